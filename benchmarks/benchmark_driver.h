@@ -0,0 +1,386 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+#ifndef dealii_benchmarks_benchmark_driver_h
+#define dealii_benchmarks_benchmark_driver_h
+
+// Common infrastructure for the matrix-free throughput benchmarks: parsing
+// of the command line, generation of the mesh, dispatch of the compile-time
+// parameters (dimension, polynomial degree, SIMD width), and the timing
+// loop that reports the results as JSON records.
+
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/multithread_info.h>
+#include <deal.II/base/revision.h>
+#include <deal.II/base/timer.h>
+#include <deal.II/base/utilities.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/distributed/tria.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria.h>
+
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+namespace Benchmarks
+{
+  using namespace dealii;
+
+#ifdef DEAL_II_WITH_P4EST
+  template <int dim>
+  using TriangulationType = parallel::distributed::Triangulation<dim>;
+#else
+  /**
+   * A serial triangulation with the same constructor as
+   * parallel::distributed::Triangulation, such that the benchmarks can be
+   * written independently of whether deal.II was configured with p4est.
+   */
+  template <int dim>
+  class TriangulationType : public Triangulation<dim>
+  {
+  public:
+    TriangulationType(const MPI_Comm comm)
+    {
+      AssertThrow(Utilities::MPI::n_mpi_processes(comm) == 1,
+                  ExcMessage("Running the benchmarks on more than one MPI "
+                             "process requires deal.II with p4est."));
+    }
+  };
+#endif
+
+
+
+  /**
+   * The run-time parameters of a benchmark, set from command line arguments
+   * of the form `--name=value`.
+   */
+  struct Parameters
+  {
+    /**
+     * Space dimension, 2 or 3.
+     */
+    unsigned int dim = 3;
+
+    /**
+     * Polynomial degree of the finite element, between 1 and 8.
+     */
+    unsigned int degree = 4;
+
+    /**
+     * Finite element type, either `FE_Q` or `FE_DGQ`. Ignored by benchmarks
+     * that only support one of the two types.
+     */
+    std::string element = "FE_Q";
+
+    /**
+     * Number of SIMD lanes of VectorizedArray<double>, where zero selects
+     * the widest width supported by the configuration of deal.II.
+     */
+    unsigned int vectorization_width = 0;
+
+    /**
+     * Maximal number of threads per MPI rank. The default is one thread,
+     * and zero selects the default of MultithreadInfo.
+     */
+    unsigned int n_threads = 1;
+
+    /**
+     * Approximate number of unknowns, used to select the mesh size.
+     */
+    types::global_dof_index n_dofs = 1000000;
+
+    /**
+     * Whether the interior vertices of the mesh should be perturbed, which
+     * leads to general (non-affine) geometry on all cells. The default are
+     * affine cells where MatrixFree compresses the geometry data.
+     */
+    bool deformed_mesh = false;
+
+    /**
+     * Number of timed operator applications in each of the repetitions.
+     */
+    unsigned int n_operations = 50;
+
+    /**
+     * Number of repetitions of the timing loop, reporting the minimum,
+     * average and maximum.
+     */
+    unsigned int n_repetitions = 5;
+
+    /**
+     * Name of the file to which the JSON records are appended, with an
+     * empty string denoting output to the screen only.
+     */
+    std::string output_file = "";
+
+    /**
+     * Parse the command line.
+     */
+    void
+    parse(const int argc, char **argv)
+    {
+      for (int i = 1; i < argc; ++i)
+        {
+          const std::string argument = argv[i];
+          const std::size_t equal    = argument.find('=');
+          const std::size_t start =
+            (argument.compare(0, 2, "--") == 0) ? 2 : 0;
+          AssertThrow(equal != std::string::npos,
+                      ExcMessage("Arguments must be given in the form "
+                                 "--name=value, got " +
+                                 argument));
+          const std::string name  = argument.substr(start, equal - start);
+          const std::string value = argument.substr(equal + 1);
+
+          if (name == "dim")
+            dim = Utilities::string_to_int(value);
+          else if (name == "degree")
+            degree = Utilities::string_to_int(value);
+          else if (name == "element")
+            element = value;
+          else if (name == "vectorization-width")
+            vectorization_width = Utilities::string_to_int(value);
+          else if (name == "threads")
+            n_threads = Utilities::string_to_int(value);
+          else if (name == "n-dofs")
+            n_dofs = static_cast<types::global_dof_index>(
+              Utilities::string_to_double(value));
+          else if (name == "deformed")
+            deformed_mesh = (value == "true" || value == "1");
+          else if (name == "operations")
+            n_operations = Utilities::string_to_int(value);
+          else if (name == "repetitions")
+            n_repetitions = Utilities::string_to_int(value);
+          else if (name == "output")
+            output_file = value;
+          else
+            AssertThrow(false,
+                        ExcMessage("Unknown parameter '" + name +
+                                   "'. Valid parameters are dim, degree, "
+                                   "element, vectorization-width, threads, "
+                                   "n-dofs, deformed, operations, "
+                                   "repetitions, and output."));
+        }
+
+      AssertThrow(dim == 2 || dim == 3,
+                  ExcMessage("Only dim=2 and dim=3 are supported."));
+      AssertThrow(degree >= 1 && degree <= 8,
+                  ExcMessage("Only degrees between 1 and 8 are supported."));
+      AssertThrow(element == "FE_Q" || element == "FE_DGQ",
+                  ExcMessage("Only FE_Q and FE_DGQ are supported."));
+      AssertThrow(n_operations > 0 && n_repetitions > 0,
+                  ExcMessage("Need at least one operation and repetition."));
+    }
+
+    /**
+     * Return the SIMD width in use, resolving the default value.
+     */
+    unsigned int
+    get_vectorization_width() const
+    {
+      return vectorization_width == 0 ? VectorizedArray<double>::size() :
+                                        vectorization_width;
+    }
+  };
+
+
+
+  /**
+   * Create a subdivided hypercube mesh on [0,1]^dim with approximately
+   * @p parameters.n_dofs unknowns for elements of degree
+   * @p parameters.degree, with the number of cells per direction being
+   * 1, 2, or 3 times a power of two. The mesh is perturbed if requested
+   * by @p parameters.deformed_mesh.
+   */
+  template <int dim>
+  void
+  create_mesh(Triangulation<dim> &tria, const Parameters &parameters)
+  {
+    unsigned int best_subdivisions = 1, best_refinements = 0;
+    double       best_distance     = std::numeric_limits<double>::max();
+    for (unsigned int refinements = 0; refinements < 12; ++refinements)
+      for (unsigned int subdivisions = 1; subdivisions <= 3; ++subdivisions)
+        {
+          const double n_cells_1d = subdivisions * (1U << refinements);
+          const double n_dofs =
+            std::pow(n_cells_1d * parameters.degree + 1., dim);
+          const double distance =
+            std::abs(std::log(n_dofs / parameters.n_dofs));
+          if (distance < best_distance)
+            {
+              best_distance     = distance;
+              best_subdivisions = subdivisions;
+              best_refinements  = refinements;
+            }
+        }
+
+    GridGenerator::subdivided_hyper_cube(tria, best_subdivisions);
+    tria.refine_global(best_refinements);
+
+    if (parameters.deformed_mesh)
+      GridTools::transform(
+        [](const Point<dim> &p) {
+          Point<dim> result = p;
+          for (unsigned int d = 0; d < dim; ++d)
+            result[d] += 0.05 * std::sin(2. * numbers::PI * p[(d + 1) % dim]);
+          return result;
+        },
+        tria);
+  }
+
+
+
+  /**
+   * Call `Runner::template run<dim, degree, VectorizedArrayType>(parameters)`
+   * with the compile-time parameters matching the run-time values in
+   * @p parameters. The SIMD width is either 1 or the widest width
+   * supported by the configuration of deal.II.
+   */
+  template <typename Runner, int dim, int degree = 1>
+  void
+  dispatch_degree(const Parameters &parameters)
+  {
+    if (parameters.degree == degree)
+      {
+        constexpr unsigned int native_width = VectorizedArray<double>::size();
+        if (parameters.get_vectorization_width() == native_width)
+          Runner::template run<dim, degree, VectorizedArray<double>>(
+            parameters);
+        else if (parameters.get_vectorization_width() == 1)
+          Runner::template run<dim, degree, VectorizedArray<double, 1>>(
+            parameters);
+        else
+          AssertThrow(false,
+                      ExcMessage("Only vectorization widths 1 and " +
+                                 std::to_string(native_width) +
+                                 " are supported in this configuration."));
+      }
+    else if constexpr (degree < 8)
+      dispatch_degree<Runner, dim, degree + 1>(parameters);
+    else
+      AssertThrow(false, ExcNotImplemented());
+  }
+
+
+
+  /**
+   * Same as above, also dispatching on the dimension.
+   */
+  template <typename Runner>
+  void
+  dispatch(const Parameters &parameters)
+  {
+    if (parameters.dim == 2)
+      dispatch_degree<Runner, 2>(parameters);
+    else
+      dispatch_degree<Runner, 3>(parameters);
+  }
+
+
+
+  /**
+   * Time the function @p operation, which is called
+   * `parameters.n_operations` times in each of `parameters.n_repetitions`
+   * repetitions, and report the throughput as a JSON record on the screen
+   * and, if requested, in the output file. The record includes the time per
+   * operation (minimum, average, and maximum over the repetitions and the
+   * MPI ranks), the throughput in unknowns per second, and the memory
+   * throughput computed from @p bytes_per_operation, the (estimated) number
+   * of bytes transferred from main memory in one operation summed over all
+   * MPI ranks.
+   */
+  inline void
+  run_and_report(const std::string &           benchmark,
+                 const Parameters &            parameters,
+                 const types::global_dof_index n_dofs,
+                 const double                  bytes_per_operation,
+                 const std::function<void()> & operation,
+                 const MPI_Comm                comm = MPI_COMM_WORLD)
+  {
+    // warm up caches and data structures set up on first use
+    operation();
+
+    std::vector<double> times(parameters.n_repetitions);
+    for (unsigned int r = 0; r < parameters.n_repetitions; ++r)
+      {
+#ifdef DEAL_II_WITH_MPI
+        const int ierr = MPI_Barrier(comm);
+        AssertThrowMPI(ierr);
+#endif
+        Timer timer;
+        for (unsigned int i = 0; i < parameters.n_operations; ++i)
+          operation();
+        times[r] = Utilities::MPI::max(timer.wall_time(), comm) /
+                   parameters.n_operations;
+      }
+
+    const double min_time = *std::min_element(times.begin(), times.end());
+    const double max_time = *std::max_element(times.begin(), times.end());
+    double       avg_time = 0;
+    for (const double t : times)
+      avg_time += t / times.size();
+
+    if (Utilities::MPI::this_mpi_process(comm) != 0)
+      return;
+
+    boost::property_tree::ptree record;
+    record.put("benchmark", benchmark);
+    record.put("revision", DEAL_II_GIT_SHORTREV);
+    record.put("dim", parameters.dim);
+    record.put("degree", parameters.degree);
+    record.put("element", parameters.element);
+    record.put("vectorization_width", parameters.get_vectorization_width());
+    record.put("vectorization_bits", DEAL_II_VECTORIZATION_WIDTH_IN_BITS);
+    record.put("n_mpi_processes", Utilities::MPI::n_mpi_processes(comm));
+    record.put("n_threads", MultithreadInfo::n_threads());
+    record.put("deformed_mesh", parameters.deformed_mesh);
+    record.put("n_dofs", n_dofs);
+    record.put("time_per_operation_min", min_time);
+    record.put("time_per_operation_avg", avg_time);
+    record.put("time_per_operation_max", max_time);
+    record.put("gdofs_per_second", 1e-9 * n_dofs / min_time);
+    record.put("gbytes_per_second", 1e-9 * bytes_per_operation / min_time);
+
+    std::ostringstream json;
+    boost::property_tree::write_json(json, record, false);
+    std::cout << json.str() << std::flush;
+
+    if (!parameters.output_file.empty())
+      {
+        std::ofstream file(parameters.output_file, std::ios::app);
+        AssertThrow(file, ExcIO());
+        file << json.str();
+      }
+  }
+} // namespace Benchmarks
+
+#endif
@@ -0,0 +1,268 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+// Throughput of a face-based matrix-free loop: the symmetric interior
+// penalty discretization of the Laplacian with FE_DGQ elements, evaluated
+// with MatrixFree::loop() over cells, interior faces and boundary faces
+// similarly to step-59. The parameter `element` is ignored.
+
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include "benchmark_driver.h"
+
+
+namespace Benchmarks
+{
+  struct DGLaplaceRunner
+  {
+    template <int dim, int degree, typename VectorizedArrayType>
+    static void
+    run(const Parameters &input_parameters)
+    {
+      using Number     = double;
+      using VectorType = LinearAlgebra::distributed::Vector<Number>;
+      using MatrixFreeType = MatrixFree<dim, Number, VectorizedArrayType>;
+
+      Parameters parameters = input_parameters;
+      parameters.element    = "FE_DGQ";
+
+      TriangulationType<dim> tria(MPI_COMM_WORLD);
+      create_mesh(tria, parameters);
+
+      const FE_DGQ<dim>   fe(degree);
+      const MappingQ<dim> mapping(parameters.deformed_mesh ? degree : 1);
+      DoFHandler<dim>     dof_handler(tria);
+      dof_handler.distribute_dofs(fe);
+
+      AffineConstraints<Number> constraints;
+      constraints.close();
+
+      typename MatrixFreeType::AdditionalData additional_data;
+      additional_data.mapping_update_flags =
+        update_gradients | update_JxW_values;
+      additional_data.mapping_update_flags_inner_faces =
+        update_gradients | update_JxW_values | update_normal_vectors;
+      additional_data.mapping_update_flags_boundary_faces =
+        update_gradients | update_JxW_values | update_normal_vectors;
+      additional_data.tasks_parallel_scheme =
+        MultithreadInfo::n_threads() > 1 ?
+          MatrixFreeType::AdditionalData::partition_partition :
+          MatrixFreeType::AdditionalData::none;
+
+      MatrixFreeType matrix_free;
+      matrix_free.reinit(mapping,
+                         dof_handler,
+                         constraints,
+                         QGauss<1>(degree + 1),
+                         additional_data);
+
+      // all cells have the same size up to the deformation, so a single
+      // penalty parameter is enough for the purpose of this benchmark
+      const Number penalty = degree * (degree + 1.) * std::sqrt(1. * dim) /
+                             GridTools::minimal_cell_diameter(tria);
+
+      const auto cell_operation = [](const MatrixFreeType &data,
+                                     VectorType &          dst,
+                                     const VectorType &    src,
+                                     const std::pair<unsigned int, unsigned int>
+                                       &cell_range) {
+        FEEvaluation<dim, degree, degree + 1, 1, Number, VectorizedArrayType>
+          phi(data);
+        for (unsigned int cell = cell_range.first; cell < cell_range.second;
+             ++cell)
+          {
+            phi.reinit(cell);
+            phi.gather_evaluate(src, EvaluationFlags::gradients);
+            for (const unsigned int q : phi.quadrature_point_indices())
+              phi.submit_gradient(phi.get_gradient(q), q);
+            phi.integrate_scatter(EvaluationFlags::gradients, dst);
+          }
+      };
+
+      const auto face_operation = [penalty](
+                                    const MatrixFreeType &data,
+                                    VectorType &          dst,
+                                    const VectorType &    src,
+                                    const std::pair<unsigned int, unsigned int>
+                                      &face_range) {
+        FEFaceEvaluation<dim,
+                         degree,
+                         degree + 1,
+                         1,
+                         Number,
+                         VectorizedArrayType>
+          phi_inner(data, true), phi_outer(data, false);
+        for (unsigned int face = face_range.first; face < face_range.second;
+             ++face)
+          {
+            phi_inner.reinit(face);
+            phi_inner.gather_evaluate(src,
+                                      EvaluationFlags::values |
+                                        EvaluationFlags::gradients);
+            phi_outer.reinit(face);
+            phi_outer.gather_evaluate(src,
+                                      EvaluationFlags::values |
+                                        EvaluationFlags::gradients);
+
+            for (const unsigned int q : phi_inner.quadrature_point_indices())
+              {
+                const VectorizedArrayType solution_jump =
+                  phi_inner.get_value(q) - phi_outer.get_value(q);
+                const VectorizedArrayType average_normal_derivative =
+                  (phi_inner.get_normal_derivative(q) +
+                   phi_outer.get_normal_derivative(q)) *
+                  Number(0.5);
+                const VectorizedArrayType test_by_value =
+                  solution_jump * penalty - average_normal_derivative;
+
+                phi_inner.submit_value(test_by_value, q);
+                phi_outer.submit_value(-test_by_value, q);
+
+                phi_inner.submit_normal_derivative(-solution_jump * Number(0.5),
+                                                   q);
+                phi_outer.submit_normal_derivative(-solution_jump * Number(0.5),
+                                                   q);
+              }
+
+            phi_inner.integrate_scatter(EvaluationFlags::values |
+                                          EvaluationFlags::gradients,
+                                        dst);
+            phi_outer.integrate_scatter(EvaluationFlags::values |
+                                          EvaluationFlags::gradients,
+                                        dst);
+          }
+      };
+
+      const auto boundary_operation =
+        [penalty](const MatrixFreeType &                       data,
+                  VectorType &                                 dst,
+                  const VectorType &                           src,
+                  const std::pair<unsigned int, unsigned int> &face_range) {
+          FEFaceEvaluation<dim,
+                           degree,
+                           degree + 1,
+                           1,
+                           Number,
+                           VectorizedArrayType>
+            phi_inner(data, true);
+          for (unsigned int face = face_range.first; face < face_range.second;
+               ++face)
+            {
+              phi_inner.reinit(face);
+              phi_inner.gather_evaluate(src,
+                                        EvaluationFlags::values |
+                                          EvaluationFlags::gradients);
+
+              // homogeneous Dirichlet conditions imposed weakly
+              for (const unsigned int q : phi_inner.quadrature_point_indices())
+                {
+                  const VectorizedArrayType solution_jump =
+                    Number(2.) * phi_inner.get_value(q);
+                  const VectorizedArrayType test_by_value =
+                    solution_jump * penalty -
+                    phi_inner.get_normal_derivative(q);
+
+                  phi_inner.submit_value(test_by_value, q);
+                  phi_inner.submit_normal_derivative(-solution_jump *
+                                                       Number(0.5),
+                                                     q);
+                }
+              phi_inner.integrate_scatter(EvaluationFlags::values |
+                                            EvaluationFlags::gradients,
+                                          dst);
+            }
+        };
+
+      VectorType src, dst;
+      matrix_free.initialize_dof_vector(src);
+      matrix_free.initialize_dof_vector(dst);
+      src = 1.;
+
+      // estimate the memory transfer by reading the source vector including
+      // its ghost entries once, writing the destination vector once, and
+      // reading the index and geometry data once
+      const types::global_dof_index n_dofs = dof_handler.n_dofs();
+      const double                  bytes =
+        Utilities::MPI::sum(
+          static_cast<double>(src.get_partitioner()->n_ghost_indices()),
+          MPI_COMM_WORLD) *
+          sizeof(Number) +
+        2. * sizeof(Number) * static_cast<double>(n_dofs) +
+        Utilities::MPI::sum(
+          static_cast<double>(
+            matrix_free.get_dof_info().memory_consumption() +
+            matrix_free.get_mapping_info().memory_consumption()),
+          MPI_COMM_WORLD);
+
+      run_and_report("dg_laplace_loop", parameters, n_dofs, bytes, [&]() {
+        matrix_free.template loop<VectorType, VectorType>(
+          cell_operation,
+          face_operation,
+          boundary_operation,
+          dst,
+          src,
+          true,
+          MatrixFreeType::DataAccessOnFaces::gradients,
+          MatrixFreeType::DataAccessOnFaces::gradients);
+      });
+    }
+  };
+} // namespace Benchmarks
+
+
+
+int
+main(int argc, char **argv)
+{
+  try
+    {
+      Benchmarks::Parameters parameters;
+      parameters.parse(argc, argv);
+
+      dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(
+        argc,
+        argv,
+        parameters.n_threads == 0 ? dealii::numbers::invalid_unsigned_int :
+                                    parameters.n_threads);
+
+      Benchmarks::dispatch<Benchmarks::DGLaplaceRunner>(parameters);
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+
+  return 0;
+}
@@ -0,0 +1,204 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+// Throughput of the cell-based matrix-free operators: the matrix-vector
+// products of MatrixFreeOperators::LaplaceOperator and
+// MatrixFreeOperators::MassOperator as well as a PreconditionChebyshev
+// smoother around the Laplace operator as used in step-37.
+
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/diagonal_matrix.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/precondition.h>
+
+#include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/matrix_free/operators.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include <memory>
+
+#include "benchmark_driver.h"
+
+
+namespace Benchmarks
+{
+  struct OperatorRunner
+  {
+    template <int dim, int degree, typename VectorizedArrayType>
+    static void
+    run(const Parameters &parameters)
+    {
+      using VectorType = LinearAlgebra::distributed::Vector<double>;
+
+      TriangulationType<dim> tria(MPI_COMM_WORLD);
+      create_mesh(tria, parameters);
+
+      std::unique_ptr<FiniteElement<dim>> fe;
+      if (parameters.element == "FE_Q")
+        fe = std::make_unique<FE_Q<dim>>(degree);
+      else
+        fe = std::make_unique<FE_DGQ<dim>>(degree);
+
+      const MappingQ<dim> mapping(parameters.deformed_mesh ? degree : 1);
+      DoFHandler<dim>     dof_handler(tria);
+      dof_handler.distribute_dofs(*fe);
+
+      AffineConstraints<double> constraints;
+      constraints.reinit(DoFTools::extract_locally_relevant_dofs(dof_handler));
+      if (parameters.element == "FE_Q")
+        DoFTools::make_zero_boundary_constraints(dof_handler, constraints);
+      constraints.close();
+
+      typename MatrixFree<dim, double, VectorizedArrayType>::AdditionalData
+        additional_data;
+      additional_data.mapping_update_flags =
+        update_values | update_gradients | update_JxW_values;
+      additional_data.tasks_parallel_scheme =
+        MultithreadInfo::n_threads() > 1 ?
+          MatrixFree<dim, double, VectorizedArrayType>::AdditionalData::
+            partition_partition :
+          MatrixFree<dim, double, VectorizedArrayType>::AdditionalData::none;
+
+      const auto matrix_free =
+        std::make_shared<MatrixFree<dim, double, VectorizedArrayType>>();
+      matrix_free->reinit(mapping,
+                          dof_handler,
+                          constraints,
+                          QGauss<1>(degree + 1),
+                          additional_data);
+
+      // estimate the memory transfer of a single operator evaluation by
+      // reading either vector once, writing the destination vector once,
+      // and reading the index and geometry data once
+      const types::global_dof_index n_dofs = dof_handler.n_dofs();
+      const double                  bytes_vectors =
+        3. * sizeof(double) * static_cast<double>(n_dofs);
+      const double bytes_data = Utilities::MPI::sum(
+        static_cast<double>(
+          matrix_free->get_dof_info().memory_consumption() +
+          matrix_free->get_mapping_info().memory_consumption()),
+        MPI_COMM_WORLD);
+
+      using LaplaceOperatorType =
+        MatrixFreeOperators::LaplaceOperator<dim,
+                                             degree,
+                                             degree + 1,
+                                             1,
+                                             VectorType,
+                                             VectorizedArrayType>;
+      using MassOperatorType =
+        MatrixFreeOperators::MassOperator<dim,
+                                          degree,
+                                          degree + 1,
+                                          1,
+                                          VectorType,
+                                          VectorizedArrayType>;
+
+      VectorType src, dst;
+
+      {
+        LaplaceOperatorType laplace_operator;
+        laplace_operator.initialize(matrix_free);
+        laplace_operator.initialize_dof_vector(src);
+        laplace_operator.initialize_dof_vector(dst);
+        src = 1.;
+
+        run_and_report("laplace_vmult",
+                       parameters,
+                       n_dofs,
+                       bytes_vectors + bytes_data,
+                       [&]() { laplace_operator.vmult(dst, src); });
+
+        laplace_operator.compute_diagonal();
+        using ChebyshevType =
+          PreconditionChebyshev<LaplaceOperatorType,
+                                VectorType,
+                                DiagonalMatrix<VectorType>>;
+        typename ChebyshevType::AdditionalData chebyshev_data;
+        chebyshev_data.degree              = 5;
+        chebyshev_data.smoothing_range     = 20.;
+        chebyshev_data.eig_cg_n_iterations = 20;
+        chebyshev_data.preconditioner =
+          laplace_operator.get_matrix_diagonal_inverse();
+        ChebyshevType chebyshev;
+        chebyshev.initialize(laplace_operator, chebyshev_data);
+
+        // the Chebyshev iteration additionally reads the diagonal and two
+        // auxiliary vectors in each step
+        run_and_report("chebyshev_vmult_degree_5",
+                       parameters,
+                       n_dofs,
+                       chebyshev_data.degree *
+                         (bytes_vectors * 2 + bytes_data),
+                       [&]() { chebyshev.vmult(dst, src); });
+      }
+
+      {
+        MassOperatorType mass_operator;
+        mass_operator.initialize(matrix_free);
+        run_and_report("mass_vmult",
+                       parameters,
+                       n_dofs,
+                       bytes_vectors + bytes_data,
+                       [&]() { mass_operator.vmult(dst, src); });
+      }
+    }
+  };
+} // namespace Benchmarks
+
+
+
+int
+main(int argc, char **argv)
+{
+  try
+    {
+      Benchmarks::Parameters parameters;
+      parameters.parse(argc, argv);
+
+      dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(
+        argc,
+        argv,
+        parameters.n_threads == 0 ? dealii::numbers::invalid_unsigned_int :
+                                    parameters.n_threads);
+
+      Benchmarks::dispatch<Benchmarks::OperatorRunner>(parameters);
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+
+  return 0;
+}
@@ -0,0 +1,163 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+// Throughput of the polynomial transfer of MGTwoLevelTransfer as used by
+// MGTransferGlobalCoarsening, between elements of degree `degree` and
+// max(1, degree/2) on the same mesh (bisection of the degree). The
+// throughput is reported in terms of the unknowns on the fine level. The
+// parameter `vectorization-width` is ignored because the transfer always
+// uses the widest SIMD width.
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/multigrid/mg_transfer_global_coarsening.h>
+
+#include <memory>
+
+#include "benchmark_driver.h"
+
+
+namespace Benchmarks
+{
+  struct TransferRunner
+  {
+    template <int dim, int degree, typename VectorizedArrayType>
+    static void
+    run(const Parameters &parameters)
+    {
+      using VectorType = LinearAlgebra::distributed::Vector<double>;
+
+      TriangulationType<dim> tria(MPI_COMM_WORLD);
+      create_mesh(tria, parameters);
+
+      const unsigned int degree_coarse = std::max(1, degree / 2);
+
+      std::unique_ptr<FiniteElement<dim>> fe_fine, fe_coarse;
+      if (parameters.element == "FE_Q")
+        {
+          fe_fine   = std::make_unique<FE_Q<dim>>(degree);
+          fe_coarse = std::make_unique<FE_Q<dim>>(degree_coarse);
+        }
+      else
+        {
+          fe_fine   = std::make_unique<FE_DGQ<dim>>(degree);
+          fe_coarse = std::make_unique<FE_DGQ<dim>>(degree_coarse);
+        }
+
+      DoFHandler<dim> dof_fine(tria), dof_coarse(tria);
+      dof_fine.distribute_dofs(*fe_fine);
+      dof_coarse.distribute_dofs(*fe_coarse);
+
+      AffineConstraints<double> constraints_fine, constraints_coarse;
+      constraints_fine.reinit(
+        DoFTools::extract_locally_relevant_dofs(dof_fine));
+      constraints_coarse.reinit(
+        DoFTools::extract_locally_relevant_dofs(dof_coarse));
+      if (parameters.element == "FE_Q")
+        {
+          DoFTools::make_zero_boundary_constraints(dof_fine, constraints_fine);
+          DoFTools::make_zero_boundary_constraints(dof_coarse,
+                                                   constraints_coarse);
+        }
+      constraints_fine.close();
+      constraints_coarse.close();
+
+      MGTwoLevelTransfer<dim, VectorType> transfer;
+      transfer.reinit_polynomial_transfer(dof_fine,
+                                          dof_coarse,
+                                          constraints_fine,
+                                          constraints_coarse);
+
+      VectorType vec_fine(dof_fine.locally_owned_dofs(),
+                          DoFTools::extract_locally_relevant_dofs(dof_fine),
+                          MPI_COMM_WORLD);
+      VectorType vec_coarse(dof_coarse.locally_owned_dofs(),
+                            DoFTools::extract_locally_relevant_dofs(
+                              dof_coarse),
+                            MPI_COMM_WORLD);
+      vec_fine   = 1.;
+      vec_coarse = 1.;
+
+      // estimate the memory transfer by reading the source vector once,
+      // reading and writing the destination vector once, and reading the
+      // index data of the transfer once
+      const types::global_dof_index n_dofs = dof_fine.n_dofs();
+      const double                  bytes =
+        sizeof(double) * (static_cast<double>(dof_fine.n_dofs()) +
+                          static_cast<double>(dof_coarse.n_dofs())) *
+          1.5 +
+        Utilities::MPI::sum(static_cast<double>(transfer.memory_consumption()),
+                            MPI_COMM_WORLD);
+
+      run_and_report("mg_transfer_prolongate_and_add",
+                     parameters,
+                     n_dofs,
+                     bytes,
+                     [&]() {
+                       transfer.prolongate_and_add(vec_fine, vec_coarse);
+                     });
+
+      run_and_report("mg_transfer_restrict_and_add",
+                     parameters,
+                     n_dofs,
+                     bytes,
+                     [&]() {
+                       transfer.restrict_and_add(vec_coarse, vec_fine);
+                     });
+    }
+  };
+} // namespace Benchmarks
+
+
+
+int
+main(int argc, char **argv)
+{
+  try
+    {
+      Benchmarks::Parameters parameters;
+      parameters.parse(argc, argv);
+
+      dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(
+        argc,
+        argv,
+        parameters.n_threads == 0 ? dealii::numbers::invalid_unsigned_int :
+                                    parameters.n_threads);
+
+      Benchmarks::dispatch<Benchmarks::TransferRunner>(parameters);
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+
+  return 0;
+}
@@ -51,7 +51,9 @@
 #
 #     DEAL_II_WITH_64BIT_INDICES
 #     DEAL_II_WITH_COMPLEX_VALUES
+#     DEAL_II_WITH_TRACING
 #     DEAL_II_COMPILE_EXAMPLES
+#     DEAL_II_FE_EVAL_FACTORY_DEGREE_MAX
 #     DEAL_II_DOXYGEN_USE_MATHJAX
 #     DEAL_II_DOXYGEN_USE_ONLINE_MATHJAX
 #     DEAL_II_CPACK_EXTERNAL_LIBS
@@ -336,12 +338,31 @@ option(DEAL_II_WITH_COMPLEX_VALUES
   )
 list(APPEND DEAL_II_FEATURES COMPLEX_VALUES)
 
+option(DEAL_II_WITH_TRACING
+  "If set to ON, the library records the begin and end of selected operations such as matrix-free loops, ghost exchanges, and linear solvers while Tracing::start() is active, for export in the Chrome trace event format. The default is OFF, in which case the instrumentation is compiled out."
+  OFF
+  )
+list(APPEND DEAL_II_FEATURES TRACING)
+
 option(DEAL_II_COMPILE_EXAMPLES
   "If set to ON, all configurable example executables will be built and installed as well. If set to OFF, the examples component only installs the source code of example steps."
   ON
   )
 mark_as_advanced(DEAL_II_COMPILE_EXAMPLES)
 
+set(DEAL_II_FE_EVAL_FACTORY_DEGREE_MAX "6" CACHE STRING
+  "The largest polynomial degree for which the library pre-compiles the fast evaluation kernels used by FEEvaluation and FEFaceEvaluation with runtime polynomial degree (template argument fe_degree = -1). Higher values increase the compile time and size of the library."
+  )
+mark_as_advanced(DEAL_II_FE_EVAL_FACTORY_DEGREE_MAX)
+
+if(NOT DEAL_II_FE_EVAL_FACTORY_DEGREE_MAX MATCHES "^[1-9][0-9]*$")
+  message(FATAL_ERROR "
+DEAL_II_FE_EVAL_FACTORY_DEGREE_MAX must be a positive integer, but it is set
+to \"${DEAL_II_FE_EVAL_FACTORY_DEGREE_MAX}\".
+"
+    )
+endif()
+
 option(DEAL_II_DOXYGEN_USE_MATHJAX
   "If set to ON, doxygen documentation is generated using mathjax"
   OFF
@@ -144,6 +144,7 @@ if(CMAKE_BUILD_TYPE MATCHES "Debug")
   _detailed("#        DEAL_II_LIBRARIES_DEBUG:      ${BASE_LIBRARIES_DEBUG}\n")
 endif()
 _detailed("#        DEAL_II_VECTORIZATION_WIDTH_IN_BITS: ${DEAL_II_VECTORIZATION_WIDTH_IN_BITS}\n")
+_detailed("#        DEAL_II_FE_EVAL_FACTORY_DEGREE_MAX: ${DEAL_II_FE_EVAL_FACTORY_DEGREE_MAX}\n")
 
 if(DEAL_II_HAVE_CXX20)
   _detailed("#        DEAL_II_HAVE_CXX20\n")
@@ -340,6 +340,52 @@ namespace python
     compute_aspect_ratio_of_cells(const MappingQWrapper &  mapping,
                                   const QuadratureWrapper &quadrature);
 
+    /**
+     * Return the coordinates of all vertices of the Triangulation, as a list
+     * with one list of spacedim coordinates per vertex. Unused vertices are
+     * included so that the position in the list is the vertex index.
+     */
+    boost::python::list
+    get_vertices() const;
+
+    /**
+     * Return the indices of the vertices of all active cells, as a list with
+     * one list of vertex indices per active cell in the order of
+     * active_cells().
+     */
+    boost::python::list
+    get_active_cell_vertex_indices() const;
+
+    /**
+     * Return the centers of all active cells, as a list with one list of
+     * spacedim coordinates per active cell in the order of active_cells().
+     */
+    boost::python::list
+    compute_active_cell_centers() const;
+
+    /**
+     * Return the measures of all active cells in the order of
+     * active_cells().
+     */
+    boost::python::list
+    compute_active_cell_measures() const;
+
+    /**
+     * Flag the active cells for isotropic refinement for which the entry of
+     * @p flags, given in the order of active_cells(), is true, and clear the
+     * refinement flags of all other active cells.
+     */
+    void
+    set_refine_flags(const boost::python::list &flags);
+
+    /**
+     * Flag the active cells for coarsening for which the entry of @p flags,
+     * given in the order of active_cells(), is true, and clear the
+     * coarsening flags of all other active cells.
+     */
+    void
+    set_coarsen_flags(const boost::python::list &flags);
+
     /**
      * Write mesh to the output file @filename according to the given data
      * format.
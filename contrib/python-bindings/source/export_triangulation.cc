@@ -470,6 +470,45 @@ namespace python
 
 
 
+  const char get_vertices_docstring[] =
+    "Return the coordinates of all vertices, one list of coordinates per    \n"
+    "vertex. Unused vertices are included so that the position in the list  \n"
+    "is the vertex index.                                                   \n";
+
+
+
+  const char get_active_cell_vertex_indices_docstring[] =
+    "Return the vertex indices of all active cells, one list per cell in    \n"
+    "the order of active_cells().                                           \n";
+
+
+
+  const char compute_active_cell_centers_docstring[] =
+    "Return the centers of all active cells, one list of coordinates per    \n"
+    "cell in the order of active_cells().                                   \n";
+
+
+
+  const char compute_active_cell_measures_docstring[] =
+    "Return the measures of all active cells in the order of                \n"
+    "active_cells().                                                        \n";
+
+
+
+  const char set_refine_flags_docstring[] =
+    "Flag the active cells for isotropic refinement whose entry in the      \n"
+    "given list of booleans, in the order of active_cells(), is true, and   \n"
+    "clear the refinement flags of all other active cells.                  \n";
+
+
+
+  const char set_coarsen_flags_docstring[] =
+    "Flag the active cells for coarsening whose entry in the given list of  \n"
+    "booleans, in the order of active_cells(), is true, and clear the       \n"
+    "coarsening flags of all other active cells.                            \n";
+
+
+
   const char minimal_cell_diameter_docstring[] =
     "Return the diameter of the smallest active cell of a triangulation.    \n";
 
@@ -689,6 +728,30 @@ namespace python
            &TriangulationWrapper::compute_aspect_ratio_of_cells,
            compute_aspect_ratio_of_cells_docstring,
            boost::python::args("self", "mapping", "quadrature"))
+      .def("get_vertices",
+           &TriangulationWrapper::get_vertices,
+           get_vertices_docstring,
+           boost::python::args("self"))
+      .def("get_active_cell_vertex_indices",
+           &TriangulationWrapper::get_active_cell_vertex_indices,
+           get_active_cell_vertex_indices_docstring,
+           boost::python::args("self"))
+      .def("compute_active_cell_centers",
+           &TriangulationWrapper::compute_active_cell_centers,
+           compute_active_cell_centers_docstring,
+           boost::python::args("self"))
+      .def("compute_active_cell_measures",
+           &TriangulationWrapper::compute_active_cell_measures,
+           compute_active_cell_measures_docstring,
+           boost::python::args("self"))
+      .def("set_refine_flags",
+           &TriangulationWrapper::set_refine_flags,
+           set_refine_flags_docstring,
+           boost::python::args("self", "flags"))
+      .def("set_coarsen_flags",
+           &TriangulationWrapper::set_coarsen_flags,
+           set_coarsen_flags_docstring,
+           boost::python::args("self", "flags"))
       .def("refine_global",
            &TriangulationWrapper::refine_global,
            refine_global_docstring,
@@ -721,6 +721,128 @@ namespace python
 
 
 
+    template <int dim, int spacedim>
+    boost::python::list
+    get_vertices(const void *triangulation)
+    {
+      const Triangulation<dim, spacedim> *tria =
+        static_cast<const Triangulation<dim, spacedim> *>(triangulation);
+
+      boost::python::list vertices;
+      for (const Point<spacedim> &vertex : tria->get_vertices())
+        {
+          boost::python::list coordinates;
+          for (int d = 0; d < spacedim; ++d)
+            coordinates.append(vertex[d]);
+          vertices.append(coordinates);
+        }
+
+      return vertices;
+    }
+
+
+
+    template <int dim, int spacedim>
+    boost::python::list
+    get_active_cell_vertex_indices(const void *triangulation)
+    {
+      const Triangulation<dim, spacedim> *tria =
+        static_cast<const Triangulation<dim, spacedim> *>(triangulation);
+
+      boost::python::list cells_vertices;
+      for (const auto &cell : tria->active_cell_iterators())
+        {
+          boost::python::list vertex_indices;
+          for (const unsigned int v : cell->vertex_indices())
+            vertex_indices.append(cell->vertex_index(v));
+          cells_vertices.append(vertex_indices);
+        }
+
+      return cells_vertices;
+    }
+
+
+
+    template <int dim, int spacedim>
+    boost::python::list
+    compute_active_cell_centers(const void *triangulation)
+    {
+      const Triangulation<dim, spacedim> *tria =
+        static_cast<const Triangulation<dim, spacedim> *>(triangulation);
+
+      boost::python::list centers;
+      for (const auto &cell : tria->active_cell_iterators())
+        {
+          const Point<spacedim> center = cell->center();
+          boost::python::list   coordinates;
+          for (int d = 0; d < spacedim; ++d)
+            coordinates.append(center[d]);
+          centers.append(coordinates);
+        }
+
+      return centers;
+    }
+
+
+
+    template <int dim, int spacedim>
+    boost::python::list
+    compute_active_cell_measures(const void *triangulation)
+    {
+      const Triangulation<dim, spacedim> *tria =
+        static_cast<const Triangulation<dim, spacedim> *>(triangulation);
+
+      boost::python::list measures;
+      for (const auto &cell : tria->active_cell_iterators())
+        measures.append(cell->measure());
+
+      return measures;
+    }
+
+
+
+    template <int dim, int spacedim>
+    void
+    set_refine_flags(const boost::python::list &flags, void *triangulation)
+    {
+      Triangulation<dim, spacedim> *tria =
+        static_cast<Triangulation<dim, spacedim> *>(triangulation);
+
+      AssertThrow(static_cast<unsigned int>(boost::python::len(flags)) ==
+                    tria->n_active_cells(),
+                  ExcMessage("The number of flags must be equal to the "
+                             "number of active cells."));
+
+      for (const auto &cell : tria->active_cell_iterators())
+        if (boost::python::extract<bool>(flags[cell->active_cell_index()]))
+          cell->set_refine_flag();
+        else
+          cell->clear_refine_flag();
+    }
+
+
+
+    template <int dim, int spacedim>
+    void
+    set_coarsen_flags(const boost::python::list &flags, void *triangulation)
+    {
+      Triangulation<dim, spacedim> *tria =
+        static_cast<Triangulation<dim, spacedim> *>(triangulation);
+
+      AssertThrow(static_cast<unsigned int>(boost::python::len(flags)) ==
+                    tria->n_active_cells(),
+                  ExcMessage("The number of flags must be equal to the "
+                             "number of active cells."));
+
+      for (const auto &cell : tria->active_cell_iterators())
+        if (boost::python::extract<bool>(flags[cell->active_cell_index()]))
+          cell->set_coarsen_flag();
+        else
+          cell->clear_coarsen_flag();
+    }
+
+
+
     template <int dim, int spacedim>
     boost::python::list
     active_cells(TriangulationWrapper &triangulation_wrapper)
@@ -1717,6 +1839,84 @@ namespace python
 
 
 
+  boost::python::list
+  TriangulationWrapper::get_vertices() const
+  {
+    if ((dim == 2) && (spacedim == 2))
+      return internal::get_vertices<2, 2>(triangulation);
+    else if ((dim == 2) && (spacedim == 3))
+      return internal::get_vertices<2, 3>(triangulation);
+    else
+      return internal::get_vertices<3, 3>(triangulation);
+  }
+
+
+
+  boost::python::list
+  TriangulationWrapper::get_active_cell_vertex_indices() const
+  {
+    if ((dim == 2) && (spacedim == 2))
+      return internal::get_active_cell_vertex_indices<2, 2>(triangulation);
+    else if ((dim == 2) && (spacedim == 3))
+      return internal::get_active_cell_vertex_indices<2, 3>(triangulation);
+    else
+      return internal::get_active_cell_vertex_indices<3, 3>(triangulation);
+  }
+
+
+
+  boost::python::list
+  TriangulationWrapper::compute_active_cell_centers() const
+  {
+    if ((dim == 2) && (spacedim == 2))
+      return internal::compute_active_cell_centers<2, 2>(triangulation);
+    else if ((dim == 2) && (spacedim == 3))
+      return internal::compute_active_cell_centers<2, 3>(triangulation);
+    else
+      return internal::compute_active_cell_centers<3, 3>(triangulation);
+  }
+
+
+
+  boost::python::list
+  TriangulationWrapper::compute_active_cell_measures() const
+  {
+    if ((dim == 2) && (spacedim == 2))
+      return internal::compute_active_cell_measures<2, 2>(triangulation);
+    else if ((dim == 2) && (spacedim == 3))
+      return internal::compute_active_cell_measures<2, 3>(triangulation);
+    else
+      return internal::compute_active_cell_measures<3, 3>(triangulation);
+  }
+
+
+
+  void
+  TriangulationWrapper::set_refine_flags(const boost::python::list &flags)
+  {
+    if ((dim == 2) && (spacedim == 2))
+      internal::set_refine_flags<2, 2>(flags, triangulation);
+    else if ((dim == 2) && (spacedim == 3))
+      internal::set_refine_flags<2, 3>(flags, triangulation);
+    else
+      internal::set_refine_flags<3, 3>(flags, triangulation);
+  }
+
+
+
+  void
+  TriangulationWrapper::set_coarsen_flags(const boost::python::list &flags)
+  {
+    if ((dim == 2) && (spacedim == 2))
+      internal::set_coarsen_flags<2, 2>(flags, triangulation);
+    else if ((dim == 2) && (spacedim == 3))
+      internal::set_coarsen_flags<2, 3>(flags, triangulation);
+    else
+      internal::set_coarsen_flags<3, 3>(flags, triangulation);
+  }
+
+
+
   void
   TriangulationWrapper::refine_global(const unsigned int n)
   {
@@ -463,6 +463,36 @@ class TestTriangulationWrapper(unittest.TestCase):
             else:
                 self.assertEqual(n_cells, 8)
 
+    def test_bulk_queries(self):
+        for dim in self.dim:
+            triangulation = self.build_hyper_cube_triangulation(dim)
+            triangulation.refine_global(1)
+            n_cells = triangulation.n_active_cells()
+
+            centers = triangulation.compute_active_cell_centers()
+            measures = triangulation.compute_active_cell_measures()
+            cells_vertices = triangulation.get_active_cell_vertex_indices()
+            vertices = triangulation.get_vertices()
+            self.assertEqual(len(centers), n_cells)
+            self.assertEqual(len(measures), n_cells)
+            self.assertEqual(len(cells_vertices), n_cells)
+            for cell, center, measure, cell_vertices in \
+                    zip(triangulation.active_cells(), centers, measures,
+                        cells_vertices):
+                self.assertAlmostEqual(measure, cell.measure())
+                self.assertEqual(len(center), len(vertices[0]))
+                for d in range(len(center)):
+                    average = sum(vertices[v][d] for v in cell_vertices) / \
+                        len(cell_vertices)
+                    self.assertAlmostEqual(center[d], average)
+
+            flags = [i % 2 == 0 for i in range(n_cells)]
+            triangulation.set_refine_flags(flags)
+            triangulation.execute_coarsening_and_refinement()
+            n_children = 4 if dim[0] == '2D' else 8
+            self.assertEqual(triangulation.n_active_cells(),
+                             n_cells + (n_children - 1) * ((n_cells + 1) // 2))
+
 
 if __name__ == '__main__':
     unittest.main()
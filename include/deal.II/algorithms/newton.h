@@ -66,7 +66,35 @@ namespace Algorithms
    * at this point.
    *
    * For the call to (*#inverse_derivative), the vector <tt>"Newton
-   * residual"</tt> is inserted before <tt>"Newton iterate"</tt>.
+   * residual"</tt> is inserted before <tt>"Newton iterate"</tt>, and an
+   * entry of type <tt>const double*</tt> named <tt>"Newton forcing
+   * term"</tt> is appended. It points to the relative tolerance to which
+   * the linear system needs to be solved, see below.
+   *
+   * <h3>Inexact Newton method</h3>
+   *
+   * Solving the linear systems in the first Newton steps more accurately
+   * than the nonlinear residual warrants wastes iterations of the inner
+   * solver. If #adaptive_forcing is set, the forcing term, i.e., the
+   * tolerance for the reduction of the linear residual in step <i>k</i>, is
+   * chosen according to the second choice of Eisenstat and Walker,
+   * @f[
+   *   \eta_k = \gamma \left(\frac{\|F(u_k)\|}{\|F(u_{k-1})\|}
+   *   \right)^\alpha,
+   * @f]
+   * safeguarded from below by $\gamma\eta_{k-1}^\alpha$ if this value is
+   * larger than 0.1, and by half the ratio of the tolerance of #control and
+   * the current residual, and from above by #max_forcing_term, which is
+   * also used in the first step. Without #adaptive_forcing, the forcing term
+   * is zero, and the inner solver uses its own tolerance. An inner solver
+   * makes use of the forcing term by reading it from its <tt>in</tt>
+   * argument:
+   * @code
+   *   const double *forcing_term =
+   *     in.try_read_ptr<double>("Newton forcing term");
+   *   if (forcing_term != nullptr && *forcing_term > 0.)
+   *     solver_control.set_reduction(*forcing_term);
+   * @endcode
    */
   template <typename VectorType>
   class Newton : public OperatorBase
@@ -167,6 +195,37 @@ namespace Algorithms
      */
     double assemble_threshold;
 
+    /**
+     * Choose the forcing terms adaptively as described in the documentation
+     * of this class.
+     *
+     * The default value is false.
+     *
+     * @note Controlled by <tt>Adaptive forcing</tt> in parameter file
+     */
+    bool adaptive_forcing;
+
+    /**
+     * The largest forcing term, also used in the first step.
+     *
+     * @note Controlled by <tt>Maximal forcing term</tt> in parameter file
+     */
+    double max_forcing_term;
+
+    /**
+     * The factor $\gamma$ in the choice of the forcing terms.
+     *
+     * @note Controlled by <tt>Forcing gamma</tt> in parameter file
+     */
+    double forcing_gamma;
+
+    /**
+     * The exponent $\alpha$ in the choice of the forcing terms.
+     *
+     * @note Controlled by <tt>Forcing alpha</tt> in parameter file
+     */
+    double forcing_alpha;
+
   public:
     /**
      * Print residual, update and updated solution after each step into file
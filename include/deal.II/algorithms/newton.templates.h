@@ -26,6 +26,8 @@
 
 #include <deal.II/lac/vector_memory.h>
 
+#include <algorithm>
+#include <cmath>
 #include <iomanip>
 
 
@@ -41,6 +43,10 @@ namespace Algorithms
     , assemble_now(false)
     , n_stepsize_iterations(21)
     , assemble_threshold(0.)
+    , adaptive_forcing(false)
+    , max_forcing_term(0.9)
+    , forcing_gamma(0.9)
+    , forcing_alpha(2.)
     , debug_vectors(false)
     , debug(0)
   {}
@@ -54,6 +60,12 @@ namespace Algorithms
     ReductionControl::declare_parameters(param);
     param.declare_entry("Assemble threshold", "0.", Patterns::Double(0.));
     param.declare_entry("Stepsize iterations", "21", Patterns::Integer(0));
+    param.declare_entry("Adaptive forcing", "false", Patterns::Bool());
+    param.declare_entry("Maximal forcing term",
+                        "0.9",
+                        Patterns::Double(0., 1.));
+    param.declare_entry("Forcing gamma", "0.9", Patterns::Double(0., 1.));
+    param.declare_entry("Forcing alpha", "2.", Patterns::Double(1., 2.));
     param.declare_entry("Debug level", "0", Patterns::Integer(0));
     param.declare_entry("Debug vectors", "false", Patterns::Bool());
     param.leave_subsection();
@@ -67,6 +79,10 @@ namespace Algorithms
     control.parse_parameters(param);
     assemble_threshold    = param.get_double("Assemble threshold");
     n_stepsize_iterations = param.get_integer("Stepsize iterations");
+    adaptive_forcing      = param.get_bool("Adaptive forcing");
+    max_forcing_term      = param.get_double("Maximal forcing term");
+    forcing_gamma         = param.get_double("Forcing gamma");
+    forcing_alpha         = param.get_double("Forcing alpha");
     debug                 = param.get_integer("Debug level");
     debug_vectors         = param.get_bool("Debug vectors");
     param.leave_subsection();
@@ -116,12 +132,14 @@ namespace Algorithms
 
     Du->reinit(u);
     res->reinit(u);
+    double  forcing_term = 0.;
     AnyData src1;
     AnyData src2;
     src1.add<const VectorType *>(&u, "Newton iterate");
     src1.merge(in);
     src2.add<const VectorType *>(res.get(), "Newton residual");
     src2.merge(src1);
+    src2.add<const double *>(&forcing_term, "Newton forcing term");
     AnyData out1;
     out1.add<VectorType *>(res.get(), "Residual");
     AnyData out2;
@@ -152,6 +170,29 @@ namespace Algorithms
         if ((step > 1) && (resnorm / old_residual >= assemble_threshold))
           inverse_derivative->notify(Events::bad_derivative);
 
+        if (adaptive_forcing)
+          {
+            if (step == 1)
+              forcing_term = max_forcing_term;
+            else
+              {
+                const double safeguard =
+                  forcing_gamma * std::pow(forcing_term, forcing_alpha);
+                forcing_term =
+                  forcing_gamma *
+                  std::pow(resnorm / old_residual, forcing_alpha);
+                if (safeguard > 0.1)
+                  forcing_term = std::max(forcing_term, safeguard);
+              }
+            // Do not solve more accurately than needed to reach the
+            // tolerance of the Newton iteration in this step
+            forcing_term = std::min(
+              max_forcing_term,
+              std::max(forcing_term, 0.5 * control.tolerance() / resnorm));
+            if (debug > 0)
+              deallog << "Forcing term: " << forcing_term << std::endl;
+          }
+
         Du->reinit(u);
         try
           {
@@ -469,14 +469,15 @@ private:
    * AlignedVector uses to store the memory used for the elements.
    *
    * There are two ways the AlignedVector class can handle memory:
-   * - Allocation via `new[]` in reserve() where we call `posix_memalign()`
-   *   to obtain a chunk of memory and then do placement-`new` to initialize
-   *   memory. If this is what we have done, then we need to call the
-   *   destructors of the currently active elements by hand, and then
-   *   call `std::free()` to return memory. In order to call the destructors
-   *   of currently used elements, the deleter object needs to have access
-   *   to the owning `AlignedVector` object to know which of the allocated
-   *   elements are currently actually used.
+   * - Allocation in reserve() where we call
+   *   Utilities::System::allocate_aligned() to obtain a chunk of memory and
+   *   then do placement-`new` to initialize memory. If this is what we have
+   *   done, then we need to call the destructors of the currently active
+   *   elements by hand, and then call Utilities::System::free_aligned() to
+   *   return memory. In order to call the destructors of currently used
+   *   elements, the deleter object needs to have access to the owning
+   *   `AlignedVector` object to know which of the allocated elements are
+   *   currently actually used.
    * - We have called `replicate_across_communicator()`, in which case the
    *   elements have been moved into a memory "window" managed by MPI.
    *   In that case, one process (the root process of an MPI communicator
@@ -526,8 +527,9 @@ private:
    *   can achieve via the reset_owning_object() function.
    *
    * This scheme can be further optimized in the following way: In the most
-   * common case, memory is allocated via `posix_memalign()` and needs to
-   * destroyed via `std::free()`. Rather than derive an action class for
+   * common case, memory is allocated via
+   * Utilities::System::allocate_aligned() and needs to destroyed via
+   * Utilities::System::free_aligned(). Rather than derive an action class for
    * this common case, dynamically allocate an object for this case, and
    * call it, we can just special case this situation: If the pointer to the
    * action object is `nullptr`, then we just execute the default action.
@@ -561,7 +563,7 @@ private:
     /**
      * Constructor. When this constructor is called, it installs an
      * action that corresponds to "regular" memory allocation that
-     * needs to be handled by using `std::free()`.
+     * needs to be handled by using Utilities::System::free_aligned().
      */
     Deleter(AlignedVector<T> *owning_object);
 
@@ -1086,7 +1088,11 @@ AlignedVector<T>::Deleter::operator()(T *ptr)
                  --p)
               p->~T();
 
-          std::free(ptr);
+          // The allocated size is still available at this point, see the
+          // comments in reserve() and clear()
+          Utilities::System::free_aligned(
+            ptr,
+            (owning_aligned_vector->allocated_elements_end - ptr) * sizeof(T));
         }
     }
   else
@@ -1371,9 +1377,8 @@ AlignedVector<T>::reserve(const size_type new_allocated_size)
 
       // allocate and align along 64-byte boundaries (this is enough for all
       // levels of vectorization currently supported by deal.II)
-      T *new_data_ptr;
-      Utilities::System::posix_memalign(
-        reinterpret_cast<void **>(&new_data_ptr), 64, new_size * sizeof(T));
+      T *new_data_ptr = static_cast<T *>(
+        Utilities::System::allocate_aligned(new_size * sizeof(T), 64));
 
       // Now create a deleter that encodes what should happen when the object is
       // released: We need to destroy the objects that are currently alive (in
@@ -23,6 +23,7 @@
 #include <deal.II/base/mpi_stub.h>
 #include <deal.II/base/point.h>
 #include <deal.II/base/table.h>
+#include <deal.II/base/thread_management.h>
 
 #include <deal.II/grid/reference_cell.h>
 
@@ -1207,6 +1208,33 @@ namespace DataOutBase
      */
     std::map<std::string, std::string> physical_units;
 
+    /**
+     * Flag determining whether DataOutInterface::write_vtu_in_parallel() and
+     * DataOutInterface::write_vtu_in_parallel_async() first send the data of
+     * all processes on the same shared-memory node to the first process of
+     * that node, so that only one process per node accesses the file. On
+     * parallel file systems, this replaces many small writes by few large
+     * ones and reduces the contention of many processes writing to the same
+     * file.
+     *
+     * Default is <tt>false</tt>.
+     */
+    bool aggregate_on_shared_memory_nodes;
+
+    /**
+     * Hints for the MPI I/O library that are passed to `MPI_File_open()`
+     * by DataOutInterface::write_vtu_in_parallel() and
+     * DataOutInterface::write_vtu_in_parallel_async(), as key-value pairs of
+     * an `MPI_Info` object. Which keys are understood depends on the MPI
+     * implementation and the file system. For example, ROMIO on Lustre
+     * accepts `striping_factor` and `striping_unit` to set the stripe count
+     * and size of a newly created file, and `cb_nodes` to set the number of
+     * processes that do the actual writing in collective operations.
+     *
+     * The default is an empty map, i.e., no hints.
+     */
+    std::map<std::string, std::string> mpi_io_hints;
+
     /**
      * Constructor. Initializes the member variables with names corresponding
      * to the argument names of this function.
@@ -2078,6 +2106,58 @@ namespace DataOutBase
     const VtkFlags &flags,
     std::ostream &  out);
 
+  /**
+   * Write the main part of a vtu file for a cloud of @p points without any
+   * connectivity between them, such as particles. Each point is written as
+   * a vertex cell. The data to be written at the points is given in
+   * @p data, which has one row per data set and one column per point, like
+   * Patch::data. The meaning of @p data_names, @p nonscalar_data_ranges, and
+   * @p flags is the same as for write_vtu_main(); the only difference is
+   * that no Patch objects have to be built, which for millions of points
+   * needs several times the memory of the data itself.
+   *
+   * The output can be combined with write_vtu_header() and
+   * write_vtu_footer() into a complete vtu file.
+   */
+  template <int spacedim>
+  void
+  write_vtu_point_cloud_main(
+    const std::vector<Point<spacedim>> &points,
+    const Table<2, float> &             data,
+    const std::vector<std::string> &    data_names,
+    const std::vector<
+      std::tuple<unsigned int,
+                 unsigned int,
+                 std::string,
+                 DataComponentInterpretation::DataComponentInterpretation>>
+      &             nonscalar_data_ranges,
+    const VtkFlags &flags,
+    std::ostream &  out);
+
+  /**
+   * Collectively write the point clouds given by @p points and @p data on
+   * all processes of @p comm into the single vtu file @p filename, using MPI
+   * I/O in the same way as DataOutInterface::write_vtu_in_parallel(). The
+   * other arguments are explained in write_vtu_point_cloud_main(). The
+   * @p data_names and @p nonscalar_data_ranges must be the same on all
+   * processes. Without MPI, this function simply writes a vtu file.
+   */
+  template <int spacedim>
+  void
+  write_vtu_point_cloud_in_parallel(
+    const std::string &                 filename,
+    const std::vector<Point<spacedim>> &points,
+    const Table<2, float> &             data,
+    const std::vector<std::string> &    data_names,
+    const std::vector<
+      std::tuple<unsigned int,
+                 unsigned int,
+                 std::string,
+                 DataComponentInterpretation::DataComponentInterpretation>>
+      &             nonscalar_data_ranges,
+    const VtkFlags &flags,
+    const MPI_Comm &comm);
+
   /**
    * Some visualization programs, such as ParaView, can read several separate
    * VTU files that all form part of the same simulation, in order to
@@ -2395,6 +2475,18 @@ namespace DataOutBase
    * contain only the solution values. If @p write_mesh_file is true and the
    * filenames are the same, the resulting file will contain both mesh data
    * and solution values.
+   *
+   * In time-dependent simulations on a fixed mesh, the mesh only needs to be
+   * written once. Later time steps can then be written with
+   * @p write_mesh_file set to false and a new @p solution_filename, and refer
+   * to the mesh file through
+   * DataOutInterface::create_xdmf_entry() and
+   * DataOutInterface::append_xdmf_entry().
+   *
+   * If @p compression is different from CompressionLevel::no_compression,
+   * all datasets are stored in chunks of about one megabyte that are
+   * compressed with the deflate filter of HDF5. With parallel HDF5, this
+   * requires HDF5 version 1.10.2 or later.
    */
   template <int dim, int spacedim>
   void
@@ -2403,7 +2495,9 @@ namespace DataOutBase
                       const bool                               write_mesh_file,
                       const std::string &                      mesh_filename,
                       const std::string &solution_filename,
-                      const MPI_Comm &   comm);
+                      const MPI_Comm &   comm,
+                      const CompressionLevel compression =
+                        CompressionLevel::no_compression);
 
   /**
    * DataOutFilter is an intermediate data format that reduces the amount of
@@ -2737,6 +2831,46 @@ public:
   write_vtu_in_parallel(const std::string &filename,
                         const MPI_Comm &   comm) const;
 
+  /**
+   * Like write_vtu_in_parallel(), but return before the data has been
+   * written to disk. The patches are converted into the (possibly
+   * compressed) VTU representation before this function returns, so the
+   * current object can be modified or rebuilt right away, for example by
+   * the next call to DataOut::build_patches(). The collective MPI I/O
+   * operations then run on a separate task, concurrently with whatever the
+   * calling program does next.
+   *
+   * This function is a collective call on @p comm. Since the I/O
+   * operations are performed on a different thread, this requires that MPI
+   * was initialized with `MPI_THREAD_MULTIPLE`, e.g., through
+   * Utilities::MPI::MPI_InitFinalize with more than one thread. If that is
+   * not the case, the file is written before this function returns.
+   *
+   * The returned task needs to be joined, via Threads::Task::join(), on all
+   * processes before the program ends, and before a file of the same name
+   * is written again:
+   * @code
+   *   Threads::Task<void> output_task;
+   *   for (unsigned int step = 0; step < n_steps; ++step)
+   *     {
+   *       ...
+   *       if (step % 10 == 0)
+   *         {
+   *           data_out.build_patches();
+   *           if (output_task.joinable())
+   *             output_task.join();
+   *           output_task = data_out.write_vtu_in_parallel_async(
+   *             "solution-" + std::to_string(step) + ".vtu", comm);
+   *         }
+   *     }
+   *   if (output_task.joinable())
+   *     output_task.join();
+   * @endcode
+   */
+  Threads::Task<void>
+  write_vtu_in_parallel_async(const std::string &filename,
+                              const MPI_Comm &   comm) const;
+
   /**
    * Some visualization programs, such as ParaView, can read several separate
    * VTU files that all form part of the same simulation, in order to
@@ -2925,6 +3059,40 @@ public:
                   const std::string &           filename,
                   const MPI_Comm &              comm) const;
 
+  /**
+   * Add @p entry to the XDMF file @p filename, creating the file if it does
+   * not exist yet or is empty. Contrary to write_xdmf_file(), which writes
+   * the entries of all time steps every time it is called, this function
+   * only writes the new entry at the end of the file, so that the cost of
+   * writing the XDMF file does not grow with the number of time steps:
+   *
+   * @code
+   * // in each time step:
+   * data_out.write_filtered_data(data_filter);
+   * data_out.write_hdf5_parallel(data_filter,
+   *                              step == 0,
+   *                              "mesh.h5",
+   *                              "solution-" + std::to_string(step) + ".h5",
+   *                              MPI_COMM_WORLD);
+   * data_out.append_xdmf_entry(
+   *   data_out.create_xdmf_entry(data_filter,
+   *                              "mesh.h5",
+   *                              "solution-" + std::to_string(step) + ".h5",
+   *                              simulation_time,
+   *                              MPI_COMM_WORLD),
+   *   "solution.xdmf",
+   *   MPI_COMM_WORLD);
+   * @endcode
+   *
+   * The file must have been written by write_xdmf_file() or this function.
+   * Like write_xdmf_file(), only the process with rank zero in @p comm
+   * accesses the file.
+   */
+  void
+  append_xdmf_entry(const XDMFEntry &  entry,
+                    const std::string &filename,
+                    const MPI_Comm &   comm) const;
+
   /**
    * Write the data in @p data_filter to a single HDF5 file containing both the
    * mesh and solution values. Below is an example of how to use this function
@@ -2949,14 +3117,17 @@ public:
    * false, the mesh data will not be written and the solution file will
    * contain only the solution values. If write_mesh_file is true and the
    * filenames are the same, the resulting file will contain both mesh data
-   * and solution values.
+   * and solution values. See DataOutBase::write_hdf5_parallel() for the
+   * meaning of @p compression.
    */
   void
   write_hdf5_parallel(const DataOutBase::DataOutFilter &data_filter,
                       const bool                        write_mesh_file,
                       const std::string &               mesh_filename,
                       const std::string &               solution_filename,
-                      const MPI_Comm &                  comm) const;
+                      const MPI_Comm &                  comm,
+                      const DataOutBase::CompressionLevel compression =
+                        DataOutBase::CompressionLevel::no_compression) const;
 
   /**
    * DataOutFilter is an intermediate data format that reduces the amount of
@@ -3105,6 +3276,16 @@ protected:
   unsigned int default_subdivisions;
 
 private:
+  /**
+   * Return the part of the VTU file written by write_vtu_in_parallel() that
+   * contains the patches of the current process, i.e., what
+   * DataOutBase::write_vtu_main() writes, or an empty string if there is
+   * nothing to be written by this process. This is a collective call on
+   * @p comm.
+   */
+  std::string
+  create_vtu_piece(const MPI_Comm &comm) const;
+
   /**
    * Standard output format.  Use this format, if output format default_format
    * is requested. It can be changed by the <tt>set_format</tt> function or in
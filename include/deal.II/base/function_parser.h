@@ -24,6 +24,7 @@
 #include <deal.II/base/mu_parser_internal.h>
 #include <deal.II/base/point.h>
 #include <deal.II/base/tensor.h>
+#include <deal.II/base/vectorization.h>
 
 #include <map>
 #include <vector>
@@ -344,6 +345,42 @@ public:
   virtual double
   value(const Point<dim> &p, const unsigned int component = 0) const override;
 
+  /**
+   * Return the value of the function at the points stored in the lanes of
+   * @p p, e.g., the quadrature points returned by
+   * FEEvaluation::quadrature_point(). The points of all lanes are evaluated
+   * with a single call to the bulk mode of the parser.
+   */
+  template <std::size_t width>
+  VectorizedArray<double, width>
+  value(const Point<dim, VectorizedArray<double, width>> &p,
+        const unsigned int component = 0) const;
+
+  /**
+   * Return all components of the function at the given point.
+   */
+  virtual void
+  vector_value(const Point<dim> &p, Vector<double> &values) const override;
+
+  /**
+   * Return the values of the given component at all points in @p points.
+   * In contrast to the default implementation of the base class, which calls
+   * value() for each point, the parsed expression is evaluated for blocks of
+   * points at once.
+   */
+  virtual void
+  value_list(const std::vector<Point<dim>> &points,
+             std::vector<double> &          values,
+             const unsigned int             component = 0) const override;
+
+  /**
+   * Return all components of the function at all points in @p points,
+   * evaluating the parsed expressions for blocks of points at once.
+   */
+  virtual void
+  vector_value_list(const std::vector<Point<dim>> &points,
+                    std::vector<Vector<double>> &  values) const override;
+
   /**
    * Return an array of function expressions (one per component), used to
    * initialize this function.
@@ -372,6 +409,31 @@ public:
 };
 
 
+template <int dim>
+template <std::size_t width>
+inline VectorizedArray<double, width>
+FunctionParser<dim>::value(const Point<dim, VectorizedArray<double, width>> &p,
+                           const unsigned int component) const
+{
+  std::array<Point<dim>, width> points;
+  for (unsigned int v = 0; v < width; ++v)
+    for (unsigned int d = 0; d < dim; ++d)
+      points[v][d] = p[d][v];
+
+  std::array<double, width> values;
+  this->do_value_list(ArrayView<const Point<dim>>(points.data(), width),
+                      this->get_time(),
+                      component,
+                      ArrayView<double>(values.data(), width));
+
+  VectorizedArray<double, width> result;
+  for (unsigned int v = 0; v < width; ++v)
+    result[v] = values[v];
+  return result;
+}
+
+
+
 template <int dim>
 std::string
 FunctionParser<dim>::default_variable_names()
@@ -21,6 +21,7 @@
 #  include <deal.II/base/config.h>
 
 #  include <deal.II/base/thread_management.h>
+#  include <deal.II/base/types.h>
 
 #  include <algorithm>
 #  include <functional>
@@ -260,16 +261,15 @@ namespace GraphColoring
               graph[j].push_back(i);
             }
 
-      // Sort the vertices by decreasing degree.
-      std::vector<int>::iterator degrees_it;
+      // Sort the vertices by decreasing degree. Vertices of the same degree
+      // keep their order.
       for (unsigned int i = 0; i < partition_size; ++i)
-        {
-          // Find the largest element.
-          degrees_it         = std::max_element(degrees.begin(), degrees.end());
-          sorted_vertices[i] = degrees_it - degrees.begin();
-          // Put the largest element to -1 so it cannot be chosen again.
-          *degrees_it = -1;
-        }
+        sorted_vertices[i] = i;
+      std::stable_sort(sorted_vertices.begin(),
+                       sorted_vertices.end(),
+                       [&degrees](const unsigned int a, const unsigned int b) {
+                         return degrees[a] > degrees[b];
+                       });
 
       // Color the graph.
       std::vector<std::unordered_set<unsigned int>> colors_used;
@@ -456,6 +456,99 @@ namespace GraphColoring
 
       return coloring;
     }
+
+
+
+    /**
+     * Move iterators from colors with more than the average number of
+     * iterators to smaller colors whose iterators they do not conflict with,
+     * so that the colors have similar sizes, and then sort the iterators of
+     * each color.
+     *
+     * The colors are processed one after the other by WorkStream::run(), so
+     * the threads are idle at the end of each color if it has too few
+     * iterators to keep them busy. Sorting the iterators of a color with
+     * <code>operator&lt;</code>, which for cell iterators sorts the cells by
+     * level and index, has the effect that the contiguous chunks of a color
+     * that WorkStream assigns to the threads consist of cells that are close
+     * in memory.
+     *
+     * @param[in] get_conflict_indices A user defined function object
+     * returning a set of indicators that are descriptive of what represents a
+     * conflict. See above for a more thorough discussion.
+     * @param[in,out] coloring A valid coloring, which is modified in place.
+     */
+    template <typename Iterator>
+    void
+    balance_colors(const std::function<std::vector<types::global_dof_index>(
+                     const Iterator &)> &              get_conflict_indices,
+                   std::vector<std::vector<Iterator>> &coloring)
+    {
+      const unsigned int n_colors    = coloring.size();
+      std::size_t        n_iterators = 0;
+      for (const auto &color : coloring)
+        n_iterators += color.size();
+      if (n_colors < 2 || n_iterators == 0)
+        return;
+      const std::size_t target_size = (n_iterators + n_colors - 1) / n_colors;
+
+      // Collect the conflict indices of the iterators and, for each color,
+      // the set of conflict indices used by its iterators. Since the
+      // iterators of a color do not conflict, each index appears only once
+      // in a color.
+      std::vector<std::vector<std::vector<types::global_dof_index>>>
+        conflict_indices(n_colors);
+      std::vector<std::unordered_set<types::global_dof_index>> used_indices(
+        n_colors);
+      for (unsigned int c = 0; c < n_colors; ++c)
+        {
+          conflict_indices[c].reserve(coloring[c].size());
+          for (const Iterator &it : coloring[c])
+            {
+              conflict_indices[c].push_back(get_conflict_indices(it));
+              used_indices[c].insert(conflict_indices[c].back().begin(),
+                                     conflict_indices[c].back().end());
+            }
+        }
+
+      for (unsigned int c = 0; c < n_colors; ++c)
+        {
+          // Go backward through the iterators of a large color, so that the
+          // remaining iterators stay in place, and move each one to the
+          // smallest color that it does not conflict with, if any.
+          for (std::size_t i = coloring[c].size();
+               i > 0 && coloring[c].size() > target_size;
+               --i)
+            {
+              const std::vector<types::global_dof_index> &indices =
+                conflict_indices[c][i - 1];
+              unsigned int destination = numbers::invalid_unsigned_int;
+              for (unsigned int d = 0; d < n_colors; ++d)
+                if (d != c && coloring[d].size() < target_size &&
+                    (destination == numbers::invalid_unsigned_int ||
+                     coloring[d].size() < coloring[destination].size()) &&
+                    std::none_of(indices.begin(),
+                                 indices.end(),
+                                 [&](const types::global_dof_index index) {
+                                   return used_indices[d].count(index) > 0;
+                                 }))
+                  destination = d;
+              if (destination == numbers::invalid_unsigned_int)
+                continue;
+
+              for (const types::global_dof_index index : indices)
+                used_indices[c].erase(index);
+              used_indices[destination].insert(indices.begin(), indices.end());
+              coloring[destination].push_back(coloring[c][i - 1]);
+              conflict_indices[destination].push_back(indices);
+              coloring[c].erase(coloring[c].begin() + (i - 1));
+              conflict_indices[c].erase(conflict_indices[c].begin() + (i - 1));
+            }
+        }
+
+      for (auto &color : coloring)
+        std::sort(color.begin(), color.end());
+    }
   } // namespace internal
 
 
@@ -530,6 +623,15 @@ namespace GraphColoring
    * @param[in] get_conflict_indices A user defined function object returning
    * a set of indicators that are descriptive of what represents a conflict.
    * See above for a more thorough discussion.
+   * @param[in] balance_colors If true, iterators are moved from large colors
+   * to smaller colors they do not conflict with, so that all colors have
+   * about the same number of elements, and the iterators of each color are
+   * sorted with <code>operator&lt;</code>. Since WorkStream::run() works on
+   * one color after the other, colors of similar size reduce the time
+   * threads are idle at the end of a color, and sorted colors give each
+   * thread a contiguous chunk of, e.g., cells that are close in memory. This
+   * post-processing step requires another call of @p get_conflict_indices
+   * for each iterator.
    * @return A set of sets of iterators (where sets are represented by
    * std::vector for efficiency). Each element of the outermost set
    * corresponds to the iterators pointing to objects that are in the same
@@ -542,7 +644,8 @@ namespace GraphColoring
     const Iterator &                               begin,
     const typename identity<Iterator>::type &      end,
     const std::function<std::vector<types::global_dof_index>(
-      const typename identity<Iterator>::type &)> &get_conflict_indices)
+      const typename identity<Iterator>::type &)> &get_conflict_indices,
+    const bool                                     balance_colors = false)
   {
     Assert(begin != end,
            ExcMessage(
@@ -567,7 +670,13 @@ namespace GraphColoring
     tasks.join_all();
 
     // Gather the colors together.
-    return internal::gather_colors(partition_coloring);
+    std::vector<std::vector<Iterator>> coloring =
+      internal::gather_colors(partition_coloring);
+
+    if (balance_colors)
+      internal::balance_colors(get_conflict_indices, coloring);
+
+    return coloring;
   }
 
   /**
@@ -207,6 +207,22 @@ public:
   void
   add_indices(const IndexSet &other, const size_type offset = 0);
 
+  /**
+   * Add all indices stored in @p indices to the set. In contrast to the
+   * add_indices() function taking an iterator range, the indices need
+   * neither be sorted nor unique: The function sorts them with a radix sort
+   * (whose cost is linear in the number of indices), removes duplicates, and
+   * forms the list of ranges in a single pass over the sorted indices. This
+   * makes it the function of choice to build an index set from a large
+   * number of indices that have been collected in arbitrary order, for
+   * example the degrees of freedom on all ghost cells.
+   *
+   * The vector is used as scratch space. On return, it contains the sorted
+   * unique indices that were passed in.
+   */
+  void
+  add_unsorted_indices(std::vector<size_type> &indices);
+
   /**
    * Return whether the specified index is an element of the index set.
    */
@@ -974,6 +990,25 @@ private:
    */
   mutable size_type largest_range;
 
+  /**
+   * For index sets with many ranges, a table that allows to find the range
+   * containing a given index in (on average) constant time: The index space
+   * is split into blocks of <tt>2^range_lookup_shift</tt> indices, and entry
+   * @p b of this table stores the number of the first range whose end lies
+   * beyond the start of block @p b. The range containing an index in block
+   * @p b is therefore among the ranges with numbers from
+   * <tt>range_lookup[b]</tt> to <tt>range_lookup[b+1]</tt>. The block size is
+   * chosen such that there are about as many blocks as ranges. The table is
+   * built by do_compress() and used by index_within_set(); it is empty for
+   * index sets with few ranges, for which the binary search is fast anyway.
+   */
+  mutable std::vector<unsigned int> range_lookup;
+
+  /**
+   * The base-2 logarithm of the block size used in @p range_lookup.
+   */
+  mutable unsigned int range_lookup_shift;
+
   /**
    * A mutex that is used to synchronize operations of the do_compress()
    * function that is called from many 'const' functions via compress().
@@ -1508,6 +1543,7 @@ inline IndexSet::IndexSet()
   : is_compressed(true)
   , index_space_size(0)
   , largest_range(numbers::invalid_unsigned_int)
+  , range_lookup_shift(0)
 {}
 
 
@@ -1516,6 +1552,7 @@ inline IndexSet::IndexSet(const size_type size)
   : is_compressed(true)
   , index_space_size(size)
   , largest_range(numbers::invalid_unsigned_int)
+  , range_lookup_shift(0)
 {}
 
 
@@ -1525,11 +1562,14 @@ inline IndexSet::IndexSet(IndexSet &&is) noexcept
   , is_compressed(is.is_compressed)
   , index_space_size(is.index_space_size)
   , largest_range(is.largest_range)
+  , range_lookup(std::move(is.range_lookup))
+  , range_lookup_shift(is.range_lookup_shift)
 {
   is.ranges.clear();
   is.is_compressed    = true;
   is.index_space_size = 0;
   is.largest_range    = numbers::invalid_unsigned_int;
+  is.range_lookup.clear();
 
   compress();
 }
@@ -1539,15 +1579,18 @@ inline IndexSet::IndexSet(IndexSet &&is) noexcept
 inline IndexSet &
 IndexSet::operator=(IndexSet &&is) noexcept
 {
-  ranges           = std::move(is.ranges);
-  is_compressed    = is.is_compressed;
-  index_space_size = is.index_space_size;
-  largest_range    = is.largest_range;
+  ranges             = std::move(is.ranges);
+  is_compressed      = is.is_compressed;
+  index_space_size   = is.index_space_size;
+  largest_range      = is.largest_range;
+  range_lookup       = std::move(is.range_lookup);
+  range_lookup_shift = is.range_lookup_shift;
 
   is.ranges.clear();
   is.is_compressed    = true;
   is.index_space_size = 0;
   is.largest_range    = numbers::invalid_unsigned_int;
+  is.range_lookup.clear();
 
   compress();
 
@@ -1606,6 +1649,7 @@ IndexSet::clear()
   ranges.clear();
   is_compressed = true;
   largest_range = numbers::invalid_unsigned_int;
+  range_lookup.clear();
 }
 
 
@@ -1943,7 +1987,8 @@ template <class Archive>
 inline void
 IndexSet::serialize(Archive &ar, const unsigned int)
 {
-  ar &ranges &is_compressed &index_space_size &largest_range;
+  ar &ranges &is_compressed &index_space_size &largest_range &range_lookup
+    &range_lookup_shift;
 }
 
 DEAL_II_NAMESPACE_CLOSE
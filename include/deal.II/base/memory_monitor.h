@@ -0,0 +1,214 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+#ifndef dealii_memory_monitor_h
+#define dealii_memory_monitor_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/mpi_stub.h>
+
+#include <functional>
+#include <map>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * A class that collects the memory consumption of the major data structures
+ * of a program, grouped into subsystems, and prints the current and peak
+ * memory of each subsystem as statistics over all MPI processes, similar to
+ * what TimerOutput::print_wall_time_statistics() does for run times.
+ *
+ * Objects are registered with add() under the name of a subsystem, e.g.,
+ * "Triangulation", "DoFHandler", "MatrixFree", or "Vectors". Several objects
+ * can be registered under the same name, in which case their memory is
+ * summed. Every call to update() evaluates the memory_consumption() of all
+ * registered objects and records, for each subsystem, the current memory and
+ * the largest memory seen in any call to update() so far:
+ * @code
+ *   MemoryMonitor memory_monitor(MPI_COMM_WORLD, pcout);
+ *   memory_monitor.add("Triangulation", triangulation);
+ *   memory_monitor.add("DoFHandler", dof_handler);
+ *   memory_monitor.add("AffineConstraints", constraints);
+ *   memory_monitor.add("MatrixFree", matrix_free);
+ *   memory_monitor.add("Vectors", solution);
+ *   memory_monitor.add("Vectors", system_rhs);
+ *
+ *   for (unsigned int cycle = 0; cycle < n_cycles; ++cycle)
+ *     {
+ *       // refine the mesh, set up the system, and solve
+ *       memory_monitor.update();
+ *     }
+ *   memory_monitor.print_summary();
+ * @endcode
+ *
+ * Since the memory of the subsystems is only sampled in update(), the peak
+ * values of the subsystems do not contain temporary objects that only exist
+ * between two calls. To make the table useful for sizing jobs nonetheless,
+ * it contains two additional rows that are kept up to date continuously:
+ * the memory obtained from Utilities::System::allocate_aligned(), which holds
+ * the data of all AlignedVector objects (and thus of Table, FullMatrix, and
+ * MatrixFree) and the local elements of LinearAlgebra::distributed::Vector,
+ * see Utilities::System::get_aligned_memory_statistics(), and the resident
+ * memory of the process as reported by the operating system (VmRSS and
+ * VmHWM on Linux, see Utilities::System::get_memory_stats()).
+ *
+ * print_summary() needs to be called on all processes of the communicator,
+ * and the same subsystems need to be registered on all of them.
+ *
+ * The registered objects are stored by reference and need to be removed with
+ * remove() before they are destroyed if update() is called after that point.
+ *
+ * @ingroup memory
+ */
+class MemoryMonitor
+{
+public:
+  /**
+   * Constructor. The summary is written to @p stream on the root process of
+   * @p mpi_comm.
+   */
+  MemoryMonitor(const MPI_Comm &mpi_comm, std::ostream &stream);
+
+  /**
+   * Constructor. The summary is written to @p stream on the root process of
+   * @p mpi_comm, if the stream is active on that process.
+   */
+  MemoryMonitor(const MPI_Comm &mpi_comm, ConditionalOStream &stream);
+
+  /**
+   * Register @p object under the name @p subsystem. The memory of the object
+   * is determined by MemoryConsumption::memory_consumption(), i.e., by its
+   * memory_consumption() member function for classes, or by the overloads in
+   * namespace MemoryConsumption for the types of the C++ standard library.
+   */
+  template <typename T>
+  std::enable_if_t<
+    !std::is_convertible<const T &, std::function<std::size_t()>>::value>
+  add(const std::string &subsystem, const T &object);
+
+  /**
+   * Register a function that returns the number of bytes of some data
+   * structure under the name @p subsystem.
+   */
+  void
+  add(const std::string &                 subsystem,
+      const std::function<std::size_t()> &memory_function);
+
+  /**
+   * Remove all objects registered under the name @p subsystem, together with
+   * the memory recorded for the subsystem.
+   */
+  void
+  remove(const std::string &subsystem);
+
+  /**
+   * Evaluate the memory of all registered objects, and update the current
+   * and peak memory of each subsystem.
+   */
+  void
+  update();
+
+  /**
+   * Return the memory of the subsystem @p subsystem on the current process,
+   * in bytes, as determined by the last call to update().
+   */
+  std::size_t
+  get_current_memory(const std::string &subsystem) const;
+
+  /**
+   * Return the largest memory of the subsystem @p subsystem on the current
+   * process in any call to update(), in bytes.
+   */
+  std::size_t
+  get_peak_memory(const std::string &subsystem) const;
+
+  /**
+   * Write the current and the peak memory of each subsystem, in MB, as the
+   * minimum, average, and maximum over all processes of the communicator
+   * passed to the constructor, together with the ranks where the minimum and
+   * the maximum are attained. This function is collective and uses the
+   * memory recorded by the last call to update().
+   */
+  void
+  print_summary() const;
+
+private:
+  /**
+   * The data stored for each subsystem.
+   */
+  struct Subsystem
+  {
+    /**
+     * The functions that return the memory of the objects registered for
+     * the subsystem.
+     */
+    std::vector<std::function<std::size_t()>> memory_functions;
+
+    /**
+     * The memory determined by the last call to update().
+     */
+    std::size_t current_memory = 0;
+
+    /**
+     * The largest memory determined by any call to update().
+     */
+    std::size_t peak_memory = 0;
+  };
+
+  /**
+   * The subsystems, sorted by their names so that all processes print them
+   * in the same order.
+   */
+  std::map<std::string, Subsystem> subsystems;
+
+  /**
+   * The communicator the statistics are computed over.
+   */
+  MPI_Comm mpi_comm;
+
+  /**
+   * The stream the summary is written to.
+   */
+  ConditionalOStream out_stream;
+};
+
+
+
+#ifndef DOXYGEN
+/* ---------------------- inline functions ------------------------ */
+
+
+template <typename T>
+inline std::enable_if_t<
+  !std::is_convertible<const T &, std::function<std::size_t()>>::value>
+MemoryMonitor::add(const std::string &subsystem, const T &object)
+{
+  add(subsystem, std::function<std::size_t()>([&object]() {
+        return MemoryConsumption::memory_consumption(object);
+      }));
+}
+
+#endif
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -18,8 +18,11 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/mpi.h>
 #include <deal.II/base/subscriptor.h>
+#include <deal.II/base/thread_management.h>
 
+#include <chrono>
 #include <memory>
 #include <vector>
 
@@ -174,6 +177,31 @@ public:
   void
   apply(ActionFunctionObjectType action);
 
+  /**
+   * Like apply(), but run the actions on the different levels as concurrent
+   * tasks, and return the wall time in seconds spent on each level. This is
+   * useful to set up level operators or smoothers, e.g., MatrixFree objects
+   * and the diagonals and eigenvalue estimates of PreconditionChebyshev,
+   * where each level is independent of the others.
+   *
+   * Since such setup functions typically call MPI collectives on the
+   * communicator of the mesh, and the order in which concurrent tasks reach
+   * these calls differs between processes, the levels can only be run
+   * concurrently if the actions do not communicate. This is assumed if
+   * @p communicator contains a single process. Otherwise, the actions are
+   * run one after the other in the order of increasing level on all
+   * processes, as in apply(), and only the timings are collected. Callers
+   * whose actions do not communicate can pass MPI_COMM_SELF to always get
+   * concurrent execution.
+   *
+   * The action is called concurrently on different objects, so it must not
+   * modify state shared between levels without synchronization.
+   */
+  template <typename ActionFunctionObjectType>
+  MGLevelObject<double>
+  apply_in_parallel(ActionFunctionObjectType action,
+                    const MPI_Comm           communicator = MPI_COMM_SELF);
+
   /**
    * Memory used by this object.
    */
@@ -320,6 +348,40 @@ MGLevelObject<Object>::apply(ActionFunctionObjectType action)
 }
 
 
+template <class Object>
+template <typename ActionFunctionObjectType>
+MGLevelObject<double>
+MGLevelObject<Object>::apply_in_parallel(ActionFunctionObjectType action,
+                                         const MPI_Comm           communicator)
+{
+  MGLevelObject<double> timings(min_level(), max_level());
+
+  const auto run_level = [&](const unsigned int lvl) {
+    const auto start = std::chrono::steady_clock::now();
+    action(lvl, (*this)[lvl]);
+    timings[lvl] = std::chrono::duration<double>(
+                     std::chrono::steady_clock::now() - start)
+                     .count();
+  };
+
+  if (Utilities::MPI::n_mpi_processes(communicator) > 1)
+    for (unsigned int lvl = min_level(); lvl <= max_level(); ++lvl)
+      run_level(lvl);
+  else
+    {
+      // start with the finest level, which is typically the most expensive
+      // one, and run the coarsest level on the current thread
+      Threads::TaskGroup<void> tasks;
+      for (unsigned int lvl = max_level(); lvl > min_level(); --lvl)
+        tasks += Threads::new_task([&run_level, lvl]() { run_level(lvl); });
+      run_level(min_level());
+      tasks.join_all();
+    }
+
+  return timings;
+}
+
+
 template <class Object>
 std::size_t
 MGLevelObject<Object>::memory_consumption() const
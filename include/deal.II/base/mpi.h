@@ -729,6 +729,31 @@ namespace Utilities
         const MPI_Comm &          mpi_communicator,
         const ArrayView<T> &      sums);
 
+    /**
+     * An immediate variant of sum() for a single value, based on
+     * `MPI_Iallreduce`: the function starts the reduction and returns
+     * immediately, and the sum over all processes is obtained by calling
+     * Future::get() on the returned object. Other work can be done between
+     * these two steps while the reduction is in progress.
+     *
+     * Like sum(), this function is collective, so all processes need to call
+     * it in the same order relative to other collective operations on
+     * @p mpi_communicator.
+     */
+    template <typename T>
+    Future<T>
+    isum(const T &value, const MPI_Comm &mpi_communicator);
+
+    /**
+     * Like the previous function, but compute the sums of all elements of the
+     * array @p values in a single message, which is cheaper than starting a
+     * separate reduction for each of them. The array is copied, so it need
+     * not stay alive until the reduction has completed.
+     */
+    template <typename T>
+    Future<std::vector<T>>
+    isum(const ArrayView<const T> &values, const MPI_Comm &mpi_communicator);
+
     /**
      * Perform an MPI sum of the entries of a symmetric tensor.
      *
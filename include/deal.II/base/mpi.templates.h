@@ -28,6 +28,7 @@
 #include <deal.II/lac/sparse_matrix.h>
 #include <deal.II/lac/vector.h>
 
+#include <memory>
 #include <set>
 #include <vector>
 
@@ -137,6 +138,53 @@ namespace Utilities
               std::copy(values.begin(), values.end(), output.begin());
           }
       }
+
+
+
+      template <typename T>
+      Future<std::vector<T>>
+      iall_reduce(const MPI_Op &            mpi_op,
+                  const ArrayView<const T> &values,
+                  const MPI_Comm &          mpi_communicator)
+      {
+        // the buffer needs to stay alive until the reduction has completed,
+        // so let the function objects of the future own it
+        const auto buffer =
+          std::make_shared<std::vector<T>>(values.begin(), values.end());
+
+#ifdef DEAL_II_WITH_MPI
+        if (job_supports_mpi())
+          {
+            // complex numbers are sent as pairs of real numbers, which gives
+            // the correct sums as they are taken component by component
+            using real_type = typename numbers::NumberTraits<T>::real_type;
+            const int n_components =
+              static_cast<int>(sizeof(T) / sizeof(real_type));
+
+            const auto request = std::make_shared<MPI_Request>();
+            const int  ierr =
+              MPI_Iallreduce(MPI_IN_PLACE,
+                             static_cast<void *>(buffer->data()),
+                             static_cast<int>(values.size()) * n_components,
+                             mpi_type_id_for_type<real_type>,
+                             mpi_op,
+                             mpi_communicator,
+                             request.get());
+            AssertThrowMPI(ierr);
+
+            return Future<std::vector<T>>(
+              [request]() {
+                const int ierr = MPI_Wait(request.get(), MPI_STATUS_IGNORE);
+                AssertThrowMPI(ierr);
+              },
+              [buffer]() { return std::move(*buffer); });
+          }
+#endif
+        (void)mpi_op;
+        (void)mpi_communicator;
+        return Future<std::vector<T>>(
+          []() {}, [buffer]() { return std::move(*buffer); });
+      }
     } // namespace internal
 
 
@@ -183,6 +231,29 @@ namespace Utilities
 
 
 
+    template <typename T>
+    Future<T>
+    isum(const T &value, const MPI_Comm &mpi_communicator)
+    {
+      const auto future = std::make_shared<Future<std::vector<T>>>(
+        internal::iall_reduce(MPI_SUM,
+                              ArrayView<const T>(&value, 1),
+                              mpi_communicator));
+      return Future<T>([future]() { future->wait(); },
+                       [future]() { return future->get()[0]; });
+    }
+
+
+
+    template <typename T>
+    Future<std::vector<T>>
+    isum(const ArrayView<const T> &values, const MPI_Comm &mpi_communicator)
+    {
+      return internal::iall_reduce(MPI_SUM, values, mpi_communicator);
+    }
+
+
+
     template <int rank, int dim, typename Number>
     Tensor<rank, dim, Number>
     sum(const Tensor<rank, dim, Number> &t, const MPI_Comm &mpi_communicator)
@@ -102,11 +102,12 @@ namespace Utilities
      * There are many ways to implement the general functionality required
      * for these "consensus algorithms". This namespace provides several
      * implementations of consensus algorithms, specifically the
-     * NBX and PEX algorithms, along with a serial one for the case where
-     * one wants to run such an algorithm on a single process. The key
-     * entry points to these algorithms are the
-     * nbx(), pex(), serial(), and selector() functions that take a
-     * communicator, a list of targets, and a number of functions
+     * NBX and PEX algorithms, a hierarchical algorithm that aggregates the
+     * messages of all processes on a compute node, along with a serial one
+     * for the case where one wants to run such an algorithm on a single
+     * process. The key entry points to these algorithms are the
+     * nbx(), pex(), hierarchical(), serial(), and selector() functions that
+     * take a communicator, a list of targets, and a number of functions
      * as argument. The selector() function redirects to the other
      * implementations based on the number of processes that participate
      * in an MPI universe, since some implementations are better or worse
@@ -850,6 +851,211 @@ namespace Utilities
           const MPI_Comm &comm);
 
 
+#ifdef DEAL_II_WITH_MPI
+      namespace internal
+      {
+        /**
+         * The distribution of the processes of a communicator onto the
+         * compute nodes, i.e., onto shared-memory domains, as used by the
+         * Hierarchical class.
+         */
+        struct NodeTopology
+        {
+          /**
+           * A communicator with the processes of the original communicator
+           * that run on the same node as the current process.
+           */
+          MPI_Comm node_comm;
+
+          /**
+           * A communicator with the process with rank zero in #node_comm of
+           * each node, the leader of the node. On all other processes, this
+           * is MPI_COMM_NULL.
+           */
+          MPI_Comm leader_comm;
+
+          /**
+           * The ranks in the original communicator of the processes in
+           * #node_comm, indexed by their rank in #node_comm.
+           */
+          std::vector<unsigned int> node_ranks;
+
+          /**
+           * The rank in #leader_comm of the leader of the node of each process
+           * of the original communicator. This field is only filled on the
+           * leaders.
+           */
+          std::vector<unsigned int> leader_of_rank;
+
+          /**
+           * The largest number of processes on any node.
+           */
+          unsigned int max_node_size;
+        };
+
+        /**
+         * Return the NodeTopology of @p comm. The first call for a
+         * communicator is collective and attaches the result as an MPI
+         * attribute to @p comm, so that later calls do not communicate, and
+         * the communicators of the topology are freed together with @p comm.
+         */
+        const NodeTopology &
+        get_node_topology(const MPI_Comm &comm);
+
+        /**
+         * Append a message from the process with rank @p sender to the
+         * process with rank @p receiver with the payload given by the range
+         * from @p payload_begin to @p payload_end to @p buffer.
+         */
+        void
+        append_message(const unsigned int                       sender,
+                       const unsigned int                       receiver,
+                       const std::vector<char>::const_iterator &payload_begin,
+                       const std::vector<char>::const_iterator &payload_end,
+                       std::vector<char> &                      buffer);
+
+        /**
+         * Call @p function with the sender, the receiver, and the range of
+         * the payload of each message that has been appended to @p buffer by
+         * append_message().
+         */
+        void
+        for_each_message(
+          const std::vector<char> &buffer,
+          const std::function<void(const unsigned int,
+                                   const unsigned int,
+                                   const std::vector<char>::const_iterator &,
+                                   const std::vector<char>::const_iterator &)>
+            &function);
+
+        /**
+         * Concatenate the messages of all processes of a node on the leader
+         * of the node, and return an empty buffer on all other processes.
+         */
+        std::vector<char>
+        gather_messages_on_leader(const std::vector<char> &messages,
+                                  const NodeTopology &     topology);
+
+        /**
+         * Send the messages collected on a leader to the leaders of the
+         * nodes of their receivers, with one message per pair of nodes, and
+         * return the messages received for the processes of the own node.
+         * Only the leaders take part in this function.
+         */
+        std::vector<char>
+        route_messages_between_nodes(const std::vector<char> &messages,
+                                     const NodeTopology &     topology);
+
+        /**
+         * Distribute the messages given on the leader of a node to their
+         * receivers on the node, and return the messages received by the
+         * current process.
+         */
+        std::vector<char>
+        scatter_messages_from_leader(const std::vector<char> &messages,
+                                     const NodeTopology &     topology);
+      } // namespace internal
+#endif
+
+
+
+      /**
+       * This class implements a concrete algorithm for the
+       * ConsensusAlgorithms::Interface base class that aggregates the
+       * communication of all processes on a compute node. Instead of sending
+       * one message between each pair of processes that communicate, as NBX
+       * and PEX do, the requests of all processes of a node are gathered on
+       * one process of the node, the leader, via a shared-memory
+       * communicator. The leaders exchange one message per pair of
+       * communicating nodes using NBX, and then scatter the requests to their
+       * receivers on the node. The answers are returned to the requesting
+       * processes the same way.
+       *
+       * On large machines with many processes per node, this reduces the
+       * number of messages between nodes up to the square of the number of
+       * processes per node, at the cost of copying all payloads through the
+       * leaders. The ranks of all processes are stored on the leaders, which
+       * is memory proportional to the number of processes. The layout of the
+       * nodes is only determined the first time the algorithm is run on a
+       * communicator. If each node only hosts a single process, the algorithm
+       * falls back to NBX.
+       *
+       * @tparam RequestType The type of the elements of the vector to be sent.
+       * @tparam AnswerType The type of the elements of the vector to be received.
+       */
+      template <typename RequestType, typename AnswerType>
+      class Hierarchical : public Interface<RequestType, AnswerType>
+      {
+      public:
+        /**
+         * Default constructor.
+         */
+        Hierarchical() = default;
+
+        /**
+         * Destructor.
+         */
+        virtual ~Hierarchical() = default;
+
+        // Import the declarations from the base class.
+        using Interface<RequestType, AnswerType>::run;
+
+        /**
+         * @copydoc Interface::run()
+         */
+        virtual std::vector<unsigned int>
+        run(
+          const std::vector<unsigned int> &                     targets,
+          const std::function<RequestType(const unsigned int)> &create_request,
+          const std::function<AnswerType(const unsigned int,
+                                         const RequestType &)> &answer_request,
+          const std::function<void(const unsigned int, const AnswerType &)>
+            &             process_answer,
+          const MPI_Comm &comm) override;
+      };
+
+
+
+      /**
+       * This function implements a concrete algorithm for the consensus
+       * algorithms problem (see the documentation of the surrounding
+       * namespace) that aggregates the communication of all processes on a
+       * compute node, see the Hierarchical class for details.
+       *
+       * The arguments and the restrictions on the function objects are the
+       * same as for nbx().
+       *
+       * @tparam RequestType The type of the object to be sent.
+       * @tparam AnswerType The type of the object to be received.
+       */
+      template <typename RequestType, typename AnswerType>
+      std::vector<unsigned int>
+      hierarchical(
+        const std::vector<unsigned int> &                     targets,
+        const std::function<RequestType(const unsigned int)> &create_request,
+        const std::function<AnswerType(const unsigned int, const RequestType &)>
+          &answer_request,
+        const std::function<void(const unsigned int, const AnswerType &)>
+          &             process_answer,
+        const MPI_Comm &comm);
+
+      /**
+       * This function provides a specialization of the one above for
+       * the case where a sending process does not require an answer, see
+       * the corresponding version of nbx().
+       *
+       * @tparam RequestType The type of the object to be sent.
+       */
+      template <typename RequestType>
+      std::vector<unsigned int>
+      hierarchical(
+        const std::vector<unsigned int> &                     targets,
+        const std::function<RequestType(const unsigned int)> &create_request,
+        const std::function<void(const unsigned int, const RequestType &)>
+          &             process_request,
+        const MPI_Comm &comm);
+
+
       /**
        * A serial fall back for the above classes to allow programming
        * independently of whether MPI is used or not.
@@ -984,8 +1190,9 @@ namespace Utilities
        * A class which delegates its task to other
        * ConsensusAlgorithms::Interface implementations depending on the number
        * of processes in the MPI communicator. For a small number of processes
-       * it uses PEX and for a large number of processes NBX. The threshold
-       * depends if the program is compiled in debug or release mode, but the
+       * it uses PEX, for a large number of processes NBX, and for a very
+       * large number of processes Hierarchical. The thresholds
+       * depend if the program is compiled in debug or release mode, but the
        * goal is to always use the most efficient algorithm for however many
        * processes participate in the communication.
        *
@@ -1053,8 +1260,9 @@ namespace Utilities
        * surrounding namespace). In particular, it delegates its work
        * to one of the other functions in this namespace depending on the number
        * of processes in the MPI communicator. For a small number of processes
-       * it uses pex() and for a large number of processes nbx(). The threshold
-       * depends if the program is compiled in debug or release mode, but the
+       * it uses pex(), for a large number of processes nbx(), and for a very
+       * large number of processes hierarchical(). The thresholds
+       * depend if the program is compiled in debug or release mode, but the
        * goal is to always use the most efficient algorithm for however many
        * processes participate in the communication.
        *
@@ -1328,6 +1536,53 @@ namespace Utilities
 
 
 
+      template <typename RequestType, typename AnswerType>
+      std::vector<unsigned int>
+      hierarchical(
+        const std::vector<unsigned int> &                     targets,
+        const std::function<RequestType(const unsigned int)> &create_request,
+        const std::function<AnswerType(const unsigned int, const RequestType &)>
+          &answer_request,
+        const std::function<void(const unsigned int, const AnswerType &)>
+          &             process_answer,
+        const MPI_Comm &comm)
+      {
+        return Hierarchical<RequestType, AnswerType>().run(
+          targets, create_request, answer_request, process_answer, comm);
+      }
+
+
+
+      template <typename RequestType>
+      std::vector<unsigned int>
+      hierarchical(
+        const std::vector<unsigned int> &                     targets,
+        const std::function<RequestType(const unsigned int)> &create_request,
+        const std::function<void(const unsigned int, const RequestType &)>
+          &             process_request,
+        const MPI_Comm &comm)
+      {
+        // Forward to the other function with rewritten function objects and
+        // an empty answer type, as in nbx() and pex().
+        using EmptyType = std::tuple<>;
+
+        return hierarchical<RequestType, EmptyType>(
+          targets,
+          create_request,
+          // answer_request:
+          [&process_request](const unsigned int source_rank,
+                             const RequestType &request) -> EmptyType {
+            process_request(source_rank, request);
+            return {};
+          },
+          // process_answer:
+          [](const unsigned int /*target_rank */,
+             const EmptyType & /*answer*/) {},
+          comm);
+      }
+
+
+
       template <typename RequestType, typename AnswerType>
       std::vector<unsigned int>
       serial(
@@ -2384,6 +2639,122 @@ namespace Utilities
 
 
 
+      template <typename RequestType, typename AnswerType>
+      std::vector<unsigned int>
+      Hierarchical<RequestType, AnswerType>::run(
+        const std::vector<unsigned int> &                     targets,
+        const std::function<RequestType(const unsigned int)> &create_request,
+        const std::function<AnswerType(const unsigned int, const RequestType &)>
+          &answer_request,
+        const std::function<void(const unsigned int, const AnswerType &)>
+          &             process_answer,
+        const MPI_Comm &comm)
+      {
+        Assert(has_unique_elements(targets),
+               ExcMessage("The consensus algorithms expect that each process "
+                          "only sends a single message to another process, "
+                          "but the targets provided include duplicates."));
+
+        const unsigned int n_procs = (Utilities::MPI::job_supports_mpi() ?
+                                        Utilities::MPI::n_mpi_processes(comm) :
+                                        1);
+        if (n_procs == 1)
+          return Serial<RequestType, AnswerType>().run(
+            targets, create_request, answer_request, process_answer, comm);
+
+        std::set<unsigned int> requesting_processes;
+
+#  ifdef DEAL_II_WITH_MPI
+        const internal::NodeTopology &topology =
+          internal::get_node_topology(comm);
+        if (topology.max_node_size == 1)
+          return NBX<RequestType, AnswerType>().run(
+            targets, create_request, answer_request, process_answer, comm);
+
+        static CollectiveMutex      mutex;
+        CollectiveMutex::ScopedLock lock(mutex, comm);
+
+        try
+          {
+            const unsigned int my_rank = Utilities::MPI::this_mpi_process(comm);
+
+            // 1) Pack the requests of this process and deliver them to
+            //    their targets via the leaders of the nodes.
+            std::vector<char> requests;
+            for (const unsigned int target : targets)
+              {
+                const std::vector<char> request =
+                  (create_request ?
+                     Utilities::pack(create_request(target), false) :
+                     std::vector<char>());
+                internal::append_message(
+                  my_rank, target, request.cbegin(), request.cend(), requests);
+              }
+            requests = internal::scatter_messages_from_leader(
+              internal::route_messages_between_nodes(
+                internal::gather_messages_on_leader(requests, topology),
+                topology),
+              topology);
+
+            // 2) Answer the requests received by this process and return
+            //    the answers to the requesting processes the same way.
+            std::vector<char> answers;
+            internal::for_each_message(
+              requests,
+              [&](const unsigned int                       source,
+                  const unsigned int                       receiver,
+                  const std::vector<char>::const_iterator &begin,
+                  const std::vector<char>::const_iterator &end) {
+                (void)receiver;
+                Assert(receiver == my_rank, ExcInternalError());
+                requesting_processes.insert(source);
+
+                const std::vector<char> answer =
+                  (answer_request ?
+                     Utilities::pack(answer_request(
+                                       source,
+                                       Utilities::unpack<RequestType>(begin,
+                                                                      end,
+                                                                      false)),
+                                     false) :
+                     std::vector<char>());
+                internal::append_message(
+                  my_rank, source, answer.cbegin(), answer.cend(), answers);
+              });
+            answers = internal::scatter_messages_from_leader(
+              internal::route_messages_between_nodes(
+                internal::gather_messages_on_leader(answers, topology),
+                topology),
+              topology);
+
+            // 3) Process the answers to the requests of this process.
+            if (process_answer)
+              internal::for_each_message(
+                answers,
+                [&](const unsigned int                       target,
+                    const unsigned int                       receiver,
+                    const std::vector<char>::const_iterator &begin,
+                    const std::vector<char>::const_iterator &end) {
+                  (void)receiver;
+                  Assert(receiver == my_rank, ExcInternalError());
+                  process_answer(target,
+                                 Utilities::unpack<AnswerType>(begin,
+                                                               end,
+                                                               false));
+                });
+          }
+        catch (...)
+          {
+            handle_exception(std::current_exception(), comm);
+          }
+#  endif
+
+        return std::vector<unsigned int>(requesting_processes.begin(),
+                                         requesting_processes.end());
+      }
+
+
+
       template <typename RequestType, typename AnswerType>
       Serial<RequestType, AnswerType>::Serial(
         Process<RequestType, AnswerType> &process,
@@ -2469,10 +2840,15 @@ namespace Utilities
                                         1);
 #  ifdef DEAL_II_WITH_MPI
 #    ifdef DEBUG
-        if (n_procs > 10)
+        const unsigned int nbx_threshold          = 10;
+        const unsigned int hierarchical_threshold = 20;
 #    else
-        if (n_procs > 99)
+        const unsigned int nbx_threshold          = 99;
+        const unsigned int hierarchical_threshold = 1023;
 #    endif
+        if (n_procs > hierarchical_threshold)
+          consensus_algo.reset(new Hierarchical<RequestType, AnswerType>());
+        else if (n_procs > nbx_threshold)
           consensus_algo.reset(new NBX<RequestType, AnswerType>());
         else
 #  endif
@@ -24,6 +24,8 @@
 
 #include <deal.II/lac/vector_space_vector.h>
 
+#include <memory>
+
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -34,6 +36,17 @@ namespace Utilities
     /**
      * A flexible Partitioner class, which does not impose restrictions
      * regarding the order of the underlying index sets.
+     *
+     * Like Utilities::MPI::Partitioner for its import indices, this class
+     * stores the indices to be sent and received as contiguous ranges, so
+     * that the values can be packed into and unpacked from the communication
+     * buffer by block copies rather than one index at a time whenever the
+     * indices of a process are (partly) consecutive.
+     *
+     * Besides one value per index, several values per index (e.g., the
+     * components of a vector-valued quantity stored next to each other) and
+     * several vectors can be exchanged at once. In that case, all values
+     * destined for a process are sent in a single message.
      */
     class NoncontiguousPartitioner
       : public Utilities::MPI::CommunicationPatternBase
@@ -83,12 +96,38 @@ namespace Utilities
        *   update_values_finish() in sequence. Users can call these two
        *   functions separately and hereby overlap communication and
        *   computation.
+       *
+       * @note The MPI requests of this function are created as persistent
+       *   requests on first use and reused by subsequent calls with the same
+       *   type @p Number and the same @p n_components.
+       *
+       * If @p n_components is larger than one, each index refers to
+       * @p n_components consecutive entries of the arrays, i.e., the entries
+       * with numbers `i * n_components` up to `(i + 1) * n_components - 1`
+       * belong to index `i`.
        */
       template <typename Number>
       void
       export_to_ghosted_array(
         const ArrayView<const Number> &locally_owned_array,
-        const ArrayView<Number> &      ghost_array) const;
+        const ArrayView<Number> &      ghost_array,
+        const unsigned int             n_components = 1) const;
+
+      /**
+       * Same as above, but exchange the values of several vectors at once.
+       * The values of all vectors destined for one process are sent in a
+       * single message, which saves the latency of the separate messages
+       * required by repeated calls to the function above.
+       *
+       * @pre @p locally_owned_arrays and @p ghost_arrays must have the same
+       *   number of entries.
+       */
+      template <typename Number>
+      void
+      export_to_ghosted_array(
+        const std::vector<ArrayView<const Number>> &locally_owned_arrays,
+        const std::vector<ArrayView<Number>> &      ghost_arrays,
+        const unsigned int                          n_components = 1) const;
 
       /**
        * Same as above but with an interface similar to
@@ -98,8 +137,9 @@ namespace Utilities
        * used.
        *
        * @pre The size of the @p temporary_storage vector has to be at least
-       *   temporary_storage_size. The reason for this is that this vector is
-       *   used as buffer for both sending and receiving data.
+       *   temporary_storage_size() times @p n_components. The reason for this
+       *   is that this vector is used as buffer for both sending and
+       *   receiving data.
        *
        * @note Any value less than 10 is a valid value of
        *   @p communication_channel.
@@ -111,7 +151,8 @@ namespace Utilities
         const ArrayView<const Number> &locally_owned_array,
         const ArrayView<Number> &      temporary_storage,
         const ArrayView<Number> &      ghost_array,
-        std::vector<MPI_Request> &     requests) const;
+        std::vector<MPI_Request> &     requests,
+        const unsigned int             n_components = 1) const;
 
       /**
        * Start update: Data is packed, non-blocking send and receives
@@ -135,7 +176,25 @@ namespace Utilities
         const unsigned int             communication_channel,
         const ArrayView<const Number> &locally_owned_array,
         const ArrayView<Number> &      temporary_storage,
-        std::vector<MPI_Request> &     requests) const;
+        std::vector<MPI_Request> &     requests,
+        const unsigned int             n_components = 1) const;
+
+      /**
+       * Same as above, but for several vectors whose values are sent in one
+       * message per process.
+       *
+       * @pre The size of the @p temporary_storage vector has to be at least
+       *   temporary_storage_size() times the number of vectors times
+       *   @p n_components.
+       */
+      template <typename Number>
+      void
+      export_to_ghosted_array_start(
+        const unsigned int                          communication_channel,
+        const std::vector<ArrayView<const Number>> &locally_owned_arrays,
+        const ArrayView<Number> &                   temporary_storage,
+        std::vector<MPI_Request> &                  requests,
+        const unsigned int                          n_components = 1) const;
 
       /**
        * Finish update. The method waits until all data has been sent and
@@ -156,7 +215,20 @@ namespace Utilities
       export_to_ghosted_array_finish(
         const ArrayView<const Number> &temporary_storage,
         const ArrayView<Number> &      ghost_array,
-        std::vector<MPI_Request> &     requests) const;
+        std::vector<MPI_Request> &     requests,
+        const unsigned int             n_components = 1) const;
+
+      /**
+       * Same as above, but for several vectors, matching the respective
+       * variant of export_to_ghosted_array_start().
+       */
+      template <typename Number>
+      void
+      export_to_ghosted_array_finish(
+        const ArrayView<const Number> &       temporary_storage,
+        const std::vector<ArrayView<Number>> &ghost_arrays,
+        std::vector<MPI_Request> &            requests,
+        const unsigned int                    n_components = 1) const;
 
       /**
        * Returns the number of processes this process sends data to and the
@@ -167,8 +239,10 @@ namespace Utilities
 
       /**
        * Return the size of the temporary storage needed by the
-       * export_to_ghosted_array() functions, if the temporary storage is
-       * handled by the user code.
+       * export_to_ghosted_array() functions for one value per index, if the
+       * temporary storage is handled by the user code. When several values
+       * per index or several vectors are exchanged, the size has to be
+       * multiplied by the number of values per index.
        */
       unsigned int
       temporary_storage_size() const;
@@ -202,6 +276,114 @@ namespace Utilities
              const MPI_Comm &                            communicator);
 
     private:
+      /**
+       * Set up the ranks and the offsets of the communication pattern and
+       * return the local indices of the entries to be sent and received in
+       * the order of the buffer.
+       */
+      void
+      setup_communication_pattern(
+        const IndexSet &                      indexset_locally_owned,
+        const IndexSet &                      indexset_ghost,
+        const MPI_Comm &                      communicator,
+        std::vector<types::global_dof_index> &send_indices,
+        std::vector<types::global_dof_index> &recv_indices);
+
+      /**
+       * Compress the indices @p send_indices and @p recv_indices into
+       * contiguous ranges, stored in send_indices_data and recv_indices_data.
+       */
+      void
+      compress_indices(
+        const std::vector<types::global_dof_index> &send_indices,
+        const std::vector<types::global_dof_index> &recv_indices);
+
+      /**
+       * Copy the values of the arrays @p locally_owned_arrays to be sent to
+       * the process `send_ranks[send_rank_index]` into @p buffer.
+       */
+      template <typename Number>
+      void
+      pack_send_data(
+        const unsigned int                              send_rank_index,
+        const ArrayView<const ArrayView<const Number>> &locally_owned_arrays,
+        Number *                                        buffer,
+        const unsigned int                              n_components) const;
+
+      /**
+       * Copy the values received from the process
+       * `recv_ranks[recv_rank_index]` from @p buffer into the arrays
+       * @p ghost_arrays.
+       */
+      template <typename Number>
+      void
+      unpack_recv_data(
+        const unsigned int                        recv_rank_index,
+        const Number *                            buffer,
+        const ArrayView<const ArrayView<Number>> &ghost_arrays,
+        const unsigned int                        n_components) const;
+
+      /**
+       * Implementation of both export_to_ghosted_array_start() functions.
+       */
+      template <typename Number>
+      void
+      export_to_ghosted_array_start_impl(
+        const unsigned int                              communication_channel,
+        const ArrayView<const ArrayView<const Number>> &locally_owned_arrays,
+        const ArrayView<Number> &                       temporary_storage,
+        std::vector<MPI_Request> &                      requests,
+        const unsigned int                              n_components) const;
+
+      /**
+       * Implementation of both export_to_ghosted_array_finish() functions.
+       */
+      template <typename Number>
+      void
+      export_to_ghosted_array_finish_impl(
+        const ArrayView<const Number> &           temporary_storage,
+        const ArrayView<const ArrayView<Number>> &ghost_arrays,
+        std::vector<MPI_Request> &                requests,
+        const unsigned int                        n_components) const;
+
+      /**
+       * Implementation of both export_to_ghosted_array() functions that
+       * manage the buffers internally. The MPI requests are persistent
+       * requests that are set up for the given number of values per index.
+       */
+      template <typename Number>
+      void
+      export_to_ghosted_array_persistent(
+        const ArrayView<const ArrayView<const Number>> &locally_owned_arrays,
+        const ArrayView<const ArrayView<Number>> &       ghost_arrays,
+        const unsigned int                              n_components) const;
+
+      /**
+       * Persistent MPI requests for the internal buffers, created by the
+       * export_to_ghosted_array() functions that do not take user buffers.
+       */
+      struct PersistentRequests
+      {
+        /**
+         * Destructor. Free the requests.
+         */
+        ~PersistentRequests();
+
+        /**
+         * The requests, first those of the send operations and then those
+         * of the receive operations.
+         */
+        std::vector<MPI_Request> requests;
+
+        /**
+         * The buffer, data type, and number of values per index the requests
+         * have been set up for.
+         */
+        const void * buffer;
+        MPI_Datatype datatype;
+        unsigned int n_values;
+      };
+
       /**
        * MPI communicator.
        */
@@ -220,12 +402,19 @@ namespace Utilities
       std::vector<types::global_dof_index> send_ptr;
 
       /**
-       * Local index of each entry in send_buffer within the destination
-       * vector.
-       *
-       * @note Together with `send_ptr` this forms a CRS data structure.
+       * Local indices of the entries in send_buffer within the source vector,
+       * compressed into half-open ranges `[first, second)`. The ranges of
+       * the process `send_ranks[i]` are the ones with numbers between
+       * `send_indices_chunks_by_rank[i]` and
+       * `send_indices_chunks_by_rank[i+1]`.
+       */
+      std::vector<std::pair<types::global_dof_index, types::global_dof_index>>
+        send_indices_data;
+
+      /**
+       * Offset of the ranges of each process within send_indices_data.
        */
-      std::vector<types::global_dof_index> send_indices;
+      std::vector<unsigned int> send_indices_chunks_by_rank;
 
       /**
        * The ranks this process receives data from.
@@ -240,12 +429,16 @@ namespace Utilities
       std::vector<types::global_dof_index> recv_ptr;
 
       /**
-       * Local index of each entry in recv_buffer within the destination
-       * vector.
-       *
-       * @note Together with `recv_ptr` this forms a CRS data structure.
+       * Local indices of the entries in recv_buffer within the destination
+       * vector, compressed into half-open ranges like send_indices_data.
+       */
+      std::vector<std::pair<types::global_dof_index, types::global_dof_index>>
+        recv_indices_data;
+
+      /**
+       * Offset of the ranges of each process within recv_indices_data.
        */
-      std::vector<types::global_dof_index> recv_indices;
+      std::vector<unsigned int> recv_indices_chunks_by_rank;
 
       /**
        * Buffer containing the values sorted by rank for sending and receiving.
@@ -259,11 +452,12 @@ namespace Utilities
       mutable std::vector<std::uint8_t> buffers;
 
       /**
-       * MPI requests for sending and receiving.
+       * Persistent MPI requests for sending and receiving from the internal
+       * buffers.
        *
        * @note Only allocated if not provided externally by user.
        */
-      mutable std::vector<MPI_Request> requests;
+      mutable std::shared_ptr<PersistentRequests> persistent_requests;
     };
 
   } // namespace MPI
@@ -26,6 +26,8 @@
 
 #include <deal.II/lac/vector_space_vector.h>
 
+#include <algorithm>
+
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -37,26 +39,32 @@ namespace Utilities
     void
     NoncontiguousPartitioner::export_to_ghosted_array(
       const ArrayView<const Number> &src,
-      const ArrayView<Number> &      dst) const
+      const ArrayView<Number> &      dst,
+      const unsigned int             n_components) const
     {
-      // allocate internal memory since needed
-      if (requests.size() != send_ranks.size() + recv_ranks.size())
-        requests.resize(send_ranks.size() + recv_ranks.size());
-
-      if (this->buffers.size() != send_ptr.back() * sizeof(Number))
-        this->buffers.resize(this->temporary_storage_size() * sizeof(Number));
-
-      // perform actual exchange
-      this->template export_to_ghosted_array<Number>(
-        0,
-        src,
-        ArrayView<Number>(reinterpret_cast<Number *>(this->buffers.data()),
-                          send_ptr.back()),
-        dst,
-        this->requests);
+      this->template export_to_ghosted_array_persistent<Number>(
+        ArrayView<const ArrayView<const Number>>(&src, 1),
+        ArrayView<const ArrayView<Number>>(&dst, 1),
+        n_components);
     }
 
 
+
+    template <typename Number>
+    void
+    NoncontiguousPartitioner::export_to_ghosted_array(
+      const std::vector<ArrayView<const Number>> &src,
+      const std::vector<ArrayView<Number>> &      dst,
+      const unsigned int                          n_components) const
+    {
+      AssertDimension(src.size(), dst.size());
+
+      this->template export_to_ghosted_array_persistent<Number>(
+        make_array_view(src), make_array_view(dst), n_components);
+    }
+
+
+
     template <typename Number>
     void
     NoncontiguousPartitioner::export_to_ghosted_array(
@@ -64,16 +72,19 @@ namespace Utilities
       const ArrayView<const Number> &locally_owned_array,
       const ArrayView<Number> &      temporary_storage,
       const ArrayView<Number> &      ghost_array,
-      std::vector<MPI_Request> &     requests) const
+      std::vector<MPI_Request> &     requests,
+      const unsigned int             n_components) const
     {
       this->template export_to_ghosted_array_start<Number>(
         communication_channel,
         locally_owned_array,
         temporary_storage,
-        requests);
+        requests,
+        n_components);
       this->template export_to_ghosted_array_finish<Number>(temporary_storage,
                                                             ghost_array,
-                                                            requests);
+                                                            requests,
+                                                            n_components);
     }
 
 
@@ -84,16 +95,160 @@ namespace Utilities
       const unsigned int             communication_channel,
       const ArrayView<const Number> &src,
       const ArrayView<Number> &      buffers,
-      std::vector<MPI_Request> &     requests) const
+      std::vector<MPI_Request> &     requests,
+      const unsigned int             n_components) const
+    {
+      this->template export_to_ghosted_array_start_impl<Number>(
+        communication_channel,
+        ArrayView<const ArrayView<const Number>>(&src, 1),
+        buffers,
+        requests,
+        n_components);
+    }
+
+
+
+    template <typename Number>
+    void
+    NoncontiguousPartitioner::export_to_ghosted_array_start(
+      const unsigned int                          communication_channel,
+      const std::vector<ArrayView<const Number>> &src,
+      const ArrayView<Number> &                   buffers,
+      std::vector<MPI_Request> &                  requests,
+      const unsigned int                          n_components) const
+    {
+      this->template export_to_ghosted_array_start_impl<Number>(
+        communication_channel,
+        make_array_view(src),
+        buffers,
+        requests,
+        n_components);
+    }
+
+
+
+    template <typename Number>
+    void
+    NoncontiguousPartitioner::export_to_ghosted_array_finish(
+      const ArrayView<const Number> &buffers,
+      const ArrayView<Number> &      dst,
+      std::vector<MPI_Request> &     requests,
+      const unsigned int             n_components) const
+    {
+      this->template export_to_ghosted_array_finish_impl<Number>(
+        buffers,
+        ArrayView<const ArrayView<Number>>(&dst, 1),
+        requests,
+        n_components);
+    }
+
+
+
+    template <typename Number>
+    void
+    NoncontiguousPartitioner::export_to_ghosted_array_finish(
+      const ArrayView<const Number> &       buffers,
+      const std::vector<ArrayView<Number>> &dst,
+      std::vector<MPI_Request> &            requests,
+      const unsigned int                    n_components) const
+    {
+      this->template export_to_ghosted_array_finish_impl<Number>(
+        buffers, make_array_view(dst), requests, n_components);
+    }
+
+
+
+    template <typename Number>
+    void
+    NoncontiguousPartitioner::pack_send_data(
+      const unsigned int                              send_rank_index,
+      const ArrayView<const ArrayView<const Number>> &src,
+      Number *                                        buffer,
+      const unsigned int                              n_components) const
+    {
+      for (unsigned int c = send_indices_chunks_by_rank[send_rank_index];
+           c < send_indices_chunks_by_rank[send_rank_index + 1];
+           ++c)
+        {
+          const auto &range = send_indices_data[c];
+          for (const auto &array : src)
+            AssertIndexRange(range.second * n_components, array.size() + 1);
+
+          // the values of a single vector are stored in the same order in
+          // the buffer, so the whole range can be copied at once
+          if (src.size() == 1)
+            buffer = std::copy(src[0].data() + range.first * n_components,
+                               src[0].data() + range.second * n_components,
+                               buffer);
+          else
+            for (types::global_dof_index k = range.first; k < range.second;
+                 ++k)
+              for (const auto &array : src)
+                for (unsigned int d = 0; d < n_components; ++d)
+                  *buffer++ = array[k * n_components + d];
+        }
+    }
+
+
+
+    template <typename Number>
+    void
+    NoncontiguousPartitioner::unpack_recv_data(
+      const unsigned int                        recv_rank_index,
+      const Number *                            buffer,
+      const ArrayView<const ArrayView<Number>> &dst,
+      const unsigned int                        n_components) const
+    {
+      for (unsigned int c = recv_indices_chunks_by_rank[recv_rank_index];
+           c < recv_indices_chunks_by_rank[recv_rank_index + 1];
+           ++c)
+        {
+          const auto &range = recv_indices_data[c];
+          for (const auto &array : dst)
+            AssertIndexRange(range.second * n_components, array.size() + 1);
+
+          if (dst.size() == 1)
+            {
+              const types::global_dof_index n_entries =
+                (range.second - range.first) * n_components;
+              std::copy(buffer,
+                        buffer + n_entries,
+                        dst[0].data() + range.first * n_components);
+              buffer += n_entries;
+            }
+          else
+            for (types::global_dof_index k = range.first; k < range.second;
+                 ++k)
+              for (const auto &array : dst)
+                for (unsigned int d = 0; d < n_components; ++d)
+                  array[k * n_components + d] = *buffer++;
+        }
+    }
+
+
+
+    template <typename Number>
+    void
+    NoncontiguousPartitioner::export_to_ghosted_array_start_impl(
+      const unsigned int                              communication_channel,
+      const ArrayView<const ArrayView<const Number>> &src,
+      const ArrayView<Number> &                       buffers,
+      std::vector<MPI_Request> &                      requests,
+      const unsigned int                              n_components) const
     {
 #ifndef DEAL_II_WITH_MPI
       (void)communication_channel;
       (void)src;
       (void)buffers;
       (void)requests;
+      (void)n_components;
       Assert(false, ExcNeedsMPI());
 #else
       AssertDimension(requests.size(), recv_ranks.size() + send_ranks.size());
+      Assert(src.size() > 0, ExcMessage("At least one vector is required."));
+      Assert(n_components > 0, ExcMessage("At least one component per index."));
+
+      const unsigned int n_values = src.size() * n_components;
 
       const auto tag =
         communication_channel +
@@ -108,8 +263,8 @@ namespace Utilities
       for (types::global_dof_index i = 0; i < recv_ranks.size(); ++i)
         {
           const int ierr =
-            MPI_Irecv(buffers.data() + recv_ptr[i],
-                      recv_ptr[i + 1] - recv_ptr[i],
+            MPI_Irecv(buffers.data() + recv_ptr[i] * n_values,
+                      (recv_ptr[i + 1] - recv_ptr[i]) * n_values,
                       Utilities::MPI::mpi_type_id_for_type<Number>,
                       recv_ranks[i],
                       tag,
@@ -120,25 +275,20 @@ namespace Utilities
 
       // post send
       AssertIndexRange(send_ranks.size(), send_ptr.size());
-      for (types::global_dof_index i = 0, k = 0; i < send_ranks.size(); ++i)
+      for (types::global_dof_index i = 0; i < send_ranks.size(); ++i)
         {
           // collect data to be send
-          for (types::global_dof_index j = send_ptr[i]; j < send_ptr[i + 1];
-               j++)
-            {
-              AssertIndexRange(k, send_indices.size());
-              buffers[j] = src[send_indices[k]];
-              ++k;
-            }
+          Assert(send_ptr[i + 1] * n_values <= buffers.size(),
+                 ExcMessage("The input buffer doesn't contain enough entries"));
+          pack_send_data(i,
+                         src,
+                         buffers.data() + send_ptr[i] * n_values,
+                         n_components);
 
           // send data
-          Assert((send_ptr[i] < buffers.size()) ||
-                   (send_ptr[i] == buffers.size() &&
-                    send_ptr[i + 1] == send_ptr[i]),
-                 ExcMessage("The input buffer doesn't contain enough entries"));
           const int ierr =
-            MPI_Isend(buffers.data() + send_ptr[i],
-                      send_ptr[i + 1] - send_ptr[i],
+            MPI_Isend(buffers.data() + send_ptr[i] * n_values,
+                      (send_ptr[i + 1] - send_ptr[i]) * n_values,
                       Utilities::MPI::mpi_type_id_for_type<Number>,
                       send_ranks[i],
                       tag,
@@ -153,17 +303,21 @@ namespace Utilities
 
     template <typename Number>
     void
-    NoncontiguousPartitioner::export_to_ghosted_array_finish(
-      const ArrayView<const Number> &buffers,
-      const ArrayView<Number> &      dst,
-      std::vector<MPI_Request> &     requests) const
+    NoncontiguousPartitioner::export_to_ghosted_array_finish_impl(
+      const ArrayView<const Number> &           buffers,
+      const ArrayView<const ArrayView<Number>> &dst,
+      std::vector<MPI_Request> &                requests,
+      const unsigned int                        n_components) const
     {
 #ifndef DEAL_II_WITH_MPI
       (void)buffers;
       (void)dst;
       (void)requests;
+      (void)n_components;
       Assert(false, ExcNeedsMPI());
 #else
+      const unsigned int n_values = dst.size() * n_components;
+
       // receive all data packages and copy data from buffers
       for (types::global_dof_index proc = 0; proc < recv_ranks.size(); ++proc)
         {
@@ -176,10 +330,10 @@ namespace Utilities
           AssertThrowMPI(ierr);
 
           AssertIndexRange(i + 1, recv_ptr.size());
-          for (types::global_dof_index j = recv_ptr[i], c = 0;
-               j < recv_ptr[i + 1];
-               j++)
-            dst[recv_indices[j]] = buffers[recv_ptr[i] + c++];
+          unpack_recv_data(i,
+                           buffers.data() + recv_ptr[i] * n_values,
+                           dst,
+                           n_components);
         }
 
       // wait that all data packages have been sent
@@ -189,6 +343,108 @@ namespace Utilities
 #endif
     }
 
+
+
+    template <typename Number>
+    void
+    NoncontiguousPartitioner::export_to_ghosted_array_persistent(
+      const ArrayView<const ArrayView<const Number>> &src,
+      const ArrayView<const ArrayView<Number>> &      dst,
+      const unsigned int                              n_components) const
+    {
+#ifndef DEAL_II_WITH_MPI
+      (void)src;
+      (void)dst;
+      (void)n_components;
+      Assert(false, ExcNeedsMPI());
+#else
+      Assert(src.size() > 0, ExcMessage("At least one vector is required."));
+      Assert(n_components > 0, ExcMessage("At least one component per index."));
+
+      const unsigned int n_values = src.size() * n_components;
+      const std::size_t  buffer_size =
+        this->temporary_storage_size() * n_values * sizeof(Number);
+      if (buffers.size() != buffer_size)
+        buffers.resize(buffer_size);
+
+      const MPI_Datatype datatype =
+        Utilities::MPI::mpi_type_id_for_type<Number>;
+      Number *buffer = reinterpret_cast<Number *>(buffers.data());
+
+      // set up the persistent requests unless they exist for the present
+      // buffer and data type already
+      if (persistent_requests == nullptr ||
+          persistent_requests->buffer != buffers.data() ||
+          persistent_requests->datatype != datatype ||
+          persistent_requests->n_values != n_values)
+        {
+          persistent_requests = std::make_shared<PersistentRequests>();
+          persistent_requests->buffer   = buffers.data();
+          persistent_requests->datatype = datatype;
+          persistent_requests->n_values = n_values;
+          persistent_requests->requests.resize(send_ranks.size() +
+                                               recv_ranks.size());
+
+          const int tag =
+            internal::Tags::noncontiguous_partitioner_update_ghost_values_start;
+          for (unsigned int i = 0; i < send_ranks.size(); ++i)
+            {
+              const int ierr =
+                MPI_Send_init(buffer + send_ptr[i] * n_values,
+                              (send_ptr[i + 1] - send_ptr[i]) * n_values,
+                              datatype,
+                              send_ranks[i],
+                              tag,
+                              communicator,
+                              &persistent_requests->requests[i]);
+              AssertThrowMPI(ierr);
+            }
+          for (unsigned int i = 0; i < recv_ranks.size(); ++i)
+            {
+              const int ierr = MPI_Recv_init(
+                buffer + recv_ptr[i] * n_values,
+                (recv_ptr[i + 1] - recv_ptr[i]) * n_values,
+                datatype,
+                recv_ranks[i],
+                tag,
+                communicator,
+                &persistent_requests->requests[send_ranks.size() + i]);
+              AssertThrowMPI(ierr);
+            }
+        }
+
+      std::vector<MPI_Request> &requests = persistent_requests->requests;
+
+      // start the receives before packing the data
+      if (recv_ranks.size() > 0)
+        {
+          const int ierr = MPI_Startall(recv_ranks.size(),
+                                        requests.data() + send_ranks.size());
+          AssertThrowMPI(ierr);
+        }
+
+      // pack the data and start the send to each process once its part of
+      // the buffer is filled
+      for (unsigned int i = 0; i < send_ranks.size(); ++i)
+        {
+          pack_send_data(i, src, buffer + send_ptr[i] * n_values, n_components);
+
+          const int ierr = MPI_Start(&requests[i]);
+          AssertThrowMPI(ierr);
+        }
+
+      // unpacking and waiting for the sends is the same as for regular
+      // requests, since MPI_Waitany() and MPI_Waitall() deactivate the
+      // persistent requests without freeing them
+      this->template export_to_ghosted_array_finish_impl<Number>(
+        ArrayView<const Number>(buffer,
+                                this->temporary_storage_size() * n_values),
+        dst,
+        requests,
+        n_components);
+#endif
+    }
+
   } // namespace MPI
 } // namespace Utilities
 
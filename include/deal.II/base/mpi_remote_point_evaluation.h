@@ -86,6 +86,23 @@ namespace Utilities
              const Triangulation<dim, spacedim> &tria,
              const Mapping<dim, spacedim> &      mapping);
 
+      /**
+       * Update the internal data structures for the points passed to the last
+       * call of reinit() after the mesh has moved, e.g., because the vertices
+       * of the triangulation or the displacement vector of a
+       * MappingQEulerian object have been changed, and return whether the
+       * communication pattern could be kept. Each point is first searched in
+       * the cell it has been found in before and then, with that cell as a
+       * hint, in the surrounding cells. Only if a point has moved out of the
+       * locally owned cells or if the map of points to cells is not unique,
+       * the points are located from scratch with reinit().
+       *
+       * @warning This is a collective call that needs to be executed by all
+       *   processors in the communicator.
+       */
+      bool
+      update_point_locations(const Mapping<dim, spacedim> &mapping);
+
       /**
        * Data of points positioned in a cell.
        */
@@ -119,6 +136,14 @@ namespace Utilities
        *   vertex) that is shared by multiple cells or a point is outside of the
        *   computational domain.
        *
+       * Several quantities can be transferred in a single round of
+       * communication by setting @p n_values_per_point to a value larger
+       * than one. In that case, @p evaluation_function needs to write
+       * @p n_values_per_point consecutive values for each reference point, and
+       * the values associated with entry $i$ of get_point_ptrs() are placed
+       * at positions <code>i * n_values_per_point</code> to
+       * <code>(i + 1) * n_values_per_point - 1</code> of @p output.
+       *
        * @warning This is a collective call that needs to be executed by all
        *   processors in the communicator.
        */
@@ -128,13 +153,21 @@ namespace Utilities
         std::vector<T> &output,
         std::vector<T> &buffer,
         const std::function<void(const ArrayView<T> &, const CellData &)>
-          &evaluation_function) const;
+          &                evaluation_function,
+        const unsigned int n_values_per_point = 1) const;
 
       /**
        * This method is the inverse of the method evaluate_and_process(). It
        * makes the data at the points, provided by @p input, available in the
        * function @p evaluation_function.
        *
+       * As for evaluate_and_process(), several quantities per point can be
+       * transferred by setting @p n_values_per_point to a value larger than
+       * one. Then, @p input contains @p n_values_per_point consecutive values
+       * for each point passed to reinit(), and @p evaluation_function
+       * receives @p n_values_per_point consecutive values for each reference
+       * point.
+       *
        * @warning This is a collective call that needs to be executed by all
        *   processors in the communicator.
        */
@@ -144,7 +177,8 @@ namespace Utilities
         const std::vector<T> &input,
         std::vector<T> &      buffer,
         const std::function<void(const ArrayView<const T> &, const CellData &)>
-          &evaluation_function) const;
+          &                evaluation_function,
+        const unsigned int n_values_per_point = 1) const;
 
       /**
        * Return a CRS-like data structure to determine the position of the
@@ -223,6 +257,18 @@ namespace Utilities
        */
       boost::signals2::connection tria_signal;
 
+      /**
+       * The points passed to the last call of reinit().
+       */
+      std::vector<Point<spacedim>> points;
+
+      /**
+       * The real-space positions of the points in the order of
+       * CellData::reference_point_values, needed to find the points again in
+       * update_point_locations().
+       */
+      std::vector<Point<spacedim>> cell_point_values;
+
       /**
        * Flag indicating if the reinit() function has been called and if yes
        * the triangulation has not been modified since then (potentially
@@ -304,19 +350,24 @@ namespace Utilities
       std::vector<T> &output,
       std::vector<T> &buffer,
       const std::function<void(const ArrayView<T> &, const CellData &)>
-        &evaluation_function) const
+        &                evaluation_function,
+      const unsigned int n_values_per_point) const
     {
 #ifndef DEAL_II_WITH_MPI
       Assert(false, ExcNeedsMPI());
       (void)output;
       (void)buffer;
       (void)evaluation_function;
+      (void)n_values_per_point;
 #else
       static CollectiveMutex      mutex;
       CollectiveMutex::ScopedLock lock(mutex, tria->get_communicator());
 
-      output.resize(point_ptrs.back());
-      buffer.resize(send_permutation.size() * 2);
+      const unsigned int n = n_values_per_point;
+      Assert(n > 0, ExcMessage("At least one value per point is needed."));
+
+      output.resize(point_ptrs.back() * n);
+      buffer.resize(send_permutation.size() * n * 2);
       ArrayView<T> buffer_1(buffer.data(), buffer.size() / 2);
       ArrayView<T> buffer_2(buffer.data() + buffer.size() / 2,
                             buffer.size() / 2);
@@ -326,7 +377,8 @@ namespace Utilities
 
       // sort for communication
       for (unsigned int i = 0; i < send_permutation.size(); ++i)
-        buffer_2[send_permutation[i]] = buffer_1[i];
+        for (unsigned int c = 0; c < n; ++c)
+          buffer_2[send_permutation[i] * n + c] = buffer_1[i * n + c];
 
       // process remote quadrature points and send them away
       std::map<unsigned int, std::vector<char>> temp_map;
@@ -345,14 +397,15 @@ namespace Utilities
             {
               // process locally-owned values
               temp_recv_map[my_rank] =
-                std::vector<T>(buffer_2.begin() + send_ptrs[i],
-                               buffer_2.begin() + send_ptrs[i + 1]);
+                std::vector<T>(buffer_2.begin() + send_ptrs[i] * n,
+                               buffer_2.begin() + send_ptrs[i + 1] * n);
               continue;
             }
 
           temp_map[send_ranks[i]] =
-            Utilities::pack(std::vector<T>(buffer_2.begin() + send_ptrs[i],
-                                           buffer_2.begin() + send_ptrs[i + 1]),
+            Utilities::pack(std::vector<T>(buffer_2.begin() + send_ptrs[i] * n,
+                                           buffer_2.begin() +
+                                             send_ptrs[i + 1] * n),
                             false);
 
           auto &buffer = temp_map[send_ranks[i]];
@@ -408,11 +461,9 @@ namespace Utilities
       // copy received data into output vector
       auto it = recv_permutation.begin();
       for (const auto &j : temp_recv_map)
-        for (const auto &i : j.second)
-          {
-            output[*it] = i;
-            it++;
-          }
+        for (unsigned int i = 0; i < j.second.size(); i += n, ++it)
+          for (unsigned int c = 0; c < n; ++c)
+            output[*it * n + c] = j.second[i + c];
 #endif
     }
 
@@ -424,23 +475,30 @@ namespace Utilities
       const std::vector<T> &input,
       std::vector<T> &      buffer,
       const std::function<void(const ArrayView<const T> &, const CellData &)>
-        &evaluation_function) const
+        &                evaluation_function,
+      const unsigned int n_values_per_point) const
     {
 #ifndef DEAL_II_WITH_MPI
       Assert(false, ExcNeedsMPI());
       (void)input;
       (void)buffer;
       (void)evaluation_function;
+      (void)n_values_per_point;
 #else
       static CollectiveMutex      mutex;
       CollectiveMutex::ScopedLock lock(mutex, tria->get_communicator());
 
+      const unsigned int n = n_values_per_point;
+      Assert(n > 0, ExcMessage("At least one value per point is needed."));
+
       const auto &ptr = this->get_point_ptrs();
+      AssertDimension(input.size(), (ptr.size() - 1) * n);
 
       std::map<unsigned int, std::vector<T>> temp_recv_map;
 
       for (unsigned int i = 0; i < recv_ranks.size(); ++i)
-        temp_recv_map[recv_ranks[i]].resize(recv_ptrs[i + 1] - recv_ptrs[i]);
+        temp_recv_map[recv_ranks[i]].resize((recv_ptrs[i + 1] - recv_ptrs[i]) *
+                                            n);
 
       const unsigned int my_rank =
         Utilities::MPI::this_mpi_process(tria->get_communicator());
@@ -452,33 +510,32 @@ namespace Utilities
         for (auto &j : temp_recv_map)
           i += j.second.size();
 
-        AssertDimension(recv_permutation.size(), i);
+        AssertDimension(recv_permutation.size() * n, i);
       }
 #  endif
 
       {
         // duplicate data to be able to sort it more easily in the next step
-        std::vector<T> buffer_(ptr.back());
+        std::vector<T> buffer_(ptr.back() * n);
         for (unsigned int i = 0, c = 0; i < ptr.size() - 1; ++i)
           {
             const auto n_entries = ptr[i + 1] - ptr[i];
 
             for (unsigned int j = 0; j < n_entries; ++j, ++c)
-              buffer_[c] = input[i];
+              for (unsigned int k = 0; k < n; ++k)
+                buffer_[c * n + k] = input[i * n + k];
           }
 
         // sort data according to the ranks
         auto it = recv_permutation.begin();
         for (auto &j : temp_recv_map)
-          for (auto &i : j.second)
-            {
-              i = buffer_[*it];
-              it++;
-            }
+          for (unsigned int i = 0; i < j.second.size(); i += n, ++it)
+            for (unsigned int k = 0; k < n; ++k)
+              j.second[i + k] = buffer_[*it * n + k];
       }
 
       // buffer.resize(point_ptrs.back());
-      buffer.resize(send_permutation.size() * 2);
+      buffer.resize(send_permutation.size() * n * 2);
       ArrayView<T> buffer_1(buffer.data(), buffer.size() / 2);
       ArrayView<T> buffer_2(buffer.data() + buffer.size() / 2,
                             buffer.size() / 2);
@@ -523,9 +580,10 @@ namespace Utilities
                                                              my_rank));
 
               AssertDimension(buffer_send.size(),
-                              send_ptrs[j + 1] - send_ptrs[j]);
+                              (send_ptrs[j + 1] - send_ptrs[j]) * n);
 
-              for (unsigned int i = send_ptrs[j], c = 0; i < send_ptrs[j + 1];
+              for (unsigned int i = send_ptrs[j] * n, c = 0;
+                   i < send_ptrs[j + 1] * n;
                    ++i, ++c)
                 buffer_1[i] = buffer_send[c];
 
@@ -565,9 +623,10 @@ namespace Utilities
           const unsigned int j = std::distance(send_ranks.begin(), ptr);
 
           AssertDimension(recv_buffer_unpacked.size(),
-                          send_ptrs[j + 1] - send_ptrs[j]);
+                          (send_ptrs[j + 1] - send_ptrs[j]) * n);
 
-          for (unsigned int i = send_ptrs[j], c = 0; i < send_ptrs[j + 1];
+          for (unsigned int i = send_ptrs[j] * n, c = 0;
+               i < send_ptrs[j + 1] * n;
                ++i, ++c)
             {
               AssertIndexRange(i, buffer_1.size());
@@ -582,7 +641,8 @@ namespace Utilities
 
       // sort for easy access during function call
       for (unsigned int i = 0; i < send_permutation.size(); ++i)
-        buffer_2[i] = buffer_1[send_permutation[i]];
+        for (unsigned int c = 0; c < n; ++c)
+          buffer_2[i * n + c] = buffer_1[send_permutation[i] * n + c];
 
       // evaluate function at points
       evaluation_function(buffer_2, cell_data);
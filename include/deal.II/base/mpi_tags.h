@@ -119,6 +119,8 @@ namespace Utilities
           scalapack_copy_to2,
           /// ScaLAPACKMatrix<NumberType>::copy_from
           scalapack_copy_from,
+          /// ScaLAPACKMatrix<NumberType>::copy_to_async
+          scalapack_copy_to_async,
 
           /// ProcessGrid::ProcessGrid
           process_grid_constructor,
@@ -153,6 +155,10 @@ namespace Utilities
           affine_constraints_make_consistent_in_parallel_0,
           affine_constraints_make_consistent_in_parallel_1,
 
+          // DataOutInterface::write_vtu_in_parallel() with aggregation of the
+          // data on shared-memory nodes
+          data_out_aggregate_pieces,
+
         };
       } // namespace Tags
     }   // namespace internal
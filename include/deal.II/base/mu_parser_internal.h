@@ -142,9 +142,18 @@ namespace internal
        */
       ParserData(const ParserData &) = delete;
 
+      /**
+       * The maximal number of points evaluated by a single call to the bulk
+       * mode of muParser.
+       */
+      static constexpr unsigned int max_bulk_size = 64;
+
       /**
        * Scratch array used to set independent variables (i.e., x, y, and t)
-       * before each muParser call.
+       * before each muParser call. The values of variable $i$ are stored at
+       * positions <code>i * max_bulk_size</code> to
+       * <code>(i + 1) * max_bulk_size - 1</code>, as required by the bulk
+       * mode of muParser; a single evaluation only uses the first entry.
        */
       std::vector<double> vars;
 
@@ -196,6 +205,18 @@ namespace internal
                     const double       time,
                     ArrayView<Number> &values) const;
 
+      /**
+       * Compute the values of a single component at all points in @p points.
+       * The byte code of muParser is run over blocks of points at once in
+       * its bulk mode, which avoids the overhead of setting up the
+       * evaluation and of accessing the thread-local data for each point.
+       */
+      void
+      do_value_list(const ArrayView<const Point<dim>> &points,
+                    const double                       time,
+                    const unsigned int                 component,
+                    const ArrayView<Number> &          values) const;
+
       /**
        * An array of function expressions (one per component), required to
        * initialize tfp in each thread.
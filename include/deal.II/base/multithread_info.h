@@ -64,6 +64,27 @@ public:
    */
   MultithreadInfo() = delete;
 
+  /**
+   * An enum describing the libraries that can be used to run the tasks
+   * spawned by the parallel functions in the namespace parallel, by the
+   * vector operations, and by WorkStream.
+   */
+  enum class TaskBackend
+  {
+    /**
+     * Run all operations sequentially on the calling thread.
+     */
+    sequential,
+    /**
+     * Use the scheduler of the Threading Building Blocks.
+     */
+    tbb,
+    /**
+     * Use the shared taskflow executor returned by get_taskflow_executor().
+     */
+    taskflow
+  };
+
   /**
    * The number of CPUs in the system.
    *
@@ -116,6 +137,84 @@ public:
   static bool
   is_running_single_threaded();
 
+  /**
+   * Select the library that runs the tasks of the parallel functions in the
+   * namespace parallel, of the vector operations, and of WorkStream. This
+   * allows, for example, to avoid running the TBB thread pool next to the
+   * OpenMP runtime of an external library by choosing the taskflow executor
+   * or a sequential execution.
+   *
+   * The default is TaskBackend::tbb if deal.II is configured with TBB,
+   * TaskBackend::taskflow if it is configured with taskflow only, and
+   * TaskBackend::sequential otherwise. The default can be overridden by the
+   * environment variable DEAL_II_TASK_BACKEND, which may be set to
+   * `sequential`, `tbb`, or `taskflow`.
+   *
+   * An exception is thrown if deal.II is not configured with the requested
+   * library. This function must not be called while parallel operations are
+   * running.
+   */
+  static void
+  set_task_backend(const TaskBackend backend);
+
+  /**
+   * Return the library selected by set_task_backend().
+   */
+  static TaskBackend
+  get_task_backend();
+
+  /**
+   * Return whether deal.II is configured with the library required by
+   * @p backend.
+   */
+  static bool
+  is_task_backend_available(const TaskBackend backend);
+
+  /**
+   * Select whether parallel loops over index ranges, i.e.,
+   * parallel::apply_to_subranges(), parallel::ParallelForInteger (used by
+   * AlignedVector to initialize its memory), and the operations of Vector and
+   * LinearAlgebra::distributed::Vector, split the range into one contiguous
+   * block per thread in a deterministic way. With the TBB backend, the
+   * blocks are assigned to the threads by a tbb::static_partitioner, which
+   * gives the same thread the same part of an array in every loop. Since
+   * the memory pages of an array are placed on the NUMA domain of the
+   * thread that touches them first, this avoids accesses to remote memory on
+   * machines with several sockets, in particular in combination with
+   * set_thread_pinning().
+   *
+   * The default is `false`, i.e., the ranges are split dynamically to
+   * balance the load. The environment variable DEAL_II_PIN_THREADS set to
+   * `1` enables both static partitioning and thread pinning.
+   */
+  static void
+  set_static_partitioning(const bool use_static_partitioning);
+
+  /**
+   * Return whether static partitioning has been selected by
+   * set_static_partitioning().
+   */
+  static bool
+  use_static_partitioning();
+
+  /**
+   * Select whether the worker threads of TBB and of the taskflow executor
+   * get bound to a fixed core when they start working, which prevents the
+   * operating system from moving them to another socket away from the memory
+   * they have touched first. The threads are bound to the cores in the order
+   * in which they join, modulo n_cores(). Threads that have already been
+   * bound stay bound when pinning is switched off again. On systems other
+   * than Linux, this function has no effect.
+   */
+  static void
+  set_thread_pinning(const bool pin_threads);
+
+  /**
+   * Return whether thread pinning has been selected by set_thread_pinning().
+   */
+  static bool
+  use_thread_pinning();
+
   /**
    * Make sure the multithreading API is initialized. This normally does not
    * need to be called in usercode.
@@ -142,6 +241,21 @@ private:
    */
   static unsigned int n_max_threads;
 
+  /**
+   * The library selected to run tasks.
+   */
+  static TaskBackend task_backend;
+
+  /**
+   * Whether parallel loops use a static partitioning.
+   */
+  static bool static_partitioning;
+
+  /**
+   * Whether worker threads are bound to cores.
+   */
+  static bool thread_pinning;
+
 #  ifdef DEAL_II_WITH_TASKFLOW
   /**
    * Store a taskflow Executor that is constructed with N workers (from
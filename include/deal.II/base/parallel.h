@@ -20,14 +20,17 @@
 #include <deal.II/base/config.h>
 
 #include <deal.II/base/exceptions.h>
+#include <deal.II/base/multithread_info.h>
 #include <deal.II/base/mutex.h>
 #include <deal.II/base/synchronous_iterator.h>
 #include <deal.II/base/template_constraints.h>
 
+#include <algorithm>
 #include <cstddef>
 #include <functional>
 #include <memory>
 #include <tuple>
+#include <vector>
 
 #ifdef DEAL_II_WITH_TBB
 DEAL_II_DISABLE_EXTRA_DIAGNOSTICS
@@ -38,6 +41,12 @@ DEAL_II_DISABLE_EXTRA_DIAGNOSTICS
 DEAL_II_ENABLE_EXTRA_DIAGNOSTICS
 #endif
 
+#ifdef DEAL_II_WITH_TASKFLOW
+DEAL_II_DISABLE_EXTRA_DIAGNOSTICS
+#  include <taskflow/taskflow.hpp>
+DEAL_II_ENABLE_EXTRA_DIAGNOSTICS
+#endif
+
 
 // TODO[WB]: allow calling functions to pass along a tbb::affinity_partitioner
 // object to ensure that subsequent calls use the same cache lines
@@ -105,6 +114,162 @@ namespace parallel
                         *partitioner);
     }
 #endif
+
+#ifdef DEAL_II_WITH_TASKFLOW
+    /**
+     * Split the range <code>[begin,end)</code> into at most
+     * 4*MultithreadInfo::n_threads() subranges (or
+     * MultithreadInfo::n_threads() subranges with static partitioning) of at
+     * least @p grainsize elements and return the offsets of the subranges
+     * relative to @p begin. The subranges only depend on the length of the
+     * range and the number of threads, which makes the results of reductions
+     * reproducible.
+     */
+    inline std::vector<std::size_t>
+    split_range(const std::size_t n_elements, const unsigned int grainsize)
+    {
+      // with static partitioning, create one block per thread
+      const unsigned int n_blocks_per_thread =
+        MultithreadInfo::use_static_partitioning() ? 1 : 4;
+      const std::size_t n_chunks = std::max<std::size_t>(
+        1,
+        std::min<std::size_t>(n_blocks_per_thread *
+                                MultithreadInfo::n_threads(),
+                              n_elements / std::max(grainsize, 1U)));
+      std::vector<std::size_t> offsets(n_chunks + 1);
+      for (std::size_t c = 0; c <= n_chunks; ++c)
+        offsets[c] = c * n_elements / n_chunks;
+      return offsets;
+    }
+#endif
+
+
+
+    /**
+     * Call @p f on disjoint subranges <code>[b,e)</code> that collectively
+     * cover <code>[begin,end)</code>, using the task backend selected by
+     * MultithreadInfo::set_task_backend(). If the sequential backend is
+     * selected, if only one thread is allowed, or if the range has fewer
+     * than @p grainsize elements, <code>f(begin,end)</code> is called on the
+     * calling thread.
+     */
+    template <typename RangeType, typename Function>
+    void
+    parallel_for_subranges(const RangeType &  begin,
+                           const RangeType &  end,
+                           const Function &   f,
+                           const unsigned int grainsize)
+    {
+      const std::size_t n_elements = end - begin;
+      if (MultithreadInfo::n_threads() > 1 && n_elements > grainsize)
+        switch (MultithreadInfo::get_task_backend())
+          {
+#ifdef DEAL_II_WITH_TBB
+            case MultithreadInfo::TaskBackend::tbb:
+              if (MultithreadInfo::use_static_partitioning())
+                tbb::parallel_for(
+                  tbb::blocked_range<RangeType>(begin, end, grainsize),
+                  [&f](const tbb::blocked_range<RangeType> &range) {
+                    f(range.begin(), range.end());
+                  },
+                  tbb::static_partitioner());
+              else
+                parallel_for(
+                  begin,
+                  end,
+                  [&f](const tbb::blocked_range<RangeType> &range) {
+                    f(range.begin(), range.end());
+                  },
+                  grainsize);
+              return;
+#endif
+#ifdef DEAL_II_WITH_TASKFLOW
+            case MultithreadInfo::TaskBackend::taskflow:
+              {
+                tf::Executor &executor =
+                  MultithreadInfo::get_taskflow_executor();
+                // do not block a worker of the executor by waiting for
+                // nested tasks, but run them on the calling worker instead
+                if (executor.this_worker_id() >= 0)
+                  break;
+                const std::vector<std::size_t> offsets =
+                  split_range(n_elements, grainsize);
+                tf::Taskflow taskflow;
+                for (std::size_t c = 0; c + 1 < offsets.size(); ++c)
+                  taskflow.emplace([&f, &begin, &offsets, c]() {
+                    f(begin + offsets[c], begin + offsets[c + 1]);
+                  });
+                executor.run(taskflow).wait();
+                return;
+              }
+#endif
+            default:
+              break;
+          }
+
+      f(begin, end);
+    }
+
+
+
+    /**
+     * Like parallel_for_subranges(), but accumulate the results of the
+     * calls to @p f, which must return objects of type @p ResultType.
+     */
+    template <typename ResultType, typename RangeType, typename Function>
+    ResultType
+    accumulate_subranges(const RangeType &  begin,
+                         const RangeType &  end,
+                         const Function &   f,
+                         const unsigned int grainsize)
+    {
+      const std::size_t n_elements = end - begin;
+      if (MultithreadInfo::n_threads() > 1 && n_elements > grainsize)
+        switch (MultithreadInfo::get_task_backend())
+          {
+#ifdef DEAL_II_WITH_TBB
+            case MultithreadInfo::TaskBackend::tbb:
+              return tbb::parallel_reduce(
+                tbb::blocked_range<RangeType>(begin, end, grainsize),
+                ResultType(0),
+                [f](const auto &range, const ResultType &starting_value) {
+                  ResultType value = starting_value;
+                  value += f(range.begin(), range.end());
+                  return value;
+                },
+                std::plus<ResultType>(),
+                tbb::auto_partitioner());
+#endif
+#ifdef DEAL_II_WITH_TASKFLOW
+            case MultithreadInfo::TaskBackend::taskflow:
+              {
+                tf::Executor &executor =
+                  MultithreadInfo::get_taskflow_executor();
+                if (executor.this_worker_id() >= 0)
+                  break;
+                const std::vector<std::size_t> offsets =
+                  split_range(n_elements, grainsize);
+                std::vector<ResultType> results(offsets.size() - 1);
+                tf::Taskflow            taskflow;
+                for (std::size_t c = 0; c + 1 < offsets.size(); ++c)
+                  taskflow.emplace([&f, &begin, &offsets, &results, c]() {
+                    results[c] = f(begin + offsets[c], begin + offsets[c + 1]);
+                  });
+                executor.run(taskflow).wait();
+
+                // sum up in a fixed order
+                ResultType result = ResultType(0);
+                for (const ResultType &value : results)
+                  result += value;
+                return result;
+              }
+#endif
+            default:
+              break;
+          }
+
+      return f(begin, end);
+    }
   } // namespace internal
 
   /**
@@ -117,13 +282,13 @@ namespace parallel
    * use multiple threads.
    *
    * If running in parallel, the iterator range is split into several chunks
-   * that are each packaged up as a task and given to the Threading Building
-   * Blocks scheduler to work on as compute resources are available. The
-   * function returns once all chunks have been worked on. The last argument
-   * denotes the minimum number of elements of the iterator range per task;
-   * the number must be large enough to amortize the startup cost of new
-   * tasks, and small enough to ensure that tasks can be reasonably load
-   * balanced.
+   * that are each packaged up as a task and given to the scheduler selected
+   * by MultithreadInfo::set_task_backend() to work on as compute resources
+   * are available. The function returns once all chunks have been worked
+   * on. The last argument denotes the minimum number of elements of the
+   * iterator range per task; the number must be large enough to amortize the
+   * startup cost of new tasks, and small enough to ensure that tasks can be
+   * reasonably load balanced.
    *
    * For a discussion of the kind of problems to which this function is
    * applicable, see the
@@ -138,27 +303,18 @@ namespace parallel
             const Predicate &    predicate,
             const unsigned int   grainsize)
   {
-#ifndef DEAL_II_WITH_TBB
-    // make sure we don't get compiler
-    // warnings about unused arguments
-    (void)grainsize;
-
-    for (OutputIterator in = begin_in; in != end_in;)
-      *out++ = predicate(*in++);
-#else
     using Iterators     = std::tuple<InputIterator, OutputIterator>;
     using SyncIterators = SynchronousIterators<Iterators>;
     Iterators x_begin(begin_in, out);
     Iterators x_end(end_in, OutputIterator());
-    internal::parallel_for(
+    internal::parallel_for_subranges(
       SyncIterators(x_begin),
       SyncIterators(x_end),
-      [predicate](const auto &range) {
-        for (const auto &p : range)
-          *std::get<1>(p) = predicate(*std::get<0>(p));
+      [predicate](const SyncIterators &begin, const SyncIterators &end) {
+        for (SyncIterators p = begin; p != end; ++p)
+          *std::get<1>(*p) = predicate(*std::get<0>(*p));
       },
       grainsize);
-#endif
   }
 
 
@@ -173,13 +329,13 @@ namespace parallel
    * use multiple threads.
    *
    * If running in parallel, the iterator range is split into several chunks
-   * that are each packaged up as a task and given to the Threading Building
-   * Blocks scheduler to work on as compute resources are available. The
-   * function returns once all chunks have been worked on. The last argument
-   * denotes the minimum number of elements of the iterator range per task;
-   * the number must be large enough to amortize the startup cost of new
-   * tasks, and small enough to ensure that tasks can be reasonably load
-   * balanced.
+   * that are each packaged up as a task and given to the scheduler selected
+   * by MultithreadInfo::set_task_backend() to work on as compute resources
+   * are available. The function returns once all chunks have been worked
+   * on. The last argument denotes the minimum number of elements of the
+   * iterator range per task; the number must be large enough to amortize the
+   * startup cost of new tasks, and small enough to ensure that tasks can be
+   * reasonably load balanced.
    *
    * For a discussion of the kind of problems to which this function is
    * applicable, see the
@@ -198,28 +354,19 @@ namespace parallel
             const Predicate &     predicate,
             const unsigned int    grainsize)
   {
-#ifndef DEAL_II_WITH_TBB
-    // make sure we don't get compiler
-    // warnings about unused arguments
-    (void)grainsize;
-
-    for (OutputIterator in1 = begin_in1; in1 != end_in1;)
-      *out++ = predicate(*in1++, *in2++);
-#else
     using Iterators =
       std::tuple<InputIterator1, InputIterator2, OutputIterator>;
     using SyncIterators = SynchronousIterators<Iterators>;
     Iterators x_begin(begin_in1, in2, out);
     Iterators x_end(end_in1, InputIterator2(), OutputIterator());
-    internal::parallel_for(
+    internal::parallel_for_subranges(
       SyncIterators(x_begin),
       SyncIterators(x_end),
-      [predicate](const auto &range) {
-        for (const auto &p : range)
-          *std::get<2>(p) = predicate(*std::get<0>(p), *std::get<1>(p));
+      [predicate](const SyncIterators &begin, const SyncIterators &end) {
+        for (SyncIterators p = begin; p != end; ++p)
+          *std::get<2>(*p) = predicate(*std::get<0>(*p), *std::get<1>(*p));
       },
       grainsize);
-#endif
   }
 
 
@@ -234,13 +381,13 @@ namespace parallel
    * use multiple threads.
    *
    * If running in parallel, the iterator range is split into several chunks
-   * that are each packaged up as a task and given to the Threading Building
-   * Blocks scheduler to work on as compute resources are available. The
-   * function returns once all chunks have been worked on. The last argument
-   * denotes the minimum number of elements of the iterator range per task;
-   * the number must be large enough to amortize the startup cost of new
-   * tasks, and small enough to ensure that tasks can be reasonably load
-   * balanced.
+   * that are each packaged up as a task and given to the scheduler selected
+   * by MultithreadInfo::set_task_backend() to work on as compute resources
+   * are available. The function returns once all chunks have been worked
+   * on. The last argument denotes the minimum number of elements of the
+   * iterator range per task; the number must be large enough to amortize the
+   * startup cost of new tasks, and small enough to ensure that tasks can be
+   * reasonably load balanced.
    *
    * For a discussion of the kind of problems to which this function is
    * applicable, see the
@@ -261,14 +408,6 @@ namespace parallel
             const Predicate &     predicate,
             const unsigned int    grainsize)
   {
-#ifndef DEAL_II_WITH_TBB
-    // make sure we don't get compiler
-    // warnings about unused arguments
-    (void)grainsize;
-
-    for (OutputIterator in1 = begin_in1; in1 != end_in1;)
-      *out++ = predicate(*in1++, *in2++, *in3++);
-#else
     using Iterators = std::
       tuple<InputIterator1, InputIterator2, InputIterator3, OutputIterator>;
     using SyncIterators = SynchronousIterators<Iterators>;
@@ -277,36 +416,18 @@ namespace parallel
                     InputIterator2(),
                     InputIterator3(),
                     OutputIterator());
-    internal::parallel_for(
+    internal::parallel_for_subranges(
       SyncIterators(x_begin),
       SyncIterators(x_end),
-      [predicate](const auto &range) {
-        for (const auto &p : range)
-          *std::get<3>(p) =
-            predicate(*std::get<0>(p), *std::get<1>(p), *std::get<2>(p));
+      [predicate](const SyncIterators &begin, const SyncIterators &end) {
+        for (SyncIterators p = begin; p != end; ++p)
+          *std::get<3>(*p) =
+            predicate(*std::get<0>(*p), *std::get<1>(*p), *std::get<2>(*p));
       },
       grainsize);
-#endif
   }
 
 
-  namespace internal
-  {
-#ifdef DEAL_II_WITH_TBB
-    /**
-     * Take a range argument and call the given function with its begin and
-     * end.
-     */
-    template <typename RangeType, typename Function>
-    void
-    apply_to_subranges(const tbb::blocked_range<RangeType> &range,
-                       const Function &                     f)
-    {
-      f(range.begin(), range.end());
-    }
-#endif
-  } // namespace internal
-
 
   /**
    * This function applies the given function argument @p f to all elements in
@@ -384,21 +505,7 @@ namespace parallel
                      const Function &                          f,
                      const unsigned int                        grainsize)
   {
-#ifndef DEAL_II_WITH_TBB
-    // make sure we don't get compiler
-    // warnings about unused arguments
-    (void)grainsize;
-
-    f(begin, end);
-#else
-    internal::parallel_for(
-      begin,
-      end,
-      [&f](const tbb::blocked_range<RangeType> &range) {
-        internal::apply_to_subranges<RangeType, Function>(range, f);
-      },
-      grainsize);
-#endif
+    internal::parallel_for_subranges<RangeType>(begin, end, f, grainsize);
   }
 
 
@@ -530,24 +637,10 @@ namespace parallel
                             const typename identity<RangeType>::type &end,
                             const unsigned int                        grainsize)
   {
-#ifndef DEAL_II_WITH_TBB
-    // make sure we don't get compiler
-    // warnings about unused arguments
-    (void)grainsize;
-
-    return f(begin, end);
-#else
-    return tbb::parallel_reduce(
-      tbb::blocked_range<RangeType>(begin, end, grainsize),
-      ResultType(0),
-      [f](const auto &range, const ResultType &starting_value) {
-        ResultType value = starting_value;
-        value += f(range.begin(), range.end());
-        return value;
-      },
-      std::plus<ResultType>(),
-      tbb::auto_partitioner());
-#endif
+    return internal::accumulate_subranges<ResultType, RangeType>(begin,
+                                                                 end,
+                                                                 f,
+                                                                 grainsize);
   }
 
 
@@ -664,21 +757,13 @@ namespace parallel
     const std::size_t end,
     const std::size_t minimum_parallel_grain_size) const
   {
-#ifndef DEAL_II_WITH_TBB
-    // make sure we don't get compiler
-    // warnings about unused arguments
-    (void)minimum_parallel_grain_size;
-
-    apply_to_subrange(begin, end);
-#else
-    internal::parallel_for(
+    internal::parallel_for_subranges(
       begin,
       end,
-      [this](const tbb::blocked_range<std::size_t> &range) {
-        apply_to_subrange(range.begin(), range.end());
+      [this](const std::size_t sub_begin, const std::size_t sub_end) {
+        apply_to_subrange(sub_begin, sub_end);
       },
       minimum_parallel_grain_size);
-#endif
   }
 
 } // end of namespace parallel
@@ -28,7 +28,10 @@
 #include <deal.II/lac/vector_operation.h>
 
 #include <limits>
+#include <list>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -36,6 +39,137 @@ namespace Utilities
 {
   namespace MPI
   {
+    namespace internal
+    {
+      /**
+       * Data that the Partitioner class keeps to reduce the cost of repeated
+       * ghost exchanges with persistent requests or neighborhood collectives,
+       * see Partitioner::CommunicationMode. Since persistent requests are
+       * bound to specific buffers, the data is stored per combination of
+       * buffers, direction, and communication channel, and reused whenever
+       * the same buffers are communicated again.
+       */
+      struct PartitionerCommunicationData
+      {
+        /**
+         * The setup for one combination of buffers.
+         */
+        struct Entry
+        {
+          /**
+           * Whether this entry refers to export_to_ghosted_array_start()
+           * (true) or import_from_ghosted_array_start() (false).
+           */
+          bool is_export;
+
+          /**
+           * The communication channel.
+           */
+          unsigned int channel;
+
+          /**
+           * The buffers and the size of the elements exchanged, identifying
+           * the entry.
+           */
+          const void *ghost_array;
+          std::size_t ghost_array_size;
+          const void *temporary_storage;
+          std::size_t number_size;
+
+          /**
+           * Whether the communication set up by this entry has been started
+           * but not yet finished. Entries in flight are never evicted.
+           */
+          bool in_flight;
+
+          /**
+           * The persistent requests, first those of the receive operations
+           * and then those of the send operations.
+           */
+          std::vector<MPI_Request> requests;
+
+          /**
+           * Counts and offsets in bytes for the neighborhood collectives.
+           * They need to remain valid until the non-blocking collective has
+           * finished.
+           */
+          std::vector<int> send_counts;
+          std::vector<int> send_offsets;
+          std::vector<int> receive_counts;
+          std::vector<int> receive_offsets;
+        };
+
+        /**
+         * Constructor.
+         */
+        PartitionerCommunicationData();
+
+        /**
+         * Destructor. Frees the persistent requests and the graph
+         * communicators.
+         */
+        ~PartitionerCommunicationData();
+
+        /**
+         * Return the entry for the given buffers, creating a new one if
+         * necessary. In the latter case, @p is_new is set to true. At most
+         * #max_entries entries are kept.
+         */
+        Entry &
+        get_entry(const bool         is_export,
+                  const unsigned int channel,
+                  const void *       ghost_array,
+                  const std::size_t  ghost_array_size,
+                  const void *       temporary_storage,
+                  const std::size_t  number_size,
+                  bool &             is_new);
+
+        /**
+         * Mark the entries associated with the given ghost array as
+         * finished.
+         */
+        void
+        finish_entries(const bool        is_export,
+                       const void *      ghost_array,
+                       const std::size_t ghost_array_size,
+                       const std::size_t number_size);
+
+        /**
+         * The maximal number of entries kept.
+         */
+        static constexpr unsigned int max_entries = 64;
+
+        /**
+         * A lock protecting the list of entries.
+         */
+        std::mutex mutex;
+
+        /**
+         * The list of entries. A list is used because references to the
+         * entries must remain valid while other entries are added or
+         * removed.
+         */
+        std::list<Entry> entries;
+
+        /**
+         * The distributed graph communicator for the direction of
+         * export_to_ghosted_array_start(), where the owners of the ghost
+         * indices are the sources and the import targets are the
+         * destinations, or MPI_COMM_NULL if neighborhood collectives are not
+         * used.
+         */
+        MPI_Comm export_graph;
+
+        /**
+         * The distributed graph communicator for the direction of
+         * import_from_ghosted_array_start().
+         */
+        MPI_Comm import_graph;
+      };
+    } // namespace internal
+
+
+
     /**
      * This class defines a model for the partitioning of a vector (or, in
      * fact, any linear data structure) among processors using MPI.
@@ -273,6 +407,53 @@ namespace Utilities
       set_ghost_indices(const IndexSet &ghost_indices,
                         const IndexSet &larger_ghost_index_set = IndexSet());
 
+      /**
+       * The ways to implement the data exchange in
+       * export_to_ghosted_array_start() and
+       * import_from_ghosted_array_start().
+       */
+      enum class CommunicationMode
+      {
+        /**
+         * Post new MPI_Irecv and MPI_Isend operations for every exchange.
+         */
+        point_to_point,
+        /**
+         * Set up persistent requests with MPI_Recv_init and MPI_Send_init
+         * the first time a pair of buffers is exchanged, and only call
+         * MPI_Start for subsequent exchanges of the same buffers. This saves
+         * the setup and matching of the requests in the MPI library, which
+         * becomes noticeable for small local problems on many processes.
+         */
+        persistent_requests,
+        /**
+         * Exchange the data with MPI_Ineighbor_alltoallv on distributed graph
+         * communicators that are created by set_ghost_indices() from the
+         * ghost and import targets. This lets the MPI library optimize the
+         * exchange as a whole. Since neighborhood collectives are collective
+         * operations, all processes must start the exchanges of different
+         * vectors in the same order when using this mode.
+         */
+        neighborhood_collectives
+      };
+
+      /**
+       * Select the way data is exchanged. The default is
+       * CommunicationMode::point_to_point, unless the environment variable
+       * <tt>DEAL_II_PARTITIONER_COMMUNICATION</tt> is set to
+       * <tt>persistent</tt> or <tt>neighborhood</tt> at the time the object
+       * is created. This function is collective over the communicator of the
+       * partitioner and must not be called while an exchange is in progress.
+       */
+      void
+      set_communication_mode(const CommunicationMode mode);
+
+      /**
+       * Return the way data is exchanged.
+       */
+      CommunicationMode
+      get_communication_mode() const;
+
       /**
        * Return the global size.
        */
@@ -722,16 +903,14 @@ namespace Utilities
       /**
        * The set of (local) indices that we are importing during compress(),
        * i.e., others' ghosts that belong to the local range. The data stored is
-       * the same than in import_indices_data but the data is expanded in plain
-       * arrays. This variable is only used when using CUDA-aware MPI.
+       * the same than in import_indices_data but the data is expanded in a
+       * plain array in device memory, ordered by the import targets. This
+       * variable is only used when using CUDA-aware MPI.
        */
       // The variable is mutable to enable lazy initialization in
       // export_to_ghosted_array_start(). This way partitioner does not have to
       // be templated on the MemorySpaceType.
-      mutable std::vector<
-        std::pair<std::unique_ptr<unsigned int[], void (*)(unsigned int *)>,
-                  unsigned int>>
-        import_indices_plain_dev;
+      mutable std::shared_ptr<unsigned int> import_indices_plain_dev;
 
       /**
        * A variable caching the number of ghost indices. It would be expensive
@@ -790,6 +969,49 @@ namespace Utilities
        * A variable storing whether the ghost indices have been explicitly set.
        */
       bool have_ghost_indices;
+
+      /**
+       * The way data is exchanged.
+       */
+      CommunicationMode communication_mode;
+
+      /**
+       * Persistent requests and graph communicators for the communication
+       * modes other than CommunicationMode::point_to_point. The object is
+       * created by set_ghost_indices() and set_communication_mode(), and
+       * shared between copies of this object since it only depends on the
+       * communication pattern.
+       */
+      std::shared_ptr<internal::PartitionerCommunicationData>
+        communication_data;
+
+      /**
+       * Create #communication_data for the current communication pattern and
+       * communication mode.
+       */
+      void
+      setup_communication_data();
+
+      /**
+       * Return the communication mode actually used for the next exchange,
+       * which falls back to CommunicationMode::point_to_point if the
+       * necessary data has not been set up.
+       */
+      CommunicationMode
+      active_communication_mode() const;
+
+      /**
+       * Fill a newly created entry of #communication_data for exchanging
+       * data between @p ghost_array and @p temporary_storage, i.e., create
+       * the persistent requests with tag @p mpi_tag or compute the counts
+       * and offsets of the neighborhood collectives.
+       */
+      void
+      setup_communication_entry(
+        internal::PartitionerCommunicationData::Entry &entry,
+        const unsigned int                             mpi_tag,
+        void *                                         ghost_array,
+        void *                                         temporary_storage) const;
     };
 
 
@@ -995,6 +1217,14 @@ namespace Utilities
       return have_ghost_indices;
     }
 
+
+
+    inline Partitioner::CommunicationMode
+    Partitioner::get_communication_mode() const
+    {
+      return communication_mode;
+    }
+
 #endif // ifndef DOXYGEN
 
   } // end of namespace MPI
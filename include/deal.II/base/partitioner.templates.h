@@ -21,6 +21,7 @@
 #include <deal.II/base/cuda_size.h>
 #include <deal.II/base/mpi_tags.h>
 #include <deal.II/base/partitioner.h>
+#include <deal.II/base/tracing.h>
 
 #include <deal.II/lac/cuda_kernels.templates.h>
 #include <deal.II/lac/la_parallel_vector.h>
@@ -48,6 +49,8 @@ namespace Utilities
       const ArrayView<Number, MemorySpaceType> &      ghost_array,
       std::vector<MPI_Request> &                      requests) const
     {
+      DEAL_II_TRACE_SCOPE("Partitioner::export_to_ghosted_array_start", "mpi");
+
       AssertDimension(temporary_storage.size(), n_import_indices());
       AssertIndexRange(communication_channel, 200);
       Assert(ghost_array.size() == n_ghost_indices() ||
@@ -72,10 +75,38 @@ namespace Utilities
       Assert(mpi_tag <= Utilities::MPI::internal::Tags::partitioner_export_end,
              ExcInternalError());
 
+      // set up or look up the persistent requests or the neighborhood
+      // collective counts for the given buffers
+      const CommunicationMode mode = active_communication_mode();
+      internal::PartitionerCommunicationData::Entry *entry = nullptr;
+      if (mode != CommunicationMode::point_to_point)
+        {
+          bool new_entry = false;
+          entry          = &communication_data->get_entry(true,
+                                                 communication_channel,
+                                                 ghost_array.data(),
+                                                 ghost_array.size(),
+                                                 temporary_storage.data(),
+                                                 sizeof(Number),
+                                                 new_entry);
+          if (new_entry)
+            setup_communication_entry(*entry,
+                                      mpi_tag,
+                                      ghost_array.data(),
+                                      temporary_storage.data());
+        }
+
       // Need to send and receive the data. Use non-blocking communication,
       // where it is usually less overhead to first initiate the receive and
-      // then actually send the data
-      requests.resize(n_import_targets + n_ghost_targets);
+      // then actually send the data. With neighborhood collectives, a single
+      // request covers all messages.
+      requests.resize(mode == CommunicationMode::neighborhood_collectives ?
+                        1 :
+                        n_import_targets + n_ghost_targets);
+      if (mode == CommunicationMode::persistent_requests)
+        std::copy(entry->requests.begin(),
+                  entry->requests.end(),
+                  requests.begin());
 
       // as a ghost array pointer, put the data at the end of the given ghost
       // array in case we want to fill only a subset of the ghosts so that we
@@ -85,59 +116,72 @@ namespace Utilities
       const bool use_larger_set =
         (n_ghost_indices_in_larger_set > n_ghost_indices() &&
          ghost_array.size() == n_ghost_indices_in_larger_set);
-      Number *ghost_array_ptr =
+      Number *const ghost_array_start =
         use_larger_set ? ghost_array.data() + n_ghost_indices_in_larger_set -
                            n_ghost_indices() :
                          ghost_array.data();
-
-      for (unsigned int i = 0; i < n_ghost_targets; ++i)
+      Number *ghost_array_ptr = ghost_array_start;
+
+      if (mode == CommunicationMode::point_to_point)
+        for (unsigned int i = 0; i < n_ghost_targets; ++i)
+          {
+            // allow writing into ghost indices even though we are in a
+            // const function
+            const int ierr =
+              MPI_Irecv(ghost_array_ptr,
+                        ghost_targets_data[i].second * sizeof(Number),
+                        MPI_BYTE,
+                        ghost_targets_data[i].first,
+                        mpi_tag,
+                        communicator,
+                        &requests[i]);
+            AssertThrowMPI(ierr);
+            ghost_array_ptr += ghost_targets_data[i].second;
+          }
+      else if (mode == CommunicationMode::persistent_requests &&
+               n_ghost_targets > 0)
         {
-          // allow writing into ghost indices even though we are in a
-          // const function
-          const int ierr =
-            MPI_Irecv(ghost_array_ptr,
-                      ghost_targets_data[i].second * sizeof(Number),
-                      MPI_BYTE,
-                      ghost_targets_data[i].first,
-                      mpi_tag,
-                      communicator,
-                      &requests[i]);
+          const int ierr = MPI_Startall(n_ghost_targets, requests.data());
           AssertThrowMPI(ierr);
-          ghost_array_ptr += ghost_targets_data[i].second;
         }
 
       Number *temp_array_ptr = temporary_storage.data();
 #    if defined(DEAL_II_COMPILER_CUDA_AWARE) && \
       defined(DEAL_II_MPI_WITH_CUDA_SUPPORT)
       // When using CUDAs-aware MPI, the set of local indices that are ghosts
-      // indices on other processors is expanded in arrays. This is for
-      // performance reasons as this can significantly decrease the number of
-      // kernel launched. The indices are expanded the first time the function
-      // is called.
-      if ((std::is_same<MemorySpaceType, MemorySpace::CUDA>::value) &&
-          (import_indices_plain_dev.size() == 0))
-        initialize_import_indices_plain_dev();
-#    endif
-
-      for (unsigned int i = 0; i < n_import_targets; ++i)
+      // indices on other processors is expanded in a plain array. This is
+      // for performance reasons as this allows us to pack the data for all
+      // import targets with a single kernel launch and a single
+      // synchronization before the send operations start, rather than one
+      // of each per target. The indices are expanded the first time the
+      // function is called.
+      if (std::is_same<MemorySpaceType, MemorySpace::CUDA>::value)
         {
-#    if defined(DEAL_II_COMPILER_CUDA_AWARE) && \
-      defined(DEAL_II_MPI_WITH_CUDA_SUPPORT)
-          if (std::is_same<MemorySpaceType, MemorySpace::CUDA>::value)
+          if (import_indices_plain_dev == nullptr)
+            initialize_import_indices_plain_dev();
+
+          if (n_import_indices() > 0)
             {
-              const auto chunk_size = import_indices_plain_dev[i].second;
-              const int  n_blocks =
-                1 + chunk_size / (::dealii::CUDAWrappers::chunk_size *
-                                  ::dealii::CUDAWrappers::block_size);
+              const int n_blocks =
+                1 + n_import_indices() / (::dealii::CUDAWrappers::chunk_size *
+                                          ::dealii::CUDAWrappers::block_size);
               ::dealii::LinearAlgebra::CUDAWrappers::kernel::
                 gather<<<n_blocks, ::dealii::CUDAWrappers::block_size>>>(
-                  temp_array_ptr,
-                  import_indices_plain_dev[i].first.get(),
+                  temporary_storage.data(),
+                  import_indices_plain_dev.get(),
                   locally_owned_array.data(),
-                  chunk_size);
+                  n_import_indices());
+              AssertCudaKernel();
               cudaDeviceSynchronize();
             }
-          else
+        }
+#    endif
+
+      for (unsigned int i = 0; i < n_import_targets; ++i)
+        {
+#    if defined(DEAL_II_COMPILER_CUDA_AWARE) && \
+      defined(DEAL_II_MPI_WITH_CUDA_SUPPORT)
+          if (!std::is_same<MemorySpaceType, MemorySpace::CUDA>::value)
 #    endif
             {
               // copy the data to be sent to the import_data field
@@ -163,16 +207,40 @@ namespace Utilities
             }
 
           // start the send operations
+          if (mode == CommunicationMode::point_to_point)
+            {
+              const int ierr =
+                MPI_Isend(temp_array_ptr,
+                          import_targets_data[i].second * sizeof(Number),
+                          MPI_BYTE,
+                          import_targets_data[i].first,
+                          mpi_tag,
+                          communicator,
+                          &requests[n_ghost_targets + i]);
+              AssertThrowMPI(ierr);
+            }
+          else if (mode == CommunicationMode::persistent_requests)
+            {
+              const int ierr = MPI_Start(&requests[n_ghost_targets + i]);
+              AssertThrowMPI(ierr);
+            }
+          temp_array_ptr += import_targets_data[i].second;
+        }
+
+      if (mode == CommunicationMode::neighborhood_collectives)
+        {
           const int ierr =
-            MPI_Isend(temp_array_ptr,
-                      import_targets_data[i].second * sizeof(Number),
-                      MPI_BYTE,
-                      import_targets_data[i].first,
-                      mpi_tag,
-                      communicator,
-                      &requests[n_ghost_targets + i]);
+            MPI_Ineighbor_alltoallv(temporary_storage.data(),
+                                    entry->send_counts.data(),
+                                    entry->send_offsets.data(),
+                                    MPI_BYTE,
+                                    ghost_array_start,
+                                    entry->receive_counts.data(),
+                                    entry->receive_offsets.data(),
+                                    MPI_BYTE,
+                                    communication_data->export_graph,
+                                    &requests[0]);
           AssertThrowMPI(ierr);
-          temp_array_ptr += import_targets_data[i].second;
         }
     }
 
@@ -184,6 +252,8 @@ namespace Utilities
       const ArrayView<Number, MemorySpaceType> &ghost_array,
       std::vector<MPI_Request> &                requests) const
     {
+      DEAL_II_TRACE_SCOPE("Partitioner::export_to_ghosted_array_finish", "mpi");
+
       Assert(ghost_array.size() == n_ghost_indices() ||
                ghost_array.size() == n_ghost_indices_in_larger_set,
              ExcGhostIndexArrayHasWrongSize(ghost_array.size(),
@@ -192,7 +262,10 @@ namespace Utilities
 
       // wait for both sends and receives to complete, even though only
       // receives are really necessary. this gives (much) better performance
-      AssertDimension(ghost_targets().size() + import_targets().size(),
+      const CommunicationMode mode = active_communication_mode();
+      AssertDimension(mode == CommunicationMode::neighborhood_collectives ?
+                        1 :
+                        ghost_targets().size() + import_targets().size(),
                       requests.size());
       if (requests.size() > 0)
         {
@@ -201,6 +274,11 @@ namespace Utilities
           AssertThrowMPI(ierr);
         }
       requests.resize(0);
+      if (mode != CommunicationMode::point_to_point)
+        communication_data->finish_entries(true,
+                                           ghost_array.data(),
+                                           ghost_array.size(),
+                                           sizeof(Number));
 
       // in case we only sent a subset of indices, we now need to move the data
       // to the correct positions and delete the old content
@@ -272,6 +350,9 @@ namespace Utilities
       const ArrayView<Number, MemorySpaceType> &temporary_storage,
       std::vector<MPI_Request> &                requests) const
     {
+      DEAL_II_TRACE_SCOPE("Partitioner::import_from_ghosted_array_start",
+                          "mpi");
+
       AssertDimension(temporary_storage.size(), n_import_indices());
       AssertIndexRange(communication_channel, 200);
       Assert(ghost_array.size() == n_ghost_indices() ||
@@ -292,9 +373,11 @@ namespace Utilities
         return;
 #    endif
 
-      // nothing to do when we neither have import
-      // nor ghost indices.
-      if (n_ghost_indices() == 0 && n_import_indices() == 0)
+      // nothing to do when we neither have import nor ghost indices, except
+      // for neighborhood collectives in which all processes participate
+      const CommunicationMode mode = active_communication_mode();
+      if (n_ghost_indices() == 0 && n_import_indices() == 0 &&
+          mode != CommunicationMode::neighborhood_collectives)
         return;
 
       const unsigned int n_import_targets = import_targets_data.size();
@@ -313,7 +396,32 @@ namespace Utilities
         communication_channel;
       Assert(mpi_tag <= Utilities::MPI::internal::Tags::partitioner_import_end,
              ExcInternalError());
-      requests.resize(n_import_targets + n_ghost_targets);
+
+      internal::PartitionerCommunicationData::Entry *entry = nullptr;
+      if (mode != CommunicationMode::point_to_point)
+        {
+          bool new_entry = false;
+          entry          = &communication_data->get_entry(false,
+                                                 communication_channel,
+                                                 ghost_array.data(),
+                                                 ghost_array.size(),
+                                                 temporary_storage.data(),
+                                                 sizeof(Number),
+                                                 new_entry);
+          if (new_entry)
+            setup_communication_entry(*entry,
+                                      mpi_tag,
+                                      ghost_array.data(),
+                                      temporary_storage.data());
+        }
+
+      requests.resize(mode == CommunicationMode::neighborhood_collectives ?
+                        1 :
+                        n_import_targets + n_ghost_targets);
+      if (mode == CommunicationMode::persistent_requests)
+        std::copy(entry->requests.begin(),
+                  entry->requests.end(),
+                  requests.begin());
 
       // initiate the receive operations
       Number *temp_array_ptr = temporary_storage.data();
@@ -326,17 +434,26 @@ namespace Utilities
             ExcMessage("Index overflow: Maximum message size in MPI is 2GB. "
                        "The number of ghost entries times the size of 'Number' "
                        "exceeds this value. This is not supported."));
-          const int ierr =
-            MPI_Irecv(temp_array_ptr,
-                      import_targets_data[i].second * sizeof(Number),
-                      MPI_BYTE,
-                      import_targets_data[i].first,
-                      mpi_tag,
-                      communicator,
-                      &requests[i]);
-          AssertThrowMPI(ierr);
+          if (mode == CommunicationMode::point_to_point)
+            {
+              const int ierr =
+                MPI_Irecv(temp_array_ptr,
+                          import_targets_data[i].second * sizeof(Number),
+                          MPI_BYTE,
+                          import_targets_data[i].first,
+                          mpi_tag,
+                          communicator,
+                          &requests[i]);
+              AssertThrowMPI(ierr);
+            }
           temp_array_ptr += import_targets_data[i].second;
         }
+      if (mode == CommunicationMode::persistent_requests &&
+          n_import_targets > 0)
+        {
+          const int ierr = MPI_Startall(n_import_targets, requests.data());
+          AssertThrowMPI(ierr);
+        }
 
       // initiate the send operations
 
@@ -419,18 +536,42 @@ namespace Utilities
           if (std::is_same<MemorySpaceType, MemorySpace::CUDA>::value)
             cudaDeviceSynchronize();
 #    endif
-          const int ierr =
-            MPI_Isend(ghost_array_ptr,
-                      ghost_targets_data[i].second * sizeof(Number),
-                      MPI_BYTE,
-                      ghost_targets_data[i].first,
-                      mpi_tag,
-                      communicator,
-                      &requests[n_import_targets + i]);
-          AssertThrowMPI(ierr);
+          if (mode == CommunicationMode::point_to_point)
+            {
+              const int ierr =
+                MPI_Isend(ghost_array_ptr,
+                          ghost_targets_data[i].second * sizeof(Number),
+                          MPI_BYTE,
+                          ghost_targets_data[i].first,
+                          mpi_tag,
+                          communicator,
+                          &requests[n_import_targets + i]);
+              AssertThrowMPI(ierr);
+            }
+          else if (mode == CommunicationMode::persistent_requests)
+            {
+              const int ierr = MPI_Start(&requests[n_import_targets + i]);
+              AssertThrowMPI(ierr);
+            }
 
           ghost_array_ptr += ghost_targets_data[i].second;
         }
+
+      if (mode == CommunicationMode::neighborhood_collectives)
+        {
+          const int ierr =
+            MPI_Ineighbor_alltoallv(ghost_array.data(),
+                                    entry->send_counts.data(),
+                                    entry->send_offsets.data(),
+                                    MPI_BYTE,
+                                    temporary_storage.data(),
+                                    entry->receive_counts.data(),
+                                    entry->receive_offsets.data(),
+                                    MPI_BYTE,
+                                    communication_data->import_graph,
+                                    &requests[0]);
+          AssertThrowMPI(ierr);
+        }
     }
 
 
@@ -506,6 +647,9 @@ namespace Utilities
       const ArrayView<Number, MemorySpaceType> &      ghost_array,
       std::vector<MPI_Request> &                      requests) const
     {
+      DEAL_II_TRACE_SCOPE("Partitioner::import_from_ghosted_array_finish",
+                          "mpi");
+
       AssertDimension(temporary_storage.size(), n_import_indices());
       Assert(ghost_array.size() == n_ghost_indices() ||
                ghost_array.size() == n_ghost_indices_in_larger_set,
@@ -563,24 +707,43 @@ namespace Utilities
 #    if (defined(DEAL_II_COMPILER_CUDA_AWARE) && \
          defined(DEAL_II_MPI_WITH_CUDA_SUPPORT))
       // When using CUDAs-aware MPI, the set of local indices that are ghosts
-      // indices on other processors is expanded in arrays. This is for
-      // performance reasons as this can significantly decrease the number of
-      // kernel launched. The indices are expanded the first time the function
-      // is called.
+      // indices on other processors is expanded in a plain array. This is
+      // for performance reasons as this can significantly decrease the
+      // number of kernel launched. The indices are expanded the first time
+      // the function is called.
       if ((std::is_same<MemorySpaceType, MemorySpace::CUDA>::value) &&
-          (import_indices_plain_dev.size() == 0))
+          (import_indices_plain_dev == nullptr))
         initialize_import_indices_plain_dev();
 #    endif
 
+      const CommunicationMode mode = active_communication_mode();
       if (vector_operation != dealii::VectorOperation::insert)
-        AssertDimension(n_ghost_targets + n_import_targets, requests.size());
+        AssertDimension(mode == CommunicationMode::neighborhood_collectives ?
+                          1 :
+                          n_ghost_targets + n_import_targets,
+                        requests.size());
+
+      // with neighborhood collectives, a single request covers both the
+      // receive and the send operations
+      if (mode == CommunicationMode::neighborhood_collectives &&
+          requests.size() > 0)
+        {
+          const int ierr =
+            MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+          AssertThrowMPI(ierr);
+        }
+
       // first wait for the receive to complete
       if (requests.size() > 0 && n_import_targets > 0)
         {
           AssertDimension(locally_owned_array.size(), locally_owned_size());
-          const int ierr =
-            MPI_Waitall(n_import_targets, requests.data(), MPI_STATUSES_IGNORE);
-          AssertThrowMPI(ierr);
+          if (mode != CommunicationMode::neighborhood_collectives)
+            {
+              const int ierr = MPI_Waitall(n_import_targets,
+                                           requests.data(),
+                                           MPI_STATUSES_IGNORE);
+              AssertThrowMPI(ierr);
+            }
 
           const Number *read_position = temporary_storage.data();
 #    if !(defined(DEAL_II_COMPILER_CUDA_AWARE) && \
@@ -638,11 +801,17 @@ namespace Utilities
                                                          locally_owned_array[j],
                                                          my_pid));
 #    else
+          // As opposed to the packing in export_to_ghosted_array_start(), the
+          // kernels are launched separately for each import target: The same
+          // index might be imported from several processes, which would lead
+          // to a race condition within a single kernel.
           if (vector_operation == dealii::VectorOperation::add)
             {
-              for (auto const &import_indices_plain : import_indices_plain_dev)
+              const unsigned int *import_indices_plain =
+                import_indices_plain_dev.get();
+              for (const auto &import_target : import_targets_data)
                 {
-                  const auto chunk_size = import_indices_plain.second;
+                  const auto chunk_size = import_target.second;
                   const int n_blocks =
                     1 + chunk_size / (::dealii::CUDAWrappers::chunk_size *
                                       ::dealii::CUDAWrappers::block_size);
@@ -651,18 +820,21 @@ namespace Utilities
                                          dealii::LinearAlgebra::CUDAWrappers::
                                            kernel::Binop_Addition>
                     <<<n_blocks, dealii::CUDAWrappers::block_size>>>(
-                      import_indices_plain.first.get(),
+                      import_indices_plain,
                       locally_owned_array.data(),
                       read_position,
                       chunk_size);
+                  import_indices_plain += chunk_size;
                   read_position += chunk_size;
                 }
             }
           else if (vector_operation == dealii::VectorOperation::min)
             {
-              for (auto const &import_indices_plain : import_indices_plain_dev)
+              const unsigned int *import_indices_plain =
+                import_indices_plain_dev.get();
+              for (const auto &import_target : import_targets_data)
                 {
-                  const auto chunk_size = import_indices_plain.second;
+                  const auto chunk_size = import_target.second;
                   const int n_blocks =
                     1 + chunk_size / (::dealii::CUDAWrappers::chunk_size *
                                       ::dealii::CUDAWrappers::block_size);
@@ -671,18 +843,21 @@ namespace Utilities
                       Number,
                       dealii::LinearAlgebra::CUDAWrappers::kernel::Binop_Min>
                     <<<n_blocks, dealii::CUDAWrappers::block_size>>>(
-                      import_indices_plain.first.get(),
+                      import_indices_plain,
                       locally_owned_array.data(),
                       read_position,
                       chunk_size);
+                  import_indices_plain += chunk_size;
                   read_position += chunk_size;
                 }
             }
           else if (vector_operation == dealii::VectorOperation::max)
             {
-              for (auto const &import_indices_plain : import_indices_plain_dev)
+              const unsigned int *import_indices_plain =
+                import_indices_plain_dev.get();
+              for (const auto &import_target : import_targets_data)
                 {
-                  const auto chunk_size = import_indices_plain.second;
+                  const auto chunk_size = import_target.second;
                   const int n_blocks =
                     1 + chunk_size / (::dealii::CUDAWrappers::chunk_size *
                                       ::dealii::CUDAWrappers::block_size);
@@ -691,22 +866,19 @@ namespace Utilities
                       Number,
                       dealii::LinearAlgebra::CUDAWrappers::kernel::Binop_Max>
                     <<<n_blocks, dealii::CUDAWrappers::block_size>>>(
-                      import_indices_plain.first.get(),
+                      import_indices_plain,
                       locally_owned_array.data(),
                       read_position,
                       chunk_size);
+                  import_indices_plain += chunk_size;
                   read_position += chunk_size;
                 }
             }
           else
             {
-              for (auto const &import_indices_plain : import_indices_plain_dev)
-                {
-                  // We can't easily assert here, so we just move the pointer
-                  // matching the host code.
-                  const auto chunk_size = import_indices_plain.second;
-                  read_position += chunk_size;
-                }
+              // We can't easily assert here, so we just move the pointer
+              // matching the host code.
+              read_position += n_import_indices();
             }
 #    endif
           AssertDimension(read_position - temporary_storage.data(),
@@ -716,14 +888,23 @@ namespace Utilities
       // wait for the send operations to complete
       if (requests.size() > 0 && n_ghost_targets > 0)
         {
-          const int ierr = MPI_Waitall(n_ghost_targets,
-                                       &requests[n_import_targets],
-                                       MPI_STATUSES_IGNORE);
-          AssertThrowMPI(ierr);
+          if (mode != CommunicationMode::neighborhood_collectives)
+            {
+              const int ierr = MPI_Waitall(n_ghost_targets,
+                                           &requests[n_import_targets],
+                                           MPI_STATUSES_IGNORE);
+              AssertThrowMPI(ierr);
+            }
         }
       else
         AssertDimension(n_ghost_indices(), 0);
 
+      if (requests.size() > 0 && mode != CommunicationMode::point_to_point)
+        communication_data->finish_entries(false,
+                                           ghost_array.data(),
+                                           ghost_array.size(),
+                                           sizeof(Number));
+
       // clear the ghost array in case we did not yet do that in the _start
       // function
       if (ghost_array.size() > 0)
@@ -18,6 +18,8 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/array_view.h>
 #include <deal.II/base/quadrature.h>
 #include <deal.II/base/std_cxx17/optional.h>
 #include <deal.II/base/subscriptor.h>
@@ -32,6 +34,7 @@
 
 #include <deal.II/lac/vector.h>
 
+#include <algorithm>
 #include <map>
 #include <type_traits>
 #include <vector>
@@ -254,6 +257,135 @@ private:
 };
 
 
+
+/**
+ * A class for storing data of type @p DataType at the quadrature points of
+ * the cell batches of a MatrixFree object in a single contiguous array,
+ * indexed by the cell batch and the quadrature point index. Contrary to
+ * CellDataStorage, which allocates each quadrature point's object on the
+ * heap and looks up cells in a map, the data of all quadrature points of a
+ * cell batch is stored next to each other, and the data of consecutive cell
+ * batches follows. This avoids one memory allocation per quadrature point
+ * and gives the same memory access pattern as the loops of FEEvaluation.
+ *
+ * The intended use is with a @p DataType whose members are vectorized,
+ * e.g. VectorizedArray<double> or Tensor<2, dim, VectorizedArray<double>>,
+ * such that each object holds the data of one quadrature point of all the
+ * cells of a batch:
+ * @code
+ *   struct HistoryData
+ *   {
+ *     SymmetricTensor<2, dim, VectorizedArray<double>> plastic_strain;
+ *     VectorizedArray<double>                          hardening;
+ *   };
+ *
+ *   CellBatchDataStorage<HistoryData> history;
+ *   history.initialize(matrix_free.n_cell_batches(), phi.n_q_points);
+ *   ...
+ *   for (unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+ *     {
+ *       phi.reinit(cell);
+ *       for (const unsigned int q : phi.quadrature_point_indices())
+ *         {
+ *           HistoryData &data = history(cell, q);
+ *           ...
+ *         }
+ *     }
+ * @endcode
+ *
+ * All cell batches have the same number of quadrature points. Since the
+ * numbering of cell batches changes when the MatrixFree object is
+ * reinitialized after mesh refinement, transferring the data to a new mesh
+ * needs to go through the cells, e.g. via CellDataStorage and
+ * parallel::distributed::ContinuousQuadratureDataTransfer.
+ */
+template <typename DataType>
+class CellBatchDataStorage : public Subscriptor
+{
+public:
+  /**
+   * Default constructor. Creates an empty object.
+   */
+  CellBatchDataStorage();
+
+  /**
+   * Allocate the data for @p n_cell_batches cell batches with
+   * @p n_q_points quadrature points each and set all entries to
+   * @p initial_value.
+   */
+  void
+  initialize(const unsigned int n_cell_batches,
+             const unsigned int n_q_points,
+             const DataType &   initial_value = DataType());
+
+  /**
+   * Release all data.
+   */
+  void
+  clear();
+
+  /**
+   * Return the number of cell batches data is stored for.
+   */
+  unsigned int
+  n_cell_batches() const;
+
+  /**
+   * Return the number of quadrature points per cell batch.
+   */
+  unsigned int
+  n_q_points() const;
+
+  /**
+   * Return a reference to the data at quadrature point @p q of the cell
+   * batch @p cell_batch.
+   */
+  DataType &
+  operator()(const unsigned int cell_batch, const unsigned int q);
+
+  /**
+   * Return a read-only reference to the data at quadrature point @p q of
+   * the cell batch @p cell_batch.
+   */
+  const DataType &
+  operator()(const unsigned int cell_batch, const unsigned int q) const;
+
+  /**
+   * Return a view to the data at all quadrature points of the cell batch
+   * @p cell_batch.
+   */
+  ArrayView<DataType>
+  get_data(const unsigned int cell_batch);
+
+  /**
+   * Return a read-only view to the data at all quadrature points of the
+   * cell batch @p cell_batch.
+   */
+  ArrayView<const DataType>
+  get_data(const unsigned int cell_batch) const;
+
+  /**
+   * Return an estimate of the memory consumption of this object in bytes.
+   * Memory allocated by the objects of type @p DataType themselves is not
+   * included.
+   */
+  std::size_t
+  memory_consumption() const;
+
+private:
+  /**
+   * The number of quadrature points per cell batch.
+   */
+  unsigned int n_points;
+
+  /**
+   * The data of all quadrature points, with the quadrature points of a cell
+   * batch running fastest.
+   */
+  AlignedVector<DataType> data;
+};
+
+
 /**
  * An abstract class which specifies requirements for data on
  * a single quadrature point to be transferable during refinement or
@@ -318,6 +450,26 @@ public:
    */
   virtual void
   unpack_values(const std::vector<double> &values) = 0;
+
+  /**
+   * Pack all data stored in the derived class into the buffer @p values of
+   * size number_of_values(), which is a row of the flat matrix the
+   * data of all quadrature points of a cell are collected in by
+   * parallel::distributed::ContinuousQuadratureDataTransfer.
+   *
+   * The default implementation calls pack_values() with a temporary vector
+   * and copies the result. Derived classes can override this function to
+   * write directly into @p values and avoid the memory allocation.
+   */
+  virtual void
+  pack_values_to_buffer(const ArrayView<double> &values) const;
+
+  /**
+   * The opposite of pack_values_to_buffer(). The default implementation
+   * copies @p values into a temporary vector and calls unpack_values().
+   */
+  virtual void
+  unpack_values_from_buffer(const ArrayView<const double> &values);
 };
 
 
@@ -806,6 +958,142 @@ CellDataStorage<CellIteratorType, DataType>::try_get_data(
     }
 }
 
+//--------------------------------------------------------------------
+//                         CellBatchDataStorage
+//--------------------------------------------------------------------
+
+template <typename DataType>
+inline CellBatchDataStorage<DataType>::CellBatchDataStorage()
+  : n_points(0)
+{}
+
+
+
+template <typename DataType>
+inline void
+CellBatchDataStorage<DataType>::initialize(const unsigned int n_cell_batches,
+                                           const unsigned int n_q_points,
+                                           const DataType &   initial_value)
+{
+  n_points = n_q_points;
+  data.clear();
+  data.resize(static_cast<std::size_t>(n_cell_batches) * n_q_points,
+              initial_value);
+}
+
+
+
+template <typename DataType>
+inline void
+CellBatchDataStorage<DataType>::clear()
+{
+  n_points = 0;
+  data.clear();
+}
+
+
+
+template <typename DataType>
+inline unsigned int
+CellBatchDataStorage<DataType>::n_cell_batches() const
+{
+  return n_points == 0 ? 0 : data.size() / n_points;
+}
+
+
+
+template <typename DataType>
+inline unsigned int
+CellBatchDataStorage<DataType>::n_q_points() const
+{
+  return n_points;
+}
+
+
+
+template <typename DataType>
+inline DataType &
+CellBatchDataStorage<DataType>::operator()(const unsigned int cell_batch,
+                                           const unsigned int q)
+{
+  AssertIndexRange(cell_batch, n_cell_batches());
+  AssertIndexRange(q, n_points);
+  return data[static_cast<std::size_t>(cell_batch) * n_points + q];
+}
+
+
+
+template <typename DataType>
+inline const DataType &
+CellBatchDataStorage<DataType>::operator()(const unsigned int cell_batch,
+                                           const unsigned int q) const
+{
+  AssertIndexRange(cell_batch, n_cell_batches());
+  AssertIndexRange(q, n_points);
+  return data[static_cast<std::size_t>(cell_batch) * n_points + q];
+}
+
+
+
+template <typename DataType>
+inline ArrayView<DataType>
+CellBatchDataStorage<DataType>::get_data(const unsigned int cell_batch)
+{
+  AssertIndexRange(cell_batch, n_cell_batches());
+  return ArrayView<DataType>(data.data() + static_cast<std::size_t>(
+                                             cell_batch) * n_points,
+                             n_points);
+}
+
+
+
+template <typename DataType>
+inline ArrayView<const DataType>
+CellBatchDataStorage<DataType>::get_data(const unsigned int cell_batch) const
+{
+  AssertIndexRange(cell_batch, n_cell_batches());
+  return ArrayView<const DataType>(data.data() + static_cast<std::size_t>(
+                                                   cell_batch) * n_points,
+                                   n_points);
+}
+
+
+
+template <typename DataType>
+inline std::size_t
+CellBatchDataStorage<DataType>::memory_consumption() const
+{
+  return sizeof(*this) + data.size() * sizeof(DataType);
+}
+
+
+
+//--------------------------------------------------------------------
+//                    TransferableQuadraturePointData
+//--------------------------------------------------------------------
+
+inline void
+TransferableQuadraturePointData::pack_values_to_buffer(
+  const ArrayView<double> &values) const
+{
+  std::vector<double> vector_values(values.size());
+  pack_values(vector_values);
+  AssertDimension(vector_values.size(), values.size());
+  std::copy(vector_values.begin(), vector_values.end(), values.begin());
+}
+
+
+
+inline void
+TransferableQuadraturePointData::unpack_values_from_buffer(
+  const ArrayView<const double> &values)
+{
+  const std::vector<double> vector_values(values.begin(), values.end());
+  unpack_values(vector_values);
+}
+
+
+
 //--------------------------------------------------------------------
 //                    ContinuousQuadratureDataTransfer
 //--------------------------------------------------------------------
@@ -835,15 +1123,12 @@ pack_cell_data(const CellIteratorType &                           cell,
       const unsigned int n = (*qpd)[0]->number_of_values();
       matrix_data.reinit(m, n);
 
-      std::vector<double> single_qp_data(n);
-      for (unsigned int q = 0; q < m; ++q)
-        {
-          (*qpd)[q]->pack_values(single_qp_data);
-          AssertDimension(single_qp_data.size(), n);
-
-          for (unsigned int i = 0; i < n; ++i)
-            matrix_data(q, i) = single_qp_data[i];
-        }
+      // the rows of the matrix are contiguous, so the data of each
+      // quadrature point can be written directly into them
+      if (n > 0)
+        for (unsigned int q = 0; q < m; ++q)
+          static_cast<const TransferableQuadraturePointData &>(*(*qpd)[q])
+            .pack_values_to_buffer(ArrayView<double>(&matrix_data(q, 0), n));
     }
   else
     {
@@ -871,15 +1156,13 @@ unpack_to_cell_data(const CellIteratorType &                     cell,
       const unsigned int n = values_at_qp.n();
       AssertDimension((*qpd)[0]->number_of_values(), n);
 
-      std::vector<double> single_qp_data(n);
       AssertDimension(qpd->size(), values_at_qp.m());
 
-      for (unsigned int q = 0; q < qpd->size(); ++q)
-        {
-          for (unsigned int i = 0; i < n; ++i)
-            single_qp_data[i] = values_at_qp(q, i);
-          (*qpd)[q]->unpack_values(single_qp_data);
-        }
+      if (n > 0)
+        for (unsigned int q = 0; q < qpd->size(); ++q)
+          static_cast<TransferableQuadraturePointData &>(*(*qpd)[q])
+            .unpack_values_from_buffer(
+              ArrayView<const double>(&values_at_qp(q, 0), n));
     }
 }
 
@@ -23,8 +23,10 @@
 #include <deal.II/base/table_indices.h>
 #include <deal.II/base/template_constraints.h>
 #include <deal.II/base/tensor.h>
+#include <deal.II/base/vectorization.h>
 
 #include <array>
+#include <limits>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -1648,6 +1650,58 @@ namespace internal
       }
     };
 
+
+    /**
+     * Specialization of the inverse of a rank-4 tensor in 3d for a batch of
+     * tensors stored in a VectorizedArray. The pivot search of the general
+     * implementation selects different rows in different lanes, so this
+     * variant runs the Gauss-Jordan algorithm without pivoting, which
+     * executes the same operations in all lanes. This is stable for the
+     * positive definite tangent moduli of material laws, which are the main
+     * use case of batched tensor inversion.
+     */
+    template <typename Number, std::size_t width>
+    struct Inverse<4, 3, VectorizedArray<Number, width>>
+    {
+      static dealii::SymmetricTensor<4, 3, VectorizedArray<Number, width>>
+      value(
+        const dealii::SymmetricTensor<4, 3, VectorizedArray<Number, width>> &t)
+      {
+        dealii::SymmetricTensor<4, 3, VectorizedArray<Number, width>> tmp = t;
+
+        const unsigned int N = 6;
+        for (unsigned int j = 0; j < N; ++j)
+          {
+            const VectorizedArray<Number, width> hr =
+              Number(1.) / tmp.data[j][j];
+            tmp.data[j][j] = hr;
+            for (unsigned int k = 0; k < N; ++k)
+              {
+                if (k == j)
+                  continue;
+                const VectorizedArray<Number, width> factor =
+                  tmp.data[j][k] * hr;
+                for (unsigned int i = 0; i < N; ++i)
+                  if (i != j)
+                    tmp.data[i][k] -= tmp.data[i][j] * factor;
+              }
+            for (unsigned int i = 0; i < N; ++i)
+              {
+                tmp.data[i][j] *= hr;
+                tmp.data[j][i] *= -hr;
+              }
+            tmp.data[j][j] = hr;
+          }
+
+        // Scale rows and columns as in the general case
+        for (unsigned int i = 0; i < N; ++i)
+          for (unsigned int j = 0; j < N; ++j)
+            tmp.data[i][j] *= Number((i < 3 ? 1. : 0.5) * (j < 3 ? 1. : 0.5));
+
+        return tmp;
+      }
+    };
+
   } // namespace SymmetricTensorImplementation
 } // namespace internal
 
@@ -1886,14 +1940,18 @@ namespace internal
     for (unsigned int i = 0; i < data_dim; ++i)
       for (unsigned int j = 0; j < data_dim; ++j)
         {
-          // Start with the non-diagonal part
+          // Start with the non-diagonal part, accumulating into a local
+          // variable rather than the result tensor, which allows the
+          // compiler to keep the sum in a register
+          value_type sum{};
           for (unsigned int d = dim; d < (dim * (dim + 1) / 2); ++d)
-            tmp[i][j] += data[i][d] * sdata[d][j];
-          tmp[i][j] += tmp[i][j]; // tmp[i][j] = tmp[i][j] * 2;
+            sum += data[i][d] * sdata[d][j];
+          sum += sum; // sum = sum * 2.;
 
           // Now add the contributions from the diagonal
           for (unsigned int d = 0; d < dim; ++d)
-            tmp[i][j] += data[i][d] * sdata[d][j];
+            sum += data[i][d] * sdata[d][j];
+          tmp[i][j] = sum;
         }
     return tmp;
   }
@@ -3298,6 +3356,250 @@ eigenvectors(const SymmetricTensor<2, dim, Number> &T,
 
 
 
+namespace internal
+{
+  namespace SymmetricTensorImplementation
+  {
+    /**
+     * Compute the eigenvalues and eigenvectors of the tensors in the lanes
+     * of @p A by cyclic Jacobi rotations. In contrast to the algorithms for
+     * scalar numbers, all decisions are taken with masks rather than
+     * branches, so that all lanes execute the same instructions. In 2d, a
+     * single rotation diagonalizes the tensor exactly; in 3d, sweeps are
+     * repeated until the off-diagonal entries of all lanes have become
+     * negligible, which typically takes four to six sweeps.
+     */
+    template <int dim, typename Number, std::size_t width>
+    std::array<std::pair<VectorizedArray<Number, width>,
+                         Tensor<1, dim, VectorizedArray<Number, width>>>,
+               dim>
+    jacobi_vectorized(
+      dealii::SymmetricTensor<2, dim, VectorizedArray<Number, width>> A)
+    {
+      using VectorizedArrayType = VectorizedArray<Number, width>;
+
+      dealii::Tensor<2, dim, VectorizedArrayType> Q;
+      for (unsigned int d = 0; d < dim; ++d)
+        Q[d][d] = Number(1.);
+
+      VectorizedArrayType scale = VectorizedArrayType();
+      for (unsigned int i = 0; i < dim; ++i)
+        for (unsigned int j = i; j < dim; ++j)
+          scale += std::abs(A[i][j]);
+      const VectorizedArrayType tolerance =
+        std::numeric_limits<Number>::epsilon() * scale;
+
+      const unsigned int max_n_sweeps = 50;
+      for (unsigned int sweep = 0;; ++sweep)
+        {
+          // Check convergence in all lanes
+          VectorizedArrayType off_diagonal = VectorizedArrayType();
+          for (unsigned int p = 0; p < dim; ++p)
+            for (unsigned int q = p + 1; q < dim; ++q)
+              off_diagonal += std::abs(A[p][q]);
+          bool converged = true;
+          for (unsigned int v = 0; v < width; ++v)
+            converged = converged && off_diagonal[v] <= tolerance[v];
+          if (converged)
+            break;
+
+          AssertThrow(sweep < max_n_sweeps,
+                      ExcMessage("No convergence in vectorized Jacobi "
+                                 "eigenvector algorithm."));
+
+          for (unsigned int p = 0; p < dim; ++p)
+            for (unsigned int q = p + 1; q < dim; ++q)
+              {
+                const VectorizedArrayType a_pq = A[p][q];
+
+                // The rotation angle follows from
+                // theta = (a_qq - a_pp) / (2 a_pq) and
+                // t = sign(theta) / (|theta| + sqrt(theta^2 + 1)); lanes with
+                // a_pq == 0 need no rotation, so we use t = 0 there.
+                const VectorizedArrayType zero = VectorizedArrayType();
+                const VectorizedArrayType one  = Number(1.);
+                const VectorizedArrayType safe_a_pq =
+                  compare_and_apply_mask<SIMDComparison::equal>(a_pq,
+                                                                zero,
+                                                                one,
+                                                                a_pq);
+                const VectorizedArrayType theta =
+                  (A[q][q] - A[p][p]) / (Number(2.) * safe_a_pq);
+                const VectorizedArrayType sign =
+                  compare_and_apply_mask<SIMDComparison::less_than>(theta,
+                                                                    zero,
+                                                                    -one,
+                                                                    one);
+                const VectorizedArrayType t =
+                  compare_and_apply_mask<SIMDComparison::equal>(
+                    a_pq,
+                    zero,
+                    zero,
+                    sign / (std::abs(theta) + std::sqrt(theta * theta + one)));
+                const VectorizedArrayType c = one / std::sqrt(t * t + one);
+                const VectorizedArrayType s = t * c;
+
+                A[p][p] -= t * a_pq;
+                A[q][q] += t * a_pq;
+                A[p][q] = zero;
+                for (unsigned int r = 0; r < dim; ++r)
+                  if (r != p && r != q)
+                    {
+                      const VectorizedArrayType a_rp = A[r][p];
+                      const VectorizedArrayType a_rq = A[r][q];
+                      A[r][p]                        = c * a_rp - s * a_rq;
+                      A[r][q]                        = s * a_rp + c * a_rq;
+                    }
+                for (unsigned int r = 0; r < dim; ++r)
+                  {
+                    const VectorizedArrayType q_rp = Q[r][p];
+                    const VectorizedArrayType q_rq = Q[r][q];
+                    Q[r][p]                        = c * q_rp - s * q_rq;
+                    Q[r][q]                        = s * q_rp + c * q_rq;
+                  }
+              }
+        }
+
+      std::array<std::pair<VectorizedArrayType,
+                           Tensor<1, dim, VectorizedArrayType>>,
+                 dim>
+        eig_vals_vecs;
+      for (unsigned int e = 0; e < dim; ++e)
+        {
+          eig_vals_vecs[e].first = A[e][e];
+          for (unsigned int d = 0; d < dim; ++d)
+            eig_vals_vecs[e].second[d] = Q[d][e];
+        }
+
+      // Sort in descending order of the eigenvalues with a sorting network
+      // of compare-exchange operations on the lanes
+      const auto compare_exchange = [&](const unsigned int i,
+                                        const unsigned int j) {
+        const VectorizedArrayType lambda_i = eig_vals_vecs[i].first;
+        const VectorizedArrayType lambda_j = eig_vals_vecs[j].first;
+        eig_vals_vecs[i].first =
+          compare_and_apply_mask<SIMDComparison::less_than>(lambda_i,
+                                                            lambda_j,
+                                                            lambda_j,
+                                                            lambda_i);
+        eig_vals_vecs[j].first =
+          compare_and_apply_mask<SIMDComparison::less_than>(lambda_i,
+                                                            lambda_j,
+                                                            lambda_i,
+                                                            lambda_j);
+        for (unsigned int d = 0; d < dim; ++d)
+          {
+            const VectorizedArrayType v_i = eig_vals_vecs[i].second[d];
+            const VectorizedArrayType v_j = eig_vals_vecs[j].second[d];
+            eig_vals_vecs[i].second[d] =
+              compare_and_apply_mask<SIMDComparison::less_than>(lambda_i,
+                                                                lambda_j,
+                                                                v_j,
+                                                                v_i);
+            eig_vals_vecs[j].second[d] =
+              compare_and_apply_mask<SIMDComparison::less_than>(lambda_i,
+                                                                lambda_j,
+                                                                v_i,
+                                                                v_j);
+          }
+      };
+      if (dim > 1)
+        compare_exchange(0, 1);
+      if (dim > 2)
+        {
+          compare_exchange(1, 2);
+          compare_exchange(0, 1);
+        }
+
+      return eig_vals_vecs;
+    }
+  } // namespace SymmetricTensorImplementation
+} // namespace internal
+
+
+
+/**
+ * Return the eigenvalues and eigenvectors of the symmetric tensors stored in
+ * the lanes of a SymmetricTensor of VectorizedArray numbers, as they appear
+ * in batched evaluations of material laws, e.g., in FEEvaluation loops. The
+ * array is sorted in descending order of the eigenvalues in each lane.
+ *
+ * Since the algorithms for scalar numbers branch on the values of the
+ * tensor entries, this overload always uses cyclic Jacobi rotations that
+ * are computed for all lanes at once with masked operations, and the
+ * argument @p method is ignored. In 2d, the decomposition is obtained in
+ * closed form by a single rotation.
+ *
+ * @relatesalso SymmetricTensor
+ */
+template <int dim, typename Number, std::size_t width>
+inline std::array<std::pair<VectorizedArray<Number, width>,
+                            Tensor<1, dim, VectorizedArray<Number, width>>>,
+                  std::integral_constant<int, dim>::value>
+eigenvectors(const SymmetricTensor<2, dim, VectorizedArray<Number, width>> &T,
+             const SymmetricTensorEigenvectorMethod method =
+               SymmetricTensorEigenvectorMethod::ql_implicit_shifts)
+{
+  (void)method;
+  return internal::SymmetricTensorImplementation::jacobi_vectorized(T);
+}
+
+
+
+/**
+ * Return the eigenvalues of the $1 \times 1$ symmetric tensors stored in the
+ * lanes of a SymmetricTensor of VectorizedArray numbers.
+ *
+ * @relatesalso SymmetricTensor
+ */
+template <typename Number, std::size_t width>
+inline std::array<VectorizedArray<Number, width>, 1>
+eigenvalues(const SymmetricTensor<2, 1, VectorizedArray<Number, width>> &T)
+{
+  return {{T[0][0]}};
+}
+
+
+
+/**
+ * Return the eigenvalues of the $2 \times 2$ symmetric tensors stored in the
+ * lanes of a SymmetricTensor of VectorizedArray numbers, sorted in
+ * descending order in each lane. The eigenvalues are computed with the
+ * same algorithm as the eigenvectors() function for VectorizedArray
+ * numbers, which, unlike the solution of the characteristic polynomial,
+ * does not lose accuracy for (almost) equal eigenvalues.
+ *
+ * @relatesalso SymmetricTensor
+ */
+template <typename Number, std::size_t width>
+inline std::array<VectorizedArray<Number, width>, 2>
+eigenvalues(const SymmetricTensor<2, 2, VectorizedArray<Number, width>> &T)
+{
+  const auto eig_vals_vecs = eigenvectors(T);
+  return {{eig_vals_vecs[0].first, eig_vals_vecs[1].first}};
+}
+
+
+
+/**
+ * Return the eigenvalues of the $3 \times 3$ symmetric tensors stored in the
+ * lanes of a SymmetricTensor of VectorizedArray numbers, sorted in
+ * descending order in each lane, see the 2d variant of this function.
+ *
+ * @relatesalso SymmetricTensor
+ */
+template <typename Number, std::size_t width>
+inline std::array<VectorizedArray<Number, width>, 3>
+eigenvalues(const SymmetricTensor<2, 3, VectorizedArray<Number, width>> &T)
+{
+  const auto eig_vals_vecs = eigenvectors(T);
+  return {{eig_vals_vecs[0].first,
+           eig_vals_vecs[1].first,
+           eig_vals_vecs[2].first}};
+}
+
+
+
 /**
  * Return the transpose of the given symmetric tensor. Since we are working
  * with symmetric objects, the transpose is of course the same as the original
@@ -26,10 +26,12 @@
 #include <deal.II/base/template_constraints.h>
 
 #include <atomic>
+#include <condition_variable>
 #include <functional>
 #include <future>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <thread>
 #include <utility>
 #include <vector>
@@ -1712,6 +1714,105 @@ namespace Threads
     std::list<Task<RT>> tasks;
   };
 
+
+
+  // ------------------------ TaskGraph -------------------------------------
+
+  /**
+   * A collection of functions with dependencies between them, to be run as
+   * concurrently as these dependencies allow. Each function added through
+   * add_task() may name other, previously added, functions that need to
+   * have finished before it can start. A call to run() then executes all
+   * functions as tasks: every function is started as soon as all of its
+   * prerequisites are done, and run() returns once all of them have
+   * finished.
+   *
+   * A typical use is the setup phase after mesh refinement, where many steps
+   * only depend on the DoFHandler but not on each other:
+   * @code
+   *   Threads::TaskGraph setup;
+   *   const unsigned int dofs = setup.add_task([&]() {
+   *     dof_handler.distribute_dofs(fe);
+   *     DoFRenumbering::Cuthill_McKee(dof_handler);
+   *   });
+   *   const unsigned int hanging = setup.add_task(
+   *     [&]() {
+   *       DoFTools::make_hanging_node_constraints(dof_handler,
+   *                                               hanging_node_constraints);
+   *     },
+   *     {dofs});
+   *   const unsigned int boundary = setup.add_task(
+   *     [&]() {
+   *       VectorTools::interpolate_boundary_values(dof_handler,
+   *                                                0,
+   *                                                boundary_function,
+   *                                                boundary_constraints);
+   *     },
+   *     {dofs});
+   *   setup.add_task([&]() { solution_transfer.interpolate(solution); },
+   *                  {dofs});
+   *   const unsigned int constraints = setup.add_task(
+   *     [&]() {
+   *       constraints.merge(hanging_node_constraints);
+   *       constraints.merge(boundary_constraints);
+   *       constraints.close();
+   *     },
+   *     {hanging, boundary});
+   *   setup.add_task([&]() { make_sparsity_pattern(); }, {constraints});
+   *   setup.run();
+   * @endcode
+   * Functions running concurrently must of course not write to the same
+   * objects.
+   *
+   * Unlike joining Task objects from within other tasks, which may deadlock,
+   * all scheduling decisions are made on the thread that calls run(). If a
+   * function throws an exception, the functions that depend on it are not
+   * started, and run() re-throws the exception once all functions that were
+   * already running have finished.
+   *
+   * @ingroup tasks
+   */
+  class TaskGraph
+  {
+  public:
+    /**
+     * Add @p function to the graph, to be run only after all functions whose
+     * indices are listed in @p prerequisites have finished. Return the index
+     * by which later functions can refer to this one.
+     */
+    unsigned int
+    add_task(const std::function<void()> &     function,
+             const std::vector<unsigned int> &prerequisites = {});
+
+    /**
+     * Return the number of functions added to the graph.
+     */
+    std::size_t
+    size() const
+    {
+      return functions.size();
+    }
+
+    /**
+     * Run all functions of the graph, respecting their dependencies, and
+     * wait until all of them have finished. The graph can be run more than
+     * once.
+     */
+    void
+    run() const;
+
+  private:
+    /**
+     * The functions of the graph.
+     */
+    std::vector<std::function<void()>> functions;
+
+    /**
+     * For each function, the indices of the functions it depends on.
+     */
+    std::vector<std::vector<unsigned int>> prerequisites;
+  };
+
 } // namespace Threads
 
 /**
@@ -19,9 +19,11 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/mpi_stub.h>
 #include <deal.II/base/signaling_nan.h>
 
 #include <functional>
+#include <utility>
 #include <vector>
 
 DEAL_II_NAMESPACE_OPEN
@@ -470,6 +472,48 @@ namespace TimeStepping
       VectorType &vec_ri,
       VectorType &vec_ki);
 
+    /**
+     * Same as the previous function, but the evaluation of the differential
+     * operator and the vector updates of each stage are both left to the
+     * function @p perform_stage. This allows to merge the vector updates with
+     * the operator evaluation, e.g. in the `operation_after_loop` argument of
+     * MatrixFree::cell_loop(), or to apply an inverse mass matrix cell by
+     * cell, rather than running separate sweeps through the vectors. For
+     * each stage, @p perform_stage is called with the arguments `(t,
+     * factor_solution, factor_ai, current_ri, vec_ki, solution, next_ri)` and
+     * must perform the operations
+     * @code
+     *   vec_ki = f(t, current_ri);
+     *   if (factor_ai != 0.)
+     *     next_ri = solution + factor_ai * vec_ki;
+     *   solution += factor_solution * vec_ki;
+     * @endcode
+     * where the update of @p next_ri is skipped in the last stage. In the
+     * first stage, @p current_ri refers to the same object as @p solution,
+     * and in all other stages, @p current_ri and @p next_ri refer to the same
+     * object @p vec_ri. Therefore, an implementation must only overwrite an
+     * entry of these vectors once it has been read for the last time, which
+     * is the guarantee given by the `operation_after_loop` of
+     * MatrixFree::cell_loop(). The function
+     * MatrixFreeOperators::update_low_storage_runge_kutta_stage() implements
+     * the vector updates for that purpose. The function returns the time at
+     * the end of the time step.
+     */
+    double
+    evolve_one_time_step(
+      const std::function<void(const double      t,
+                               const double      factor_solution,
+                               const double      factor_ai,
+                               const VectorType &current_ri,
+                               VectorType &      vec_ki,
+                               VectorType &      solution,
+                               VectorType &      next_ri)> &perform_stage,
+      double                                             t,
+      double                                             delta_t,
+      VectorType &                                       solution,
+      VectorType &                                       vec_ri,
+      VectorType &                                       vec_ki);
+
     /**
      * Get the coefficients of the scheme.
      * Note that here vector @p a is not the conventional definition in terms of a
@@ -701,6 +745,12 @@ namespace TimeStepping
 
     /**
      * If necessary, deallocate memory allocated by the object.
+     *
+     * The vectors holding the stages and intermediate results are kept from
+     * one call of evolve_one_time_step() to the next, and are only
+     * allocated anew if the size of the vector passed to it changes. This
+     * function needs to be called if the vector changes its parallel
+     * distribution without changing its size.
      */
     void
     free_memory();
@@ -786,7 +836,9 @@ namespace TimeStepping
 
   private:
     /**
-     * Compute the different stages needed.
+     * Compute the different stages needed. If @p skip_first_stage is true,
+     * the first stage is already stored in @p f_stages. @p Y is used as
+     * temporary storage.
      */
     void
     compute_stages(
@@ -794,6 +846,8 @@ namespace TimeStepping
       const double                                                       t,
       const double             delta_t,
       const VectorType &       y,
+      const bool               skip_first_stage,
+      VectorType &             Y,
       std::vector<VectorType> &f_stages);
 
     /**
@@ -847,16 +901,175 @@ namespace TimeStepping
     std::vector<double> b2;
 
     /**
-     * If the last_same_as_first flag is set to true, the last stage is saved
-     * and reused as the first stage of the next time step.
+     * If the last_same_as_first flag is set to true, the last stage of a time
+     * step is kept in #f_stages and reused as the first stage of the next
+     * time step. This flag indicates whether such a stage is available.
+     */
+    bool last_stage_available = false;
+
+    /**
+     * The stages of the last time step, kept to avoid allocating them in
+     * every time step.
+     */
+    std::vector<VectorType> f_stages;
+
+    /**
+     * Vectors for the solution at the beginning of the time step, the error
+     * estimate, and the argument of the stages, kept to avoid allocating
+     * them in every time step.
      */
-    VectorType *last_stage = nullptr;
+    std::vector<VectorType> work_vectors;
 
     /**
      * Status structure of the object.
      */
     Status status;
   };
+
+
+
+  /**
+   * This class implements the parareal algorithm, which solves an initial
+   * value problem in parallel in time. The time interval is split into as
+   * many slices as there are processes in a time communicator, and each
+   * process integrates the problem on its own slice with an accurate but
+   * expensive fine propagator $\mathcal F$, starting from an approximation
+   * of the solution at the beginning of the slice. These starting values
+   * are corrected in every iteration by a sweep over the slices with a
+   * cheap coarse propagator $\mathcal G$,
+   * @f[
+   *   U_{p+1}^{k+1} = \mathcal G(U_p^{k+1}) + \mathcal F(U_p^k)
+   *                   - \mathcal G(U_p^k),
+   * @f]
+   * which is the only sequential part of the algorithm. After $k$
+   * iterations, the solution on the first $k$ slices equals the one of the
+   * fine propagator, so the iteration stops after at most one iteration less
+   * than the number of slices, or earlier if the largest change of the
+   * values at the end of the slices is smaller than a tolerance. Parareal is
+   * the two-level variant of the multigrid reduction in time (MGRIT)
+   * algorithm with F-relaxation.
+   *
+   * The propagators are functions that integrate the problem from a time
+   * $t_0$ to a time $t_1$, overwriting the vector passed to them. This way,
+   * any time stepping method can be used, e.g., one of the Runge-Kutta
+   * methods of this namespace with a small and a large time step, or an
+   * Algorithms::ThetaTimestepping object:
+   * @code
+   *   TimeStepping::ExplicitRungeKutta<VectorType> runge_kutta(
+   *     TimeStepping::RK_CLASSIC_FOURTH_ORDER);
+   *   const auto make_propagator = [&](const double time_step) {
+   *     return [&runge_kutta, &f, time_step](const double t0,
+   *                                          const double t1,
+   *                                          VectorType & y) {
+   *       for (double t = t0; t < t1 - 1e-12 * time_step;)
+   *         t = runge_kutta.evolve_one_time_step(
+   *           f, t, std::min(time_step, t1 - t), y);
+   *     };
+   *   };
+   *   TimeStepping::Parareal<VectorType> parareal(time_communicator,
+   *                                               make_propagator(1e-3),
+   *                                               make_propagator(1e-1),
+   *                                               10,
+   *                                               1e-8);
+   *   parareal.evolve(0., 1., solution);
+   * @endcode
+   *
+   * To combine the parallelization in time with a parallelization in space,
+   * the processes are split into groups that each work on one time slice
+   * with their own spatial communicator, and the time communicator connects
+   * the processes with the same rank in the spatial communicators of all
+   * groups:
+   * @code
+   *   const unsigned int rank =
+   *     Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+   *   MPI_Comm space_communicator, time_communicator;
+   *   MPI_Comm_split(MPI_COMM_WORLD,
+   *                  rank / n_processes_in_space,
+   *                  rank,
+   *                  &space_communicator);
+   *   MPI_Comm_split(MPI_COMM_WORLD,
+   *                  rank % n_processes_in_space,
+   *                  rank,
+   *                  &time_communicator);
+   * @endcode
+   * The vectors of all groups need to have the same parallel distribution,
+   * since the values at the ends of the slices are sent from each process to
+   * the process with the same spatial rank in the next group. The locally
+   * owned elements of VectorType must be stored contiguously starting at
+   * <tt>begin()</tt>, as is the case for Vector and
+   * LinearAlgebra::distributed::Vector.
+   */
+  template <typename VectorType>
+  class Parareal
+  {
+  public:
+    /**
+     * The type of the fine and coarse propagators, which integrate the
+     * problem from the first to the second argument, replacing the initial
+     * value in the third argument by the solution.
+     */
+    using Propagator =
+      std::function<void(const double, const double, VectorType &)>;
+
+    /**
+     * Constructor. The iteration stops after @p max_iterations iterations, or
+     * if the largest change of the solution at the end of a time slice in
+     * the $l_2$ norm is not larger than @p tolerance.
+     */
+    Parareal(const MPI_Comm &  time_communicator,
+             const Propagator &fine_propagator,
+             const Propagator &coarse_propagator,
+             const unsigned int max_iterations,
+             const double       tolerance);
+
+    /**
+     * Solve the problem from @p t_start to @p t_end. On input, @p y needs to
+     * contain the initial value on the processes of the first time slice,
+     * and a vector of the correct size and parallel distribution on all
+     * other processes. On output, @p y contains the solution at the end of
+     * the time slice of the present process, returned by get_time_slice(),
+     * i.e., the processes of the last time slice hold the solution at
+     * @p t_end.
+     *
+     * This function is collective over the time communicator and the
+     * spatial communicators. It returns the number of iterations.
+     */
+    unsigned int
+    evolve(const double t_start, const double t_end, VectorType &y);
+
+    /**
+     * Return the start and end time of the time slice of the present process
+     * for the time interval from @p t_start to @p t_end.
+     */
+    std::pair<double, double>
+    get_time_slice(const double t_start, const double t_end) const;
+
+  private:
+    /**
+     * The communicator of the time slices.
+     */
+    const MPI_Comm time_communicator;
+
+    /**
+     * The fine propagator.
+     */
+    const Propagator fine_propagator;
+
+    /**
+     * The coarse propagator.
+     */
+    const Propagator coarse_propagator;
+
+    /**
+     * The maximal number of iterations.
+     */
+    const unsigned int max_iterations;
+
+    /**
+     * The tolerance for the change of the solution.
+     */
+    const double tolerance;
+  };
 } // namespace TimeStepping
 
 DEAL_II_NAMESPACE_CLOSE
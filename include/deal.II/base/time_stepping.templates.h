@@ -19,8 +19,10 @@
 #include <deal.II/base/config.h>
 
 #include <deal.II/base/exceptions.h>
+#include <deal.II/base/mpi.h>
 #include <deal.II/base/time_stepping.h>
 
+#include <algorithm>
 #include <functional>
 
 DEAL_II_NAMESPACE_OPEN
@@ -424,6 +426,50 @@ namespace TimeStepping
     return (t + delta_t);
   }
 
+
+
+  template <typename VectorType>
+  double
+  LowStorageRungeKutta<VectorType>::evolve_one_time_step(
+    const std::function<void(const double      t,
+                             const double      factor_solution,
+                             const double      factor_ai,
+                             const VectorType &current_ri,
+                             VectorType &      vec_ki,
+                             VectorType &      solution,
+                             VectorType &      next_ri)> &perform_stage,
+    double                                             t,
+    double                                             delta_t,
+    VectorType &                                       solution,
+    VectorType &                                       vec_ri,
+    VectorType &                                       vec_ki)
+  {
+    Assert(status.method != runge_kutta_method::invalid, ExcNoMethodSelected());
+
+    perform_stage(t,
+                  this->b[0] * delta_t,
+                  this->a[0][0] * delta_t,
+                  solution,
+                  vec_ki,
+                  solution,
+                  vec_ri);
+
+    for (unsigned int stage = 1; stage < this->n_stages; ++stage)
+      {
+        const double c_i = this->c[stage];
+        const double factor_ai =
+          (stage == this->n_stages - 1 ? 0 : this->a[0][stage] * delta_t);
+        perform_stage(t + c_i * delta_t,
+                      this->b[stage] * delta_t,
+                      factor_ai,
+                      vec_ri,
+                      vec_ki,
+                      solution,
+                      vec_ri);
+      }
+    return (t + delta_t);
+  }
+
   template <typename VectorType>
   void
   LowStorageRungeKutta<VectorType>::get_coefficients(
@@ -716,7 +762,7 @@ namespace TimeStepping
     , refine_tol(refine_tol)
     , coarsen_tol(coarsen_tol)
     , last_same_as_first(false)
-    , last_stage(nullptr)
+    , last_stage_available(false)
     , status{}
   {
     // virtual functions called in constructors and destructors never use the
@@ -974,10 +1020,9 @@ namespace TimeStepping
   void
   EmbeddedExplicitRungeKutta<VectorType>::free_memory()
   {
-    if (last_stage != nullptr)
-      delete last_stage;
-
-    last_stage = nullptr;
+    f_stages.clear();
+    work_vectors.clear();
+    last_stage_available = false;
   }
 
 
@@ -1008,21 +1053,39 @@ namespace TimeStepping
   {
     Assert(status.method != runge_kutta_method::invalid, ExcNoMethodSelected());
 
-    bool                    done       = false;
-    unsigned int            count      = 0;
-    double                  error_norm = 0.;
-    VectorType              old_y(y);
-    VectorType              error(y);
-    std::vector<VectorType> f_stages(this->n_stages, y);
+    // Reuse the vectors of the previous time step if they are compatible
+    if (f_stages.size() != this->n_stages || work_vectors.empty() ||
+        work_vectors[0].size() != y.size())
+      {
+        f_stages.assign(this->n_stages, y);
+        work_vectors.assign(3, y);
+        last_stage_available = false;
+      }
+    VectorType &old_y = work_vectors[0];
+    VectorType &error = work_vectors[1];
+    VectorType &Y     = work_vectors[2];
+    old_y             = y;
+
+    // Put the last stage of the previous time step into the place of the
+    // first stage, the last stage is overwritten anyway
+    const bool skip_first_stage = last_same_as_first && last_stage_available;
+    if (skip_first_stage)
+      f_stages[0].swap(f_stages.back());
+
+    bool         done       = false;
+    unsigned int count      = 0;
+    double       error_norm = 0.;
 
     while (!done)
       {
-        error = 0.;
-        y     = old_y;
+        if (count > 0)
+          y = old_y;
         // Compute the different stages needed.
-        compute_stages(f, t, delta_t, y, f_stages);
+        compute_stages(f, t, delta_t, y, skip_first_stage, Y, f_stages);
 
-        for (unsigned int i = 0; i < this->n_stages; ++i)
+        error.equ(delta_t * (b2[0] - b1[0]), f_stages[0]);
+        y.sadd(1., delta_t * this->b1[0], f_stages[0]);
+        for (unsigned int i = 1; i < this->n_stages; ++i)
           {
             y.sadd(1., delta_t * this->b1[i], f_stages[i]);
             error.sadd(1., delta_t * (b2[i] - b1[i]), f_stages[i]);
@@ -1076,14 +1139,8 @@ namespace TimeStepping
         ++count;
       }
 
-    // Save the last stage if necessary
-    if (last_same_as_first == true)
-      {
-        if (last_stage == nullptr)
-          last_stage = new VectorType(f_stages.back());
-        else
-          *last_stage = f_stages.back();
-      }
+    // The last stage stays in f_stages for the next time step
+    last_stage_available = last_same_as_first;
 
     status.n_iterations = count;
     status.error_norm   = error_norm;
@@ -1128,23 +1185,13 @@ namespace TimeStepping
     const double                                                       t,
     const double                                                       delta_t,
     const VectorType &                                                 y,
-    std::vector<VectorType> &                                          f_stages)
+    const bool               skip_first_stage,
+    VectorType &             Y,
+    std::vector<VectorType> &f_stages)
   {
-    VectorType   Y(y);
-    unsigned int i = 0;
-
     // If the last stage is the same as the first, we can skip the evaluation
     // of the first stage.
-    if (last_same_as_first == true)
-      {
-        if (last_stage != nullptr)
-          {
-            f_stages[0] = *last_stage;
-            i           = 1;
-          }
-      }
-
-    for (; i < this->n_stages; ++i)
+    for (unsigned int i = skip_first_stage ? 1 : 0; i < this->n_stages; ++i)
       {
         Y = y;
         for (unsigned int j = 0; j < i; ++j)
@@ -1152,6 +1199,156 @@ namespace TimeStepping
         f_stages[i] = f(t + this->c[i] * delta_t, Y);
       }
   }
+
+
+
+  // ----------------------------------------------------------------------
+  // Parareal
+  // ----------------------------------------------------------------------
+
+  template <typename VectorType>
+  Parareal<VectorType>::Parareal(const MPI_Comm &   time_communicator,
+                                 const Propagator & fine_propagator,
+                                 const Propagator & coarse_propagator,
+                                 const unsigned int max_iterations,
+                                 const double       tolerance)
+    : time_communicator(time_communicator)
+    , fine_propagator(fine_propagator)
+    , coarse_propagator(coarse_propagator)
+    , max_iterations(max_iterations)
+    , tolerance(tolerance)
+  {}
+
+
+
+  template <typename VectorType>
+  std::pair<double, double>
+  Parareal<VectorType>::get_time_slice(const double t_start,
+                                       const double t_end) const
+  {
+    const unsigned int n_slices =
+      Utilities::MPI::n_mpi_processes(time_communicator);
+    const unsigned int slice =
+      Utilities::MPI::this_mpi_process(time_communicator);
+    const double slice_length = (t_end - t_start) / n_slices;
+
+    return std::make_pair(t_start + slice * slice_length,
+                          slice + 1 == n_slices ?
+                            t_end :
+                            t_start + (slice + 1) * slice_length);
+  }
+
+
+
+  template <typename VectorType>
+  unsigned int
+  Parareal<VectorType>::evolve(const double t_start,
+                               const double t_end,
+                               VectorType & y)
+  {
+    const unsigned int n_slices =
+      Utilities::MPI::n_mpi_processes(time_communicator);
+    const std::pair<double, double> time_slice =
+      get_time_slice(t_start, t_end);
+
+    // With a single time slice, the fine propagator gives the solution
+    if (n_slices == 1)
+      {
+        fine_propagator(time_slice.first, time_slice.second, y);
+        return 0;
+      }
+
+#ifdef DEAL_II_WITH_MPI
+    const unsigned int slice =
+      Utilities::MPI::this_mpi_process(time_communicator);
+    const MPI_Datatype mpi_type =
+      Utilities::MPI::mpi_type_id_for_type<typename VectorType::value_type>;
+    const int   tag          = 0;
+    MPI_Request send_request = MPI_REQUEST_NULL;
+    int         ierr;
+
+    // The value at the start of the slice, the result of the fine and coarse
+    // propagators, and a temporary vector
+    VectorType u_start(y);
+    VectorType fine_value(y);
+    VectorType coarse_value(y);
+    VectorType tmp(y);
+
+    const auto receive_start_value = [&]() {
+      if (slice > 0)
+        {
+          ierr = MPI_Recv(u_start.begin(),
+                          u_start.locally_owned_size(),
+                          mpi_type,
+                          slice - 1,
+                          tag,
+                          time_communicator,
+                          MPI_STATUS_IGNORE);
+          AssertThrowMPI(ierr);
+        }
+    };
+    // Send the value at the end of the slice, y, without waiting for the
+    // next slice to receive it. The send needs to complete before y is
+    // changed again.
+    const auto send_end_value = [&]() {
+      if (slice + 1 < n_slices)
+        {
+          ierr = MPI_Isend(y.begin(),
+                           y.locally_owned_size(),
+                           mpi_type,
+                           slice + 1,
+                           tag,
+                           time_communicator,
+                           &send_request);
+          AssertThrowMPI(ierr);
+        }
+    };
+    const auto wait_for_send = [&]() {
+      ierr = MPI_Wait(&send_request, MPI_STATUS_IGNORE);
+      AssertThrowMPI(ierr);
+    };
+
+    // Initial sequential sweep with the coarse propagator
+    receive_start_value();
+    coarse_value = u_start;
+    coarse_propagator(time_slice.first, time_slice.second, coarse_value);
+    y = coarse_value;
+    send_end_value();
+
+    unsigned int iteration = 0;
+    while (iteration < std::min(max_iterations, n_slices - 1))
+      {
+        // The fine propagation runs in parallel on all slices
+        fine_value = u_start;
+        fine_propagator(time_slice.first, time_slice.second, fine_value);
+
+        // The correction is a sequential sweep with the coarse propagator
+        receive_start_value();
+        tmp = u_start;
+        coarse_propagator(time_slice.first, time_slice.second, tmp);
+        fine_value += tmp;
+        fine_value -= coarse_value;
+        coarse_value = tmp;
+
+        wait_for_send();
+        y -= fine_value;
+        const double change = y.l2_norm();
+        y                   = fine_value;
+        send_end_value();
+        ++iteration;
+
+        if (Utilities::MPI::max(change, time_communicator) <= tolerance)
+          break;
+      }
+
+    wait_for_send();
+
+    return iteration;
+#else
+    Assert(false, ExcNeedsMPI());
+    return 0;
+#endif
+  }
 } // namespace TimeStepping
 
 DEAL_II_NAMESPACE_CLOSE
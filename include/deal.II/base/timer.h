@@ -22,7 +22,9 @@
 #include <deal.II/base/mpi.h>
 #include <deal.II/base/mutex.h>
 
+#include <array>
 #include <chrono>
+#include <cstdint>
 #include <list>
 #include <map>
 #include <string>
@@ -575,6 +577,20 @@ public:
     void
     stop();
 
+    /**
+     * Add @p n_flops floating point operations to the section this object
+     * measures. See TimerOutput::add_flops().
+     */
+    void
+    add_flops(const double n_flops);
+
+    /**
+     * Add @p n_bytes bytes of memory transfer to the section this object
+     * measures. See TimerOutput::add_memory_transfer().
+     */
+    void
+    add_memory_transfer(const double n_bytes);
+
   private:
     /**
      * Reference to the TimerOutput object
@@ -798,6 +814,75 @@ public:
   print_wall_time_statistics(const MPI_Comm &mpi_comm,
                              const double    print_quantile = 0.) const;
 
+  /**
+   * Start recording hardware performance counters for all sections entered
+   * from now on. On Linux, this uses the perf_event interface of the kernel
+   * to count CPU cycles, retired instructions, last-level cache references,
+   * and last-level cache misses of the calling thread and of all threads it
+   * creates after this call. Only user-space events are counted, so the
+   * default setting of <tt>/proc/sys/kernel/perf_event_paranoid</tt> on
+   * most systems suffices.
+   *
+   * Hardware counters cannot be enabled while a section is active. The
+   * function returns whether the counters could be opened; if not, for
+   * example on other operating systems, inside containers that do not expose
+   * the performance monitoring unit, or on virtual machines, the counter
+   * columns of print_hardware_counter_statistics() show zeros.
+   *
+   * Since there is no portable hardware event for floating point
+   * operations, the operation counts of a section need to be provided by the
+   * user with add_flops() or Scope::add_flops(). Similarly, the number of
+   * bytes transferred from and to memory can be specified with
+   * add_memory_transfer(); if no such information is given, the transfer is
+   * estimated as one cache line of 64 bytes per last-level cache miss.
+   */
+  bool
+  enable_hardware_counters();
+
+  /**
+   * Stop recording hardware performance counters and release the associated
+   * resources. The values collected so far are kept.
+   */
+  void
+  disable_hardware_counters();
+
+  /**
+   * Add @p n_flops floating point operations to the section named
+   * @p section_name, or to the last section that was entered if the name is
+   * empty. The section must exist. The operation counts are accumulated over
+   * all calls and are used by print_hardware_counter_statistics() to compute
+   * the achieved floating point throughput and the arithmetic intensity.
+   */
+  void
+  add_flops(const double n_flops, const std::string &section_name = "");
+
+  /**
+   * Add @p n_bytes bytes of memory transfer to the section named
+   * @p section_name, or to the last section that was entered if the name is
+   * empty. Once a value has been given for a section, it replaces the
+   * estimate from the last-level cache misses in
+   * print_hardware_counter_statistics().
+   */
+  void
+  add_memory_transfer(const double n_bytes,
+                      const std::string &section_name = "");
+
+  /**
+   * Print a formatted table that summarizes the floating point throughput,
+   * the memory bandwidth, the arithmetic intensity (floating point
+   * operations per byte), the instructions per cycle, and the last-level
+   * cache miss rate of the various sections. Throughput and bandwidth are
+   * given in terms of the minimum, average, and maximum over the MPI ranks
+   * in @p mpi_comm, the other quantities as averages. Together with the peak
+   * performance and memory bandwidth of the machine, this allows to place
+   * each section in a roofline model.
+   *
+   * As for print_wall_time_statistics(), the rates are only meaningful if
+   * the TimerOutput object is constructed without an MPI_Comm argument.
+   */
+  void
+  print_hardware_counter_statistics(const MPI_Comm &mpi_comm) const;
+
   /**
    * By calling this function, all output can be disabled. This function
    * together with enable_output() can be useful if one wants to control the
@@ -840,6 +925,13 @@ private:
    */
   Timer timer_all;
 
+  /**
+   * The number of hardware events recorded by enable_hardware_counters():
+   * CPU cycles, instructions, last-level cache references, and last-level
+   * cache misses, in this order.
+   */
+  static constexpr unsigned int n_hardware_counters = 4;
+
   /**
    * A structure that groups all information that we collect about each of the
    * sections.
@@ -850,6 +942,23 @@ private:
     double       total_cpu_time;
     double       total_wall_time;
     unsigned int n_calls;
+
+    /**
+     * The counter values at the time the section was last entered.
+     */
+    std::array<std::uint64_t, n_hardware_counters> counter_start_values;
+
+    /**
+     * The accumulated hardware counter values.
+     */
+    std::array<double, n_hardware_counters> total_counter_values;
+
+    /**
+     * The floating point operations and memory transfer reported with
+     * add_flops() and add_memory_transfer().
+     */
+    double total_flops;
+    double total_bytes;
   };
 
   /**
@@ -886,6 +995,20 @@ private:
    * used with several threads.
    */
   Threads::Mutex mutex;
+
+  /**
+   * File descriptors of the hardware counters opened by
+   * enable_hardware_counters(), or -1 if hardware counters are not in use.
+   */
+  std::array<int, n_hardware_counters> hardware_counter_fds;
+
+  /**
+   * Read the current values of the hardware counters into @p values. The
+   * values are zero for counters that are not in use.
+   */
+  void
+  read_hardware_counters(
+    std::array<std::uint64_t, n_hardware_counters> &values) const;
 };
 
 
@@ -964,6 +1087,24 @@ TimerOutput::Scope::stop()
 }
 
 
+
+inline void
+TimerOutput::Scope::add_flops(const double n_flops)
+{
+  Assert(in, ExcMessage("The section of this scope has already been left."));
+  timer.add_flops(n_flops, section_name);
+}
+
+
+
+inline void
+TimerOutput::Scope::add_memory_transfer(const double n_bytes)
+{
+  Assert(in, ExcMessage("The section of this scope has already been left."));
+  timer.add_memory_transfer(n_bytes, section_name);
+}
+
+
 DEAL_II_NAMESPACE_CLOSE
 
 #endif
@@ -0,0 +1,199 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+#ifndef dealii_tracing_h
+#define dealii_tracing_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/mpi_stub.h>
+
+#include <cstdint>
+#include <string>
+
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * A lightweight facility to record the begin and end of selected operations
+ * in the library and in user code, together with the MPI rank and the thread
+ * that executed them, and to write the result in the JSON based Chrome
+ * trace event format. The resulting file can be loaded into
+ * <tt>chrome://tracing</tt> or the <a href="https://ui.perfetto.dev">Perfetto
+ * UI</a>, which show a timeline with one row per thread, grouped by MPI
+ * rank. This makes it possible to see, for example, which rank is waiting
+ * in the ghost exchange of a vector while another one is still computing.
+ *
+ * Events are created by the macro DEAL_II_TRACE_SCOPE, which records the
+ * time between its position and the end of the enclosing scope. The macro
+ * is only active if deal.II is configured with
+ * <tt>-DDEAL_II_WITH_TRACING=ON</tt> and expands to nothing otherwise, so
+ * that the instrumentation has no cost in regular builds. With tracing
+ * compiled in, the library records events in
+ * - MatrixFree::cell_loop() and MatrixFree::loop(),
+ * - the ghost exchange functions of Utilities::MPI::Partitioner,
+ * - Multigrid::level_v_step(),
+ * - SolverCG::solve(),
+ * - WorkStream::run(), and
+ * - Triangulation::execute_coarsening_and_refinement().
+ *
+ * Recording only takes place between calls to Tracing::start() and
+ * Tracing::stop(); otherwise, a scope costs a single check of an atomic
+ * flag. Each thread appends its events to a buffer of its own, so no
+ * synchronization between threads is necessary while recording. A typical
+ * use looks like this:
+ * @code
+ *   Tracing::start();
+ *   {
+ *     DEAL_II_TRACE_SCOPE("assemble", "user");
+ *     assemble_system();
+ *   }
+ *   solve();
+ *   Tracing::stop();
+ *   Tracing::write_chrome_trace("trace.json", MPI_COMM_WORLD);
+ * @endcode
+ *
+ * The time stamps of different MPI ranks are taken from the system clock
+ * and are hence only comparable to the extent that the clocks of the nodes
+ * of a cluster are synchronized, which is typically the case to within a few
+ * microseconds.
+ *
+ * @ingroup utilities
+ */
+namespace Tracing
+{
+  /**
+   * Start recording events. Events that have been recorded previously are
+   * kept.
+   */
+  void
+  start();
+
+  /**
+   * Stop recording events.
+   */
+  void
+  stop();
+
+  /**
+   * Return whether events are currently being recorded.
+   */
+  bool
+  is_active();
+
+  /**
+   * Delete all recorded events. This function must not be called while
+   * other threads are inside a traced scope.
+   */
+  void
+  clear();
+
+  /**
+   * Return the number of events recorded on the present process.
+   */
+  std::size_t
+  n_events();
+
+  /**
+   * Collect the events of all processes in @p mpi_comm on rank zero and
+   * write them to the file @p filename in the Chrome trace event format.
+   * Each MPI rank is shown as a process and each thread as a thread of
+   * that process. This function is collective and should be called after
+   * stop(), when no thread is inside a traced scope anymore.
+   */
+  void
+  write_chrome_trace(const std::string &filename, const MPI_Comm &mpi_comm);
+
+  /**
+   * An object that records an event covering its lifetime. Use the macro
+   * DEAL_II_TRACE_SCOPE rather than this class directly, so that the
+   * instrumentation can be compiled out.
+   */
+  class Scope
+  {
+  public:
+    /**
+     * Constructor. Record the current time if tracing is active. The
+     * strings @p name and @p category are not copied and must hence stay
+     * alive until the events are written, which is the case for string
+     * literals.
+     */
+    Scope(const char *name, const char *category);
+
+    /**
+     * Destructor. Store the event if tracing was active when the object
+     * was created.
+     */
+    ~Scope();
+
+    /**
+     * Copying a scope is not allowed.
+     */
+    Scope(const Scope &) = delete;
+
+    /**
+     * Copying a scope is not allowed.
+     */
+    Scope &
+    operator=(const Scope &) = delete;
+
+  private:
+    /**
+     * The name of the event.
+     */
+    const char *name;
+
+    /**
+     * The category of the event.
+     */
+    const char *category;
+
+    /**
+     * The time in nanoseconds at which the event started, or -1 if tracing
+     * was not active at construction.
+     */
+    std::int64_t start_time;
+  };
+} // namespace Tracing
+
+DEAL_II_NAMESPACE_CLOSE
+
+
+/**
+ * Record an event named @p name in the category @p category that spans
+ * from the position of this macro to the end of the enclosing scope, see
+ * the namespace Tracing. Both arguments must be string literals. Unless
+ * deal.II is configured with <tt>DEAL_II_WITH_TRACING</tt>, this macro
+ * expands to nothing.
+ *
+ * @ingroup utilities
+ */
+#ifdef DEAL_II_WITH_TRACING
+#  define DEAL_II_TRACE_SCOPE(name, category) \
+    DEAL_II_TRACE_SCOPE_HELPER(name, category, __LINE__)
+#  define DEAL_II_TRACE_SCOPE_HELPER(name, category, line) \
+    DEAL_II_TRACE_SCOPE_HELPER2(name, category, line)
+#  define DEAL_II_TRACE_SCOPE_HELPER2(name, category, line) \
+    const ::dealii::Tracing::Scope dealii_trace_scope_##line(name, category)
+#else
+#  define DEAL_II_TRACE_SCOPE(name, category) \
+    do                                        \
+      {                                       \
+      }                                       \
+    while (false)
+#endif
+
+#endif
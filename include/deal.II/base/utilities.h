@@ -21,7 +21,9 @@
 #include <deal.II/base/exceptions.h>
 
 #include <cstddef>
+#include <cstring>
 #include <functional>
+#include <initializer_list>
 #include <string>
 #include <tuple>
 #include <type_traits>
@@ -572,6 +574,13 @@ namespace Utilities
    *   followed by a bit-by-bit copy of the contents of the vector. A
    *   similar process is used for vectors of vectors of objects whose type
    *   `T` satisfies `std::is_trivially_copyable`.
+   * - If the object is a `std::pair` or `std::tuple` whose elements satisfy
+   *   `std::is_trivially_copyable` or are again such pairs or tuples, then
+   *   the elements are copied bit by bit into the output buffer one after
+   *   the other, whether or not compression is requested. If no compression
+   *   is requested, the same is done for such objects that are larger than
+   *   256 bytes and for the elements of vectors of pairs and tuples, after
+   *   copying the length of the vector into the output buffer.
    * - Finally, if the type `T` of the object to be packed is std::tuple<>
    *   (i.e., a tuple without any elements as indicated by the empty argument
    *   list) and if no compression is requested, then this
@@ -956,6 +965,147 @@ namespace Utilities
      */
     void
     posix_memalign(void **memptr, std::size_t alignment, std::size_t size);
+
+    /**
+     * A structure that describes how allocate_aligned() obtains large blocks
+     * of memory, i.e., blocks of at least #huge_page_size bytes. Smaller
+     * blocks are always allocated with posix_memalign().
+     */
+    struct MemoryAllocationPolicy
+    {
+      /**
+       * Align large blocks to #huge_page_size, round their size up to a
+       * multiple of it, and advise the operating system to back them with
+       * transparent huge pages.
+       */
+      bool use_transparent_huge_pages = false;
+
+      /**
+       * Try to map large blocks from the explicit huge page pool of the
+       * operating system (`MAP_HUGETLB` on Linux), which must have been
+       * reserved by the administrator. If this fails, the blocks are
+       * allocated as if only #use_transparent_huge_pages were set.
+       */
+      bool use_explicit_huge_pages = false;
+
+      /**
+       * Keep large blocks released by free_aligned() in a pool and reuse them
+       * for later allocations of a similar size instead of returning them to
+       * the operating system. This avoids the cost of page faults when
+       * vectors are repeatedly reinitialized, e.g., after mesh refinement.
+       */
+      bool use_memory_pool = false;
+
+      /**
+       * The size of a huge page, and the minimal size of the blocks that are
+       * subject to this policy.
+       */
+      std::size_t huge_page_size = 2097152;
+
+      /**
+       * The maximal number of bytes kept in the pool. Blocks released beyond
+       * this limit are returned to the operating system.
+       */
+      std::size_t max_pool_size = static_cast<std::size_t>(-1);
+    };
+
+    /**
+     * Set the policy used by allocate_aligned() for future allocations.
+     * Blocks allocated before remain valid and are released according to the
+     * policy in place when they were allocated. This function must not be
+     * called concurrently with allocate_aligned().
+     */
+    void
+    set_memory_allocation_policy(const MemoryAllocationPolicy &policy);
+
+    /**
+     * Return the policy set by set_memory_allocation_policy().
+     */
+    const MemoryAllocationPolicy &
+    get_memory_allocation_policy();
+
+    /**
+     * Allocate @p size bytes of memory aligned to at least @p alignment bytes
+     * according to the policy set by set_memory_allocation_policy(). This
+     * function is used by AlignedVector and
+     * LinearAlgebra::distributed::Vector. The memory must be released with
+     * free_aligned().
+     *
+     * The @p size of all blocks allocated by this function and not yet
+     * released is accounted for in the numbers returned by
+     * get_aligned_memory_statistics().
+     */
+    void *
+    allocate_aligned(const std::size_t size, const std::size_t alignment = 64);
+
+    /**
+     * Release memory obtained from allocate_aligned(), possibly by keeping it
+     * in the memory pool. Passing a null pointer is allowed and does nothing.
+     * The argument @p size must be the size passed to allocate_aligned() for
+     * this block of memory.
+     */
+    void
+    free_aligned(void *ptr, const std::size_t size);
+
+    /**
+     * A structure that describes the memory obtained from allocate_aligned()
+     * on the current process, see get_aligned_memory_statistics().
+     */
+    struct AlignedMemoryStatistics
+    {
+      /**
+       * The number of bytes allocated by allocate_aligned() and not yet
+       * released by free_aligned().
+       */
+      std::size_t bytes_in_use;
+
+      /**
+       * The largest value #bytes_in_use has had since the start of the
+       * program or the last call to reset_aligned_memory_peak().
+       */
+      std::size_t peak_bytes_in_use;
+
+      /**
+       * The number of blocks allocated by allocate_aligned() and not yet
+       * released by free_aligned().
+       */
+      std::size_t n_blocks_in_use;
+    };
+
+    /**
+     * Return the statistics of the memory obtained from allocate_aligned().
+     * Since all memory of AlignedVector, and thus of Table, FullMatrix, and
+     * the data structures of MatrixFree, as well as the local elements of
+     * LinearAlgebra::distributed::Vector is obtained through this function,
+     * this gives the high-water mark of the memory used by these classes,
+     * including short-lived temporary objects that a snapshot of their
+     * memory_consumption() would miss. The memory held by the memory pool
+     * (see MemoryAllocationPolicy::use_memory_pool) is not part of these
+     * numbers.
+     */
+    AlignedMemoryStatistics
+    get_aligned_memory_statistics();
+
+    /**
+     * Set the peak memory usage reported by get_aligned_memory_statistics()
+     * to the memory currently in use, e.g., to measure the peak of a single
+     * phase of a program.
+     */
+    void
+    reset_aligned_memory_peak();
+
+    /**
+     * Return all blocks currently held by the memory pool to the operating
+     * system.
+     */
+    void
+    release_memory_pool();
+
+    /**
+     * Return the number of bytes currently held by the memory pool.
+     */
+    std::size_t
+    memory_pool_size();
   } // namespace System
 } // namespace Utilities
 
@@ -1325,6 +1475,285 @@ namespace Utilities
              ExcMessage("The given buffer has the wrong size."));
     }
 
+
+
+    /**
+     * Return whether all of the given values are true.
+     */
+    constexpr bool
+    all_true(const std::initializer_list<bool> values)
+    {
+      for (const bool value : values)
+        if (!value)
+          return false;
+      return true;
+    }
+
+
+
+    /**
+     * Return the sum of the given values.
+     */
+    constexpr std::size_t
+    sum_of(const std::initializer_list<std::size_t> values)
+    {
+      std::size_t result = 0;
+      for (const std::size_t value : values)
+        result += value;
+      return result;
+    }
+
+
+
+    /**
+     * A structure that is used to identify whether an object of type T has a
+     * fixed size and can be copied bit by bit, element by element, into a
+     * character array, i.e., whether T satisfies
+     * std::is_trivially_copyable<T>::value == true or is a std::pair or
+     * std::tuple whose elements are such types. If so, the structure provides
+     * the size of the packed object and functions to write the object into
+     * and read it from a character array.
+     */
+    template <typename T, typename = void>
+    struct FixedSizePacking
+    {
+      static constexpr bool        value = false;
+      static constexpr std::size_t size  = 0;
+
+      static void
+      write(const T &, char *)
+      {
+        // We shouldn't get here:
+        Assert(false, ExcInternalError());
+      }
+
+      static void
+      read(const char *, T &)
+      {
+        // We shouldn't get here:
+        Assert(false, ExcInternalError());
+      }
+    };
+
+
+
+    template <typename T>
+    struct FixedSizePacking<
+      T,
+      std::enable_if_t<std::is_trivially_copyable<T>::value>>
+    {
+      static constexpr bool        value = true;
+      static constexpr std::size_t size  = sizeof(T);
+
+      static void
+      write(const T &object, char *dest)
+      {
+        std::memcpy(dest, &object, sizeof(T));
+      }
+
+      static void
+      read(const char *source, T &object)
+      {
+        std::memcpy(&object, source, sizeof(T));
+      }
+    };
+
+
+
+    template <typename A, typename B>
+    struct FixedSizePacking<
+      std::pair<A, B>,
+      std::enable_if_t<!std::is_trivially_copyable<std::pair<A, B>>::value &&
+                       FixedSizePacking<A>::value &&
+                       FixedSizePacking<B>::value>>
+    {
+      static constexpr bool        value = true;
+      static constexpr std::size_t size =
+        FixedSizePacking<A>::size + FixedSizePacking<B>::size;
+
+      static void
+      write(const std::pair<A, B> &object, char *dest)
+      {
+        FixedSizePacking<A>::write(object.first, dest);
+        FixedSizePacking<B>::write(object.second,
+                                   dest + FixedSizePacking<A>::size);
+      }
+
+      static void
+      read(const char *source, std::pair<A, B> &object)
+      {
+        FixedSizePacking<A>::read(source, object.first);
+        FixedSizePacking<B>::read(source + FixedSizePacking<A>::size,
+                                  object.second);
+      }
+    };
+
+
+
+    template <typename... Ts>
+    struct FixedSizePacking<
+      std::tuple<Ts...>,
+      std::enable_if_t<!std::is_trivially_copyable<std::tuple<Ts...>>::value &&
+                       all_true({FixedSizePacking<Ts>::value...})>>
+    {
+      static constexpr bool        value = true;
+      static constexpr std::size_t size =
+        sum_of({std::size_t(0), FixedSizePacking<Ts>::size...});
+
+      static void
+      write(const std::tuple<Ts...> &object, char *dest)
+      {
+        write(object, dest, std::index_sequence_for<Ts...>());
+      }
+
+      static void
+      read(const char *source, std::tuple<Ts...> &object)
+      {
+        read(source, object, std::index_sequence_for<Ts...>());
+      }
+
+    private:
+      template <std::size_t... indices>
+      static void
+      write(const std::tuple<Ts...> &object,
+            char *                   dest,
+            std::index_sequence<indices...>)
+      {
+        // The elements of a braced initializer list are evaluated in order
+        const int dummy[] = {
+          0,
+          (FixedSizePacking<Ts>::write(std::get<indices>(object), dest),
+           dest += FixedSizePacking<Ts>::size,
+           0)...};
+        (void)dummy;
+      }
+
+      template <std::size_t... indices>
+      static void
+      read(const char *source,
+           std::tuple<Ts...> &object,
+           std::index_sequence<indices...>)
+      {
+        const int dummy[] = {
+          0,
+          (FixedSizePacking<Ts>::read(source, std::get<indices>(object)),
+           source += FixedSizePacking<Ts>::size,
+           0)...};
+        (void)dummy;
+      }
+    };
+
+
+
+    /**
+     * A structure that is used to identify whether a template argument is a
+     * std::vector<T> where T is a std::pair or std::tuple for which
+     * FixedSizePacking<T>::value == true. (Vectors of types that satisfy
+     * std::is_trivially_copyable are handled by
+     * IsVectorOfTriviallyCopyable.)
+     */
+    template <typename T>
+    struct IsVectorOfFixedSizeAggregates
+    {
+      static constexpr bool value = false;
+    };
+
+
+
+    template <typename T>
+    struct IsVectorOfFixedSizeAggregates<std::vector<T>>
+    {
+      static constexpr bool value =
+        FixedSizePacking<T>::value && !std::is_trivially_copyable<T>::value;
+    };
+
+
+
+    /**
+     * Append the length of a vector for which
+     * IsVectorOfFixedSizeAggregates is true, followed by its elements packed
+     * with FixedSizePacking, to a character array.
+     *
+     * If the type is not such a vector, then the function throws an
+     * exception.
+     */
+    template <typename T>
+    inline void
+    append_vector_of_fixed_size_aggregates_to_buffer(const T &,
+                                                     std::vector<char> &)
+    {
+      // We shouldn't get here:
+      Assert(false, ExcInternalError());
+    }
+
+
+
+    template <typename T,
+              typename = std::enable_if_t<
+                IsVectorOfFixedSizeAggregates<std::vector<T>>::value>>
+    inline void
+    append_vector_of_fixed_size_aggregates_to_buffer(
+      const std::vector<T> &object,
+      std::vector<char> &   dest_buffer)
+    {
+      const typename std::vector<T>::size_type vector_size = object.size();
+
+      const std::size_t previous_size = dest_buffer.size();
+      dest_buffer.resize(previous_size + sizeof(vector_size) +
+                         vector_size * FixedSizePacking<T>::size);
+
+      char *dest = dest_buffer.data() + previous_size;
+      std::memcpy(dest, &vector_size, sizeof(vector_size));
+      dest += sizeof(vector_size);
+      for (const T &element : object)
+        {
+          FixedSizePacking<T>::write(element, dest);
+          dest += FixedSizePacking<T>::size;
+        }
+    }
+
+
+
+    template <typename T>
+    inline void
+    create_vector_of_fixed_size_aggregates_from_buffer(
+      const std::vector<char>::const_iterator &,
+      const std::vector<char>::const_iterator &,
+      T &)
+    {
+      // We shouldn't get here:
+      Assert(false, ExcInternalError());
+    }
+
+
+
+    template <typename T,
+              typename = std::enable_if_t<
+                IsVectorOfFixedSizeAggregates<std::vector<T>>::value>>
+    inline void
+    create_vector_of_fixed_size_aggregates_from_buffer(
+      const std::vector<char>::const_iterator &cbegin,
+      const std::vector<char>::const_iterator &cend,
+      std::vector<T> &                         object)
+    {
+      typename std::vector<T>::size_type vector_size;
+      memcpy(&vector_size, &*cbegin, sizeof(vector_size));
+
+      Assert(static_cast<std::ptrdiff_t>(cend - cbegin) ==
+               static_cast<std::ptrdiff_t>(sizeof(vector_size) +
+                                           vector_size *
+                                             FixedSizePacking<T>::size),
+             ExcMessage("The given buffer has the wrong size."));
+      (void)cend;
+
+      object.resize(vector_size);
+      const char *source = &*cbegin + sizeof(vector_size);
+      for (T &element : object)
+        {
+          FixedSizePacking<T>::read(source, element);
+          source += FixedSizePacking<T>::size;
+        }
+    }
   } // namespace internal
 
 
@@ -1381,6 +1810,34 @@ namespace Utilities
 
         size = dest_buffer.size() - previous_size;
       }
+    // Next try if the object has a fixed size and consists of trivially
+    // copyable elements, such as std::pair<unsigned int, double>. Such
+    // objects are copied element by element into the output buffer. For
+    // trivially copyable objects that are too large for the first case, this
+    // is only done if we are not asked to compress the data.
+    else if (internal::FixedSizePacking<T>::value &&
+             (!std::is_trivially_copyable<T>::value ||
+              (allow_compression == false)))
+      {
+        size                            = internal::FixedSizePacking<T>::size;
+        const std::size_t previous_size = dest_buffer.size();
+        dest_buffer.resize(previous_size + size);
+
+        if (size > 0)
+          internal::FixedSizePacking<T>::write(object,
+                                               dest_buffer.data() +
+                                                 previous_size);
+      }
+    // The same for vectors of such objects, assuming that we are not asked
+    // to compress the data.
+    else if (internal::IsVectorOfFixedSizeAggregates<T>::value &&
+             (allow_compression == false))
+      {
+        const std::size_t previous_size = dest_buffer.size();
+        internal::append_vector_of_fixed_size_aggregates_to_buffer(
+          object, dest_buffer);
+        size = dest_buffer.size() - previous_size;
+      }
     else
       {
         // use buffer as the target of a compressing
@@ -1471,6 +1928,32 @@ namespace Utilities
                                                                   object);
         return object;
       }
+    // Objects of fixed size consisting of trivially copyable elements, see
+    // pack()
+    else if (internal::FixedSizePacking<T>::value &&
+             (!std::is_trivially_copyable<T>::value ||
+              (allow_compression == false)))
+      {
+        const std::size_t size = internal::FixedSizePacking<T>::size;
+
+        T object;
+        Assert(static_cast<std::size_t>(std::distance(cbegin, cend)) == size,
+               ExcMessage("The given buffer has the wrong size."));
+
+        if (size > 0)
+          internal::FixedSizePacking<T>::read(&*cbegin, object);
+
+        return object;
+      }
+    else if (internal::IsVectorOfFixedSizeAggregates<T>::value &&
+             (allow_compression == false))
+      {
+        T object;
+        internal::create_vector_of_fixed_size_aggregates_from_buffer(cbegin,
+                                                                     cend,
+                                                                     object);
+        return object;
+      }
     else
       {
         // decompress the buffer section into the object
@@ -26,6 +26,7 @@
 #  include <deal.II/base/template_constraints.h>
 #  include <deal.II/base/thread_local_storage.h>
 #  include <deal.II/base/thread_management.h>
+#  include <deal.II/base/tracing.h>
 
 #  ifdef DEAL_II_WITH_TBB
 DEAL_II_DISABLE_EXTRA_DIAGNOSTICS
@@ -37,9 +38,19 @@ DEAL_II_DISABLE_EXTRA_DIAGNOSTICS
 DEAL_II_ENABLE_EXTRA_DIAGNOSTICS
 #  endif
 
+#  ifdef DEAL_II_WITH_TASKFLOW
+DEAL_II_DISABLE_EXTRA_DIAGNOSTICS
+#    include <taskflow/taskflow.hpp>
+DEAL_II_ENABLE_EXTRA_DIAGNOSTICS
+#  endif
+
+#  include <algorithm>
+#  include <chrono>
 #  include <functional>
 #  include <iterator>
+#  include <list>
 #  include <memory>
+#  include <mutex>
 #  include <utility>
 #  include <vector>
 
@@ -161,6 +172,32 @@ DEAL_II_NAMESPACE_OPEN
  */
 namespace WorkStream
 {
+  /**
+   * A structure that collects information about the time spent in the copier
+   * stage of WorkStream::run_with_concurrent_copiers().
+   */
+  struct CopierStatistics
+  {
+    /**
+     * The number of chunks of items that were processed.
+     */
+    unsigned int n_chunks = 0;
+
+    /**
+     * The wall time, in seconds and summed over all chunks, that the tasks
+     * spent waiting for the locks that protect the copier.
+     */
+    double wait_time = 0.;
+
+    /**
+     * The wall time, in seconds and summed over all chunks, spent in the
+     * copier.
+     */
+    double copy_time = 0.;
+  };
+
+
+
   /**
    * The nested namespaces contain various implementations of the workstream
    * algorithms.
@@ -1000,6 +1037,426 @@ namespace WorkStream
 #  endif // DEAL_II_WITH_TBB
 
 
+
+    /**
+     * A namespace for the implementation of
+     * WorkStream::run_with_concurrent_copiers(). The items are split into
+     * chunks that are processed as independent tasks. Each task runs the
+     * worker on all items of its chunk and then the copier on the resulting
+     * copy data objects. Rather than serializing all copiers, the copier of a
+     * chunk only acquires the locks associated with the conflict indices of
+     * its items, so that copiers of chunks writing to disjoint sets of
+     * indices can run concurrently.
+     */
+    namespace concurrent_copiers
+    {
+      /**
+       * The number of locks the conflict indices are mapped to.
+       */
+      constexpr unsigned int n_locks = 1024;
+
+
+
+      /**
+       * A structure holding the scratch data object, the copy data objects of
+       * one chunk, and the locks needed by the chunk, along with a flag that
+       * indicates whether this object is currently in use.
+       */
+      template <typename ScratchData, typename CopyData>
+      struct ChunkData
+      {
+        ChunkData(const ScratchData &sample_scratch_data)
+          : scratch_data(std::make_unique<ScratchData>(sample_scratch_data))
+          , currently_in_use(false)
+        {}
+
+        // Provide a copy constructor that does not copy the internal state,
+        // like ScratchAndCopyDataObjects above.
+        ChunkData(const ChunkData &)
+          : currently_in_use(false)
+        {}
+
+        std::unique_ptr<ScratchData> scratch_data;
+        std::vector<CopyData>        copy_data;
+        std::vector<unsigned int>    lock_indices;
+        bool                         currently_in_use;
+      };
+
+
+
+      /**
+       * A class that runs the worker and the copier on one chunk of items at
+       * a time and collects the time spent waiting for the copier locks.
+       */
+      template <typename Iterator, typename ScratchData, typename CopyData>
+      class ChunkProcessor
+      {
+      public:
+        /**
+         * Constructor.
+         */
+        ChunkProcessor(
+          const std::vector<Iterator> &items,
+          const std::function<void(const Iterator &, ScratchData &, CopyData &)>
+            &                                          worker,
+          const std::function<void(const CopyData &)> &copier,
+          const std::function<std::vector<types::global_dof_index>(
+            const Iterator &)> &                       get_conflict_indices,
+          const ScratchData &                          sample_scratch_data,
+          const CopyData &                             sample_copy_data,
+          const unsigned int                           chunk_size)
+          : items(items)
+          , worker(worker)
+          , copier(copier)
+          , get_conflict_indices(get_conflict_indices)
+          , sample_scratch_data(sample_scratch_data)
+          , sample_copy_data(sample_copy_data)
+          , chunk_size(chunk_size)
+          , locks(n_locks)
+        {}
+
+        /**
+         * Return the number of chunks the items are split into.
+         */
+        unsigned int
+        n_chunks() const
+        {
+          return (items.size() + chunk_size - 1) / chunk_size;
+        }
+
+        /**
+         * Run the worker and the copier on the items of chunk @p chunk.
+         */
+        void
+        operator()(const unsigned int chunk)
+        {
+          AssertIndexRange(chunk, n_chunks());
+
+          // get an unused object from the thread-local list, see the
+          // discussion in tbb_colored::WorkerAndCopier
+          ChunkData<ScratchData, CopyData> *chunk_data = nullptr;
+          {
+            ChunkDataList &list = data.get();
+            for (auto &entry : list)
+              if (entry.currently_in_use == false)
+                {
+                  chunk_data = &entry;
+                  break;
+                }
+            if (chunk_data == nullptr)
+              {
+                list.emplace_back(sample_scratch_data);
+                chunk_data = &list.back();
+              }
+            chunk_data->currently_in_use = true;
+          }
+
+          const std::size_t begin = std::size_t(chunk) * chunk_size;
+          const std::size_t end = std::min(begin + chunk_size, items.size());
+          if (chunk_data->copy_data.size() < end - begin)
+            chunk_data->copy_data.resize(end - begin, sample_copy_data);
+
+          std::vector<unsigned int> &lock_indices = chunk_data->lock_indices;
+          lock_indices.clear();
+          for (std::size_t i = begin; i < end; ++i)
+            {
+              try
+                {
+                  if (worker)
+                    worker(items[i],
+                           *chunk_data->scratch_data,
+                           chunk_data->copy_data[i - begin]);
+                  if (copier && get_conflict_indices)
+                    for (const types::global_dof_index index :
+                         get_conflict_indices(items[i]))
+                      lock_indices.push_back(index % n_locks);
+                }
+              catch (const std::exception &exc)
+                {
+                  Threads::internal::handle_std_exception(exc);
+                }
+              catch (...)
+                {
+                  Threads::internal::handle_unknown_exception();
+                }
+            }
+
+          if (copier)
+            {
+              // without conflict information, all copiers share one lock
+              if (!get_conflict_indices)
+                lock_indices.push_back(0);
+              std::sort(lock_indices.begin(), lock_indices.end());
+              lock_indices.erase(std::unique(lock_indices.begin(),
+                                             lock_indices.end()),
+                                 lock_indices.end());
+
+              // acquiring the locks in ascending order avoids deadlocks
+              const auto time_0 = std::chrono::steady_clock::now();
+              for (const unsigned int l : lock_indices)
+                locks[l].lock();
+              const auto time_1 = std::chrono::steady_clock::now();
+
+              for (std::size_t i = begin; i < end; ++i)
+                try
+                  {
+                    copier(chunk_data->copy_data[i - begin]);
+                  }
+                catch (const std::exception &exc)
+                  {
+                    Threads::internal::handle_std_exception(exc);
+                  }
+                catch (...)
+                  {
+                    Threads::internal::handle_unknown_exception();
+                  }
+
+              const auto time_2 = std::chrono::steady_clock::now();
+              for (auto l = lock_indices.rbegin(); l != lock_indices.rend();
+                   ++l)
+                locks[*l].unlock();
+
+              std::lock_guard<std::mutex> lock(statistics_mutex);
+              statistics.wait_time +=
+                std::chrono::duration<double>(time_1 - time_0).count();
+              statistics.copy_time +=
+                std::chrono::duration<double>(time_2 - time_1).count();
+            }
+
+          {
+            std::lock_guard<std::mutex> lock(statistics_mutex);
+            ++statistics.n_chunks;
+          }
+
+          chunk_data->currently_in_use = false;
+        }
+
+        /**
+         * Return the statistics collected so far.
+         */
+        CopierStatistics
+        get_statistics() const
+        {
+          return statistics;
+        }
+
+      private:
+        using ChunkDataList = std::list<ChunkData<ScratchData, CopyData>>;
+
+        const std::vector<Iterator> &items;
+
+        const std::function<void(const Iterator &, ScratchData &, CopyData &)>
+          worker;
+
+        const std::function<void(const CopyData &)> copier;
+
+        const std::function<std::vector<types::global_dof_index>(
+          const Iterator &)>
+          get_conflict_indices;
+
+        const ScratchData &sample_scratch_data;
+        const CopyData &   sample_copy_data;
+
+        const unsigned int chunk_size;
+
+        /**
+         * Thread-local scratch and copy data objects.
+         */
+        Threads::ThreadLocalStorage<ChunkDataList> data;
+
+        /**
+         * The locks protecting the copier, indexed by the conflict indices
+         * modulo n_locks.
+         */
+        std::vector<std::mutex> locks;
+
+        std::mutex       statistics_mutex;
+        CopierStatistics statistics;
+      };
+    } // namespace concurrent_copiers
+
+
+
+#  ifdef DEAL_II_WITH_TASKFLOW
+    /**
+     * A namespace for the implementation of the WorkStream pattern on top of
+     * the taskflow executor returned by
+     * MultithreadInfo::get_taskflow_executor(), used if the taskflow backend
+     * is selected by MultithreadInfo::set_task_backend().
+     */
+    namespace taskflow_no_coloring
+    {
+      /**
+       * The items are processed in windows of @p queue_length chunks of
+       * @p chunk_size items. Within a window, the workers of all chunks run
+       * concurrently, while the copier of a chunk runs after its worker and
+       * after the copier of the previous chunk, i.e., the copier is called
+       * in the order of the items like in the TBB implementation. The
+       * windows bound the memory to @p queue_length scratch data objects
+       * and <code>queue_length*chunk_size</code> copy data objects.
+       */
+      template <typename Worker,
+                typename Copier,
+                typename Iterator,
+                typename ScratchData,
+                typename CopyData>
+      void
+      run(const Iterator &                         begin,
+          const typename identity<Iterator>::type &end,
+          Worker                                   worker,
+          Copier                                   copier,
+          const ScratchData &                      sample_scratch_data,
+          const CopyData &                         sample_copy_data,
+          const unsigned int                       queue_length,
+          const unsigned int                       chunk_size)
+      {
+        const bool have_worker =
+          (static_cast<const std::function<
+             void(const Iterator &, ScratchData &, CopyData &)> &>(worker)) !=
+          nullptr;
+        const bool have_copier =
+          (static_cast<const std::function<void(const CopyData &)> &>(
+            copier)) != nullptr;
+
+        std::vector<std::unique_ptr<ScratchData>> scratch_data(queue_length);
+        std::vector<std::vector<CopyData>>        copy_data(queue_length);
+        std::vector<Iterator>                     items;
+        items.reserve(queue_length * chunk_size);
+
+        tf::Executor &executor = MultithreadInfo::get_taskflow_executor();
+        Iterator      current  = begin;
+        while (current != end)
+          {
+            items.clear();
+            while (current != end && items.size() < queue_length * chunk_size)
+              {
+                items.push_back(current);
+                ++current;
+              }
+
+            tf::Taskflow taskflow;
+            tf::Task     previous_copier;
+            for (unsigned int c = 0; c * chunk_size < items.size(); ++c)
+              {
+                const std::size_t first = c * chunk_size;
+                const std::size_t last =
+                  std::min<std::size_t>(first + chunk_size, items.size());
+                if (scratch_data[c] == nullptr)
+                  {
+                    scratch_data[c] =
+                      std::make_unique<ScratchData>(sample_scratch_data);
+                    copy_data[c].resize(chunk_size, sample_copy_data);
+                  }
+
+                tf::Task work = taskflow.emplace([&, c, first, last]() {
+                  for (std::size_t i = first; i < last; ++i)
+                    try
+                      {
+                        if (have_worker)
+                          worker(items[i],
+                                 *scratch_data[c],
+                                 copy_data[c][i - first]);
+                      }
+                    catch (const std::exception &exc)
+                      {
+                        Threads::internal::handle_std_exception(exc);
+                      }
+                    catch (...)
+                      {
+                        Threads::internal::handle_unknown_exception();
+                      }
+                });
+
+                if (have_copier)
+                  {
+                    tf::Task copy = taskflow.emplace([&, c, first, last]() {
+                      for (std::size_t i = first; i < last; ++i)
+                        try
+                          {
+                            copier(copy_data[c][i - first]);
+                          }
+                        catch (const std::exception &exc)
+                          {
+                            Threads::internal::handle_std_exception(exc);
+                          }
+                        catch (...)
+                          {
+                            Threads::internal::handle_unknown_exception();
+                          }
+                    });
+                    work.precede(copy);
+                    if (c > 0)
+                      previous_copier.precede(copy);
+                    previous_copier = copy;
+                  }
+              }
+            executor.run(taskflow).wait();
+          }
+      }
+    } // namespace taskflow_no_coloring
+
+
+
+    namespace taskflow_colored
+    {
+      /**
+       * Run the items of one color after the other. Since the copiers of
+       * items of the same color do not conflict, the items of a color are
+       * split into subranges that are worked on concurrently, each with its
+       * own scratch and copy data objects.
+       */
+      template <typename Worker,
+                typename Copier,
+                typename Iterator,
+                typename ScratchData,
+                typename CopyData>
+      void
+      run(const std::vector<std::vector<Iterator>> &colored_iterators,
+          Worker                                    worker,
+          Copier                                    copier,
+          const ScratchData &                       sample_scratch_data,
+          const CopyData &                          sample_copy_data,
+          const unsigned int                        chunk_size)
+      {
+        const bool have_worker =
+          (static_cast<const std::function<
+             void(const Iterator &, ScratchData &, CopyData &)> &>(worker)) !=
+          nullptr;
+        const bool have_copier =
+          (static_cast<const std::function<void(const CopyData &)> &>(
+            copier)) != nullptr;
+
+        using ItemIterator = typename std::vector<Iterator>::const_iterator;
+        for (const std::vector<Iterator> &items : colored_iterators)
+          parallel::internal::parallel_for_subranges(
+            items.cbegin(),
+            items.cend(),
+            [&](const ItemIterator &first, const ItemIterator &last) {
+              ScratchData scratch_data = sample_scratch_data;
+              CopyData    copy_data    = sample_copy_data; // NOLINT
+              for (ItemIterator p = first; p != last; ++p)
+                try
+                  {
+                    if (have_worker)
+                      worker(*p, scratch_data, copy_data);
+                    if (have_copier)
+                      copier(copy_data);
+                  }
+                catch (const std::exception &exc)
+                  {
+                    Threads::internal::handle_std_exception(exc);
+                  }
+                catch (...)
+                  {
+                    Threads::internal::handle_unknown_exception();
+                  }
+            },
+            chunk_size);
+      }
+    } // namespace taskflow_colored
+#  endif // DEAL_II_WITH_TASKFLOW
+
+
   } // namespace internal
 
 
@@ -1130,6 +1587,8 @@ namespace WorkStream
       const unsigned int queue_length = 2 * MultithreadInfo::n_threads(),
       const unsigned int chunk_size   = 8)
   {
+    DEAL_II_TRACE_SCOPE("WorkStream::run", "workstream");
+
     Assert(queue_length > 0,
            ExcMessage("The queue length must be at least one, and preferably "
                       "larger than the number of processors on this system."));
@@ -1142,7 +1601,9 @@ namespace WorkStream
     if (!(begin != end))
       return;
 
-    if (MultithreadInfo::n_threads() > 1)
+    if (MultithreadInfo::n_threads() > 1 &&
+        MultithreadInfo::get_task_backend() ==
+          MultithreadInfo::TaskBackend::tbb)
       {
 #  ifdef DEAL_II_WITH_TBB
         if (static_cast<const std::function<void(const CopyData &)> &>(copier))
@@ -1191,6 +1652,24 @@ namespace WorkStream
 #  endif
       }
 
+#  ifdef DEAL_II_WITH_TASKFLOW
+    if (MultithreadInfo::n_threads() > 1 &&
+        MultithreadInfo::get_task_backend() ==
+          MultithreadInfo::TaskBackend::taskflow &&
+        MultithreadInfo::get_taskflow_executor().this_worker_id() < 0)
+      {
+        internal::taskflow_no_coloring::run(begin,
+                                            end,
+                                            worker,
+                                            copier,
+                                            sample_scratch_data,
+                                            sample_copy_data,
+                                            queue_length,
+                                            chunk_size);
+        return;
+      }
+#  endif
+
     // no TBB installed or we are requested to run sequentially:
     internal::sequential::run(
       begin, end, worker, copier, sample_scratch_data, sample_copy_data);
@@ -1277,6 +1756,8 @@ namespace WorkStream
       const unsigned int                        queue_length,
       const unsigned int                        chunk_size)
   {
+    DEAL_II_TRACE_SCOPE("WorkStream::run", "workstream");
+
     Assert(queue_length > 0,
            ExcMessage("The queue length must be at least one, and preferably "
                       "larger than the number of processors on this system."));
@@ -1285,7 +1766,9 @@ namespace WorkStream
     (void)chunk_size; // removes -Wunused-parameter warning in optimized mode
 
 
-    if (MultithreadInfo::n_threads() > 1)
+    if (MultithreadInfo::n_threads() > 1 &&
+        MultithreadInfo::get_task_backend() ==
+          MultithreadInfo::TaskBackend::tbb)
       {
 #  ifdef DEAL_II_WITH_TBB
         internal::tbb_colored::run(colored_iterators,
@@ -1300,6 +1783,22 @@ namespace WorkStream
 #  endif
       }
 
+#  ifdef DEAL_II_WITH_TASKFLOW
+    if (MultithreadInfo::n_threads() > 1 &&
+        MultithreadInfo::get_task_backend() ==
+          MultithreadInfo::TaskBackend::taskflow &&
+        MultithreadInfo::get_taskflow_executor().this_worker_id() < 0)
+      {
+        internal::taskflow_colored::run(colored_iterators,
+                                        worker,
+                                        copier,
+                                        sample_scratch_data,
+                                        sample_copy_data,
+                                        chunk_size);
+        return;
+      }
+#  endif
+
     // run all colors sequentially:
     {
       internal::sequential::run(colored_iterators,
@@ -1312,6 +1811,101 @@ namespace WorkStream
 
 
 
+  /**
+   * A variant of the run() function above that does not serialize the
+   * copier. The items in the range <code>[begin,end)</code> are split into
+   * chunks of @p chunk_size items. If the taskflow backend is selected by
+   * MultithreadInfo::set_task_backend(), each chunk is an independent task
+   * on the executor returned by MultithreadInfo::get_taskflow_executor(),
+   * whose idle threads steal tasks from busy ones. Otherwise, the chunks are
+   * distributed by parallel::apply_to_subranges().
+   *
+   * Each task first runs the @p worker on all items of its chunk and then
+   * the @p copier on the resulting copy data objects. Before doing so, the
+   * task acquires one lock for each of the indices returned by
+   * @p get_conflict_indices for the items of the chunk, e.g., the global
+   * DoF indices of a cell as returned by
+   * DoFCellAccessor::get_dof_indices(). Since the indices are mapped to a
+   * fixed number of locks, chunks whose copiers write into disjoint rows of
+   * a matrix or disjoint entries of a vector can usually copy their data
+   * concurrently. If @p get_conflict_indices is an empty function object,
+   * all copiers are protected by the same lock.
+   *
+   * In contrast to run(), the copier is not called in the order of the
+   * items, and the order of the accumulation into global objects, and
+   * hence the round-off, may differ from one run to the next. The memory is
+   * bounded by one scratch data object and @p chunk_size copy data objects
+   * per thread.
+   *
+   * The function returns the accumulated time the tasks spent waiting for
+   * the copier locks and inside the copier, which is useful to judge
+   * whether the copier limits the parallel scaling.
+   */
+  template <typename Worker,
+            typename Copier,
+            typename Iterator,
+            typename ScratchData,
+            typename CopyData>
+  CopierStatistics
+  run_with_concurrent_copiers(
+    const Iterator &                         begin,
+    const typename identity<Iterator>::type &end,
+    Worker                                   worker,
+    Copier                                   copier,
+    const std::function<std::vector<types::global_dof_index>(
+      const Iterator &)> &                   get_conflict_indices,
+    const ScratchData &                      sample_scratch_data,
+    const CopyData &                         sample_copy_data,
+    const unsigned int                       chunk_size = 8)
+  {
+    Assert(chunk_size > 0, ExcMessage("The chunk_size must be at least one."));
+
+    std::vector<Iterator> items;
+    for (Iterator p = begin; p != end; ++p)
+      items.push_back(p);
+    if (items.empty())
+      return CopierStatistics();
+
+    using ChunkProcessor = internal::concurrent_copiers::
+      ChunkProcessor<Iterator, ScratchData, CopyData>;
+    ChunkProcessor processor(items,
+                             worker,
+                             copier,
+                             get_conflict_indices,
+                             sample_scratch_data,
+                             sample_copy_data,
+                             chunk_size);
+    const unsigned int n_chunks = processor.n_chunks();
+
+#  ifdef DEAL_II_WITH_TASKFLOW
+    if (MultithreadInfo::n_threads() > 1 && n_chunks > 1 &&
+        MultithreadInfo::get_task_backend() ==
+          MultithreadInfo::TaskBackend::taskflow &&
+        MultithreadInfo::get_taskflow_executor().this_worker_id() < 0)
+      {
+        // submit one task per chunk and let idle workers steal them
+        tf::Taskflow taskflow;
+        for (unsigned int chunk = 0; chunk < n_chunks; ++chunk)
+          taskflow.emplace([&processor, chunk]() { processor(chunk); });
+        MultithreadInfo::get_taskflow_executor().run(taskflow).wait();
+        return processor.get_statistics();
+      }
+#  endif
+
+    parallel::internal::parallel_for_subranges(
+      0u,
+      n_chunks,
+      [&processor](const unsigned int chunk_begin,
+                   const unsigned int chunk_end) {
+        for (unsigned int chunk = chunk_begin; chunk < chunk_end; ++chunk)
+          processor(chunk);
+      },
+      1);
+    return processor.get_statistics();
+  }
+
+
+
   /**
    * This is a variant of one of the two main functions of the WorkStream
    * concept, doing work as described in the introduction to this namespace.
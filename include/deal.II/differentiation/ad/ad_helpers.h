@@ -22,7 +22,9 @@
 
 #  include <deal.II/base/numbers.h>
 #  include <deal.II/base/symmetric_tensor.h>
+#  include <deal.II/base/table.h>
 #  include <deal.II/base/tensor.h>
+#  include <deal.II/base/vectorization.h>
 
 #  include <deal.II/differentiation/ad/ad_drivers.h>
 #  include <deal.II/differentiation/ad/ad_number_traits.h>
@@ -3216,6 +3218,71 @@ namespace Differentiation
       void
       compute_hessian(FullMatrix<scalar_type> &hessian) const;
 
+      /**
+       * Evaluate the recorded scalar field, its gradient and its Hessian for
+       * a batch of points at once, namely for each lane of the
+       * VectorizedArray entries of @p independent_variable_values. This is
+       * the operation needed at the quadrature points of a matrix-free
+       * operator, where FEEvaluation provides the values of the independent
+       * variables (e.g., the components of a deformation gradient) for
+       * several cells at once in the lanes of a VectorizedArray. A material
+       * law can then be recorded once on a tape and evaluated for the whole
+       * batch with a single function call:
+       * @code
+       *   // The tape has been recorded before, e.g., when the operator
+       *   // was set up.
+       *   for (const unsigned int q : phi.quadrature_point_indices())
+       *     {
+       *       Tensor<2, dim, VectorizedArray<double>> F = phi.get_gradient(q);
+       *       for (unsigned int d = 0; d < dim; ++d)
+       *         F[d][d] += 1.;
+       *       for (unsigned int i = 0; i < n_independent_variables; ++i)
+       *         values[i] = F[i / dim][i % dim];
+       *       ad_helper.compute_value_gradient_and_hessian(
+       *         values,
+       *         psi,
+       *         dpsi,
+       *         d2psi,
+       *         phi.n_active_entries_per_cell_batch());
+       *       // ... use dpsi and d2psi in phi.submit_gradient() ...
+       *     }
+       * @endcode
+       *
+       * The tape is evaluated for one lane after the other, reusing the
+       * activated tape and the internal scratch data in between, so the
+       * cost is that of calling set_independent_variables(),
+       * compute_value(), compute_gradient() and compute_hessian() for each
+       * lane, without the overhead of the per-lane bookkeeping at the call
+       * site. After the call, the independent variable values of the last
+       * active lane are set on this object.
+       *
+       * @param[in] independent_variable_values The values of the
+       * independent variables, one VectorizedArray per independent variable
+       * and one point per lane. The length of this vector must be
+       * <code>n_independent_variables</code>.
+       * @param[out] value The value of the scalar field at each point.
+       * @param[out] gradient The gradient of the scalar field at each point.
+       * The vector is resized to <code>n_independent_variables</code>.
+       * @param[out] hessian The Hessian of the scalar field at each point.
+       * The table is resized to
+       * <code>n_independent_variables</code>$\times$<code>n_independent_variables</code>.
+       * @param[in] n_active_lanes The number of lanes that hold valid
+       * points, as returned by FEEvaluation::n_active_entries_per_cell_batch()
+       * for partially filled cell batches. The results in the remaining lanes
+       * are set to zero.
+       *
+       * @note This function is only available for taped AD numbers.
+       */
+      template <std::size_t width>
+      void
+      compute_value_gradient_and_hessian(
+        const std::vector<VectorizedArray<scalar_type, width>>
+          &                                  independent_variable_values,
+        VectorizedArray<scalar_type, width> &value,
+        std::vector<VectorizedArray<scalar_type, width>> &gradient,
+        Table<2, VectorizedArray<scalar_type, width>> &   hessian,
+        const unsigned int n_active_lanes = width);
+
       /**
        * Extract the function gradient for a subset of independent variables
        * $\mathbf{A} \subset \mathbf{X}$, i.e.
@@ -3914,6 +3981,59 @@ namespace Differentiation
 
 
 
+    template <int                  dim,
+              enum AD::NumberTypes ADNumberTypeCode,
+              typename ScalarType>
+    template <std::size_t width>
+    void
+    ScalarFunction<dim, ADNumberTypeCode, ScalarType>::
+      compute_value_gradient_and_hessian(
+        const std::vector<VectorizedArray<scalar_type, width>>
+          &                                  independent_variable_values,
+        VectorizedArray<scalar_type, width> &value,
+        std::vector<VectorizedArray<scalar_type, width>> &gradient,
+        Table<2, VectorizedArray<scalar_type, width>> &   hessian,
+        const unsigned int                                n_active_lanes)
+    {
+      static_assert(ADNumberTraits<ad_type>::is_taped == true,
+                    "The batched evaluation of the scalar function is only "
+                    "available for taped AD numbers.");
+      const unsigned int n_independent_variables =
+        this->n_independent_variables();
+      AssertDimension(independent_variable_values.size(),
+                      n_independent_variables);
+      Assert(n_active_lanes > 0 && n_active_lanes <= width,
+             ExcIndexRange(n_active_lanes, 1, width + 1));
+
+      value = scalar_type();
+      gradient.assign(n_independent_variables,
+                      VectorizedArray<scalar_type, width>(scalar_type()));
+      hessian.reinit(n_independent_variables, n_independent_variables);
+      hessian.fill(VectorizedArray<scalar_type, width>(scalar_type()));
+
+      std::vector<scalar_type> lane_values(n_independent_variables);
+      Vector<scalar_type>      lane_gradient;
+      FullMatrix<scalar_type>  lane_hessian;
+      for (unsigned int v = 0; v < n_active_lanes; ++v)
+        {
+          for (unsigned int i = 0; i < n_independent_variables; ++i)
+            lane_values[i] = independent_variable_values[i][v];
+          this->set_independent_variables(lane_values);
+
+          value[v] = compute_value();
+          compute_gradient(lane_gradient);
+          compute_hessian(lane_hessian);
+          for (unsigned int i = 0; i < n_independent_variables; ++i)
+            {
+              gradient[i][v] = lane_gradient[i];
+              for (unsigned int j = 0; j < n_independent_variables; ++j)
+                hessian(i, j)[v] = lane_hessian(i, j);
+            }
+        }
+    }
+
+
+
     template <int                  dim,
               enum AD::NumberTypes ADNumberTypeCode,
               typename ScalarType>
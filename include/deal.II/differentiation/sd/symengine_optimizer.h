@@ -37,6 +37,7 @@ DEAL_II_ENABLE_EXTRA_DIAGNOSTICS
 
 #  include <deal.II/base/exceptions.h>
 #  include <deal.II/base/logstream.h>
+#  include <deal.II/base/mpi_stub.h>
 #  include <deal.II/base/utilities.h>
 
 #  include <deal.II/differentiation/sd/symengine_number_types.h>
@@ -51,6 +52,7 @@ DEAL_II_ENABLE_EXTRA_DIAGNOSTICS
 #  include <algorithm>
 #  include <map>
 #  include <memory>
+#  include <string>
 #  include <type_traits>
 #  include <utility>
 #  include <vector>
@@ -1795,6 +1797,48 @@ namespace Differentiation
       void
       optimize();
 
+      /**
+       * Perform the optimization of all registered dependent functions in the
+       * same way as optimize(), but only once for all processes of
+       * @p mpi_communicator and, if a @p cache_directory is given, only once
+       * for all runs of a program.
+       *
+       * The optimization, which can take minutes for large expressions and
+       * the LLVM optimizer, is performed on the root process only. The
+       * optimized state is then serialized and broadcast to all other
+       * processes, which deserialize it instead of optimizing the
+       * expressions themselves. If @p cache_directory is not empty, the
+       * serialized state is additionally stored in a file in this directory
+       * whose name is built from hash(). The next time the same expressions
+       * are optimized with the same settings, the root process reads this
+       * file instead of performing the optimization.
+       *
+       * All processes must have registered the same symbols and dependent
+       * functions and selected the same optimization method and flags. This
+       * is checked by comparing hash() with that of the root process.
+       *
+       * @note The cache files of the LLVM optimizer contain machine code,
+       * and the hash of the expressions depends on the SymEngine build. A
+       * cache directory should therefore only be shared between runs of the
+       * same program on the same kind of machines. Outdated files are never
+       * removed.
+       *
+       * @note As with serialization in general, the "lambda" optimizer
+       * cannot be stored in its optimized state, so the optimization is
+       * repeated on each process for this optimization method.
+       */
+      void
+      optimize(const MPI_Comm &   mpi_communicator,
+               const std::string &cache_directory = "");
+
+      /**
+       * Return a hash of the registered independent symbols and dependent
+       * functions, the optimization method and the optimization flags, which
+       * identifies the result of optimize().
+       */
+      std::size_t
+      hash() const;
+
       /**
        * Returns a flag which indicates whether the optimize()
        * function has been called and the class is finalized.
@@ -22,11 +22,167 @@
 
 #include <deal.II/dofs/dof_handler.h>
 
+#include <chrono>
+#include <vector>
+
 
 DEAL_II_NAMESPACE_OPEN
 
 namespace parallel
 {
+  /**
+   * A class that records the measured computational cost of each active cell
+   * of a Triangulation, e.g., the time spent on the cell during an assembly
+   * with WorkStream::run() or an operator evaluation with
+   * MatrixFree::cell_loop(). The recorded costs can then be turned into cell
+   * weights for the next repartitioning via
+   * CellWeights::measured_weighting(). This is useful if the cost of a cell
+   * varies in ways that cannot be predicted from the finite element alone,
+   * e.g., because of different material models or nonlinear iterations
+   * local to a cell.
+   *
+   * The costs are stored by the active cell index and are set to zero
+   * whenever the triangulation changes, i.e., they always refer to the
+   * current mesh and need to be recorded again after each refinement or
+   * repartitioning.
+   *
+   * The time spent in a task on one cell, e.g., in the worker function of
+   * WorkStream::run(), can be recorded with an object of the class Scope:
+   * @code
+   * parallel::MeasuredCellCosts<dim> cell_costs(triangulation);
+   *
+   * auto worker = [&](const auto &cell, auto &scratch, auto &copy) {
+   *   const typename parallel::MeasuredCellCosts<dim>::Scope scope(cell_costs,
+   *                                                               *cell);
+   *   ... assemble on cell ...
+   * };
+   * @endcode
+   * In MatrixFree::cell_loop(), the work is done on batches of several cells
+   * at once, so the time of a batch is distributed equally among the cells
+   * within the batch:
+   * @code
+   * for (unsigned int cell = range.first; cell < range.second; ++cell)
+   *   {
+   *     const auto start = std::chrono::steady_clock::now();
+   *
+   *     ... evaluate the operator on cell batch ...
+   *
+   *     const double time = std::chrono::duration<double>(
+   *       std::chrono::steady_clock::now() - start).count();
+   *     const unsigned int n_lanes =
+   *       matrix_free.n_active_entries_per_cell_batch(cell);
+   *     for (unsigned int v = 0; v < n_lanes; ++v)
+   *       cell_costs.add(*matrix_free.get_cell_iterator(cell, v),
+   *                      time / n_lanes);
+   *   }
+   * @endcode
+   *
+   * The costs of different cells may be recorded concurrently from several
+   * threads, but the cost of one and the same cell must not be recorded from
+   * more than one thread at a time, which is the case for the loops of
+   * WorkStream and MatrixFree.
+   *
+   * @ingroup distributed
+   */
+  template <int dim, int spacedim = dim>
+  class MeasuredCellCosts
+  {
+  public:
+    /**
+     * A class that measures the wall time between its construction and
+     * destruction and adds it to the cost of a cell.
+     */
+    class Scope
+    {
+    public:
+      /**
+       * Constructor. Starts the measurement for @p cell.
+       */
+      Scope(MeasuredCellCosts<dim, spacedim> & costs,
+            const CellAccessor<dim, spacedim> &cell);
+
+      /**
+       * Destructor. Adds the time elapsed since the construction to the
+       * cost of the cell.
+       */
+      ~Scope();
+
+    private:
+      /**
+       * The object the measured time is added to.
+       */
+      MeasuredCellCosts<dim, spacedim> &costs;
+
+      /**
+       * The active cell index of the cell.
+       */
+      const unsigned int active_cell_index;
+
+      /**
+       * The point in time when the measurement was started.
+       */
+      const std::chrono::time_point<std::chrono::steady_clock> start;
+    };
+
+    /**
+     * Constructor. All costs are initialized to zero.
+     */
+    MeasuredCellCosts(const dealii::Triangulation<dim, spacedim> &tria);
+
+    /**
+     * Destructor.
+     */
+    ~MeasuredCellCosts();
+
+    /**
+     * Set the costs of all cells to zero.
+     */
+    void
+    reset();
+
+    /**
+     * Add @p cost to the cost of the active cell @p cell. The unit of the
+     * cost is arbitrary, but must be the same for all cells and processes;
+     * the Scope class records seconds.
+     */
+    void
+    add(const CellAccessor<dim, spacedim> &cell, const double cost);
+
+    /**
+     * Return the cost recorded on @p cell. If @p cell is not active, the sum
+     * of the costs of its active descendants is returned.
+     */
+    double
+    get_cost(const CellAccessor<dim, spacedim> &cell) const;
+
+    /**
+     * Return the costs of all active cells, indexed by the active cell index.
+     */
+    const std::vector<double> &
+    get_costs() const;
+
+  private:
+    /**
+     * The triangulation the costs refer to.
+     */
+    SmartPointer<const dealii::Triangulation<dim, spacedim>,
+                 MeasuredCellCosts<dim, spacedim>>
+      tria;
+
+    /**
+     * The costs of all active cells, indexed by the active cell index.
+     */
+    std::vector<double> costs;
+
+    /**
+     * A connection to the `any_change` signal of the triangulation, which
+     * resets the costs.
+     */
+    boost::signals2::connection connection;
+  };
+
+
+
   /**
    * Anytime a parallel::TriangulationBase is repartitioned, either upon request
    * or by refinement/coarsening, cells will be distributed amongst all
@@ -191,6 +347,31 @@ namespace parallel
     static WeightingFunction
     ndofs_weighting(const std::vector<std::pair<float, float>> &coefficients);
 
+    /**
+     * Determine the weight $w_K$ of each cell $K$ from the cost $c_K$
+     * recorded for it in @p costs in the following way: \f[ w_K =
+     * w_\text{min} + s \, c_K \f] where the scaling factor $s$ is given by
+     * @p weight_per_cost and the minimal weight $w_\text{min}$ by
+     * @p minimum_weight. The latter accounts for the cost of cells on which
+     * no cost was recorded and must be greater than zero if this may be the
+     * case for all cells of a process. For cells that are going to be
+     * coarsened, the costs of the children are summed up.
+     *
+     * If the costs are recorded in seconds, as done by
+     * MeasuredCellCosts::Scope, the default @p weight_per_cost gives a weight
+     * of one per microsecond.
+     *
+     * The right hand side will be rounded to the nearest integer since cell
+     * weights are required to be integers.
+     *
+     * @note The object @p costs must outlive the returned function.
+     */
+    static WeightingFunction
+    measured_weighting(
+      const MeasuredCellCosts<dim, spacedim> &costs,
+      const double                            weight_per_cost = 1e6,
+      const unsigned int                      minimum_weight  = 1);
+
     /**
      * @}
      */
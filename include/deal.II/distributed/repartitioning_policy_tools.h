@@ -179,6 +179,54 @@ namespace RepartitioningPolicyTools
       weighting_function;
   };
 
+  /**
+   * A policy that takes the topology of the machine into account. The
+   * processes of the communicator of the triangulation are grouped by the
+   * compute node they run on, as determined by
+   * <code>MPI_Comm_split_type(..., MPI_COMM_TYPE_SHARED, ...)</code>. The
+   * active cells, in the order given by their global active cell index (which
+   * follows the space-filling curve for p4est-based triangulations), are then
+   * split in two levels: first into one contiguous chunk per node, with a
+   * weight proportional to the number of processes on that node, and then
+   * each chunk among the processes of the node.
+   *
+   * Since each node receives a single contiguous piece of the space-filling
+   * curve, the interface between nodes is kept small even if the ranks of a
+   * node are not numbered consecutively in the communicator (e.g., for a
+   * round-robin placement of processes). The faces between processes on the
+   * same node, which are cheap to communicate over, make up the remaining
+   * interfaces.
+   *
+   * If all processes of each node are numbered consecutively, the result is
+   * the same as the one of CellWeightPolicy.
+   */
+  template <int dim, int spacedim = dim>
+  class NodeAwarePolicy : public Base<dim, spacedim>
+  {
+  public:
+    /**
+     * Constructor taking an optional function that gives a weight to each
+     * cell. If no function is given, all cells have the same weight.
+     */
+    NodeAwarePolicy(
+      const std::function<unsigned int(
+        const typename Triangulation<dim, spacedim>::cell_iterator &,
+        const typename Triangulation<dim, spacedim>::CellStatus)>
+        &weighting_function = {});
+
+    virtual LinearAlgebra::distributed::Vector<double>
+    partition(const Triangulation<dim, spacedim> &tria_in) const override;
+
+  private:
+    /**
+     * A function that gives a weight to each cell.
+     */
+    const std::function<
+      unsigned int(const typename Triangulation<dim, spacedim>::cell_iterator &,
+                   const typename Triangulation<dim, spacedim>::CellStatus)>
+      weighting_function;
+  };
+
 } // namespace RepartitioningPolicyTools
 
 DEAL_II_NAMESPACE_CLOSE
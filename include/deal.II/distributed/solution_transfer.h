@@ -22,6 +22,8 @@
 
 #include <deal.II/dofs/dof_handler.h>
 
+#include <deal.II/lac/vector.h>
+
 #include <vector>
 
 
@@ -40,6 +42,12 @@ namespace parallel
      * SolutionTransfer object at the same time, that the calls to prepare_*()
      * and interpolate()/deserialize() need to be in the same order.
      *
+     * @note The values of all vectors passed to one call of
+     * prepare_for_coarsening_and_refinement() are stored together on each
+     * cell and moved in a single exchange. When transferring many vectors
+     * that live on the same DoFHandler, it is therefore cheaper to pass them
+     * all to one SolutionTransfer object than to use one object per vector.
+     *
      * <h3>Note on ghost elements</h3> In a parallel computation PETSc or
      * Trilinos vector may contain ghost elements or not. For reading in
      * information with prepare_for_coarsening_and_refinement() or
@@ -341,6 +349,13 @@ namespace parallel
        */
       unsigned int handle;
 
+      /**
+       * Scratch storage for the values of the degrees of freedom of one
+       * vector on one cell, reused on all cells to avoid allocating memory
+       * in pack_callback() and unpack_callback().
+       */
+      Vector<typename VectorType::value_type> cell_dof_values;
+
       /**
        * A callback function used to pack the data on the current mesh into
        * objects that can later be retrieved after refinement, coarsening and
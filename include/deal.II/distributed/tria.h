@@ -33,6 +33,7 @@
 
 #include <functional>
 #include <list>
+#include <memory>
 #include <set>
 #include <type_traits>
 #include <utility>
@@ -474,6 +475,19 @@ namespace parallel
        *
        * @note The algorithm is free of communication.
        *
+       * @note The check of the requirements above and the mappings of the
+       * quadrants visited by the search are computed in the first call and
+       * reused by subsequent calls until the mesh is changed by refinement,
+       * coarsening, repartitioning, or loading. Changes of the manifold ids
+       * in between are not detected. To make the most of the stored data,
+       * pass as many points as possible at once rather than calling this
+       * function for each point.
+       *
+       * For triangulations that are not based on p4est, the function
+       * GridTools::guess_point_owner() together with the covering rtree of
+       * GridTools::Cache::get_covering_rtree() provides a similar
+       * functionality.
+       *
        * @param[in] points a list of query points
        * @return list of owner ranks
        */
@@ -564,6 +578,104 @@ namespace parallel
       void
       repartition();
 
+      /**
+       * The prediction of the effect of a call to repartition() as computed
+       * by estimate_repartition().
+       */
+      struct RepartitionEstimate
+      {
+        /**
+         * The load imbalance of the current partition, i.e., the maximal sum
+         * of the cell weights on a process divided by the average over all
+         * processes, minus one. A perfectly balanced partition has an
+         * imbalance of zero.
+         */
+        double current_imbalance = 0.;
+
+        /**
+         * The load imbalance of the partition after repartition().
+         */
+        double predicted_imbalance = 0.;
+
+        /**
+         * The maximal sum of the cell weights on a process for the current
+         * partition.
+         */
+        std::uint64_t current_max_weight = 0;
+
+        /**
+         * The maximal sum of the cell weights on a process after
+         * repartition().
+         */
+        std::uint64_t predicted_max_weight = 0;
+
+        /**
+         * The total number of cells that change their owner.
+         */
+        types::global_cell_index n_migrated_cells = 0;
+
+        /**
+         * The total number of bytes of the data attached with
+         * register_data_attach() that is sent to other processes.
+         */
+        std::uint64_t n_migrated_bytes = 0;
+
+        /**
+         * The maximal number of bytes of attached data sent by a single
+         * process, which determines the time of the data transfer.
+         */
+        std::uint64_t max_migrated_bytes_per_process = 0;
+      };
+
+      /**
+       * Predict the effect of a call to repartition() without changing the
+       * mesh. The new partition is computed from the cell weights given by
+       * the `weight` signal (or from the number of cells if no function is
+       * connected to the signal) in the same way as p4est does along its
+       * space-filling curve, and the volume of the data attached with
+       * register_data_attach() that would be shipped to other processes is
+       * determined by calling the pack callbacks on the cells that change
+       * their owner. The first cell of each callback of fixed size is used
+       * to determine the size for all cells.
+       *
+       * Since p4est keeps families of cells that may be coarsened together
+       * on the same process, the actual partition may differ slightly from
+       * the predicted one, so the result is an estimate. This is a
+       * collective operation.
+       */
+      RepartitionEstimate
+      estimate_repartition() const;
+
+      /**
+       * Call repartition() only if it pays off: nothing is done if the
+       * current imbalance as defined in RepartitionEstimate is not larger
+       * than @p imbalance_tolerance. Otherwise, if @p cost_per_migrated_byte
+       * is positive, the reduction of the maximal weight on a process, i.e.
+       * the gain per unit of work of the computations the weights describe,
+       * is compared to the cost of the data transfer, which is given by the
+       * maximal number of bytes sent by a process times
+       * @p cost_per_migrated_byte (in units of the cell weights), and the
+       * mesh is only repartitioned if the gain is larger. For example, if the
+       * weights measure the cost of one time step and the mesh is considered
+       * for repartitioning every @p n time steps, pass the cost of moving one
+       * byte divided by @p n.
+       *
+       * The attached data has to be set up as for repartition(). If the mesh
+       * is not repartitioned, the data is packed and handed back on each
+       * process without communication, so that it can be unpacked with
+       * notify_ready_to_unpack() in either case. The signals
+       * Triangulation::Signals::pre_distributed_repartition and
+       * Triangulation::Signals::post_distributed_repartition are only
+       * triggered if the mesh is repartitioned.
+       *
+       * @return Whether the mesh has been repartitioned.
+       *
+       * This is a collective operation.
+       */
+      bool
+      repartition_if_imbalanced(const double imbalance_tolerance,
+                                const double cost_per_migrated_byte = 0.);
+
       /**
        * Return the local memory consumption in bytes.
        */
@@ -730,6 +842,13 @@ namespace parallel
        */
       typename dealii::internal::p4est::types<dim>::ghost *parallel_ghost;
 
+      /**
+       * Data kept between calls of find_point_owner_rank(). Reset whenever
+       * the mesh changes.
+       */
+      struct PointOwnerSearchCache;
+      std::unique_ptr<PointOwnerSearchCache> point_owner_search_cache;
+
       /**
        * Go through all p4est trees and record the relations between locally
        * owned p4est quadrants and active deal.II cells in the private member
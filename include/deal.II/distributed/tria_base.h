@@ -24,6 +24,7 @@
 #include <deal.II/base/smartpointer.h>
 #include <deal.II/base/subscriptor.h>
 #include <deal.II/base/template_constraints.h>
+#include <deal.II/base/thread_management.h>
 
 #include <deal.II/grid/tria.h>
 
@@ -503,6 +504,41 @@ namespace parallel
     virtual void
     load(const std::string &filename, const bool autopartition) = 0;
 
+    /**
+     * Select whether save() writes the data attached to the cells, e.g., by
+     * SolutionTransfer or CellDataTransfer, in the background. For large
+     * computations, writing this data typically takes most of the time of
+     * save(). If @p asynchronous is true, save() packs the attached data
+     * into memory buffers, prepares the files and the file positions of all
+     * processes, and returns while a separate task writes the buffers to
+     * the files. In the meantime, the computation can continue and even
+     * refine the mesh or change the data that was attached. The price is
+     * that the buffers stay in memory until the data has been written.
+     *
+     * The files produced in this mode are the same as the ones of a
+     * synchronous call to save(). They are written by each process with
+     * standard file streams at disjoint positions rather than with MPI-IO,
+     * which requires a file system that supports concurrent writes to the
+     * same file from several nodes, as parallel file systems do.
+     *
+     * The checkpoint is only complete once wait_for_save() has returned,
+     * which is done automatically at the beginning of the next call to
+     * save() and load(). By default, the data is written synchronously.
+     */
+    void
+    set_asynchronous_save(const bool asynchronous);
+
+    /**
+     * Wait until the data attached to the cells in the last call to save()
+     * has been written to the files by all processes, if save() has been
+     * called in asynchronous mode (see set_asynchronous_save()). If writing
+     * has failed on any process, an exception of type ExcIO is thrown on all
+     * processes. This is a collective operation that needs to be called on
+     * all processes.
+     */
+    void
+    wait_for_save() const;
+
     /**
      * Register a function that can be used to attach data of fixed size
      * to cells. This is useful for two purposes: (i) Upon refinement and
@@ -844,6 +880,19 @@ namespace parallel
            const unsigned int global_num_cells,
            const std::string &filename) const;
 
+      /**
+       * Same as save(), but only create the files and compute the positions
+       * to write to, which involves communication among the processes, and
+       * return a task that writes the packed data to the files in the
+       * background without any further communication. The buffers of the
+       * packed data are moved into the task, so they are empty after this
+       * call.
+       */
+      Threads::Task<void>
+      save_in_background(const unsigned int global_first_cell,
+                         const unsigned int global_num_cells,
+                         const std::string &filename);
+
       /**
        * Transfer data from file system.
        *
@@ -917,6 +966,18 @@ namespace parallel
     };
 
     DataTransfer data_transfer;
+
+    /**
+     * Flag that denotes whether the attached data is written in the
+     * background, see set_asynchronous_save().
+     */
+    bool asynchronous_save;
+
+    /**
+     * The task writing the attached data of the last call to save() in
+     * asynchronous mode.
+     */
+    mutable Threads::Task<void> pending_save;
   };
 
 } // namespace parallel
@@ -19,6 +19,8 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/array_view.h>
+
 #include <deal.II/dofs/dof_handler.h>
 #include <deal.II/dofs/dof_iterator_selector.h>
 
@@ -1923,6 +1925,17 @@ public:
   void
   get_dof_indices(std::vector<types::global_dof_index> &dof_indices) const;
 
+  /**
+   * Same as above, but write the indices into an arbitrary array of the
+   * right size, e.g., a `std::array` or a part of a larger array that holds
+   * the indices of many cells. In contrast to the function above, this does
+   * not require the indices to be stored in a `std::vector`, which allows
+   * to avoid allocating and filling a separate vector for each cell when
+   * the indices of several cells are collected at once.
+   */
+  void
+  get_dof_indices(const ArrayView<types::global_dof_index> &dof_indices) const;
+
   /**
    * Retrieve the global indices of the degrees of freedom on this cell in the
    * level vector associated to the level of the cell.
@@ -617,6 +617,51 @@ namespace DoFRenumbering
       std::vector<types::global_dof_index>(),
     const unsigned int level = numbers::invalid_unsigned_int);
 
+  /**
+   * Renumber the degrees of freedom by a Cuthill-McKee ordering of the
+   * locally owned active cells, rather than of the degrees of freedom
+   * themselves.
+   *
+   * The function builds the graph in which two locally owned active cells
+   * are connected if they share a face (including faces with hanging nodes,
+   * where the cell is connected to all children of its neighbor adjacent to
+   * that face), and computes a breadth-first Cuthill-McKee ordering of this
+   * graph, starting from a cell of minimal degree and restarting in every
+   * connected component. The degrees of freedom are then numbered in the
+   * order in which they are first encountered when traversing the cells in
+   * this order, see cell_wise().
+   *
+   * In contrast to the Cuthill_McKee() function above, this function never
+   * builds a sparsity pattern of the degrees of freedom: its cost and memory
+   * consumption are proportional to the number of cells rather than the
+   * number of nonzero entries of the matrix, which makes it considerably
+   * cheaper for higher order elements. The ordering is computed
+   * independently on each process for its locally owned cells and does not
+   * require any communication. The bandwidth obtained this way is typically
+   * comparable to, though somewhat larger than, the one of the DoF-based
+   * algorithm.
+   *
+   * If @p reversed_numbering is true, the cells are traversed in the reverse
+   * Cuthill-McKee order.
+   */
+  template <int dim, int spacedim>
+  void
+  Cuthill_McKee_on_cells(DoFHandler<dim, spacedim> &dof_handler,
+                         const bool                 reversed_numbering = false);
+
+  /**
+   * Compute the renumbering vector needed by the Cuthill_McKee_on_cells()
+   * function. This function does not perform the renumbering on the
+   * DoFHandler DoFs but only returns the renumbering vector, which has one
+   * entry for each locally owned degree of freedom.
+   */
+  template <int dim, int spacedim>
+  void
+  compute_Cuthill_McKee_on_cells(
+    std::vector<types::global_dof_index> &new_dof_indices,
+    const DoFHandler<dim, spacedim> &     dof_handler,
+    const bool                            reversed_numbering = false);
+
   /**
    * Renumber the degrees of freedom according to the Cuthill-McKee method,
    * eventually using the reverse numbering scheme, in this case for a
@@ -56,6 +56,7 @@ template <class MeshType>
 class InterGridMap;
 template <int dim, int spacedim>
 class Mapping;
+class SparsityPattern;
 template <int dim, class T>
 class Table;
 template <typename Number>
@@ -489,6 +490,110 @@ namespace DoFTools
     const bool                       keep_constrained_dofs = true,
     const types::subdomain_id subdomain_id = numbers::invalid_subdomain_id);
 
+  /**
+   * Compute the sparsity pattern of the blocks of a BlockCSRSparseMatrix
+   * built on the given @p dof_handler, where the degrees of freedom $i$
+   * with the same value of $i / \text{block\_size}$ form a block. The
+   * pattern @p block_sparsity_pattern must be of size $N/\text{block\_size}
+   * \times N/\text{block\_size}$ with $N$ the number of degrees of freedom,
+   * which must be divisible by @p block_size. A block is added whenever the
+   * sparsity pattern computed by the first make_sparsity_pattern() function
+   * above with the same arguments would contain an entry within that block,
+   * but the pattern is built directly on the blocks, without setting up the
+   * pattern for the individual degrees of freedom first.
+   *
+   * See the documentation of BlockCSRSparseMatrix for the numbering of the
+   * degrees of freedom this function expects. The other arguments have the
+   * same meaning as in the first make_sparsity_pattern() function.
+   *
+   * @ingroup constraints
+   */
+  template <int dim, int spacedim, typename number = double>
+  void
+  make_sparsity_pattern(
+    const DoFHandler<dim, spacedim> &dof_handler,
+    const unsigned int               block_size,
+    SparsityPatternBase &            block_sparsity_pattern,
+    const AffineConstraints<number> &constraints = AffineConstraints<number>(),
+    const bool                       keep_constrained_dofs = true,
+    const types::subdomain_id subdomain_id = numbers::invalid_subdomain_id);
+
+  /**
+   * Compute the same sparsity pattern as the first make_sparsity_pattern()
+   * function above, but store it directly in a SparsityPattern object that
+   * is reinitialized and compressed by this function, rather than in an
+   * intermediate DynamicSparsityPattern that is later copied into a
+   * SparsityPattern.
+   *
+   * To this end, the function runs over the cells twice. The first pass only
+   * counts the entries that would be added to each row, which is an upper
+   * bound for the length of the row because entries coupling through more
+   * than one cell are counted for each of these cells. The second pass then
+   * adds the entries to @p sparsity_pattern reinitialized with these row
+   * lengths, and the final call to SparsityPattern::compress() removes the
+   * unused slots. In contrast to the DynamicSparsityPattern, which stores a
+   * separately allocated array for each row, this needs only one integer per
+   * row during the first pass and two contiguous arrays for the column
+   * indices during compression, which considerably reduces both
+   * the memory consumption and the number of memory allocations for large
+   * problems. On the other hand, the entries of all cells are computed twice.
+   *
+   * The arguments have the same meaning as in the first
+   * make_sparsity_pattern() function. Since the SparsityPattern class does
+   * not support a distributed storage, this function is meant for problems
+   * where each process stores the full pattern.
+   *
+   * @ingroup constraints
+   */
+  template <int dim, int spacedim, typename number = double>
+  void
+  make_static_sparsity_pattern(
+    const DoFHandler<dim, spacedim> &dof_handler,
+    SparsityPattern &                sparsity_pattern,
+    const AffineConstraints<number> &constraints = AffineConstraints<number>(),
+    const bool                       keep_constrained_dofs = true,
+    const types::subdomain_id subdomain_id = numbers::invalid_subdomain_id);
+
+  /**
+   * Same as the previous function, but run the two passes over the cells in
+   * parallel, using the given partition of the active cells of
+   * @p dof_handler into colors. The cells of one color are worked on
+   * concurrently, the colors one after the other. Each pass therefore
+   * requires that no two cells of the same color write to the same row of
+   * the sparsity pattern, i.e., that the sets of degrees of freedom of these
+   * cells, augmented by the degrees of freedom the constrained ones among
+   * them are constrained to, are disjoint. This is the same requirement as
+   * for assembling the matrix concurrently through WorkStream::run() with a
+   * graph coloring, so the coloring of the assembly can be reused here. It
+   * may be computed by
+   * @code
+   *   const auto colored_cells = GraphColoring::make_graph_coloring(
+   *     dof_handler.begin_active(),
+   *     dof_handler.end(),
+   *     [&](const typename DoFHandler<dim>::active_cell_iterator &cell) {
+   *       std::vector<types::global_dof_index> dof_indices(
+   *         cell->get_fe().n_dofs_per_cell());
+   *       cell->get_dof_indices(dof_indices);
+   *       constraints.resolve_indices(dof_indices);
+   *       return dof_indices;
+   *     });
+   * @endcode
+   *
+   * Cells that are not locally owned are skipped.
+   *
+   * @ingroup constraints
+   */
+  template <int dim, int spacedim, typename number = double>
+  void
+  make_static_sparsity_pattern(
+    const DoFHandler<dim, spacedim> &dof_handler,
+    const std::vector<std::vector<
+      typename DoFHandler<dim, spacedim>::active_cell_iterator>>
+      &                              colored_cells,
+    SparsityPattern &                sparsity_pattern,
+    const AffineConstraints<number> &constraints = AffineConstraints<number>(),
+    const bool                       keep_constrained_dofs = true);
+
   /**
    * Construct a sparsity pattern that allows coupling degrees of freedom on
    * two different but related meshes.
@@ -600,6 +705,11 @@ namespace DoFTools
    * some of the entries of these masks to zeros, you can get a sparser
    * sparsity pattern.
    *
+   * If the DoFHandler does not use hp-capabilities, the couplings implied by
+   * the two masks for each pair of faces are computed only once, and the
+   * faces of different cells are traversed in parallel using the WorkStream
+   * framework, while the entries are written into @p sparsity sequentially.
+   *
    * @ingroup constraints
    */
   template <int dim, int spacedim>
@@ -637,6 +747,10 @@ namespace DoFTools
    *      return 0 < face_center[0];
    *    };
    * @endcode
+   *
+   * Since the faces of different cells may be worked on concurrently, @p
+   * face_has_flux_coupling needs to be safe to call from several threads at
+   * the same time.
    */
   template <int dim, int spacedim, typename number>
   void
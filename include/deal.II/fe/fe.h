@@ -1162,6 +1162,26 @@ public:
   bool
   isotropic_restriction_is_implemented() const;
 
+  /**
+   * Release the memory held by the prolongation and restriction matrices.
+   * Elements that compute these matrices on demand in
+   * get_prolongation_matrix() and get_restriction_matrix(), such as FE_Q,
+   * FE_DGQ, FE_Nedelec, and FESystem, recompute them upon the next request.
+   * For higher order elements in 3d and hp::FECollection objects with many
+   * entries, the matrices for all refinement cases and children can take a
+   * considerable amount of memory, which can be given back once no
+   * SolutionTransfer or other operation requiring them is pending.
+   *
+   * The default implementation does nothing, since elements that compute
+   * these matrices in their constructor could not restore them.
+   *
+   * @note This function must not be called while other threads may access
+   * the matrices. References obtained from get_prolongation_matrix() or
+   * get_restriction_matrix() before the call become invalid.
+   */
+  virtual void
+  clear_prolongation_and_restriction_matrices() const;
+
 
   /**
    * Access the #restriction_is_additive_flags field. See the discussion about
@@ -2386,6 +2406,15 @@ protected:
     const bool isotropic_restriction_only  = false,
     const bool isotropic_prolongation_only = false);
 
+  /**
+   * Set all prolongation and restriction matrices to empty matrices and free
+   * their memory. For use in the implementation of
+   * clear_prolongation_and_restriction_matrices() in derived classes that
+   * compute the matrices on demand.
+   */
+  void
+  free_prolongation_and_restriction_matrices() const;
+
   /**
    * Vector of projection matrices. See get_restriction_matrix() above. The
    * constructor initializes these matrices to zero dimensions, which can be
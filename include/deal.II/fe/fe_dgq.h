@@ -225,6 +225,15 @@ public:
     const RefinementCase<dim> &refinement_case =
       RefinementCase<dim>::isotropic_refinement) const override;
 
+  /**
+   * Release the prolongation and restriction matrices. They are recomputed
+   * upon the next call to get_prolongation_matrix() or
+   * get_restriction_matrix(). See
+   * FiniteElement::clear_prolongation_and_restriction_matrices().
+   */
+  virtual void
+  clear_prolongation_and_restriction_matrices() const override;
+
   /**
    * @name Functions to support hp
    * @{
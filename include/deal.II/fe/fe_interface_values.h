@@ -25,6 +25,9 @@
 
 #include <deal.II/hp/q_collection.h>
 
+#include <algorithm>
+#include <utility>
+
 DEAL_II_NAMESPACE_OPEN
 
 #ifndef DOXYGEN
@@ -2114,6 +2117,18 @@ private:
    */
   std::vector<std::array<unsigned int, 2>> dofmap;
 
+  /**
+   * Scratch arrays for the DoF indices of the two cells of the current
+   * interface and the same indices sorted together with their local index,
+   * kept as members to avoid memory allocation in reinit().
+   */
+  std::vector<types::global_dof_index> cell_dof_indices;
+  std::vector<types::global_dof_index> neighbor_dof_indices;
+  std::vector<std::pair<types::global_dof_index, unsigned int>>
+    sorted_cell_dof_indices;
+  std::vector<std::pair<types::global_dof_index, unsigned int>>
+    sorted_neighbor_dof_indices;
+
   /**
    * The FEFaceValues object for the current cell.
    */
@@ -2274,44 +2289,64 @@ FEInterfaceValues<dim, spacedim>::reinit(
   // Set up dof mapping and remove duplicates (for continuous elements).
   {
     // Get dof indices first:
-    std::vector<types::global_dof_index> v(
-      fe_face_values->get_fe().n_dofs_per_cell());
-    cell->get_active_or_mg_dof_indices(v);
-    std::vector<types::global_dof_index> v2(
+    cell_dof_indices.resize(fe_face_values->get_fe().n_dofs_per_cell());
+    cell->get_active_or_mg_dof_indices(cell_dof_indices);
+    neighbor_dof_indices.resize(
       fe_face_values_neighbor->get_fe().n_dofs_per_cell());
-    cell_neighbor->get_active_or_mg_dof_indices(v2);
-
-    // Fill a map from the global dof index to the left and right
-    // local index.
-    std::map<types::global_dof_index, std::pair<unsigned int, unsigned int>>
-                                          tempmap;
-    std::pair<unsigned int, unsigned int> invalid_entry(
-      numbers::invalid_unsigned_int, numbers::invalid_unsigned_int);
-
-    for (unsigned int i = 0; i < v.size(); ++i)
-      {
-        // If not already existing, add an invalid entry:
-        auto result = tempmap.insert(std::make_pair(v[i], invalid_entry));
-        result.first->second.first = i;
-      }
-
-    for (unsigned int i = 0; i < v2.size(); ++i)
-      {
-        // If not already existing, add an invalid entry:
-        auto result = tempmap.insert(std::make_pair(v2[i], invalid_entry));
-        result.first->second.second = i;
-      }
-
-    // Transfer from the map to the sorted std::vectors.
-    dofmap.resize(tempmap.size());
-    interface_dof_indices.resize(tempmap.size());
-    unsigned int idx = 0;
-    for (auto &x : tempmap)
-      {
-        interface_dof_indices[idx] = x.first;
-        dofmap[idx]                = {{x.second.first, x.second.second}};
-        ++idx;
-      }
+    cell_neighbor->get_active_or_mg_dof_indices(neighbor_dof_indices);
+
+    // Sort the indices of each cell together with their local index. A
+    // global index that appears several times on a cell is mapped to the
+    // last local index.
+    const auto sort_indices =
+      [](const std::vector<types::global_dof_index> &indices,
+         std::vector<std::pair<types::global_dof_index, unsigned int>>
+           &sorted) {
+        sorted.resize(indices.size());
+        for (unsigned int i = 0; i < indices.size(); ++i)
+          sorted[i] = std::make_pair(indices[i], i);
+        std::sort(sorted.begin(), sorted.end());
+
+        unsigned int n_unique = 0;
+        for (unsigned int i = 0; i < sorted.size(); ++i)
+          if (n_unique > 0 && sorted[n_unique - 1].first == sorted[i].first)
+            sorted[n_unique - 1].second = sorted[i].second;
+          else
+            sorted[n_unique++] = sorted[i];
+        sorted.resize(n_unique);
+      };
+    sort_indices(cell_dof_indices, sorted_cell_dof_indices);
+    sort_indices(neighbor_dof_indices, sorted_neighbor_dof_indices);
+
+    // Merge the two sorted lists into the sorted std::vectors, identifying
+    // the DoFs shared by both cells. Compared to collecting the indices in
+    // a std::map, this avoids a memory allocation per DoF on every face.
+    interface_dof_indices.clear();
+    dofmap.clear();
+    auto       a     = sorted_cell_dof_indices.begin();
+    auto       b     = sorted_neighbor_dof_indices.begin();
+    const auto a_end = sorted_cell_dof_indices.end();
+    const auto b_end = sorted_neighbor_dof_indices.end();
+    while (a != a_end || b != b_end)
+      if (b == b_end || (a != a_end && a->first < b->first))
+        {
+          interface_dof_indices.push_back(a->first);
+          dofmap.push_back({{a->second, numbers::invalid_unsigned_int}});
+          ++a;
+        }
+      else if (a == a_end || b->first < a->first)
+        {
+          interface_dof_indices.push_back(b->first);
+          dofmap.push_back({{numbers::invalid_unsigned_int, b->second}});
+          ++b;
+        }
+      else
+        {
+          interface_dof_indices.push_back(a->first);
+          dofmap.push_back({{a->second, b->second}});
+          ++a;
+          ++b;
+        }
   }
 }
 
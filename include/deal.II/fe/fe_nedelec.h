@@ -565,6 +565,15 @@ public:
     const RefinementCase<dim> &refinement_case =
       RefinementCase<dim>::isotropic_refinement) const override;
 
+  /**
+   * Release the prolongation and restriction matrices. They are recomputed
+   * upon the next call to get_prolongation_matrix() or
+   * get_restriction_matrix(). See
+   * FiniteElement::clear_prolongation_and_restriction_matrices().
+   */
+  virtual void
+  clear_prolongation_and_restriction_matrices() const override;
+
   // documentation inherited from the base class
   virtual void
   convert_generalized_support_point_values_to_dof_values(
@@ -625,6 +634,24 @@ private:
   void
   initialize_restriction();
 
+  /**
+   * Compute the interface constraints by projection of the shape functions
+   * on the children of a face. Called from the constructor unless the
+   * constraints of an element with the same name are already cached.
+   */
+  void
+  initialize_interface_constraints();
+
+  /**
+   * Fill the prolongation and restriction matrices, either by copying them
+   * from a process-wide cache of elements with the same name or by
+   * computing them with FETools::compute_embedding_matrices() and
+   * initialize_restriction(). Called on demand from
+   * get_prolongation_matrix() and get_restriction_matrix().
+   */
+  void
+  initialize_embedding_and_restriction_matrices();
+
   /**
    * These are the factors multiplied to a function in the
    * #generalized_face_support_points when computing the integration.
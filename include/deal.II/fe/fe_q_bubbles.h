@@ -150,6 +150,14 @@ public:
     const unsigned int         child,
     const RefinementCase<dim> &refinement_case) const override;
 
+  /**
+   * The prolongation and restriction matrices of this element are computed
+   * in the constructor and can not be recomputed on demand, so this
+   * function keeps them.
+   */
+  virtual void
+  clear_prolongation_and_restriction_matrices() const override;
+
   /**
    * Check for non-zero values on a face.
    *
@@ -126,6 +126,20 @@ namespace FESeries
               const unsigned int            cell_active_fe_index,
               Table<dim, CoefficientType> & fourier_coefficients);
 
+    /**
+     * Calculate the expansion coefficients of several cells that share the
+     * same @p active_fe_index at once. Each column of @p local_dof_values
+     * holds the local DoF values of one cell. On return, the corresponding
+     * column of @p coefficients holds the coefficients of that cell, unrolled
+     * in the order used by Table::fill(). All columns are transformed by a
+     * single matrix-matrix product, which is considerably faster than
+     * calling the function above once per cell.
+     */
+    void
+    calculate(const FullMatrix<CoefficientType> &local_dof_values,
+              const unsigned int                 active_fe_index,
+              FullMatrix<CoefficientType> &      coefficients);
+
     /**
      * Return the number of coefficients in each coordinate direction for the
      * finite element associated with @p index in the provided hp::FECollection.
@@ -296,6 +310,20 @@ namespace FESeries
               const unsigned int            cell_active_fe_index,
               Table<dim, CoefficientType> & legendre_coefficients);
 
+    /**
+     * Calculate the expansion coefficients of several cells that share the
+     * same @p active_fe_index at once. Each column of @p local_dof_values
+     * holds the local DoF values of one cell. On return, the corresponding
+     * column of @p coefficients holds the coefficients of that cell, unrolled
+     * in the order used by Table::fill(). All columns are transformed by a
+     * single matrix-matrix product, which is considerably faster than
+     * calling the function above once per cell.
+     */
+    void
+    calculate(const FullMatrix<CoefficientType> &local_dof_values,
+              const unsigned int                 active_fe_index,
+              FullMatrix<CoefficientType> &      coefficients);
+
     /**
      * Return the number of coefficients in each coordinate direction for the
      * finite element associated with @p index in the provided hp::FECollection.
@@ -855,6 +855,15 @@ public:
     const RefinementCase<dim> &refinement_case =
       RefinementCase<dim>::isotropic_refinement) const override;
 
+  /**
+   * Release the prolongation and restriction matrices. They are recomputed
+   * upon the next call to get_prolongation_matrix() or
+   * get_restriction_matrix(). See
+   * FiniteElement::clear_prolongation_and_restriction_matrices().
+   */
+  virtual void
+  clear_prolongation_and_restriction_matrices() const override;
+
   /**
    * Given an index in the natural ordering of indices on a face, return the
    * index of the same degree of freedom on the cell.
@@ -58,6 +58,15 @@ DEAL_II_NAMESPACE_OPEN
 #ifndef DOXYGEN
 template <int dim, int spacedim = dim>
 class FEValuesBase;
+
+namespace internal
+{
+  namespace MatrixFreeFunctions
+  {
+    template <typename Number>
+    struct ShapeInfo;
+  }
+} // namespace internal
 #endif
 
 namespace internal
@@ -637,6 +646,14 @@ namespace FEValuesViews
      * Store the data about shape functions.
      */
     std::vector<ShapeFunctionData> shape_function_data;
+
+    /**
+     * The indices of the shape functions that may be nonzero in the selected
+     * component(s), in ascending order. The get_function_*() functions only
+     * loop over these shape functions, which for elements with many
+     * components, such as an FESystem, skips most of the shape functions.
+     */
+    std::vector<unsigned int> nonzero_shape_functions;
   };
 
 
@@ -1444,6 +1461,14 @@ namespace FEValuesViews
      * Store the data about shape functions.
      */
     std::vector<ShapeFunctionData> shape_function_data;
+
+    /**
+     * The indices of the shape functions that may be nonzero in the selected
+     * component(s), in ascending order. The get_function_*() functions only
+     * loop over these shape functions, which for elements with many
+     * components, such as an FESystem, skips most of the shape functions.
+     */
+    std::vector<unsigned int> nonzero_shape_functions;
   };
 
 
@@ -3978,6 +4003,18 @@ protected:
                                                                      spacedim>
     finite_element_output;
 
+  /**
+   * The one-dimensional shape data of the finite element, set up by the
+   * FEValues class for scalar tensor-product elements such as FE_Q and
+   * FE_DGQ on tensor-product quadrature formulas with the same formula in
+   * all directions. If present, the get_function_values() and
+   * get_function_gradients() functions for scalar elements evaluate the
+   * solution by sum factorization rather than by a loop over all shape
+   * functions in all quadrature points. Otherwise, this pointer is empty.
+   */
+  std::unique_ptr<
+    const dealii::internal::MatrixFreeFunctions::ShapeInfo<double>>
+    tensor_product_shape_info;
 
   /**
    * Original update flags handed to the constructor of FEValues.
@@ -4116,6 +4153,38 @@ public:
   void
   reinit(const typename Triangulation<dim, spacedim>::cell_iterator &cell);
 
+  /**
+   * Destructor.
+   */
+  ~FEValues() override;
+
+  /**
+   * Compute the data this object provides on every active cell of
+   * @p triangulation that is not artificial, and store it. Subsequent calls
+   * to reinit() with one of these cells then do not compute anything but
+   * exchange the stored data of that cell with the current one, which takes
+   * constant time. This is useful if one assembles many times on the same
+   * mesh, e.g., in a Newton iteration, and can afford to keep the mapping
+   * and shape function data of all cells in memory.
+   *
+   * The stored data is discarded when the triangulation is changed or its
+   * vertices are moved. It is not updated if the mapping changes in other
+   * ways, as can be the case for MappingQEulerian or MappingFEField; call
+   * this function again in that case.
+   *
+   * @note The stored data belongs to this object only. Copies of it, as the
+   * scratch objects used with WorkStream, need to call this function
+   * themselves.
+   */
+  void
+  precompute_data(const Triangulation<dim, spacedim> &triangulation);
+
+  /**
+   * Release the data stored by precompute_data().
+   */
+  void
+  clear_precomputed_data();
+
   /**
    * Return a reference to the copy of the quadrature formula stored by this
    * object.
@@ -4167,6 +4236,48 @@ private:
    */
   void
   do_reinit();
+
+  /**
+   * The triangulation for which precompute_data() has been called, or
+   * `nullptr`.
+   */
+  const Triangulation<dim, spacedim> *precomputed_triangulation = nullptr;
+
+  /**
+   * Whether precompute_data() stored data for a cell, indexed by the active
+   * cell index.
+   */
+  std::vector<bool> has_precomputed_data;
+
+  /**
+   * The mapping data stored by precompute_data(), indexed by the active
+   * cell index.
+   */
+  std::vector<
+    internal::FEValuesImplementation::MappingRelatedData<dim, spacedim>>
+    precomputed_mapping_output;
+
+  /**
+   * The finite element data stored by precompute_data(), indexed by the
+   * active cell index.
+   */
+  std::vector<
+    internal::FEValuesImplementation::FiniteElementRelatedData<dim, spacedim>>
+    precomputed_finite_element_output;
+
+  /**
+   * The active cell index of the entry of the precomputed data that is
+   * currently exchanged with the output fields of this object, or
+   * numbers::invalid_unsigned_int.
+   */
+  unsigned int swapped_in_cell = numbers::invalid_unsigned_int;
+
+  /**
+   * Connections to the signals of the triangulation that discard the
+   * precomputed data when the mesh changes.
+   */
+  boost::signals2::connection precomputed_data_listener_refinement;
+  boost::signals2::connection precomputed_data_listener_mesh_transform;
 };
 
 
@@ -0,0 +1,303 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+#ifndef dealii_fe_values_batch_h
+#define dealii_fe_values_batch_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/geometry_info.h>
+#include <deal.II/base/point.h>
+#include <deal.II/base/quadrature.h>
+#include <deal.II/base/smartpointer.h>
+#include <deal.II/base/table.h>
+#include <deal.II/base/tensor.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/fe/fe.h>
+
+#include <array>
+
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * @addtogroup feaccess
+ * @{
+ */
+
+/**
+ * A class that computes the values and gradients of shape functions and the
+ * quadrature weights times the Jacobian determinant on several cells at
+ * once, with one cell per lane of a VectorizedArray. It fills the gap
+ * between FEValues, which works on one cell at a time in scalar arithmetic,
+ * and FEEvaluation, which uses sum factorization and does not expose the
+ * individual shape functions. This makes it possible to assemble element
+ * matrices for VectorizedArrayType::size() cells at once and to distribute
+ * them lane by lane, for example with
+ * AffineConstraints::distribute_local_to_global().
+ *
+ * The geometry is described by the d-linear interpolation of the vertices
+ * of each cell, i.e., the results are the same as those of FEValues with a
+ * MappingQ of degree one. Only hypercube cells and primitive finite
+ * elements are supported. For a primitive element, shape_value() and
+ * shape_grad() refer to the only nonzero vector component of a shape
+ * function, like the corresponding functions of FEValues.
+ *
+ * A typical loop looks like this:
+ * @code
+ *   FEValuesBatch<dim> fe_batch(fe, quadrature);
+ *   constexpr unsigned int n_lanes = FEValuesBatch<dim>::n_lanes;
+ *   std::vector<typename DoFHandler<dim>::active_cell_iterator> cells;
+ *   for (const auto &cell : dof_handler.active_cell_iterators())
+ *     {
+ *       cells.push_back(cell);
+ *       if (cells.size() == n_lanes || cell == last_cell)
+ *         {
+ *           fe_batch.reinit(make_array_view(cells));
+ *           // compute the element matrices of all cells in 'cells' with
+ *           // fe_batch.shape_grad(i, q) and fe_batch.JxW(q) and
+ *           // distribute lane v of the result to the cell cells[v]
+ *           cells.clear();
+ *         }
+ *     }
+ * @endcode
+ */
+template <int dim, typename Number = double>
+class FEValuesBatch
+{
+public:
+  /**
+   * The vectorized number type holding one value per cell of the batch.
+   */
+  using VectorizedArrayType = VectorizedArray<Number>;
+
+  /**
+   * The maximal number of cells that can be handled at once.
+   */
+  static constexpr unsigned int n_lanes = VectorizedArrayType::size();
+
+  /**
+   * Number of quadrature points.
+   */
+  const unsigned int n_quadrature_points;
+
+  /**
+   * Number of shape functions per cell.
+   */
+  const unsigned int dofs_per_cell;
+
+  /**
+   * Constructor. Evaluate the shape functions of @p fe and their gradients
+   * on the reference cell in the points of @p quadrature.
+   */
+  FEValuesBatch(const FiniteElement<dim, dim> &fe,
+                const Quadrature<dim> &        quadrature);
+
+  /**
+   * Compute the data for the cells in @p cells, which must contain at least
+   * one and at most #n_lanes cell iterators of any type. Lane $v$ of all
+   * returned values refers to the cell `cells[v]`. The lanes beyond
+   * `cells.size()` repeat the data of the first cell and should be ignored.
+   */
+  template <typename CellIteratorType>
+  void
+  reinit(const ArrayView<CellIteratorType> &cells);
+
+  /**
+   * Return the number of lanes filled by the last call to reinit().
+   */
+  unsigned int
+  n_filled_lanes() const;
+
+  /**
+   * Return the value of shape function @p i in quadrature point @p q_point.
+   * Since the geometry does not enter the shape values, this number is the
+   * same for all cells.
+   */
+  Number
+  shape_value(const unsigned int i, const unsigned int q_point) const;
+
+  /**
+   * Return the gradient of shape function @p i in quadrature point
+   * @p q_point on the cells of the batch.
+   */
+  const Tensor<1, dim, VectorizedArrayType> &
+  shape_grad(const unsigned int i, const unsigned int q_point) const;
+
+  /**
+   * Return the quadrature weight of @p q_point times the Jacobian
+   * determinant of the cells of the batch.
+   */
+  const VectorizedArrayType &
+  JxW(const unsigned int q_point) const;
+
+  /**
+   * Return the finite element this object was constructed with.
+   */
+  const FiniteElement<dim, dim> &
+  get_fe() const;
+
+private:
+  /**
+   * Compute the Jacobians, the JxW values, and the real-space shape
+   * gradients from the vertices stored in #vertices.
+   */
+  void
+  compute_geometry_and_gradients();
+
+  /**
+   * The finite element in use.
+   */
+  const SmartPointer<const FiniteElement<dim, dim>> fe;
+
+  /**
+   * The quadrature weights.
+   */
+  const std::vector<double> weights;
+
+  /**
+   * The number of cells passed to the last call to reinit().
+   */
+  unsigned int n_cells;
+
+  /**
+   * The vertices of the cells of the current batch, one cell per lane.
+   */
+  std::array<Point<dim, VectorizedArrayType>,
+             GeometryInfo<dim>::vertices_per_cell>
+    vertices;
+
+  /**
+   * Values of the shape functions on the reference cell, indexed by shape
+   * function and quadrature point.
+   */
+  Table<2, Number> reference_shape_values;
+
+  /**
+   * Gradients of the shape functions on the reference cell, indexed by
+   * shape function and quadrature point.
+   */
+  Table<2, Tensor<1, dim, Number>> reference_shape_gradients;
+
+  /**
+   * Gradients of the d-linear geometry shape functions associated with the
+   * vertices, indexed by vertex and quadrature point.
+   */
+  Table<2, Tensor<1, dim, Number>> vertex_gradients;
+
+  /**
+   * Gradients of the shape functions on the cells of the current batch,
+   * indexed by shape function and quadrature point.
+   */
+  Table<2, Tensor<1, dim, VectorizedArrayType>> shape_gradients;
+
+  /**
+   * The JxW values on the cells of the current batch.
+   */
+  AlignedVector<VectorizedArrayType> JxW_values;
+};
+
+/** @} */
+
+#ifndef DOXYGEN
+
+/*------------------------ Inline functions ---------------------------------*/
+
+template <int dim, typename Number>
+template <typename CellIteratorType>
+inline void
+FEValuesBatch<dim, Number>::reinit(const ArrayView<CellIteratorType> &cells)
+{
+  Assert(cells.size() > 0, ExcMessage("At least one cell is required."));
+  AssertIndexRange(cells.size(), n_lanes + 1);
+
+  n_cells = cells.size();
+  for (unsigned int lane = 0; lane < n_lanes; ++lane)
+    {
+      const CellIteratorType &cell = cells[lane < n_cells ? lane : 0];
+      Assert(cell->reference_cell().is_hyper_cube(), ExcNotImplemented());
+      for (unsigned int v = 0; v < GeometryInfo<dim>::vertices_per_cell; ++v)
+        {
+          const Point<dim> &vertex = cell->vertex(v);
+          for (unsigned int d = 0; d < dim; ++d)
+            vertices[v][d][lane] = vertex[d];
+        }
+    }
+
+  compute_geometry_and_gradients();
+}
+
+
+
+template <int dim, typename Number>
+inline unsigned int
+FEValuesBatch<dim, Number>::n_filled_lanes() const
+{
+  return n_cells;
+}
+
+
+
+template <int dim, typename Number>
+inline Number
+FEValuesBatch<dim, Number>::shape_value(const unsigned int i,
+                                        const unsigned int q_point) const
+{
+  return reference_shape_values(i, q_point);
+}
+
+
+
+template <int dim, typename Number>
+inline const Tensor<1, dim, VectorizedArray<Number>> &
+FEValuesBatch<dim, Number>::shape_grad(const unsigned int i,
+                                       const unsigned int q_point) const
+{
+  Assert(n_cells > 0,
+         ExcMessage("reinit() needs to be called before accessing data."));
+  return shape_gradients(i, q_point);
+}
+
+
+
+template <int dim, typename Number>
+inline const typename FEValuesBatch<dim, Number>::VectorizedArrayType &
+FEValuesBatch<dim, Number>::JxW(const unsigned int q_point) const
+{
+  Assert(n_cells > 0,
+         ExcMessage("reinit() needs to be called before accessing data."));
+  AssertIndexRange(q_point, n_quadrature_points);
+  return JxW_values[q_point];
+}
+
+
+
+template <int dim, typename Number>
+inline const FiniteElement<dim, dim> &
+FEValuesBatch<dim, Number>::get_fe() const
+{
+  return *fe;
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -324,6 +324,16 @@ public:
      */
     std::vector<Tensor<4, dim>> shape_fourth_derivatives;
 
+    /**
+     * Derivatives of the shape functions at the first unit support point of
+     * the finite element. They are used to compute the constant Jacobian of
+     * cells on which the mapping is affine, see
+     * MappingFE::fill_fe_values().
+     *
+     * Computed once, if derivatives of the mapping are requested.
+     */
+    std::vector<Tensor<1, dim>> affine_shape_derivatives;
+
     /**
      * Unit tangential vectors. Used for the computation of boundary forms and
      * normal vectors.
@@ -20,10 +20,19 @@
 
 #include <deal.II/base/array_view.h>
 #include <deal.II/base/ndarray.h>
+#include <deal.II/base/parallel.h>
 
 #include <deal.II/grid/reference_cell.h>
 #include <deal.II/grid/tria_description.h>
 
+#ifdef DEAL_II_WITH_TBB
+DEAL_II_DISABLE_EXTRA_DIAGNOSTICS
+#  include <tbb/parallel_sort.h>
+DEAL_II_ENABLE_EXTRA_DIAGNOSTICS
+#endif
+
+#include <algorithm>
+
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -987,6 +996,23 @@ namespace internal
 
 
 
+    /**
+     * Sort the given keys, using all available threads if deal.II has been
+     * configured with TBB.
+     */
+    template <typename Key>
+    void
+    sort_keys(std::vector<Key> &keys)
+    {
+#ifdef DEAL_II_WITH_TBB
+      tbb::parallel_sort(keys.begin(), keys.end());
+#else
+      std::sort(keys.begin(), keys.end());
+#endif
+    }
+
+
+
     /**
      * Build entities of dimension d (with 0<d<dim). Entities are described by
      * a set of vertices.
@@ -1042,63 +1068,79 @@ namespace internal
       std::vector<dealii::ReferenceCell>                ad_entity_types;
       std::vector<std::array<unsigned int, key_length>> ad_compatibility;
 
-      keys.reserve(n_entities);
-      ad_entity_vertices.reserve(n_entities);
-      ad_entity_types.reserve(n_entities);
-      ad_compatibility.reserve(n_entities);
+      keys.resize(n_entities);
+      ad_entity_vertices.resize(n_entities);
+      ad_entity_types.resize(n_entities);
+      if (compatibility_mode)
+        ad_compatibility.resize(n_entities);
 
       ptr_d.resize(cell_types_index.size() + 1);
       ptr_d[0] = 0;
+      for (unsigned int c = 0; c < cell_types_index.size(); ++c)
+        ptr_d[c + 1] =
+          ptr_d[c] + cell_types[static_cast<types::geometric_entity_type>(
+                                  cell_types_index[c])]
+                       ->n_entities(d);
 
       static const unsigned int offset = 1;
 
-      // loop over all cells
-      for (unsigned int c = 0, counter = 0; c < cell_types_index.size(); ++c)
-        {
-          const auto &cell_type =
-            cell_types[static_cast<types::geometric_entity_type>(
-              cell_types_index[c])];
-          ptr_d[c + 1] = ptr_d[c] + cell_type->n_entities(d);
-
-          // ... collect vertices of cell
-          const dealii::ArrayView<const unsigned int> cell_vertice(
-            cell_vertices.data() + cell_ptr[c], cell_ptr[c + 1] - cell_ptr[c]);
-
-          // ... loop over all its entities
-          for (unsigned int e = 0; e < cell_type->n_entities(d); ++e)
+      // loop over all cells. since the position of the entities of each cell
+      // is given by ptr_d, the cells can be processed in parallel
+      parallel::apply_to_subranges(
+        0U,
+        static_cast<unsigned int>(cell_types_index.size()),
+        [&](const unsigned int begin, const unsigned int end) {
+          for (unsigned int c = begin; c < end; ++c)
             {
-              // ... determine global entity vertices
-              const auto &local_entity_vertices =
-                cell_type->vertices_of_entity(d, e);
+              const auto &cell_type =
+                cell_types[static_cast<types::geometric_entity_type>(
+                  cell_types_index[c])];
+
+              // ... collect vertices of cell
+              const dealii::ArrayView<const unsigned int> cell_vertice(
+                cell_vertices.data() + cell_ptr[c],
+                cell_ptr[c + 1] - cell_ptr[c]);
+
+              // ... loop over all its entities
+              for (unsigned int e = 0, counter = ptr_d[c];
+                   e < cell_type->n_entities(d);
+                   ++e, ++counter)
+                {
+                  // ... determine global entity vertices
+                  const auto &local_entity_vertices =
+                    cell_type->vertices_of_entity(d, e);
 
-              std::array<unsigned int, key_length> entity_vertices;
-              std::fill(entity_vertices.begin(), entity_vertices.end(), 0);
+                  std::array<unsigned int, key_length> entity_vertices;
+                  std::fill(entity_vertices.begin(), entity_vertices.end(), 0);
 
-              for (unsigned int i = 0; i < local_entity_vertices.size(); ++i)
-                entity_vertices[i] =
-                  cell_vertice[local_entity_vertices[i]] + offset;
+                  for (unsigned int i = 0; i < local_entity_vertices.size();
+                       ++i)
+                    entity_vertices[i] =
+                      cell_vertice[local_entity_vertices[i]] + offset;
 
-              // ... create key
-              std::array<unsigned int, key_length> key = entity_vertices;
-              std::sort(key.begin(), key.end());
-              keys.emplace_back(key, counter++);
+                  // ... create key
+                  std::array<unsigned int, key_length> key = entity_vertices;
+                  std::sort(key.begin(), key.end());
+                  keys[counter] = std::make_tuple(key, counter);
 
-              ad_entity_vertices.emplace_back(entity_vertices);
+                  ad_entity_vertices[counter] = entity_vertices;
 
-              ad_entity_types.emplace_back(cell_type->type_of_entity(d, e));
+                  ad_entity_types[counter] = cell_type->type_of_entity(d, e);
 
-              if (compatibility_mode)
-                ad_compatibility.emplace_back(
-                  second_key_function(entity_vertices, cell_type, c, e));
+                  if (compatibility_mode)
+                    ad_compatibility[counter] =
+                      second_key_function(entity_vertices, cell_type, c, e);
+                }
             }
-        }
+        },
+        1000);
 
       col_d.resize(keys.size());
       orientations.resize(keys.size());
 
       // step 2: sort according to key so that entities with same key can be
       // merged
-      std::sort(keys.begin(), keys.end());
+      sort_keys(keys);
 
 
       if (compatibility_mode)
@@ -1128,18 +1170,23 @@ namespace internal
               std::get<0>(keys[i]) = new_key;
             }
 
-          std::sort(keys.begin(), keys.end());
+          sort_keys(keys);
 
           ptr_0.reserve(n_unique_entities);
           col_0.reserve(n_unique_entity_vertices);
         }
 
 
+      // step 3: enumerate the unique entities and remember for each entity
+      // the entity with the same key that defines the default orientation
       std::array<unsigned int, key_length> ref_key;
-      std::array<unsigned int, key_length> ref_indices;
       std::fill(ref_key.begin(), ref_key.end(), 0);
 
-      for (unsigned int i = 0, counter = dealii::numbers::invalid_unsigned_int;
+      std::vector<unsigned int> ref_offsets(keys.size());
+
+      for (unsigned int i = 0,
+                        counter  = dealii::numbers::invalid_unsigned_int,
+                        ref_offset = 0;
            i < keys.size();
            i++)
         {
@@ -1149,27 +1196,34 @@ namespace internal
             {
               // new key
               counter++;
-              ref_key     = std::get<0>(keys[i]);
-              ref_indices = ad_entity_vertices[offset_i];
+              ref_key    = std::get<0>(keys[i]);
+              ref_offset = offset_i;
 
               ptr_0.push_back(col_0.size());
               for (const auto j : ad_entity_vertices[offset_i])
                 if (j != 0)
                   col_0.push_back(j - offset);
-
-              // take its orientation as default
-              col_d[offset_i]        = counter;
-              orientations[offset_i] = 1;
-            }
-          else
-            {
-              col_d[offset_i] = counter;
-              orientations[offset_i] =
-                ad_entity_types[offset_i].compute_orientation(
-                  ad_entity_vertices[offset_i], ref_indices);
             }
+
+          col_d[offset_i]       = counter;
+          ref_offsets[offset_i] = ref_offset;
         }
       ptr_0.push_back(col_0.size());
+
+      // step 4: compute the orientations relative to the default one in
+      // parallel
+      parallel::apply_to_subranges(
+        0U,
+        static_cast<unsigned int>(keys.size()),
+        [&](const unsigned int begin, const unsigned int end) {
+          for (unsigned int i = begin; i < end; ++i)
+            orientations[i] =
+              (ref_offsets[i] == i) ?
+                1 :
+                ad_entity_types[i].compute_orientation(
+                  ad_entity_vertices[i], ad_entity_vertices[ref_offsets[i]]);
+        },
+        1000);
     }
 
 
@@ -341,6 +341,8 @@ public:
     assimp,
     /// Use read_exodusii()
     exodusii,
+    /// Use read_dealii_binary()
+    dealii_binary,
   };
 
   /**
@@ -433,6 +435,34 @@ public:
   void
   read_vtu(std::istream &in);
 
+  /**
+   * Read a coarse mesh, and possibly its refinement history, in the binary
+   * format written by GridOut::write_dealii_binary().
+   *
+   * The file consists of a short header followed by flat arrays of the
+   * vertex coordinates, the cell connectivity, the material and manifold ids
+   * of the cells, the boundary and manifold ids of faces and edges, and the
+   * refinement cases of all refined cells level by level. Each of these
+   * arrays is read with a single unformatted read, so there is no parsing
+   * step, and since the layout is flat the file can also be memory-mapped by
+   * other tools.
+   *
+   * Since the data has been written from a valid Triangulation, none of the
+   * fix-ups applied by the other readers (deletion of unused vertices,
+   * reordering of cells) is performed. If the file contains a refinement
+   * history, the refinement is replayed level by level after the coarse
+   * triangulation has been created. Manifolds that should be used to place
+   * new vertices must therefore be attached to the triangulation before
+   * calling this function for vertices to end up at the same positions as in
+   * the written mesh.
+   *
+   * The file must have been written for the same @p dim and @p spacedim and
+   * on a machine with the same byte order; otherwise, an exception is
+   * thrown.
+   */
+  void
+  read_dealii_binary(std::istream &in);
+
 
   /**
    * Read grid data from an unv file as generated by the Salome mesh
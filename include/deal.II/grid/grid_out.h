@@ -1020,7 +1020,9 @@ public:
     /// write() calls write_vtk()
     vtk,
     /// write() calls write_vtu()
-    vtu
+    vtu,
+    /// write() calls write_dealii_binary()
+    dealii_binary
   };
 
   /**
@@ -1341,6 +1343,52 @@ public:
   void
   write_vtu(const Triangulation<dim, spacedim> &tria, std::ostream &out) const;
 
+  /**
+   * Write the triangulation in the vtu format into a single file, with all
+   * processes of the communicator of the triangulation participating. Each
+   * process contributes the cells it owns, see
+   * @ref GlossLocallyOwnedCell "locally owned cells", and the file is
+   * written collectively through MPI-IO, as in
+   * DataOutInterface::write_vtu_in_parallel(). This avoids both gathering
+   * the mesh on one process and setting up a DataOut object only for the
+   * purpose of writing the mesh. For a serial triangulation, this function
+   * writes the same file as write_vtu().
+   *
+   * The flag GridOutFlags::Vtu::serialize_triangulation is not supported by
+   * this function.
+   */
+  template <int dim, int spacedim>
+  void
+  write_vtu_in_parallel(const Triangulation<dim, spacedim> &tria,
+                        const std::string &                 filename) const;
+
+  /**
+   * Write the coarse mesh of the triangulation, together with the
+   * refinement cases of all refined cells, in a binary format that can be
+   * read back with GridIn::read_dealii_binary().
+   *
+   * After a header that identifies the format, its version, the dimensions
+   * and the byte order, the file contains flat arrays, each preceded by its
+   * length as a 64-bit integer: the vertex coordinates of the coarse mesh,
+   * the number of vertices and the vertex indices of the coarse cells, their
+   * material and manifold ids, the vertices and boundary and manifold ids of
+   * all lines and quads that do not have default ids, and finally the number
+   * of cells on each level and the refinement case of each of these cells.
+   * All ids are stored as 32-bit unsigned integers. The format is meant for
+   * quickly storing and restoring meshes on the same kind of machine, not as
+   * a portable archival format.
+   *
+   * The refinement is only written for serial triangulations. For
+   * triangulations derived from parallel::TriangulationBase, only the coarse
+   * mesh is written. Vertices that have been moved after refinement do not
+   * keep their positions, since the refinement is replayed when reading the
+   * file.
+   */
+  template <int dim, int spacedim>
+  void
+  write_dealii_binary(const Triangulation<dim, spacedim> &tria,
+                      std::ostream &                      out) const;
+
   /**
    * Write triangulation in VTU format for each processor, and add a .pvtu file
    * for visualization in VisIt or Paraview that describes the collection of VTU
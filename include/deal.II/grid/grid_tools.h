@@ -954,8 +954,16 @@ namespace GridTools
    * Mapping::transform_unit_to_real(qpoints[c][0])
    * returns @p points[a].
    *
-   * The algorithm builds an rtree of @p points to sort them spatially, before
-   * attempting to call find_active_cell_around_point().
+   * The algorithm builds an rtree of @p points to sort them spatially. For
+   * each cell bounding box of the @p cache, all points within the box are
+   * first mapped to the unit cell of the box's cell at once with
+   * Mapping::transform_points_real_to_unit_cell(). Only points that do not
+   * lie in the interior of that cell are then passed to
+   * find_active_cell_around_point().
+   * If deal.II is configured with ArborX and Kokkos has been initialized,
+   * e.g., with `Kokkos::ScopeGuard`, the points within the cell bounding
+   * boxes are instead found with a single batched query to an
+   * ArborXWrappers::BVH of @p points, which processes the boxes in parallel.
    *
    * @note This function is not implemented for the codimension one case (<tt>spacedim != dim</tt>).
    *
@@ -2343,6 +2351,25 @@ namespace GridTools
                                  Triangulation<dim, spacedim> &triangulation,
                                  const bool group_siblings = true);
 
+  /**
+   * Return the active cells of the given triangulation in the order of the
+   * space-filling curve that is used by partition_triangulation_zorder()
+   * (and by the p4est library): the coarse cells are sorted hierarchically
+   * by their connectivity, and the active descendants of each coarse cell
+   * are traversed depth first in the order of their child numbers.
+   *
+   * Active cell iterators traverse the cells level by level in the order in
+   * which they have been created, so that consecutive cells may be far apart
+   * after several cycles of adaptive refinement. Looping over the vector
+   * returned by this function instead visits neighboring cells one after
+   * the other, which improves the memory locality of the data accessed on
+   * each cell, e.g., during assembly. The vector needs to be recomputed
+   * whenever the triangulation changes.
+   */
+  template <int dim, int spacedim>
+  std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>
+  get_active_cells_in_zorder(const Triangulation<dim, spacedim> &triangulation);
+
   /**
    * Partitions the cells of a multigrid hierarchy by assigning level subdomain
    * ids using the "youngest child" rule, that is, each cell in the hierarchy is
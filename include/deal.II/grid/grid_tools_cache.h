@@ -54,6 +54,15 @@ namespace GridTools
    * changed due to a Triangulation::Signals::any_change() signal being
    * triggered.
    *
+   * For serial triangulations, the vertex to cell map is not rebuilt from
+   * scratch after a call to
+   * Triangulation::execute_coarsening_and_refinement() that changed only a
+   * small part of the mesh. Instead, the cells that have been coarsened and
+   * refined are tracked through the
+   * Triangulation::Signals::pre_coarsening_on_cell and
+   * Triangulation::Signals::post_refinement_on_cell signals, and only the
+   * entries of the vertices of these cells are updated.
+   *
    * If the triangulation changes for other reasons, for example because you
    * use it in conjunction with a MappingQEulerian object that sees the
    * vertices through its own transformation, or because you manually change
@@ -310,6 +319,62 @@ namespace GridTools
      * Storage for the status of the triangulation signal.
      */
     boost::signals2::connection tria_signal;
+
+    /**
+     * Storage for the status of the signals used to track the cells changed
+     * by Triangulation::execute_coarsening_and_refinement().
+     */
+    std::vector<boost::signals2::connection> refinement_signals;
+
+    /**
+     * Whether we are currently within a call to
+     * Triangulation::execute_coarsening_and_refinement() whose changes are
+     * being tracked.
+     */
+    bool track_refinement;
+
+    /**
+     * The parents of the cells that have been coarsened away during the
+     * current call to Triangulation::execute_coarsening_and_refinement().
+     */
+    std::vector<typename Triangulation<dim, spacedim>::cell_iterator>
+      coarsened_cells;
+
+    /**
+     * The vertices of the children of the cells in @p coarsened_cells,
+     * recorded before these children were removed.
+     */
+    std::vector<unsigned int> vertices_of_coarsened_cells;
+
+    /**
+     * The cells that have been refined during the current call to
+     * Triangulation::execute_coarsening_and_refinement().
+     */
+    std::vector<typename Triangulation<dim, spacedim>::cell_iterator>
+      refined_cells;
+
+    /**
+     * Record that the children of @p cell are about to be coarsened away.
+     */
+    void
+    pre_coarsening_on_cell(
+      const typename Triangulation<dim, spacedim>::cell_iterator &cell);
+
+    /**
+     * Update the vertex to cell map for the cells recorded in
+     * @p coarsened_cells and @p refined_cells, or mark it for a complete
+     * update if too many cells have changed, and mark all other data
+     * structures for update.
+     */
+    void
+    update_after_refinement();
+
+    /**
+     * Recompute the entries of the vertex to cell map that belong to the
+     * vertices of the changed cells.
+     */
+    void
+    update_vertex_to_cell_map_after_refinement();
   };
 
 
@@ -451,6 +451,20 @@ public:
   get_new_point(const ArrayView<const Point<spacedim>> &surrounding_points,
                 const ArrayView<const double> &         weights) const override;
 
+  /**
+   * Compute a collection of new points on the CylindricalManifold, with the
+   * same result as calling get_new_point() for each row of @p weights.
+   *
+   * The new points that lie on the axis are computed directly. All other
+   * ones are computed with a single call to ChartManifold::get_new_points(),
+   * which pulls the surrounding points back to the chart only once rather
+   * than once for each new point.
+   */
+  virtual void
+  get_new_points(const ArrayView<const Point<spacedim>> &surrounding_points,
+                 const Table<2, double> &                weights,
+                 ArrayView<Point<spacedim>> new_points) const override;
+
 private:
   /**
    * A vector orthogonal to the normal direction.
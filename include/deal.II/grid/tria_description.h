@@ -650,6 +650,134 @@ namespace TriangulationDescription
       const TriangulationDescription::Settings setting =
         TriangulationDescription::Settings::default_setting);
 
+    /**
+     * Construct a TriangulationDescription::Description for a coarse mesh
+     * that is given in pieces, with each process providing the cells it
+     * owns, e.g., read from its part of a pre-partitioned mesh file. In
+     * contrast to the functions above, the global mesh is never stored on a
+     * single process, which makes it possible to set up a
+     * parallel::fullydistributed::Triangulation for meshes that are too
+     * large for the memory of a single node.
+     *
+     * The ghost layer, i.e., the cells of other processes that share a
+     * vertex with a locally owned cell, is determined by the consensus
+     * algorithms of Utilities::MPI::ConsensusAlgorithms: each vertex on the
+     * surface of the local piece of the mesh is registered at a process
+     * determined by its global index, which then informs all processes that
+     * registered the same vertex about each other, and the processes send
+     * each other copies of the cells adjacent to the shared vertices. The
+     * communication is thus restricted to the neighboring processes and the
+     * surfaces of the pieces.
+     *
+     * @code
+     * // read the cells of this process from a partitioned mesh file
+     * std::vector<Point<dim>>                  vertices;
+     * std::vector<types::global_vertex_index> global_vertex_indices;
+     * std::vector<CellData<dim>>              cells;
+     * std::vector<types::coarse_cell_id>      coarse_cell_ids;
+     * SubCellData                             subcell_data;
+     * // ... fill the vectors ...
+     *
+     * const TriangulationDescription::Description<dim, dim> description =
+     *   TriangulationDescription::Utilities::
+     *     create_description_from_partitioned_cells<dim, dim>(
+     *       vertices, global_vertex_indices, cells, coarse_cell_ids,
+     *       subcell_data, comm);
+     *
+     * parallel::fullydistributed::Triangulation<dim> tria_pft(comm);
+     * tria_pft.create_triangulation(description);
+     * @endcode
+     *
+     * @param vertices The vertices of the locally owned cells, in an
+     *   arbitrary local numbering.
+     * @param global_vertex_indices The global index of each entry of
+     *   @p vertices. Vertices shared between processes must have the same
+     *   global index on all of them.
+     * @param cells The locally owned cells, with the vertex indices
+     *   referring to entries of @p vertices. As for the serial
+     *   Triangulation::create_triangulation(), the cells of the global mesh
+     *   must be consistently oriented, see GridTools::consistently_order_cells().
+     * @param coarse_cell_ids The unique global id of each of the @p cells,
+     *   see @ref GlossCoarseCellId.
+     * @param subcell_data The boundary and manifold ids of the faces of the
+     *   locally owned cells, with the vertex indices referring to entries of
+     *   @p vertices: the entries of SubCellData::boundary_lines in 2d, and
+     *   of SubCellData::boundary_quads in 3d. Faces not listed get the
+     *   default boundary id zero and the flat manifold id. The manifold ids
+     *   of the edges in 3d given in SubCellData::boundary_lines are not
+     *   considered.
+     * @param comm MPI communicator.
+     * @param smoothing Mesh smoothing type.
+     * @param settings See the description of the Settings enumerator.
+     * @return Description to be used to set up a Triangulation.
+     *
+     * @note This is a collective operation.
+     */
+    template <int dim, int spacedim = dim>
+    Description<dim, spacedim>
+    create_description_from_partitioned_cells(
+      const std::vector<Point<spacedim>> &           vertices,
+      const std::vector<types::global_vertex_index> &global_vertex_indices,
+      const std::vector<dealii::CellData<dim>> &     cells,
+      const std::vector<types::coarse_cell_id> &     coarse_cell_ids,
+      const SubCellData &                            subcell_data,
+      const MPI_Comm &                               comm,
+      const typename Triangulation<dim, spacedim>::MeshSmoothing smoothing =
+        dealii::Triangulation<dim, spacedim>::none,
+      const TriangulationDescription::Settings settings =
+        TriangulationDescription::Settings::default_setting);
+
+    /**
+     * Construct a TriangulationDescription::Description for the mesh that
+     * GridGenerator::subdivided_hyper_rectangle() creates for the same
+     * arguments, i.e., a hyper rectangle with corners @p p1 and @p p2 that
+     * is subdivided into @p repetitions[d] coarse cells in coordinate
+     * direction d.
+     *
+     * In contrast to the functions above, neither the global mesh nor a
+     * serial Triangulation is ever created: the coarse cells are numbered
+     * lexicographically, each process owns a contiguous range of this
+     * numbering of roughly equal size, and the locally owned cells as well as
+     * the ghost cells around them are computed directly from their indices
+     * without any communication. The effort of this function is thus
+     * proportional to the number of locally relevant cells, which makes it
+     * possible to set up a parallel::fullydistributed::Triangulation with a
+     * very large number of coarse cells.
+     *
+     * @code
+     * parallel::fullydistributed::Triangulation<dim> tria_pft(comm);
+     * tria_pft.create_triangulation(
+     *   TriangulationDescription::Utilities::
+     *     create_description_from_subdivided_hyper_rectangle<dim>(
+     *       repetitions, p1, p2, comm));
+     * @endcode
+     *
+     * @param repetitions The number of coarse cells in each coordinate
+     *   direction.
+     * @param p1 One corner of the hyper rectangle.
+     * @param p2 The opposite corner of the hyper rectangle.
+     * @param comm MPI communicator.
+     * @param colorize If true, the boundary ids are set as in
+     *   GridGenerator::subdivided_hyper_rectangle(), i.e., the faces at the
+     *   lower and upper end of coordinate direction d get the boundary ids
+     *   2d and 2d+1. Otherwise, all boundary faces get boundary id zero.
+     * @param smoothing Mesh smoothing type.
+     * @param settings See the description of the Settings enumerator.
+     * @return Description to be used to set up a Triangulation.
+     */
+    template <int dim>
+    Description<dim, dim>
+    create_description_from_subdivided_hyper_rectangle(
+      const std::vector<unsigned int> &repetitions,
+      const Point<dim> &               p1,
+      const Point<dim> &               p2,
+      const MPI_Comm &                 comm,
+      const bool                       colorize = false,
+      const typename Triangulation<dim, dim>::MeshSmoothing smoothing =
+        dealii::Triangulation<dim, dim>::none,
+      const TriangulationDescription::Settings settings =
+        TriangulationDescription::Settings::default_setting);
+
   } // namespace Utilities
 
 
@@ -356,6 +356,13 @@ namespace internal
       /**
        * Pointer which is not used by the library but may be accessed and set
        * by the user to handle data local to a line/quad/etc.
+       *
+       * Since most programs never use the user data, this vector is only
+       * allocated, for all objects at once, upon the first write access
+       * through user_pointer() or user_index(), and it is released by
+       * clear_user_data(). As long as it is empty, all user pointers are
+       * @p nullptr and all user indices are zero. As a consequence, the first
+       * write access must not happen concurrently from several threads.
        */
       std::vector<UserData> user_data;
 
@@ -434,7 +441,9 @@ namespace internal
              ExcPointerIndexClash());
       user_data_type = data_pointer;
 
-      AssertIndexRange(i, user_data.size());
+      AssertIndexRange(i, n_objects());
+      if (i >= user_data.size())
+        user_data.resize(n_objects());
       return user_data[i].p;
     }
 
@@ -446,8 +455,8 @@ namespace internal
              ExcPointerIndexClash());
       user_data_type = data_pointer;
 
-      AssertIndexRange(i, user_data.size());
-      return user_data[i].p;
+      AssertIndexRange(i, n_objects());
+      return i < user_data.size() ? user_data[i].p : nullptr;
     }
 
 
@@ -458,7 +467,9 @@ namespace internal
              ExcPointerIndexClash());
       user_data_type = data_index;
 
-      AssertIndexRange(i, user_data.size());
+      AssertIndexRange(i, n_objects());
+      if (i >= user_data.size())
+        user_data.resize(n_objects());
       return user_data[i].i;
     }
 
@@ -466,8 +477,9 @@ namespace internal
     inline void
     TriaObjects::clear_user_data(const unsigned int i)
     {
-      AssertIndexRange(i, user_data.size());
-      user_data[i].i = 0;
+      AssertIndexRange(i, n_objects());
+      if (i < user_data.size())
+        user_data[i].i = 0;
     }
 
 
@@ -496,8 +508,8 @@ namespace internal
              ExcPointerIndexClash());
       user_data_type = data_index;
 
-      AssertIndexRange(i, user_data.size());
-      return user_data[i].i;
+      AssertIndexRange(i, n_objects());
+      return i < user_data.size() ? user_data[i].i : 0;
     }
 
 
@@ -505,8 +517,8 @@ namespace internal
     TriaObjects::clear_user_data()
     {
       user_data_type = data_unknown;
-      for (auto &data : user_data)
-        data.p = nullptr;
+      user_data.clear();
+      user_data.shrink_to_fit();
     }
 
 
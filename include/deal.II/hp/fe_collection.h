@@ -24,7 +24,13 @@
 
 #include <deal.II/hp/collection.h>
 
+#include <deal.II/lac/full_matrix.h>
+
+#include <array>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <set>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -358,6 +364,36 @@ namespace hp
     hp_quad_dof_identities(const std::set<unsigned int> &fes,
                            const unsigned int            face_no = 0) const;
 
+    /**
+     * Return the face interpolation matrix between the elements with indices
+     * @p fe_index_1 and @p fe_index_2 of this collection, i.e., the matrix
+     * computed by
+     * <code>(*this)[fe_index_1].get_face_interpolation_matrix((*this)[fe_index_2],
+     * matrix, face_no)</code>.
+     *
+     * The matrix is computed the first time it is requested and then stored
+     * in this object, so that subsequent calls (for example, those made by
+     * DoFTools::make_hanging_node_constraints() after every mesh refinement
+     * step) do not have to compute it again. This function may be called
+     * concurrently from several threads. The cache is not copied along with
+     * the collection.
+     */
+    const FullMatrix<double> &
+    get_face_interpolation_matrix(const unsigned int fe_index_1,
+                                  const unsigned int fe_index_2,
+                                  const unsigned int face_no = 0) const;
+
+    /**
+     * Same as get_face_interpolation_matrix(), but for the matrix computed by
+     * <code>(*this)[fe_index_1].get_subface_interpolation_matrix((*this)[fe_index_2],
+     * subface, matrix, face_no)</code>.
+     */
+    const FullMatrix<double> &
+    get_subface_interpolation_matrix(const unsigned int fe_index_1,
+                                     const unsigned int fe_index_2,
+                                     const unsigned int subface,
+                                     const unsigned int face_no = 0) const;
+
 
     /**
      * Return the indices of finite elements in this FECollection that dominate
@@ -848,6 +884,86 @@ namespace hp
      */
 
   private:
+    /**
+     * A cache for data that only depends on pairs (or sets) of elements of
+     * this collection and that is needed over and over again, for example
+     * after every mesh refinement step:
+     * - The face and subface interpolation matrices handed out by
+     *   get_face_interpolation_matrix() and
+     *   get_subface_interpolation_matrix(), indexed by the two element
+     *   indices, the subface (or numbers::invalid_unsigned_int for face
+     *   matrices), and the face number.
+     * - The identities returned by hp_vertex_dof_identities(),
+     *   hp_line_dof_identities(), and hp_quad_dof_identities(), indexed by
+     *   the dimension of the object, the face number (or
+     *   numbers::invalid_unsigned_int for vertices and lines), and the set of
+     *   element indices.
+     *
+     * Copies and moves of this object start out empty, since the elements at
+     * a given index of the collection copied to need not be the same as those
+     * of the collection copied from.
+     */
+    class Cache
+    {
+    public:
+      Cache() = default;
+
+      Cache(const Cache &)
+      {}
+
+      Cache(Cache &&) noexcept
+      {}
+
+      Cache &
+      operator=(const Cache &)
+      {
+        clear();
+        return *this;
+      }
+
+      Cache &
+      operator=(Cache &&) noexcept
+      {
+        clear();
+        return *this;
+      }
+
+      void
+      clear()
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        interpolation_matrices.clear();
+        dof_identities.clear();
+      }
+
+      std::mutex mutex;
+
+      std::map<std::array<unsigned int, 4>, std::unique_ptr<FullMatrix<double>>>
+        interpolation_matrices;
+
+      std::map<std::pair<std::array<unsigned int, 2>, std::set<unsigned int>>,
+               std::vector<std::map<unsigned int, unsigned int>>>
+        dof_identities;
+    };
+
+    /**
+     * The cache of interpolation matrices and DoF identities.
+     */
+    mutable Cache cache;
+
+    /**
+     * Return the identities between the degrees of freedom of the elements
+     * with indices @p fes on objects of dimension @p structdim from the
+     * cache, computing them with @p query_identities if they are not yet
+     * stored there.
+     */
+    template <typename QueryFunction>
+    std::vector<std::map<unsigned int, unsigned int>>
+    get_cached_dof_identities(const unsigned int            structdim,
+                              const unsigned int            face_no,
+                              const std::set<unsigned int> &fes,
+                              const QueryFunction &         query_identities) const;
+
     /**
      * A linear mapping collection for all reference cell types of each index
      * of this object.
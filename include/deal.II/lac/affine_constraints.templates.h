@@ -21,10 +21,12 @@
 #include <deal.II/base/cuda_size.h>
 #include <deal.II/base/memory_consumption.h>
 #include <deal.II/base/mpi_compute_index_owner_internal.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/table.h>
 #include <deal.II/base/thread_local_storage.h>
 
 #include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/block_csr_sparse_matrix.h>
 #include <deal.II/lac/block_sparse_matrix.h>
 #include <deal.II/lac/block_sparse_matrix_ez.h>
 #include <deal.II/lac/block_sparsity_pattern.h>
@@ -54,6 +56,7 @@
 
 #include <algorithm>
 #include <complex>
+#include <cstdint>
 #include <iomanip>
 #include <numeric>
 #include <ostream>
@@ -410,17 +413,23 @@ namespace internal
 
           std::vector<ConstraintType> data;
 
+          // note: at this stage locally_relevant_constraints still
+          // contains only locally owned constraints. both these and the
+          // requested indices are sorted, so we can look up the
+          // constraints by walking through both lists at once, rather than
+          // by searching the whole list for each index
+          auto prt = locally_relevant_constraints.begin();
           for (const auto index : rank_and_indices.second)
             {
-              // note: at this stage locally_relevant_constraints still
-              // contains only locally owned constraints
-              const auto prt =
-                std::find_if(locally_relevant_constraints.begin(),
-                             locally_relevant_constraints.end(),
-                             [index](const auto &a) {
-                               return std::get<0>(a) == index;
-                             });
-              if (prt != locally_relevant_constraints.end())
+              prt = std::lower_bound(prt,
+                                     locally_relevant_constraints.end(),
+                                     index,
+                                     [](const auto &a, const auto &index) {
+                                       return std::get<0>(a) < index;
+                                     });
+              if (prt == locally_relevant_constraints.end())
+                break;
+              if (std::get<0>(*prt) == index)
                 data.push_back(*prt);
             }
 
@@ -600,6 +609,7 @@ AffineConstraints<number>::add_entries(
   //
   // in any case: skip this entry if an entry for this column already
   // exists, since we don't want to enter it twice
+  line.entries.reserve(line.entries.size() + col_weight_pairs.size());
   for (const std::pair<size_type, number> &col_weight_pair : col_weight_pairs)
     {
       Assert(constrained_dof_index != col_weight_pair.first,
@@ -658,21 +668,27 @@ AffineConstraints<number>::close()
   if (sorted == true)
     return;
 
-  // sort the lines
-  std::sort(lines.begin(), lines.end());
+  // all of the following steps except for the last one work on the
+  // individual lines independently of each other, so we can do them in
+  // parallel. make sure that the index set of local lines is compressed
+  // before, since its queries are not thread-safe otherwise
+  local_lines.compress();
+  constexpr unsigned int grainsize = 256;
 
-  // update list of pointers and give the vector a sharp size since we
-  // won't modify the size any more after this point.
+  // sort the lines. since lines_cache is ordered by the index of the
+  // constrained dofs, this simply amounts to moving the lines into the
+  // order given by lines_cache and updating the pointers
   {
-    std::vector<size_type> new_lines(lines_cache.size(),
-                                     numbers::invalid_size_type);
-    size_type              counter = 0;
-    for (const ConstraintLine &line : lines)
-      {
-        new_lines[calculate_line_index(line.index)] = counter;
-        ++counter;
-      }
-    std::swap(lines_cache, new_lines);
+    std::vector<ConstraintLine> sorted_lines;
+    sorted_lines.reserve(lines.size());
+    for (size_type &position : lines_cache)
+      if (position != numbers::invalid_size_type)
+        {
+          sorted_lines.push_back(std::move(lines[position]));
+          position = sorted_lines.size() - 1;
+        }
+    AssertDimension(sorted_lines.size(), lines.size());
+    lines.swap(sorted_lines);
   }
 
   // in debug mode: check whether we really set the pointers correctly.
@@ -682,248 +698,272 @@ AffineConstraints<number>::close()
              ExcInternalError());
 
   // first, strip zero entries, as we have to do that only once
-  for (ConstraintLine &line : lines)
-    // first remove zero entries. that would mean that in the linear
-    // constraint for a node, x_i = ax_1 + bx_2 + ..., another node times 0
-    // appears. obviously, 0*something can be omitted
-    line.entries.erase(std::remove_if(line.entries.begin(),
-                                      line.entries.end(),
-                                      [](
-                                        const std::pair<size_type, number> &p) {
-                                        return p.second == number(0.);
-                                      }),
-                       line.entries.end());
-
-
-
-#ifdef DEBUG
-  // In debug mode we are computing an estimate for the maximum number
-  // of constraints so that we can bail out if there is a cycle in the
-  // constraints (which is easier than searching for cycles in the graph).
-  //
-  // Let us figure out the largest dof index. This is an upper bound for the
-  // number of constraints because it is an approximation for the number of dofs
-  // in our system.
-  size_type largest_idx = 0;
-  for (const ConstraintLine &line : lines)
-    for (const std::pair<size_type, number> &entry : line.entries)
-      largest_idx = std::max(largest_idx, entry.first);
-#endif
-
-      // replace references to dofs that are themselves constrained. note that
-      // because we may replace references to other dofs that may themselves be
-      // constrained to third ones, we have to iterate over all this until we
-      // replace no chains of constraints any more
-      //
-      // the iteration replaces references to constrained degrees of freedom by
-      // second-order references. for example if x3=x0/2+x2/2 and x2=x0/2+x1/2,
-      // then the new list will be x3=x0/2+x0/4+x1/4. note that x0 appear
-      // twice. we will throw this duplicate out in the following step, where
-      // we sort the list so that throwing out duplicates becomes much more
-      // efficient. also, we have to do it only once, rather than in each
-      // iteration
-#ifdef DEBUG
-  size_type iteration = 0;
-#endif
-  while (true)
-    {
-      bool chained_constraint_replaced = false;
-
-      for (ConstraintLine &line : lines)
+  parallel::apply_to_subranges(
+    size_type(0),
+    lines.size(),
+    [&](const size_type begin, const size_type end) {
+      for (size_type i = begin; i < end; ++i)
         {
-#ifdef DEBUG
-          // we need to keep track of how many replacements we do in this line,
-          // because we can end up in a cycle A->B->C->A without the number of
-          // entries growing.
-          size_type n_replacements = 0;
-#endif
+          // first remove zero entries. that would mean that in the linear
+          // constraint for a node, x_i = ax_1 + bx_2 + ..., another node
+          // times 0 appears. obviously, 0*something can be omitted
+          ConstraintLine &line = lines[i];
+          line.entries.erase(
+            std::remove_if(line.entries.begin(),
+                           line.entries.end(),
+                           [](const std::pair<size_type, number> &p) {
+                             return p.second == number(0.);
+                           }),
+            line.entries.end());
+        }
+    },
+    grainsize);
+
+  // replace references to dofs that are themselves constrained. note that
+  // because we may replace references to other dofs that may themselves be
+  // constrained to third ones, we have to resolve the chains of constraints
+  // in the right order: we call a line resolved once none of its entries
+  // refers to a dof that is constrained by a line stored on the current
+  // processor. in each round, we first determine the lines whose entries
+  // only refer to dofs that are unconstrained or whose lines have been
+  // resolved in earlier rounds, and then expand these lines. this way, the
+  // lines expanded in one round only read lines that are not modified in
+  // that round, so the expansion can run in parallel, and the number of
+  // rounds is the maximal length of the constraint chains.
+  //
+  // the expansion replaces references to constrained degrees of freedom by
+  // second-order references. for example if x3=x0/2+x2/2 and x2=x0/2+x1/2,
+  // then the new list will be x3=x0/2+x0/4+x1/4. note that x0 appear
+  // twice. we will throw this duplicate out in the following step, where
+  // we sort the list so that throwing out duplicates becomes much more
+  // efficient. also, we have to do it only once, rather than in each
+  // round
+  const auto refers_to_constrained_dof =
+    [&](const std::pair<size_type, number> &entry) {
+      return ((local_lines.size() == 0) ||
+              (local_lines.is_element(entry.first))) &&
+             is_constrained(entry.first);
+    };
 
-          // loop over all entries of this line (including ones that we
-          // have appended in this go around) and see whether they are
-          // further constrained. ignore elements that we don't store on
-          // the current processor
-          size_type entry = 0;
-          while (entry < line.entries.size())
-            if (((local_lines.size() == 0) ||
-                 (local_lines.is_element(line.entries[entry].first))) &&
-                is_constrained(line.entries[entry].first))
-              {
-                // ok, this entry is further constrained:
-                chained_constraint_replaced = true;
-
-                // look up the chain of constraints for this entry
-                const size_type dof_index = line.entries[entry].first;
-                const number    weight    = line.entries[entry].second;
-
-                Assert(dof_index != line.index,
-                       ExcMessage("Cycle in constraints detected!"));
-
-                const ConstraintLine &constrained_line =
-                  lines[lines_cache[calculate_line_index(dof_index)]];
-                Assert(constrained_line.index == dof_index, ExcInternalError());
-
-                // now we have to replace an entry by its expansion. we do
-                // that by overwriting the entry by the first entry of the
-                // expansion and adding the remaining ones to the end,
-                // where we will later process them once more
-                //
-                // we can of course only do that if the DoF that we are
-                // currently handle is constrained by a linear combination
-                // of other dofs:
-                if (constrained_line.entries.size() > 0)
-                  {
-                    for (size_type i = 0; i < constrained_line.entries.size();
-                         ++i)
-                      Assert(dof_index != constrained_line.entries[i].first,
-                             ExcMessage("Cycle in constraints detected!"));
-
-                    // replace first entry, then tack the rest to the end
-                    // of the list
-                    line.entries[entry] = std::pair<size_type, number>(
-                      constrained_line.entries[0].first,
-                      constrained_line.entries[0].second * weight);
-
-                    for (size_type i = 1; i < constrained_line.entries.size();
-                         ++i)
-                      line.entries.emplace_back(
-                        constrained_line.entries[i].first,
-                        constrained_line.entries[i].second * weight);
+  // use a character rather than a bool in the flags, so that different lines
+  // can be written concurrently
+  std::vector<std::uint8_t> line_is_resolved(lines.size(), 0);
+  std::vector<std::uint8_t> line_is_ready(lines.size(), 0);
+  std::vector<size_type>    unresolved_lines(lines.size());
+  std::iota(unresolved_lines.begin(), unresolved_lines.end(), size_type(0));
 
-#ifdef DEBUG
-                    // keep track of how many entries we replace in this
-                    // line. If we do more than there are constraints or
-                    // dofs in our system, we must have a cycle.
-                    ++n_replacements;
-                    Assert(n_replacements / 2 < largest_idx,
-                           ExcMessage("Cycle in constraints detected!"));
-                    if (n_replacements / 2 >= largest_idx)
-                      return; // this enables us to test for this Exception.
-#endif
-                  }
-                else
-                  // the DoF that we encountered is not constrained by a
-                  // linear combination of other dofs but is equal to just
-                  // the inhomogeneity (i.e. its chain of entries is
-                  // empty). in that case, we can't just overwrite the
-                  // current entry, but we have to actually eliminate it
+  while (unresolved_lines.empty() == false)
+    {
+      // determine the lines that can be expanded in this round
+      parallel::apply_to_subranges(
+        size_type(0),
+        unresolved_lines.size(),
+        [&](const size_type begin, const size_type end) {
+          for (size_type i = begin; i < end; ++i)
+            {
+              bool is_ready = true;
+              for (const std::pair<size_type, number> &entry :
+                   lines[unresolved_lines[i]].entries)
+                if (refers_to_constrained_dof(entry) &&
+                    (line_is_resolved[lines_cache[calculate_line_index(
+                       entry.first)]] == 0))
                   {
-                    line.entries.erase(line.entries.begin() + entry);
+                    is_ready = false;
+                    break;
                   }
-
-                line.inhomogeneity += constrained_line.inhomogeneity * weight;
-
-                // now that we're here, do not increase index by one but
-                // rather make another pass for the present entry because
-                // we have replaced the present entry by another one, or
-                // because we have deleted it and shifted all following
-                // ones one forward
+              line_is_ready[unresolved_lines[i]] = is_ready;
+            }
+        },
+        grainsize);
+
+      // expand these lines
+      parallel::apply_to_subranges(
+        size_type(0),
+        unresolved_lines.size(),
+        [&](const size_type begin, const size_type end) {
+          for (size_type i = begin; i < end; ++i)
+            if (line_is_ready[unresolved_lines[i]] != 0)
+              {
+                ConstraintLine &line = lines[unresolved_lines[i]];
+
+                // loop over all entries of this line and see whether they
+                // are further constrained. ignore elements that we don't
+                // store on the current processor
+                size_type entry = 0;
+                while (entry < line.entries.size())
+                  if (refers_to_constrained_dof(line.entries[entry]))
+                    {
+                      // look up the chain of constraints for this entry
+                      const size_type dof_index = line.entries[entry].first;
+                      const number    weight    = line.entries[entry].second;
+
+                      const ConstraintLine &constrained_line =
+                        lines[lines_cache[calculate_line_index(dof_index)]];
+                      Assert(constrained_line.index == dof_index,
+                             ExcInternalError());
+
+                      // now we have to replace an entry by its expansion. we
+                      // do that by overwriting the entry by the first entry
+                      // of the expansion and adding the remaining ones to the
+                      // end. since the constrained line has already been
+                      // resolved, none of the new entries needs to be
+                      // expanded any further.
+                      //
+                      // we can of course only do that if the DoF that we are
+                      // currently handle is constrained by a linear
+                      // combination of other dofs:
+                      if (constrained_line.entries.size() > 0)
+                        {
+                          line.entries[entry] = std::pair<size_type, number>(
+                            constrained_line.entries[0].first,
+                            constrained_line.entries[0].second * weight);
+
+                          for (size_type j = 1;
+                               j < constrained_line.entries.size();
+                               ++j)
+                            line.entries.emplace_back(
+                              constrained_line.entries[j].first,
+                              constrained_line.entries[j].second * weight);
+
+                          ++entry;
+                        }
+                      else
+                        // the DoF that we encountered is not constrained by
+                        // a linear combination of other dofs but is equal to
+                        // just the inhomogeneity (i.e. its chain of entries
+                        // is empty). in that case, we can't just overwrite
+                        // the current entry, but we have to actually
+                        // eliminate it and look at the entry that has been
+                        // shifted into its place
+                        line.entries.erase(line.entries.begin() + entry);
+
+                      line.inhomogeneity +=
+                        constrained_line.inhomogeneity * weight;
+                    }
+                  else
+                    // entry not further constrained. just move ahead by one
+                    ++entry;
               }
-            else
-              // entry not further constrained. just move ahead by one
-              ++entry;
-        }
-
-      // if we didn't do anything in this round, then quit the loop
-      if (chained_constraint_replaced == false)
-        break;
-
-#ifdef DEBUG
-      // increase iteration count. note that we should not iterate more
-      // times than there are constraints, since this puts a natural upper
-      // bound on the length of constraint chains
-      ++iteration;
-      Assert(iteration <= lines.size(), ExcInternalError());
-#endif
+        },
+        grainsize);
+
+      // mark the expanded lines as resolved and remove them from the list
+      const auto new_end =
+        std::remove_if(unresolved_lines.begin(),
+                       unresolved_lines.end(),
+                       [&](const size_type line) {
+                         if (line_is_ready[line] == 0)
+                           return false;
+                         line_is_resolved[line] = 1;
+                         return true;
+                       });
+
+      // if no line could be expanded in this round, the remaining lines
+      // must contain a cycle
+      Assert(new_end != unresolved_lines.end(),
+             ExcMessage("Cycle in constraints detected!"));
+      if (new_end == unresolved_lines.end())
+        return; // this enables us to test for this Exception.
+
+      unresolved_lines.erase(new_end, unresolved_lines.end());
     }
 
   // finally sort the entries and re-scale them if necessary. in this step,
   // we also throw out duplicates as mentioned above. moreover, as some
   // entries might have had zero weights, we replace them by a vector with
   // sharp sizes.
-  for (ConstraintLine &line : lines)
-    {
-      std::sort(line.entries.begin(),
-                line.entries.end(),
-                [](const std::pair<unsigned int, number> &a,
-                   const std::pair<unsigned int, number> &b) -> bool {
-                  // Let's use lexicogrpahic ordering with std::abs for number
-                  // type (it might be complex valued).
-                  return (a.first < b.first) ||
-                         (a.first == b.first &&
-                          std::abs(a.second) < std::abs(b.second));
-                });
-
-      // loop over the now sorted list and see whether any of the entries
-      // references the same dofs more than once in order to find how many
-      // non-duplicate entries we have. This lets us allocate the correct
-      // amount of memory for the constraint entries.
-      size_type duplicates = 0;
-      for (size_type i = 1; i < line.entries.size(); ++i)
-        if (line.entries[i].first == line.entries[i - 1].first)
-          duplicates++;
-
-      if (duplicates > 0 || line.entries.size() < line.entries.capacity())
-        {
-          typename ConstraintLine::Entries new_entries;
-
-          // if we have no duplicates, copy verbatim the entries. this way,
-          // the final size is of the vector is correct.
-          if (duplicates == 0)
-            new_entries = line.entries;
-          else
-            {
-              // otherwise, we need to go through the list and resolve the
-              // duplicates
-              new_entries.reserve(line.entries.size() - duplicates);
-              new_entries.push_back(line.entries[0]);
-              for (size_type j = 1; j < line.entries.size(); ++j)
-                if (line.entries[j].first == line.entries[j - 1].first)
-                  {
-                    Assert(new_entries.back().first == line.entries[j].first,
-                           ExcInternalError());
-                    new_entries.back().second += line.entries[j].second;
-                  }
-                else
-                  new_entries.push_back(line.entries[j]);
-
-              Assert(new_entries.size() == line.entries.size() - duplicates,
-                     ExcInternalError());
+  const auto sort_and_rescale_line = [](ConstraintLine &line) {
+    std::sort(line.entries.begin(),
+              line.entries.end(),
+              [](const std::pair<unsigned int, number> &a,
+                 const std::pair<unsigned int, number> &b) -> bool {
+                // Let's use lexicogrpahic ordering with std::abs for number
+                // type (it might be complex valued).
+                return (a.first < b.first) ||
+                       (a.first == b.first &&
+                        std::abs(a.second) < std::abs(b.second));
+              });
+
+    // loop over the now sorted list and see whether any of the entries
+    // references the same dofs more than once in order to find how many
+    // non-duplicate entries we have. This lets us allocate the correct
+    // amount of memory for the constraint entries.
+    size_type duplicates = 0;
+    for (size_type i = 1; i < line.entries.size(); ++i)
+      if (line.entries[i].first == line.entries[i - 1].first)
+        duplicates++;
+
+    if (duplicates > 0 || line.entries.size() < line.entries.capacity())
+      {
+        typename ConstraintLine::Entries new_entries;
 
-              // make sure there are really no duplicates left and that the
-              // list is still sorted
-              for (size_type j = 1; j < new_entries.size(); ++j)
+        // if we have no duplicates, copy verbatim the entries. this way,
+        // the final size is of the vector is correct.
+        if (duplicates == 0)
+          new_entries = line.entries;
+        else
+          {
+            // otherwise, we need to go through the list and resolve the
+            // duplicates
+            new_entries.reserve(line.entries.size() - duplicates);
+            new_entries.push_back(line.entries[0]);
+            for (size_type j = 1; j < line.entries.size(); ++j)
+              if (line.entries[j].first == line.entries[j - 1].first)
                 {
-                  Assert(new_entries[j].first != new_entries[j - 1].first,
-                         ExcInternalError());
-                  Assert(new_entries[j].first > new_entries[j - 1].first,
+                  Assert(new_entries.back().first == line.entries[j].first,
                          ExcInternalError());
+                  new_entries.back().second += line.entries[j].second;
                 }
-            }
+              else
+                new_entries.push_back(line.entries[j]);
 
-          // replace old list of constraints for this dof by the new one
-          line.entries.swap(new_entries);
-        }
+            Assert(new_entries.size() == line.entries.size() - duplicates,
+                   ExcInternalError());
 
-      // Finally do the following check: if the sum of weights for the
-      // constraints is close to one, but not exactly one, then rescale all
-      // the weights so that they sum up to 1. this adds a little numerical
-      // stability and avoids all sorts of problems where the actual value
-      // is close to, but not quite what we expected
-      //
-      // the case where the weights don't quite sum up happens when we
-      // compute the interpolation weights "on the fly", i.e. not from
-      // precomputed tables. in this case, the interpolation weights are
-      // also subject to round-off
-      number sum = 0.;
-      for (const std::pair<size_type, number> &entry : line.entries)
-        sum += entry.second;
-      if (std::abs(sum - number(1.)) < 1.e-13)
-        {
-          for (std::pair<size_type, number> &entry : line.entries)
-            entry.second /= sum;
-          line.inhomogeneity /= sum;
-        }
-    } // end of loop over all constraint lines
+            // make sure there are really no duplicates left and that the
+            // list is still sorted
+            for (size_type j = 1; j < new_entries.size(); ++j)
+              {
+                Assert(new_entries[j].first != new_entries[j - 1].first,
+                       ExcInternalError());
+                Assert(new_entries[j].first > new_entries[j - 1].first,
+                       ExcInternalError());
+              }
+          }
+
+        // replace old list of constraints for this dof by the new one
+        line.entries.swap(new_entries);
+      }
+
+    // Finally do the following check: if the sum of weights for the
+    // constraints is close to one, but not exactly one, then rescale all
+    // the weights so that they sum up to 1. this adds a little numerical
+    // stability and avoids all sorts of problems where the actual value
+    // is close to, but not quite what we expected
+    //
+    // the case where the weights don't quite sum up happens when we
+    // compute the interpolation weights "on the fly", i.e. not from
+    // precomputed tables. in this case, the interpolation weights are
+    // also subject to round-off
+    number sum = 0.;
+    for (const std::pair<size_type, number> &entry : line.entries)
+      sum += entry.second;
+    if (std::abs(sum - number(1.)) < 1.e-13)
+      {
+        for (std::pair<size_type, number> &entry : line.entries)
+          entry.second /= sum;
+        line.inhomogeneity /= sum;
+      }
+  };
+
+  parallel::apply_to_subranges(
+    size_type(0),
+    lines.size(),
+    [&](const size_type begin, const size_type end) {
+      for (size_type i = begin; i < end; ++i)
+        sort_and_rescale_line(lines[i]);
+    },
+    grainsize);
 
 #ifdef DEBUG
   // if in debug mode: check that no dof is constrained to another dof that
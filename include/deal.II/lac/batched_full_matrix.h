@@ -0,0 +1,571 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+#ifndef dealii_batched_full_matrix_h
+#define dealii_batched_full_matrix_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/table.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/lac/exceptions.h>
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/lapack_support.h>
+
+#include <array>
+#include <utility>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * @addtogroup Matrix1
+ * @{
+ */
+
+/**
+ * A batch of small dense square matrices of the same size, stored such that
+ * each entry is a VectorizedArray holding the corresponding entry of
+ * <code>width</code> different matrices, one per lane. The factorizations
+ * and solves of this class work on all lanes at once, which is much faster
+ * than calling LAPACK once per matrix when many matrices of modest size,
+ * say up to a few hundred rows, are to be factorized. A typical example is
+ * the static condensation of local matrices in a hybridized discontinuous
+ * Galerkin method as in step-51, where the matrices of several cells can be
+ * processed together just as in the cell batches of MatrixFree. The class
+ * follows the same approach as TensorProductMatrixSymmetricSum, which
+ * computes the fast diagonalization for several cells at once when
+ * instantiated with a VectorizedArray.
+ *
+ * The interface resembles the one of LAPACKFullMatrix: after filling the
+ * entries, either through operator()() with vectorized values or through
+ * set_lane() for the matrix of one lane, the matrices can be factorized by
+ * compute_lu_factorization() or compute_cholesky_factorization(), or
+ * inverted by invert(), and linear systems are solved by solve(). The state
+ * of the object is tracked with the same LAPACKSupport::State values as in
+ * LAPACKFullMatrix.
+ *
+ * The LU factorization uses partial pivoting, with the pivot rows selected
+ * separately for each lane. All arithmetic operations are vectorized over the
+ * lanes; only the search for the pivot and the row exchanges deal with the
+ * lanes one by one, which is a lower-order cost.
+ *
+ * All lanes are factorized, including those that do not hold a matrix of
+ * interest when fewer than <code>width</code> matrices are available. Such
+ * lanes need to be filled with some regular matrix, e.g., the identity
+ * matrix via set_lane_to_identity(), because a singular matrix in any lane
+ * makes the factorizations throw an exception.
+ */
+template <typename Number, std::size_t width = VectorizedArray<Number>::size()>
+class BatchedFullMatrix
+{
+public:
+  /**
+   * The type of the entries of the matrix, holding the entries of all lanes.
+   */
+  using value_type = VectorizedArray<Number, width>;
+
+  /**
+   * Constructor. Create a batch of square matrices of dimension @p n, with
+   * all entries set to zero.
+   */
+  BatchedFullMatrix(const unsigned int n = 0);
+
+  /**
+   * Change the dimension of the matrices to @p n and set all entries to
+   * zero.
+   */
+  void
+  reinit(const unsigned int n);
+
+  /**
+   * Number of rows of the matrices.
+   */
+  unsigned int
+  m() const;
+
+  /**
+   * Number of columns of the matrices.
+   */
+  unsigned int
+  n() const;
+
+  /**
+   * Read-write access to the entry <code>(i,j)</code> of the matrices of
+   * all lanes. Only allowed in the state LAPACKSupport::matrix.
+   */
+  value_type &
+  operator()(const unsigned int i, const unsigned int j);
+
+  /**
+   * Read access to the entry <code>(i,j)</code> of the matrices of all
+   * lanes.
+   */
+  const value_type &
+  operator()(const unsigned int i, const unsigned int j) const;
+
+  /**
+   * Copy the entries of @p matrix into lane @p lane. The matrix must be
+   * square and of the size given to reinit().
+   */
+  template <typename Number2>
+  void
+  set_lane(const unsigned int lane, const FullMatrix<Number2> &matrix);
+
+  /**
+   * Set the matrix of lane @p lane to the identity matrix. This is intended
+   * for lanes that do not hold a matrix of interest, see the documentation
+   * of the class.
+   */
+  void
+  set_lane_to_identity(const unsigned int lane);
+
+  /**
+   * Copy the entries of lane @p lane into @p matrix, which is resized as
+   * necessary. Depending on the state of the object, this is the matrix, its
+   * inverse, or the factors of a factorization in the same format as
+   * LAPACKFullMatrix.
+   */
+  template <typename Number2>
+  void
+  extract_lane(const unsigned int lane, FullMatrix<Number2> &matrix) const;
+
+  /**
+   * Matrix-vector multiplication <code>dst = A * src</code> for all lanes.
+   * Only allowed in the states LAPACKSupport::matrix and
+   * LAPACKSupport::inverse_matrix.
+   */
+  void
+  vmult(const ArrayView<value_type> &      dst,
+        const ArrayView<const value_type> &src) const;
+
+  /**
+   * Compute the LU factorization of the matrices of all lanes with partial
+   * pivoting. Throws an exception of type LACExceptions::ExcSingular if the
+   * matrix in any of the lanes is singular.
+   */
+  void
+  compute_lu_factorization();
+
+  /**
+   * Compute the Cholesky factorization $A = LL^T$ of the matrices of all
+   * lanes, which must be symmetric and positive definite. Only the lower
+   * triangle of the matrices is used. Throws an exception of type
+   * LACExceptions::ExcSingular if the matrix in any of the lanes is not
+   * positive definite.
+   */
+  void
+  compute_cholesky_factorization();
+
+  /**
+   * Invert the matrices of all lanes, using their LU factorization. If the
+   * object is in the state LAPACKSupport::lu or LAPACKSupport::cholesky, the
+   * existing factorization is used.
+   */
+  void
+  invert();
+
+  /**
+   * Solve the linear systems with the matrices of all lanes and the right
+   * hand side @p v, and return the solution in @p v. Requires that either
+   * compute_lu_factorization() or compute_cholesky_factorization() has been
+   * called before.
+   */
+  void
+  solve(const ArrayView<value_type> &v) const;
+
+  /**
+   * Return the state of the matrix.
+   */
+  LAPACKSupport::State
+  get_state() const;
+
+  /**
+   * Determine an estimate for the memory consumption (in bytes) of this
+   * object.
+   */
+  std::size_t
+  memory_consumption() const;
+
+private:
+  /**
+   * The entries of the matrices, or their factors or inverses.
+   */
+  Table<2, value_type> values;
+
+  /**
+   * The pivot rows selected in each step of the LU factorization, separately
+   * for each lane.
+   */
+  std::vector<std::array<unsigned int, width>> pivots;
+
+  /**
+   * The state of the object.
+   */
+  LAPACKSupport::State state;
+};
+
+/** @} */
+
+/* ----------------------- Inline functions -------------------------- */
+
+#ifndef DOXYGEN
+
+template <typename Number, std::size_t width>
+inline BatchedFullMatrix<Number, width>::BatchedFullMatrix(const unsigned int n)
+  : state(LAPACKSupport::matrix)
+{
+  reinit(n);
+}
+
+
+
+template <typename Number, std::size_t width>
+inline void
+BatchedFullMatrix<Number, width>::reinit(const unsigned int n)
+{
+  values.reinit(n, n);
+  pivots.clear();
+  state = LAPACKSupport::matrix;
+}
+
+
+
+template <typename Number, std::size_t width>
+inline unsigned int
+BatchedFullMatrix<Number, width>::m() const
+{
+  return values.size(0);
+}
+
+
+
+template <typename Number, std::size_t width>
+inline unsigned int
+BatchedFullMatrix<Number, width>::n() const
+{
+  return values.size(1);
+}
+
+
+
+template <typename Number, std::size_t width>
+inline typename BatchedFullMatrix<Number, width>::value_type &
+BatchedFullMatrix<Number, width>::operator()(const unsigned int i,
+                                             const unsigned int j)
+{
+  Assert(state == LAPACKSupport::matrix, LAPACKSupport::ExcState(state));
+  return values(i, j);
+}
+
+
+
+template <typename Number, std::size_t width>
+inline const typename BatchedFullMatrix<Number, width>::value_type &
+BatchedFullMatrix<Number, width>::operator()(const unsigned int i,
+                                             const unsigned int j) const
+{
+  return values(i, j);
+}
+
+
+
+template <typename Number, std::size_t width>
+template <typename Number2>
+inline void
+BatchedFullMatrix<Number, width>::set_lane(const unsigned int         lane,
+                                           const FullMatrix<Number2> &matrix)
+{
+  AssertIndexRange(lane, width);
+  AssertDimension(matrix.m(), m());
+  AssertDimension(matrix.n(), n());
+  Assert(state == LAPACKSupport::matrix, LAPACKSupport::ExcState(state));
+
+  for (unsigned int i = 0; i < m(); ++i)
+    for (unsigned int j = 0; j < n(); ++j)
+      values(i, j)[lane] = matrix(i, j);
+}
+
+
+
+template <typename Number, std::size_t width>
+inline void
+BatchedFullMatrix<Number, width>::set_lane_to_identity(const unsigned int lane)
+{
+  AssertIndexRange(lane, width);
+  Assert(state == LAPACKSupport::matrix, LAPACKSupport::ExcState(state));
+
+  for (unsigned int i = 0; i < m(); ++i)
+    for (unsigned int j = 0; j < n(); ++j)
+      values(i, j)[lane] = (i == j) ? Number(1.) : Number();
+}
+
+
+
+template <typename Number, std::size_t width>
+template <typename Number2>
+inline void
+BatchedFullMatrix<Number, width>::extract_lane(
+  const unsigned int   lane,
+  FullMatrix<Number2> &matrix) const
+{
+  AssertIndexRange(lane, width);
+
+  matrix.reinit(m(), n());
+  for (unsigned int i = 0; i < m(); ++i)
+    for (unsigned int j = 0; j < n(); ++j)
+      matrix(i, j) = values(i, j)[lane];
+}
+
+
+
+template <typename Number, std::size_t width>
+inline void
+BatchedFullMatrix<Number, width>::vmult(
+  const ArrayView<value_type> &      dst,
+  const ArrayView<const value_type> &src) const
+{
+  Assert(state == LAPACKSupport::matrix ||
+           state == LAPACKSupport::inverse_matrix,
+         LAPACKSupport::ExcState(state));
+  AssertDimension(dst.size(), m());
+  AssertDimension(src.size(), n());
+
+  for (unsigned int i = 0; i < m(); ++i)
+    {
+      const value_type *row = &values(i, 0);
+      value_type        sum = row[0] * src[0];
+      for (unsigned int j = 1; j < n(); ++j)
+        sum += row[j] * src[j];
+      dst[i] = sum;
+    }
+}
+
+
+
+template <typename Number, std::size_t width>
+inline void
+BatchedFullMatrix<Number, width>::compute_lu_factorization()
+{
+  Assert(state == LAPACKSupport::matrix, LAPACKSupport::ExcState(state));
+  state = LAPACKSupport::unusable;
+
+  const unsigned int size = m();
+  pivots.resize(size);
+
+  for (unsigned int k = 0; k < size; ++k)
+    {
+      // find the pivot row separately for each lane
+      value_type                       max_value = std::abs(values(k, k));
+      std::array<unsigned int, width> &pivot     = pivots[k];
+      pivot.fill(k);
+      for (unsigned int i = k + 1; i < size; ++i)
+        {
+          const value_type value = std::abs(values(i, k));
+          for (unsigned int v = 0; v < width; ++v)
+            if (value[v] > max_value[v])
+              {
+                max_value[v] = value[v];
+                pivot[v]     = i;
+              }
+        }
+
+      for (unsigned int v = 0; v < width; ++v)
+        {
+          AssertThrow(max_value[v] > Number(), LACExceptions::ExcSingular());
+          if (pivot[v] != k)
+            for (unsigned int j = 0; j < size; ++j)
+              std::swap(values(k, j)[v], values(pivot[v], j)[v]);
+        }
+
+      // eliminate the entries below the diagonal, keeping the multipliers in
+      // the lower triangle
+      const value_type  inverse_diagonal = Number(1.) / values(k, k);
+      const value_type *row_k            = &values(k, 0);
+      for (unsigned int i = k + 1; i < size; ++i)
+        {
+          value_type *     row_i      = &values(i, 0);
+          const value_type multiplier = row_i[k] * inverse_diagonal;
+          row_i[k]                    = multiplier;
+          for (unsigned int j = k + 1; j < size; ++j)
+            row_i[j] -= multiplier * row_k[j];
+        }
+    }
+
+  state = LAPACKSupport::lu;
+}
+
+
+
+template <typename Number, std::size_t width>
+inline void
+BatchedFullMatrix<Number, width>::compute_cholesky_factorization()
+{
+  Assert(state == LAPACKSupport::matrix, LAPACKSupport::ExcState(state));
+  state = LAPACKSupport::unusable;
+
+  const unsigned int size = m();
+  for (unsigned int j = 0; j < size; ++j)
+    {
+      value_type *row_j    = &values(j, 0);
+      value_type  diagonal = row_j[j];
+      for (unsigned int k = 0; k < j; ++k)
+        diagonal -= row_j[k] * row_j[k];
+      for (unsigned int v = 0; v < width; ++v)
+        AssertThrow(diagonal[v] > Number(), LACExceptions::ExcSingular());
+      diagonal                          = std::sqrt(diagonal);
+      row_j[j]                          = diagonal;
+      const value_type inverse_diagonal = Number(1.) / diagonal;
+
+      for (unsigned int i = j + 1; i < size; ++i)
+        {
+          value_type *row_i = &values(i, 0);
+          value_type  sum   = row_i[j];
+          for (unsigned int k = 0; k < j; ++k)
+            sum -= row_i[k] * row_j[k];
+          row_i[j] = sum * inverse_diagonal;
+        }
+    }
+
+  state = LAPACKSupport::cholesky;
+}
+
+
+
+template <typename Number, std::size_t width>
+inline void
+BatchedFullMatrix<Number, width>::invert()
+{
+  Assert(state == LAPACKSupport::matrix || state == LAPACKSupport::lu ||
+           state == LAPACKSupport::cholesky,
+         LAPACKSupport::ExcState(state));
+
+  if (state == LAPACKSupport::matrix)
+    compute_lu_factorization();
+
+  // solve for the columns of the identity matrix, transposing the result
+  // into the row-wise storage of the inverse
+  const unsigned int      size = m();
+  Table<2, value_type>    inverse(size, size);
+  std::vector<value_type> column(size);
+  for (unsigned int j = 0; j < size; ++j)
+    {
+      for (unsigned int i = 0; i < size; ++i)
+        column[i] = (i == j) ? Number(1.) : Number();
+      solve(make_array_view(column));
+      for (unsigned int i = 0; i < size; ++i)
+        inverse(i, j) = column[i];
+    }
+
+  values.swap(inverse);
+  pivots.clear();
+  state = LAPACKSupport::inverse_matrix;
+}
+
+
+
+template <typename Number, std::size_t width>
+inline void
+BatchedFullMatrix<Number, width>::solve(const ArrayView<value_type> &v) const
+{
+  AssertDimension(v.size(), m());
+
+  const unsigned int size = m();
+  if (state == LAPACKSupport::lu)
+    {
+      // forward substitution with the unit lower triangle, interleaved with
+      // the row exchanges of the factorization
+      for (unsigned int k = 0; k < size; ++k)
+        {
+          const std::array<unsigned int, width> &pivot = pivots[k];
+          for (unsigned int l = 0; l < width; ++l)
+            if (pivot[l] != k)
+              std::swap(v[k][l], v[pivot[l]][l]);
+        }
+      for (unsigned int i = 1; i < size; ++i)
+        {
+          const value_type *row = &values(i, 0);
+          value_type        sum = v[i];
+          for (unsigned int j = 0; j < i; ++j)
+            sum -= row[j] * v[j];
+          v[i] = sum;
+        }
+
+      // backward substitution with the upper triangle
+      for (unsigned int i = size; i > 0;)
+        {
+          --i;
+          const value_type *row = &values(i, 0);
+          value_type        sum = v[i];
+          for (unsigned int j = i + 1; j < size; ++j)
+            sum -= row[j] * v[j];
+          v[i] = sum / row[i];
+        }
+    }
+  else if (state == LAPACKSupport::cholesky)
+    {
+      // forward substitution with L
+      for (unsigned int i = 0; i < size; ++i)
+        {
+          const value_type *row = &values(i, 0);
+          value_type        sum = v[i];
+          for (unsigned int j = 0; j < i; ++j)
+            sum -= row[j] * v[j];
+          v[i] = sum / row[i];
+        }
+
+      // backward substitution with L^T, running over the columns of L
+      for (unsigned int i = size; i > 0;)
+        {
+          --i;
+          v[i] /= values(i, i);
+          const value_type *row = &values(i, 0);
+          for (unsigned int j = 0; j < i; ++j)
+            v[j] -= row[j] * v[i];
+        }
+    }
+  else
+    Assert(false, LAPACKSupport::ExcState(state));
+}
+
+
+
+template <typename Number, std::size_t width>
+inline LAPACKSupport::State
+BatchedFullMatrix<Number, width>::get_state() const
+{
+  return state;
+}
+
+
+
+template <typename Number, std::size_t width>
+inline std::size_t
+BatchedFullMatrix<Number, width>::memory_consumption() const
+{
+  return sizeof(*this) + values.memory_consumption() +
+         MemoryConsumption::memory_consumption(pivots);
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
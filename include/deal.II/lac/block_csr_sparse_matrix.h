@@ -0,0 +1,725 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+#ifndef dealii_block_csr_sparse_matrix_h
+#define dealii_block_csr_sparse_matrix_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/parallel.h>
+#include <deal.II/base/smartpointer.h>
+#include <deal.II/base/subscriptor.h>
+
+#include <deal.II/lac/exceptions.h>
+#include <deal.II/lac/sparsity_pattern.h>
+
+#include <array>
+#include <type_traits>
+
+DEAL_II_NAMESPACE_OPEN
+
+/*! @addtogroup Matrix1
+ *@{
+ */
+
+/**
+ * A sparse matrix in the block compressed row (BSR) format, where each
+ * entry of the sparsity pattern represents a dense block of size
+ * @p block_size $\times$ @p block_size.
+ *
+ * The class is meant for vector-valued problems like elasticity or flow
+ * problems, where all components at a support point couple with all
+ * components at the neighboring support points. Compared to SparseMatrix,
+ * only one column index is stored per block rather than one per entry, and
+ * the matrix-vector product works on small dense blocks of compile-time
+ * size, which the compiler can unroll and vectorize. As opposed to
+ * ChunkSparseMatrix, whose chunks are formed from consecutive indices
+ * without regard to the finite element, the blocks of this class group the
+ * degrees of freedom $i$ with the same value of $i / \text{block\_size}$.
+ * This is the natural numbering of a DoFHandler with an FESystem of
+ * @p block_size copies of a scalar element, such as
+ * <code>FESystem<dim>(FE_Q<dim>(degree), dim)</code>, where all components
+ * at a support point are numbered consecutively. Renumberings of the DoFs
+ * must keep these groups together, e.g., by renumbering a scalar DoFHandler
+ * on the same mesh and expanding the result.
+ *
+ * The sparsity pattern is a SparsityPattern of size $N/\text{block\_size}
+ * \times N/\text{block\_size}$ with one entry per block, as computed by the
+ * variant of DoFTools::make_sparsity_pattern() taking a block size. Entries
+ * can be written by the same add() functions as used for SparseMatrix, so
+ * AffineConstraints::distribute_local_to_global() works on objects of this
+ * class. The entries within a block are stored row by row.
+ *
+ * The matrix-vector product vmult() runs in parallel over the block rows
+ * using parallel::apply_to_subranges(), similarly to SparseMatrix::vmult().
+ * The class supports vectors of type Vector and
+ * LinearAlgebra::distributed::Vector without ghost entries on a single
+ * process, i.e., the same setting as SparseMatrix.
+ */
+template <typename number, int block_size>
+class BlockCSRSparseMatrix : public virtual Subscriptor
+{
+  static_assert(block_size > 0, "The block size must be positive.");
+
+public:
+  /**
+   * Declare type for container size.
+   */
+  using size_type = types::global_dof_index;
+
+  /**
+   * Type of the matrix entries.
+   */
+  using value_type = number;
+
+  /**
+   * Constructor. Leaves the object empty, call reinit() before use.
+   */
+  BlockCSRSparseMatrix();
+
+  /**
+   * Constructor, calling reinit() with the given sparsity pattern of the
+   * blocks.
+   */
+  explicit BlockCSRSparseMatrix(const SparsityPattern &block_sparsity);
+
+  /**
+   * Copy constructor. Only allowed for empty matrices, like for
+   * SparseMatrix.
+   */
+  BlockCSRSparseMatrix(const BlockCSRSparseMatrix &matrix);
+
+  /**
+   * Reinitialize the matrix with the sparsity pattern @p block_sparsity of
+   * the blocks, which must be compressed and square. All entries are set to
+   * zero. The object keeps a pointer to the sparsity pattern, which hence
+   * must live at least as long as this object.
+   */
+  void
+  reinit(const SparsityPattern &block_sparsity);
+
+  /**
+   * Release all memory and return to a state just like after having called
+   * the default constructor.
+   */
+  void
+  clear();
+
+  /**
+   * Set all entries to zero. The only allowed argument is zero.
+   */
+  BlockCSRSparseMatrix &
+  operator=(const double d);
+
+  /**
+   * Return the number of rows of the matrix, i.e., the number of block rows
+   * times the block size.
+   */
+  size_type
+  m() const;
+
+  /**
+   * Return the number of columns of the matrix.
+   */
+  size_type
+  n() const;
+
+  /**
+   * Return the number of block rows of the matrix.
+   */
+  size_type
+  n_block_rows() const;
+
+  /**
+   * Return the number of stored entries, i.e., the number of blocks times
+   * the number of entries in a block.
+   */
+  std::size_t
+  n_nonzero_elements() const;
+
+  /**
+   * Return a reference to the sparsity pattern of the blocks.
+   */
+  const SparsityPattern &
+  get_sparsity_pattern() const;
+
+  /**
+   * Set the entry $(i,j)$ to @p value. The block containing the entry must
+   * be present in the sparsity pattern.
+   */
+  void
+  set(const size_type i, const size_type j, const number value);
+
+  /**
+   * Add @p value to the entry $(i,j)$. The block containing the entry must
+   * be present in the sparsity pattern unless @p value is zero.
+   */
+  void
+  add(const size_type i, const size_type j, const number value);
+
+  /**
+   * Add the given @p values into the columns @p col_indices of the row
+   * @p row, with the same interface as SparseMatrix::add(). This is the
+   * function used by AffineConstraints::distribute_local_to_global().
+   */
+  template <typename number2>
+  void
+  add(const size_type  row,
+      const size_type  n_cols,
+      const size_type *col_indices,
+      const number2 *  values,
+      const bool       elide_zero_values      = true,
+      const bool       col_indices_are_sorted = false);
+
+  /**
+   * Return the value of the entry $(i,j)$, which must be present in the
+   * sparsity pattern.
+   */
+  number
+  operator()(const size_type i, const size_type j) const;
+
+  /**
+   * Return the value of the entry $(i,j)$, or zero if the block containing
+   * the entry is not present in the sparsity pattern.
+   */
+  number
+  el(const size_type i, const size_type j) const;
+
+  /**
+   * Return a pointer to the @p block_size $\times$ @p block_size entries of
+   * the block in block row @p block_row and block column @p block_col,
+   * stored row by row, or `nullptr` if the block is not in the sparsity
+   * pattern.
+   */
+  number *
+  block(const size_type block_row, const size_type block_col);
+
+  /**
+   * Matrix-vector multiplication: let <i>dst = M*src</i> with <i>M</i>
+   * being this matrix.
+   */
+  template <typename VectorType>
+  void
+  vmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Adding matrix-vector multiplication: add <i>M*src</i> to <i>dst</i>
+   * with <i>M</i> being this matrix.
+   */
+  template <typename VectorType>
+  void
+  vmult_add(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Matrix-vector multiplication with the transpose matrix: let <i>dst =
+   * M<sup>T</sup>*src</i> with <i>M</i> being this matrix. This operation
+   * runs in serial.
+   */
+  template <typename VectorType>
+  void
+  Tvmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Adding matrix-vector multiplication with the transpose matrix: add
+   * <i>M<sup>T</sup>*src</i> to <i>dst</i> with <i>M</i> being this
+   * matrix. This operation runs in serial.
+   */
+  template <typename VectorType>
+  void
+  Tvmult_add(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Determine an estimate for the memory consumption (in bytes) of this
+   * object, not including the sparsity pattern.
+   */
+  std::size_t
+  memory_consumption() const;
+
+  /**
+   * @addtogroup Exceptions
+   * @{
+   */
+
+  /**
+   * Exception
+   */
+  DeclException2(ExcInvalidIndex,
+                 size_type,
+                 size_type,
+                 << "You are trying to access the matrix entry with index <"
+                 << arg1 << ',' << arg2
+                 << ">, but the block containing this entry does not exist "
+                 << "in the sparsity pattern of this matrix.");
+  /** @} */
+
+private:
+  /**
+   * Return the index of the block containing the entry $(i,j)$ within the
+   * sparsity pattern, or SparsityPattern::invalid_entry.
+   */
+  size_type
+  block_index(const size_type i, const size_type j) const;
+
+  /**
+   * Compute the matrix-vector product on the block rows in the range
+   * `[begin, end)` and either write or add the result into @p dst.
+   */
+  void
+  vmult_on_subrange(const size_type begin,
+                    const size_type end,
+                    number *        dst,
+                    const number *  src,
+                    const bool      add) const;
+
+  /**
+   * The number of entries of a block.
+   */
+  static constexpr unsigned int entries_per_block = block_size * block_size;
+
+  /**
+   * Pointer to the sparsity pattern of the blocks.
+   */
+  SmartPointer<const SparsityPattern, BlockCSRSparseMatrix> cols;
+
+  /**
+   * The entries of all blocks, with the entries of block $k$ in the
+   * numbering of the sparsity pattern starting at position
+   * $k\cdot\text{block\_size}^2$.
+   */
+  AlignedVector<number> values;
+};
+
+/*@}*/
+
+/* ---------------------------------- Inline functions ------------------- */
+
+#ifndef DOXYGEN
+
+template <typename number, int block_size>
+inline BlockCSRSparseMatrix<number, block_size>::BlockCSRSparseMatrix()
+  : cols(nullptr, "BlockCSRSparseMatrix")
+{}
+
+
+
+template <typename number, int block_size>
+inline BlockCSRSparseMatrix<number, block_size>::BlockCSRSparseMatrix(
+  const SparsityPattern &block_sparsity)
+  : BlockCSRSparseMatrix()
+{
+  reinit(block_sparsity);
+}
+
+
+
+template <typename number, int block_size>
+inline BlockCSRSparseMatrix<number, block_size>::BlockCSRSparseMatrix(
+  const BlockCSRSparseMatrix &matrix)
+  : Subscriptor()
+  , cols(nullptr, "BlockCSRSparseMatrix")
+{
+  (void)matrix;
+  Assert(matrix.cols == nullptr && matrix.values.size() == 0,
+         ExcMessage(
+           "You can only copy construct empty matrices, like SparseMatrix."));
+}
+
+
+
+template <typename number, int block_size>
+inline void
+BlockCSRSparseMatrix<number, block_size>::reinit(
+  const SparsityPattern &block_sparsity)
+{
+  Assert(block_sparsity.is_compressed(), SparsityPattern::ExcNotCompressed());
+  Assert(block_sparsity.n_rows() == block_sparsity.n_cols(),
+         ExcNotQuadratic());
+
+  cols = &block_sparsity;
+  values.resize_fast(block_sparsity.n_nonzero_elements() * entries_per_block);
+
+  // zero the blocks with the same partitioning as in vmult to get a good
+  // first touch on NUMA systems
+  *this = 0.;
+}
+
+
+
+template <typename number, int block_size>
+inline void
+BlockCSRSparseMatrix<number, block_size>::clear()
+{
+  cols = nullptr;
+  values.clear();
+}
+
+
+
+template <typename number, int block_size>
+inline BlockCSRSparseMatrix<number, block_size> &
+BlockCSRSparseMatrix<number, block_size>::operator=(const double d)
+{
+  (void)d;
+  Assert(d == 0, ExcMessage("Only assignment of zero is allowed."));
+
+  if (cols == nullptr)
+    return *this;
+
+  const std::size_t *const rowstart = cols->rowstart.get();
+  parallel::apply_to_subranges(
+    size_type(0),
+    n_block_rows(),
+    [&](const size_type begin, const size_type end) {
+      std::fill(values.begin() + rowstart[begin] * entries_per_block,
+                values.begin() + rowstart[end] * entries_per_block,
+                number());
+    },
+    internal::SparseMatrixImplementation::minimum_parallel_grain_size);
+
+  return *this;
+}
+
+
+
+template <typename number, int block_size>
+inline typename BlockCSRSparseMatrix<number, block_size>::size_type
+BlockCSRSparseMatrix<number, block_size>::m() const
+{
+  return n_block_rows() * block_size;
+}
+
+
+
+template <typename number, int block_size>
+inline typename BlockCSRSparseMatrix<number, block_size>::size_type
+BlockCSRSparseMatrix<number, block_size>::n() const
+{
+  return n_block_rows() * block_size;
+}
+
+
+
+template <typename number, int block_size>
+inline typename BlockCSRSparseMatrix<number, block_size>::size_type
+BlockCSRSparseMatrix<number, block_size>::n_block_rows() const
+{
+  return cols == nullptr ? 0 : cols->n_rows();
+}
+
+
+
+template <typename number, int block_size>
+inline std::size_t
+BlockCSRSparseMatrix<number, block_size>::n_nonzero_elements() const
+{
+  return values.size();
+}
+
+
+
+template <typename number, int block_size>
+inline const SparsityPattern &
+BlockCSRSparseMatrix<number, block_size>::get_sparsity_pattern() const
+{
+  Assert(cols != nullptr, ExcNotInitialized());
+  return *cols;
+}
+
+
+
+template <typename number, int block_size>
+inline typename BlockCSRSparseMatrix<number, block_size>::size_type
+BlockCSRSparseMatrix<number, block_size>::block_index(const size_type i,
+                                                      const size_type j) const
+{
+  Assert(cols != nullptr, ExcNotInitialized());
+  AssertIndexRange(i, m());
+  AssertIndexRange(j, n());
+  return (*cols)(i / block_size, j / block_size);
+}
+
+
+
+template <typename number, int block_size>
+inline void
+BlockCSRSparseMatrix<number, block_size>::set(const size_type i,
+                                              const size_type j,
+                                              const number    value)
+{
+  AssertIsFinite(value);
+  const size_type index = block_index(i, j);
+  if (index == SparsityPattern::invalid_entry)
+    {
+      Assert(value == number(), ExcInvalidIndex(i, j));
+      return;
+    }
+  values[index * entries_per_block + (i % block_size) * block_size +
+         j % block_size] = value;
+}
+
+
+
+template <typename number, int block_size>
+inline void
+BlockCSRSparseMatrix<number, block_size>::add(const size_type i,
+                                              const size_type j,
+                                              const number    value)
+{
+  AssertIsFinite(value);
+  if (value == number())
+    return;
+  const size_type index = block_index(i, j);
+  Assert(index != SparsityPattern::invalid_entry, ExcInvalidIndex(i, j));
+  values[index * entries_per_block + (i % block_size) * block_size +
+         j % block_size] += value;
+}
+
+
+
+template <typename number, int block_size>
+template <typename number2>
+inline void
+BlockCSRSparseMatrix<number, block_size>::add(
+  const size_type  row,
+  const size_type  n_cols,
+  const size_type *col_indices,
+  const number2 *  values_to_add,
+  const bool       elide_zero_values,
+  const bool /*col_indices_are_sorted*/)
+{
+  // consecutive columns often fall into the same block, so remember the
+  // last block we looked up
+  size_type last_block_col = numbers::invalid_size_type;
+  number *  block_row_ptr  = nullptr;
+  for (size_type k = 0; k < n_cols; ++k)
+    {
+      const number value = values_to_add[k];
+      AssertIsFinite(value);
+      if (elide_zero_values && value == number())
+        continue;
+
+      const size_type block_col = col_indices[k] / block_size;
+      if (block_col != last_block_col)
+        {
+          const size_type index = block_index(row, col_indices[k]);
+          Assert(index != SparsityPattern::invalid_entry,
+                 ExcInvalidIndex(row, col_indices[k]));
+          block_row_ptr = values.data() + index * entries_per_block +
+                          (row % block_size) * block_size;
+          last_block_col = block_col;
+        }
+      block_row_ptr[col_indices[k] % block_size] += value;
+    }
+}
+
+
+
+template <typename number, int block_size>
+inline number
+BlockCSRSparseMatrix<number, block_size>::operator()(const size_type i,
+                                                     const size_type j) const
+{
+  const size_type index = block_index(i, j);
+  Assert(index != SparsityPattern::invalid_entry, ExcInvalidIndex(i, j));
+  return values[index * entries_per_block + (i % block_size) * block_size +
+                j % block_size];
+}
+
+
+
+template <typename number, int block_size>
+inline number
+BlockCSRSparseMatrix<number, block_size>::el(const size_type i,
+                                             const size_type j) const
+{
+  const size_type index = block_index(i, j);
+  if (index == SparsityPattern::invalid_entry)
+    return number();
+  return values[index * entries_per_block + (i % block_size) * block_size +
+                j % block_size];
+}
+
+
+
+template <typename number, int block_size>
+inline number *
+BlockCSRSparseMatrix<number, block_size>::block(const size_type block_row,
+                                                const size_type block_col)
+{
+  Assert(cols != nullptr, ExcNotInitialized());
+  const size_type index = (*cols)(block_row, block_col);
+  if (index == SparsityPattern::invalid_entry)
+    return nullptr;
+  return values.data() + index * entries_per_block;
+}
+
+
+
+template <typename number, int block_size>
+inline void
+BlockCSRSparseMatrix<number, block_size>::vmult_on_subrange(
+  const size_type begin,
+  const size_type end,
+  number *        dst,
+  const number *  src,
+  const bool      add) const
+{
+  const std::size_t *const rowstart = cols->rowstart.get();
+  const size_type *const   colnums  = cols->colnums.get();
+  const number *const      val      = values.data();
+
+  for (size_type row = begin; row < end; ++row)
+    {
+      std::array<number, block_size> sum = {};
+      for (std::size_t k = rowstart[row]; k < rowstart[row + 1]; ++k)
+        {
+          const number *block_values = val + k * entries_per_block;
+          const number *src_values   = src + colnums[k] * block_size;
+          for (unsigned int r = 0; r < block_size; ++r)
+            for (unsigned int c = 0; c < block_size; ++c)
+              sum[r] += block_values[r * block_size + c] * src_values[c];
+        }
+
+      number *dst_values = dst + row * block_size;
+      if (add)
+        for (unsigned int r = 0; r < block_size; ++r)
+          dst_values[r] += sum[r];
+      else
+        for (unsigned int r = 0; r < block_size; ++r)
+          dst_values[r] = sum[r];
+    }
+}
+
+
+
+template <typename number, int block_size>
+template <typename VectorType>
+inline void
+BlockCSRSparseMatrix<number, block_size>::vmult(VectorType &      dst,
+                                                const VectorType &src) const
+{
+  static_assert(std::is_same<typename VectorType::value_type, number>::value,
+                "The vector type must use the same number type as the "
+                "matrix.");
+  Assert(cols != nullptr, ExcNotInitialized());
+  AssertDimension(dst.size(), m());
+  AssertDimension(src.size(), n());
+  Assert(&src != &dst,
+         ExcMessage("Source and destination must not be the same vector."));
+
+  const number *src_ptr = src.begin();
+  number *      dst_ptr = dst.begin();
+  parallel::apply_to_subranges(
+    size_type(0),
+    n_block_rows(),
+    [&](const size_type begin, const size_type end) {
+      vmult_on_subrange(begin, end, dst_ptr, src_ptr, false);
+    },
+    internal::SparseMatrixImplementation::minimum_parallel_grain_size);
+}
+
+
+
+template <typename number, int block_size>
+template <typename VectorType>
+inline void
+BlockCSRSparseMatrix<number, block_size>::vmult_add(
+  VectorType &      dst,
+  const VectorType &src) const
+{
+  static_assert(std::is_same<typename VectorType::value_type, number>::value,
+                "The vector type must use the same number type as the "
+                "matrix.");
+  Assert(cols != nullptr, ExcNotInitialized());
+  AssertDimension(dst.size(), m());
+  AssertDimension(src.size(), n());
+  Assert(&src != &dst,
+         ExcMessage("Source and destination must not be the same vector."));
+
+  const number *src_ptr = src.begin();
+  number *      dst_ptr = dst.begin();
+  parallel::apply_to_subranges(
+    size_type(0),
+    n_block_rows(),
+    [&](const size_type begin, const size_type end) {
+      vmult_on_subrange(begin, end, dst_ptr, src_ptr, true);
+    },
+    internal::SparseMatrixImplementation::minimum_parallel_grain_size);
+}
+
+
+
+template <typename number, int block_size>
+template <typename VectorType>
+inline void
+BlockCSRSparseMatrix<number, block_size>::Tvmult(VectorType &      dst,
+                                                 const VectorType &src) const
+{
+  dst = number();
+  Tvmult_add(dst, src);
+}
+
+
+
+template <typename number, int block_size>
+template <typename VectorType>
+inline void
+BlockCSRSparseMatrix<number, block_size>::Tvmult_add(
+  VectorType &      dst,
+  const VectorType &src) const
+{
+  static_assert(std::is_same<typename VectorType::value_type, number>::value,
+                "The vector type must use the same number type as the "
+                "matrix.");
+  Assert(cols != nullptr, ExcNotInitialized());
+  AssertDimension(dst.size(), n());
+  AssertDimension(src.size(), m());
+  Assert(&src != &dst,
+         ExcMessage("Source and destination must not be the same vector."));
+
+  const std::size_t *const rowstart = cols->rowstart.get();
+  const size_type *const   colnums  = cols->colnums.get();
+
+  for (size_type row = 0; row < n_block_rows(); ++row)
+    {
+      const number *src_values = src.begin() + row * block_size;
+      for (std::size_t k = rowstart[row]; k < rowstart[row + 1]; ++k)
+        {
+          const number *block_values = values.data() + k * entries_per_block;
+          number *      dst_values   = dst.begin() + colnums[k] * block_size;
+          for (unsigned int r = 0; r < block_size; ++r)
+            for (unsigned int c = 0; c < block_size; ++c)
+              dst_values[c] += block_values[r * block_size + c] * src_values[r];
+        }
+    }
+}
+
+
+
+template <typename number, int block_size>
+inline std::size_t
+BlockCSRSparseMatrix<number, block_size>::memory_consumption() const
+{
+  return sizeof(*this) + values.memory_consumption();
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -19,6 +19,7 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/array_view.h>
 #include <deal.II/base/exceptions.h>
 
 #include <deal.II/lac/block_indices.h>
@@ -699,6 +700,22 @@ namespace LinearAlgebra
                   const VectorSpaceVector<Number> &V,
                   const VectorSpaceVector<Number> &W) override;
 
+      /**
+       * Compute the scalar products of this vector with each of the vectors
+       * in @p vectors, i.e., <tt>dot_products[i] = *this * *vectors[i]</tt>,
+       * using a single global reduction for all of them instead of one per
+       * scalar product. This is useful for the orthogonalization in Krylov
+       * methods such as GMRES, where a vector is orthogonalized against
+       * several basis vectors at once and the latency of the reductions
+       * dominates on many processes.
+       *
+       * For complex-valued vectors, the scalar products are computed as in
+       * operator*().
+       */
+      void
+      multi_dot(const ArrayView<const BlockVector<Number> *const> &vectors,
+                const ArrayView<Number> &dot_products) const;
+
       /**
        * Return the global size of the vector, equal to the sum of the number of
        * locally owned indices among all processors.
@@ -869,6 +869,37 @@ namespace LinearAlgebra
 
 
 
+    template <typename Number>
+    void
+    BlockVector<Number>::multi_dot(
+      const ArrayView<const BlockVector<Number> *const> &vectors,
+      const ArrayView<Number> &                          dot_products) const
+    {
+      Assert(this->n_blocks() > 0, ExcEmptyObject());
+      AssertDimension(vectors.size(), dot_products.size());
+
+      std::vector<Number> local_results(vectors.size(), Number());
+      for (unsigned int v = 0; v < vectors.size(); ++v)
+        {
+          AssertDimension(this->n_blocks(), vectors[v]->n_blocks());
+          for (unsigned int i = 0; i < this->n_blocks(); ++i)
+            local_results[v] +=
+              this->block(i).inner_product_local(vectors[v]->block(i));
+        }
+
+      if (this->block(0).partitioner->n_mpi_processes() > 1)
+        Utilities::MPI::sum(
+          ArrayView<const Number>(local_results),
+          this->block(0).partitioner->get_mpi_communicator(),
+          dot_products);
+      else
+        std::copy(local_results.begin(),
+                  local_results.end(),
+                  dot_products.begin());
+    }
+
+
+
     template <typename Number>
     inline void
     BlockVector<Number>::swap(BlockVector<Number> &v)
@@ -21,6 +21,7 @@
 #include <deal.II/base/communication_pattern_base.h>
 #include <deal.II/base/memory_space.h>
 #include <deal.II/base/memory_space_data.h>
+#include <deal.II/base/mpi.h>
 #include <deal.II/base/mpi_stub.h>
 #include <deal.II/base/numbers.h>
 #include <deal.II/base/parallel.h>
@@ -930,6 +931,59 @@ namespace LinearAlgebra
       void
       sadd(const Number s, const Vector<Number, MemorySpace> &V);
 
+      /**
+       * Start the computation of the inner product of this vector with
+       * @p V, i.e., the result of operator*(), and return an object through
+       * which the result is obtained with Utilities::MPI::Future::get(). The
+       * contributions of the locally owned elements are computed right away,
+       * but the reduction over all processes is done with a non-blocking
+       * collective operation, so that other work, such as further vector
+       * operations or a matrix-vector product, can be done while the
+       * reduction is in progress. This is the building block of pipelined
+       * Krylov solvers.
+       *
+       * Since this function is collective, all processes need to call it in
+       * the same order relative to other collective operations.
+       */
+      Utilities::MPI::Future<Number>
+      inner_product_async(const Vector<Number, MemorySpace> &V) const;
+
+      /**
+       * Start the computation of the inner products of this vector with each
+       * of the vectors in @p vectors, like inner_product_async(). All inner
+       * products are summed over the processes in a single message, which
+       * is cheaper than separate reductions when the latency of the
+       * communication dominates. The future returns the inner products in
+       * the order of @p vectors.
+       */
+      Utilities::MPI::Future<std::vector<Number>>
+      inner_products_async(
+        const std::vector<const Vector<Number, MemorySpace> *> &vectors) const;
+
+      /**
+       * Start the computation of the square of the $l_2$ norm of the vector,
+       * i.e., the result of norm_sqr(), like inner_product_async().
+       */
+      Utilities::MPI::Future<real_type>
+      norm_sqr_async() const;
+
+      /**
+       * Start the computation of the $l_2$ norm of the vector, i.e., the
+       * result of l2_norm(), like inner_product_async().
+       */
+      Utilities::MPI::Future<real_type>
+      l2_norm_async() const;
+
+      /**
+       * Perform the vector update of add_and_dot() and start the computation
+       * of the inner product, like inner_product_async(). The vector is
+       * updated when the function returns.
+       */
+      Utilities::MPI::Future<Number>
+      add_and_dot_async(const Number                       a,
+                        const Vector<Number, MemorySpace> &V,
+                        const Vector<Number, MemorySpace> &W);
+
       /** @} */
 
 
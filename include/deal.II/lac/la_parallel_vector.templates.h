@@ -135,12 +135,14 @@ namespace LinearAlgebra
         {
           if (comm_shared == MPI_COMM_SELF)
             {
-              Number *new_val;
-              Utilities::System::posix_memalign(
-                reinterpret_cast<void **>(&new_val),
-                64,
-                sizeof(Number) * new_alloc_size);
-              data.values = {new_val, [](Number *data) { std::free(data); }};
+              Number *new_val = static_cast<Number *>(
+                Utilities::System::allocate_aligned(sizeof(Number) *
+                                                      new_alloc_size,
+                                                    64));
+              data.values = {new_val, [new_alloc_size](Number *data) {
+                               Utilities::System::free_aligned(
+                                 data, sizeof(Number) * new_alloc_size);
+                             }};
 
               allocated_size = new_alloc_size;
 
@@ -213,15 +215,16 @@ namespace LinearAlgebra
               for (unsigned int i = 0; i < size_sm; ++i)
                 others[i] += n_align_sm[i];
 
-              std::vector<unsigned int> new_alloc_sizes(size_sm);
+              std::vector<types::global_dof_index> new_alloc_sizes(size_sm);
 
-              ierr = MPI_Allgather(&new_alloc_size,
-                                   1,
-                                   MPI_UNSIGNED,
-                                   new_alloc_sizes.data(),
-                                   1,
-                                   MPI_UNSIGNED,
-                                   comm_shared);
+              ierr = MPI_Allgather(
+                &new_alloc_size,
+                1,
+                Utilities::MPI::mpi_type_id_for_type<types::global_dof_index>,
+                new_alloc_sizes.data(),
+                1,
+                Utilities::MPI::mpi_type_id_for_type<types::global_dof_index>,
+                comm_shared);
               AssertThrowMPI(ierr);
 
               data.values_sm.resize(size_sm);
@@ -2045,6 +2048,94 @@ namespace LinearAlgebra
 
 
 
+    template <typename Number, typename MemorySpaceType>
+    Utilities::MPI::Future<Number>
+    Vector<Number, MemorySpaceType>::inner_product_async(
+      const Vector<Number, MemorySpaceType> &v) const
+    {
+      const Number local_result = inner_product_local(v);
+      if (partitioner->n_mpi_processes() > 1)
+        return Utilities::MPI::isum(local_result,
+                                    partitioner->get_mpi_communicator());
+      else
+        return Utilities::MPI::Future<Number>(
+          []() {}, [local_result]() { return local_result; });
+    }
+
+
+
+    template <typename Number, typename MemorySpaceType>
+    Utilities::MPI::Future<std::vector<Number>>
+    Vector<Number, MemorySpaceType>::inner_products_async(
+      const std::vector<const Vector<Number, MemorySpaceType> *> &vectors)
+      const
+    {
+      std::vector<Number> local_results(vectors.size());
+      for (unsigned int i = 0; i < vectors.size(); ++i)
+        {
+          Assert(vectors[i] != nullptr, ExcNotInitialized());
+          local_results[i] = inner_product_local(*vectors[i]);
+        }
+
+      if (partitioner->n_mpi_processes() > 1)
+        return Utilities::MPI::isum(
+          ArrayView<const Number>(local_results.data(), local_results.size()),
+          partitioner->get_mpi_communicator());
+      else
+        return Utilities::MPI::Future<std::vector<Number>>(
+          []() {}, [local_results]() { return local_results; });
+    }
+
+
+
+    template <typename Number, typename MemorySpaceType>
+    Utilities::MPI::Future<typename Vector<Number, MemorySpaceType>::real_type>
+    Vector<Number, MemorySpaceType>::norm_sqr_async() const
+    {
+      const real_type local_result = norm_sqr_local();
+      if (partitioner->n_mpi_processes() > 1)
+        return Utilities::MPI::isum(local_result,
+                                    partitioner->get_mpi_communicator());
+      else
+        return Utilities::MPI::Future<real_type>(
+          []() {}, [local_result]() { return local_result; });
+    }
+
+
+
+    template <typename Number, typename MemorySpaceType>
+    Utilities::MPI::Future<typename Vector<Number, MemorySpaceType>::real_type>
+    Vector<Number, MemorySpaceType>::l2_norm_async() const
+    {
+      // the future is not copyable, so share it between the two function
+      // objects
+      const auto future =
+        std::make_shared<Utilities::MPI::Future<real_type>>(norm_sqr_async());
+      return Utilities::MPI::Future<real_type>(
+        [future]() { future->wait(); },
+        [future]() { return std::sqrt(future->get()); });
+    }
+
+
+
+    template <typename Number, typename MemorySpaceType>
+    Utilities::MPI::Future<Number>
+    Vector<Number, MemorySpaceType>::add_and_dot_async(
+      const Number                           a,
+      const Vector<Number, MemorySpaceType> &v,
+      const Vector<Number, MemorySpaceType> &w)
+    {
+      const Number local_result = add_and_dot_local(a, v, w);
+      if (partitioner->n_mpi_processes() > 1)
+        return Utilities::MPI::isum(local_result,
+                                    partitioner->get_mpi_communicator());
+      else
+        return Utilities::MPI::Future<Number>(
+          []() {}, [local_result]() { return local_result; });
+    }
+
+
+
     template <typename Number, typename MemorySpaceType>
     inline bool
     Vector<Number, MemorySpaceType>::partitioners_are_compatible(
@@ -564,6 +564,58 @@ namespace PETScWrappers
     void
     compress(const VectorOperation::values operation);
 
+#  if DEAL_II_PETSC_VERSION_GTE(3, 18, 0)
+    /**
+     * Set the nonzero pattern of the matrix from a list of entries in
+     * coordinate (COO) format, i.e., the <i>k</i>th entry is located in the
+     * row <tt>row_indices[k]</tt> and the column <tt>column_indices[k]</tt>.
+     * This replaces the current sparsity pattern of the matrix, and prepares
+     * the communication of the entries that are given on a process but
+     * stored on another one, so that all later calls to set_values_COO()
+     * only need to exchange values.
+     *
+     * The pattern is typically computed once from the local degrees of
+     * freedom of all locally owned cells, one entry per pair of local
+     * degrees of freedom, in the order in which the cell matrices will later
+     * be passed to set_values_COO(). Entries may be given several times, in
+     * which case their values are added. Entries with a negative row or
+     * column index are ignored, which can be used to skip the rows and
+     * columns of degrees of freedom with homogeneous constraints, e.g., by
+     * replacing the indices of all constrained degrees of freedom by
+     * <tt>-1</tt> when building the pattern. The cell matrices then need to
+     * be assembled without resolving the constraints, and the diagonal
+     * entries of the constrained rows need to be listed as separate
+     * entries.
+     *
+     * This function is a collective operation and wraps
+     * <tt>MatSetPreallocationCOO</tt>, which requires PETSc 3.18 or later.
+     */
+    void
+    set_COO_pattern(const std::vector<PetscInt> &row_indices,
+                    const std::vector<PetscInt> &column_indices);
+
+    /**
+     * Set the values of the matrix from the values of the entries given to
+     * the last call to set_COO_pattern(), in the same order. If
+     * @p operation is VectorOperation::insert, the previous values of the
+     * matrix are overwritten, and otherwise the new values are added to
+     * them. Values of entries that appear several times in the pattern are
+     * added in either case.
+     *
+     * The values are communicated to the owning processes within this
+     * function, and the matrix can be used right away, i.e., compress()
+     * must not be called afterwards. If PETSc has been configured with
+     * support for a device and the matrix is of a device type, @p values
+     * may also point to device memory.
+     *
+     * This function is a collective operation and wraps
+     * <tt>MatSetValuesCOO</tt>, which requires PETSc 3.18 or later.
+     */
+    void
+    set_values_COO(const PetscScalar *            values,
+                   const VectorOperation::values operation);
+#  endif
+
     /**
      * Return the value of the entry (<i>i,j</i>).  This may be an expensive
      * operation and you should always take care where to call this function.
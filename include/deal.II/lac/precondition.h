@@ -32,6 +32,7 @@
 #include <deal.II/lac/solver_cg.h>
 #include <deal.II/lac/vector_memory.h>
 
+#include <functional>
 #include <limits>
 
 DEAL_II_NAMESPACE_OPEN
@@ -1809,6 +1810,24 @@ public:
  * iterations. Finally, the maximum eigenvalue is multiplied by a safety
  * factor of 1.2.
  *
+ * When the preconditioner is re-initialized for a sequence of slowly
+ * changing matrices, e.g., in a time loop or a nonlinear iteration, the
+ * estimate of a previous call to initialize() can be kept by setting
+ * PreconditionChebyshev::AdditionalData::eigenvalue_reuse_tolerance to a
+ * positive value. Instead of running the eigenvalue algorithm again, the
+ * class then compares the Rayleigh quotient of the preconditioned matrix
+ * with a vector stored during the last estimate (the initial vector of the
+ * Lanczos method or the final vector of the power iteration) to its value at
+ * the time of that estimate, at the cost of one matrix-vector product. Since
+ * the comparison is always against the last actual estimate, small changes
+ * over many calls add up until they exceed the tolerance. If the relative
+ * change is within the tolerance, the previous eigenvalues are used, with the
+ * maximum eigenvalue scaled up by the change of the Rayleigh quotient if it
+ * increased. Otherwise, the eigenvalues are estimated anew, with the power
+ * iteration starting from its previous final vector. Instead of the Rayleigh
+ * quotient, a measure of the change of the matrix known to the user can be
+ * given by PreconditionChebyshev::AdditionalData::eigenvalue_drift_indicator.
+ *
  * Due to the cost of the eigenvalue estimate, this class is most appropriate
  * if it is applied repeatedly, e.g. in a smoother for a geometric multigrid
  * solver, that can in turn be used to solve several linear systems.
@@ -1925,6 +1944,11 @@ public:
  * set `dst` to zero, whereas the operation after the loop performs the
  * iteration leading to $x^{n+1}$ described above, modifying the `dst` and
  * `src` vectors.
+ *
+ * SparseMatrix provides this function as well, for vectors of type Vector
+ * and LinearAlgebra::distributed::Vector. The fused loop is then over chunks
+ * of rows, which pays off for matrices with a small bandwidth, see the
+ * documentation of that function.
  */
 template <typename MatrixType         = SparseMatrix<double>,
           typename VectorType         = Vector<double>,
@@ -2069,6 +2093,23 @@ public:
      * Specifies the polynomial type to be used.
      */
     PolynomialType polynomial_type;
+
+    /**
+     * Relative change of the preconditioned matrix up to which the
+     * eigenvalue estimate of the previous call to initialize() is reused,
+     * see the section on the estimation of eigenvalues in the documentation
+     * of the class. The default value of zero disables the reuse. Only in
+     * effect if @p eig_cg_n_iterations is positive.
+     */
+    double eigenvalue_reuse_tolerance;
+
+    /**
+     * A function returning the relative change of the matrix since the last
+     * estimate of the eigenvalues, to be compared against @p
+     * eigenvalue_reuse_tolerance. If empty, the change is measured by the
+     * Rayleigh quotient of the preconditioned matrix.
+     */
+    std::function<double()> eigenvalue_drift_indicator;
   };
 
 
@@ -2234,6 +2275,26 @@ private:
    */
   bool eigenvalues_are_initialized;
 
+  /**
+   * The eigenvalue estimates of the last run of the eigenvalue algorithm,
+   * kept for reuse by later calls to initialize() if
+   * AdditionalData::eigenvalue_reuse_tolerance is positive.
+   */
+  mutable EigenvalueInformation previous_eigenvalue_information;
+
+  /**
+   * The vector whose Rayleigh quotient is used to detect changes of the
+   * matrix when reusing eigenvalue estimates. Empty unless
+   * AdditionalData::eigenvalue_reuse_tolerance is positive.
+   */
+  mutable VectorType eigenvalue_check_vector;
+
+  /**
+   * The Rayleigh quotient of @p eigenvalue_check_vector at the time of the
+   * last run of the eigenvalue algorithm.
+   */
+  mutable double eigenvalue_check_rayleigh_quotient;
+
   /**
    * A mutex to avoid that multiple vmult() invocations by different threads
    * overwrite the temporary vectors.
@@ -3070,6 +3131,87 @@ namespace internal
         }
     }
 
+#  ifdef DEAL_II_COMPILER_CUDA_AWARE
+    // device version of VectorUpdater, which performs all updates of one
+    // Chebyshev iteration in a single kernel
+    template <typename Number>
+    __global__ void
+    vector_updates_kernel(const Number *     rhs,
+                          const Number *     matrix_diagonal_inverse,
+                          const unsigned int iteration_index,
+                          const Number       factor1,
+                          const Number       factor2,
+                          const Number *     solution_old,
+                          Number *           tmp_vector,
+                          Number *           solution,
+                          const unsigned int locally_owned_size)
+    {
+      const unsigned int index = threadIdx.x + blockDim.x * blockIdx.x;
+      if (index < locally_owned_size)
+        {
+          if (iteration_index == 0)
+            solution[index] =
+              factor2 * matrix_diagonal_inverse[index] * rhs[index];
+          else if (iteration_index == 1)
+            tmp_vector[index] =
+              (Number(1.) + factor1) * solution[index] +
+              factor2 * matrix_diagonal_inverse[index] *
+                (rhs[index] - tmp_vector[index]);
+          else
+            tmp_vector[index] =
+              (Number(1.) + factor1) * solution[index] -
+              factor1 * solution_old[index] +
+              factor2 * matrix_diagonal_inverse[index] *
+                (rhs[index] - tmp_vector[index]);
+        }
+    }
+
+    // selection for diagonal matrix around parallel deal.II vector on CUDA
+    // devices, which launches a single kernel instead of one kernel per
+    // vector operation
+    template <typename Number>
+    inline void
+    vector_updates(
+      const LinearAlgebra::distributed::Vector<Number, MemorySpace::CUDA> &rhs,
+      const dealii::DiagonalMatrix<
+        LinearAlgebra::distributed::Vector<Number, MemorySpace::CUDA>> &jacobi,
+      const unsigned int iteration_index,
+      const double       factor1,
+      const double       factor2,
+      LinearAlgebra::distributed::Vector<Number, MemorySpace::CUDA>
+        &solution_old,
+      LinearAlgebra::distributed::Vector<Number, MemorySpace::CUDA>
+        &temp_vector1,
+      LinearAlgebra::distributed::Vector<Number, MemorySpace::CUDA> &,
+      LinearAlgebra::distributed::Vector<Number, MemorySpace::CUDA> &solution)
+    {
+      const unsigned int n_local_elements = rhs.locally_owned_size();
+      if (n_local_elements > 0)
+        {
+          const int n_blocks =
+            1 + (n_local_elements - 1) / CUDAWrappers::block_size;
+          vector_updates_kernel<<<n_blocks, CUDAWrappers::block_size>>>(
+            rhs.get_values(),
+            jacobi.get_vector().get_values(),
+            iteration_index,
+            static_cast<Number>(factor1),
+            static_cast<Number>(factor2),
+            solution_old.get_values(),
+            temp_vector1.get_values(),
+            solution.get_values(),
+            n_local_elements);
+          AssertCudaKernel();
+        }
+
+      // swap vectors x^{n+1}->x^{n}, given the updates in the function above
+      if (iteration_index > 0)
+        {
+          solution.swap(temp_vector1);
+          solution_old.swap(temp_vector1);
+        }
+    }
+#  endif // DEAL_II_COMPILER_CUDA_AWARE
+
     // We need to have a separate declaration for static const members
 
     // general case and the case that the preconditioner can work on
@@ -3473,6 +3615,22 @@ namespace internal
         }
       return eigenvalue_estimate;
     }
+
+    // Rayleigh quotient (v, P^{-1} A v) / (v, v) of the preconditioned matrix
+    template <typename MatrixType,
+              typename VectorType,
+              typename PreconditionerType>
+    double
+    rayleigh_quotient(const MatrixType &        matrix,
+                      const VectorType &        vector,
+                      const PreconditionerType &preconditioner,
+                      VectorType &              tmp_vector1,
+                      VectorType &              tmp_vector2)
+    {
+      matrix.vmult(tmp_vector1, vector);
+      preconditioner.vmult(tmp_vector2, tmp_vector1);
+      return (vector * tmp_vector2) / (vector * vector);
+    }
   } // namespace PreconditionChebyshevImplementation
 } // namespace internal
 
@@ -3494,6 +3652,7 @@ inline PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::
   , max_eigenvalue(max_eigenvalue)
   , eigenvalue_algorithm(eigenvalue_algorithm)
   , polynomial_type(polynomial_type)
+  , eigenvalue_reuse_tolerance(0.)
 {}
 
 
@@ -3505,14 +3664,16 @@ inline typename PreconditionChebyshev<MatrixType,
 PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::
   AdditionalData::operator=(const AdditionalData &other_data)
 {
-  degree               = other_data.degree;
-  smoothing_range      = other_data.smoothing_range;
-  eig_cg_n_iterations  = other_data.eig_cg_n_iterations;
-  eig_cg_residual      = other_data.eig_cg_residual;
-  max_eigenvalue       = other_data.max_eigenvalue;
-  preconditioner       = other_data.preconditioner;
-  eigenvalue_algorithm = other_data.eigenvalue_algorithm;
-  polynomial_type      = other_data.polynomial_type;
+  degree                     = other_data.degree;
+  smoothing_range            = other_data.smoothing_range;
+  eig_cg_n_iterations        = other_data.eig_cg_n_iterations;
+  eig_cg_residual            = other_data.eig_cg_residual;
+  max_eigenvalue             = other_data.max_eigenvalue;
+  preconditioner             = other_data.preconditioner;
+  eigenvalue_algorithm       = other_data.eigenvalue_algorithm;
+  polynomial_type            = other_data.polynomial_type;
+  eigenvalue_reuse_tolerance = other_data.eigenvalue_reuse_tolerance;
+  eigenvalue_drift_indicator = other_data.eigenvalue_drift_indicator;
   constraints.copy_from(other_data.constraints);
 
   return *this;
@@ -3526,6 +3687,7 @@ inline PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::
   : theta(1.)
   , delta(1.)
   , eigenvalues_are_initialized(false)
+  , eigenvalue_check_rayleigh_quotient(0.)
 {
   static_assert(
     std::is_same<size_type, typename VectorType::size_type>::value,
@@ -3563,7 +3725,10 @@ PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::clear()
     solution_old.reinit(empty_vector);
     temp_vector1.reinit(empty_vector);
     temp_vector2.reinit(empty_vector);
+    eigenvalue_check_vector.reinit(empty_vector);
   }
+  previous_eigenvalue_information    = EigenvalueInformation();
+  eigenvalue_check_rayleigh_quotient = 0.;
   data.preconditioner.reset();
 }
 
@@ -3591,65 +3756,131 @@ PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::
              ExcMessage(
                "Need to set at least two iterations to find eigenvalues."));
 
-      internal::PreconditionChebyshevImplementation::EigenvalueTracker
-        eigenvalue_tracker;
+      // check whether the estimate of a previous call to initialize() can
+      // be reused because the matrix has changed little
+      bool reuse_previous_estimate = false;
+      if (data.eigenvalue_reuse_tolerance > 0. &&
+          eigenvalue_check_vector.size() == src.size() &&
+          eigenvalue_check_rayleigh_quotient > 0.)
+        {
+          double ratio = 1.;
+          double drift = 0.;
+          if (data.eigenvalue_drift_indicator)
+            drift = data.eigenvalue_drift_indicator();
+          else
+            {
+              ratio =
+                internal::PreconditionChebyshevImplementation::
+                  rayleigh_quotient(*matrix_ptr,
+                                    eigenvalue_check_vector,
+                                    *data.preconditioner,
+                                    solution_old,
+                                    temp_vector1) /
+                eigenvalue_check_rayleigh_quotient;
+              drift = std::abs(ratio - 1.);
+            }
 
-      // set an initial guess that contains some high-frequency parts (to the
-      // extent possible without knowing the discretization and the numbering)
-      // to trigger high eigenvalues according to the external function
-      internal::PreconditionChebyshevImplementation::set_initial_guess(
-        temp_vector1);
-      data.constraints.set_zero(temp_vector1);
+          if (drift <= data.eigenvalue_reuse_tolerance)
+            {
+              info.min_eigenvalue_estimate =
+                previous_eigenvalue_information.min_eigenvalue_estimate;
+              info.max_eigenvalue_estimate =
+                previous_eigenvalue_information.max_eigenvalue_estimate *
+                std::max(1., ratio);
+              reuse_previous_estimate = true;
+            }
+        }
 
-      if (data.eigenvalue_algorithm ==
-          AdditionalData::EigenvalueAlgorithm::lanczos)
+      if (reuse_previous_estimate == false)
         {
-          // set a very strict tolerance to force at least two iterations
-          IterationNumberControl control(data.eig_cg_n_iterations,
-                                         1e-10,
-                                         false,
-                                         false);
-
-          SolverCG<VectorType> solver(control);
-          solver.connect_eigenvalues_slot(
-            [&eigenvalue_tracker](const std::vector<double> &eigenvalues) {
-              eigenvalue_tracker.slot(eigenvalues);
-            });
+          internal::PreconditionChebyshevImplementation::EigenvalueTracker
+            eigenvalue_tracker;
+
+          // the check above might have used this vector as temporary storage,
+          // but the CG method needs a zero starting vector
+          solution_old = 0.;
+
+          // set an initial guess that contains some high-frequency parts (to
+          // the extent possible without knowing the discretization and the
+          // numbering) to trigger high eigenvalues according to the external
+          // function, unless we can start the power iteration from its
+          // previous result
+          if (data.eigenvalue_algorithm ==
+                AdditionalData::EigenvalueAlgorithm::power_iteration &&
+              eigenvalue_check_vector.size() == src.size())
+            temp_vector1 = eigenvalue_check_vector;
+          else
+            internal::PreconditionChebyshevImplementation::set_initial_guess(
+              temp_vector1);
+          data.constraints.set_zero(temp_vector1);
 
-          solver.solve(*matrix_ptr,
-                       solution_old,
-                       temp_vector1,
-                       *data.preconditioner);
+          if (data.eigenvalue_algorithm ==
+              AdditionalData::EigenvalueAlgorithm::lanczos)
+            {
+              // set a very strict tolerance to force at least two iterations
+              IterationNumberControl control(data.eig_cg_n_iterations,
+                                             1e-10,
+                                             false,
+                                             false);
+
+              SolverCG<VectorType> solver(control);
+              solver.connect_eigenvalues_slot(
+                [&eigenvalue_tracker](const std::vector<double> &eigenvalues) {
+                  eigenvalue_tracker.slot(eigenvalues);
+                });
+
+              solver.solve(*matrix_ptr,
+                           solution_old,
+                           temp_vector1,
+                           *data.preconditioner);
+
+              info.cg_iterations = control.last_step();
+            }
+          else if (data.eigenvalue_algorithm ==
+                   AdditionalData::EigenvalueAlgorithm::power_iteration)
+            {
+              Assert(data.degree != numbers::invalid_unsigned_int,
+                     ExcMessage("Cannot estimate the minimal eigenvalue with "
+                                "the power iteration"));
+
+              eigenvalue_tracker.values.push_back(
+                internal::PreconditionChebyshevImplementation::power_iteration(
+                  *matrix_ptr,
+                  temp_vector1,
+                  *data.preconditioner,
+                  data.eig_cg_n_iterations));
+            }
+          else
+            Assert(false, ExcNotImplemented());
 
-          info.cg_iterations = control.last_step();
-        }
-      else if (data.eigenvalue_algorithm ==
-               AdditionalData::EigenvalueAlgorithm::power_iteration)
-        {
-          Assert(data.degree != numbers::invalid_unsigned_int,
-                 ExcMessage("Cannot estimate the minimal eigenvalue with the "
-                            "power iteration"));
-
-          eigenvalue_tracker.values.push_back(
-            internal::PreconditionChebyshevImplementation::power_iteration(
-              *matrix_ptr,
-              temp_vector1,
-              *data.preconditioner,
-              data.eig_cg_n_iterations));
-        }
-      else
-        Assert(false, ExcNotImplemented());
+          // read the eigenvalues from the attached eigenvalue tracker
+          if (eigenvalue_tracker.values.empty())
+            info.min_eigenvalue_estimate = info.max_eigenvalue_estimate = 1.;
+          else
+            {
+              info.min_eigenvalue_estimate =
+                eigenvalue_tracker.values.front();
 
-      // read the eigenvalues from the attached eigenvalue tracker
-      if (eigenvalue_tracker.values.empty())
-        info.min_eigenvalue_estimate = info.max_eigenvalue_estimate = 1.;
-      else
-        {
-          info.min_eigenvalue_estimate = eigenvalue_tracker.values.front();
+              // include a safety factor since the CG method will in general
+              // not be converged
+              info.max_eigenvalue_estimate =
+                1.2 * eigenvalue_tracker.values.back();
+            }
 
-          // include a safety factor since the CG method will in general not
-          // be converged
-          info.max_eigenvalue_estimate = 1.2 * eigenvalue_tracker.values.back();
+          // remember the vector and its Rayleigh quotient for checking the
+          // change of the matrix in later calls to initialize()
+          if (data.eigenvalue_reuse_tolerance > 0.)
+            {
+              eigenvalue_check_vector = temp_vector1;
+              eigenvalue_check_rayleigh_quotient =
+                internal::PreconditionChebyshevImplementation::
+                  rayleigh_quotient(*matrix_ptr,
+                                    eigenvalue_check_vector,
+                                    *data.preconditioner,
+                                    solution_old,
+                                    temp_vector1);
+              previous_eigenvalue_information = info;
+            }
         }
     }
   else
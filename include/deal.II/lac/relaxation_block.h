@@ -18,6 +18,7 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/aligned_vector.h>
 #include <deal.II/base/smartpointer.h>
 #include <deal.II/base/subscriptor.h>
 
@@ -46,7 +47,18 @@ DEAL_II_NAMESPACE_OPEN
  * Seidel process.
  *
  * Parallel computations require you to specify an initialized
- * ghost vector in AdditionalData::temp_ghost_vector.
+ * ghost vector in AdditionalData::temp_ghost_vector. This is supported for
+ * TrilinosWrappers::MPI::Vector and LinearAlgebra::distributed::Vector; in
+ * the latter case, the ghost vector must contain all indices that appear in
+ * the rows of the matrix belonging to the block list as ghost entries, and
+ * the blocks themselves should only contain locally owned indices.
+ *
+ * The inverses of the diagonal blocks are computed in parallel using the
+ * task scheduler. The Jacobi variant also computes the corrections of the
+ * blocks in parallel, followed by a serial accumulation into the
+ * result because of the overlap of the blocks. For many small blocks, the
+ * flag AdditionalData::contiguous_inverses stores all inverses in a single
+ * array for faster access.
  *
  * @ingroup Preconditioners
  */
@@ -181,6 +193,18 @@ public:
      */
     mutable VectorType *temp_ghost_vector;
 
+    /**
+     * Store the inverses of all diagonal blocks one after the other in a
+     * single contiguous array, rather than in one FullMatrix object per
+     * block. This avoids the indirection through the individual matrix
+     * objects and makes the relaxation step stream through the inverses in
+     * the order of the blocks. This option requires #inversion to be
+     * PreconditionBlockBase::gauss_jordan and #same_diagonal to be false.
+     * The inverses are then not accessible through the function inverse()
+     * of the derived classes.
+     */
+    bool contiguous_inverses = false;
+
     /**
      * Return the memory allocated in this object.
      */
@@ -264,6 +288,38 @@ private:
    */
   void
   block_kernel(const size_type block_begin, const size_type block_end);
+
+  /**
+   * Compute the local residual of block number @p block in @p b_cell and
+   * apply the inverse of the diagonal block to it, storing the result in
+   * @p x_cell.
+   */
+  void
+  block_correction(const size_type                          block,
+                   const VectorType &                       prev,
+                   const VectorType &                       src,
+                   Vector<typename VectorType::value_type> &b_cell,
+                   Vector<typename VectorType::value_type> &x_cell) const;
+
+  /**
+   * The starting position of each block in the block list, i.e., the
+   * position of the first entry of block number <tt>i</tt> among all
+   * entries of AdditionalData::block_list. The last entry is the total
+   * number of entries.
+   */
+  std::vector<std::size_t> block_starts;
+
+  /**
+   * The starting position of the inverse of each diagonal block in
+   * #inverse_values, if AdditionalData::contiguous_inverses is set.
+   */
+  std::vector<std::size_t> inverse_starts;
+
+  /**
+   * The inverses of all diagonal blocks in row-major order, if
+   * AdditionalData::contiguous_inverses is set.
+   */
+  AlignedVector<InverseNumberType> inverse_values;
 };
 
 
@@ -18,7 +18,10 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/parallel.h>
+
 #include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/la_parallel_vector.h>
 #include <deal.II/lac/relaxation_block.h>
 #include <deal.II/lac/trilinos_vector.h>
 #include <deal.II/lac/vector_memory.h>
@@ -73,6 +76,31 @@ RelaxationBlock<MatrixType, InverseNumberType, VectorType>::initialize(
                additional_data->same_diagonal,
                additional_data->inversion);
 
+  const size_type n_blocks = additional_data->block_list.n_rows();
+  block_starts.resize(n_blocks + 1);
+  block_starts[0] = 0;
+  for (size_type block = 0; block < n_blocks; ++block)
+    block_starts[block + 1] =
+      block_starts[block] + additional_data->block_list.row_length(block);
+
+  if (additional_data->contiguous_inverses)
+    {
+      Assert(additional_data->inversion ==
+               PreconditionBlockBase<InverseNumberType>::gauss_jordan,
+             ExcMessage("Contiguous storage of the inverses is only "
+                        "implemented for Gauss-Jordan inversion."));
+      Assert(!additional_data->same_diagonal, ExcNotImplemented());
+
+      inverse_starts.resize(n_blocks + 1);
+      inverse_starts[0] = 0;
+      for (size_type block = 0; block < n_blocks; ++block)
+        {
+          const std::size_t bs = additional_data->block_list.row_length(block);
+          inverse_starts[block + 1] = inverse_starts[block] + bs * bs;
+        }
+      inverse_values.resize_fast(inverse_starts.back());
+    }
+
   if (additional_data->invert_diagonal)
     invert_diagblocks();
 }
@@ -84,6 +112,9 @@ RelaxationBlock<MatrixType, InverseNumberType, VectorType>::clear()
 {
   A               = nullptr;
   additional_data = nullptr;
+  block_starts.clear();
+  inverse_starts.clear();
+  inverse_values.clear();
   PreconditionBlockBase<InverseNumberType>::clear();
 }
 
@@ -152,8 +183,21 @@ RelaxationBlock<MatrixType, InverseNumberType, VectorType>::block_kernel(
       switch (this->inversion)
         {
           case PreconditionBlockBase<InverseNumberType>::gauss_jordan:
-            this->inverse(block).reinit(bs, bs);
-            this->inverse(block).invert(M_cell);
+            if (this->additional_data->contiguous_inverses)
+              {
+                if (bs > 0)
+                  M_cell.gauss_jordan();
+                InverseNumberType *inverse =
+                  inverse_values.data() + inverse_starts[block];
+                for (size_type i = 0; i < bs; ++i)
+                  for (size_type j = 0; j < bs; ++j)
+                    inverse[i * bs + j] = M_cell(i, j);
+              }
+            else
+              {
+                this->inverse(block).reinit(bs, bs);
+                this->inverse(block).invert(M_cell);
+              }
             break;
           case PreconditionBlockBase<InverseNumberType>::householder:
             this->inverse_householder(block).initialize(M_cell);
@@ -212,8 +256,80 @@ namespace internal
     return *other;
   }
 #endif // DEAL_II_WITH_TRILINOS
+
+  /**
+   * Specialization for LinearAlgebra::distributed::Vector. Use the ghosted
+   * vector if one is given, and the vector itself otherwise, which is
+   * appropriate for computations on a single process.
+   */
+  template <typename Number>
+  inline const LinearAlgebra::distributed::Vector<Number> &
+  prepare_ghost_vector(const LinearAlgebra::distributed::Vector<Number> &prev,
+                       LinearAlgebra::distributed::Vector<Number> *other)
+  {
+    if (other == nullptr)
+      return prev;
+
+    Assert(other->size() == prev.size(), ExcInternalError());
+
+    // import ghost values:
+    other->copy_locally_owned_data_from(prev);
+    other->update_ghost_values();
+    return *other;
+  }
 } // end namespace internal
 
+
+
+template <typename MatrixType, typename InverseNumberType, typename VectorType>
+inline void
+RelaxationBlock<MatrixType, InverseNumberType, VectorType>::block_correction(
+  const size_type                          block,
+  const VectorType &                       prev,
+  const VectorType &                       src,
+  Vector<typename VectorType::value_type> &b_cell,
+  Vector<typename VectorType::value_type> &x_cell) const
+{
+  const MatrixType &M  = *this->A;
+  const size_type   bs = additional_data->block_list.row_length(block);
+
+  b_cell.reinit(bs);
+  x_cell.reinit(bs);
+  // Collect off-diagonal parts
+  SparsityPattern::iterator row = additional_data->block_list.begin(block);
+  for (size_type row_cell = 0; row_cell < bs; ++row_cell, ++row)
+    {
+      b_cell(row_cell) = src(row->column());
+      for (typename MatrixType::const_iterator entry = M.begin(row->column());
+           entry != M.end(row->column());
+           ++entry)
+        b_cell(row_cell) -= entry->value() * prev(entry->column());
+    }
+
+  // Apply inverse diagonal
+  if (additional_data->contiguous_inverses)
+    {
+      const InverseNumberType *inverse =
+        inverse_values.data() + inverse_starts[block];
+      for (size_type i = 0; i < bs; ++i, inverse += bs)
+        {
+          typename VectorType::value_type sum = 0;
+          for (size_type j = 0; j < bs; ++j)
+            sum += inverse[j] * b_cell(j);
+          x_cell(i) = sum;
+        }
+    }
+  else
+    this->inverse_vmult(block, x_cell, b_cell);
+
+#ifdef DEBUG
+  for (unsigned int i = 0; i < x_cell.size(); ++i)
+    {
+      AssertIsFinite(x_cell(i));
+    }
+#endif
+}
+
 template <typename MatrixType, typename InverseNumberType, typename VectorType>
 inline void
 RelaxationBlock<MatrixType, InverseNumberType, VectorType>::do_step(
@@ -227,7 +343,6 @@ RelaxationBlock<MatrixType, InverseNumberType, VectorType>::do_step(
   const VectorType &ghosted_prev =
     internal::prepare_ghost_vector(prev, additional_data->temp_ghost_vector);
 
-  const MatrixType &                      M = *this->A;
   Vector<typename VectorType::value_type> b_cell, x_cell;
 
   const bool         permutation_empty = additional_data->order.size() == 0;
@@ -239,6 +354,43 @@ RelaxationBlock<MatrixType, InverseNumberType, VectorType>::do_step(
     for (unsigned int i = 0; i < additional_data->order.size(); ++i)
       AssertDimension(additional_data->order[i].size(), this->size());
 
+  // In a Jacobi step, the corrections of the blocks only depend on the old
+  // iterate and can be computed in parallel. Since the blocks may overlap,
+  // they are first collected in an array following the layout of the block
+  // list and then added to the result in a serial loop.
+  if (&dst != &prev && permutation_empty)
+    {
+      std::vector<typename VectorType::value_type> corrections(
+        block_starts.back());
+
+      parallel::apply_to_subranges(
+        0,
+        n_blocks,
+        [&](const size_type block_begin, const size_type block_end) {
+          Vector<typename VectorType::value_type> b_cell, x_cell;
+          for (size_type block = block_begin; block < block_end; ++block)
+            {
+              block_correction(block, ghosted_prev, src, b_cell, x_cell);
+              std::copy(x_cell.begin(),
+                        x_cell.end(),
+                        corrections.begin() + block_starts[block]);
+            }
+        },
+        16);
+
+      for (size_type block = 0; block < n_blocks; ++block)
+        {
+          const size_type bs = additional_data->block_list.row_length(block);
+          SparsityPattern::iterator row =
+            additional_data->block_list.begin(block);
+          for (size_type row_cell = 0; row_cell < bs; ++row_cell, ++row)
+            dst(row->column()) += additional_data->relaxation *
+                                  corrections[block_starts[block] + row_cell];
+        }
+      dst.compress(dealii::VectorOperation::add);
+      return;
+    }
+
   for (unsigned int perm = 0; perm < n_permutations; ++perm)
     {
       for (unsigned int bi = 0; bi < n_blocks; ++bi)
@@ -253,31 +405,11 @@ RelaxationBlock<MatrixType, InverseNumberType, VectorType>::do_step(
 
           const size_type bs = additional_data->block_list.row_length(block);
 
-          b_cell.reinit(bs);
-          x_cell.reinit(bs);
-          // Collect off-diagonal parts
+          block_correction(block, ghosted_prev, src, b_cell, x_cell);
+
+          // Store in result vector
           SparsityPattern::iterator row =
             additional_data->block_list.begin(block);
-          for (size_type row_cell = 0; row_cell < bs; ++row_cell, ++row)
-            {
-              b_cell(row_cell) = src(row->column());
-              for (typename MatrixType::const_iterator entry =
-                     M.begin(row->column());
-                   entry != M.end(row->column());
-                   ++entry)
-                b_cell(row_cell) -=
-                  entry->value() * ghosted_prev(entry->column());
-            }
-          // Apply inverse diagonal
-          this->inverse_vmult(block, x_cell, b_cell);
-#ifdef DEBUG
-          for (unsigned int i = 0; i < x_cell.size(); ++i)
-            {
-              AssertIsFinite(x_cell(i));
-            }
-#endif
-          // Store in result vector
-          row = additional_data->block_list.begin(block);
           for (size_type row_cell = 0; row_cell < bs; ++row_cell, ++row)
             dst(row->column()) +=
               additional_data->relaxation * x_cell(row_cell);
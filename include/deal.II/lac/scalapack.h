@@ -235,6 +235,27 @@ public:
   void
   copy_to(ScaLAPACKMatrix<NumberType> &dest) const;
 
+  /**
+   * Start copying the contents of the distributed matrix into a differently
+   * distributed matrix @p dest, like the previous function, but with
+   * non-blocking point-to-point messages between the processes that own
+   * matching parts of the two matrices, rather than with ScaLAPACK's
+   * blocking redistribution routine. The copy is complete once the
+   * Utilities::MPI::Future object returned by this function has been waited
+   * for or destroyed; until then, neither the current matrix nor @p dest
+   * must be modified or destroyed, and the content of @p dest must not be
+   * read. This allows to overlap the redistribution with other work, e.g.,
+   * with assembling the next matrix or with an operation on a different
+   * matrix on the process grid of @p dest.
+   *
+   * The process grids of both matrices must have been built on the same MPI
+   * communicator, or on communicators with the same processes in the same
+   * order. Like the previous function, this function must be called
+   * on all processes of that communicator.
+   */
+  Utilities::MPI::Future<void>
+  copy_to_async(ScaLAPACKMatrix<NumberType> &dest) const;
+
   /**
    * Copy a submatrix (subset) of the distributed matrix A to a submatrix of the distributed matrix @p B.
    *
@@ -21,13 +21,16 @@
 
 #include <deal.II/base/exceptions.h>
 #include <deal.II/base/logstream.h>
+#include <deal.II/base/mpi.h>
 #include <deal.II/base/subscriptor.h>
+#include <deal.II/base/tracing.h>
 #include <deal.II/base/vectorization.h>
 
 #include <deal.II/lac/solver.h>
 #include <deal.II/lac/solver_control.h>
 #include <deal.II/lac/tridiagonal_matrix.h>
 
+#include <array>
 #include <cmath>
 
 DEAL_II_NAMESPACE_OPEN
@@ -383,6 +386,91 @@ public:
 };
 
 
+/**
+ * This class implements a pipelined variant of the preconditioned conjugate
+ * gradient method according to the algorithm by Ghysels and Vanroose
+ * (P. Ghysels, W. Vanroose, "Hiding global synchronization latency in the
+ * preconditioned Conjugate Gradient algorithm", Parallel Computing 40,
+ * pp. 224-238, 2014). In exact arithmetic, it computes the same iterates as
+ * SolverCG. Rather than two global reductions per iteration that each block
+ * until all processes have contributed, the three inner products
+ * $\mathbf{r}^T \mathbf{u}$, $\mathbf{w}^T \mathbf{u}$ and
+ * $\mathbf{r}^T \mathbf{r}$ (with the preconditioned residual $\mathbf{u} =
+ * P^{-1}\mathbf{r}$ and $\mathbf{w} = A\mathbf{u}$) are combined into a
+ * single reduction. For vectors of type LinearAlgebra::distributed::Vector,
+ * this reduction is started with a non-blocking `MPI_Iallreduce` and only
+ * waited for after the application of the preconditioner and the
+ * matrix-vector product of the current iteration, such that the latency of
+ * the global communication is hidden behind the local work. For other
+ * vector types, the inner products are computed with the usual blocking
+ * vector operations, such that the method is functional but does not
+ * overlap communication.
+ *
+ * The price to pay for the overlap are four additional vectors compared to
+ * SolverCG and four additional vector updates per iteration. Furthermore,
+ * the residual norm passed to the SolverControl object lags behind by one
+ * iteration, i.e., the solver applies the preconditioner and the matrix one
+ * additional time before it detects convergence. As the recurrences for the
+ * auxiliary vectors are prone to the accumulation of round-off errors, the
+ * attainable accuracy of the pipelined variant is typically somewhat worse
+ * than the one of SolverCG, so tolerances close to machine precision should
+ * be avoided. The method should be used when the global reductions in
+ * SolverCG dominate the run time, which is typically the case on large
+ * numbers of MPI ranks with cheap matrix-vector products and
+ * preconditioners.
+ *
+ * @note Like SolverCG, this method requires a symmetric matrix and a
+ * symmetric preconditioner.
+ */
+template <typename VectorType = Vector<double>>
+class SolverPipelinedCG : public SolverBase<VectorType>
+{
+public:
+  /**
+   * Declare type for container size.
+   */
+  using size_type = types::global_dof_index;
+
+  /**
+   * Standardized data struct to pipe additional data to the solver.
+   * Here, it does not store anything but just exists for consistency
+   * with the other solver classes.
+   */
+  struct AdditionalData
+  {};
+
+  /**
+   * Constructor.
+   */
+  SolverPipelinedCG(SolverControl &           cn,
+                    VectorMemory<VectorType> &mem,
+                    const AdditionalData &    data = AdditionalData());
+
+  /**
+   * Constructor. Use an object of type GrowingVectorMemory as a default to
+   * allocate memory.
+   */
+  SolverPipelinedCG(SolverControl &       cn,
+                    const AdditionalData &data = AdditionalData());
+
+  /**
+   * Solve the linear system $Ax=b$ for x.
+   */
+  template <typename MatrixType, typename PreconditionerType>
+  void
+  solve(const MatrixType &        A,
+        VectorType &              x,
+        const VectorType &        b,
+        const PreconditionerType &preconditioner);
+
+protected:
+  /**
+   * Additional parameters.
+   */
+  AdditionalData additional_data;
+};
+
+
 /** @} */
 
 /*------------------------- Implementation ----------------------------*/
@@ -1196,6 +1284,120 @@ namespace internal
           }
       }
     };
+
+    // Helper class to compute the three inner products of one iteration of
+    // SolverPipelinedCG. The general implementation computes them with the
+    // (blocking) vector operations of VectorType when start() is called.
+    template <typename VectorType, typename = int>
+    struct PipelinedDotProducts
+    {
+      using Number = typename VectorType::value_type;
+
+      void
+      start(const VectorType &r, const VectorType &u, const VectorType &w)
+      {
+        results[0] = r * u;
+        results[1] = w * u;
+        results[2] = r * r;
+      }
+
+      const std::array<Number, 3> &
+      finish()
+      {
+        return results;
+      }
+
+      std::array<Number, 3> results;
+    };
+
+
+
+    // Specialization for LinearAlgebra::distributed::Vector which computes
+    // the local contributions to the inner products in one sweep over the
+    // vectors and then starts a non-blocking reduction that is completed in
+    // finish().
+    template <typename VectorType>
+    struct PipelinedDotProducts<
+      VectorType,
+      std::enable_if_t<std::is_same<VectorType,
+                                    LinearAlgebra::distributed::Vector<
+                                      typename VectorType::value_type,
+                                      MemorySpace::Host>>::value,
+                       int>>
+    {
+      using Number = typename VectorType::value_type;
+
+      PipelinedDotProducts()
+#ifdef DEAL_II_WITH_MPI
+        : request(MPI_REQUEST_NULL)
+#endif
+      {}
+
+      ~PipelinedDotProducts()
+      {
+#ifdef DEAL_II_WITH_MPI
+        if (request != MPI_REQUEST_NULL)
+          MPI_Wait(&request, MPI_STATUS_IGNORE);
+#endif
+      }
+
+      void
+      start(const VectorType &r, const VectorType &u, const VectorType &w)
+      {
+        const Number *     r_ptr = r.begin();
+        const Number *     u_ptr = u.begin();
+        const Number *     w_ptr = w.begin();
+        const unsigned int size  = r.locally_owned_size();
+
+        Number r_dot_u = Number(), w_dot_u = Number(), r_dot_r = Number();
+        for (unsigned int i = 0; i < size; ++i)
+          {
+            const Number u_i =
+              numbers::NumberTraits<Number>::conjugate(u_ptr[i]);
+            r_dot_u += r_ptr[i] * u_i;
+            w_dot_u += w_ptr[i] * u_i;
+            r_dot_r +=
+              r_ptr[i] * numbers::NumberTraits<Number>::conjugate(r_ptr[i]);
+          }
+        results = {{r_dot_u, w_dot_u, r_dot_r}};
+
+#ifdef DEAL_II_WITH_MPI
+        const MPI_Comm &comm = r.get_mpi_communicator();
+        if (Utilities::MPI::job_supports_mpi() &&
+            Utilities::MPI::n_mpi_processes(comm) > 1)
+          {
+            const int ierr =
+              MPI_Iallreduce(MPI_IN_PLACE,
+                             results.data(),
+                             3,
+                             Utilities::MPI::mpi_type_id_for_type<Number>,
+                             MPI_SUM,
+                             comm,
+                             &request);
+            AssertThrowMPI(ierr);
+          }
+#endif
+      }
+
+      const std::array<Number, 3> &
+      finish()
+      {
+#ifdef DEAL_II_WITH_MPI
+        if (request != MPI_REQUEST_NULL)
+          {
+            const int ierr = MPI_Wait(&request, MPI_STATUS_IGNORE);
+            AssertThrowMPI(ierr);
+          }
+#endif
+        return results;
+      }
+
+      std::array<Number, 3> results;
+
+#ifdef DEAL_II_WITH_MPI
+      MPI_Request request;
+#endif
+    };
   } // namespace SolverCG
 } // namespace internal
 
@@ -1209,6 +1411,8 @@ SolverCG<VectorType>::solve(const MatrixType &        A,
                             const VectorType &        b,
                             const PreconditionerType &preconditioner)
 {
+  DEAL_II_TRACE_SCOPE("SolverCG::solve", "solver");
+
   using number = typename VectorType::value_type;
 
   SolverControl::State solver_state = SolverControl::iterate;
@@ -1350,6 +1554,156 @@ SolverFlexibleCG<VectorType>::SolverFlexibleCG(SolverControl &cn,
 
 
 
+
+template <typename VectorType>
+SolverPipelinedCG<VectorType>::SolverPipelinedCG(SolverControl &           cn,
+                                                 VectorMemory<VectorType> &mem,
+                                                 const AdditionalData &data)
+  : SolverBase<VectorType>(cn, mem)
+  , additional_data(data)
+{}
+
+
+
+template <typename VectorType>
+SolverPipelinedCG<VectorType>::SolverPipelinedCG(SolverControl &       cn,
+                                                 const AdditionalData &data)
+  : SolverBase<VectorType>(cn)
+  , additional_data(data)
+{}
+
+
+
+template <typename VectorType>
+template <typename MatrixType, typename PreconditionerType>
+void
+SolverPipelinedCG<VectorType>::solve(const MatrixType &        A,
+                                     VectorType &              x,
+                                     const VectorType &        b,
+                                     const PreconditionerType &preconditioner)
+{
+  DEAL_II_TRACE_SCOPE("SolverPipelinedCG::solve", "solver");
+
+  using number = typename VectorType::value_type;
+
+  SolverControl::State solver_state = SolverControl::iterate;
+
+  LogStream::Prefix prefix("pipelined_cg");
+
+  // the vectors of the Ghysels-Vanroose algorithm: r is the residual, u the
+  // preconditioned residual, w = A u, m = P^{-1} w, n = A m, p the search
+  // direction, and s = A p, q = P^{-1} s, z = A q are the auxiliary vectors
+  // that replace the matrix-vector products by recurrences
+  typename VectorMemory<VectorType>::Pointer r_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer u_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer w_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer m_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer n_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer p_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer s_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer q_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer z_pointer(this->memory);
+
+  VectorType &r = *r_pointer;
+  VectorType &u = *u_pointer;
+  VectorType &w = *w_pointer;
+  VectorType &m = *m_pointer;
+  VectorType &n = *n_pointer;
+  VectorType &p = *p_pointer;
+  VectorType &s = *s_pointer;
+  VectorType &q = *q_pointer;
+  VectorType &z = *z_pointer;
+
+  r.reinit(x, true);
+  u.reinit(x, true);
+  w.reinit(x, true);
+  m.reinit(x, true);
+  n.reinit(x, true);
+  p.reinit(x, true);
+  s.reinit(x, true);
+  q.reinit(x, true);
+  z.reinit(x, true);
+
+  // compute residual. if vector is zero, then short-circuit the full
+  // computation
+  if (!x.all_zero())
+    {
+      A.vmult(r, x);
+      r.sadd(-1., 1., b);
+    }
+  else
+    r.equ(1., b);
+
+  preconditioner.vmult(u, r);
+  A.vmult(w, u);
+
+  internal::SolverCG::PipelinedDotProducts<VectorType> dot_products;
+
+  number gamma = number(), previous_gamma = number();
+  number alpha = number(), beta = number();
+
+  double residual_norm = 0.;
+
+  int it = 0;
+  while (true)
+    {
+      // start the reduction for the inner products of this iteration and
+      // overlap them with the preconditioner and the matrix-vector product
+      dot_products.start(r, u, w);
+
+      preconditioner.vmult(m, w);
+      A.vmult(n, m);
+
+      const std::array<number, 3> &sums = dot_products.finish();
+
+      // the residual norm refers to the residual vector at the start of this
+      // iteration, so we check convergence before updating the iterates
+      residual_norm = std::sqrt(std::abs(sums[2]));
+      solver_state  = this->iteration_status(it, residual_norm, x);
+      if (solver_state != SolverControl::iterate)
+        break;
+
+      ++it;
+
+      previous_gamma = gamma;
+      gamma          = sums[0];
+      const number delta = sums[1];
+      if (it > 1)
+        {
+          Assert(std::abs(previous_gamma) != 0., ExcDivideByZero());
+          beta = gamma / previous_gamma;
+          Assert(std::abs(delta - beta * gamma / alpha) != 0.,
+                 ExcDivideByZero());
+          alpha = gamma / (delta - beta * gamma / alpha);
+
+          z.sadd(beta, 1., n);
+          q.sadd(beta, 1., m);
+          s.sadd(beta, 1., w);
+          p.sadd(beta, 1., u);
+        }
+      else
+        {
+          Assert(std::abs(delta) != 0., ExcDivideByZero());
+          beta  = number();
+          alpha = gamma / delta;
+
+          z.equ(1., n);
+          q.equ(1., m);
+          s.equ(1., w);
+          p.equ(1., u);
+        }
+
+      x.add(alpha, p);
+      r.add(-alpha, s);
+      u.add(-alpha, q);
+      w.add(-alpha, z);
+    }
+
+  AssertThrow(solver_state == SolverControl::success,
+              SolverControl::NoConvergence(it, residual_norm));
+}
+
+
 #endif // DOXYGEN
 
 DEAL_II_NAMESPACE_CLOSE
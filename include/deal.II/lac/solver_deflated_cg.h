@@ -0,0 +1,496 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+#ifndef dealii_solver_deflated_cg_h
+#define dealii_solver_deflated_cg_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/logstream.h>
+
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/lapack_full_matrix.h>
+#include <deal.II/lac/solver.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/vector.h>
+#include <deal.II/lac/vector_memory.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * @addtogroup Solvers
+ * @{
+ */
+
+/**
+ * Deflated preconditioned Conjugate Gradient method with recycling of the
+ * deflation space, for the solution of sequences of linear systems with
+ * symmetric positive definite matrices that change only little from one
+ * system to the next, as arising in time stepping or parameter studies.
+ *
+ * The method follows the algorithm of Y. Saad, M. Yeung, J. Erhel, and F.
+ * Guyomarc'h, "A deflated version of the conjugate gradient algorithm", SIAM
+ * J. Sci. Comput. 21 (2000), pp. 1909-1926: Given a set of $k$ linearly
+ * independent deflation vectors $W$, the initial guess is corrected such that
+ * the residual is orthogonal to $W$, and all search directions are kept
+ * $A$-orthogonal to $W$,
+ * @f[
+ *   p_{j+1} = z_{j+1} + \beta_j p_j - W \mu_j, \qquad
+ *   (W^T A W)\, \mu_j = (A W)^T z_{j+1},
+ * @f]
+ * where $z_{j+1} = P^{-1} r_{j+1}$ is the preconditioned residual. In
+ * effect, the components of the solution in the span of $W$ are computed by
+ * a Galerkin projection, and the iteration only has to resolve the
+ * remainder. If $W$ approximates the eigenvectors belonging to the smallest
+ * eigenvalues, the convergence is governed by the effective condition number
+ * given by the ratio of the largest eigenvalue to the smallest eigenvalue
+ * that is not deflated.
+ *
+ * The deflation vectors are stored in the solver object and updated at the
+ * end of each call to solve(): The first
+ * AdditionalData::n_collected_directions search directions of the solve, all
+ * of which are $A$-orthogonal to each other and to $W$, together with the
+ * current $W$ span a subspace in which the Ritz vectors of the matrix
+ * belonging to the AdditionalData::n_deflation_vectors smallest Ritz values
+ * are computed by a Rayleigh-Ritz procedure. These become the deflation
+ * vectors of the next call to solve(). The first solve is thus a plain
+ * preconditioned CG solve that builds the space, and the subsequent solves
+ * benefit from a space that improves from one call to the next.
+ *
+ * Since the matrix may change from one system to the next, the products of
+ * the matrix with the deflation vectors are recomputed at the start of each
+ * solve, which costs $k$ matrix-vector products, with $k$ the number of
+ * deflation vectors. Each iteration additionally needs $k$ inner products
+ * and $k$ vector updates, and the update of the space at the end of a solve
+ * costs about $\frac12 (k+m)^2$ inner products, with $m$ the number of
+ * collected search directions. Besides the $k$ deflation vectors, memory for
+ * $k+m$ vectors is needed during the solve. For sequences of related systems
+ * whose preconditioner leaves a number of small eigenvalues, the iteration
+ * counts typically drop by 30-60% after a few solves, which outweighs these
+ * overheads for matrices that are expensive to apply compared to vector
+ * operations.
+ *
+ * The deflation space can be accessed through get_deflation_vectors() and
+ * set with set_deflation_vectors(), e.g., to persist it between runs of a
+ * program or to transfer it between solver objects.
+ *
+ * A typical use for a time stepping loop is
+ * @code
+ *   SolverControl                   solver_control(1000, 1e-12);
+ *   SolverDeflatedCG<Vector<double>> solver(solver_control);
+ *
+ *   for (unsigned int step = 0; step < n_steps; ++step)
+ *     {
+ *       assemble_system();
+ *       solver.solve(system_matrix, solution, system_rhs, preconditioner);
+ *     }
+ * @endcode
+ *
+ * The matrix must be symmetric and positive definite, and the preconditioner
+ * must be symmetric and positive definite as well. Besides the usual vector
+ * operations required by all solvers, the deflation vectors need the vector
+ * type to be copy constructible.
+ *
+ * @note The update of the deflation space solves a small generalized
+ * eigenvalue problem with LAPACK and thus requires deal.II to be configured
+ * with LAPACK.
+ *
+ *
+ * <h3>Observing the progress of linear solver iterations</h3>
+ *
+ * The solve() function of this class uses the mechanism described in the
+ * Solver base class to determine convergence. This mechanism can also be used
+ * to observe the progress of the iteration.
+ */
+template <typename VectorType = Vector<double>>
+class SolverDeflatedCG : public SolverBase<VectorType>
+{
+public:
+  /**
+   * Standardized data struct to pipe additional data to the solver.
+   */
+  struct AdditionalData
+  {
+    /**
+     * Constructor. By default, keep ten deflation vectors and extract them
+     * from the previous deflation space and the first 40 search directions
+     * of each solve.
+     */
+    explicit AdditionalData(const unsigned int n_deflation_vectors    = 10,
+                            const unsigned int n_collected_directions = 40);
+
+    /**
+     * Maximal number of deflation vectors kept from one call of solve() to
+     * the next. A value of zero disables the recycling and turns this class
+     * into a plain preconditioned CG method, unless vectors are set by
+     * set_deflation_vectors().
+     */
+    unsigned int n_deflation_vectors;
+
+    /**
+     * Number of search directions of each solve that are stored to update
+     * the deflation space at the end of the solve.
+     */
+    unsigned int n_collected_directions;
+  };
+
+  /**
+   * Constructor.
+   */
+  SolverDeflatedCG(SolverControl &           cn,
+                   VectorMemory<VectorType> &mem,
+                   const AdditionalData &    data = AdditionalData());
+
+  /**
+   * Constructor. Use an object of type GrowingVectorMemory as a default to
+   * allocate memory.
+   */
+  SolverDeflatedCG(SolverControl &       cn,
+                   const AdditionalData &data = AdditionalData());
+
+  /**
+   * Solve the linear system $Ax=b$ for x, deflating the current deflation
+   * space, and update the deflation space afterwards.
+   */
+  template <typename MatrixType, typename PreconditionerType>
+  void
+  solve(const MatrixType &        A,
+        VectorType &              x,
+        const VectorType &        b,
+        const PreconditionerType &preconditioner);
+
+  /**
+   * Return the current deflation vectors.
+   */
+  const std::vector<VectorType> &
+  get_deflation_vectors() const;
+
+  /**
+   * Set the deflation vectors to be used by the next call of solve(). The
+   * vectors must be linearly independent and have the layout of the
+   * solution vector.
+   */
+  void
+  set_deflation_vectors(const std::vector<VectorType> &vectors);
+
+  /**
+   * Delete the deflation vectors, such that the next call of solve() starts
+   * building the deflation space anew.
+   */
+  void
+  clear_deflation_vectors();
+
+protected:
+  /**
+   * Compute the new deflation vectors by a Rayleigh-Ritz procedure in the
+   * space spanned by the current deflation vectors and the collected search
+   * directions @p P, scaled to unit energy norm. The matrix @p E contains
+   * the products of the matrix with the current deflation vectors.
+   */
+  void
+  update_deflation_vectors(
+    const FullMatrix<double> &                                     E,
+    const std::vector<typename VectorMemory<VectorType>::Pointer> &P,
+    const unsigned int n_collected);
+
+  /**
+   * Additional parameters.
+   */
+  AdditionalData additional_data;
+
+  /**
+   * The deflation vectors.
+   */
+  std::vector<VectorType> deflation_vectors;
+};
+
+/** @} */
+/*------------------------- Implementation ----------------------------*/
+
+#ifndef DOXYGEN
+
+template <typename VectorType>
+inline SolverDeflatedCG<VectorType>::AdditionalData::AdditionalData(
+  const unsigned int n_deflation_vectors,
+  const unsigned int n_collected_directions)
+  : n_deflation_vectors(n_deflation_vectors)
+  , n_collected_directions(n_collected_directions)
+{}
+
+
+
+template <typename VectorType>
+SolverDeflatedCG<VectorType>::SolverDeflatedCG(SolverControl &           cn,
+                                               VectorMemory<VectorType> &mem,
+                                               const AdditionalData &    data)
+  : SolverBase<VectorType>(cn, mem)
+  , additional_data(data)
+{}
+
+
+
+template <typename VectorType>
+SolverDeflatedCG<VectorType>::SolverDeflatedCG(SolverControl &       cn,
+                                               const AdditionalData &data)
+  : SolverBase<VectorType>(cn)
+  , additional_data(data)
+{}
+
+
+
+template <typename VectorType>
+const std::vector<VectorType> &
+SolverDeflatedCG<VectorType>::get_deflation_vectors() const
+{
+  return deflation_vectors;
+}
+
+
+
+template <typename VectorType>
+void
+SolverDeflatedCG<VectorType>::set_deflation_vectors(
+  const std::vector<VectorType> &vectors)
+{
+  deflation_vectors = vectors;
+}
+
+
+
+template <typename VectorType>
+void
+SolverDeflatedCG<VectorType>::clear_deflation_vectors()
+{
+  deflation_vectors.clear();
+}
+
+
+
+template <typename VectorType>
+template <typename MatrixType, typename PreconditionerType>
+void
+SolverDeflatedCG<VectorType>::solve(const MatrixType &        A,
+                                    VectorType &              x,
+                                    const VectorType &        b,
+                                    const PreconditionerType &preconditioner)
+{
+  using VectorPointer = typename VectorMemory<VectorType>::Pointer;
+
+  LogStream::Prefix prefix("deflated_cg");
+
+  const unsigned int n_deflation = deflation_vectors.size();
+
+  // products of the matrix with the deflation vectors and the inverse of
+  // the projected matrix E = W^T A W
+  std::vector<VectorPointer> AW;
+  FullMatrix<double>         E(n_deflation, n_deflation);
+  FullMatrix<double>         E_inverse(n_deflation, n_deflation);
+  for (unsigned int i = 0; i < n_deflation; ++i)
+    {
+      AW.emplace_back(this->memory);
+      AW[i]->reinit(x, true);
+      A.vmult(*AW[i], deflation_vectors[i]);
+    }
+  for (unsigned int i = 0; i < n_deflation; ++i)
+    for (unsigned int j = 0; j <= i; ++j)
+      E(i, j) = E(j, i) = deflation_vectors[i] * (*AW[j]);
+  if (n_deflation > 0)
+    E_inverse.invert(E);
+
+  // compute E^{-1} V^T v for a set of vectors V, used both for the initial
+  // guess and to make the search directions A-orthogonal to W
+  Vector<double> projection(n_deflation), coefficients(n_deflation);
+  const auto     compute_coefficients = [&](const auto &      V,
+                                          const VectorType &v) {
+    for (unsigned int i = 0; i < n_deflation; ++i)
+      projection(i) = v * (*V[i]);
+    E_inverse.vmult(coefficients, projection);
+  };
+
+  // the first search directions, scaled to unit energy norm
+  const unsigned int         n_collect = additional_data.n_collected_directions;
+  std::vector<VectorPointer> P;
+  unsigned int               n_collected = 0;
+
+  VectorPointer r_pointer(this->memory);
+  VectorPointer z_pointer(this->memory);
+  VectorPointer p_pointer(this->memory);
+  VectorPointer Ap_pointer(this->memory);
+
+  VectorType &r  = *r_pointer;
+  VectorType &z  = *z_pointer;
+  VectorType &p  = *p_pointer;
+  VectorType &Ap = *Ap_pointer;
+
+  r.reinit(x, true);
+  z.reinit(x, true);
+  p.reinit(x, true);
+  Ap.reinit(x, true);
+
+  A.vmult(r, x);
+  r.sadd(-1., 1., b);
+
+  // correct the initial guess by the Galerkin projection onto W, such that
+  // the residual is orthogonal to W
+  if (n_deflation > 0)
+    {
+      std::vector<const VectorType *> W(n_deflation);
+      for (unsigned int i = 0; i < n_deflation; ++i)
+        W[i] = &deflation_vectors[i];
+      compute_coefficients(W, r);
+      for (unsigned int i = 0; i < n_deflation; ++i)
+        {
+          x.add(coefficients(i), deflation_vectors[i]);
+          r.add(-coefficients(i), *AW[i]);
+        }
+    }
+
+  double               residual_norm = r.l2_norm();
+  unsigned int         it            = 0;
+  SolverControl::State solver_state =
+    this->iteration_status(it, residual_norm, x);
+
+  double r_dot_z = 0.;
+  if (solver_state == SolverControl::iterate)
+    {
+      preconditioner.vmult(z, r);
+      r_dot_z = r * z;
+      p       = z;
+      if (n_deflation > 0)
+        {
+          compute_coefficients(AW, z);
+          for (unsigned int i = 0; i < n_deflation; ++i)
+            p.add(-coefficients(i), deflation_vectors[i]);
+        }
+    }
+
+  while (solver_state == SolverControl::iterate)
+    {
+      ++it;
+
+      A.vmult(Ap, p);
+      const double p_dot_Ap = p * Ap;
+      Assert(p_dot_Ap > 0.,
+             ExcMessage("The matrix or the preconditioner is not positive "
+                        "definite."));
+      const double alpha = r_dot_z / p_dot_Ap;
+
+      if (n_collected < n_collect)
+        {
+          P.emplace_back(this->memory);
+          P[n_collected]->reinit(x, true);
+          P[n_collected]->equ(1. / std::sqrt(p_dot_Ap), p);
+          ++n_collected;
+        }
+
+      x.add(alpha, p);
+      residual_norm = std::sqrt(std::abs(r.add_and_dot(-alpha, Ap, r)));
+
+      solver_state = this->iteration_status(it, residual_norm, x);
+      if (solver_state != SolverControl::iterate)
+        break;
+
+      preconditioner.vmult(z, r);
+      const double r_dot_z_old = r_dot_z;
+      r_dot_z                  = r * z;
+      p.sadd(r_dot_z / r_dot_z_old, 1., z);
+      if (n_deflation > 0)
+        {
+          compute_coefficients(AW, z);
+          for (unsigned int i = 0; i < n_deflation; ++i)
+            p.add(-coefficients(i), deflation_vectors[i]);
+        }
+    }
+
+  // update the deflation space also in case the solver did not converge,
+  // since the space collected so far is still useful
+  update_deflation_vectors(E, P, n_collected);
+
+  // in case of failure: throw exception
+  AssertThrow(solver_state == SolverControl::success,
+              SolverControl::NoConvergence(it, residual_norm));
+  // otherwise exit as normal
+}
+
+
+
+template <typename VectorType>
+void
+SolverDeflatedCG<VectorType>::update_deflation_vectors(
+  const FullMatrix<double> &                                     E,
+  const std::vector<typename VectorMemory<VectorType>::Pointer> &P,
+  const unsigned int                                             n_collected)
+{
+  const unsigned int n_deflation = deflation_vectors.size();
+  const unsigned int n_basis     = n_deflation + n_collected;
+  const unsigned int n_new =
+    std::min(additional_data.n_deflation_vectors, n_basis);
+
+  if (n_new == 0)
+    {
+      deflation_vectors.clear();
+      return;
+    }
+
+  const auto basis_vector = [&](const unsigned int i) -> const VectorType & {
+    return i < n_deflation ? deflation_vectors[i] : *P[i - n_deflation];
+  };
+
+  // Rayleigh-Ritz procedure in the space Z = [W, P]: the eigenvalue problem
+  // Z^T A Z y = theta Z^T Z y is solved in the form Z^T Z y = 1/theta Z^T A
+  // Z y, such that the well-conditioned matrix Z^T A Z is the one that gets
+  // factorized. Since the search directions are A-orthogonal to each other
+  // and to W, and scaled to unit energy norm, Z^T A Z is block-diagonal with
+  // the blocks E and identity, and only Z^T Z needs to be computed.
+  LAPACKFullMatrix<double> mass(n_basis, n_basis);
+  LAPACKFullMatrix<double> energy(n_basis, n_basis);
+  for (unsigned int i = 0; i < n_basis; ++i)
+    for (unsigned int j = 0; j <= i; ++j)
+      mass(i, j) = mass(j, i) = basis_vector(i) * basis_vector(j);
+  for (unsigned int i = 0; i < n_deflation; ++i)
+    for (unsigned int j = 0; j < n_deflation; ++j)
+      energy(i, j) = E(i, j);
+  for (unsigned int i = n_deflation; i < n_basis; ++i)
+    energy(i, i) = 1.;
+
+  // the eigenvalues 1/theta are returned in ascending order, so the Ritz
+  // vectors of the smallest Ritz values are the last ones
+  std::vector<Vector<double>> eigenvectors(n_basis, Vector<double>(n_basis));
+  mass.compute_generalized_eigenvalues_symmetric(energy, eigenvectors);
+
+  std::vector<VectorType> new_deflation_vectors(n_new);
+  for (unsigned int l = 0; l < n_new; ++l)
+    {
+      const Vector<double> &y = eigenvectors[n_basis - 1 - l];
+      new_deflation_vectors[l].reinit(basis_vector(0));
+      for (unsigned int i = 0; i < n_basis; ++i)
+        new_deflation_vectors[l].add(y(i), basis_vector(i));
+    }
+
+  deflation_vectors = std::move(new_deflation_vectors);
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
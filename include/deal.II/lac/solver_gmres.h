@@ -20,6 +20,7 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/array_view.h>
 #include <deal.II/base/logstream.h>
 #include <deal.II/base/subscriptor.h>
 #include <deal.II/base/vectorization.h>
@@ -121,6 +122,62 @@ namespace internal
        */
       std::vector<typename VectorMemory<VectorType>::Pointer> data;
     };
+
+
+
+    /**
+     * Class to hold the Arnoldi basis vectors in single precision, see
+     * SolverGMRES::AdditionalData::store_basis_in_single_precision. Only the
+     * locally owned elements of the vectors are stored.
+     */
+    class SinglePrecisionBasis
+    {
+    public:
+      /**
+       * Constructor. Prepares storage for at most @p max_size vectors.
+       */
+      SinglePrecisionBasis(const unsigned int max_size);
+
+      /**
+       * Round the vector @p v to single precision and store it as basis
+       * vector number @p i.
+       */
+      template <class VectorType>
+      void
+      store(const unsigned int i, const VectorType &v);
+
+      /**
+       * Orthogonalize the vector @p vv against the @p dim basis vectors
+       * given by the first <tt>dim-1</tt> stored vectors and the vector
+       * @p current using two passes of the classical Gram-Schmidt algorithm,
+       * with one global reduction per pass. The factors are stored in
+       * @p h. Returns the norm of the orthogonalized vector.
+       */
+      template <class VectorType>
+      double
+      orthogonalize(const unsigned int dim,
+                    const VectorType & current,
+                    VectorType &       vv,
+                    Vector<double> &   h) const;
+
+      /**
+       * Add the linear combination of the first @p dim stored vectors with
+       * the coefficients @p h to @p p, or set @p p to it if @p zero_out is
+       * true.
+       */
+      template <class VectorType>
+      void
+      add(VectorType &          p,
+          const unsigned int    dim,
+          const Vector<double> &h,
+          const bool            zero_out) const;
+
+    private:
+      /**
+       * Field for storing the vectors.
+       */
+      std::vector<std::vector<float>> data;
+    };
   } // namespace SolverGMRESImplementation
 } // namespace internal
 
@@ -166,6 +223,25 @@ namespace internal
  * off between memory consumption and convergence speed, since a longer basis
  * means minimization over a larger space.
  *
+ *
+ * <h3>Reduced-precision basis storage</h3>
+ *
+ * For large problems, the Arnoldi basis dominates the memory consumption of
+ * the solver, and reading the basis vectors in the orthogonalization and in
+ * the update of the solution dominates its run time, since these operations
+ * are limited by the memory bandwidth. With the flag
+ * AdditionalData::store_basis_in_single_precision, all basis vectors except
+ * the most recent one are kept in single precision, which halves the memory
+ * of the basis and the memory traffic of the orthogonalization for vectors
+ * in double precision. The rounding of the basis only perturbs the Krylov
+ * space in which the solution is sought, whereas the residual that is
+ * minimized and the Hessenberg matrix keep the full precision. As long as the
+ * requested tolerance is well above the single precision round-off relative
+ * to the residual at the start of the restart cycle, the convergence is
+ * virtually unaffected; the restart then recomputes the true residual in full
+ * precision, so that the attainable accuracy is not limited by the storage
+ * of the basis.
+ *
  * For the requirements on matrices and vectors in order to work with this
  * class, see the documentation of the Solver base class.
  *
@@ -209,7 +285,23 @@ public:
        * more efficient than the modified Gram-Schmidt algorithm.
        * However, it might be numerically unstable.
        */
-      classical_gram_schmidt
+      classical_gram_schmidt,
+      /**
+       * Use classical Gram-Schmidt algorithm with unconditional
+       * re-orthogonalization (CGS2). Both passes compute the projection
+       * coefficients together with the norm of the vector in a single global
+       * reduction and obtain the norm of the orthogonalized vector by the
+       * Pythagorean theorem, such that each Arnoldi step needs only two
+       * global reductions, the same as the classical Gram-Schmidt algorithm
+       * without re-orthogonalization. This strategy combines the
+       * communication efficiency of the classical Gram-Schmidt algorithm
+       * with the stability of the modified Gram-Schmidt algorithm and is
+       * recommended for large-scale parallel computations where the inner
+       * products dominate the run time. The flag
+       * AdditionalData::force_re_orthogonalization has no effect with this
+       * strategy.
+       */
+      classical_gram_schmidt_reorthogonalized
     };
 
     /**
@@ -217,7 +309,8 @@ public:
      * i.e. do a restart every 28 iterations. Also set preconditioning from
      * left, the residual of the stopping criterion to the default residual,
      * and re-orthogonalization only if necessary. Also, the batched mode with
-     * reduced functionality to track information is disabled by default.
+     * reduced functionality to track information is disabled by default,
+     * and the basis vectors are stored with the precision of @p VectorType.
      */
     explicit AdditionalData(
       const unsigned int              max_n_tmp_vectors          = 30,
@@ -226,7 +319,8 @@ public:
       const bool                      force_re_orthogonalization = false,
       const bool                      batched_mode               = false,
       const OrthogonalizationStrategy orthogonalization_strategy =
-        OrthogonalizationStrategy::modified_gram_schmidt);
+        OrthogonalizationStrategy::modified_gram_schmidt,
+      const bool store_basis_in_single_precision = false);
 
     /**
      * Maximum number of temporary vectors. This parameter controls the size
@@ -270,6 +364,25 @@ public:
      * Strategy to orthogonalize vectors.
      */
     OrthogonalizationStrategy orthogonalization_strategy;
+
+    /**
+     * Flag to store the Arnoldi basis vectors in single precision. If set,
+     * only the most recent basis vector, which enters the next product with
+     * the matrix, and the vector being orthogonalized are kept as vectors of
+     * type @p VectorType; all previous basis vectors are rounded to
+     * <tt>float</tt> once they are complete. The Hessenberg matrix, the
+     * Givens rotations, and the update of the solution are computed in
+     * double precision. See the section on reduced-precision basis storage
+     * in the documentation of this class.
+     *
+     * This option is available for the vector types Vector and
+     * LinearAlgebra::distributed::Vector (on the host). It always uses the
+     * classical Gram-Schmidt algorithm with re-orthogonalization, so
+     * #orthogonalization_strategy and #force_re_orthogonalization are
+     * ignored, and it cannot be combined with a slot connected through
+     * connect_krylov_space_slot().
+     */
+    bool store_basis_in_single_precision;
   };
 
   /**
@@ -625,6 +738,204 @@ namespace internal
 
 
 
+    // Return a view to the locally owned elements of a vector with
+    // contiguous storage, as needed by SinglePrecisionBasis. Other vector
+    // types are not supported.
+    template <class VectorType>
+    inline ArrayView<typename VectorType::value_type>
+    locally_owned_values(const VectorType &)
+    {
+      AssertThrow(false,
+                  ExcMessage("Storing the Arnoldi basis in single precision "
+                             "is only implemented for the vector types "
+                             "Vector and LinearAlgebra::distributed::Vector."));
+      return {};
+    }
+
+
+
+    template <class Number>
+    inline ArrayView<Number>
+    locally_owned_values(dealii::Vector<Number> &v)
+    {
+      return make_array_view(v.begin(), v.end());
+    }
+
+
+
+    template <class Number>
+    inline ArrayView<const Number>
+    locally_owned_values(const dealii::Vector<Number> &v)
+    {
+      return make_array_view(v.begin(), v.end());
+    }
+
+
+
+    template <class Number>
+    inline ArrayView<Number>
+    locally_owned_values(
+      LinearAlgebra::distributed::Vector<Number, MemorySpace::Host> &v)
+    {
+      return make_array_view(v.begin(), v.begin() + v.locally_owned_size());
+    }
+
+
+
+    template <class Number>
+    inline ArrayView<const Number>
+    locally_owned_values(
+      const LinearAlgebra::distributed::Vector<Number, MemorySpace::Host> &v)
+    {
+      return make_array_view(v.begin(), v.begin() + v.locally_owned_size());
+    }
+
+
+
+    // Return the communicator over which the elements returned by
+    // locally_owned_values() are distributed.
+    template <class VectorType>
+    inline MPI_Comm
+    locally_owned_values_communicator(const VectorType &)
+    {
+      return MPI_COMM_SELF;
+    }
+
+
+
+    template <class Number>
+    inline MPI_Comm
+    locally_owned_values_communicator(
+      const LinearAlgebra::distributed::Vector<Number, MemorySpace::Host> &v)
+    {
+      return v.get_mpi_communicator();
+    }
+
+
+
+    inline SinglePrecisionBasis::SinglePrecisionBasis(
+      const unsigned int max_size)
+      : data(max_size)
+    {}
+
+
+
+    template <class VectorType>
+    inline void
+    SinglePrecisionBasis::store(const unsigned int i, const VectorType &v)
+    {
+      AssertIndexRange(i, data.size());
+
+      const auto values = locally_owned_values(v);
+      data[i].resize(values.size());
+      for (std::size_t j = 0; j < values.size(); ++j)
+        data[i][j] = static_cast<float>(values[j]);
+    }
+
+
+
+    template <class VectorType>
+    inline double
+    SinglePrecisionBasis::orthogonalize(const unsigned int dim,
+                                        const VectorType & current,
+                                        VectorType &       vv,
+                                        Vector<double> &   h) const
+    {
+      Assert(dim > 0, ExcInternalError());
+      AssertIndexRange(dim - 1, data.size());
+
+      const auto        current_values = locally_owned_values(current);
+      const auto        values         = locally_owned_values(vv);
+      const std::size_t local_size     = values.size();
+      AssertDimension(current_values.size(), local_size);
+
+      for (unsigned int i = 0; i < dim; ++i)
+        h(i) = 0.;
+
+      // collect the dim projection coefficients and the norm of vv in a
+      // single array to compute all of them with one global reduction
+      Vector<double> local_sums(dim + 1);
+
+      double norm_vv_squared = 0.;
+      for (unsigned int c = 0; c < 2; ++c)
+        {
+          for (unsigned int i = 0; i < dim - 1; ++i)
+            {
+              AssertDimension(data[i].size(), local_size);
+              const float *basis_vector = data[i].data();
+              double       sum          = 0.;
+              DEAL_II_OPENMP_SIMD_PRAGMA
+              for (std::size_t j = 0; j < local_size; ++j)
+                sum += basis_vector[j] * values[j];
+              local_sums(i) = sum;
+            }
+          double sum = 0., norm_squared = 0.;
+          DEAL_II_OPENMP_SIMD_PRAGMA
+          for (std::size_t j = 0; j < local_size; ++j)
+            {
+              sum += current_values[j] * values[j];
+              norm_squared += values[j] * values[j];
+            }
+          local_sums(dim - 1) = sum;
+          local_sums(dim)     = norm_squared;
+
+          Utilities::MPI::sum(local_sums,
+                              locally_owned_values_communicator(vv),
+                              local_sums);
+
+          for (std::size_t j = 0; j < local_size; ++j)
+            {
+              double temp = values[j] - local_sums(dim - 1) * current_values[j];
+              for (unsigned int i = 0; i < dim - 1; ++i)
+                temp -= local_sums(i) * data[i][j];
+              values[j] = temp;
+            }
+
+          // the norm after the projection follows from the Pythagorean
+          // theorem since the basis vectors are orthonormal
+          norm_vv_squared = local_sums(dim);
+          for (unsigned int i = 0; i < dim; ++i)
+            {
+              h(i) += local_sums(i);
+              norm_vv_squared -= local_sums(i) * local_sums(i);
+            }
+        }
+
+      // the basis vectors are only orthonormal up to the single precision
+      // round-off, so compute the norm explicitly in case of cancellation
+      double norm_h_squared = 0.;
+      for (unsigned int i = 0; i < dim; ++i)
+        norm_h_squared += h(i) * h(i);
+      if (!(norm_vv_squared >
+            100. * std::numeric_limits<float>::epsilon() * norm_h_squared))
+        return vv.l2_norm();
+
+      return std::sqrt(norm_vv_squared);
+    }
+
+
+
+    template <class VectorType>
+    inline void
+    SinglePrecisionBasis::add(VectorType &          p,
+                              const unsigned int    dim,
+                              const Vector<double> &h,
+                              const bool            zero_out) const
+    {
+      AssertIndexRange(dim, data.size() + 1);
+
+      const auto values = locally_owned_values(p);
+      for (std::size_t j = 0; j < values.size(); ++j)
+        {
+          double temp = zero_out ? 0. : values[j];
+          for (unsigned int i = 0; i < dim; ++i)
+            temp += h(i) * data[i][j];
+          values[j] = temp;
+        }
+    }
+
+
+
     // A comparator for better printing eigenvalues
     inline bool
     complex_less_pred(const std::complex<double> &x,
@@ -663,13 +974,15 @@ inline SolverGMRES<VectorType>::AdditionalData::AdditionalData(
   const bool                      use_default_residual,
   const bool                      force_re_orthogonalization,
   const bool                      batched_mode,
-  const OrthogonalizationStrategy orthogonalization_strategy)
+  const OrthogonalizationStrategy orthogonalization_strategy,
+  const bool                      store_basis_in_single_precision)
   : max_n_tmp_vectors(max_n_tmp_vectors)
   , right_preconditioning(right_preconditioning)
   , use_default_residual(use_default_residual)
   , force_re_orthogonalization(force_re_orthogonalization)
   , batched_mode(batched_mode)
   , orthogonalization_strategy(orthogonalization_strategy)
+  , store_basis_in_single_precision(store_basis_in_single_precision)
 {
   Assert(3 <= max_n_tmp_vectors,
          ExcMessage("SolverGMRES needs at least three "
@@ -906,6 +1219,142 @@ namespace internal
     }
 
 
+    template <class VectorType>
+    double
+    Tvmult_add_and_norm_squared(
+      const unsigned int dim,
+      const VectorType & vv,
+      const internal::SolverGMRESImplementation::TmpVectors<VectorType>
+        &             orthogonal_vectors,
+      Vector<double> &h)
+    {
+      for (unsigned int i = 0; i < dim; ++i)
+        h[i] += vv * orthogonal_vectors[i];
+      return vv.norm_sqr();
+    }
+
+
+
+    template <class Number>
+    double
+    Tvmult_add_and_norm_squared(
+      const unsigned int                                                   dim,
+      const LinearAlgebra::distributed::Vector<Number, MemorySpace::Host> &vv,
+      const internal::SolverGMRESImplementation::TmpVectors<
+        LinearAlgebra::distributed::Vector<Number, MemorySpace::Host>>
+        &             orthogonal_vectors,
+      Vector<double> &h)
+    {
+      // collect the dim projection coefficients and the norm of vv in a
+      // single array to compute all of them with one global reduction
+      Vector<double> local_sums(dim + 1);
+
+      const unsigned int locally_owned_size = vv.locally_owned_size();
+      for (unsigned int i = 0; i < dim; ++i)
+        {
+          const Number *orthogonal_vector = orthogonal_vectors[i].begin();
+          double        sum               = 0.;
+          DEAL_II_OPENMP_SIMD_PRAGMA
+          for (unsigned int j = 0; j < locally_owned_size; ++j)
+            sum += orthogonal_vector[j] * vv.local_element(j);
+          local_sums(i) = sum;
+        }
+      double norm_squared = 0.;
+      DEAL_II_OPENMP_SIMD_PRAGMA
+      for (unsigned int j = 0; j < locally_owned_size; ++j)
+        norm_squared += vv.local_element(j) * vv.local_element(j);
+      local_sums(dim) = norm_squared;
+
+      Utilities::MPI::sum(local_sums, vv.get_mpi_communicator(), local_sums);
+
+      for (unsigned int i = 0; i < dim; ++i)
+        h(i) += local_sums(i);
+      return local_sums(dim);
+    }
+
+
+
+    template <class VectorType>
+    void
+    subtract(const unsigned int dim,
+             const internal::SolverGMRESImplementation::TmpVectors<VectorType>
+               &                   orthogonal_vectors,
+             const Vector<double> &h,
+             VectorType &          vv)
+    {
+      for (unsigned int i = 0; i < dim; ++i)
+        vv.add(-h(i), orthogonal_vectors[i]);
+    }
+
+
+
+    template <class Number>
+    void
+    subtract(const unsigned int dim,
+             const internal::SolverGMRESImplementation::TmpVectors<
+               LinearAlgebra::distributed::Vector<Number, MemorySpace::Host>>
+               &                   orthogonal_vectors,
+             const Vector<double> &h,
+             LinearAlgebra::distributed::Vector<Number, MemorySpace::Host> &vv)
+    {
+      for (unsigned int j = 0; j < vv.locally_owned_size(); ++j)
+        {
+          double temp = vv.local_element(j);
+          for (unsigned int i = 0; i < dim; ++i)
+            temp -= h(i) * orthogonal_vectors[i].local_element(j);
+          vv.local_element(j) = temp;
+        }
+    }
+
+
+
+    /**
+     * Orthogonalize the vector @p vv against the @p dim (orthogonal) vectors
+     * given by @p orthogonal_vectors using two passes of the classical
+     * Gram-Schmidt algorithm, with each pass computing the projection
+     * coefficients and the norm of @p vv in a single global reduction. The
+     * sum of the factors of the two passes is stored in @p h. Returns the
+     * norm of the orthogonalized vector.
+     */
+    template <class VectorType>
+    inline double
+    classical_gram_schmidt_reorthogonalized(
+      const internal::SolverGMRESImplementation::TmpVectors<VectorType>
+        &                orthogonal_vectors,
+      const unsigned int dim,
+      VectorType &       vv,
+      Vector<double> &   h)
+    {
+      Vector<double> h_pass(dim);
+
+      double norm_vv_squared = 0.;
+      for (unsigned int c = 0; c < 2; ++c)
+        {
+          h_pass = 0.;
+          const double norm_before_squared =
+            Tvmult_add_and_norm_squared(dim, vv, orthogonal_vectors, h_pass);
+          subtract(dim, orthogonal_vectors, h_pass, vv);
+          for (unsigned int i = 0; i < dim; ++i)
+            h(i) += h_pass(i);
+
+          // the norm after the projection follows from the Pythagorean
+          // theorem since the orthogonal vectors are orthonormal
+          norm_vv_squared = norm_before_squared - h_pass.norm_sqr();
+        }
+
+      // in case of severe cancellation, the Pythagorean formula is not
+      // accurate, so compute the norm explicitly
+      if (!(norm_vv_squared >
+            100. *
+              std::numeric_limits<typename VectorType::value_type>::epsilon() *
+              h.norm_sqr()))
+        return vv.l2_norm();
+
+      return std::sqrt(norm_vv_squared);
+    }
+
+
+
     template <class VectorType>
     double
     sadd_and_norm(VectorType &      v,
@@ -1013,6 +1462,18 @@ namespace internal
       Assert(dim > 0, ExcInternalError());
       const unsigned int inner_iteration = dim - 1;
 
+      if (orthogonalization_strategy ==
+          SolverGMRES<VectorType>::AdditionalData::OrthogonalizationStrategy::
+            classical_gram_schmidt_reorthogonalized)
+        {
+          for (unsigned int i = 0; i < dim; ++i)
+            h[i] = 0;
+          return classical_gram_schmidt_reorthogonalized(orthogonal_vectors,
+                                                         dim,
+                                                         vv,
+                                                         h);
+        }
+
       // need initial norm for detection of re-orthogonalization, see below
       double     norm_vv_start = 0;
       const bool consider_reorthogonalize =
@@ -1175,6 +1636,17 @@ SolverGMRES<VectorType>::solve(const MatrixType &        A,
   internal::SolverGMRESImplementation::TmpVectors<VectorType> tmp_vectors(
     n_tmp_vectors, this->memory);
 
+  // If the basis is stored in single precision, the full-precision vectors
+  // in tmp_vectors only hold the current basis vector and the one being
+  // orthogonalized, alternating between the first two slots
+  const bool basis_in_single_precision =
+    additional_data.store_basis_in_single_precision;
+  Assert(!basis_in_single_precision || krylov_space_signal.empty(),
+         ExcMessage("The Krylov space cannot be retrieved when storing the "
+                    "basis in single precision."));
+  internal::SolverGMRESImplementation::SinglePrecisionBasis
+    single_precision_basis(basis_in_single_precision ? n_tmp_vectors : 0);
+
   // number of the present iteration; this
   // number is not reset to zero upon a
   // restart
@@ -1315,32 +1787,43 @@ SolverGMRES<VectorType>::solve(const MatrixType &        A,
            ++inner_iteration)
         {
           ++accumulated_iterations;
+          const unsigned int current_index =
+            basis_in_single_precision ? inner_iteration % 2 : inner_iteration;
+          const unsigned int next_index = basis_in_single_precision ?
+                                            (inner_iteration + 1) % 2 :
+                                            inner_iteration + 1;
+
           // yet another alias
-          VectorType &vv = tmp_vectors(inner_iteration + 1, x);
+          VectorType &vv = tmp_vectors(next_index, x);
 
           if (left_precondition)
             {
-              A.vmult(p, tmp_vectors[inner_iteration]);
+              A.vmult(p, tmp_vectors[current_index]);
               preconditioner.vmult(vv, p);
             }
           else
             {
-              preconditioner.vmult(p, tmp_vectors[inner_iteration]);
+              preconditioner.vmult(p, tmp_vectors[current_index]);
               A.vmult(vv, p);
             }
 
           dim = inner_iteration + 1;
 
           const double s =
-            internal::SolverGMRESImplementation::iterated_gram_schmidt(
-              additional_data.orthogonalization_strategy,
-              tmp_vectors,
-              dim,
-              accumulated_iterations,
-              vv,
-              h,
-              re_orthogonalize,
-              re_orthogonalize_signal);
+            basis_in_single_precision ?
+              single_precision_basis.orthogonalize(dim,
+                                                   tmp_vectors[current_index],
+                                                   vv,
+                                                   h) :
+              internal::SolverGMRESImplementation::iterated_gram_schmidt(
+                additional_data.orthogonalization_strategy,
+                tmp_vectors,
+                dim,
+                accumulated_iterations,
+                vv,
+                h,
+                re_orthogonalize,
+                re_orthogonalize_signal);
           h(inner_iteration + 1) = s;
 
           // s=0 is a lucky breakdown, the solver will reach convergence,
@@ -1348,6 +1831,11 @@ SolverGMRES<VectorType>::solve(const MatrixType &        A,
           if (s != 0)
             vv *= 1. / s;
 
+          // the current vector is not needed in full precision anymore
+          if (basis_in_single_precision)
+            single_precision_basis.store(inner_iteration,
+                                         tmp_vectors[current_index]);
+
           // for eigenvalues, get the resulting coefficients from the
           // orthogonalization process
           if (do_eigenvalues)
@@ -1387,13 +1875,23 @@ SolverGMRES<VectorType>::solve(const MatrixType &        A,
                                                                     h);
 
               if (left_precondition)
-                for (unsigned int i = 0; i < dim; ++i)
-                  x_->add(h(i), tmp_vectors[i]);
+                {
+                  if (basis_in_single_precision)
+                    single_precision_basis.add(*x_, dim, h, false);
+                  else
+                    for (unsigned int i = 0; i < dim; ++i)
+                      x_->add(h(i), tmp_vectors[i]);
+                }
               else
                 {
-                  p = 0.;
-                  for (unsigned int i = 0; i < dim; ++i)
-                    p.add(h(i), tmp_vectors[i]);
+                  if (basis_in_single_precision)
+                    single_precision_basis.add(p, dim, h, true);
+                  else
+                    {
+                      p = 0.;
+                      for (unsigned int i = 0; i < dim; ++i)
+                        p.add(h(i), tmp_vectors[i]);
+                    }
                   preconditioner.vmult(*r, p);
                   x_->add(1., *r);
                 };
@@ -1437,13 +1935,20 @@ SolverGMRES<VectorType>::solve(const MatrixType &        A,
                               all_hessenberg_signal,
                               condition_number_signal);
 
-      if (left_precondition)
+      if (basis_in_single_precision)
+        single_precision_basis.add(left_precondition ? x : p,
+                                   dim,
+                                   h,
+                                   !left_precondition);
+      else if (left_precondition)
         dealii::internal::SolverGMRESImplementation::add(
           x, dim, h, tmp_vectors, false);
       else
+        dealii::internal::SolverGMRESImplementation::add(
+          p, dim, h, tmp_vectors, true);
+
+      if (!left_precondition)
         {
-          dealii::internal::SolverGMRESImplementation::add(
-            p, dim, h, tmp_vectors, true);
           preconditioner.vmult(v, p);
           x.add(1., v);
         };
@@ -0,0 +1,253 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+#ifndef dealii_solver_iterative_refinement_h
+#define dealii_solver_iterative_refinement_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/logstream.h>
+
+#include <deal.II/lac/solver.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/vector_memory.h>
+
+#include <limits>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * @addtogroup Solvers
+ * @{
+ */
+
+/**
+ * Mixed-precision iterative refinement, i.e., a defect correction whose
+ * residuals are computed with vectors of type @p VectorType (typically in
+ * double precision) while the correction equations are solved approximately
+ * with an inner solver working on vectors of type @p InnerVectorType
+ * (typically in single precision).
+ *
+ * In each iteration, the residual $r = b - Ax$ is computed with the matrix
+ * $A$ given in full precision and its norm is passed to the SolverControl
+ * object of this class to decide about convergence. Then, the residual is
+ * converted to @p InnerVectorType, the correction equation $\tilde A d = r$
+ * is solved approximately with the inner solver, a matrix $\tilde A$, and a
+ * preconditioner that all work in the lower precision, and the correction is
+ * converted back and added to the solution, $x \leftarrow x + d$.
+ *
+ * Since Krylov methods for sparse matrices or matrix-free operators are
+ * limited by the memory bandwidth, running them on vectors, matrices, and
+ * preconditioners in single precision makes each inner iteration up to twice
+ * as fast. The outer iteration restores the accuracy of the full precision,
+ * as long as each inner solve reduces the residual by some factor, say
+ * $10^{-2}$ to $10^{-4}$. The inner solver should therefore be given a
+ * ReductionControl or an IterationNumberControl object rather than an
+ * absolute tolerance. If the inner solver throws an exception of type
+ * SolverControl::NoConvergence, the approximate correction computed so far
+ * is used.
+ *
+ * A typical use for a matrix-free operator that is set up for both
+ * precisions is
+ * @code
+ *   using VectorType      = LinearAlgebra::distributed::Vector<double>;
+ *   using InnerVectorType = LinearAlgebra::distributed::Vector<float>;
+ *
+ *   ReductionControl     inner_control(100, 1e-30, 1e-3);
+ *   SolverCG<InnerVectorType> inner_solver(inner_control);
+ *
+ *   SolverControl solver_control(100, 1e-12 * system_rhs.l2_norm());
+ *   SolverIterativeRefinement<VectorType, InnerVectorType> solver(
+ *     solver_control);
+ *   solver.solve(system_matrix,
+ *                solution,
+ *                system_rhs,
+ *                inner_solver,
+ *                system_matrix_float,
+ *                preconditioner_float);
+ * @endcode
+ *
+ * For a SparseMatrix, the matrix in lower precision can be created by
+ * SparseMatrix<float>::copy_from().
+ *
+ * The vector types must allow conversion from one to the other through
+ * <code>reinit()</code> and assignment, as is the case for Vector,
+ * BlockVector, and LinearAlgebra::distributed::Vector with different number
+ * types.
+ *
+ *
+ * <h3>Observing the progress of linear solver iterations</h3>
+ *
+ * The solve() function of this class uses the mechanism described in the
+ * Solver base class to determine convergence. This mechanism can also be used
+ * to observe the progress of the iteration. Each outer iteration is one call
+ * to the inner solver.
+ */
+template <typename VectorType      = Vector<double>,
+          typename InnerVectorType = Vector<float>>
+class SolverIterativeRefinement : public SolverBase<VectorType>
+{
+public:
+  /**
+   * Standardized data struct to pipe additional data to the solver. This
+   * solver does not need additional data.
+   */
+  struct AdditionalData
+  {};
+
+  /**
+   * Constructor.
+   */
+  SolverIterativeRefinement(SolverControl &           cn,
+                            VectorMemory<VectorType> &mem,
+                            const AdditionalData &    data = AdditionalData());
+
+  /**
+   * Constructor. Use an object of type GrowingVectorMemory as a default to
+   * allocate memory.
+   */
+  SolverIterativeRefinement(SolverControl &       cn,
+                            const AdditionalData &data = AdditionalData());
+
+  /**
+   * Solve the linear system $Ax=b$ for x, using @p inner_solver with the
+   * matrix @p inner_matrix and the preconditioner @p inner_preconditioner
+   * on vectors of type @p InnerVectorType to compute the corrections.
+   */
+  template <typename MatrixType,
+            typename InnerSolverType,
+            typename InnerMatrixType,
+            typename InnerPreconditionerType>
+  void
+  solve(const MatrixType &             A,
+        VectorType &                   x,
+        const VectorType &             b,
+        InnerSolverType &              inner_solver,
+        const InnerMatrixType &        inner_matrix,
+        const InnerPreconditionerType &inner_preconditioner);
+
+protected:
+  /**
+   * Memory for the vectors of the inner solves.
+   */
+  GrowingVectorMemory<InnerVectorType> inner_memory;
+};
+
+/** @} */
+/*------------------------- Implementation ----------------------------*/
+
+#ifndef DOXYGEN
+
+template <typename VectorType, typename InnerVectorType>
+SolverIterativeRefinement<VectorType, InnerVectorType>::
+  SolverIterativeRefinement(SolverControl &           cn,
+                            VectorMemory<VectorType> &mem,
+                            const AdditionalData &)
+  : SolverBase<VectorType>(cn, mem)
+{}
+
+
+
+template <typename VectorType, typename InnerVectorType>
+SolverIterativeRefinement<VectorType, InnerVectorType>::
+  SolverIterativeRefinement(SolverControl &cn, const AdditionalData &)
+  : SolverBase<VectorType>(cn)
+{}
+
+
+
+template <typename VectorType, typename InnerVectorType>
+template <typename MatrixType,
+          typename InnerSolverType,
+          typename InnerMatrixType,
+          typename InnerPreconditionerType>
+void
+SolverIterativeRefinement<VectorType, InnerVectorType>::solve(
+  const MatrixType &             A,
+  VectorType &                   x,
+  const VectorType &             b,
+  InnerSolverType &              inner_solver,
+  const InnerMatrixType &        inner_matrix,
+  const InnerPreconditionerType &inner_preconditioner)
+{
+  SolverControl::State conv = SolverControl::iterate;
+
+  double last_criterion = std::numeric_limits<double>::lowest();
+
+  unsigned int iter = 0;
+
+  // Memory allocation.
+  // 'Vr' holds the residual, 'Vr_inner' and 'Vd_inner' the residual and the
+  // correction in the precision of the inner solver
+  typename VectorMemory<VectorType>::Pointer      Vr(this->memory);
+  typename VectorMemory<InnerVectorType>::Pointer Vr_inner(inner_memory);
+  typename VectorMemory<InnerVectorType>::Pointer Vd_inner(inner_memory);
+
+  VectorType &r = *Vr;
+  r.reinit(x, true);
+
+  InnerVectorType &r_inner = *Vr_inner;
+  r_inner.reinit(x, true);
+
+  InnerVectorType &d_inner = *Vd_inner;
+  d_inner.reinit(x, true);
+
+  LogStream::Prefix prefix("IterativeRefinement");
+
+  // Main loop
+  while (conv == SolverControl::iterate)
+    {
+      A.vmult(r, x);
+      r.sadd(-1., 1., b);
+
+      last_criterion = r.l2_norm();
+      conv           = this->iteration_status(iter, last_criterion, x);
+      if (conv != SolverControl::iterate)
+        break;
+
+      // solve for the correction in the precision of the inner solver,
+      // keeping what it computed if it did not converge
+      r_inner = r;
+      d_inner = 0;
+      try
+        {
+          inner_solver.solve(inner_matrix,
+                             d_inner,
+                             r_inner,
+                             inner_preconditioner);
+        }
+      catch (const SolverControl::NoConvergence &)
+        {}
+
+      // add the correction, using the vector of the residual to convert it
+      // to the precision of the solution
+      r = d_inner;
+      x += r;
+
+      ++iter;
+    }
+
+  // in case of failure: throw exception
+  if (conv != SolverControl::success)
+    AssertThrow(false, SolverControl::NoConvergence(iter, last_criterion));
+  // otherwise exit as normal
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
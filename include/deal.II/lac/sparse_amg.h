@@ -0,0 +1,276 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+#ifndef dealii_sparse_amg_h
+#define dealii_sparse_amg_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/smartpointer.h>
+#include <deal.II/base/subscriptor.h>
+
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparsity_pattern.h>
+#include <deal.II/lac/vector.h>
+
+#include <memory>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * @addtogroup Preconditioners
+ * @{
+ */
+
+/**
+ * A smoothed aggregation algebraic multigrid (AMG) preconditioner for
+ * symmetric positive definite matrices of type SparseMatrix, in the spirit
+ * of the method by Vaněk, Mandel, and Brezina. In contrast to
+ * TrilinosWrappers::PreconditionAMG and PETScWrappers::PreconditionBoomerAMG,
+ * this class does not need any external library. It is meant for moderately
+ * sized problems, e.g., for the coarse grid problem of a geometric multigrid
+ * method where a dense factorization as done by MGCoarseGridHouseholder or
+ * MGCoarseGridSVD becomes too expensive.
+ *
+ * The setup in initialize() builds a hierarchy of matrices as follows:
+ * - Two unknowns $i,j$ are strongly connected if $|a_{ij}| \geq \theta
+ *   \sqrt{|a_{ii} a_{jj}|}$, with the threshold $\theta$ given by
+ *   AdditionalData::strong_threshold.
+ * - The unknowns are grouped into aggregates of strongly connected
+ *   neighbors with the greedy algorithm by Vaněk et al.
+ * - The tentative prolongator $P_0$ interpolates constants on each
+ *   aggregate, i.e., the near null space of scalar elliptic problems, and is
+ *   smoothed by one step of damped Jacobi, $P = (I - \omega D^{-1}A)P_0$ with
+ *   $\omega = \frac{4}{3}/\rho(D^{-1}A)$, where the spectral radius
+ *   $\rho(D^{-1}A)$ is bounded by Gershgorin's theorem.
+ * - The coarse matrix is the Galerkin product $A_c = P^T A P$, computed
+ *   with SparseMatrix::mmult() and SparseMatrix::Tmmult().
+ *
+ * The coarsening stops once a matrix has no more than
+ * AdditionalData::max_coarse_size rows, once AdditionalData::max_levels
+ * levels have been created, or once the aggregation does not reduce the
+ * size any more. The matrix on the coarsest level is inverted as a
+ * FullMatrix.
+ *
+ * Each call to vmult() performs one V-cycle with a PreconditionChebyshev
+ * smoother on each level, starting from a zero initial guess. The
+ * matrix-vector products and vector operations in the cycle are run in
+ * parallel with the threads of the library. Since the cycle is symmetric,
+ * this class can be used as a preconditioner for SolverCG.
+ *
+ * To use this class as coarse grid solver of a geometric multigrid
+ * method, combine it with MGCoarseGridIterativeSolver, or apply a single
+ * V-cycle by MGCoarseGridApplyPreconditioner:
+ * @code
+ *   SparseAMG<double> coarse_amg;
+ *   coarse_amg.initialize(mg_matrices[0]);
+ *
+ *   SolverControl                coarse_control(100, 1e-12, false, false);
+ *   SolverCG<Vector<double>>     coarse_cg(coarse_control);
+ *   MGCoarseGridIterativeSolver<Vector<double>,
+ *                               SolverCG<Vector<double>>,
+ *                               SparseMatrix<double>,
+ *                               SparseAMG<double>>
+ *     coarse_grid_solver(coarse_cg, mg_matrices[0], coarse_amg);
+ * @endcode
+ *
+ * @note The matrix is assumed to be symmetric positive definite with a
+ * non-zero diagonal. In particular, constrained rows must have a non-zero
+ * diagonal entry, as is the case for matrices assembled with
+ * AffineConstraints::distribute_local_to_global().
+ *
+ * @note Instantiations for this template are provided for <tt>@<float@> and
+ * @<double@></tt>; others can be generated in application programs (see the
+ * section on
+ * @ref Instantiations
+ * in the manual).
+ */
+template <typename number>
+class SparseAMG : public Subscriptor
+{
+public:
+  /**
+   * Declare type for container size.
+   */
+  using size_type = types::global_dof_index;
+
+  /**
+   * Type of the smoother used on each level.
+   */
+  using SmootherType =
+    PreconditionChebyshev<SparseMatrix<number>, Vector<number>>;
+
+  /**
+   * Parameters of the setup of the hierarchy.
+   */
+  struct AdditionalData
+  {
+    /**
+     * Constructor.
+     */
+    AdditionalData(const double       strong_threshold = 0.08,
+                   const unsigned int max_coarse_size  = 500,
+                   const unsigned int max_levels       = 10,
+                   const unsigned int smoother_degree  = 2);
+
+    /**
+     * Threshold $\theta$ for the strength of connection between two
+     * unknowns, see the class documentation.
+     */
+    double strong_threshold;
+
+    /**
+     * Maximal number of rows of the matrix on the coarsest level.
+     */
+    unsigned int max_coarse_size;
+
+    /**
+     * Maximal number of levels, including the one of the original matrix.
+     */
+    unsigned int max_levels;
+
+    /**
+     * Degree of the Chebyshev smoother on each level, i.e., the number of
+     * matrix-vector products per smoothing step.
+     */
+    unsigned int smoother_degree;
+  };
+
+  /**
+   * Constructor. Does nothing, call initialize() before using this object.
+   */
+  SparseAMG() = default;
+
+  /**
+   * Set up the multigrid hierarchy for the matrix @p matrix. The matrix
+   * needs to stay alive as long as this object is used.
+   */
+  void
+  initialize(const SparseMatrix<number> &matrix,
+             const AdditionalData &      additional_data = AdditionalData());
+
+  /**
+   * Release all memory and return to a state just like after having called
+   * the default constructor.
+   */
+  void
+  clear();
+
+  /**
+   * Apply one V-cycle to @p src and store the result in @p dst.
+   */
+  void
+  vmult(Vector<number> &dst, const Vector<number> &src) const;
+
+  /**
+   * Apply the transpose of the preconditioner. Since the V-cycle is
+   * symmetric, this is the same as vmult().
+   */
+  void
+  Tvmult(Vector<number> &dst, const Vector<number> &src) const;
+
+  /**
+   * Return the number of levels of the hierarchy, including the level of
+   * the original matrix.
+   */
+  unsigned int
+  n_levels() const;
+
+  /**
+   * Return the number of rows of the matrix on level @p level, with level
+   * zero being the original matrix.
+   */
+  size_type
+  m(const unsigned int level = 0) const;
+
+  /**
+   * Return the number of columns of the original matrix.
+   */
+  size_type
+  n() const;
+
+  /**
+   * Determine an estimate for the memory consumption (in bytes) of this
+   * object.
+   */
+  std::size_t
+  memory_consumption() const;
+
+private:
+  /**
+   * The data of one level of the hierarchy.
+   */
+  struct Level
+  {
+    /**
+     * Storage of the Galerkin matrix on the coarser levels.
+     */
+    SparsityPattern      coarse_sparsity;
+    SparseMatrix<number> coarse_matrix;
+
+    /**
+     * Prolongation from the next coarser level to this level.
+     */
+    SparsityPattern      prolongation_sparsity;
+    SparseMatrix<number> prolongation;
+
+    /**
+     * The smoother on this level.
+     */
+    SmootherType smoother;
+
+    /**
+     * Vectors of the cycle.
+     */
+    mutable Vector<number> rhs;
+    mutable Vector<number> solution;
+    mutable Vector<number> tmp;
+
+    /**
+     * The matrix on this level. Points to the matrix passed to
+     * initialize() on the finest level and to #coarse_matrix otherwise.
+     * Declared last so that it releases #coarse_matrix before that is
+     * destroyed.
+     */
+    SmartPointer<const SparseMatrix<number>, SparseAMG<number>> matrix;
+  };
+
+  /**
+   * Perform one V-cycle on the given level, solving for the vector
+   * levels[level]->solution with right hand side levels[level]->rhs.
+   */
+  void
+  v_cycle(const unsigned int level) const;
+
+  /**
+   * The levels of the hierarchy, with the original matrix on level zero.
+   */
+  std::vector<std::unique_ptr<Level>> levels;
+
+  /**
+   * Inverse of the matrix on the coarsest level.
+   */
+  FullMatrix<number> coarse_inverse;
+};
+
+/** @} */
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -0,0 +1,364 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+#ifndef dealii_sparse_amg_templates_h
+#define dealii_sparse_amg_templates_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/memory_consumption.h>
+
+#include <deal.II/lac/sparse_amg.h>
+
+#include <algorithm>
+#include <cmath>
+
+DEAL_II_NAMESPACE_OPEN
+
+
+namespace internal
+{
+  namespace SparseAMGImplementation
+  {
+    /**
+     * Group the rows of @p matrix into aggregates of strongly connected
+     * rows with the three passes of the greedy algorithm by Vaněk, Mandel,
+     * and Brezina. Return the aggregate of each row, or
+     * numbers::invalid_unsigned_int for rows without strong connections,
+     * which are left out of the coarse space. The number of aggregates is
+     * returned in @p n_aggregates.
+     */
+    template <typename number>
+    std::vector<unsigned int>
+    compute_aggregates(const SparseMatrix<number> &matrix,
+                       const double                strong_threshold,
+                       unsigned int &              n_aggregates)
+    {
+      using size_type = types::global_dof_index;
+
+      const size_type n_rows = matrix.m();
+
+      // collect the strong neighbors of each row, in compressed row storage
+      std::vector<size_type> neighbor_start(n_rows + 1, 0);
+      std::vector<size_type> neighbors;
+      neighbors.reserve(matrix.n_nonzero_elements());
+      for (size_type i = 0; i < n_rows; ++i)
+        {
+          const double a_ii = std::abs(matrix.diag_element(i));
+          for (auto entry = matrix.begin(i); entry != matrix.end(i); ++entry)
+            {
+              const size_type j = entry->column();
+              if (j == i)
+                continue;
+              const double a_jj = std::abs(matrix.diag_element(j));
+              if (std::abs(entry->value()) >=
+                  strong_threshold * std::sqrt(a_ii * a_jj))
+                neighbors.push_back(j);
+            }
+          neighbor_start[i + 1] = neighbors.size();
+        }
+
+      const unsigned int        unaggregated = numbers::invalid_unsigned_int;
+      std::vector<unsigned int> aggregate(n_rows, unaggregated);
+      n_aggregates = 0;
+
+      // pass 1: rows whose strong neighbors are all free form a new
+      // aggregate together with their neighbors
+      for (size_type i = 0; i < n_rows; ++i)
+        {
+          if (aggregate[i] != unaggregated ||
+              neighbor_start[i] == neighbor_start[i + 1])
+            continue;
+
+          bool all_free = true;
+          for (size_type k = neighbor_start[i]; k < neighbor_start[i + 1]; ++k)
+            if (aggregate[neighbors[k]] != unaggregated)
+              {
+                all_free = false;
+                break;
+              }
+          if (all_free == false)
+            continue;
+
+          aggregate[i] = n_aggregates;
+          for (size_type k = neighbor_start[i]; k < neighbor_start[i + 1]; ++k)
+            aggregate[neighbors[k]] = n_aggregates;
+          ++n_aggregates;
+        }
+
+      // pass 2: attach the remaining rows to an aggregate of a strong
+      // neighbor from pass 1
+      std::vector<unsigned int> aggregate_pass_1 = aggregate;
+      for (size_type i = 0; i < n_rows; ++i)
+        if (aggregate[i] == unaggregated)
+          for (size_type k = neighbor_start[i]; k < neighbor_start[i + 1]; ++k)
+            if (aggregate_pass_1[neighbors[k]] != unaggregated)
+              {
+                aggregate[i] = aggregate_pass_1[neighbors[k]];
+                break;
+              }
+
+      // pass 3: the rows that are still left form new aggregates with their
+      // free strong neighbors
+      for (size_type i = 0; i < n_rows; ++i)
+        {
+          if (aggregate[i] != unaggregated ||
+              neighbor_start[i] == neighbor_start[i + 1])
+            continue;
+
+          aggregate[i] = n_aggregates;
+          for (size_type k = neighbor_start[i]; k < neighbor_start[i + 1]; ++k)
+            if (aggregate[neighbors[k]] == unaggregated)
+              aggregate[neighbors[k]] = n_aggregates;
+          ++n_aggregates;
+        }
+
+      return aggregate;
+    }
+  } // namespace SparseAMGImplementation
+} // namespace internal
+
+
+
+template <typename number>
+SparseAMG<number>::AdditionalData::AdditionalData(
+  const double       strong_threshold,
+  const unsigned int max_coarse_size,
+  const unsigned int max_levels,
+  const unsigned int smoother_degree)
+  : strong_threshold(strong_threshold)
+  , max_coarse_size(max_coarse_size)
+  , max_levels(max_levels)
+  , smoother_degree(smoother_degree)
+{}
+
+
+
+template <typename number>
+void
+SparseAMG<number>::initialize(const SparseMatrix<number> &matrix,
+                              const AdditionalData &      additional_data)
+{
+  Assert(matrix.m() == matrix.n(), ExcNotQuadratic());
+  Assert(additional_data.max_levels > 0,
+         ExcMessage("At least one level is needed."));
+  Assert(additional_data.smoother_degree > 0,
+         ExcMessage("The degree of the smoother must be positive."));
+
+  clear();
+
+  levels.emplace_back(std::make_unique<Level>());
+  levels.back()->matrix = &matrix;
+
+  while (levels.back()->matrix->m() > additional_data.max_coarse_size &&
+         levels.size() < additional_data.max_levels)
+    {
+      Level &                     fine   = *levels.back();
+      const SparseMatrix<number> &A      = *fine.matrix;
+      const size_type             n_rows = A.m();
+
+      unsigned int                    n_aggregates = 0;
+      const std::vector<unsigned int> aggregate =
+        internal::SparseAMGImplementation::compute_aggregates(
+          A, additional_data.strong_threshold, n_aggregates);
+
+      // stop if the aggregation does not reduce the size considerably
+      if (n_aggregates == 0 || n_aggregates > 0.9 * n_rows)
+        break;
+
+      // the tentative prolongator interpolates constants on each aggregate
+      SparsityPattern tentative_sparsity(n_rows, n_aggregates, 1);
+      for (size_type i = 0; i < n_rows; ++i)
+        if (aggregate[i] != numbers::invalid_unsigned_int)
+          tentative_sparsity.add(i, aggregate[i]);
+      tentative_sparsity.compress();
+
+      SparseMatrix<number> tentative(tentative_sparsity);
+      for (size_type i = 0; i < n_rows; ++i)
+        if (aggregate[i] != numbers::invalid_unsigned_int)
+          tentative.set(i, aggregate[i], number(1.));
+
+      // bound the spectral radius of D^{-1}A by Gershgorin's theorem and
+      // smooth the tentative prolongator by damped Jacobi, computing
+      // P = P_0 - omega D^{-1} A P_0 in place of the product A P_0
+      double rho = 0.;
+      for (size_type i = 0; i < n_rows; ++i)
+        {
+          double row_sum = 0.;
+          for (auto entry = A.begin(i); entry != A.end(i); ++entry)
+            row_sum += std::abs(entry->value());
+          rho = std::max(rho, row_sum / std::abs(A.diag_element(i)));
+        }
+      const double omega = 4. / 3. / rho;
+
+      fine.prolongation.reinit(fine.prolongation_sparsity);
+      A.mmult(fine.prolongation, tentative);
+      for (size_type i = 0; i < n_rows; ++i)
+        {
+          const number scaling = -omega / A.diag_element(i);
+          for (auto entry = fine.prolongation.begin(i);
+               entry != fine.prolongation.end(i);
+               ++entry)
+            {
+              entry->value() *= scaling;
+              if (entry->column() == aggregate[i])
+                entry->value() += number(1.);
+            }
+        }
+
+      // the Galerkin product P^T A P gives the matrix on the next level
+      SparsityPattern      product_sparsity;
+      SparseMatrix<number> product(product_sparsity);
+      A.mmult(product, fine.prolongation);
+
+      levels.emplace_back(std::make_unique<Level>());
+      Level &coarse = *levels.back();
+      coarse.coarse_matrix.reinit(coarse.coarse_sparsity);
+      fine.prolongation.Tmmult(coarse.coarse_matrix, product);
+      coarse.matrix = &coarse.coarse_matrix;
+    }
+
+  // set up the smoothers and vectors on all levels but the coarsest one
+  typename SmootherType::AdditionalData smoother_data;
+  smoother_data.degree              = additional_data.smoother_degree;
+  smoother_data.smoothing_range     = 20.;
+  smoother_data.eig_cg_n_iterations = 10;
+  for (unsigned int l = 0; l < levels.size(); ++l)
+    {
+      Level &level = *levels[l];
+      if (l + 1 < levels.size())
+        level.smoother.initialize(*level.matrix, smoother_data);
+      level.rhs.reinit(level.matrix->m());
+      level.solution.reinit(level.matrix->m());
+      level.tmp.reinit(level.matrix->m());
+    }
+
+  coarse_inverse.copy_from(*levels.back()->matrix);
+  coarse_inverse.gauss_jordan();
+}
+
+
+
+template <typename number>
+void
+SparseAMG<number>::clear()
+{
+  levels.clear();
+  coarse_inverse.reinit(0, 0);
+}
+
+
+
+template <typename number>
+void
+SparseAMG<number>::v_cycle(const unsigned int l) const
+{
+  const Level &level = *levels[l];
+
+  if (l + 1 == levels.size())
+    {
+      coarse_inverse.vmult(level.solution, level.rhs);
+      return;
+    }
+
+  const Level &coarse = *levels[l + 1];
+
+  // pre-smoothing from zero initial guess and restriction of the residual
+  level.smoother.vmult(level.solution, level.rhs);
+  level.matrix->residual(level.tmp, level.solution, level.rhs);
+  level.prolongation.Tvmult(coarse.rhs, level.tmp);
+
+  v_cycle(l + 1);
+
+  // coarse grid correction and post-smoothing
+  level.prolongation.vmult(level.tmp, coarse.solution);
+  level.solution += level.tmp;
+  level.smoother.step(level.solution, level.rhs);
+}
+
+
+
+template <typename number>
+void
+SparseAMG<number>::vmult(Vector<number> &dst, const Vector<number> &src) const
+{
+  Assert(levels.size() > 0, ExcNotInitialized());
+  AssertDimension(dst.size(), m());
+  AssertDimension(src.size(), n());
+
+  levels[0]->rhs = src;
+  v_cycle(0);
+  dst = levels[0]->solution;
+}
+
+
+
+template <typename number>
+void
+SparseAMG<number>::Tvmult(Vector<number> &dst, const Vector<number> &src) const
+{
+  vmult(dst, src);
+}
+
+
+
+template <typename number>
+unsigned int
+SparseAMG<number>::n_levels() const
+{
+  return levels.size();
+}
+
+
+
+template <typename number>
+typename SparseAMG<number>::size_type
+SparseAMG<number>::m(const unsigned int level) const
+{
+  AssertIndexRange(level, levels.size());
+  return levels[level]->matrix->m();
+}
+
+
+
+template <typename number>
+typename SparseAMG<number>::size_type
+SparseAMG<number>::n() const
+{
+  return m(0);
+}
+
+
+
+template <typename number>
+std::size_t
+SparseAMG<number>::memory_consumption() const
+{
+  std::size_t size = sizeof(*this) + coarse_inverse.memory_consumption();
+  for (const auto &level : levels)
+    size += level->coarse_sparsity.memory_consumption() +
+            level->coarse_matrix.memory_consumption() +
+            level->prolongation_sparsity.memory_consumption() +
+            level->prolongation.memory_consumption() +
+            level->rhs.memory_consumption() +
+            level->solution.memory_consumption() +
+            level->tmp.memory_consumption();
+  return size;
+}
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -18,6 +18,9 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/multithread_info.h>
+#include <deal.II/base/parallel.h>
+
 #include <deal.II/lac/sparse_matrix.h>
 
 #include <cmath>
@@ -324,6 +327,65 @@ protected:
   void
   prebuild_lower_bound();
 
+  /**
+   * Level sets of the rows for the forward substitution with the strictly
+   * lower triangle of the decomposition: The rows
+   * <code>forward_level_rows[forward_level_starts[l]]</code> to
+   * <code>forward_level_rows[forward_level_starts[l+1]-1]</code> only
+   * depend on rows of levels less than <code>l</code> and can thus be
+   * processed concurrently. Becomes available after invocation of
+   * compute_level_sets().
+   */
+  std::vector<size_type> forward_level_starts;
+
+  /**
+   * The rows sorted by their level for the forward substitution, see
+   * #forward_level_starts.
+   */
+  std::vector<size_type> forward_level_rows;
+
+  /**
+   * Level sets of the rows for the backward substitution with the strictly
+   * upper triangle of the decomposition, in the same format as
+   * #forward_level_starts.
+   */
+  std::vector<size_type> backward_level_starts;
+
+  /**
+   * The rows sorted by their level for the backward substitution, see
+   * #backward_level_starts.
+   */
+  std::vector<size_type> backward_level_rows;
+
+  /**
+   * Compute the level sets #forward_level_starts, #forward_level_rows,
+   * #backward_level_starts, and #backward_level_rows from the sparsity
+   * pattern of the decomposition. Must be called after
+   * prebuild_lower_bound().
+   */
+  void
+  compute_level_sets();
+
+  /**
+   * Return whether the triangular substitution described by the given
+   * level sets should be run level by level in parallel, which is the case
+   * if several threads are available and the levels contain enough rows on
+   * average to amortize the synchronization between the levels.
+   */
+  bool
+  use_level_scheduling(const std::vector<size_type> &level_starts) const;
+
+  /**
+   * Call @p row_operation for all rows, one level of the given level sets
+   * after the other, with the rows within a level processed in parallel
+   * via parallel::apply_to_subranges().
+   */
+  template <typename RowOperation>
+  void
+  apply_by_level_sets(const std::vector<size_type> &level_starts,
+                      const std::vector<size_type> &level_rows,
+                      const RowOperation &          row_operation) const;
+
 private:
   /**
    * In general this pointer is zero except for the case that no
@@ -353,6 +415,41 @@ SparseLUDecomposition<number>::get_strengthen_diagonal(
 
 
 
+template <typename number>
+inline bool
+SparseLUDecomposition<number>::use_level_scheduling(
+  const std::vector<size_type> &level_starts) const
+{
+  const size_type n_levels = level_starts.empty() ? 0 : level_starts.size() - 1;
+  return MultithreadInfo::n_threads() > 1 && n_levels > 0 &&
+         this->m() >=
+           2 * n_levels *
+             internal::SparseMatrixImplementation::minimum_parallel_grain_size;
+}
+
+
+
+template <typename number>
+template <typename RowOperation>
+inline void
+SparseLUDecomposition<number>::apply_by_level_sets(
+  const std::vector<size_type> &level_starts,
+  const std::vector<size_type> &level_rows,
+  const RowOperation &          row_operation) const
+{
+  for (size_type level = 0; level + 1 < level_starts.size(); ++level)
+    parallel::apply_to_subranges(
+      level_starts[level],
+      level_starts[level + 1],
+      [&](const size_type begin, const size_type end) {
+        for (size_type i = begin; i < end; ++i)
+          row_operation(level_rows[i]);
+      },
+      internal::SparseMatrixImplementation::minimum_parallel_grain_size);
+}
+
+
+
 template <typename number>
 inline bool
 SparseLUDecomposition<number>::empty() const
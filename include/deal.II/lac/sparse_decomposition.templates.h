@@ -28,6 +28,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <numeric>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -56,6 +57,10 @@ SparseLUDecomposition<number>::clear()
 {
   std::vector<const size_type *> tmp;
   tmp.swap(prebuilt_lower_bound);
+  forward_level_starts.clear();
+  forward_level_rows.clear();
+  backward_level_starts.clear();
+  backward_level_rows.clear();
 
   SparseMatrix<number>::clear();
 
@@ -159,6 +164,72 @@ SparseLUDecomposition<number>::prebuild_lower_bound()
     }
 }
 
+
+
+template <typename number>
+void
+SparseLUDecomposition<number>::compute_level_sets()
+{
+  const size_type *const column_numbers =
+    this->get_sparsity_pattern().colnums.get();
+  const std::size_t *const rowstart_indices =
+    this->get_sparsity_pattern().rowstart.get();
+  const size_type N = this->m();
+  AssertDimension(prebuilt_lower_bound.size(), N);
+
+  // the level of a row is one more than the largest level of the rows it
+  // depends on. we then sort the rows by level with a counting sort, which
+  // keeps the rows within a level in ascending order
+  std::vector<size_type> level(N);
+  const auto             sort_rows_by_level =
+    [&](const size_type         n_levels,
+        std::vector<size_type> &level_starts,
+        std::vector<size_type> &level_rows) {
+      level_starts.assign(n_levels + 1, 0);
+      for (size_type row = 0; row < N; ++row)
+        ++level_starts[level[row] + 1];
+      std::partial_sum(level_starts.begin(),
+                       level_starts.end(),
+                       level_starts.begin());
+
+      std::vector<size_type> next_position(level_starts.begin(),
+                                           level_starts.end() - 1);
+      level_rows.resize(N);
+      for (size_type row = 0; row < N; ++row)
+        level_rows[next_position[level[row]]++] = row;
+    };
+
+  // forward substitution: rows depend on the entries left of the diagonal,
+  // skipping the diagonal element stored first in each row
+  size_type n_levels = 0;
+  for (size_type row = 0; row < N; ++row)
+    {
+      size_type row_level = 0;
+      for (const size_type *col = &column_numbers[rowstart_indices[row] + 1];
+           col != prebuilt_lower_bound[row];
+           ++col)
+        row_level = std::max(row_level, level[*col] + 1);
+      level[row] = row_level;
+      n_levels   = std::max(n_levels, row_level + 1);
+    }
+  sort_rows_by_level(n_levels, forward_level_starts, forward_level_rows);
+
+  // backward substitution: rows depend on the entries right of the diagonal
+  n_levels = 0;
+  for (size_type row = N; row > 0;)
+    {
+      --row;
+      size_type row_level = 0;
+      for (const size_type *col = prebuilt_lower_bound[row];
+           col != &column_numbers[rowstart_indices[row + 1]];
+           ++col)
+        row_level = std::max(row_level, level[*col] + 1);
+      level[row] = row_level;
+      n_levels   = std::max(n_levels, row_level + 1);
+    }
+  sort_rows_by_level(n_levels, backward_level_starts, backward_level_rows);
+}
+
 template <typename number>
 template <typename somenumber>
 void
@@ -239,7 +310,11 @@ std::size_t
 SparseLUDecomposition<number>::memory_consumption() const
 {
   return (SparseMatrix<number>::memory_consumption() +
-          MemoryConsumption::memory_consumption(prebuilt_lower_bound));
+          MemoryConsumption::memory_consumption(prebuilt_lower_bound) +
+          MemoryConsumption::memory_consumption(forward_level_starts) +
+          MemoryConsumption::memory_consumption(forward_level_rows) +
+          MemoryConsumption::memory_consumption(backward_level_starts) +
+          MemoryConsumption::memory_consumption(backward_level_rows));
 }
 
 
@@ -23,6 +23,7 @@
 #include <deal.II/base/subscriptor.h>
 
 #include <deal.II/lac/block_sparse_matrix.h>
+#include <deal.II/lac/full_matrix.h>
 #include <deal.II/lac/sparse_matrix.h>
 #include <deal.II/lac/sparse_matrix_ez.h>
 #include <deal.II/lac/vector.h>
@@ -141,11 +142,46 @@ public:
    * This function copies the contents of the matrix into its own storage; the
    * matrix can therefore be deleted after this operation, even if subsequent
    * solves are required.
+   *
+   * This function is equivalent to calling analyze() followed by
+   * refactor_numeric(). The symbolic factorization is kept, so matrices
+   * with the same sparsity pattern can subsequently be factorized with
+   * refactor_numeric().
    */
   template <class Matrix>
   void
   factorize(const Matrix &matrix);
 
+  /**
+   * Compute the symbolic factorization of the matrix, i.e., the ordering of
+   * the unknowns and the analysis of the sparsity pattern, without computing
+   * the numeric factorization. The numeric factorization is computed by a
+   * subsequent call to refactor_numeric() for this or any other matrix with
+   * the same sparsity pattern.
+   *
+   * This function copies the contents of the matrix, since UMFPACK uses the
+   * values of the entries to choose its strategy.
+   */
+  template <class Matrix>
+  void
+  analyze(const Matrix &matrix);
+
+  /**
+   * Compute the numeric factorization of the matrix, reusing the symbolic
+   * factorization computed by a previous call to analyze() or factorize().
+   * The matrix must have the same sparsity pattern as the matrix given to
+   * that call, i.e., exactly the same entries must be stored. This is the
+   * case, for example, in each step of a Newton method or in a time stepping
+   * scheme with varying coefficients, where the symbolic analysis can take a
+   * substantial share of the time of factorize().
+   *
+   * As for factorize(), the contents of the matrix are copied into the
+   * storage of this object.
+   */
+  template <class Matrix>
+  void
+  refactor_numeric(const Matrix &matrix);
+
   /**
    * Initialize memory and call SparseDirectUMFPACK::factorize.
    */
@@ -270,6 +306,33 @@ public:
   solve(BlockVector<std::complex<double>> &rhs_and_solution,
         const bool                         transpose = false) const;
 
+  /**
+   * Solve for several right hand side vectors at once. The solutions are
+   * returned in place of the right hand side vectors.
+   *
+   * UMFPACK only provides a solve function for a single right hand side.
+   * This function solves for the right hand sides in parallel using the task
+   * scheduler, with the factorization shared among all tasks and separate
+   * work arrays allocated once per task rather than once per right hand
+   * side.
+   *
+   * @pre You need to call factorize() or refactor_numeric() with a
+   * real-valued matrix before this function can be called.
+   */
+  void
+  solve(std::vector<Vector<double>> &rhs_and_solution,
+        const bool                   transpose = false) const;
+
+  /**
+   * Same as before, but with the right hand sides given as the columns of
+   * the matrix @p rhs_and_solution, i.e., this function computes
+   * $X = A^{-1} B$ for a matrix $B$ with as many rows as the factorized
+   * matrix. The solution $X$ is returned in place of $B$.
+   */
+  void
+  solve(FullMatrix<double> &rhs_and_solution,
+        const bool          transpose = false) const;
+
   /**
    * Call the two functions factorize() and solve() in that order, i.e.
    * perform the whole solution process for the given right hand side vector.
@@ -383,6 +446,22 @@ private:
   void
   clear();
 
+  /**
+   * Copy the sparsity pattern and the entries of the matrix into the arrays
+   * Ap, Ai, Ax, and Az described below.
+   */
+  template <class Matrix>
+  void
+  copy_matrix(const Matrix &matrix);
+
+  /**
+   * Compute the numeric factorization from the arrays Ap, Ai, Ax, and Az
+   * and the symbolic factorization, replacing a previously computed numeric
+   * factorization.
+   */
+  void
+  compute_numeric_decomposition();
+
   /**
    * Make sure that the arrays Ai and Ap are sorted in each row. UMFPACK wants
    * it this way. We need to have three versions of this function, one for the
@@ -27,8 +27,11 @@
 #include <deal.II/lac/sparsity_pattern.h>
 #include <deal.II/lac/vector_operation.h>
 
+#include <functional>
 #include <iterator>
 #include <memory>
+#include <utility>
+#include <vector>
 
 
 DEAL_II_NAMESPACE_OPEN
@@ -43,6 +46,8 @@ template <typename Matrix>
 class BlockMatrixBase;
 template <typename number>
 class SparseILU;
+template <typename number>
+class SparseMatrixAssemblyCache;
 #  ifdef DEAL_II_WITH_MPI
 namespace Utilities
 {
@@ -1135,6 +1140,46 @@ public:
   void
   vmult(OutVector &dst, const InVector &src) const;
 
+  /**
+   * Matrix-vector multiplication <i>dst = M*src</i> that interleaves two
+   * additional operations on vector entries with the product, in the same
+   * way as the MatrixFree::cell_loop() variant with the same arguments. This
+   * makes the matrix usable for the fused vector updates in
+   * PreconditionChebyshev and SolverCG, see there.
+   *
+   * Both functions take a half-open range <code>[begin, end)</code> of
+   * vector entries. The function @p operation_before_matrix_vector_product
+   * is run on every entry before the product accesses this entry in @p src
+   * or @p dst. The function @p operation_after_matrix_vector_product is run
+   * on a range of entries once the product does not access these entries in
+   * @p src or @p dst any more. Both functions are called on disjoint ranges
+   * from several threads at a time. Either of them may be empty.
+   *
+   * To determine which entries of @p src are accessed by which rows, the
+   * matrix keeps track of the range of columns of each consecutive chunk of
+   * rows, computed in reinit(). The savings in memory transfer hence depend
+   * on the bandwidth of the matrix: the rows are processed in groups of a few
+   * thousand per thread, and an operation after the product can only be run
+   * on entries that no later row couples to. A matrix with a small bandwidth,
+   * e.g., after renumbering the unknowns with the Cuthill-McKee algorithm,
+   * thus gets the operations fused with the product, whereas for other
+   * matrices, the function falls back to running most of each operation as a
+   * separate sweep over the vectors.
+   *
+   * This function requires the matrix to be square. It is instantiated for
+   * arguments of type Vector and LinearAlgebra::distributed::Vector.
+   *
+   * @dealiiOperationIsMultithreaded
+   */
+  template <typename VectorType>
+  void
+  vmult(VectorType &      dst,
+        const VectorType &src,
+        const std::function<void(const unsigned int, const unsigned int)>
+          &operation_before_matrix_vector_product,
+        const std::function<void(const unsigned int, const unsigned int)>
+          &operation_after_matrix_vector_product) const;
+
   /**
    * Matrix-vector multiplication: let <i>dst = M<sup>T</sup>*src</i> with
    * <i>M</i> being this matrix. This function does the same as vmult() but
@@ -1761,6 +1806,15 @@ private:
    */
   std::size_t max_len;
 
+  /**
+   * For each chunk of consecutive rows, the smallest column index of an entry
+   * in this chunk or any later row, and one past the largest column index of
+   * an entry in this chunk. This is used to schedule the operations of the
+   * vmult() variant that interleaves operations on vector entries with the
+   * product. Computed by reinit().
+   */
+  std::vector<std::pair<size_type, size_type>> column_ranges_of_row_chunks;
+
   // make all other sparse matrices friends
   template <typename somenumber>
   friend class SparseMatrix;
@@ -1773,6 +1827,10 @@ private:
   template <typename>
   friend class BlockMatrixBase;
 
+  // Add directly into the value array at precomputed positions.
+  template <typename>
+  friend class SparseMatrixAssemblyCache;
+
   // Also give access to internal details to the iterator/accessor classes.
   template <typename, bool>
   friend class SparseMatrixIterators::Iterator;
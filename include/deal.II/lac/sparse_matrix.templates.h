@@ -19,6 +19,8 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/multithread_info.h>
 #include <deal.II/base/parallel.h>
 #include <deal.II/base/template_constraints.h>
 #include <deal.II/base/utilities.h>
@@ -45,6 +47,27 @@
 DEAL_II_NAMESPACE_OPEN
 
 
+namespace internal
+{
+  namespace SparseMatrixImplementation
+  {
+    /**
+     * Number of rows in each of the chunks for which SparseMatrix records the
+     * range of column indices.
+     */
+    constexpr unsigned int n_rows_per_column_range = 256;
+
+    /**
+     * Number of chunks of rows that each thread works on between two
+     * invocations of the operations before and after the matrix-vector
+     * product in SparseMatrix::vmult().
+     */
+    constexpr unsigned int n_column_ranges_per_thread = 8;
+  } // namespace SparseMatrixImplementation
+} // namespace internal
+
+
+
 template <typename number>
 SparseMatrix<number>::SparseMatrix()
   : cols(nullptr, "SparseMatrix")
@@ -77,10 +100,12 @@ SparseMatrix<number>::SparseMatrix(SparseMatrix<number> &&m) noexcept
   , cols(m.cols)
   , val(std::move(m.val))
   , max_len(m.max_len)
+  , column_ranges_of_row_chunks(std::move(m.column_ranges_of_row_chunks))
 {
   m.cols    = nullptr;
   m.val     = nullptr;
   m.max_len = 0;
+  m.column_ranges_of_row_chunks.clear();
 }
 
 
@@ -105,13 +130,15 @@ template <typename number>
 SparseMatrix<number> &
 SparseMatrix<number>::operator=(SparseMatrix<number> &&m) noexcept
 {
-  cols    = m.cols;
-  val     = std::move(m.val);
-  max_len = m.max_len;
+  cols                        = m.cols;
+  val                         = std::move(m.val);
+  max_len                     = m.max_len;
+  column_ranges_of_row_chunks = std::move(m.column_ranges_of_row_chunks);
 
   m.cols    = nullptr;
   m.val     = nullptr;
   m.max_len = 0;
+  m.column_ranges_of_row_chunks.clear();
 
   return *this;
 }
@@ -263,6 +290,7 @@ SparseMatrix<number>::reinit(const SparsityPattern &sparsity)
     {
       val.reset();
       max_len = 0;
+      column_ranges_of_row_chunks.clear();
       return;
     }
 
@@ -274,6 +302,39 @@ SparseMatrix<number>::reinit(const SparsityPattern &sparsity)
     }
 
   *this = 0.;
+
+  // record the columns that each chunk of rows couples to, to be used by the
+  // vmult() variant that interleaves operations on vector entries
+  const size_type chunk_size =
+    internal::SparseMatrixImplementation::n_rows_per_column_range;
+  const size_type n_chunks = (m() + chunk_size - 1) / chunk_size;
+  column_ranges_of_row_chunks.resize(n_chunks);
+  parallel::apply_to_subranges(
+    0U,
+    n_chunks,
+    [this, chunk_size](const size_type begin_chunk, const size_type end_chunk) {
+      const std::size_t *rowstart = cols->rowstart.get();
+      const size_type *  colnums  = cols->colnums.get();
+      for (size_type chunk = begin_chunk; chunk < end_chunk; ++chunk)
+        {
+          const size_type end_row = std::min(m(), (chunk + 1) * chunk_size);
+          size_type       first   = n();
+          size_type       last    = 0;
+          for (std::size_t k = rowstart[chunk * chunk_size];
+               k < rowstart[end_row];
+               ++k)
+            {
+              first = std::min(first, colnums[k]);
+              last  = std::max(last, colnums[k] + 1);
+            }
+          column_ranges_of_row_chunks[chunk] = {first, last};
+        }
+    },
+    1);
+  for (size_type chunk = n_chunks; chunk > 1; --chunk)
+    column_ranges_of_row_chunks[chunk - 2].first =
+      std::min(column_ranges_of_row_chunks[chunk - 2].first,
+               column_ranges_of_row_chunks[chunk - 1].first);
 }
 
 
@@ -285,6 +346,7 @@ SparseMatrix<number>::clear()
   cols = nullptr;
   val.reset();
   max_len = 0;
+  column_ranges_of_row_chunks.clear();
 }
 
 
@@ -794,6 +856,106 @@ SparseMatrix<number>::vmult(OutVector &dst, const InVector &src) const
 
 
 
+template <typename number>
+template <typename VectorType>
+void
+SparseMatrix<number>::vmult(
+  VectorType &      dst,
+  const VectorType &src,
+  const std::function<void(const unsigned int, const unsigned int)>
+    &operation_before_matrix_vector_product,
+  const std::function<void(const unsigned int, const unsigned int)>
+    &operation_after_matrix_vector_product) const
+{
+  Assert(cols != nullptr, ExcNeedsSparsityPattern());
+  Assert(val != nullptr, ExcNotInitialized());
+  Assert(m() == n(), ExcNotQuadratic());
+  Assert(m() == dst.size(), ExcDimensionMismatch(m(), dst.size()));
+  Assert(n() == src.size(), ExcDimensionMismatch(n(), src.size()));
+
+  Assert(!PointerComparison::equal(&src, &dst), ExcSourceEqualsDestination());
+
+  const auto run_on_range =
+    [](const std::function<void(const unsigned int, const unsigned int)>
+         &             operation,
+       const size_type begin,
+       const size_type end) {
+      if (operation && end > begin)
+        parallel::apply_to_subranges(
+          begin,
+          end,
+          [&operation](const size_type begin_range,
+                       const size_type end_range) {
+            operation(begin_range, end_range);
+          },
+          internal::VectorImplementation::minimum_parallel_grain_size);
+    };
+
+  // Work through the rows in groups of chunks. Before working on a group, we
+  // run the first operation on all entries that the rows in the group access
+  // and that have not been processed yet. After the group, the second
+  // operation runs on all entries that no later row accesses any more.
+  const size_type chunk_size =
+    internal::SparseMatrixImplementation::n_rows_per_column_range;
+  const size_type n_chunks = column_ranges_of_row_chunks.size();
+  const size_type n_chunks_per_group =
+    internal::SparseMatrixImplementation::n_column_ranges_per_thread *
+    MultithreadInfo::n_threads();
+
+  size_type n_processed_before = 0;
+  size_type n_processed_after  = 0;
+  for (size_type begin_chunk = 0; begin_chunk < n_chunks;
+       begin_chunk += n_chunks_per_group)
+    {
+      const size_type end_chunk =
+        std::min(n_chunks, begin_chunk + n_chunks_per_group);
+      const size_type begin_row = begin_chunk * chunk_size;
+      const size_type end_row   = std::min(m(), end_chunk * chunk_size);
+
+      size_type end_before = end_row;
+      for (size_type chunk = begin_chunk; chunk < end_chunk; ++chunk)
+        end_before =
+          std::max(end_before, column_ranges_of_row_chunks[chunk].second);
+      if (end_before > n_processed_before)
+        {
+          run_on_range(operation_before_matrix_vector_product,
+                       n_processed_before,
+                       end_before);
+          n_processed_before = end_before;
+        }
+
+      parallel::apply_to_subranges(
+        begin_row,
+        end_row,
+        [this, &src, &dst](const size_type begin_row, const size_type end_row) {
+          internal::SparseMatrixImplementation::vmult_on_subrange(
+            begin_row,
+            end_row,
+            val.get(),
+            cols->rowstart.get(),
+            cols->colnums.get(),
+            src,
+            dst,
+            false);
+        },
+        internal::SparseMatrixImplementation::minimum_parallel_grain_size);
+
+      const size_type end_after =
+        end_chunk < n_chunks ?
+          std::min(end_row, column_ranges_of_row_chunks[end_chunk].first) :
+          m();
+      if (end_after > n_processed_after)
+        {
+          run_on_range(operation_after_matrix_vector_product,
+                       n_processed_after,
+                       end_after);
+          n_processed_after = end_after;
+        }
+    }
+}
+
+
+
 template <typename number>
 template <class OutVector, class InVector>
 void
@@ -2081,7 +2243,8 @@ template <typename number>
 std::size_t
 SparseMatrix<number>::memory_consumption() const
 {
-  return max_len * static_cast<std::size_t>(sizeof(number)) + sizeof(*this);
+  return max_len * static_cast<std::size_t>(sizeof(number)) + sizeof(*this) +
+         MemoryConsumption::memory_consumption(column_ranges_of_row_chunks);
 }
 
 
@@ -0,0 +1,468 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+#ifndef dealii_sparse_matrix_assembly_cache_h
+#define dealii_sparse_matrix_assembly_cache_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/smartpointer.h>
+#include <deal.II/base/subscriptor.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+// Forward declarations
+#ifndef DOXYGEN
+template <int, int>
+class DoFHandler;
+#endif
+
+/**
+ * @addtogroup Matrix1
+ * @{
+ */
+
+/**
+ * A class that speeds up the repeated assembly of a SparseMatrix, as in
+ * each step of a Newton iteration, by remembering where the entries of the
+ * cell matrices go in the global matrix.
+ *
+ * AffineConstraints::distribute_local_to_global() has to find the position
+ * of each entry of a cell matrix in the rows of the global matrix and to
+ * resolve constraints every time it is called. For cells whose degrees of
+ * freedom are not constrained, this class instead computes the positions of
+ * all entries in the value array of the matrix during the first call for a
+ * cell and stores them, so that later calls for the same cell simply add the
+ * cell matrix at these positions. Cells with constrained degrees of freedom
+ * are passed on to AffineConstraints::distribute_local_to_global().
+ *
+ * The cells are identified by an index between zero and the number given to
+ * reinit(), typically the active cell index. The cache needs to be reset by
+ * calling reinit() whenever the sparsity pattern of the matrix, the
+ * constraints, or the degrees of freedom of the cells change. In debug
+ * mode, the class checks that the indices passed for a cell are the same as
+ * in the first call.
+ *
+ * Alternatively, the cache can be set up with a DoFHandler, in which case
+ * the positions of all locally owned cells are computed right away, and the
+ * cells are identified by their active cell index. A Newton solver would
+ * then do the following:
+ * @code
+ *   SparseMatrixAssemblyCache<double> assembly_cache(dof_handler,
+ *                                                    constraints,
+ *                                                    system_matrix);
+ *
+ *   for (unsigned int newton_step = 0; ...; ++newton_step)
+ *     {
+ *       system_matrix = 0;
+ *       for (const auto &cell : dof_handler.active_cell_iterators())
+ *         {
+ *           // compute cell_matrix and get local_dof_indices
+ *           ...
+ *           assembly_cache.distribute_local_to_global(
+ *             cell->active_cell_index(), cell_matrix, local_dof_indices);
+ *         }
+ *       ...
+ *     }
+ * @endcode
+ *
+ * This class does not lock the matrix. Different threads can call
+ * distribute_local_to_global() at the same time for different cells if the
+ * rows the cells write into are disjoint, e.g., when the cells are colored
+ * with GraphColoring::make_graph_coloring() and the copier of WorkStream::run()
+ * is executed concurrently for the cells of one color. As each call only
+ * touches the data of the given cell, the setup of the positions during the
+ * first call is safe in this case, too.
+ */
+template <typename number>
+class SparseMatrixAssemblyCache : public Subscriptor
+{
+public:
+  /**
+   * Declare the type for container size.
+   */
+  using size_type = types::global_dof_index;
+
+  /**
+   * Constructor. Call reinit() before use.
+   */
+  SparseMatrixAssemblyCache() = default;
+
+  /**
+   * Constructor. Calls reinit() with the given arguments.
+   */
+  SparseMatrixAssemblyCache(const AffineConstraints<number> &constraints,
+                            SparseMatrix<number> &           matrix,
+                            const unsigned int               n_cells);
+
+  /**
+   * Constructor. Calls reinit() with the given arguments.
+   */
+  template <int dim, int spacedim>
+  SparseMatrixAssemblyCache(const DoFHandler<dim, spacedim> &dof_handler,
+                            const AffineConstraints<number> &constraints,
+                            SparseMatrix<number> &           matrix);
+
+  /**
+   * Set up the cache for assembling into @p matrix with the constraints
+   * @p constraints, with cells numbered from zero to @p n_cells. This
+   * discards all cached positions.
+   */
+  void
+  reinit(const AffineConstraints<number> &constraints,
+         SparseMatrix<number> &           matrix,
+         const unsigned int               n_cells);
+
+  /**
+   * Set up the cache for assembling into @p matrix with the constraints
+   * @p constraints, with the cells of @p dof_handler numbered by their
+   * active cell index. The positions of the entries of all locally owned
+   * cells without constrained degrees of freedom are computed right away.
+   */
+  template <int dim, int spacedim>
+  void
+  reinit(const DoFHandler<dim, spacedim> &dof_handler,
+         const AffineConstraints<number> &constraints,
+         SparseMatrix<number> &           matrix);
+
+  /**
+   * Add the cell matrix @p local_matrix of the cell with index
+   * @p cell_index and degrees of freedom @p local_dof_indices to the
+   * matrix. This has the same effect as calling
+   * AffineConstraints::distribute_local_to_global() with the same
+   * arguments.
+   */
+  void
+  distribute_local_to_global(const unsigned int            cell_index,
+                             const FullMatrix<number> &    local_matrix,
+                             const std::vector<size_type> &local_dof_indices);
+
+  /**
+   * Same as above, but also add the cell vector @p local_vector to
+   * @p global_vector, like the respective variant of
+   * AffineConstraints::distribute_local_to_global().
+   */
+  template <typename VectorType>
+  void
+  distribute_local_to_global(const unsigned int            cell_index,
+                             const FullMatrix<number> &    local_matrix,
+                             const Vector<number> &        local_vector,
+                             const std::vector<size_type> &local_dof_indices,
+                             VectorType &                  global_vector);
+
+  /**
+   * Return the number of cells for which the positions are stored, i.e.,
+   * the cells without constrained degrees of freedom that have been
+   * assembled since the last call to reinit().
+   */
+  unsigned int
+  n_cached_cells() const;
+
+  /**
+   * Determine an estimate for the memory consumption (in bytes) of this
+   * object.
+   */
+  std::size_t
+  memory_consumption() const;
+
+private:
+  /**
+   * Possible states of the cells.
+   */
+  enum CellState : std::uint8_t
+  {
+    /**
+     * The cell has not been assembled yet.
+     */
+    unknown,
+    /**
+     * The cell has no constrained degrees of freedom and its positions are
+     * stored.
+     */
+    cached,
+    /**
+     * The cell has constrained degrees of freedom and is assembled through
+     * the AffineConstraints object.
+     */
+    constrained
+  };
+
+  /**
+   * Look up the state of the cell, computing the positions of its entries
+   * if this is the first call for the cell.
+   */
+  CellState
+  prepare_cell(const unsigned int            cell_index,
+               const std::vector<size_type> &local_dof_indices);
+
+  /**
+   * Pointer to the constraints.
+   */
+  SmartPointer<const AffineConstraints<number>,
+               SparseMatrixAssemblyCache<number>>
+    constraints;
+
+  /**
+   * Pointer to the matrix.
+   */
+  SmartPointer<SparseMatrix<number>, SparseMatrixAssemblyCache<number>>
+    matrix;
+
+  /**
+   * The state of each cell.
+   */
+  std::vector<CellState> cell_states;
+
+  /**
+   * For each cell in the state CellState::cached, the positions in the value
+   * array of the matrix of the entries of the cell matrix, row by row.
+   */
+  std::vector<std::vector<size_type>> positions;
+
+#ifdef DEBUG
+  /**
+   * The degrees of freedom passed for each cell in the first call, used to
+   * check later calls.
+   */
+  std::vector<std::vector<size_type>> cached_dof_indices;
+#endif
+};
+
+/** @} */
+
+/* ----------------------- Inline functions -------------------------- */
+
+#ifndef DOXYGEN
+
+template <typename number>
+inline SparseMatrixAssemblyCache<number>::SparseMatrixAssemblyCache(
+  const AffineConstraints<number> &constraints,
+  SparseMatrix<number> &           matrix,
+  const unsigned int               n_cells)
+{
+  reinit(constraints, matrix, n_cells);
+}
+
+
+
+template <typename number>
+template <int dim, int spacedim>
+inline SparseMatrixAssemblyCache<number>::SparseMatrixAssemblyCache(
+  const DoFHandler<dim, spacedim> &dof_handler,
+  const AffineConstraints<number> &constraints,
+  SparseMatrix<number> &           matrix)
+{
+  reinit(dof_handler, constraints, matrix);
+}
+
+
+
+template <typename number>
+inline void
+SparseMatrixAssemblyCache<number>::reinit(
+  const AffineConstraints<number> &constraints,
+  SparseMatrix<number> &           matrix,
+  const unsigned int               n_cells)
+{
+  this->constraints = &constraints;
+  this->matrix      = &matrix;
+
+  cell_states.clear();
+  cell_states.resize(n_cells, CellState::unknown);
+  positions.clear();
+  positions.resize(n_cells);
+#  ifdef DEBUG
+  cached_dof_indices.clear();
+  cached_dof_indices.resize(n_cells);
+#  endif
+}
+
+
+
+template <typename number>
+template <int dim, int spacedim>
+inline void
+SparseMatrixAssemblyCache<number>::reinit(
+  const DoFHandler<dim, spacedim> &dof_handler,
+  const AffineConstraints<number> &constraints,
+  SparseMatrix<number> &           matrix)
+{
+  reinit(constraints, matrix, dof_handler.get_triangulation().n_active_cells());
+
+  std::vector<size_type> local_dof_indices;
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    if (cell->is_locally_owned())
+      {
+        local_dof_indices.resize(cell->get_fe().n_dofs_per_cell());
+        cell->get_dof_indices(local_dof_indices);
+        prepare_cell(cell->active_cell_index(), local_dof_indices);
+      }
+}
+
+
+
+template <typename number>
+inline typename SparseMatrixAssemblyCache<number>::CellState
+SparseMatrixAssemblyCache<number>::prepare_cell(
+  const unsigned int            cell_index,
+  const std::vector<size_type> &local_dof_indices)
+{
+  Assert(matrix != nullptr, ExcNotInitialized());
+  AssertIndexRange(cell_index, cell_states.size());
+
+  if (cell_states[cell_index] == CellState::unknown)
+    {
+      bool has_constraints = false;
+      for (const size_type index : local_dof_indices)
+        if (constraints->is_constrained(index))
+          {
+            has_constraints = true;
+            break;
+          }
+
+      if (has_constraints)
+        cell_states[cell_index] = CellState::constrained;
+      else
+        {
+          const SparsityPattern &sparsity  = matrix->get_sparsity_pattern();
+          const unsigned int     n_indices = local_dof_indices.size();
+
+          std::vector<size_type> &cell_positions = positions[cell_index];
+          cell_positions.resize(n_indices * n_indices);
+          for (unsigned int i = 0; i < n_indices; ++i)
+            for (unsigned int j = 0; j < n_indices; ++j)
+              {
+                const size_type position =
+                  sparsity(local_dof_indices[i], local_dof_indices[j]);
+                Assert(position != SparsityPattern::invalid_entry,
+                       (typename SparseMatrix<number>::ExcInvalidIndex(
+                         local_dof_indices[i], local_dof_indices[j])));
+                cell_positions[i * n_indices + j] = position;
+              }
+
+          cell_states[cell_index] = CellState::cached;
+        }
+
+#  ifdef DEBUG
+      cached_dof_indices[cell_index] = local_dof_indices;
+#  endif
+    }
+
+  Assert(cached_dof_indices[cell_index] == local_dof_indices,
+         ExcMessage("The degrees of freedom of the cell with index " +
+                    std::to_string(cell_index) +
+                    " differ from the ones of the first call. Call reinit() "
+                    "when the degrees of freedom change."));
+
+  return cell_states[cell_index];
+}
+
+
+
+template <typename number>
+inline void
+SparseMatrixAssemblyCache<number>::distribute_local_to_global(
+  const unsigned int            cell_index,
+  const FullMatrix<number> &    local_matrix,
+  const std::vector<size_type> &local_dof_indices)
+{
+  AssertDimension(local_matrix.m(), local_dof_indices.size());
+  AssertDimension(local_matrix.n(), local_dof_indices.size());
+
+  if (prepare_cell(cell_index, local_dof_indices) == CellState::constrained)
+    constraints->distribute_local_to_global(local_matrix,
+                                            local_dof_indices,
+                                            *matrix);
+  else
+    {
+      const size_type *cell_positions = positions[cell_index].data();
+      const size_type  n_entries      = positions[cell_index].size();
+      const number *   local_values   = &local_matrix(0, 0);
+      number *         values         = matrix->val.get();
+      for (size_type k = 0; k < n_entries; ++k)
+        values[cell_positions[k]] += local_values[k];
+    }
+}
+
+
+
+template <typename number>
+template <typename VectorType>
+inline void
+SparseMatrixAssemblyCache<number>::distribute_local_to_global(
+  const unsigned int            cell_index,
+  const FullMatrix<number> &    local_matrix,
+  const Vector<number> &        local_vector,
+  const std::vector<size_type> &local_dof_indices,
+  VectorType &                  global_vector)
+{
+  AssertDimension(local_vector.size(), local_dof_indices.size());
+
+  if (prepare_cell(cell_index, local_dof_indices) == CellState::constrained)
+    constraints->distribute_local_to_global(local_matrix,
+                                            local_vector,
+                                            local_dof_indices,
+                                            *matrix,
+                                            global_vector);
+  else
+    {
+      distribute_local_to_global(cell_index, local_matrix, local_dof_indices);
+      for (unsigned int i = 0; i < local_dof_indices.size(); ++i)
+        global_vector(local_dof_indices[i]) += local_vector(i);
+    }
+}
+
+
+
+template <typename number>
+inline unsigned int
+SparseMatrixAssemblyCache<number>::n_cached_cells() const
+{
+  return std::count(cell_states.begin(), cell_states.end(), CellState::cached);
+}
+
+
+
+template <typename number>
+inline std::size_t
+SparseMatrixAssemblyCache<number>::memory_consumption() const
+{
+  std::size_t memory = sizeof(*this) +
+                       cell_states.capacity() * sizeof(CellState) +
+                       MemoryConsumption::memory_consumption(positions);
+#  ifdef DEBUG
+  memory += MemoryConsumption::memory_consumption(cached_dof_indices);
+#  endif
+  return memory;
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -0,0 +1,591 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+#ifndef dealii_sparse_matrix_sell_h
+#define dealii_sparse_matrix_sell_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/parallel.h>
+#include <deal.II/base/subscriptor.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+/*! @addtogroup Matrix1
+ *@{
+ */
+
+/**
+ * A read-only copy of a SparseMatrix in the sliced ELLPACK format, also
+ * called SELL-C-$\sigma$, that is designed for fast matrix-vector products
+ * with SIMD instructions.
+ *
+ * The rows of the matrix are grouped into slices of $C$ consecutive rows,
+ * where $C$ is the number of lanes VectorizedArray<number>::size(). Within
+ * a slice, all rows are padded with zeros to the length of the longest row
+ * of the slice, and the entries are stored column by column, i.e., the
+ * $j$-th entry of all $C$ rows of a slice are adjacent in memory. This
+ * allows the matrix-vector product to process $C$ rows at once with one
+ * vectorized multiply-add per entry and a gather operation on the source
+ * vector, rather than running over the short rows of the compressed row
+ * storage of SparseMatrix one at a time. In order to reduce the amount of
+ * padding, the rows are sorted by their length within windows of $\sigma$
+ * consecutive rows before they are assigned to slices. A larger $\sigma$
+ * gives less padding, whereas a small $\sigma$ keeps the access to the
+ * destination vector local. For a value of $\sigma=1$, no sorting is done.
+ *
+ * An object of this class is built from an existing SparseMatrix by the
+ * reinit() function and does not keep a reference to the original matrix.
+ * If the values of the original matrix change, reinit() must be called
+ * again. The matrix-vector products vmult() and vmult_add() run in parallel
+ * over the slices using the task-based parallelization of
+ * parallel::apply_to_subranges(), similarly to SparseMatrix::vmult().
+ * Tvmult() and Tvmult_add() are provided for completeness, but need to
+ * scatter results to arbitrary entries of the destination vector and are
+ * therefore run in serial.
+ *
+ * The class works on vectors of type Vector and on
+ * LinearAlgebra::distributed::Vector without ghost entries (i.e., in the
+ * same setting as SparseMatrix) with the same number type as the matrix.
+ * The column indices are stored as 32 bit integers, so the number of
+ * columns must be representable by an `unsigned int`.
+ */
+template <typename number>
+class SparseMatrixSELL : public Subscriptor
+{
+public:
+  /**
+   * Declare type for container size.
+   */
+  using size_type = types::global_dof_index;
+
+  /**
+   * Type of the matrix entries.
+   */
+  using value_type = number;
+
+  /**
+   * The number of rows $C$ in a slice, equal to the number of lanes in the
+   * SIMD array VectorizedArray<number>.
+   */
+  static constexpr unsigned int slice_size = VectorizedArray<number>::size();
+
+  /**
+   * Constructor. Leaves the object empty, call reinit() before use.
+   */
+  SparseMatrixSELL();
+
+  /**
+   * Constructor, calling reinit() with the given arguments.
+   */
+  SparseMatrixSELL(const SparseMatrix<number> &matrix,
+                   const unsigned int          sorting_scope = 256);
+
+  /**
+   * Copy the sparsity pattern and the entries of @p matrix into the sliced
+   * ELLPACK format. The rows are sorted by length within windows of
+   * @p sorting_scope rows, i.e., the parameter $\sigma$ of the format; the
+   * value is rounded up to a multiple of the slice size.
+   */
+  void
+  reinit(const SparseMatrix<number> &matrix,
+         const unsigned int          sorting_scope = 256);
+
+  /**
+   * Release all memory and return to a state just like after having called
+   * the default constructor.
+   */
+  void
+  clear();
+
+  /**
+   * Return the number of rows of the matrix.
+   */
+  size_type
+  m() const;
+
+  /**
+   * Return the number of columns of the matrix.
+   */
+  size_type
+  n() const;
+
+  /**
+   * Return the number of nonzero entries of the original matrix.
+   */
+  std::size_t
+  n_nonzero_elements() const;
+
+  /**
+   * Return the number of entries actually stored, including the padding
+   * within slices. The ratio to n_nonzero_elements() measures the overhead
+   * of the format for the given matrix.
+   */
+  std::size_t
+  n_stored_elements() const;
+
+  /**
+   * Matrix-vector multiplication: let <i>dst = M*src</i> with <i>M</i>
+   * being this matrix.
+   */
+  template <typename VectorType>
+  void
+  vmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Adding matrix-vector multiplication: add <i>M*src</i> to <i>dst</i>
+   * with <i>M</i> being this matrix.
+   */
+  template <typename VectorType>
+  void
+  vmult_add(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Matrix-vector multiplication with the transpose matrix: let <i>dst =
+   * M<sup>T</sup>*src</i> with <i>M</i> being this matrix. This operation
+   * runs in serial.
+   */
+  template <typename VectorType>
+  void
+  Tvmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Adding matrix-vector multiplication with the transpose matrix: add
+   * <i>M<sup>T</sup>*src</i> to <i>dst</i> with <i>M</i> being this
+   * matrix. This operation runs in serial.
+   */
+  template <typename VectorType>
+  void
+  Tvmult_add(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Determine an estimate for the memory consumption (in bytes) of this
+   * object.
+   */
+  std::size_t
+  memory_consumption() const;
+
+private:
+  /**
+   * Compute the matrix-vector product on the slices in the range
+   * `[begin, end)` and either write or add the result into @p dst.
+   */
+  void
+  vmult_on_subrange(const unsigned int begin,
+                    const unsigned int end,
+                    number *           dst,
+                    const number *     src,
+                    const bool         add) const;
+
+  /**
+   * Compute the transpose matrix-vector product and add the result into
+   * @p dst.
+   */
+  void
+  Tvmult_add_serial(number *dst, const number *src) const;
+
+  /**
+   * Number of rows of the matrix.
+   */
+  size_type n_rows;
+
+  /**
+   * Number of columns of the matrix.
+   */
+  size_type n_cols;
+
+  /**
+   * Number of nonzero entries of the original matrix.
+   */
+  std::size_t n_nonzeros;
+
+  /**
+   * For each lane of each slice, the row of the original matrix, or
+   * numbers::invalid_unsigned_int for the padding of the last slice.
+   */
+  std::vector<unsigned int> row_of_lane;
+
+  /**
+   * The start of each slice within the arrays #values and
+   * #column_indices, in units of VectorizedArray entries, with one more
+   * entry marking the end of the last slice.
+   */
+  std::vector<std::size_t> slice_start;
+
+  /**
+   * The matrix entries of all slices, stored column by column within each
+   * slice.
+   */
+  AlignedVector<VectorizedArray<number>> values;
+
+  /**
+   * The column indices of the entries in #values, with `slice_size`
+   * consecutive indices for each VectorizedArray entry. Padded entries
+   * refer to a valid column of the same row to keep the access to the
+   * source vector local.
+   */
+  std::vector<unsigned int> column_indices;
+};
+
+/*@}*/
+
+/* ---------------------------------- Inline functions ------------------- */
+
+#ifndef DOXYGEN
+
+template <typename number>
+inline SparseMatrixSELL<number>::SparseMatrixSELL()
+  : n_rows(0)
+  , n_cols(0)
+  , n_nonzeros(0)
+  , slice_start(1, 0)
+{}
+
+
+
+template <typename number>
+inline SparseMatrixSELL<number>::SparseMatrixSELL(
+  const SparseMatrix<number> &matrix,
+  const unsigned int          sorting_scope)
+  : SparseMatrixSELL()
+{
+  reinit(matrix, sorting_scope);
+}
+
+
+
+template <typename number>
+inline void
+SparseMatrixSELL<number>::reinit(const SparseMatrix<number> &matrix,
+                                 const unsigned int          sorting_scope)
+{
+  Assert(matrix.n() <= std::numeric_limits<unsigned int>::max() &&
+           matrix.m() < std::numeric_limits<unsigned int>::max(),
+         ExcMessage("SparseMatrixSELL stores indices as unsigned int, which "
+                    "cannot represent the size of the given matrix."));
+
+  n_rows     = matrix.m();
+  n_cols     = matrix.n();
+  n_nonzeros = matrix.n_nonzero_elements();
+
+  const unsigned int n_slices = (n_rows + slice_size - 1) / slice_size;
+  const unsigned int scope =
+    std::max(1U, (sorting_scope + slice_size - 1) / slice_size) * slice_size;
+
+  // sort the rows by descending length within each window of 'scope' rows,
+  // keeping the original order among rows of equal length
+  std::vector<unsigned int> row_lengths(n_rows);
+  for (unsigned int row = 0; row < n_rows; ++row)
+    row_lengths[row] = matrix.get_row_length(row);
+
+  row_of_lane.resize(static_cast<std::size_t>(n_slices) * slice_size);
+  std::iota(row_of_lane.begin(),
+            row_of_lane.begin() + n_rows,
+            static_cast<unsigned int>(0));
+  std::fill(row_of_lane.begin() + n_rows,
+            row_of_lane.end(),
+            numbers::invalid_unsigned_int);
+  if (scope > 1)
+    for (unsigned int start = 0; start < n_rows; start += scope)
+      std::stable_sort(row_of_lane.begin() + start,
+                       row_of_lane.begin() +
+                         std::min<std::size_t>(start + scope, n_rows),
+                       [&](const unsigned int a, const unsigned int b) {
+                         return row_lengths[a] > row_lengths[b];
+                       });
+
+  slice_start.resize(n_slices + 1);
+  slice_start[0] = 0;
+  for (unsigned int slice = 0; slice < n_slices; ++slice)
+    {
+      unsigned int max_length = 0;
+      for (unsigned int v = 0; v < slice_size; ++v)
+        {
+          const unsigned int row = row_of_lane[slice * slice_size + v];
+          if (row != numbers::invalid_unsigned_int)
+            max_length = std::max(max_length, row_lengths[row]);
+        }
+      slice_start[slice + 1] = slice_start[slice] + max_length;
+    }
+
+  values.resize_fast(slice_start.back());
+  column_indices.resize(slice_start.back() * slice_size);
+
+  // fill the slices; each slice is written by a single task in the same
+  // layout as in vmult, to get a good first touch on NUMA systems
+  parallel::apply_to_subranges(
+    0U,
+    n_slices,
+    [&](const unsigned int begin, const unsigned int end) {
+      for (unsigned int slice = begin; slice < end; ++slice)
+        for (unsigned int v = 0; v < slice_size; ++v)
+          {
+            const unsigned int row    = row_of_lane[slice * slice_size + v];
+            const std::size_t  start  = slice_start[slice];
+            const std::size_t  length = slice_start[slice + 1] - start;
+
+            std::size_t  j          = 0;
+            unsigned int pad_column = 0;
+            if (row != numbers::invalid_unsigned_int)
+              for (auto entry = matrix.begin(row); entry != matrix.end(row);
+                   ++entry, ++j)
+                {
+                  values[start + j][v] = entry->value();
+                  pad_column           = entry->column();
+                  column_indices[(start + j) * slice_size + v] = pad_column;
+                }
+            for (; j < length; ++j)
+              {
+                values[start + j][v]                         = number();
+                column_indices[(start + j) * slice_size + v] = pad_column;
+              }
+          }
+    },
+    std::max(1U,
+             internal::SparseMatrixImplementation::minimum_parallel_grain_size /
+               slice_size));
+}
+
+
+
+template <typename number>
+inline void
+SparseMatrixSELL<number>::clear()
+{
+  n_rows     = 0;
+  n_cols     = 0;
+  n_nonzeros = 0;
+  row_of_lane.clear();
+  slice_start.assign(1, 0);
+  values.clear();
+  column_indices.clear();
+}
+
+
+
+template <typename number>
+inline typename SparseMatrixSELL<number>::size_type
+SparseMatrixSELL<number>::m() const
+{
+  return n_rows;
+}
+
+
+
+template <typename number>
+inline typename SparseMatrixSELL<number>::size_type
+SparseMatrixSELL<number>::n() const
+{
+  return n_cols;
+}
+
+
+
+template <typename number>
+inline std::size_t
+SparseMatrixSELL<number>::n_nonzero_elements() const
+{
+  return n_nonzeros;
+}
+
+
+
+template <typename number>
+inline std::size_t
+SparseMatrixSELL<number>::n_stored_elements() const
+{
+  return values.size() * slice_size;
+}
+
+
+
+template <typename number>
+inline void
+SparseMatrixSELL<number>::vmult_on_subrange(const unsigned int begin,
+                                            const unsigned int end,
+                                            number *           dst,
+                                            const number *     src,
+                                            const bool         add) const
+{
+  const VectorizedArray<number> *val = values.data();
+  const unsigned int *           col = column_indices.data();
+  for (unsigned int slice = begin; slice < end; ++slice)
+    {
+      VectorizedArray<number> sum = number();
+      for (std::size_t j = slice_start[slice]; j < slice_start[slice + 1];
+           ++j)
+        {
+          VectorizedArray<number> src_values;
+          src_values.gather(src, col + j * slice_size);
+          sum += val[j] * src_values;
+        }
+
+      const unsigned int *rows = row_of_lane.data() + slice * slice_size;
+      for (unsigned int v = 0; v < slice_size; ++v)
+        if (rows[v] != numbers::invalid_unsigned_int)
+          {
+            if (add)
+              dst[rows[v]] += sum[v];
+            else
+              dst[rows[v]] = sum[v];
+          }
+    }
+}
+
+
+
+template <typename number>
+inline void
+SparseMatrixSELL<number>::Tvmult_add_serial(number *      dst,
+                                            const number *src) const
+{
+  const unsigned int n_slices = slice_start.size() - 1;
+  for (unsigned int slice = 0; slice < n_slices; ++slice)
+    {
+      const unsigned int *rows = row_of_lane.data() + slice * slice_size;
+
+      VectorizedArray<number> src_values = number();
+      for (unsigned int v = 0; v < slice_size; ++v)
+        if (rows[v] != numbers::invalid_unsigned_int)
+          src_values[v] = src[rows[v]];
+
+      for (std::size_t j = slice_start[slice]; j < slice_start[slice + 1];
+           ++j)
+        {
+          const VectorizedArray<number> product = values[j] * src_values;
+          for (unsigned int v = 0; v < slice_size; ++v)
+            dst[column_indices[j * slice_size + v]] += product[v];
+        }
+    }
+}
+
+
+
+template <typename number>
+template <typename VectorType>
+inline void
+SparseMatrixSELL<number>::vmult(VectorType &dst, const VectorType &src) const
+{
+  static_assert(std::is_same<typename VectorType::value_type, number>::value,
+                "The vector type must use the same number type as the "
+                "matrix.");
+  AssertDimension(dst.size(), m());
+  AssertDimension(src.size(), n());
+  Assert(&src != &dst,
+         ExcMessage("Source and destination must not be the same vector."));
+
+  const number *src_ptr = src.begin();
+  number *      dst_ptr = dst.begin();
+  parallel::apply_to_subranges(
+    0U,
+    static_cast<unsigned int>(slice_start.size() - 1),
+    [&](const unsigned int begin, const unsigned int end) {
+      vmult_on_subrange(begin, end, dst_ptr, src_ptr, false);
+    },
+    std::max(1U,
+             internal::SparseMatrixImplementation::minimum_parallel_grain_size /
+               slice_size));
+}
+
+
+
+template <typename number>
+template <typename VectorType>
+inline void
+SparseMatrixSELL<number>::vmult_add(VectorType &      dst,
+                                    const VectorType &src) const
+{
+  static_assert(std::is_same<typename VectorType::value_type, number>::value,
+                "The vector type must use the same number type as the "
+                "matrix.");
+  AssertDimension(dst.size(), m());
+  AssertDimension(src.size(), n());
+  Assert(&src != &dst,
+         ExcMessage("Source and destination must not be the same vector."));
+
+  const number *src_ptr = src.begin();
+  number *      dst_ptr = dst.begin();
+  parallel::apply_to_subranges(
+    0U,
+    static_cast<unsigned int>(slice_start.size() - 1),
+    [&](const unsigned int begin, const unsigned int end) {
+      vmult_on_subrange(begin, end, dst_ptr, src_ptr, true);
+    },
+    std::max(1U,
+             internal::SparseMatrixImplementation::minimum_parallel_grain_size /
+               slice_size));
+}
+
+
+
+template <typename number>
+template <typename VectorType>
+inline void
+SparseMatrixSELL<number>::Tvmult(VectorType &dst, const VectorType &src) const
+{
+  dst = number();
+  Tvmult_add(dst, src);
+}
+
+
+
+template <typename number>
+template <typename VectorType>
+inline void
+SparseMatrixSELL<number>::Tvmult_add(VectorType &      dst,
+                                     const VectorType &src) const
+{
+  static_assert(std::is_same<typename VectorType::value_type, number>::value,
+                "The vector type must use the same number type as the "
+                "matrix.");
+  AssertDimension(dst.size(), n());
+  AssertDimension(src.size(), m());
+  Assert(&src != &dst,
+         ExcMessage("Source and destination must not be the same vector."));
+
+  Tvmult_add_serial(dst.begin(), src.begin());
+}
+
+
+
+template <typename number>
+inline std::size_t
+SparseMatrixSELL<number>::memory_consumption() const
+{
+  return sizeof(*this) + MemoryConsumption::memory_consumption(row_of_lane) +
+         MemoryConsumption::memory_consumption(slice_start) +
+         values.memory_consumption() +
+         MemoryConsumption::memory_consumption(column_indices);
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -0,0 +1,782 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+#ifndef dealii_sparse_matrix_simd_h
+#define dealii_sparse_matrix_simd_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/parallel.h>
+#include <deal.II/base/smartpointer.h>
+#include <deal.II/base/subscriptor.h>
+#include <deal.II/base/tensor.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparsity_pattern.h>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * A sparsity pattern that stores the column indices of groups of
+ * @p simd_length consecutive rows interleaved, so that the entries of these
+ * rows can be processed with VectorizedArray objects of width @p simd_length,
+ * one row per lane. This is the storage scheme used by graph-based explicit
+ * solvers for hyperbolic problems, such as the one in step-69, that loop over
+ * all entries of a row and read the entries of several matrices, e.g.,
+ * $c_{ij}$ and $d_{ij}$, for each of them, see SparseMatrixSIMD.
+ *
+ * The first n_vectorized_rows() rows, a multiple of @p simd_length, are
+ * split into chunks of @p simd_length rows. Within a chunk, the entries with
+ * the same position in their rows are stored next to each other. Rows of a
+ * chunk that are shorter than the longest row of the chunk are padded with
+ * entries whose column index is the one of the first entry of the row, which
+ * is the diagonal entry for square matrices, and whose values in
+ * SparseMatrixSIMD are zero. The remaining rows are stored row by row as in
+ * SparsityPattern. Since the boundary rows of a solver often need special
+ * treatment, a typical setup renumbers the degrees of freedom so that the
+ * rows to be processed in a vectorized way come first.
+ *
+ * The entry with position @p k within row @p i has the column index
+ * <code>columns(i)[k * stride_of_row(i)]</code>, which for the first row of a
+ * chunk gives the column indices of all rows of the chunk as
+ * <code>columns(i) + k * simd_length</code>, ready to be used with
+ * VectorizedArray::gather():
+ * @code
+ *   sparsity_simd.loop_over_rows(
+ *     [&](const unsigned int first_row) {
+ *       VectorizedArray<double> sum = 0.;
+ *       for (unsigned int k = 0; k < sparsity_simd.row_length(first_row);
+ *            ++k)
+ *         {
+ *           VectorizedArray<double> u_j;
+ *           u_j.gather(u.data(),
+ *                      sparsity_simd.columns(first_row) + k * simd_length);
+ *           sum += matrix_simd.get_vectorized_entry(first_row, k) * u_j;
+ *         }
+ *       sum.store(dst.data() + first_row);
+ *     },
+ *     [&](const unsigned int row) {
+ *       double sum = 0.;
+ *       for (unsigned int k = 0; k < sparsity_simd.row_length(row); ++k)
+ *         sum += matrix_simd.get_entry(row, k) *
+ *                u[sparsity_simd.columns(row)[k]];
+ *       dst[row] = sum;
+ *     });
+ * @endcode
+ *
+ * Column indices are stored as <tt>unsigned int</tt>, i.e., this class is
+ * meant for the locally owned and ghosted rows and columns of a process in
+ * a local numbering.
+ *
+ * @ingroup Sparsity
+ */
+template <int simd_length>
+class SparsityPatternSIMD : public Subscriptor
+{
+public:
+  /**
+   * Default constructor. Creates an empty pattern.
+   */
+  SparsityPatternSIMD();
+
+  /**
+   * Constructor. Calls reinit().
+   */
+  SparsityPatternSIMD(
+    const SparsityPattern &sparsity,
+    const unsigned int     n_vectorized_rows = numbers::invalid_unsigned_int);
+
+  /**
+   * Copy the column indices of @p sparsity into the storage scheme described
+   * in the class documentation. The first @p n_vectorized_rows rows, rounded
+   * down to a multiple of @p simd_length, are stored in chunks of
+   * @p simd_length rows. The default is to store all rows this way, except
+   * for the last ones if the number of rows is not divisible by
+   * @p simd_length.
+   */
+  void
+  reinit(
+    const SparsityPattern &sparsity,
+    const unsigned int     n_vectorized_rows = numbers::invalid_unsigned_int);
+
+  /**
+   * Return the number of rows.
+   */
+  unsigned int
+  n_rows() const;
+
+  /**
+   * Return the number of columns.
+   */
+  unsigned int
+  n_cols() const;
+
+  /**
+   * Return the number of rows that are stored in chunks of @p simd_length
+   * rows.
+   */
+  unsigned int
+  n_vectorized_rows() const;
+
+  /**
+   * Return the number of entries stored for row @p row. For the rows that
+   * are stored in chunks, this is the length of the longest row of the
+   * chunk, including padding.
+   */
+  unsigned int
+  row_length(const unsigned int row) const;
+
+  /**
+   * Return the distance between two consecutive entries of row @p row in the
+   * arrays returned by columns() and used by SparseMatrixSIMD, i.e.,
+   * @p simd_length for the rows stored in chunks and one otherwise.
+   */
+  unsigned int
+  stride_of_row(const unsigned int row) const;
+
+  /**
+   * Return a pointer to the column index of the first entry of row @p row.
+   * The column index of the entry with position @p k is found
+   * <code>k * stride_of_row(row)</code> elements behind it.
+   */
+  const unsigned int *
+  columns(const unsigned int row) const;
+
+  /**
+   * Return the index of the entry with position @p position_within_row in
+   * row @p row in the arrays of column indices and matrix entries.
+   */
+  std::size_t
+  entry_index(const unsigned int row,
+              const unsigned int position_within_row) const;
+
+  /**
+   * Return the number of stored entries, including the padding.
+   */
+  std::size_t
+  n_stored_entries() const;
+
+  /**
+   * Run @p vectorized_worker for the first row of each chunk of rows, and
+   * then @p row_worker for each of the remaining rows. Both loops are split
+   * into tasks with parallel::apply_to_subranges(), so the workers must be
+   * able to run concurrently on different rows; @p grainsize is the minimal
+   * number of rows processed by a task.
+   *
+   * @p vectorized_worker is called with the first row of a chunk as
+   * argument, and @p row_worker with a row, both as <tt>unsigned int</tt>.
+   */
+  template <typename VectorizedRowWorker, typename RowWorker>
+  void
+  loop_over_rows(const VectorizedRowWorker &vectorized_worker,
+                 const RowWorker &          row_worker,
+                 const unsigned int         grainsize = 64) const;
+
+  /**
+   * Return an estimate for the memory consumption, in bytes, of this
+   * object.
+   */
+  std::size_t
+  memory_consumption() const;
+
+private:
+  /**
+   * The number of columns.
+   */
+  unsigned int n_columns;
+
+  /**
+   * The number of rows stored in chunks.
+   */
+  unsigned int n_vectorized;
+
+  /**
+   * The index of the first entry of each row, with an additional entry
+   * containing the total number of entries. For the rows stored in chunks,
+   * this is the index of the first entry of the chunk plus the lane of the
+   * row.
+   */
+  std::vector<std::size_t> row_starts;
+
+  /**
+   * The column indices of all entries.
+   */
+  AlignedVector<unsigned int> column_indices;
+};
+
+
+
+/**
+ * A class that stores the entries of @p n_components sparse matrices with
+ * the same sparsity pattern in one array, laid out according to a
+ * SparsityPatternSIMD object. The entries of all matrices for one position
+ * of the pattern are stored next to each other, so that a loop over the
+ * entries of a row reads the values of all matrices, e.g., the
+ * @p dim components of $c_{ij}$ in step-69, from a single stream of memory.
+ * For the rows stored in chunks, the values of a component for the
+ * @p simd_length rows of a chunk are contiguous and can be loaded as a
+ * VectorizedArray with get_vectorized_entry() or get_vectorized_tensor().
+ *
+ * The padded entries of the chunks are zero, so that kernels that
+ * produce no contribution for vanishing matrix entries, like the sum
+ * $\sum_j c_{ij} \cdot \mathbf f(U_j)$, can ignore the padding.
+ *
+ * @ingroup Matrix1
+ */
+template <typename Number,
+          int n_components = 1,
+          int simd_length  = VectorizedArray<Number>::size()>
+class SparseMatrixSIMD : public Subscriptor
+{
+public:
+  /**
+   * Default constructor.
+   */
+  SparseMatrixSIMD();
+
+  /**
+   * Constructor. Calls reinit().
+   */
+  explicit SparseMatrixSIMD(const SparsityPatternSIMD<simd_length> &sparsity);
+
+  /**
+   * Set up the storage for the pattern @p sparsity and set all entries to
+   * zero. A pointer to the pattern is stored, so it must live longer than
+   * this object.
+   */
+  void
+  reinit(const SparsityPatternSIMD<simd_length> &sparsity);
+
+  /**
+   * Copy the entries of @p matrix into component @p component. The
+   * sparsity pattern of @p matrix must be the one passed to
+   * SparsityPatternSIMD::reinit(). The rows are processed in parallel.
+   */
+  template <typename Number2>
+  void
+  read_in(const SparseMatrix<Number2> &matrix,
+          const unsigned int           component = 0);
+
+  /**
+   * Return component @p component of the entry with position
+   * @p position_within_row in row @p row.
+   */
+  Number
+  get_entry(const unsigned int row,
+            const unsigned int position_within_row,
+            const unsigned int component = 0) const;
+
+  /**
+   * Return all components of the entry with position @p position_within_row
+   * in row @p row.
+   */
+  Tensor<1, n_components, Number>
+  get_tensor(const unsigned int row,
+             const unsigned int position_within_row) const;
+
+  /**
+   * Return component @p component of the entries with position
+   * @p position_within_row in the @p simd_length rows of the chunk starting
+   * at row @p first_row.
+   */
+  VectorizedArray<Number, simd_length>
+  get_vectorized_entry(const unsigned int first_row,
+                       const unsigned int position_within_row,
+                       const unsigned int component = 0) const;
+
+  /**
+   * Return all components of the entries with position
+   * @p position_within_row in the @p simd_length rows of the chunk starting
+   * at row @p first_row.
+   */
+  Tensor<1, n_components, VectorizedArray<Number, simd_length>>
+  get_vectorized_tensor(const unsigned int first_row,
+                        const unsigned int position_within_row) const;
+
+  /**
+   * Set component @p component of the entry with position
+   * @p position_within_row in row @p row to @p value.
+   */
+  void
+  set_entry(const unsigned int row,
+            const unsigned int position_within_row,
+            const Number       value,
+            const unsigned int component = 0);
+
+  /**
+   * Set component @p component of the entries with position
+   * @p position_within_row in the @p simd_length rows of the chunk starting
+   * at row @p first_row to @p value.
+   */
+  void
+  set_vectorized_entry(const unsigned int first_row,
+                       const unsigned int position_within_row,
+                       const VectorizedArray<Number, simd_length> &value,
+                       const unsigned int component = 0);
+
+  /**
+   * Return the sparsity pattern passed to reinit().
+   */
+  const SparsityPatternSIMD<simd_length> &
+  get_sparsity_pattern() const;
+
+  /**
+   * Return an estimate for the memory consumption, in bytes, of this
+   * object.
+   */
+  std::size_t
+  memory_consumption() const;
+
+private:
+  /**
+   * Return the index of component @p component of the entry with position
+   * @p position_within_row in row @p row in #data.
+   */
+  std::size_t
+  data_index(const unsigned int row,
+             const unsigned int position_within_row,
+             const unsigned int component) const;
+
+  /**
+   * Pointer to the sparsity pattern.
+   */
+  SmartPointer<const SparsityPatternSIMD<simd_length>,
+               SparseMatrixSIMD<Number, n_components, simd_length>>
+    sparsity;
+
+  /**
+   * The entries of all components.
+   */
+  AlignedVector<Number> data;
+};
+
+
+
+#ifndef DOXYGEN
+/*---------------------- Inline functions -----------------------------------*/
+
+
+
+template <int simd_length>
+inline SparsityPatternSIMD<simd_length>::SparsityPatternSIMD()
+  : n_columns(0)
+  , n_vectorized(0)
+  , row_starts(1, 0)
+{}
+
+
+
+template <int simd_length>
+inline SparsityPatternSIMD<simd_length>::SparsityPatternSIMD(
+  const SparsityPattern &sparsity,
+  const unsigned int     n_vectorized_rows)
+  : SparsityPatternSIMD()
+{
+  reinit(sparsity, n_vectorized_rows);
+}
+
+
+
+template <int simd_length>
+inline void
+SparsityPatternSIMD<simd_length>::reinit(const SparsityPattern &sparsity,
+                                         const unsigned int n_vectorized_rows)
+{
+  static_assert(simd_length > 0, "The SIMD length must be positive.");
+  AssertThrow(sparsity.n_rows() <= std::numeric_limits<unsigned int>::max() &&
+                sparsity.n_cols() <= std::numeric_limits<unsigned int>::max(),
+              ExcMessage("SparsityPatternSIMD stores the row and column "
+                         "indices as unsigned int, which is not large enough "
+                         "for the given sparsity pattern."));
+
+  const unsigned int n_rows = sparsity.n_rows();
+  n_columns                 = sparsity.n_cols();
+  n_vectorized              = std::min(n_vectorized_rows, n_rows);
+  n_vectorized -= n_vectorized % simd_length;
+
+  // Compute the start of each row: the chunks reserve the length of their
+  // longest row for each lane
+  row_starts.resize(n_rows + 1);
+  std::size_t n_entries = 0;
+  for (unsigned int chunk = 0; chunk < n_vectorized; chunk += simd_length)
+    {
+      unsigned int max_length = 0;
+      for (unsigned int lane = 0; lane < simd_length; ++lane)
+        {
+          row_starts[chunk + lane] = n_entries + lane;
+          max_length               = std::max<unsigned int>(
+            max_length, sparsity.row_length(chunk + lane));
+        }
+      n_entries += static_cast<std::size_t>(max_length) * simd_length;
+    }
+  for (unsigned int row = n_vectorized; row < n_rows; ++row)
+    {
+      row_starts[row] = n_entries;
+      n_entries += sparsity.row_length(row);
+    }
+  row_starts[n_rows] = n_entries;
+
+  column_indices.resize_fast(n_entries);
+  parallel::apply_to_subranges(
+    0U,
+    n_rows,
+    [&](const unsigned int begin, const unsigned int end) {
+      for (unsigned int row = begin; row < end; ++row)
+        {
+          const unsigned int stride   = stride_of_row(row);
+          const unsigned int length   = sparsity.row_length(row);
+          unsigned int *     row_cols = column_indices.data() + row_starts[row];
+          for (unsigned int k = 0; k < length; ++k)
+            row_cols[k * stride] = sparsity.column_number(row, k);
+          for (unsigned int k = length; k < row_length(row); ++k)
+            row_cols[k * stride] = (length > 0 ? row_cols[0] : 0);
+        }
+    },
+    64);
+}
+
+
+
+template <int simd_length>
+inline unsigned int
+SparsityPatternSIMD<simd_length>::n_rows() const
+{
+  return row_starts.size() - 1;
+}
+
+
+
+template <int simd_length>
+inline unsigned int
+SparsityPatternSIMD<simd_length>::n_cols() const
+{
+  return n_columns;
+}
+
+
+
+template <int simd_length>
+inline unsigned int
+SparsityPatternSIMD<simd_length>::n_vectorized_rows() const
+{
+  return n_vectorized;
+}
+
+
+
+template <int simd_length>
+inline unsigned int
+SparsityPatternSIMD<simd_length>::row_length(const unsigned int row) const
+{
+  AssertIndexRange(row, n_rows());
+  if (row < n_vectorized)
+    {
+      const unsigned int first_row = row - row % simd_length;
+      return (row_starts[first_row + simd_length] - row_starts[first_row]) /
+             simd_length;
+    }
+  else
+    return row_starts[row + 1] - row_starts[row];
+}
+
+
+
+template <int simd_length>
+inline unsigned int
+SparsityPatternSIMD<simd_length>::stride_of_row(const unsigned int row) const
+{
+  AssertIndexRange(row, n_rows());
+  return row < n_vectorized ? simd_length : 1;
+}
+
+
+
+template <int simd_length>
+inline const unsigned int *
+SparsityPatternSIMD<simd_length>::columns(const unsigned int row) const
+{
+  AssertIndexRange(row, n_rows());
+  return column_indices.data() + row_starts[row];
+}
+
+
+
+template <int simd_length>
+inline std::size_t
+SparsityPatternSIMD<simd_length>::entry_index(
+  const unsigned int row,
+  const unsigned int position_within_row) const
+{
+  AssertIndexRange(position_within_row, row_length(row));
+  return row_starts[row] +
+         static_cast<std::size_t>(position_within_row) * stride_of_row(row);
+}
+
+
+
+template <int simd_length>
+inline std::size_t
+SparsityPatternSIMD<simd_length>::n_stored_entries() const
+{
+  return row_starts.back();
+}
+
+
+
+template <int simd_length>
+template <typename VectorizedRowWorker, typename RowWorker>
+inline void
+SparsityPatternSIMD<simd_length>::loop_over_rows(
+  const VectorizedRowWorker &vectorized_worker,
+  const RowWorker &          row_worker,
+  const unsigned int         grainsize) const
+{
+  parallel::apply_to_subranges(
+    0U,
+    n_vectorized / simd_length,
+    [&](const unsigned int begin, const unsigned int end) {
+      for (unsigned int chunk = begin; chunk < end; ++chunk)
+        vectorized_worker(chunk * simd_length);
+    },
+    std::max(1U, grainsize / simd_length));
+
+  parallel::apply_to_subranges(
+    n_vectorized,
+    n_rows(),
+    [&](const unsigned int begin, const unsigned int end) {
+      for (unsigned int row = begin; row < end; ++row)
+        row_worker(row);
+    },
+    std::max(1U, grainsize));
+}
+
+
+
+template <int simd_length>
+inline std::size_t
+SparsityPatternSIMD<simd_length>::memory_consumption() const
+{
+  return sizeof(*this) + MemoryConsumption::memory_consumption(row_starts) +
+         column_indices.memory_consumption();
+}
+
+
+
+template <typename Number, int n_components, int simd_length>
+inline SparseMatrixSIMD<Number, n_components, simd_length>::SparseMatrixSIMD()
+  : sparsity(nullptr, typeid(*this).name())
+{}
+
+
+
+template <typename Number, int n_components, int simd_length>
+inline SparseMatrixSIMD<Number, n_components, simd_length>::SparseMatrixSIMD(
+  const SparsityPatternSIMD<simd_length> &sparsity)
+  : SparseMatrixSIMD()
+{
+  reinit(sparsity);
+}
+
+
+
+template <typename Number, int n_components, int simd_length>
+inline void
+SparseMatrixSIMD<Number, n_components, simd_length>::reinit(
+  const SparsityPatternSIMD<simd_length> &sparsity)
+{
+  this->sparsity = &sparsity;
+  data.resize_fast(sparsity.n_stored_entries() * n_components);
+  data.fill(Number());
+}
+
+
+
+template <typename Number, int n_components, int simd_length>
+template <typename Number2>
+inline void
+SparseMatrixSIMD<Number, n_components, simd_length>::read_in(
+  const SparseMatrix<Number2> &matrix,
+  const unsigned int           component)
+{
+  Assert(sparsity != nullptr, ExcNotInitialized());
+  AssertDimension(matrix.m(), sparsity->n_rows());
+  AssertDimension(matrix.n(), sparsity->n_cols());
+  AssertIndexRange(component, n_components);
+
+  parallel::apply_to_subranges(
+    0U,
+    sparsity->n_rows(),
+    [&](const unsigned int begin, const unsigned int end) {
+      for (unsigned int row = begin; row < end; ++row)
+        {
+          unsigned int k = 0;
+          for (auto entry = matrix.begin(row); entry != matrix.end(row);
+               ++entry, ++k)
+            {
+              Assert(entry->column() ==
+                       sparsity->columns(row)[k * sparsity->stride_of_row(row)],
+                     ExcMessage("The sparsity pattern of the matrix does not "
+                                "match the one of this object."));
+              data[data_index(row, k, component)] = entry->value();
+            }
+        }
+    },
+    64);
+}
+
+
+
+template <typename Number, int n_components, int simd_length>
+inline std::size_t
+SparseMatrixSIMD<Number, n_components, simd_length>::data_index(
+  const unsigned int row,
+  const unsigned int position_within_row,
+  const unsigned int component) const
+{
+  Assert(sparsity != nullptr, ExcNotInitialized());
+  AssertIndexRange(component, n_components);
+  const std::size_t entry = sparsity->entry_index(row, position_within_row);
+  if (row < sparsity->n_vectorized_rows())
+    {
+      // the entries of a chunk with the same position form a block, in which
+      // the components are stored one after the other for all lanes
+      const unsigned int lane = row % simd_length;
+      return (entry - lane) * n_components + component * simd_length + lane;
+    }
+  else
+    return entry * n_components + component;
+}
+
+
+
+template <typename Number, int n_components, int simd_length>
+inline Number
+SparseMatrixSIMD<Number, n_components, simd_length>::get_entry(
+  const unsigned int row,
+  const unsigned int position_within_row,
+  const unsigned int component) const
+{
+  return data[data_index(row, position_within_row, component)];
+}
+
+
+
+template <typename Number, int n_components, int simd_length>
+inline Tensor<1, n_components, Number>
+SparseMatrixSIMD<Number, n_components, simd_length>::get_tensor(
+  const unsigned int row,
+  const unsigned int position_within_row) const
+{
+  Tensor<1, n_components, Number> result;
+  for (unsigned int c = 0; c < n_components; ++c)
+    result[c] = get_entry(row, position_within_row, c);
+  return result;
+}
+
+
+
+template <typename Number, int n_components, int simd_length>
+inline VectorizedArray<Number, simd_length>
+SparseMatrixSIMD<Number, n_components, simd_length>::get_vectorized_entry(
+  const unsigned int first_row,
+  const unsigned int position_within_row,
+  const unsigned int component) const
+{
+  Assert(first_row % simd_length == 0 &&
+           first_row < sparsity->n_vectorized_rows(),
+         ExcMessage("The row must be the first row of a chunk."));
+  VectorizedArray<Number, simd_length> result;
+  result.load(data.data() +
+              data_index(first_row, position_within_row, component));
+  return result;
+}
+
+
+
+template <typename Number, int n_components, int simd_length>
+inline Tensor<1, n_components, VectorizedArray<Number, simd_length>>
+SparseMatrixSIMD<Number, n_components, simd_length>::get_vectorized_tensor(
+  const unsigned int first_row,
+  const unsigned int position_within_row) const
+{
+  Tensor<1, n_components, VectorizedArray<Number, simd_length>> result;
+  for (unsigned int c = 0; c < n_components; ++c)
+    result[c] = get_vectorized_entry(first_row, position_within_row, c);
+  return result;
+}
+
+
+
+template <typename Number, int n_components, int simd_length>
+inline void
+SparseMatrixSIMD<Number, n_components, simd_length>::set_entry(
+  const unsigned int row,
+  const unsigned int position_within_row,
+  const Number       value,
+  const unsigned int component)
+{
+  data[data_index(row, position_within_row, component)] = value;
+}
+
+
+
+template <typename Number, int n_components, int simd_length>
+inline void
+SparseMatrixSIMD<Number, n_components, simd_length>::set_vectorized_entry(
+  const unsigned int                          first_row,
+  const unsigned int                          position_within_row,
+  const VectorizedArray<Number, simd_length> &value,
+  const unsigned int                          component)
+{
+  Assert(first_row % simd_length == 0 &&
+           first_row < sparsity->n_vectorized_rows(),
+         ExcMessage("The row must be the first row of a chunk."));
+  value.store(data.data() +
+              data_index(first_row, position_within_row, component));
+}
+
+
+
+template <typename Number, int n_components, int simd_length>
+inline const SparsityPatternSIMD<simd_length> &
+SparseMatrixSIMD<Number, n_components, simd_length>::get_sparsity_pattern()
+  const
+{
+  Assert(sparsity != nullptr, ExcNotInitialized());
+  return *sparsity;
+}
+
+
+
+template <typename Number, int n_components, int simd_length>
+inline std::size_t
+SparseMatrixSIMD<Number, n_components, simd_length>::memory_consumption() const
+{
+  return sizeof(*this) + data.memory_consumption();
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -79,6 +79,7 @@ SparseMIC<number>::initialize(const SparseMatrix<somenumber> &matrix,
   SparseLUDecomposition<number>::initialize(matrix, data);
   this->strengthen_diagonal = data.strengthen_diagonal;
   this->prebuild_lower_bound();
+  this->compute_level_sets();
   this->copy_from(matrix);
 
   Assert(this->m() == this->n(), ExcNotQuadratic());
@@ -159,39 +160,55 @@ SparseMIC<number>::vmult(Vector<somenumber> &      dst,
   // strictly lower- and upper- diagonal parts of the system.
   //
   // Solve (X-L)X{-1}(X-U) x = b in 3 steps:
-  dst = src;
-  for (size_type row = 0; row < N; ++row)
-    {
-      // Now: (X-L)u = b
+  const auto forward_row = [&](const size_type row) {
+    // Now: (X-L)u = b
 
-      // get start of this row. skip
-      // the diagonal element
-      for (typename SparseMatrix<number>::const_iterator p =
-             this->begin(row) + 1;
-           (p != this->end(row)) && (p->column() < row);
-           ++p)
+    // get start of this row. skip
+    // the diagonal element
+    for (typename SparseMatrix<number>::const_iterator p =
+           this->begin(row) + 1;
+         (p != this->end(row)) && (p->column() < row);
+         ++p)
+      dst(row) -= p->value() * dst(p->column());
+
+    dst(row) *= inv_diag[row];
+  };
+
+  // x = (X-U)v
+  const auto backward_row = [&](const size_type row) {
+    // get end of this row
+    for (typename SparseMatrix<number>::const_iterator p =
+           this->begin(row) + 1;
+         p != this->end(row);
+         ++p)
+      if (p->column() > row)
         dst(row) -= p->value() * dst(p->column());
 
-      dst(row) *= inv_diag[row];
-    }
+    dst(row) *= inv_diag[row];
+  };
+
+  // rows within a level of the level sets computed in initialize() do not
+  // depend on each other, so they can be processed concurrently
+  dst = src;
+  if (this->use_level_scheduling(this->forward_level_starts))
+    this->apply_by_level_sets(this->forward_level_starts,
+                              this->forward_level_rows,
+                              forward_row);
+  else
+    for (size_type row = 0; row < N; ++row)
+      forward_row(row);
 
   // Now: v = Xu
   for (size_type row = 0; row < N; ++row)
     dst(row) *= diag[row];
 
-  // x = (X-U)v
-  for (int row = N - 1; row >= 0; --row)
-    {
-      // get end of this row
-      for (typename SparseMatrix<number>::const_iterator p =
-             this->begin(row) + 1;
-           p != this->end(row);
-           ++p)
-        if (p->column() > static_cast<size_type>(row))
-          dst(row) -= p->value() * dst(p->column());
-
-      dst(row) *= inv_diag[row];
-    }
+  if (this->use_level_scheduling(this->backward_level_starts))
+    this->apply_by_level_sets(this->backward_level_starts,
+                              this->backward_level_rows,
+                              backward_row);
+  else
+    for (size_type row = N; row > 0;)
+      backward_row(--row);
 }
 
 
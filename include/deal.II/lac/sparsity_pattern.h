@@ -56,6 +56,8 @@ template <typename number>
 class SparseLUDecomposition;
 template <typename number>
 class SparseILU;
+template <typename number, int block_size>
+class BlockCSRSparseMatrix;
 
 namespace ChunkSparsityPatternIterators
 {
@@ -1160,6 +1162,8 @@ private:
   friend class SparseILU;
   template <typename number>
   friend class ChunkSparseMatrix;
+  template <typename number, int block_size>
+  friend class BlockCSRSparseMatrix;
 
   friend class ChunkSparsityPattern;
   friend class DynamicSparsityPattern;
@@ -263,6 +263,14 @@ namespace SparsityTools
    * rows contained in this set are checked in dsp for transfer. This function
    * needs to be used with PETScWrappers::MPI::SparseMatrix for it to work
    * correctly in a parallel computation.
+   *
+   * The rows are exchanged with the consensus algorithms of
+   * Utilities::MPI::ConsensusAlgorithms in a compressed format that stores
+   * the differences between consecutive column indices with a variable
+   * number of bytes. Both the memory and the time of this function
+   * therefore scale with the number of processes the calling process
+   * actually exchanges rows with, rather than with the size of the
+   * communicator.
    */
   void
   distribute_sparsity_pattern(DynamicSparsityPattern &dsp,
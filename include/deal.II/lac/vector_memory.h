@@ -460,6 +460,225 @@ private:
 
 
 
+/**
+ * A pool based memory management class whose storage belongs to the object
+ * itself rather than to a global pool. See the documentation of the base
+ * class for a description of its purpose.
+ *
+ * In contrast to GrowingVectorMemory, whose vectors are shared by all
+ * objects of the same vector type and whose every alloc() and free() passes
+ * through a global mutex, the vectors of an object of this class are
+ * released when the object is destroyed, and the object does no locking at
+ * all. The intended use is to keep one such object with each solver (or on
+ * each thread, e.g., via Threads::ThreadLocalStorage) that is called many
+ * times in a row, for example a linear solver inside a Newton iteration:
+ * @code
+ *   PooledVectorMemory<LinearAlgebra::distributed::Vector<double>> memory;
+ *   memory.reserve(30, solution);
+ *   for (unsigned int it = 0; it < n_newton_iterations; ++it)
+ *     {
+ *       ...
+ *       SolverGMRES<LinearAlgebra::distributed::Vector<double>> solver(
+ *         control, memory);
+ *       solver.solve(jacobian, update, residual, preconditioner);
+ *     }
+ *   std::cout << "Pool hits: " << memory.get_statistics().n_hits << std::endl;
+ * @endcode
+ *
+ * Vectors returned through free() are kept untouched, including their
+ * partitioner, and are handed out again by alloc() in last-in, first-out
+ * order. Since solvers request and return their temporary vectors in the
+ * same order in every call, each temporary vector is usually served by the
+ * vector that held it in the previous call, and the call to
+ * <code>reinit(x)</code> that follows in the solver recognizes the layout
+ * it already has and neither allocates memory nor touches new pages.
+ *
+ * Vectors created by reserve() are initialized to zero by the same
+ * parallel vector operations that work on them later, so the memory pages
+ * are first touched by the threads that will access them later on (which
+ * matters on systems with non-uniform memory access).
+ *
+ * Since the object does not lock, it must not be accessed by several
+ * threads concurrently.
+ *
+ * This class is instantiated in the library for the serial, block, and
+ * distributed vectors of deal.II. For other vector types, include the file
+ * vector_memory.templates.h.
+ */
+template <typename VectorType = dealii::Vector<double>>
+class PooledVectorMemory : public VectorMemory<VectorType>
+{
+public:
+  /**
+   * Declare type for container size.
+   */
+  using size_type = types::global_dof_index;
+
+  /**
+   * A structure collecting the statistics of the pool as returned by
+   * get_statistics().
+   */
+  struct Statistics
+  {
+    /**
+     * Number of calls to alloc() that could be served by a vector already in
+     * the pool.
+     */
+    std::size_t n_hits = 0;
+
+    /**
+     * Number of calls to alloc() that had to create a new vector.
+     */
+    std::size_t n_misses = 0;
+
+    /**
+     * Largest number of vectors held by the pool at any time.
+     */
+    std::size_t peak_vectors = 0;
+
+    /**
+     * Largest number of bytes of the vectors held by the pool, as seen when
+     * the vectors are returned to the pool or created by reserve().
+     */
+    std::size_t peak_bytes = 0;
+  };
+
+  /**
+   * Constructor. If @p log_statistics is set, the destructor writes the
+   * statistics of the pool to deallog.
+   */
+  PooledVectorMemory(const bool log_statistics = false);
+
+  /**
+   * Destructor. The destructor checks that all vectors that have been
+   * allocated through the current object have been released again, and then
+   * releases the memory of all vectors of the pool.
+   */
+  virtual ~PooledVectorMemory() override;
+
+  /**
+   * Return a pointer to a vector from the pool, or to a new vector if all
+   * vectors of the pool are in use. As for the other classes derived from
+   * VectorMemory, the size and the contents of the vector are unspecified,
+   * and the place that calls this function will need to reinitialize the
+   * vector appropriately.
+   *
+   * @warning Just like using <code>new</code> and <code>delete</code>
+   *   explicitly in code invites bugs where memory is leaked (either
+   *   because the corresponding <code>delete</code> is forgotten
+   *   altogether, or because of exception safety issues), using the
+   *   alloc() and free() functions explicitly invites writing code
+   *   that accidentally leaks memory. You should consider using
+   *   the VectorMemory::Pointer class instead, which provides the
+   *   same kind of service that <code>std::unique</code> provides
+   *   for arbitrary memory allocated on the heap.
+   */
+  virtual VectorType *
+  alloc() override;
+
+  /**
+   * Return a vector to the pool, retaining it with its current layout for
+   * reuse by the next call to alloc().
+   *
+   * @warning Just like using <code>new</code> and <code>delete</code>
+   *   explicitly in code invites bugs where memory is leaked (either
+   *   because the corresponding <code>delete</code> is forgotten
+   *   altogether, or because of exception safety issues), using the
+   *   alloc() and free() functions explicitly invites writing code
+   *   that accidentally leaks memory. You should consider using
+   *   the VectorMemory::Pointer class instead, which provides the
+   *   same kind of service that <code>std::unique</code> provides
+   *   for arbitrary memory allocated on the heap.
+   */
+  virtual void
+  free(const VectorType *const v) override;
+
+  /**
+   * Make sure that the pool holds at least @p n_vectors unused vectors with
+   * the same layout as @p layout, creating new ones as necessary. The new
+   * vectors are set to zero, which first touches their memory with the
+   * thread layout of the vector operations.
+   */
+  void
+  reserve(const unsigned int n_vectors, const VectorType &layout);
+
+  /**
+   * Release all vectors that are not currently in use. The statistics are
+   * kept.
+   */
+  void
+  release_unused_memory();
+
+  /**
+   * Return the statistics collected since the construction of this object.
+   */
+  const Statistics &
+  get_statistics() const;
+
+  /**
+   * Memory consumed by this class and all vectors of the pool.
+   */
+  std::size_t
+  memory_consumption() const;
+
+private:
+  /**
+   * An entry of the pool.
+   */
+  struct Entry
+  {
+    /**
+     * The vector itself.
+     */
+    std::unique_ptr<VectorType> vector;
+
+    /**
+     * Whether the vector is currently in use.
+     */
+    bool used;
+
+    /**
+     * The memory consumption of the vector when it was last returned to the
+     * pool.
+     */
+    std::size_t bytes;
+  };
+
+  /**
+   * All vectors held by the pool.
+   */
+  std::vector<Entry> entries;
+
+  /**
+   * Indices into @p entries of the vectors that are currently not in use,
+   * with the most recently returned one last.
+   */
+  std::vector<unsigned int> unused_entries;
+
+  /**
+   * Sum of the @p bytes fields of all entries.
+   */
+  std::size_t current_bytes;
+
+  /**
+   * Number of vectors currently allocated in this object; used for detecting
+   * memory leaks.
+   */
+  size_type current_alloc;
+
+  /**
+   * The statistics of the pool.
+   */
+  Statistics statistics;
+
+  /**
+   * A flag controlling the logging of statistics by the destructor.
+   */
+  bool log_statistics;
+};
+
+
+
 namespace internal
 {
   namespace GrowingVectorMemoryImplementation
@@ -23,6 +23,7 @@
 
 #include <deal.II/lac/vector_memory.h>
 
+#include <algorithm>
 #include <memory>
 
 DEAL_II_NAMESPACE_OPEN
@@ -195,6 +196,151 @@ GrowingVectorMemory<VectorType>::memory_consumption() const
 }
 
 
+
+
+template <typename VectorType>
+inline PooledVectorMemory<VectorType>::PooledVectorMemory(
+  const bool log_statistics)
+  : current_bytes(0)
+  , current_alloc(0)
+  , log_statistics(log_statistics)
+{}
+
+
+
+template <typename VectorType>
+inline PooledVectorMemory<VectorType>::~PooledVectorMemory()
+{
+  AssertNothrow(current_alloc == 0,
+                StandardExceptions::ExcMemoryLeak(current_alloc));
+  if (log_statistics)
+    {
+      deallog << "PooledVectorMemory:Hits: " << statistics.n_hits << std::endl;
+      deallog << "PooledVectorMemory:Misses: " << statistics.n_misses
+              << std::endl;
+      deallog << "PooledVectorMemory:Maximum allocated vectors: "
+              << statistics.peak_vectors << std::endl;
+      deallog << "PooledVectorMemory:Maximum allocated bytes: "
+              << statistics.peak_bytes << std::endl;
+    }
+}
+
+
+
+template <typename VectorType>
+inline VectorType *
+PooledVectorMemory<VectorType>::alloc()
+{
+  ++current_alloc;
+
+  // take the vector that was returned most recently, which is the one most
+  // likely to already have the layout the caller is going to ask for
+  if (unused_entries.empty() == false)
+    {
+      ++statistics.n_hits;
+      Entry &entry = entries[unused_entries.back()];
+      unused_entries.pop_back();
+      entry.used = true;
+      return entry.vector.get();
+    }
+
+  ++statistics.n_misses;
+  entries.push_back(Entry{std::make_unique<VectorType>(), true, 0});
+  statistics.peak_vectors = std::max(statistics.peak_vectors, entries.size());
+
+  return entries.back().vector.get();
+}
+
+
+
+template <typename VectorType>
+inline void
+PooledVectorMemory<VectorType>::free(const VectorType *const v)
+{
+  for (unsigned int i = 0; i < entries.size(); ++i)
+    if (entries[i].vector.get() == v)
+      {
+        Assert(entries[i].used,
+               typename VectorMemory<VectorType>::ExcNotAllocatedHere());
+        entries[i].used = false;
+        unused_entries.push_back(i);
+        --current_alloc;
+
+        const std::size_t bytes = v->memory_consumption();
+        current_bytes += bytes;
+        current_bytes -= entries[i].bytes;
+        entries[i].bytes      = bytes;
+        statistics.peak_bytes = std::max(statistics.peak_bytes, current_bytes);
+        return;
+      }
+  Assert(false, typename VectorMemory<VectorType>::ExcNotAllocatedHere());
+}
+
+
+
+template <typename VectorType>
+inline void
+PooledVectorMemory<VectorType>::reserve(const unsigned int n_vectors,
+                                        const VectorType & layout)
+{
+  while (unused_entries.size() < n_vectors)
+    {
+      auto vector = std::make_unique<VectorType>();
+      // initialize with zero rather than omitting the zeroing to let the
+      // threads of the vector operations first touch the memory
+      vector->reinit(layout, false);
+
+      const std::size_t bytes = vector->memory_consumption();
+      current_bytes += bytes;
+      unused_entries.push_back(entries.size());
+      entries.push_back(Entry{std::move(vector), false, bytes});
+    }
+
+  statistics.peak_vectors = std::max(statistics.peak_vectors, entries.size());
+  statistics.peak_bytes   = std::max(statistics.peak_bytes, current_bytes);
+}
+
+
+
+template <typename VectorType>
+inline void
+PooledVectorMemory<VectorType>::release_unused_memory()
+{
+  std::vector<Entry> used_entries;
+  for (Entry &entry : entries)
+    if (entry.used)
+      used_entries.push_back(std::move(entry));
+    else
+      current_bytes -= entry.bytes;
+
+  entries.swap(used_entries);
+  unused_entries.clear();
+}
+
+
+
+template <typename VectorType>
+inline const typename PooledVectorMemory<VectorType>::Statistics &
+PooledVectorMemory<VectorType>::get_statistics() const
+{
+  return statistics;
+}
+
+
+
+template <typename VectorType>
+inline std::size_t
+PooledVectorMemory<VectorType>::memory_consumption() const
+{
+  std::size_t result = sizeof(*this) +
+                       MemoryConsumption::memory_consumption(unused_entries);
+  for (const Entry &entry : entries)
+    result += sizeof(entry) + entry.vector->memory_consumption();
+
+  return result;
+}
+
+
 DEAL_II_NAMESPACE_CLOSE
 
 #endif
@@ -90,14 +90,14 @@ namespace internal
 
 
 
-#ifdef DEAL_II_WITH_TBB
     /**
      * This struct takes the loop range from the tbb parallel for loop and
      * translates it to the actual ranges of the for loop within the vector. It
      * encodes the grain size but might choose larger values of chunks than the
      * minimum grain size. The minimum grain size given to tbb is then simple
      * 1. For affinity reasons, the layout in this loop must be kept in sync
-     * with the respective class for reductions further down.
+     * with the respective class for reductions further down. The other task
+     * backends work on the same chunks through apply_to_chunks().
      */
     template <typename Functor>
     struct TBBForFunctor
@@ -130,20 +130,28 @@ namespace internal
       }
 
       void
-      operator()(const tbb::blocked_range<size_type> &range) const
+      apply_to_chunks(const size_type chunk_begin,
+                      const size_type chunk_end) const
       {
-        const size_type r_begin = start + range.begin() * chunk_size;
-        const size_type r_end = std::min(start + range.end() * chunk_size, end);
+        const size_type r_begin = start + chunk_begin * chunk_size;
+        const size_type r_end = std::min(start + chunk_end * chunk_size, end);
         functor(r_begin, r_end);
       }
 
+#ifdef DEAL_II_WITH_TBB
+      void
+      operator()(const tbb::blocked_range<size_type> &range) const
+      {
+        apply_to_chunks(range.begin(), range.end());
+      }
+#endif
+
       Functor &       functor;
       const size_type start;
       const size_type end;
       unsigned int    n_chunks;
       size_type       chunk_size;
     };
-#endif
 
     template <typename Functor>
     void
@@ -154,43 +162,59 @@ namespace internal
       const std::shared_ptr<::dealii::parallel::internal::TBBPartitioner>
         &partitioner)
     {
-#ifdef DEAL_II_WITH_TBB
       const size_type vec_size = end - start;
       // only go to the parallel function in case there are at least 4 parallel
       // items, otherwise the overhead is too large
       if (vec_size >=
             4 * internal::VectorImplementation::minimum_parallel_grain_size &&
-          MultithreadInfo::n_threads() > 1)
+          MultithreadInfo::n_threads() > 1 &&
+          MultithreadInfo::get_task_backend() !=
+            MultithreadInfo::TaskBackend::sequential)
         {
-          Assert(partitioner.get() != nullptr,
-                 ExcInternalError(
-                   "Unexpected initialization of Vector that does "
-                   "not set the TBB partitioner to a usable state."));
-          std::shared_ptr<tbb::affinity_partitioner> tbb_partitioner =
-            partitioner->acquire_one_partitioner();
-
           TBBForFunctor<Functor> generic_functor(functor, start, end);
-          // We use a minimum grain size of 1 here since the grains at this
-          // stage of dividing the work refer to the number of vector chunks
-          // that are processed by (possibly different) threads in the
-          // parallelized for loop (i.e., they do not refer to individual
-          // vector entries). The number of chunks here is calculated inside
-          // TBBForFunctor. See also GitHub issue #2496 for further discussion
-          // of this strategy.
-          ::dealii::parallel::internal::parallel_for(
+#ifdef DEAL_II_WITH_TBB
+          if (MultithreadInfo::get_task_backend() ==
+                MultithreadInfo::TaskBackend::tbb &&
+              !MultithreadInfo::use_static_partitioning())
+            {
+              Assert(partitioner.get() != nullptr,
+                     ExcInternalError(
+                       "Unexpected initialization of Vector that does "
+                       "not set the TBB partitioner to a usable state."));
+              std::shared_ptr<tbb::affinity_partitioner> tbb_partitioner =
+                partitioner->acquire_one_partitioner();
+
+              // We use a minimum grain size of 1 here since the grains at
+              // this stage of dividing the work refer to the number of vector
+              // chunks that are processed by (possibly different) threads in
+              // the parallelized for loop (i.e., they do not refer to
+              // individual vector entries). The number of chunks here is
+              // calculated inside TBBForFunctor. See also GitHub issue #2496
+              // for further discussion of this strategy.
+              ::dealii::parallel::internal::parallel_for(
+                static_cast<size_type>(0),
+                static_cast<size_type>(generic_functor.n_chunks),
+                generic_functor,
+                1,
+                tbb_partitioner);
+              partitioner->release_one_partitioner(tbb_partitioner);
+              return;
+            }
+#endif
+          // other task backends and the static partitioning work on the
+          // same chunks of the vector
+          ::dealii::parallel::internal::parallel_for_subranges(
             static_cast<size_type>(0),
             static_cast<size_type>(generic_functor.n_chunks),
-            generic_functor,
-            1,
-            tbb_partitioner);
-          partitioner->release_one_partitioner(tbb_partitioner);
+            [&generic_functor](const size_type chunk_begin,
+                               const size_type chunk_end) {
+              generic_functor.apply_to_chunks(chunk_begin, chunk_end);
+            },
+            1);
         }
       else if (vec_size > 0)
         functor(start, end);
-#else
-      functor(start, end);
       (void)partitioner;
-#endif
     }
 
 
@@ -1296,7 +1320,6 @@ namespace internal
 
 
 
-#ifdef DEAL_II_WITH_TBB
     /**
      * This struct takes the loop range from the tbb parallel for loop and
      * translates it to the actual ranges of the reduction loop inside the
@@ -1368,19 +1391,31 @@ namespace internal
       }
 
       /**
-       * An operator used by TBB to work on a given @p range of chunks
-       * [range.begin(), range.end()).
+       * Work on the chunks [chunk_begin, chunk_end).
        */
       void
-      operator()(const tbb::blocked_range<size_type> &range) const
+      apply_to_chunks(const size_type chunk_begin,
+                      const size_type chunk_end) const
       {
-        for (size_type i = range.begin(); i < range.end(); ++i)
+        for (size_type i = chunk_begin; i < chunk_end; ++i)
           accumulate_recursive(op,
                                start + i * chunk_size,
                                std::min(start + (i + 1) * chunk_size, end),
                                array_ptr[i]);
       }
 
+#ifdef DEAL_II_WITH_TBB
+      /**
+       * An operator used by TBB to work on a given @p range of chunks
+       * [range.begin(), range.end()).
+       */
+      void
+      operator()(const tbb::blocked_range<size_type> &range) const
+      {
+        apply_to_chunks(range.begin(), range.end());
+      }
+#endif
+
       ResultType
       do_sum() const
       {
@@ -1407,7 +1442,6 @@ namespace internal
       // the number of threads we want to feed
       mutable ResultType *array_ptr;
     };
-#endif
 
 
 
@@ -1428,46 +1462,64 @@ namespace internal
         const std::shared_ptr<::dealii::parallel::internal::TBBPartitioner>
           &partitioner)
     {
-#ifdef DEAL_II_WITH_TBB
       const size_type vec_size = end - start;
       // only go to the parallel function in case there are at least 4 parallel
       // items, otherwise the overhead is too large
       if (vec_size >=
             4 * internal::VectorImplementation::minimum_parallel_grain_size &&
-          MultithreadInfo::n_threads() > 1)
+          MultithreadInfo::n_threads() > 1 &&
+          MultithreadInfo::get_task_backend() !=
+            MultithreadInfo::TaskBackend::sequential)
         {
-          Assert(partitioner.get() != nullptr,
-                 ExcInternalError(
-                   "Unexpected initialization of Vector that does "
-                   "not set the TBB partitioner to a usable state."));
-          std::shared_ptr<tbb::affinity_partitioner> tbb_partitioner =
-            partitioner->acquire_one_partitioner();
-
           TBBReduceFunctor<Operation, ResultType> generic_functor(op,
                                                                   start,
                                                                   end);
-          // We use a minimum grain size of 1 here since the grains at this
-          // stage of dividing the work refer to the number of vector chunks
-          // that are processed by (possibly different) threads in the
-          // parallelized for loop (i.e., they do not refer to individual
-          // vector entries). The number of chunks here is calculated inside
-          // TBBForFunctor. See also GitHub issue #2496 for further discussion
-          // of this strategy.
-          ::dealii::parallel::internal::parallel_for(
+#ifdef DEAL_II_WITH_TBB
+          if (MultithreadInfo::get_task_backend() ==
+                MultithreadInfo::TaskBackend::tbb &&
+              !MultithreadInfo::use_static_partitioning())
+            {
+              Assert(partitioner.get() != nullptr,
+                     ExcInternalError(
+                       "Unexpected initialization of Vector that does "
+                       "not set the TBB partitioner to a usable state."));
+              std::shared_ptr<tbb::affinity_partitioner> tbb_partitioner =
+                partitioner->acquire_one_partitioner();
+
+              // We use a minimum grain size of 1 here since the grains at
+              // this stage of dividing the work refer to the number of vector
+              // chunks that are processed by (possibly different) threads in
+              // the parallelized for loop (i.e., they do not refer to
+              // individual vector entries). The number of chunks here is
+              // calculated inside TBBForFunctor. See also GitHub issue #2496
+              // for further discussion of this strategy.
+              ::dealii::parallel::internal::parallel_for(
+                static_cast<size_type>(0),
+                static_cast<size_type>(generic_functor.n_chunks),
+                generic_functor,
+                1,
+                tbb_partitioner);
+              partitioner->release_one_partitioner(tbb_partitioner);
+              result = generic_functor.do_sum();
+              return;
+            }
+#endif
+          // other task backends and the static partitioning fill the same
+          // chunks of the result array, which keeps the result bitwise
+          // identical
+          ::dealii::parallel::internal::parallel_for_subranges(
             static_cast<size_type>(0),
             static_cast<size_type>(generic_functor.n_chunks),
-            generic_functor,
-            1,
-            tbb_partitioner);
-          partitioner->release_one_partitioner(tbb_partitioner);
+            [&generic_functor](const size_type chunk_begin,
+                               const size_type chunk_end) {
+              generic_functor.apply_to_chunks(chunk_begin, chunk_end);
+            },
+            1);
           result = generic_functor.do_sum();
         }
       else
         accumulate_recursive(op, start, end, result);
-#else
-      accumulate_recursive(op, start, end, result);
       (void)partitioner;
-#endif
     }
 
 
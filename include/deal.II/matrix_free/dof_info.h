@@ -326,6 +326,21 @@ namespace internal
         const TaskInfo &                               task_info,
         const std::vector<FaceToCellTopology<length>> &faces);
 
+      /**
+       * For each partition of cells in @p task_info, append the ranks of the
+       * MPI processes that own ghost entries read by the cell and face
+       * integrals of the partition to the respective entry of
+       * @p ghost_ranks. This information is used to process the partitions
+       * with MPI communication in the order in which the ghost data of the
+       * respective processes arrives.
+       */
+      template <int length>
+      void
+      compute_ghost_ranks_of_partitions(
+        const TaskInfo &                               task_info,
+        const std::vector<FaceToCellTopology<length>> &faces,
+        std::vector<std::vector<unsigned int>> &       ghost_ranks) const;
+
       /**
        * Return the memory consumption in bytes of this class.
        */
@@ -30,6 +30,7 @@
 #include <deal.II/matrix_free/hanging_nodes_internal.h>
 #include <deal.II/matrix_free/task_info.h>
 
+#include <algorithm>
 #include <limits>
 
 DEAL_II_NAMESPACE_OPEN
@@ -371,6 +372,86 @@ namespace internal
 
 
 
+    template <int length>
+    void
+    DoFInfo::compute_ghost_ranks_of_partitions(
+      const TaskInfo &                               task_info,
+      const std::vector<FaceToCellTopology<length>> &faces,
+      std::vector<std::vector<unsigned int>> &       ghost_ranks) const
+    {
+      AssertDimension(length, vectorization_length);
+      const unsigned int n_partitions =
+        task_info.partition_row_index[task_info.partition_row_index.size() - 2];
+      AssertDimension(ghost_ranks.size(), n_partitions);
+
+      // the ghost indices are sorted by the owning process, so the owner of
+      // a ghost index can be found by a binary search in the accumulated
+      // number of ghost indices per process
+      const unsigned int n_owned = vector_partitioner->locally_owned_size();
+      const auto &ghost_targets  = vector_partitioner->ghost_targets();
+      if (ghost_targets.empty())
+        return;
+
+      std::vector<unsigned int> ghost_target_end(ghost_targets.size());
+      for (unsigned int i = 0, end = n_owned; i < ghost_targets.size(); ++i)
+        {
+          end += ghost_targets[i].second;
+          ghost_target_end[i] = end;
+        }
+
+      const unsigned int n_components = start_components.back();
+      const auto         add_ranks_of_cell =
+        [&](const unsigned int cell, std::vector<unsigned int> &ranks) {
+          if (cell == numbers::invalid_unsigned_int)
+            return;
+          for (unsigned int it = row_starts[cell * n_components].first;
+               it != row_starts[(cell + 1) * n_components].first;
+               ++it)
+            if (dof_indices[it] >= n_owned)
+              {
+                const unsigned int target =
+                  std::upper_bound(ghost_target_end.begin(),
+                                   ghost_target_end.end(),
+                                   dof_indices[it]) -
+                  ghost_target_end.begin();
+                AssertIndexRange(target, ghost_targets.size());
+                ranks.push_back(ghost_targets[target].first);
+              }
+        };
+
+      for (unsigned int chunk = 0; chunk < n_partitions; ++chunk)
+        {
+          std::vector<unsigned int> &ranks = ghost_ranks[chunk];
+          for (unsigned int cell = task_info.cell_partition_data[chunk];
+               cell < task_info.cell_partition_data[chunk + 1];
+               ++cell)
+            for (unsigned int v = 0; v < vectorization_length; ++v)
+              add_ranks_of_cell(cell * vectorization_length + v, ranks);
+
+          if (faces.size() > 0)
+            {
+              for (unsigned int face = task_info.face_partition_data[chunk];
+                   face < task_info.face_partition_data[chunk + 1];
+                   ++face)
+                for (unsigned int v = 0; v < length; ++v)
+                  {
+                    add_ranks_of_cell(faces[face].cells_interior[v], ranks);
+                    add_ranks_of_cell(faces[face].cells_exterior[v], ranks);
+                  }
+              for (unsigned int face = task_info.boundary_partition_data[chunk];
+                   face < task_info.boundary_partition_data[chunk + 1];
+                   ++face)
+                for (unsigned int v = 0; v < length; ++v)
+                  add_ranks_of_cell(faces[face].cells_interior[v], ranks);
+            }
+
+          std::sort(ranks.begin(), ranks.end());
+          ranks.erase(std::unique(ranks.begin(), ranks.end()), ranks.end());
+        }
+    }
+
+
+
     template <int length>
     void
     DoFInfo::compute_vector_zero_access_pattern(
@@ -823,6 +823,189 @@ namespace internal
 
 
 
+  /**
+   * Dense kernels for the interpolation of shape functions without tensor
+   * product structure, e.g. on simplices, between the unknowns and the
+   * quadrature points. The shape values are stored as a matrix with entries
+   * `shape_values[i * n_q_points + q]` for the unknowns $i$ and quadrature
+   * points $q$, and the shape gradients as `dim` such matrices. A block of
+   * @p n_block quadrature points (evaluation) or unknowns (integration) is
+   * computed at once and kept in registers, such that each vector entry is
+   * loaded only once per block for the values and all derivatives.
+   */
+  template <int dim, typename Number>
+  struct EvaluatorDense
+  {
+    static constexpr unsigned int n_block = 4;
+
+    /**
+     * Compute values and/or gradients in a block of the quadrature points
+     * starting at @p q0.
+     */
+    template <int block_size, bool evaluate_values, bool evaluate_gradients>
+    static inline DEAL_II_ALWAYS_INLINE void
+    evaluate_block(const Number *     shape_values,
+                   const Number *     shape_gradients,
+                   const unsigned int n_dofs,
+                   const unsigned int n_q_points,
+                   const unsigned int q0,
+                   const Number *     values_dofs,
+                   Number *           values_quad,
+                   Number *           gradients_quad)
+    {
+      Number values[block_size];
+      Number gradients[dim][block_size];
+      for (int k = 0; k < block_size; ++k)
+        {
+          if (evaluate_values)
+            values[k] = Number();
+          if (evaluate_gradients)
+            for (unsigned int d = 0; d < dim; ++d)
+              gradients[d][k] = Number();
+        }
+
+      for (unsigned int i = 0; i < n_dofs; ++i)
+        {
+          const Number value_dof = values_dofs[i];
+          if (evaluate_values)
+            {
+              const Number *shape = shape_values + i * n_q_points + q0;
+              for (int k = 0; k < block_size; ++k)
+                values[k] += shape[k] * value_dof;
+            }
+          if (evaluate_gradients)
+            for (unsigned int d = 0; d < dim; ++d)
+              {
+                const Number *shape =
+                  shape_gradients + (d * n_dofs + i) * n_q_points + q0;
+                for (int k = 0; k < block_size; ++k)
+                  gradients[d][k] += shape[k] * value_dof;
+              }
+        }
+
+      for (int k = 0; k < block_size; ++k)
+        {
+          if (evaluate_values)
+            values_quad[q0 + k] = values[k];
+          if (evaluate_gradients)
+            for (unsigned int d = 0; d < dim; ++d)
+              gradients_quad[d * n_q_points + q0 + k] = gradients[d][k];
+        }
+    }
+
+    /**
+     * Test the values and/or gradients in the quadrature points by the
+     * shape functions of the unknowns in a block starting at @p i0.
+     */
+    template <int block_size, bool integrate_values, bool integrate_gradients>
+    static inline DEAL_II_ALWAYS_INLINE void
+    integrate_block(const Number *     shape_values,
+                    const Number *     shape_gradients,
+                    const unsigned int n_dofs,
+                    const unsigned int n_q_points,
+                    const unsigned int i0,
+                    const Number *     values_quad,
+                    const Number *     gradients_quad,
+                    Number *           values_dofs,
+                    const bool         add_into_result)
+    {
+      Number result[block_size];
+      for (int k = 0; k < block_size; ++k)
+        result[k] = add_into_result ? values_dofs[i0 + k] : Number();
+
+      for (unsigned int q = 0; q < n_q_points; ++q)
+        {
+          if (integrate_values)
+            {
+              const Number value = values_quad[q];
+              for (int k = 0; k < block_size; ++k)
+                result[k] += shape_values[(i0 + k) * n_q_points + q] * value;
+            }
+          if (integrate_gradients)
+            for (unsigned int d = 0; d < dim; ++d)
+              {
+                const Number  gradient = gradients_quad[d * n_q_points + q];
+                const Number *shape = shape_gradients + d * n_dofs * n_q_points;
+                for (int k = 0; k < block_size; ++k)
+                  result[k] += shape[(i0 + k) * n_q_points + q] * gradient;
+              }
+        }
+
+      for (int k = 0; k < block_size; ++k)
+        values_dofs[i0 + k] = result[k];
+    }
+
+    template <bool evaluate_values, bool evaluate_gradients>
+    static void
+    evaluate(const Number *     shape_values,
+             const Number *     shape_gradients,
+             const unsigned int n_dofs,
+             const unsigned int n_q_points,
+             const Number *     values_dofs,
+             Number *           values_quad,
+             Number *           gradients_quad)
+    {
+      unsigned int q = 0;
+      for (; q + n_block <= n_q_points; q += n_block)
+        evaluate_block<n_block, evaluate_values, evaluate_gradients>(
+          shape_values,
+          shape_gradients,
+          n_dofs,
+          n_q_points,
+          q,
+          values_dofs,
+          values_quad,
+          gradients_quad);
+      for (; q < n_q_points; ++q)
+        evaluate_block<1, evaluate_values, evaluate_gradients>(shape_values,
+                                                               shape_gradients,
+                                                               n_dofs,
+                                                               n_q_points,
+                                                               q,
+                                                               values_dofs,
+                                                               values_quad,
+                                                               gradients_quad);
+    }
+
+    template <bool integrate_values, bool integrate_gradients>
+    static void
+    integrate(const Number *     shape_values,
+              const Number *     shape_gradients,
+              const unsigned int n_dofs,
+              const unsigned int n_q_points,
+              const Number *     values_quad,
+              const Number *     gradients_quad,
+              Number *           values_dofs,
+              const bool         add_into_result)
+    {
+      unsigned int i = 0;
+      for (; i + n_block <= n_dofs; i += n_block)
+        integrate_block<n_block, integrate_values, integrate_gradients>(
+          shape_values,
+          shape_gradients,
+          n_dofs,
+          n_q_points,
+          i,
+          values_quad,
+          gradients_quad,
+          values_dofs,
+          add_into_result);
+      for (; i < n_dofs; ++i)
+        integrate_block<1, integrate_values, integrate_gradients>(
+          shape_values,
+          shape_gradients,
+          n_dofs,
+          n_q_points,
+          i,
+          values_quad,
+          gradients_quad,
+          values_dofs,
+          add_into_result);
+    }
+  };
+
+
+
   template <int dim, int fe_degree, int n_q_points_1d, typename Number>
   inline void
   FEEvaluationImpl<
@@ -835,59 +1018,52 @@ namespace internal
                       const Number *                         values_dofs_actual,
                       FEEvaluationData<dim, Number, false> & fe_eval)
   {
+    if (evaluation_flag & EvaluationFlags::hessians)
+      Assert(false, ExcNotImplemented());
+
     const std::size_t n_dofs =
       fe_eval.get_shape_info().dofs_per_component_on_cell;
     const std::size_t n_q_points = fe_eval.get_shape_info().n_q_points;
 
-    const auto &shape_data = fe_eval.get_shape_info().data;
-
-    using Eval =
-      EvaluatorTensorProduct<evaluate_general, 1, 0, 0, Number, Number>;
-
-    if (evaluation_flag & EvaluationFlags::values)
-      {
-        const auto shape_values    = shape_data.front().shape_values.data();
-        auto       values_quad_ptr = fe_eval.begin_values();
-        auto       values_dofs_actual_ptr = values_dofs_actual;
-
-        Eval eval(shape_values, nullptr, nullptr, n_dofs, n_q_points);
-        for (unsigned int c = 0; c < n_components; ++c)
-          {
-            eval.template values<0, true, false>(values_dofs_actual_ptr,
-                                                 values_quad_ptr);
-
-            values_quad_ptr += n_q_points;
-            values_dofs_actual_ptr += n_dofs;
-          }
-      }
+    const auto &shape_data      = fe_eval.get_shape_info().data.front();
+    const auto  shape_values    = shape_data.shape_values.data();
+    const auto  shape_gradients = shape_data.shape_gradients.data();
 
-    if (evaluation_flag & EvaluationFlags::gradients)
+    // compute the values and gradients together, in order to load the
+    // unknowns only once for both
+    using Eval = EvaluatorDense<dim, Number>;
+    for (unsigned int c = 0; c < n_components; ++c)
       {
-        const auto shape_gradients = shape_data.front().shape_gradients.data();
-        auto       gradients_quad_ptr     = fe_eval.begin_gradients();
-        auto       values_dofs_actual_ptr = values_dofs_actual;
-
-        for (unsigned int c = 0; c < n_components; ++c)
-          {
-            for (unsigned int d = 0; d < dim; ++d)
-              {
-                Eval eval(nullptr,
-                          shape_gradients + n_q_points * n_dofs * d,
-                          nullptr,
-                          n_dofs,
-                          n_q_points);
-
-                eval.template gradients<0, true, false>(values_dofs_actual_ptr,
-                                                        gradients_quad_ptr);
-
-                gradients_quad_ptr += n_q_points;
-              }
-            values_dofs_actual_ptr += n_dofs;
-          }
+        const Number *values_dofs = values_dofs_actual + c * n_dofs;
+        Number *      values_quad = fe_eval.begin_values() + c * n_q_points;
+        Number *      gradients_quad =
+          fe_eval.begin_gradients() + c * dim * n_q_points;
+        if ((evaluation_flag & EvaluationFlags::values) &&
+            (evaluation_flag & EvaluationFlags::gradients))
+          Eval::template evaluate<true, true>(shape_values,
+                                              shape_gradients,
+                                              n_dofs,
+                                              n_q_points,
+                                              values_dofs,
+                                              values_quad,
+                                              gradients_quad);
+        else if (evaluation_flag & EvaluationFlags::values)
+          Eval::template evaluate<true, false>(shape_values,
+                                               shape_gradients,
+                                               n_dofs,
+                                               n_q_points,
+                                               values_dofs,
+                                               values_quad,
+                                               gradients_quad);
+        else if (evaluation_flag & EvaluationFlags::gradients)
+          Eval::template evaluate<false, true>(shape_values,
+                                               shape_gradients,
+                                               n_dofs,
+                                               n_q_points,
+                                               values_dofs,
+                                               values_quad,
+                                               gradients_quad);
       }
-
-    if (evaluation_flag & EvaluationFlags::hessians)
-      Assert(false, ExcNotImplemented());
   }
 
 
@@ -913,61 +1089,47 @@ namespace internal
       fe_eval.get_shape_info().dofs_per_component_on_cell;
     const std::size_t n_q_points = fe_eval.get_shape_info().n_q_points;
 
-    const auto &shape_data = fe_eval.get_shape_info().data;
-
-    using Eval =
-      EvaluatorTensorProduct<evaluate_general, 1, 0, 0, Number, Number>;
+    const auto &shape_data      = fe_eval.get_shape_info().data.front();
+    const auto  shape_values    = shape_data.shape_values.data();
+    const auto  shape_gradients = shape_data.shape_gradients.data();
 
-    if (integration_flag & EvaluationFlags::values)
-      {
-        const auto shape_values    = shape_data.front().shape_values.data();
-        auto       values_quad_ptr = fe_eval.begin_values();
-        auto       values_dofs_actual_ptr = values_dofs_actual;
-
-        Eval eval(shape_values, nullptr, nullptr, n_dofs, n_q_points);
-        for (unsigned int c = 0; c < n_components; ++c)
-          {
-            if (add_into_values_array == false)
-              eval.template values<0, false, false>(values_quad_ptr,
-                                                    values_dofs_actual_ptr);
-            else
-              eval.template values<0, false, true>(values_quad_ptr,
-                                                   values_dofs_actual_ptr);
-
-            values_quad_ptr += n_q_points;
-            values_dofs_actual_ptr += n_dofs;
-          }
-      }
-
-    if (integration_flag & EvaluationFlags::gradients)
+    // test the values and gradients together, in order to write the
+    // unknowns only once for both
+    using Eval = EvaluatorDense<dim, Number>;
+    for (unsigned int c = 0; c < n_components; ++c)
       {
-        const auto shape_gradients = shape_data.front().shape_gradients.data();
-        auto       gradients_quad_ptr     = fe_eval.begin_gradients();
-        auto       values_dofs_actual_ptr = values_dofs_actual;
-
-        for (unsigned int c = 0; c < n_components; ++c)
-          {
-            for (unsigned int d = 0; d < dim; ++d)
-              {
-                Eval eval(nullptr,
-                          shape_gradients + n_q_points * n_dofs * d,
-                          nullptr,
-                          n_dofs,
-                          n_q_points);
-
-                if ((add_into_values_array == false &&
-                     !(integration_flag & EvaluationFlags::values)) &&
-                    d == 0)
-                  eval.template gradients<0, false, false>(
-                    gradients_quad_ptr, values_dofs_actual_ptr);
-                else
-                  eval.template gradients<0, false, true>(
-                    gradients_quad_ptr, values_dofs_actual_ptr);
-
-                gradients_quad_ptr += n_q_points;
-              }
-            values_dofs_actual_ptr += n_dofs;
-          }
+        Number *      values_dofs = values_dofs_actual + c * n_dofs;
+        const Number *values_quad = fe_eval.begin_values() + c * n_q_points;
+        const Number *gradients_quad =
+          fe_eval.begin_gradients() + c * dim * n_q_points;
+        if ((integration_flag & EvaluationFlags::values) &&
+            (integration_flag & EvaluationFlags::gradients))
+          Eval::template integrate<true, true>(shape_values,
+                                               shape_gradients,
+                                               n_dofs,
+                                               n_q_points,
+                                               values_quad,
+                                               gradients_quad,
+                                               values_dofs,
+                                               add_into_values_array);
+        else if (integration_flag & EvaluationFlags::values)
+          Eval::template integrate<true, false>(shape_values,
+                                                shape_gradients,
+                                                n_dofs,
+                                                n_q_points,
+                                                values_quad,
+                                                gradients_quad,
+                                                values_dofs,
+                                                add_into_values_array);
+        else if (integration_flag & EvaluationFlags::gradients)
+          Eval::template integrate<false, true>(shape_values,
+                                                shape_gradients,
+                                                n_dofs,
+                                                n_q_points,
+                                                values_quad,
+                                                gradients_quad,
+                                                values_dofs,
+                                                add_into_values_array);
       }
   }
 
@@ -4356,7 +4518,8 @@ namespace internal
     run(const unsigned int                     n_components,
         const EvaluationFlags::EvaluationFlags integration_flag,
         Number *                               values_dofs,
-        FEEvaluationData<dim, Number, true> &  fe_eval)
+        FEEvaluationData<dim, Number, true> &  fe_eval,
+        const bool                             sum_into_values)
     {
       const auto &shape_info = fe_eval.get_shape_info();
       const auto &shape_data = shape_info.data.front();
@@ -4387,8 +4550,12 @@ namespace internal
               Eval eval(shape_values, nullptr, nullptr, n_dofs, n_q_points);
               for (unsigned int c = 0; c < n_components; ++c)
                 {
-                  eval.template values<0, false, false>(values_quad_ptr,
-                                                        values_dofs_actual_ptr);
+                  if (sum_into_values)
+                    eval.template values<0, false, true>(
+                      values_quad_ptr, values_dofs_actual_ptr);
+                  else
+                    eval.template values<0, false, false>(
+                      values_quad_ptr, values_dofs_actual_ptr);
 
                   values_quad_ptr += n_q_points;
                   values_dofs_actual_ptr += n_dofs;
@@ -4416,7 +4583,7 @@ namespace internal
                                 n_q_points);
 
                       if (!(integration_flag & EvaluationFlags::values) &&
-                          d == 0)
+                          d == 0 && !sum_into_values)
                         eval.template gradients<0, false, false>(
                           gradients_quad_ptr, values_dofs_actual_ptr);
                       else
@@ -4572,6 +4739,14 @@ namespace internal
                 temp[i][v] = scratch_data[i][v];
             }
         }
+      else if (sum_into_values)
+        FEFaceNormalEvaluationImpl<dim, fe_degree, Number>::
+          template interpolate<false, true>(n_components,
+                                            integration_flag,
+                                            shape_info,
+                                            temp,
+                                            values_dofs,
+                                            fe_eval.get_face_no());
       else
         FEFaceNormalEvaluationImpl<dim, fe_degree, Number>::
           template interpolate<false, false>(n_components,
@@ -70,7 +70,8 @@ namespace internal
     integrate(const unsigned int                     n_components,
               const EvaluationFlags::EvaluationFlags integration_flag,
               Number *                               values_dofs,
-              FEEvaluationData<dim, Number, true> &  fe_eval);
+              FEEvaluationData<dim, Number, true> &  fe_eval,
+              const bool                             sum_into_values);
   };
 
 
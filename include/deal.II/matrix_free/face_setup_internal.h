@@ -129,6 +129,7 @@ namespace internal
 
       std::vector<FaceCategory>          face_is_owned;
       std::vector<bool>                  at_processor_boundary;
+      std::vector<unsigned int>          processor_boundary_rank;
       std::vector<FaceToCellTopology<1>> inner_faces;
       std::vector<FaceToCellTopology<1>> boundary_faces;
       std::vector<FaceToCellTopology<1>> inner_ghost_faces;
@@ -187,6 +188,8 @@ namespace internal
       // interesting
 
       at_processor_boundary.resize(cell_levels.size(), false);
+      processor_boundary_rank.resize(cell_levels.size(),
+                                     numbers::invalid_unsigned_int);
       face_is_owned.resize(dim > 1 ? triangulation.n_raw_faces() :
                                      triangulation.n_vertices(),
                            FaceCategory::locally_active_done_elsewhere);
@@ -709,15 +712,27 @@ namespace internal
                                   dcell->neighbor_child_on_subface(f, s);
                             if (neighbor_child->subdomain_id() !=
                                 dcell->subdomain_id())
-                              ghost_cells.insert(
-                                std::pair<unsigned int, unsigned int>(
-                                  neighbor_child->level(),
-                                  neighbor_child->index()));
+                              {
+                                ghost_cells.insert(
+                                  std::pair<unsigned int, unsigned int>(
+                                    neighbor_child->level(),
+                                    neighbor_child->index()));
+                                processor_boundary_rank[i] =
+                                  std::min<unsigned int>(
+                                    processor_boundary_rank[i],
+                                    neighbor_child->subdomain_id());
+                              }
                           }
                       else
-                        ghost_cells.insert(
-                          std::pair<unsigned int, unsigned int>(
-                            neighbor->level(), neighbor->index()));
+                        {
+                          ghost_cells.insert(
+                            std::pair<unsigned int, unsigned int>(
+                              neighbor->level(), neighbor->index()));
+                          processor_boundary_rank[i] = std::min<unsigned int>(
+                            processor_boundary_rank[i],
+                            use_active_cells ? neighbor->subdomain_id() :
+                                               neighbor->level_subdomain_id());
+                        }
                       at_processor_boundary[i] = true;
                     }
                 }
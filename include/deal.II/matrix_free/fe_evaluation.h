@@ -1697,13 +1697,20 @@ protected:
  * core. The non-templated version is also fastest at polynomial degree 5 with
  * 2.1e-9 seconds per degree of freedom or 48 million degrees of freedom per
  * second. Note that using FEEvaluation with template `degree=-1` selects the
- * fast path for degrees between one and six, and the slow path for other
- * degrees.
+ * fast path for degrees between one and six by default, and the slow path for
+ * other degrees. The largest degree of the fast path can be changed when
+ * configuring deal.II, see below.
  *
  * <h4>Pre-compiling code for more polynomial degrees</h4>
  *
  * It is also possible to pre-compile the code in FEEvaluation for a different
- * maximal polynomial degree. This is controlled by the class
+ * maximal polynomial degree. The simplest way is to set the CMake variable
+ * `DEAL_II_FE_EVAL_FACTORY_DEGREE_MAX` when configuring deal.II, e.g.,
+ * `-DDEAL_II_FE_EVAL_FACTORY_DEGREE_MAX=12` for spectral elements of
+ * degrees up to 12, which makes the library itself contain the fast path
+ * for all these degrees at the cost of longer compile times and a larger
+ * library. Alternatively, a user program can pre-compile the code itself,
+ * which is controlled by the class
  * internal::FEEvaluationFactory and the implementation in
  * `include/deal.II/matrix_free/evaluation_template_factory.templates.h`. By
  * setting the macro `FE_EVAL_FACTORY_DEGREE_MAX` to the desired integer and
@@ -1739,6 +1746,35 @@ protected:
  * n_components entries. In that case, a single vector is provided for the
  * read_dof_values() and distribute_local_to_global() calls.
  *
+ * The first variant can also be used to apply the same scalar operator to
+ * several vectors at once, e.g. for block Krylov methods or eigenvalue
+ * solvers working on a set of vectors. Given a scalar element and a
+ * LinearAlgebra::distributed::BlockVector (or a
+ * @p std::vector<VectorType>) with @p n_vectors blocks, the operator
+ *
+ * @code
+ * FEEvaluation<dim, fe_degree, n_q_points_1d, n_vectors> phi(matrix_free);
+ * for (unsigned int cell = range.first; cell < range.second; ++cell)
+ *   {
+ *     phi.reinit(cell);
+ *     phi.gather_evaluate(src, EvaluationFlags::gradients);
+ *     for (const unsigned int q : phi.quadrature_point_indices())
+ *       phi.submit_gradient(phi.get_gradient(q), q);
+ *     phi.integrate_scatter(EvaluationFlags::gradients, dst);
+ *   }
+ * @endcode
+ *
+ * processes all blocks of @p src and @p dst in a single pass through the
+ * cells. The index data of each cell batch is loaded only once and then used
+ * for the entries of all blocks, interleaving the access to the different
+ * vectors, and the inverse Jacobian and the JxW value on a quadrature point
+ * are loaded once for the whole tensor returned by get_gradient(). This
+ * amortizes the memory transfer of the index and geometry data over the
+ * number of vectors. For block vectors with at most
+ * LinearAlgebra::distributed::BlockVector::communication_block_size blocks,
+ * the ghost exchange in MatrixFree::cell_loop() is started for all blocks
+ * together and overlapped with the computations.
+ *
  * An important property of FEEvaluation in multi-component systems is the
  * layout of multiple components in the get_value(), get_gradient(), or
  * get_dof_value() calls. In this case, instead of a scalar return field
@@ -2358,6 +2394,32 @@ private:
   void
   check_template_arguments(const unsigned int fe_no,
                            const unsigned int first_selected_component);
+
+  /**
+   * Computes the inverse Jacobians and JxW values of the given cell batch
+   * from the support points of the mapping, for cell batches where
+   * MatrixFree does not store this data, see
+   * MatrixFree::AdditionalData::compute_geometry_on_the_fly.
+   */
+  void
+  compute_geometry_on_the_fly(const unsigned int cell_index);
+
+  /**
+   * Storage for the inverse Jacobians computed by
+   * compute_geometry_on_the_fly().
+   */
+  AlignedVector<Tensor<2, dim, VectorizedArrayType>> jacobians_on_the_fly;
+
+  /**
+   * Storage for the JxW values computed by compute_geometry_on_the_fly().
+   */
+  AlignedVector<VectorizedArrayType> JxW_values_on_the_fly;
+
+  /**
+   * Scratch data for the evaluation of the mapping in
+   * compute_geometry_on_the_fly().
+   */
+  AlignedVector<VectorizedArrayType> geometry_scratch_data;
 };
 
 
@@ -2685,10 +2747,21 @@ public:
    * `integrate_val` and `integrate_grad` are used to enable/disable some of
    * values or gradients. As opposed to the other integrate() method, this
    * call stores the result of the testing in the given array `values_array`.
+   *
+   * If @p sum_into_values is set to true, the result of the testing is added
+   * to the content of `values_array` rather than overwriting it. Together
+   * with evaluate() from an array, this enables element-centric loops, e.g.,
+   * by MatrixFree::loop_cell_centric(), that read the degrees of freedom of a
+   * cell once into an array like FEEvaluation::begin_dof_values(), evaluate
+   * and integrate all faces of the cell from that array, and write the
+   * accumulated result back to the global vector once. The neighbor's data
+   * on the faces is then the only remaining access to the global vectors
+   * within the face integrals.
    */
   void
   integrate(const EvaluationFlags::EvaluationFlags integration_flag,
-            VectorizedArrayType *                  values_array);
+            VectorizedArrayType *                  values_array,
+            const bool                             sum_into_values = false);
 
   /**
    * @deprecated Please use the integrate() function with the EvaluationFlags argument.
@@ -7422,8 +7495,16 @@ FEEvaluation<dim,
 
   const unsigned int offsets =
     this->mapping_data->data_index_offsets[cell_index];
-  this->jacobian = &this->mapping_data->jacobians[0][offsets];
-  this->J_value  = &this->mapping_data->JxW_values[offsets];
+  const std::vector<unsigned int> &support_point_offsets =
+    this->matrix_free->get_mapping_info().mapping_support_point_offsets;
+  if (support_point_offsets.empty() == false &&
+      support_point_offsets[cell_index] != numbers::invalid_unsigned_int)
+    compute_geometry_on_the_fly(cell_index);
+  else
+    {
+      this->jacobian = &this->mapping_data->jacobians[0][offsets];
+      this->J_value  = &this->mapping_data->JxW_values[offsets];
+    }
   if (!this->mapping_data->jacobian_gradients[0].empty())
     {
       this->jacobian_gradients =
@@ -7465,6 +7546,62 @@ FEEvaluation<dim,
 
 
 
+template <int dim,
+          int fe_degree,
+          int n_q_points_1d,
+          int n_components_,
+          typename Number,
+          typename VectorizedArrayType>
+inline void
+FEEvaluation<dim,
+             fe_degree,
+             n_q_points_1d,
+             n_components_,
+             Number,
+             VectorizedArrayType>::
+  compute_geometry_on_the_fly(const unsigned int cell_index)
+{
+  const internal::MatrixFreeFunctions::
+    MappingInfo<dim, Number, VectorizedArrayType> &mapping_info =
+      this->matrix_free->get_mapping_info();
+  AssertIndexRange(this->quad_no, mapping_info.mapping_shape_info.size());
+  const internal::MatrixFreeFunctions::ShapeInfo<VectorizedArrayType>
+    &mapping_shape_info = mapping_info.mapping_shape_info[this->quad_no];
+  AssertDimension(mapping_shape_info.n_q_points, this->n_quadrature_points);
+
+  // interpolate the gradients of the support points of the mapping, with
+  // the components of the position in the outer and the reference
+  // directions in the inner index, to the quadrature points
+  FEEvaluationData<dim, VectorizedArrayType, false> geometry_eval(
+    mapping_shape_info);
+  geometry_eval.set_data_pointers(&geometry_scratch_data, dim);
+  internal::FEEvaluationFactory<dim, VectorizedArrayType>::evaluate(
+    dim,
+    EvaluationFlags::gradients,
+    mapping_info.mapping_support_points.data() +
+      mapping_info.mapping_support_point_offsets[cell_index],
+    geometry_eval);
+
+  const unsigned int n_q_points = this->n_quadrature_points;
+  jacobians_on_the_fly.resize_fast(n_q_points);
+  JxW_values_on_the_fly.resize_fast(n_q_points);
+  const VectorizedArrayType *gradients = geometry_eval.begin_gradients();
+  for (unsigned int q = 0; q < n_q_points; ++q)
+    {
+      Tensor<2, dim, VectorizedArrayType> jac;
+      for (unsigned int d = 0; d < dim; ++d)
+        for (unsigned int e = 0; e < dim; ++e)
+          jac[d][e] = gradients[q + (d * dim + e) * n_q_points];
+      JxW_values_on_the_fly[q] =
+        determinant(jac) * Number(this->quadrature_weights[q]);
+      jacobians_on_the_fly[q] = transpose(invert(jac));
+    }
+  this->jacobian = jacobians_on_the_fly.data();
+  this->J_value  = JxW_values_on_the_fly.data();
+}
+
+
+
 template <int dim,
           int fe_degree,
           int n_q_points_1d,
@@ -7482,6 +7619,10 @@ FEEvaluation<dim,
 {
   Assert(this->dof_info != nullptr, ExcNotInitialized());
   Assert(this->mapping_data != nullptr, ExcNotInitialized());
+  Assert(this->matrix_free->get_mapping_info()
+           .mapping_support_point_offsets.empty(),
+         ExcMessage("Geometry computed on the fly is not supported when "
+                    "initializing FEEvaluation with individual cells."));
 
   this->cell     = numbers::invalid_unsigned_int;
   this->cell_ids = cell_ids;
@@ -8857,7 +8998,8 @@ FEFaceEvaluation<dim,
                  Number,
                  VectorizedArrayType>::
   integrate(const EvaluationFlags::EvaluationFlags integration_flag,
-            VectorizedArrayType *                  values_array)
+            VectorizedArrayType *                  values_array,
+            const bool                             sum_into_values)
 {
   Assert((integration_flag &
           ~(EvaluationFlags::values | EvaluationFlags::gradients |
@@ -8908,10 +9050,15 @@ FEFaceEvaluation<dim,
       template run<fe_degree, n_q_points_1d>(n_components,
                                              integration_flag_actual,
                                              values_array,
-                                             *this);
+                                             *this,
+                                             sum_into_values);
   else
     internal::FEFaceEvaluationFactory<dim, VectorizedArrayType>::integrate(
-      n_components, integration_flag_actual, values_array, *this);
+      n_components,
+      integration_flag_actual,
+      values_array,
+      *this,
+      sum_into_values);
 }
 
 
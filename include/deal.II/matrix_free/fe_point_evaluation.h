@@ -470,6 +470,16 @@ public:
   reinit(const typename Triangulation<dim, spacedim>::cell_iterator &cell,
          const ArrayView<const Point<dim>> &unit_points);
 
+  /**
+   * Select the cell with index @p cell_index among the cells whose mapping
+   * information has been precomputed by
+   * NonMatching::MappingInfo::reinit_cells() on the MappingInfo object
+   * passed to the constructor. The unit points of that cell are used by the
+   * following calls to evaluate() and integrate().
+   */
+  void
+  reinit(const unsigned int cell_index);
+
   /**
    * This function interpolates the finite element solution, represented by
    * `solution_values`, on the cell and `unit_points` passed to reinit().
@@ -585,6 +595,16 @@ public:
   DerivativeForm<1, spacedim, dim>
   inverse_jacobian(const unsigned int point_index) const;
 
+  /**
+   * Return the quadrature weight multiplied by the volume element of the
+   * mapping at the given point index. Prerequisite: This class needs to be
+   * constructed with a NonMatching::MappingInfo object whose data has been
+   * computed by NonMatching::MappingInfo::reinit_cells() with
+   * `update_JxW_values`.
+   */
+  double
+  JxW(const unsigned int point_index) const;
+
   /**
    * Return the position in real coordinates of the given point index among
    * the points passed to reinit().
@@ -718,6 +738,13 @@ private:
    */
   std::vector<Point<dim>> unit_points;
 
+  /**
+   * The index of the cell in the MappingInfo object selected by
+   * reinit(const unsigned int), or zero for mapping information computed for
+   * a single cell.
+   */
+  unsigned int current_cell_index;
+
   /**
    * Bool indicating if fast path is chosen.
    */
@@ -740,6 +767,7 @@ FEPointEvaluation<n_components, dim, spacedim, Number>::FEPointEvaluation(
       std::make_unique<NonMatching::MappingInfo<dim, spacedim>>(mapping,
                                                                 update_flags))
   , mapping_info(mapping_info_on_the_fly.get())
+  , current_cell_index(0)
 {
   setup(first_selected_component);
 }
@@ -755,6 +783,7 @@ FEPointEvaluation<n_components, dim, spacedim, Number>::FEPointEvaluation(
   , fe(&fe)
   , update_flags(mapping_info.get_update_flags())
   , mapping_info(&mapping_info)
+  , current_cell_index(0)
 {
   setup(first_selected_component);
 }
@@ -865,6 +894,20 @@ FEPointEvaluation<n_components, dim, spacedim, Number>::reinit(
 
 
 
+template <int n_components, int dim, int spacedim, typename Number>
+void
+FEPointEvaluation<n_components, dim, spacedim, Number>::reinit(
+  const unsigned int cell_index)
+{
+  // this reinit is only allowed for precomputed mapping information
+  Assert(mapping_info_on_the_fly.get() == nullptr, ExcNotImplemented());
+  AssertIndexRange(cell_index, mapping_info->n_cells());
+
+  current_cell_index = cell_index;
+}
+
+
+
 template <int n_components, int dim, int spacedim, typename Number>
 void
 FEPointEvaluation<n_components, dim, spacedim, Number>::evaluate(
@@ -874,7 +917,7 @@ FEPointEvaluation<n_components, dim, spacedim, Number>::evaluate(
   const bool precomputed_mapping = mapping_info_on_the_fly.get() == nullptr;
   if (precomputed_mapping)
     {
-      unit_points = mapping_info->get_unit_points();
+      unit_points = mapping_info->get_unit_points(current_cell_index);
 
       if (update_flags & update_values)
         values.resize(unit_points.size(), numbers::signaling_nan<value_type>());
@@ -946,11 +989,11 @@ FEPointEvaluation<n_components, dim, spacedim, Number>::evaluate(
                     Number>::set_gradient(val_and_grad.second,
                                           j,
                                           unit_gradients[i + j]);
-                  gradients[i + j] =
-                    apply_transformation(mapping_info->get_mapping_data()
-                                           .inverse_jacobians[i + j]
-                                           .transpose(),
-                                         unit_gradients[i + j]);
+                  gradients[i + j] = apply_transformation(
+                    mapping_info->get_mapping_data(current_cell_index)
+                      .inverse_jacobians[i + j]
+                      .transpose(),
+                    unit_gradients[i + j]);
                 }
             }
         }
@@ -1022,7 +1065,7 @@ FEPointEvaluation<n_components, dim, spacedim, Number>::integrate(
   const bool precomputed_mapping = mapping_info_on_the_fly.get() == nullptr;
   if (precomputed_mapping)
     {
-      unit_points = mapping_info->get_unit_points();
+      unit_points = mapping_info->get_unit_points(current_cell_index);
 
       if (update_flags & update_values)
         values.resize(unit_points.size(), numbers::signaling_nan<value_type>());
@@ -1087,7 +1130,8 @@ FEPointEvaluation<n_components, dim, spacedim, Number>::integrate(
             for (unsigned int j = 0; j < n_lanes && i + j < n_points; ++j)
               {
                 gradients[i + j] = apply_transformation(
-                  mapping_info->get_mapping_data().inverse_jacobians[i + j],
+                  mapping_info->get_mapping_data(current_cell_index)
+                    .inverse_jacobians[i + j],
                   gradients[i + j]);
                 internal::FEPointEvaluation::
                   EvaluatorTypeTraits<dim, n_components, Number>::get_gradient(
@@ -1250,9 +1294,10 @@ inline DerivativeForm<1, dim, spacedim>
 FEPointEvaluation<n_components, dim, spacedim, Number>::jacobian(
   const unsigned int point_index) const
 {
-  AssertIndexRange(point_index,
-                   mapping_info->get_mapping_data().jacobians.size());
-  return mapping_info->get_mapping_data().jacobians[point_index];
+  const auto &mapping_data =
+    mapping_info->get_mapping_data(current_cell_index);
+  AssertIndexRange(point_index, mapping_data.jacobians.size());
+  return mapping_data.jacobians[point_index];
 }
 
 
@@ -1262,9 +1307,23 @@ inline DerivativeForm<1, spacedim, dim>
 FEPointEvaluation<n_components, dim, spacedim, Number>::inverse_jacobian(
   const unsigned int point_index) const
 {
-  AssertIndexRange(point_index,
-                   mapping_info->get_mapping_data().inverse_jacobians.size());
-  return mapping_info->get_mapping_data().inverse_jacobians[point_index];
+  const auto &mapping_data =
+    mapping_info->get_mapping_data(current_cell_index);
+  AssertIndexRange(point_index, mapping_data.inverse_jacobians.size());
+  return mapping_data.inverse_jacobians[point_index];
+}
+
+
+
+template <int n_components, int dim, int spacedim, typename Number>
+inline double
+FEPointEvaluation<n_components, dim, spacedim, Number>::JxW(
+  const unsigned int point_index) const
+{
+  const std::vector<double> &JxW_values =
+    mapping_info->get_JxW_values(current_cell_index);
+  AssertIndexRange(point_index, JxW_values.size());
+  return JxW_values[point_index];
 }
 
 
@@ -1274,9 +1333,10 @@ inline Point<spacedim>
 FEPointEvaluation<n_components, dim, spacedim, Number>::real_point(
   const unsigned int point_index) const
 {
-  AssertIndexRange(point_index,
-                   mapping_info->get_mapping_data().quadrature_points.size());
-  return mapping_info->get_mapping_data().quadrature_points[point_index];
+  const auto &mapping_data =
+    mapping_info->get_mapping_data(current_cell_index);
+  AssertIndexRange(point_index, mapping_data.quadrature_points.size());
+  return mapping_data.quadrature_points[point_index];
 }
 
 
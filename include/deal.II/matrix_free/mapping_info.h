@@ -34,6 +34,7 @@
 
 #include <deal.II/matrix_free/face_info.h>
 #include <deal.II/matrix_free/mapping_info_storage.h>
+#include <deal.II/matrix_free/shape_info.h>
 
 #include <memory>
 
@@ -74,7 +75,8 @@ namespace internal
         const UpdateFlags update_flags_boundary_faces,
         const UpdateFlags update_flags_inner_faces,
         const UpdateFlags update_flags_faces_by_cells,
-        const bool        piola_transform);
+        const bool        piola_transform,
+        const bool        compute_geometry_on_the_fly = false);
 
       /**
        * Update the information in the given cells and faces that is the
@@ -90,6 +92,17 @@ namespace internal
         const std::vector<unsigned int> &active_fe_index,
         const std::shared_ptr<dealii::hp::MappingCollection<dim>> &mapping);
 
+      /**
+       * Fill the data fields of this class from another object with a
+       * possibly different number type (e.g. a lower precision), converting
+       * all entries. The two vectorized array types must have the same
+       * number of lanes, as the cell batches are shared.
+       */
+      template <typename Number2, typename VectorizedArrayType2>
+      void
+      copy_from(
+        const MappingInfo<dim, Number2, VectorizedArrayType2> &other);
+
       /**
        * Return the type of a given cell as detected during initialization.
        */
@@ -201,6 +214,35 @@ namespace internal
        */
       std::vector<std::vector<dealii::ReferenceCell>> reference_cell_types;
 
+      /**
+       * Stores whether the Jacobians and JxW values on cells of type
+       * GeometryType::general are computed on the fly from the support
+       * points of a MappingQ rather than being stored for all quadrature
+       * points, see MatrixFree::AdditionalData::compute_geometry_on_the_fly.
+       */
+      bool compute_geometry_on_the_fly;
+
+      /**
+       * The support points of the mapping on the cell batches whose geometry
+       * is computed on the fly, with the points of all components in
+       * lexicographic ordering stored contiguously for each cell batch,
+       * starting at the index given by @p mapping_support_point_offsets.
+       */
+      AlignedVector<VectorizedArrayType> mapping_support_points;
+
+      /**
+       * The offsets into @p mapping_support_points for each cell batch, or
+       * numbers::invalid_unsigned_int for cell batches with data stored in
+       * cell_data. Empty unless @p compute_geometry_on_the_fly is set.
+       */
+      std::vector<unsigned int> mapping_support_point_offsets;
+
+      /**
+       * The interpolation matrices from the support points of the mapping
+       * to the quadrature points for each quadrature formula in cell_data.
+       */
+      std::vector<ShapeInfo<VectorizedArrayType>> mapping_shape_info;
+
       /**
        * Internal function to compute the geometry for the case the mapping is
        * a MappingQ and a single quadrature formula per slot (non-hp-case) is
@@ -309,6 +351,48 @@ namespace internal
       return cell_type[cell_no];
     }
 
+
+
+    template <int dim, typename Number, typename VectorizedArrayType>
+    template <typename Number2, typename VectorizedArrayType2>
+    inline void
+    MappingInfo<dim, Number, VectorizedArrayType>::copy_from(
+      const MappingInfo<dim, Number2, VectorizedArrayType2> &other)
+    {
+      static_assert(VectorizedArrayType::size() ==
+                      VectorizedArrayType2::size(),
+                    "The number of lanes must coincide");
+
+      update_flags_cells          = other.update_flags_cells;
+      update_flags_boundary_faces = other.update_flags_boundary_faces;
+      update_flags_inner_faces    = other.update_flags_inner_faces;
+      update_flags_faces_by_cells = other.update_flags_faces_by_cells;
+      cell_type                   = other.cell_type;
+      face_type                   = other.face_type;
+      faces_by_cells_type         = other.faces_by_cells_type;
+
+      cell_data.resize(other.cell_data.size());
+      for (unsigned int i = 0; i < cell_data.size(); ++i)
+        cell_data[i].copy_from(other.cell_data[i]);
+      face_data.resize(other.face_data.size());
+      for (unsigned int i = 0; i < face_data.size(); ++i)
+        face_data[i].copy_from(other.face_data[i]);
+      face_data_by_cells.resize(other.face_data_by_cells.size());
+      for (unsigned int i = 0; i < face_data_by_cells.size(); ++i)
+        face_data_by_cells[i].copy_from(other.face_data_by_cells[i]);
+
+      mapping_collection   = other.mapping_collection;
+      mapping              = other.mapping;
+      reference_cell_types = other.reference_cell_types;
+
+      compute_geometry_on_the_fly = other.compute_geometry_on_the_fly;
+      convert_value(other.mapping_support_points, mapping_support_points);
+      mapping_support_point_offsets = other.mapping_support_point_offsets;
+      mapping_shape_info.resize(other.mapping_shape_info.size());
+      for (unsigned int i = 0; i < mapping_shape_info.size(); ++i)
+        mapping_shape_info[i].copy_from(other.mapping_shape_info[i]);
+    }
+
   } // end of namespace MatrixFreeFunctions
 } // end of namespace internal
 
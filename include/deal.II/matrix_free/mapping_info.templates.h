@@ -55,6 +55,11 @@ namespace internal
       face_type.clear();
       mapping_collection = nullptr;
       mapping            = nullptr;
+
+      compute_geometry_on_the_fly = false;
+      mapping_support_points.clear();
+      mapping_support_point_offsets.clear();
+      mapping_shape_info.clear();
     }
 
 
@@ -72,11 +77,13 @@ namespace internal
       const UpdateFlags update_flags_boundary_faces,
       const UpdateFlags update_flags_inner_faces,
       const UpdateFlags update_flags_faces_by_cells,
-      const bool        piola_transform)
+      const bool        piola_transform,
+      const bool        compute_geometry_on_the_fly)
     {
       clear();
-      this->mapping_collection = mapping;
-      this->mapping            = &mapping->operator[](0);
+      this->mapping_collection          = mapping;
+      this->mapping                     = &mapping->operator[](0);
+      this->compute_geometry_on_the_fly = compute_geometry_on_the_fly;
 
       cell_data.resize(quad.size());
       face_data.resize(quad.size());
@@ -191,11 +198,20 @@ namespace internal
         compute_mapping_q(tria, cells, face_info);
       else
         {
-          // Could call these functions in parallel, but not useful because
-          // the work inside is nicely split up already
-          initialize_cells(tria, cells, active_fe_index, *mapping);
-          initialize_faces(
-            tria, cells, face_info.faces, active_fe_index, *mapping);
+          // The data on cells and faces is filled into disjoint data fields,
+          // so compute the two concurrently. The work inside each function
+          // is split up among the threads as well, but the unequal sizes of
+          // the ranges of cells and faces leave threads idle towards the end
+          // of each function. The faces by cells need the cell types.
+          Threads::TaskGroup<> tasks;
+          tasks += Threads::new_task([&]() {
+            initialize_cells(tria, cells, active_fe_index, *mapping);
+          });
+          tasks += Threads::new_task([&]() {
+            initialize_faces(
+              tria, cells, face_info.faces, active_fe_index, *mapping);
+          });
+          tasks.join_all();
           initialize_faces_by_cells(tria, cells, face_info, *mapping);
         }
     }
@@ -220,6 +236,9 @@ namespace internal
         data.clear_data_fields();
       for (auto &data : face_data_by_cells)
         data.clear_data_fields();
+      mapping_support_points.clear();
+      mapping_support_point_offsets.clear();
+      mapping_shape_info.clear();
 
       this->mapping_collection = mapping;
       this->mapping            = &mapping->operator[](0);
@@ -229,11 +248,20 @@ namespace internal
         compute_mapping_q(tria, cells, face_info);
       else
         {
-          // Could call these functions in parallel, but not useful because
-          // the work inside is nicely split up already
-          initialize_cells(tria, cells, active_fe_index, *mapping);
-          initialize_faces(
-            tria, cells, face_info.faces, active_fe_index, *mapping);
+          // The data on cells and faces is filled into disjoint data fields,
+          // so compute the two concurrently. The work inside each function
+          // is split up among the threads as well, but the unequal sizes of
+          // the ranges of cells and faces leave threads idle towards the end
+          // of each function. The faces by cells need the cell types.
+          Threads::TaskGroup<> tasks;
+          tasks += Threads::new_task([&]() {
+            initialize_cells(tria, cells, active_fe_index, *mapping);
+          });
+          tasks += Threads::new_task([&]() {
+            initialize_faces(
+              tria, cells, face_info.faces, active_fe_index, *mapping);
+          });
+          tasks.join_all();
           initialize_faces_by_cells(tria, cells, face_info, *mapping);
         }
     }
@@ -2735,6 +2763,57 @@ namespace internal
                               preliminary_cell_type.data() + cell + n_lanes);
         }
 
+      // step 3b: in case the geometry on general cells is to be computed on
+      // the fly, keep the support points of the mapping for those cells
+      // (translated cells with the same shape can share the data, as the
+      // Jacobians only depend on the differences between the points) and
+      // skip them when filling the Jacobians and JxW values below. We
+      // cannot represent derivatives of the Jacobians that way.
+      const bool        geometry_on_the_fly =
+        compute_geometry_on_the_fly &&
+        (update_flags_cells & update_jacobian_grads) == 0;
+      std::vector<bool> store_cell_data(process_cell);
+      mapping_support_points.clear();
+      mapping_support_point_offsets.clear();
+      mapping_shape_info.clear();
+      if (geometry_on_the_fly)
+        {
+          mapping_support_point_offsets.resize(cell_type.size());
+          unsigned int n_batches_on_the_fly = 0;
+          for (unsigned int cell = 0; cell < cell_type.size(); ++cell)
+            if (cell_type[cell] != general)
+              mapping_support_point_offsets[cell] =
+                numbers::invalid_unsigned_int;
+            else if (process_cell[cell] == false)
+              mapping_support_point_offsets[cell] =
+                mapping_support_point_offsets[cell_data_index_vect[cell]];
+            else
+              mapping_support_point_offsets[cell] =
+                (n_batches_on_the_fly++) * n_mapping_points * dim;
+
+          mapping_support_points.resize_fast(n_batches_on_the_fly *
+                                             n_mapping_points * dim);
+          for (unsigned int cell = 0; cell < cell_type.size(); ++cell)
+            if (cell_type[cell] == general)
+              {
+                store_cell_data[cell] = false;
+                if (process_cell[cell])
+                  for (unsigned int i = 0; i < n_mapping_points * dim; ++i)
+                    for (unsigned int v = 0; v < n_lanes; ++v)
+                      mapping_support_points
+                        [mapping_support_point_offsets[cell] + i][v] =
+                          plain_quadrature_points[(cell * n_lanes + v) *
+                                                    n_mapping_points * dim +
+                                                  i];
+              }
+
+          FE_DGQ<dim> fe_geometry(mapping_degree);
+          mapping_shape_info.resize(cell_data.size());
+          for (unsigned int my_q = 0; my_q < cell_data.size(); ++my_q)
+            mapping_shape_info[my_q].reinit(
+              cell_data[my_q].descriptor[0].quadrature, fe_geometry);
+        }
+
       // step 4: compute the data on cells from the cached quadrature
       // points, filling up all SIMD lanes as appropriate
       for (unsigned int my_q = 0; my_q < cell_data.size(); ++my_q)
@@ -2749,6 +2828,11 @@ namespace internal
           my_data.data_index_offsets.resize(cell_type.size());
           for (unsigned int cell = 0; cell < cell_type.size(); ++cell)
             {
+              if (geometry_on_the_fly && cell_type[cell] == general)
+                {
+                  my_data.data_index_offsets[cell] = max_size;
+                  continue;
+                }
               if (process_cell[cell] == false)
                 my_data.data_index_offsets[cell] =
                   my_data.data_index_offsets[cell_data_index_vect[cell]];
@@ -2796,7 +2880,7 @@ namespace internal
                 begin,
                 end,
                 cell_type,
-                process_cell,
+                store_cell_data,
                 update_flags_cells,
                 plain_quadrature_points,
                 shape_infos[my_q],
@@ -3322,6 +3406,9 @@ namespace internal
       memory += MemoryConsumption::memory_consumption(face_data);
       memory += cell_type.capacity() * sizeof(GeometryType);
       memory += face_type.capacity() * sizeof(GeometryType);
+      memory += MemoryConsumption::memory_consumption(mapping_support_points);
+      memory +=
+        MemoryConsumption::memory_consumption(mapping_support_point_offsets);
       memory += sizeof(*this);
       return memory;
     }
@@ -30,6 +30,8 @@
 
 #include <deal.II/hp/q_collection.h>
 
+#include <deal.II/matrix_free/util.h>
+
 #include <memory>
 
 
@@ -313,6 +315,16 @@ namespace internal
       void
       clear_data_fields();
 
+      /**
+       * Fill the data fields of this class from another object with a
+       * possibly different number type (e.g. a lower precision), converting
+       * all entries. The two number types must have the same number of
+       * vectorization lanes, as the cell batches are shared.
+       */
+      template <typename Number2>
+      void
+      copy_from(const MappingInfoStorage<structdim, spacedim, Number2> &other);
+
       /**
        * Returns the quadrature index for a given number of quadrature
        * points. If not in hp-mode or if the index is not found, this
@@ -364,6 +376,43 @@ namespace internal
       return 0;
     }
 
+
+
+    template <int structdim, int spacedim, typename Number>
+    template <typename Number2>
+    inline void
+    MappingInfoStorage<structdim, spacedim, Number>::copy_from(
+      const MappingInfoStorage<structdim, spacedim, Number2> &other)
+    {
+      descriptor.resize(other.descriptor.size());
+      for (unsigned int i = 0; i < descriptor.size(); ++i)
+        {
+          descriptor[i].n_q_points    = other.descriptor[i].n_q_points;
+          descriptor[i].quadrature_1d = other.descriptor[i].quadrature_1d;
+          descriptor[i].quadrature    = other.descriptor[i].quadrature;
+          for (int d = 0; d < structdim; ++d)
+            convert_value(other.descriptor[i].tensor_quadrature_weights[d],
+                          descriptor[i].tensor_quadrature_weights[d]);
+          convert_value(other.descriptor[i].quadrature_weights,
+                        descriptor[i].quadrature_weights);
+        }
+      q_collection       = other.q_collection;
+      data_index_offsets = other.data_index_offsets;
+      convert_value(other.JxW_values, JxW_values);
+      convert_value(other.normal_vectors, normal_vectors);
+      for (unsigned int i = 0; i < 2; ++i)
+        {
+          convert_value(other.jacobians[i], jacobians[i]);
+          convert_value(other.jacobian_gradients[i], jacobian_gradients[i]);
+          convert_value(other.jacobian_gradients_non_inverse[i],
+                        jacobian_gradients_non_inverse[i]);
+          convert_value(other.normals_times_jacobians[i],
+                        normals_times_jacobians[i]);
+        }
+      quadrature_point_offsets = other.quadrature_point_offsets;
+      convert_value(other.quadrature_points, quadrature_points);
+    }
+
   } // end of namespace MatrixFreeFunctions
 } // end of namespace internal
 
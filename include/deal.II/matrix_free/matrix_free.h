@@ -209,6 +209,30 @@ public:
       color = internal::MatrixFreeFunctions::TaskInfo::color
     };
 
+    /**
+     * Collects the options for the order of the cell batches within the
+     * partitions of the loops, see @p cell_batch_ordering.
+     */
+    enum CellBatchOrdering
+    {
+      /**
+       * Keep the order of the cells given by the triangulation, i.e., form
+       * the batches from cells with consecutive indices.
+       */
+      default_ordering =
+        internal::MatrixFreeFunctions::TaskInfo::default_ordering,
+      /**
+       * Order the cells along a Hilbert curve through the cell centers.
+       */
+      hilbert_curve = internal::MatrixFreeFunctions::TaskInfo::hilbert_curve,
+      /**
+       * Order the cells by the reverse Cuthill-McKee algorithm applied to the
+       * graph of cells sharing a vertex.
+       */
+      reverse_cuthill_mckee =
+        internal::MatrixFreeFunctions::TaskInfo::reverse_cuthill_mckee
+    };
+
     /**
      * Constructor for AdditionalData.
      */
@@ -243,6 +267,9 @@ public:
       , cell_vectorization_categories_strict(
           cell_vectorization_categories_strict)
       , allow_ghosted_vectors_in_loops(allow_ghosted_vectors_in_loops)
+      , compute_geometry_on_the_fly(false)
+      , overlap_communication_per_process(false)
+      , cell_batch_ordering(default_ordering)
       , communicator_sm(MPI_COMM_SELF)
     {}
 
@@ -269,6 +296,10 @@ public:
       , cell_vectorization_categories_strict(
           other.cell_vectorization_categories_strict)
       , allow_ghosted_vectors_in_loops(other.allow_ghosted_vectors_in_loops)
+      , compute_geometry_on_the_fly(other.compute_geometry_on_the_fly)
+      , overlap_communication_per_process(
+          other.overlap_communication_per_process)
+      , cell_batch_ordering(other.cell_batch_ordering)
       , communicator_sm(other.communicator_sm)
     {}
 
@@ -297,7 +328,11 @@ public:
       cell_vectorization_categories_strict =
         other.cell_vectorization_categories_strict;
       allow_ghosted_vectors_in_loops = other.allow_ghosted_vectors_in_loops;
-      communicator_sm                = other.communicator_sm;
+      compute_geometry_on_the_fly    = other.compute_geometry_on_the_fly;
+      overlap_communication_per_process =
+        other.overlap_communication_per_process;
+      cell_batch_ordering = other.cell_batch_ordering;
+      communicator_sm     = other.communicator_sm;
 
       return *this;
     }
@@ -539,8 +574,95 @@ public:
      */
     bool allow_ghosted_vectors_in_loops;
 
+    /**
+     * Option to reduce the memory consumption of the geometry data on
+     * curved cells. By default, MatrixFree stores the inverse Jacobian and
+     * the JxW value on each quadrature point of all cells with a general
+     * (non-affine) geometry. If this option is enabled and the mapping is a
+     * MappingQ (without hp-adaptivity), only the support points of the
+     * mapping are stored for those cells, and FEEvaluation::reinit()
+     * computes the Jacobians by sum factorization from these points. For
+     * meshes with curved cells and higher polynomial degrees, this trades
+     * memory transfer for arithmetic operations, which is favorable in the
+     * memory-bound regime typical of matrix-free operator evaluation.
+     *
+     * The geometry data on faces, the quadrature points, and the data on
+     * affine or Cartesian cells are not affected. If derivatives of the
+     * Jacobians are requested through @p update_jacobian_grads or
+     * update_hessians, this option is ignored. Only FEEvaluation::reinit()
+     * with a cell batch index supports this representation.
+     *
+     * The default is false.
+     */
+    bool compute_geometry_on_the_fly;
+
+    /**
+     * Option to refine the overlap of communication and computation in
+     * MatrixFree::loop() and MatrixFree::cell_loop(). By default, the loops
+     * wait for the ghost data of all neighboring processes before working on
+     * any of the cells and faces that depend on ghost data. If this option
+     * is enabled, the cells at processor boundaries are grouped by the
+     * processes they exchange data with, and each group is processed as soon
+     * as the data of the respective processes has arrived, testing the
+     * pending messages without blocking in between. This is beneficial for
+     * face-based loops, e.g. of discontinuous Galerkin methods, where the
+     * latency of individual neighbors varies.
+     *
+     * This option only has an effect if @p tasks_parallel_scheme is set to
+     * @p none, if @p overlap_communication_computation is enabled, if more
+     * than one MPI process is used, and if @p communicator_sm is
+     * MPI_COMM_SELF. Otherwise, it is ignored. The default is false.
+     */
+    bool overlap_communication_per_process;
+
+    /**
+     * Option to control the order of the cell batches in the loops. By
+     * default, the cell batches are formed from cells with consecutive
+     * indices in the triangulation and arranged in that order, which gives
+     * good locality for meshes obtained by global or adaptive refinement of
+     * a coarse mesh with few cells. For meshes with many coarse cells in an
+     * unstructured order, e.g. imported from mesh generators, consecutive
+     * batches might touch unrelated vector entries. In that case, ordering
+     * the cells along a Hilbert space-filling curve through the cell centers
+     * (@p hilbert_curve) or by the reverse Cuthill-McKee algorithm on the
+     * graph of cells sharing a vertex (@p reverse_cuthill_mckee) lets
+     * subsequent batches access mostly the same vector entries, which are
+     * then still in cache.
+     *
+     * The reordering is applied within each partition and category, i.e.,
+     * it respects the grouping by @p cell_vectorization_category, the
+     * grouping of cells with the same parent into batches, and the
+     * separation of cells with MPI communication. It also complements a
+     * numbering of the unknowns by DoFRenumbering::matrix_free_data_locality(),
+     * which should be computed with the same AdditionalData.
+     *
+     * This option only has an effect if @p tasks_parallel_scheme is set to
+     * @p none. The default is @p default_ordering.
+     */
+    CellBatchOrdering cell_batch_ordering;
+
     /**
      * Shared-memory MPI communicator. Default: MPI_COMM_SELF.
+     *
+     * If set to a communicator that groups the processes on the same compute
+     * node, e.g. obtained by
+     * @code
+     *   MPI_Comm comm_sm;
+     *   MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, rank,
+     *                       MPI_INFO_NULL, &comm_sm);
+     * @endcode
+     * the vectors created by initialize_dof_vector() allocate their memory
+     * with `MPI_Win_allocate_shared`, and the data exchange in the loops of
+     * this class reads the ghost values owned by processes on the same node
+     * directly from their memory. Only the ghost values owned by processes on
+     * other nodes are sent by point-to-point messages. For discontinuous
+     * elements with contiguous indices on all cells, the cell and face
+     * integrals even access the entries of the neighbors in place without
+     * copying them to the ghost range. All vectors passed to the loops must
+     * be set up with initialize_dof_vector() or
+     * LinearAlgebra::distributed::Vector::reinit() with the same
+     * communicator. In this mode, @p overlap_communication_per_process is
+     * ignored.
      */
     MPI_Comm communicator_sm;
   };
@@ -637,6 +759,37 @@ public:
   copy_from(
     const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free_base);
 
+  /**
+   * Copy function that creates a deep copy of all data structures of a
+   * MatrixFree object set up with another number type, converting the
+   * geometry data and shape function data to the number type of the present
+   * object. The typical use case is a preconditioner working in single
+   * precision, e.g., the smoother of a mixed-precision multigrid method,
+   * derived from an object in double precision:
+   * @code
+   * MatrixFree<dim, double> matrix_free;
+   * matrix_free.reinit(mapping, dof_handler, constraints, quadrature, data);
+   *
+   * MatrixFree<dim, float, VectorizedArray<float,
+   *                                        VectorizedArray<double>::size()>>
+   *   matrix_free_float;
+   * matrix_free_float.copy_from(matrix_free);
+   * @endcode
+   * Compared to a second call to reinit(), this function neither needs to
+   * evaluate the mapping nor the finite element, nor does it redo the
+   * analysis of the degrees of freedom and the partitioning of cells.
+   *
+   * Since the partitioning into cell and face batches is taken from the
+   * given object without modification, @p VectorizedArrayType2 must have
+   * the same number of lanes as @p VectorizedArrayType. Furthermore, the
+   * AffineConstraints objects are not available in the new object as their
+   * number type does not match the present one.
+   */
+  template <typename Number2, typename VectorizedArrayType2>
+  void
+  copy_from(
+    const MatrixFree<dim, Number2, VectorizedArrayType2> &matrix_free_base);
+
   /**
    * Refreshes the geometry data stored in the MappingInfo fields when the
    * underlying geometry has changed (e.g. by a mapping that can deform
@@ -645,6 +798,18 @@ public:
    * same. Compared to reinit(), this operation only has to re-generate the
    * geometry arrays and can thus be significantly cheaper (depending on the
    * cost to evaluate the geometry).
+   *
+   * The data on cells, on faces, and on the faces by cells is recomputed
+   * with the update flags and quadrature formulas given to reinit(), using
+   * multiple threads, and the cell and face types (Cartesian, affine,
+   * general) are re-detected. The DoFInfo, ShapeInfo, and TaskInfo data
+   * structures are kept. This function also works for MatrixFree objects
+   * set up on a multigrid level if the mapping can describe the level
+   * cells; see MatrixFreeTools::update_mapping() for updating all levels of
+   * a multigrid hierarchy at once.
+   *
+   * @pre reinit() must have been called with
+   * AdditionalData::initialize_mapping set to true.
    */
   void
   update_mapping(const Mapping<dim> &mapping);
@@ -2076,6 +2241,27 @@ public:
   void
   print_memory_consumption(StreamType &out) const;
 
+  /**
+   * Return the wall times in seconds spent in the phases of the last call
+   * to reinit() or update_mapping() on the current MPI process, in the
+   * order of execution. The phases set up the shape function data, the
+   * indices of the unknowns together with the partitioning of the cells,
+   * the faces with the compressed index representation, and the geometry
+   * data, where the phases skipped due to AdditionalData::initialize_indices
+   * or AdditionalData::initialize_mapping are omitted.
+   */
+  const std::vector<std::pair<std::string, double>> &
+  get_setup_timings() const;
+
+  /**
+   * Print the minimum, average, and maximum over all MPI processes of the
+   * times returned by get_setup_timings() to the given output stream. This
+   * function needs to be called on all MPI processes.
+   */
+  template <typename StreamType>
+  void
+  print_setup_timings(StreamType &out) const;
+
   /**
    * Prints a summary of this class to the given output stream. It is focused
    * on the indices, and does not print all the data stored.
@@ -2277,9 +2463,14 @@ private:
     mapping_info;
 
   /**
-   * Contains shape value information on the unit cell.
+   * Contains shape value information on the unit cell. The objects are
+   * shared with all other MatrixFree objects that use the same element and
+   * quadrature formula, e.g., on the levels of a multigrid hierarchy, see
+   * internal::MatrixFreeFunctions::ShapeInfo::get_shared().
    */
-  Table<4, internal::MatrixFreeFunctions::ShapeInfo<VectorizedArrayType>>
+  Table<4,
+        std::shared_ptr<
+          const internal::MatrixFreeFunctions::ShapeInfo<VectorizedArrayType>>>
     shape_info;
 
   /**
@@ -2328,6 +2519,12 @@ private:
    */
   bool mapping_is_initialized;
 
+  /**
+   * The wall times of the phases of the last setup, see
+   * get_setup_timings().
+   */
+  std::vector<std::pair<std::string, double>> setup_timings;
+
   /**
    * Scratchpad memory for use in evaluation. We allow more than one
    * evaluation object to attach to this field (this, the outer
@@ -2350,6 +2547,9 @@ private:
    * Stored the level of the mesh to be worked on.
    */
   unsigned int mg_level;
+
+  template <int, typename, typename>
+  friend class MatrixFree;
 };
 
 
@@ -2360,6 +2560,47 @@ private:
 
 
 
+template <int dim, typename Number, typename VectorizedArrayType>
+template <typename Number2, typename VectorizedArrayType2>
+inline void
+MatrixFree<dim, Number, VectorizedArrayType>::copy_from(
+  const MatrixFree<dim, Number2, VectorizedArrayType2> &v)
+{
+  static_assert(VectorizedArrayType::size() == VectorizedArrayType2::size(),
+                "The number of lanes must coincide");
+
+  clear();
+  dof_handlers = v.dof_handlers;
+  dof_info     = v.dof_info;
+  constraint_pool_data.assign(v.constraint_pool_data.begin(),
+                              v.constraint_pool_data.end());
+  constraint_pool_row_index = v.constraint_pool_row_index;
+  mapping_info.copy_from(v.mapping_info);
+  shape_info.reinit(v.shape_info.size());
+  for (unsigned int c = 0; c < shape_info.size(0); ++c)
+    for (unsigned int nq = 0; nq < shape_info.size(1); ++nq)
+      for (unsigned int fe_no = 0; fe_no < shape_info.size(2); ++fe_no)
+        for (unsigned int q_no = 0; q_no < shape_info.size(3); ++q_no)
+          if (v.shape_info(c, nq, fe_no, q_no) != nullptr)
+            {
+              using ShapeInfoType =
+                internal::MatrixFreeFunctions::ShapeInfo<VectorizedArrayType>;
+              auto converted_shape_info = std::make_shared<ShapeInfoType>();
+              converted_shape_info->copy_from(
+                *v.shape_info(c, nq, fe_no, q_no));
+              shape_info(c, nq, fe_no, q_no) = converted_shape_info;
+            }
+  cell_level_index           = v.cell_level_index;
+  cell_level_index_end_local = v.cell_level_index_end_local;
+  task_info                  = v.task_info;
+  face_info                  = v.face_info;
+  indices_are_initialized    = v.indices_are_initialized;
+  mapping_is_initialized     = v.mapping_is_initialized;
+  mg_level                   = v.mg_level;
+}
+
+
+
 template <int dim, typename Number, typename VectorizedArrayType>
 template <typename T>
 inline void
@@ -2857,7 +3098,10 @@ MatrixFree<dim, Number, VectorizedArrayType>::get_shape_info(
   AssertIndexRange(index_quad, shape_info.size(1));
   AssertIndexRange(active_fe_index, shape_info.size(2));
   AssertIndexRange(active_quad_index, shape_info.size(3));
-  return shape_info(ind, index_quad, active_fe_index, active_quad_index);
+  Assert(shape_info(ind, index_quad, active_fe_index, active_quad_index) !=
+           nullptr,
+         ExcNotInitialized());
+  return *shape_info(ind, index_quad, active_fe_index, active_quad_index);
 }
 
 
@@ -3025,6 +3269,15 @@ MatrixFree<dim, Number, VectorizedArrayType>::get_mg_level() const
 
 
 
+template <int dim, typename Number, typename VectorizedArrayType>
+inline const std::vector<std::pair<std::string, double>> &
+MatrixFree<dim, Number, VectorizedArrayType>::get_setup_timings() const
+{
+  return setup_timings;
+}
+
+
+
 template <int dim, typename Number, typename VectorizedArrayType>
 AlignedVector<VectorizedArrayType> *
 MatrixFree<dim, Number, VectorizedArrayType>::acquire_scratch_data() const
@@ -3368,6 +3621,31 @@ namespace internal
 
 
 
+    /**
+     * Check that a vector is allocated on the shared-memory communicator of
+     * the MatrixFree object, which is needed to read the entries owned by
+     * other processes on the same node directly from their memory.
+     */
+    template <typename VectorType>
+    void
+    check_shared_memory_data(const VectorType &vec) const
+    {
+      (void)vec;
+#  ifdef DEAL_II_WITH_MPI
+      Assert(matrix_free.get_task_info().communicator_sm == MPI_COMM_SELF ||
+               vec.shared_vector_data().size() ==
+                 Utilities::MPI::n_mpi_processes(
+                   matrix_free.get_task_info().communicator_sm),
+             ExcMessage(
+               "The MatrixFree object has been set up with a shared-memory "
+               "communicator in AdditionalData::communicator_sm, but the "
+               "vector has not been allocated on this communicator. Use "
+               "MatrixFree::initialize_dof_vector() to set up the vector."));
+#  endif
+    }
+
+
+
     /**
      * Start update_ghost_value for serial vectors
      */
@@ -3473,6 +3751,8 @@ namespace internal
               part.n_import_sm_procs() == 0)
             return;
 
+          check_shared_memory_data(vec);
+
           tmp_data[component_in_block_vector] =
             matrix_free.acquire_scratch_data_non_threadsafe();
           tmp_data[component_in_block_vector]->resize_fast(
@@ -3583,6 +3863,98 @@ namespace internal
 
 
 
+    /**
+     * Test for the arrival of the ghost values sent by the process with the
+     * given rank for vectors that do not support the split into _start()
+     * and finish() stages and serial vectors
+     */
+    template <typename VectorType,
+              std::enable_if_t<!has_update_ghost_values_start<VectorType>,
+                               VectorType> * = nullptr>
+    bool
+    update_ghost_values_test(const unsigned int /*component_in_block_vector*/,
+                             const unsigned int /*rank*/,
+                             const VectorType & /*vec*/)
+    {
+      return true;
+    }
+
+
+
+    /**
+     * Test for the arrival of the ghost values sent by the process with the
+     * given rank for vectors that _do_ support the split into _start() and
+     * finish() stages, but don't support exchange on a subset of DoFs. As
+     * these vectors cannot test individual processes, the complete exchange
+     * is finished here.
+     */
+    template <typename VectorType,
+              std::enable_if_t<has_update_ghost_values_start<VectorType> &&
+                                 !has_exchange_on_subset<VectorType>,
+                               VectorType> * = nullptr>
+    bool
+    update_ghost_values_test(const unsigned int component_in_block_vector,
+                             const unsigned int /*rank*/,
+                             const VectorType &vec)
+    {
+      (void)component_in_block_vector;
+      vec.update_ghost_values_finish();
+      return true;
+    }
+
+
+
+    /**
+     * Test for the arrival of the ghost values sent by the process with the
+     * given rank for vectors that _do_ support the split into _start() and
+     * finish() stages and also support exchange on a subset of DoFs,
+     * i.e. LinearAlgebra::distributed::Vector
+     */
+    template <typename VectorType,
+              std::enable_if_t<has_update_ghost_values_start<VectorType> &&
+                                 has_exchange_on_subset<VectorType>,
+                               VectorType> * = nullptr>
+    bool
+    update_ghost_values_test(const unsigned int component_in_block_vector,
+                             const unsigned int rank,
+                             const VectorType & vec)
+    {
+      static_assert(
+        std::is_same<Number, typename VectorType::value_type>::value,
+        "Type mismatch between VectorType and VectorDataExchange");
+      (void)component_in_block_vector;
+      (void)rank;
+
+      if (vec.size() != 0)
+        {
+#  ifdef DEAL_II_WITH_MPI
+          AssertIndexRange(component_in_block_vector, tmp_data.size());
+          AssertDimension(requests.size(), tmp_data.size());
+
+          // no communication has been started for this vector
+          if (tmp_data[component_in_block_vector] == nullptr)
+            return true;
+
+          const unsigned int mf_component = find_vector_in_mf(vec);
+
+          const auto &part = get_partitioner(mf_component);
+
+          return part.export_to_ghosted_array_test(
+            rank,
+            ArrayView<const Number>(vec.begin(), part.locally_owned_size()),
+            vec.shared_vector_data(),
+            ArrayView<Number>(const_cast<Number *>(vec.begin()) +
+                                part.locally_owned_size(),
+                              matrix_free.get_dof_info(mf_component)
+                                .vector_partitioner->n_ghost_indices()),
+            this->requests[component_in_block_vector]);
+#  endif
+        }
+      return true;
+    }
+
+
+
     /**
      * Start compress for serial vectors
      */
@@ -3666,6 +4038,8 @@ namespace internal
               part.n_import_sm_procs() == 0)
             return;
 
+          check_shared_memory_data(vec);
+
           tmp_data[component_in_block_vector] =
             matrix_free.acquire_scratch_data_non_threadsafe();
           tmp_data[component_in_block_vector]->resize_fast(
@@ -4229,6 +4603,111 @@ namespace internal
 
 
 
+  //
+  // update_ghost_values_test
+  //
+
+  // for block vectors
+  template <int dim,
+            typename VectorStruct,
+            typename Number,
+            typename VectorizedArrayType,
+            std::enable_if_t<IsBlockVector<VectorStruct>::value, VectorStruct>
+              * = nullptr>
+  bool
+  update_ghost_values_test(
+    const VectorStruct &                                  vec,
+    VectorDataExchange<dim, Number, VectorizedArrayType> &exchanger,
+    const unsigned int                                    rank,
+    const unsigned int                                    channel = 0)
+  {
+    if (get_communication_block_size(vec) < vec.n_blocks())
+      {
+        // everything has already been completed in the _start() call
+        return true;
+      }
+
+    bool arrived = true;
+    for (unsigned int i = 0; i < vec.n_blocks(); ++i)
+      arrived =
+        update_ghost_values_test(vec.block(i), exchanger, rank, channel + i) &&
+        arrived;
+    return arrived;
+  }
+
+
+
+  // for non-block vectors
+  template <int dim,
+            typename VectorStruct,
+            typename Number,
+            typename VectorizedArrayType,
+            std::enable_if_t<!IsBlockVector<VectorStruct>::value, VectorStruct>
+              * = nullptr>
+  bool
+  update_ghost_values_test(
+    const VectorStruct &                                  vec,
+    VectorDataExchange<dim, Number, VectorizedArrayType> &exchanger,
+    const unsigned int                                    rank,
+    const unsigned int                                    channel = 0)
+  {
+    return exchanger.update_ghost_values_test(channel, rank, vec);
+  }
+
+
+
+  // for vector of vectors
+  template <int dim,
+            typename VectorStruct,
+            typename Number,
+            typename VectorizedArrayType>
+  inline bool
+  update_ghost_values_test(
+    const std::vector<VectorStruct> &                     vec,
+    VectorDataExchange<dim, Number, VectorizedArrayType> &exchanger,
+    const unsigned int                                    rank)
+  {
+    bool         arrived         = true;
+    unsigned int component_index = 0;
+    for (unsigned int comp = 0; comp < vec.size(); ++comp)
+      {
+        arrived =
+          update_ghost_values_test(vec[comp], exchanger, rank, component_index) &&
+          arrived;
+        component_index += n_components(vec[comp]);
+      }
+    return arrived;
+  }
+
+
+
+  // for vector of pointers to vectors
+  template <int dim,
+            typename VectorStruct,
+            typename Number,
+            typename VectorizedArrayType>
+  inline bool
+  update_ghost_values_test(
+    const std::vector<VectorStruct *> &                   vec,
+    VectorDataExchange<dim, Number, VectorizedArrayType> &exchanger,
+    const unsigned int                                    rank)
+  {
+    bool         arrived         = true;
+    unsigned int component_index = 0;
+    for (unsigned int comp = 0; comp < vec.size(); ++comp)
+      {
+        arrived = update_ghost_values_test(*vec[comp],
+                                           exchanger,
+                                           rank,
+                                           component_index) &&
+                  arrived;
+        component_index += n_components(*vec[comp]);
+      }
+    return arrived;
+  }
+
+
+
   //
   // compress_start
   //
@@ -4769,6 +5248,17 @@ namespace internal
         internal::update_ghost_values_finish(src, src_data_exchanger);
     }
 
+    // Checks whether the ghost values sent by the given rank have arrived
+    virtual bool
+    vector_update_ghosts_test(const unsigned int rank) override
+    {
+      if (!src_and_dst_are_same)
+        return internal::update_ghost_values_test(src,
+                                                  src_data_exchanger,
+                                                  rank);
+      return true;
+    }
+
     // Starts the communication for the vector compress operation
     virtual void
     vector_compress_start() override
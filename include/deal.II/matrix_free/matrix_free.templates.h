@@ -23,9 +23,12 @@
 #include <deal.II/base/mpi.h>
 #include <deal.II/base/mpi_consensus_algorithms.h>
 #include <deal.II/base/multithread_info.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/polynomials_piecewise.h>
 #include <deal.II/base/quadrature_lib.h>
 #include <deal.II/base/tensor_product_polynomials.h>
+#include <deal.II/base/thread_management.h>
+#include <deal.II/base/timer.h>
 
 #include <deal.II/distributed/tria.h>
 
@@ -39,6 +42,7 @@
 #include <deal.II/hp/q_collection.h>
 
 #include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/sparsity_tools.h>
 
 #include <deal.II/matrix_free/constraint_info.h>
 #include <deal.II/matrix_free/face_info.h>
@@ -47,14 +51,15 @@
 #include <deal.II/matrix_free/matrix_free.h>
 
 #ifdef DEAL_II_WITH_TBB
-#  include <deal.II/base/parallel.h>
-
 DEAL_II_DISABLE_EXTRA_DIAGNOSTICS
 #  include <tbb/concurrent_unordered_map.h>
 DEAL_II_ENABLE_EXTRA_DIAGNOSTICS
 #endif
 
+#include <algorithm>
+#include <cmath>
 #include <fstream>
+#include <numeric>
 
 //
 // TBB with oneAPI API has deprecated and removed the
@@ -399,8 +404,14 @@ MatrixFree<dim, Number, VectorizedArrayType>::internal_reinit(
   // Store the level of the mesh to be worked on.
   this->mg_level = additional_data.mg_level;
 
+  setup_timings.clear();
+  Timer timer;
+
   // Reads out the FE information and stores the shape function values,
-  // gradients and Hessians for quadrature points.
+  // gradients and Hessians for quadrature points. The entries are
+  // independent of each other, so set them up concurrently. Objects for the
+  // same element and quadrature formula are shared with other MatrixFree
+  // objects, e.g., on other multigrid levels.
   {
     unsigned int n_components = 0;
     for (unsigned int no = 0; no < dof_handler.size(); ++no)
@@ -416,6 +427,7 @@ MatrixFree<dim, Number, VectorizedArrayType>::internal_reinit(
       n_quad_in_collection = std::max(n_quad_in_collection, quad[q].size());
     shape_info.reinit(TableIndices<4>(
       n_components, n_quad, n_fe_in_collection, n_quad_in_collection));
+    Threads::TaskGroup<> tasks;
     for (unsigned int no = 0, c = 0; no < dof_handler.size(); ++no)
       for (unsigned int b = 0; b < dof_handler[no]->get_fe(0).n_base_elements();
            ++b, ++c)
@@ -424,9 +436,14 @@ MatrixFree<dim, Number, VectorizedArrayType>::internal_reinit(
              ++fe_no)
           for (unsigned int nq = 0; nq < n_quad; ++nq)
             for (unsigned int q_no = 0; q_no < quad[nq].size(); ++q_no)
-              shape_info(c, nq, fe_no, q_no)
-                .reinit(quad[nq][q_no], dof_handler[no]->get_fe(fe_no), b);
+              tasks += Threads::new_task([&, no, b, c, fe_no, nq, q_no]() {
+                shape_info(c, nq, fe_no, q_no) = internal::MatrixFreeFunctions::
+                  ShapeInfo<VectorizedArrayType>::get_shared(
+                    quad[nq][q_no], dof_handler[no]->get_fe(fe_no), b);
+              });
+    tasks.join_all();
   }
+  setup_timings.emplace_back("shape info", timer.wall_time());
 
   // Store pointers to AffineConstraints objects if Number type matches
   affine_constraints.resize(constraints.size());
@@ -442,6 +459,13 @@ MatrixFree<dim, Number, VectorizedArrayType>::internal_reinit(
 
       task_info.allow_ghosted_vectors_in_loops =
         additional_data.allow_ghosted_vectors_in_loops;
+      task_info.overlap_communication_per_process =
+        additional_data.overlap_communication_per_process &&
+        additional_data.overlap_communication_computation &&
+        additional_data.communicator_sm == MPI_COMM_SELF;
+      task_info.cell_batch_ordering =
+        static_cast<internal::MatrixFreeFunctions::TaskInfo::CellBatchOrdering>(
+          additional_data.cell_batch_ordering);
 
       // set variables that are independent of FE
       if (Utilities::MPI::job_supports_mpi() == true)
@@ -514,7 +538,7 @@ MatrixFree<dim, Number, VectorizedArrayType>::internal_reinit(
       task_info.vectorization_length = VectorizedArrayType::size();
       task_info.n_active_cells       = cell_level_index.size();
       task_info.create_blocks_serial(
-        dummy, 1, false, dummy, false, dummy, dummy, dummy2);
+        dummy, dummy, 1, false, dummy, false, dummy, dummy, dummy, dummy2);
 
       for (unsigned int i = 0; i < dof_info.size(); ++i)
         {
@@ -839,11 +863,12 @@ MatrixFree<dim, Number, VectorizedArrayType>::internal_reinit(
                ++fe_no)
             for (unsigned int nq = 0; nq < quad.size(); ++nq)
               for (unsigned int q_no = 0; q_no < quad[nq].size(); ++q_no)
-                if (shape_info(c, nq, fe_no, q_no).element_type ==
+                if (shape_info(c, nq, fe_no, q_no)->element_type ==
                     internal::MatrixFreeFunctions::ElementType::
                       tensor_raviart_thomas)
                   piola_transform = true;
 
+      timer.restart();
       mapping_info.initialize(
         dof_handler[0]->get_triangulation(),
         cell_level_index,
@@ -857,7 +882,9 @@ MatrixFree<dim, Number, VectorizedArrayType>::internal_reinit(
         additional_data.mapping_update_flags_boundary_faces,
         additional_data.mapping_update_flags_inner_faces,
         additional_data.mapping_update_flags_faces_by_cells,
-        piola_transform);
+        piola_transform,
+        additional_data.compute_geometry_on_the_fly);
+      setup_timings.emplace_back("mapping info", timer.wall_time());
 
       mapping_is_initialized = true;
     }
@@ -906,11 +933,13 @@ MatrixFree<dim, Number, VectorizedArrayType>::update_mapping(
   const std::shared_ptr<hp::MappingCollection<dim>> &mapping)
 {
   AssertDimension(shape_info.size(1), mapping_info.cell_data.size());
+  Timer timer;
   mapping_info.update_mapping(dof_handlers[0]->get_triangulation(),
                               cell_level_index,
                               face_info,
                               dof_info[0].cell_active_fe_index,
                               mapping);
+  setup_timings = {{"update mapping info", timer.wall_time()}};
 }
 
 
@@ -1160,8 +1189,6 @@ namespace internal
     AssertDimension(n_dof_handlers, locally_owned_dofs.size());
     AssertDimension(n_dof_handlers, constraint.size());
 
-    std::vector<types::global_dof_index> local_dof_indices_resolved;
-    std::vector<types::global_dof_index> local_dof_indices;
     std::vector<std::vector<std::vector<unsigned int>>> lexicographic(
       n_dof_handlers);
 
@@ -1339,17 +1366,33 @@ namespace internal
           }
       }
 
-    for (unsigned int counter = 0; counter < n_active_cells; ++counter)
-      {
-        bool cell_at_subdomain_boundary =
-          (face_setup.at_processor_boundary.size() > counter &&
-           face_setup.at_processor_boundary[counter]) ||
-          (overlap_communication_computation == false && task_info.n_procs > 1);
-
+    // The access to the DoFHandler and the resolution of hanging node
+    // constraints are independent between cells, so they are run in
+    // parallel on chunks of cells. The subsequent compression of the indices
+    // in DoFInfo::read_dof_indices() collects the constraints of all cells
+    // in a common data structure and is done serially. Working on chunks
+    // limits the memory for the intermediate indices.
+    struct CellIndices
+    {
+      std::vector<types::global_dof_index> plain;
+      std::vector<types::global_dof_index> resolved;
+      bool                                 has_hanging_node_constraints;
+    };
+    const unsigned int chunk_size =
+      std::min(n_active_cells, 1024U * MultithreadInfo::n_threads());
+    std::vector<CellIndices> chunk_indices(chunk_size * n_dof_handlers);
+
+    const auto extract_indices = [&](const unsigned int begin,
+                                     const unsigned int end,
+                                     const unsigned int chunk_start) {
+      std::vector<types::global_dof_index> local_dof_indices_resolved;
+      for (unsigned int counter = begin; counter < end; ++counter)
         for (unsigned int no = 0; no < n_dof_handlers; ++no)
           {
             const DoFHandler<dim> &dofh = *dof_handler[no];
-            bool                   cell_has_hanging_node_constraints = false;
+            CellIndices &indices =
+              chunk_indices[(counter - chunk_start) * n_dof_handlers + no];
+            indices.has_hanging_node_constraints = false;
 
             // read indices from active cells
             if (mg_level == numbers::invalid_unsigned_int)
@@ -1378,22 +1421,22 @@ namespace internal
                 local_dof_indices_resolved.resize(dofs_per_cell);
                 cell_it->get_dof_indices(local_dof_indices_resolved);
 
-                local_dof_indices.resize(dofs_per_cell);
+                indices.plain.resize(dofs_per_cell);
                 for (unsigned int i = 0; i < dofs_per_cell; ++i)
-                  local_dof_indices[i] =
+                  indices.plain[i] =
                     local_dof_indices_resolved[lexicographic[no][fe_index][i]];
 
                 if (dim > 1 && use_fast_hanging_node_algorithm)
                   {
-                    local_dof_indices_resolved = local_dof_indices;
+                    indices.resolved = indices.plain;
 
-                    cell_has_hanging_node_constraints =
+                    indices.has_hanging_node_constraints =
                       dof_info[no].process_hanging_node_constraints(
                         *hanging_nodes,
                         lexicographic[no],
                         counter,
                         cell_it,
-                        local_dof_indices_resolved);
+                        indices.resolved);
                   }
               }
             // we are requested to use a multigrid level
@@ -1419,28 +1462,57 @@ namespace internal
                                                     .second];
                   }
 
-                local_dof_indices.resize(dofs_per_cell);
+                indices.plain.resize(dofs_per_cell);
                 for (unsigned int i = 0; i < dofs_per_cell; ++i)
-                  local_dof_indices[i] =
+                  indices.plain[i] =
                     local_dof_indices_resolved[lexicographic[no][0][i]];
               }
-
-            dof_info[no].read_dof_indices(cell_has_hanging_node_constraints ?
-                                            local_dof_indices_resolved :
-                                            local_dof_indices,
-                                          local_dof_indices,
-                                          cell_has_hanging_node_constraints,
-                                          *constraint[no],
-                                          counter,
-                                          constraint_values,
-                                          cell_at_subdomain_boundary);
           }
+    };
+
+    for (unsigned int chunk_start = 0; chunk_start < n_active_cells;
+         chunk_start += chunk_size)
+      {
+        const unsigned int chunk_end =
+          std::min(chunk_start + chunk_size, n_active_cells);
+        dealii::parallel::apply_to_subranges(
+          chunk_start,
+          chunk_end,
+          [&](const unsigned int begin, const unsigned int end) {
+            extract_indices(begin, end, chunk_start);
+          },
+          64);
+
+        for (unsigned int counter = chunk_start; counter < chunk_end;
+             ++counter)
+          {
+            bool cell_at_subdomain_boundary =
+              (face_setup.at_processor_boundary.size() > counter &&
+               face_setup.at_processor_boundary[counter]) ||
+              (overlap_communication_computation == false &&
+               task_info.n_procs > 1);
+
+            for (unsigned int no = 0; no < n_dof_handlers; ++no)
+              {
+                const CellIndices &indices =
+                  chunk_indices[(counter - chunk_start) * n_dof_handlers + no];
+                dof_info[no].read_dof_indices(
+                  indices.has_hanging_node_constraints ? indices.resolved :
+                                                         indices.plain,
+                  indices.plain,
+                  indices.has_hanging_node_constraints,
+                  *constraint[no],
+                  counter,
+                  constraint_values,
+                  cell_at_subdomain_boundary);
+              }
 
-        // if we found dofs on some FE component that belong to other
-        // processors, the cell is added to the boundary cells.
-        if (cell_at_subdomain_boundary == true &&
-            counter < cell_level_index_end_local)
-          subdomain_boundary_cells.push_back(counter);
+            // if we found dofs on some FE component that belong to other
+            // processors, the cell is added to the boundary cells.
+            if (cell_at_subdomain_boundary == true &&
+                counter < cell_level_index_end_local)
+              subdomain_boundary_cells.push_back(counter);
+          }
       }
 
     // clear hanging_node_constraint_masks if there are no hanging nodes
@@ -1566,12 +1638,86 @@ namespace internal
                   parent_relation[i] = position;
                 ++position;
               }
+        // In case the cells with communication should be processed by the
+        // process they exchange data with, group them by the lowest rank of
+        // their neighbors at the processor boundary
+        std::vector<unsigned int> subdomain_boundary_cells_rank;
+        if (task_info.overlap_communication_per_process &&
+            task_info.n_procs > 1 &&
+            face_setup.processor_boundary_rank.empty() == false)
+          {
+            subdomain_boundary_cells_rank.reserve(
+              subdomain_boundary_cells.size());
+            for (const unsigned int cell : subdomain_boundary_cells)
+              subdomain_boundary_cells_rank.push_back(
+                face_setup.processor_boundary_rank[cell]);
+          }
+
+        // If requested, compute the position of each locally owned cell in
+        // a traversal along a space-filling curve or by the reverse
+        // Cuthill-McKee algorithm, which the batches are sorted by
+        std::vector<unsigned int> cell_order;
+        const unsigned int        n_owned_cells = task_info.n_active_cells;
+        AssertIndexRange(n_owned_cells, cell_level_index.size() + 1);
+        if (task_info.cell_batch_ordering ==
+            internal::MatrixFreeFunctions::TaskInfo::hilbert_curve)
+          {
+            std::vector<Point<dim>> centers(n_owned_cells);
+            for (unsigned int c = 0; c < n_owned_cells; ++c)
+              centers[c] =
+                typename Triangulation<dim>::cell_iterator(
+                  &tria, cell_level_index[c].first, cell_level_index[c].second)
+                  ->center();
+            const std::vector<std::array<std::uint64_t, dim>> hilbert_index =
+              Utilities::inverse_Hilbert_space_filling_curve(centers);
+
+            std::vector<unsigned int> sorted_cells(n_owned_cells);
+            std::iota(sorted_cells.begin(), sorted_cells.end(), 0U);
+            std::stable_sort(sorted_cells.begin(),
+                             sorted_cells.end(),
+                             [&](const unsigned int a, const unsigned int b) {
+                               return hilbert_index[a] < hilbert_index[b];
+                             });
+            cell_order.resize(n_owned_cells);
+            for (unsigned int i = 0; i < n_owned_cells; ++i)
+              cell_order[sorted_cells[i]] = i;
+          }
+        else if (task_info.cell_batch_ordering ==
+                 internal::MatrixFreeFunctions::TaskInfo::reverse_cuthill_mckee)
+          {
+            // cells sharing a vertex access common vector entries for
+            // continuous elements, and they are neighbors in the sense of
+            // data locality also for face integrals
+            std::vector<std::vector<unsigned int>> vertex_to_cells(
+              tria.n_vertices());
+            for (unsigned int c = 0; c < n_owned_cells; ++c)
+              {
+                typename Triangulation<dim>::cell_iterator cell(
+                  &tria, cell_level_index[c].first, cell_level_index[c].second);
+                for (const unsigned int v : cell->vertex_indices())
+                  vertex_to_cells[cell->vertex_index(v)].push_back(c);
+              }
+            DynamicSparsityPattern connectivity(n_owned_cells, n_owned_cells);
+            for (const auto &cells : vertex_to_cells)
+              for (const unsigned int c : cells)
+                connectivity.add_entries(c, cells.begin(), cells.end());
+
+            std::vector<DynamicSparsityPattern::size_type> new_indices(
+              n_owned_cells);
+            SparsityTools::reorder_Cuthill_McKee(connectivity, new_indices);
+            cell_order.resize(n_owned_cells);
+            for (unsigned int c = 0; c < n_owned_cells; ++c)
+              cell_order[c] = n_owned_cells - 1 - new_indices[c];
+          }
+
         task_info.create_blocks_serial(subdomain_boundary_cells,
+                                       subdomain_boundary_cells_rank,
                                        max_dofs_per_cell,
                                        hp_functionality_enabled,
                                        dof_info[0].cell_active_fe_index,
                                        strict_categories,
                                        parent_relation,
+                                       cell_order,
                                        renumbering,
                                        irregular_cells);
       }
@@ -1754,6 +1900,25 @@ namespace internal
                                               renumbering,
                                               connectivity);
 
+        // Estimate the relative cost of cell batches with different FE
+        // indices for balancing the partitions in hp-mode: with sum
+        // factorization, the work per cell scales as the number of DoFs
+        // times the number of DoFs per direction.
+        task_info.fe_index_cost.clear();
+        if (hp_functionality_enabled)
+          {
+            std::vector<double> cost(dof_info[0].dofs_per_cell.size());
+            for (unsigned int i = 0; i < cost.size(); ++i)
+              cost[i] = std::pow(static_cast<double>(
+                                   std::max(1U, dof_info[0].dofs_per_cell[i])),
+                                 1. + 1. / dim);
+            const double min_cost =
+              cost.empty() ? 1. : *std::min_element(cost.begin(), cost.end());
+            for (const double c : cost)
+              task_info.fe_index_cost.push_back(
+                static_cast<unsigned int>(std::round(c / min_cost)));
+          }
+
         task_info.make_thread_graph(dof_info[0].cell_active_fe_index,
                                     connectivity,
                                     renumbering,
@@ -1891,6 +2056,8 @@ MatrixFree<dim, Number, VectorizedArrayType>::initialize_indices(
             b);
   }
 
+  Timer timer;
+
   const unsigned int n_lanes     = VectorizedArrayType::size();
   task_info.vectorization_length = n_lanes;
   internal::MatrixFreeFunctions::ConstraintValues<double> constraint_values;
@@ -1938,6 +2105,9 @@ MatrixFree<dim, Number, VectorizedArrayType>::initialize_indices(
     }
 
   AssertDimension(constraint_pool_data.size(), length);
+  setup_timings.emplace_back("dof indices and cell partitioning",
+                             timer.wall_time());
+  timer.restart();
 
   // Finally resort the faces and collect several faces for vectorization
   if ((additional_data.mapping_update_flags_inner_faces |
@@ -2080,6 +2250,39 @@ MatrixFree<dim, Number, VectorizedArrayType>::initialize_indices(
   for (auto &di : dof_info)
     di.compute_vector_zero_access_pattern(task_info, face_info.faces);
 
+  // collect the ranks of the processes whose ghost data is needed by the
+  // individual partitions, in order to process the partitions at the
+  // processor boundary in the order in which the ghost data arrives
+  task_info.partition_ghost_ranks_index.clear();
+  task_info.partition_ghost_ranks.clear();
+  if (task_info.overlap_communication_per_process &&
+      task_info.scheme == internal::MatrixFreeFunctions::TaskInfo::none &&
+      task_info.n_procs > 1 && task_info.partition_row_index.size() == 5)
+    {
+      const unsigned int n_partitions =
+        task_info.partition_row_index[task_info.partition_row_index.size() - 2];
+      std::vector<std::vector<unsigned int>> ghost_ranks(n_partitions);
+      for (const auto &di : dof_info)
+        di.compute_ghost_ranks_of_partitions(task_info,
+                                             face_info.faces,
+                                             ghost_ranks);
+
+      task_info.partition_ghost_ranks_index.resize(n_partitions + 1, 0);
+      for (unsigned int i = 0; i < n_partitions; ++i)
+        {
+          std::sort(ghost_ranks[i].begin(), ghost_ranks[i].end());
+          ghost_ranks[i].erase(std::unique(ghost_ranks[i].begin(),
+                                           ghost_ranks[i].end()),
+                               ghost_ranks[i].end());
+          task_info.partition_ghost_ranks.insert(
+            task_info.partition_ghost_ranks.end(),
+            ghost_ranks[i].begin(),
+            ghost_ranks[i].end());
+          task_info.partition_ghost_ranks_index[i + 1] =
+            task_info.partition_ghost_ranks.size();
+        }
+    }
+
 #ifdef DEAL_II_WITH_MPI
   {
     // non-buffering mode is only supported if the indices of all cells are
@@ -2298,6 +2501,8 @@ MatrixFree<dim, Number, VectorizedArrayType>::initialize_indices(
       }
   }
 #endif
+  setup_timings.emplace_back("face info and index compression",
+                             timer.wall_time());
 
   indices_are_initialized = true;
 }
@@ -2314,6 +2519,7 @@ MatrixFree<dim, Number, VectorizedArrayType>::clear()
   task_info.clear();
   dof_handlers.clear();
   face_info.clear();
+  setup_timings.clear();
   indices_are_initialized = false;
   mapping_is_initialized  = false;
 }
@@ -2327,7 +2533,12 @@ MatrixFree<dim, Number, VectorizedArrayType>::memory_consumption() const
   std::size_t memory = MemoryConsumption::memory_consumption(dof_info);
   memory += MemoryConsumption::memory_consumption(cell_level_index);
   memory += MemoryConsumption::memory_consumption(face_info);
-  memory += MemoryConsumption::memory_consumption(shape_info);
+  for (unsigned int c = 0; c < shape_info.size(0); ++c)
+    for (unsigned int nq = 0; nq < shape_info.size(1); ++nq)
+      for (unsigned int fe_no = 0; fe_no < shape_info.size(2); ++fe_no)
+        for (unsigned int q_no = 0; q_no < shape_info.size(3); ++q_no)
+          if (shape_info(c, nq, fe_no, q_no) != nullptr)
+            memory += shape_info(c, nq, fe_no, q_no)->memory_consumption();
   memory += MemoryConsumption::memory_consumption(constraint_pool_data);
   memory += MemoryConsumption::memory_consumption(constraint_pool_row_index);
   memory += MemoryConsumption::memory_consumption(task_info);
@@ -2364,9 +2575,16 @@ MatrixFree<dim, Number, VectorizedArrayType>::print_memory_consumption(
   out << "   Memory mapping info" << std::endl;
   mapping_info.print_memory_consumption(out, task_info);
 
+  std::size_t memory_shape_info = 0;
+  for (unsigned int c = 0; c < shape_info.size(0); ++c)
+    for (unsigned int nq = 0; nq < shape_info.size(1); ++nq)
+      for (unsigned int fe_no = 0; fe_no < shape_info.size(2); ++fe_no)
+        for (unsigned int q_no = 0; q_no < shape_info.size(3); ++q_no)
+          if (shape_info(c, nq, fe_no, q_no) != nullptr)
+            memory_shape_info +=
+              shape_info(c, nq, fe_no, q_no)->memory_consumption();
   out << "   Memory unit cell shape data:      ";
-  task_info.print_memory_statistics(
-    out, MemoryConsumption::memory_consumption(shape_info));
+  task_info.print_memory_statistics(out, memory_shape_info);
   if (task_info.scheme != internal::MatrixFreeFunctions::TaskInfo::none)
     {
       out << "   Memory task partitioning info:    ";
@@ -2377,6 +2595,25 @@ MatrixFree<dim, Number, VectorizedArrayType>::print_memory_consumption(
 
 
 
+template <int dim, typename Number, typename VectorizedArrayType>
+template <typename StreamType>
+void
+MatrixFree<dim, Number, VectorizedArrayType>::print_setup_timings(
+  StreamType &out) const
+{
+  for (const auto &timing : setup_timings)
+    {
+      const Utilities::MPI::MinMaxAvg time =
+        Utilities::MPI::min_max_avg(timing.second, task_info.communicator);
+      out << "  Setup " << std::left << std::setw(35) << timing.first
+          << std::right << " min/avg/max: " << std::setw(10) << time.min
+          << " " << std::setw(10) << time.avg << " " << std::setw(10)
+          << time.max << " s" << std::endl;
+    }
+}
+
+
+
 template <int dim, typename Number, typename VectorizedArrayType>
 void
 MatrixFree<dim, Number, VectorizedArrayType>::print(std::ostream &out) const
@@ -0,0 +1,580 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+#ifndef dealii_matrix_free_vanka_h
+#define dealii_matrix_free_vanka_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/parallel.h>
+#include <deal.II/base/smartpointer.h>
+#include <deal.II/base/subscriptor.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/lac/batched_full_matrix.h>
+#include <deal.II/lac/la_parallel_block_vector.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include <functional>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * A cell-wise Vanka smoother for saddle point problems of Stokes type with
+ * matrix-free operators, in the spirit of SparseVanka. For each cell $K$,
+ * the local saddle point matrix $A_K$ coupling all velocity and pressure
+ * degrees of freedom of the cell is set up and inverted, and the
+ * preconditioner is applied as the additive Schwarz method
+ * @f[
+ *   P^{-1} r = \omega W \sum_K R_K^T A_K^{-1} R_K r,
+ * @f]
+ * where $R_K$ extracts the unknowns of cell $K$ from the global vector as
+ * done by FEEvaluation::read_dof_values(), $W$ is the diagonal matrix of the
+ * inverse number of cells that share an unknown, and $\omega$ is the
+ * relaxation parameter AdditionalData::relaxation.
+ *
+ * The velocity and the pressure are described by two different DoFHandler
+ * objects in the MatrixFree object, with a vector-valued element for the
+ * velocity, and the vectors are of type LinearAlgebra::distributed::BlockVector
+ * with the velocity in block zero and the pressure in block one, as in the
+ * matrix-free operators of the Stokes problem in step-56 style solvers. The
+ * cell matrices are obtained from a user-provided cell operation that
+ * applies the local operator to the degrees of freedom of one cell batch,
+ * i.e., that is called with the velocity and pressure values in
+ * FEEvaluation::begin_dof_values() and returns the integrated result in the
+ * same arrays:
+ * @code
+ *   const auto local_stokes =
+ *     [&](FEEvaluation<dim, degree + 1, degree + 2, dim, double> &velocity,
+ *         FEEvaluation<dim, degree, degree + 2, 1, double> &      pressure) {
+ *       velocity.evaluate(EvaluationFlags::gradients);
+ *       pressure.evaluate(EvaluationFlags::values);
+ *       for (const unsigned int q : velocity.quadrature_point_indices())
+ *         {
+ *           const auto grad_u = velocity.get_symmetric_gradient(q);
+ *           const auto p      = pressure.get_value(q);
+ *           velocity.submit_symmetric_gradient(grad_u, q);
+ *           velocity.submit_divergence(-p, q);
+ *           pressure.submit_value(-trace(grad_u), q);
+ *         }
+ *       velocity.integrate(EvaluationFlags::gradients);
+ *       pressure.integrate(EvaluationFlags::values);
+ *     };
+ * @endcode
+ * The matrices of all cells in a batch are computed by a single application
+ * of the cell operation per unit vector, and they are inverted together with
+ * the vectorized factorization of BatchedFullMatrix. Likewise, the
+ * application of the smoother in vmult() works on complete cell batches in
+ * the parallel cell loop of MatrixFree. Thus, no sparse matrix is ever
+ * assembled and a monolithic multigrid method for the Stokes problem stays
+ * completely matrix-free.
+ *
+ * Unknowns with homogeneous constraints, such as Dirichlet boundary
+ * conditions, are eliminated from the cell matrices, whereas hanging-node
+ * constraints are applied by FEEvaluation::read_dof_values() and
+ * FEEvaluation::distribute_local_to_global() around the local solve.
+ *
+ * The smoother typically damps the high frequencies of the error in a
+ * Richardson iteration as done by MGSmootherPrecondition, whose level
+ * smoothers are set up with MGSmootherPrecondition::initialize_matrices()
+ * and a subsequent call to initialize() for each level.
+ *
+ * @note The local matrices of the cells must be invertible, which is the
+ * case for inf-sup stable pairs such as the Taylor--Hood elements as long
+ * as each cell has enough velocity unknowns that are not subject to
+ * Dirichlet conditions. The memory consumption is quadratic in the number
+ * of unknowns per cell, which limits the use of this class to moderate
+ * polynomial degrees.
+ *
+ * @ingroup Preconditioners
+ */
+template <int dim,
+          int degree_velocity,
+          int degree_pressure,
+          int n_q_points_1d,
+          typename Number,
+          typename VectorizedArrayType = VectorizedArray<Number>>
+class MatrixFreeVanka : public Subscriptor
+{
+  static_assert(
+    std::is_same<VectorizedArrayType,
+                 VectorizedArray<Number, VectorizedArrayType::size()>>::value,
+    "This class only supports VectorizedArray as vectorized type.");
+
+public:
+  /**
+   * The type of the vectors the smoother is applied to.
+   */
+  using VectorType = LinearAlgebra::distributed::BlockVector<Number>;
+
+  /**
+   * The evaluator of the velocity.
+   */
+  using FEEvaluationVelocity = FEEvaluation<dim,
+                                            degree_velocity,
+                                            n_q_points_1d,
+                                            dim,
+                                            Number,
+                                            VectorizedArrayType>;
+
+  /**
+   * The evaluator of the pressure.
+   */
+  using FEEvaluationPressure = FEEvaluation<dim,
+                                            degree_pressure,
+                                            n_q_points_1d,
+                                            1,
+                                            Number,
+                                            VectorizedArrayType>;
+
+  /**
+   * The type of the cell operation that defines the local matrices.
+   */
+  using CellOperation =
+    std::function<void(FEEvaluationVelocity &, FEEvaluationPressure &)>;
+
+  /**
+   * Parameters of the smoother.
+   */
+  struct AdditionalData
+  {
+    /**
+     * Constructor.
+     */
+    AdditionalData(const unsigned int dof_index_velocity = 0,
+                   const unsigned int dof_index_pressure = 1,
+                   const unsigned int quad_index         = 0,
+                   const double       relaxation         = 1.)
+      : dof_index_velocity(dof_index_velocity)
+      , dof_index_pressure(dof_index_pressure)
+      , quad_index(quad_index)
+      , relaxation(relaxation)
+    {}
+
+    /**
+     * Index of the DoFHandler of the velocity within MatrixFree.
+     */
+    unsigned int dof_index_velocity;
+
+    /**
+     * Index of the DoFHandler of the pressure within MatrixFree.
+     */
+    unsigned int dof_index_pressure;
+
+    /**
+     * Index of the quadrature formula within MatrixFree passed to the
+     * evaluators of the cell operation.
+     */
+    unsigned int quad_index;
+
+    /**
+     * Relaxation parameter $\omega$.
+     */
+    double relaxation;
+  };
+
+  /**
+   * Set up the inverses of the cell matrices given by @p cell_operation for
+   * all cell batches of @p matrix_free. The MatrixFree object needs to stay
+   * alive as long as this object is used.
+   */
+  void
+  initialize(const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+             const CellOperation &                               cell_operation,
+             const AdditionalData &additional_data = AdditionalData());
+
+  /**
+   * Release all memory and return to a state just like after having called
+   * the default constructor.
+   */
+  void
+  clear();
+
+  /**
+   * Initialize a block vector with the velocity and pressure blocks as
+   * expected by vmult().
+   */
+  void
+  initialize_dof_vector(VectorType &vector) const;
+
+  /**
+   * Apply the smoother to @p src and store the result in @p dst.
+   */
+  void
+  vmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Determine an estimate for the memory consumption (in bytes) of this
+   * object.
+   */
+  std::size_t
+  memory_consumption() const;
+
+private:
+  /**
+   * Apply the inverses of the cell matrices of the cell batches in
+   * @p cell_range and add the result to @p dst.
+   */
+  void
+  local_apply(const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+              VectorType &                                        dst,
+              const VectorType &                                  src,
+              const std::pair<unsigned int, unsigned int> &cell_range) const;
+
+  /**
+   * Pointer to the MatrixFree object.
+   */
+  SmartPointer<const MatrixFree<dim, Number, VectorizedArrayType>>
+    matrix_free;
+
+  /**
+   * The parameters passed to initialize().
+   */
+  AdditionalData additional_data;
+
+  /**
+   * The inverses of the cell matrices, one per cell batch, with the velocity
+   * unknowns numbered before the pressure unknowns in the order of
+   * FEEvaluation::begin_dof_values().
+   */
+  std::vector<BatchedFullMatrix<Number, VectorizedArrayType::size()>>
+    cell_inverses;
+
+  /**
+   * The diagonal of the matrix $\omega W$.
+   */
+  VectorType weights;
+};
+
+
+
+#ifndef DOXYGEN
+
+template <int dim,
+          int degree_velocity,
+          int degree_pressure,
+          int n_q_points_1d,
+          typename Number,
+          typename VectorizedArrayType>
+void
+MatrixFreeVanka<dim,
+                degree_velocity,
+                degree_pressure,
+                n_q_points_1d,
+                Number,
+                VectorizedArrayType>::
+  initialize(const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+             const CellOperation &                               cell_operation,
+             const AdditionalData &additional_data)
+{
+  Assert(cell_operation, ExcMessage("The cell operation must be set."));
+
+  this->matrix_free     = &matrix_free;
+  this->additional_data = additional_data;
+
+  // a vector of ones, which is zero after FEEvaluation::read_dof_values() at
+  // the unknowns with homogeneous constraints
+  VectorType ones;
+  initialize_dof_vector(ones);
+  ones = Number(1.);
+  ones.update_ghost_values();
+
+  const unsigned int n_cell_batches = matrix_free.n_cell_batches();
+  cell_inverses.resize(n_cell_batches);
+
+  parallel::apply_to_subranges(
+    0U,
+    n_cell_batches,
+    [&](const unsigned int begin, const unsigned int end) {
+      FEEvaluationVelocity velocity(matrix_free,
+                                    std::make_pair(begin, end),
+                                    additional_data.dof_index_velocity,
+                                    additional_data.quad_index);
+      FEEvaluationPressure pressure(matrix_free,
+                                    std::make_pair(begin, end),
+                                    additional_data.dof_index_pressure,
+                                    additional_data.quad_index);
+
+      const unsigned int n_velocity = velocity.dofs_per_cell;
+      const unsigned int n_dofs     = n_velocity + pressure.dofs_per_cell;
+
+      AlignedVector<VectorizedArrayType> unconstrained(n_dofs);
+
+      for (unsigned int cell = begin; cell < end; ++cell)
+        {
+          velocity.reinit(cell);
+          pressure.reinit(cell);
+
+          auto &matrix = cell_inverses[cell];
+          matrix.reinit(n_dofs);
+
+          // all lanes of the batch are filled by a single application of the
+          // cell operation per unit vector
+          for (unsigned int j = 0; j < n_dofs; ++j)
+            {
+              for (unsigned int i = 0; i < n_velocity; ++i)
+                velocity.begin_dof_values()[i] = static_cast<Number>(i == j);
+              for (unsigned int i = n_velocity; i < n_dofs; ++i)
+                pressure.begin_dof_values()[i - n_velocity] =
+                  static_cast<Number>(i == j);
+
+              cell_operation(velocity, pressure);
+
+              for (unsigned int i = 0; i < n_velocity; ++i)
+                matrix(i, j) = velocity.begin_dof_values()[i];
+              for (unsigned int i = n_velocity; i < n_dofs; ++i)
+                matrix(i, j) = pressure.begin_dof_values()[i - n_velocity];
+            }
+
+          // eliminate the constrained unknowns by identity rows and columns
+          velocity.read_dof_values(ones.block(0));
+          pressure.read_dof_values(ones.block(1));
+          for (unsigned int i = 0; i < n_velocity; ++i)
+            unconstrained[i] = velocity.begin_dof_values()[i];
+          for (unsigned int i = n_velocity; i < n_dofs; ++i)
+            unconstrained[i] = pressure.begin_dof_values()[i - n_velocity];
+
+          for (unsigned int i = 0; i < n_dofs; ++i)
+            {
+              const VectorizedArrayType is_constrained =
+                compare_and_apply_mask<SIMDComparison::equal>(
+                  unconstrained[i],
+                  VectorizedArrayType(),
+                  VectorizedArrayType(1.),
+                  VectorizedArrayType());
+              const VectorizedArrayType keep =
+                VectorizedArrayType(1.) - is_constrained;
+              for (unsigned int j = 0; j < n_dofs; ++j)
+                {
+                  matrix(i, j) *= keep;
+                  matrix(j, i) *= keep;
+                }
+              matrix(i, i) += is_constrained;
+            }
+
+          for (unsigned int v =
+                 matrix_free.n_active_entries_per_cell_batch(cell);
+               v < VectorizedArrayType::size();
+               ++v)
+            matrix.set_lane_to_identity(v);
+
+          matrix.invert();
+        }
+    },
+    1);
+
+  // count the cells sharing each unknown
+  initialize_dof_vector(weights);
+  int dummy = 0;
+  matrix_free.template cell_loop<VectorType, int>(
+    [&](const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+        VectorType &                                        counts,
+        const int &,
+        const std::pair<unsigned int, unsigned int> &cell_range) {
+      FEEvaluationVelocity velocity(matrix_free,
+                                    cell_range,
+                                    additional_data.dof_index_velocity,
+                                    additional_data.quad_index);
+      FEEvaluationPressure pressure(matrix_free,
+                                    cell_range,
+                                    additional_data.dof_index_pressure,
+                                    additional_data.quad_index);
+      for (unsigned int cell = cell_range.first; cell < cell_range.second;
+           ++cell)
+        {
+          velocity.reinit(cell);
+          pressure.reinit(cell);
+          for (unsigned int i = 0; i < velocity.dofs_per_cell; ++i)
+            velocity.begin_dof_values()[i] = Number(1.);
+          for (unsigned int i = 0; i < pressure.dofs_per_cell; ++i)
+            pressure.begin_dof_values()[i] = Number(1.);
+          velocity.distribute_local_to_global(counts.block(0));
+          pressure.distribute_local_to_global(counts.block(1));
+        }
+    },
+    weights,
+    dummy,
+    true);
+
+  for (unsigned int b = 0; b < weights.n_blocks(); ++b)
+    for (auto &entry : weights.block(b))
+      entry = (entry > Number()) ?
+                static_cast<Number>(additional_data.relaxation) / entry :
+                Number();
+}
+
+
+
+template <int dim,
+          int degree_velocity,
+          int degree_pressure,
+          int n_q_points_1d,
+          typename Number,
+          typename VectorizedArrayType>
+void
+MatrixFreeVanka<dim,
+                degree_velocity,
+                degree_pressure,
+                n_q_points_1d,
+                Number,
+                VectorizedArrayType>::clear()
+{
+  matrix_free = nullptr;
+  cell_inverses.clear();
+  weights.reinit(0);
+}
+
+
+
+template <int dim,
+          int degree_velocity,
+          int degree_pressure,
+          int n_q_points_1d,
+          typename Number,
+          typename VectorizedArrayType>
+void
+MatrixFreeVanka<dim,
+                degree_velocity,
+                degree_pressure,
+                n_q_points_1d,
+                Number,
+                VectorizedArrayType>::initialize_dof_vector(VectorType &vector)
+  const
+{
+  Assert(matrix_free != nullptr, ExcNotInitialized());
+
+  vector.reinit(2);
+  matrix_free->initialize_dof_vector(vector.block(0),
+                                     additional_data.dof_index_velocity);
+  matrix_free->initialize_dof_vector(vector.block(1),
+                                     additional_data.dof_index_pressure);
+  vector.collect_sizes();
+}
+
+
+
+template <int dim,
+          int degree_velocity,
+          int degree_pressure,
+          int n_q_points_1d,
+          typename Number,
+          typename VectorizedArrayType>
+void
+MatrixFreeVanka<dim,
+                degree_velocity,
+                degree_pressure,
+                n_q_points_1d,
+                Number,
+                VectorizedArrayType>::vmult(VectorType &      dst,
+                                            const VectorType &src) const
+{
+  Assert(matrix_free != nullptr, ExcNotInitialized());
+
+  matrix_free->cell_loop(&MatrixFreeVanka::local_apply, this, dst, src, true);
+  dst.scale(weights);
+}
+
+
+
+template <int dim,
+          int degree_velocity,
+          int degree_pressure,
+          int n_q_points_1d,
+          typename Number,
+          typename VectorizedArrayType>
+void
+MatrixFreeVanka<dim,
+                degree_velocity,
+                degree_pressure,
+                n_q_points_1d,
+                Number,
+                VectorizedArrayType>::
+  local_apply(const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+              VectorType &                                        dst,
+              const VectorType &                                  src,
+              const std::pair<unsigned int, unsigned int> &cell_range) const
+{
+  FEEvaluationVelocity velocity(matrix_free,
+                                cell_range,
+                                additional_data.dof_index_velocity,
+                                additional_data.quad_index);
+  FEEvaluationPressure pressure(matrix_free,
+                                cell_range,
+                                additional_data.dof_index_pressure,
+                                additional_data.quad_index);
+
+  const unsigned int n_velocity = velocity.dofs_per_cell;
+  const unsigned int n_dofs     = n_velocity + pressure.dofs_per_cell;
+
+  AlignedVector<VectorizedArrayType> local_src(n_dofs), local_dst(n_dofs);
+
+  for (unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
+    {
+      velocity.reinit(cell);
+      pressure.reinit(cell);
+      velocity.read_dof_values(src.block(0));
+      pressure.read_dof_values(src.block(1));
+
+      for (unsigned int i = 0; i < n_velocity; ++i)
+        local_src[i] = velocity.begin_dof_values()[i];
+      for (unsigned int i = n_velocity; i < n_dofs; ++i)
+        local_src[i] = pressure.begin_dof_values()[i - n_velocity];
+
+      cell_inverses[cell].vmult(
+        ArrayView<VectorizedArrayType>(local_dst.data(), n_dofs),
+        ArrayView<const VectorizedArrayType>(local_src.data(), n_dofs));
+
+      for (unsigned int i = 0; i < n_velocity; ++i)
+        velocity.begin_dof_values()[i] = local_dst[i];
+      for (unsigned int i = n_velocity; i < n_dofs; ++i)
+        pressure.begin_dof_values()[i - n_velocity] = local_dst[i];
+
+      velocity.distribute_local_to_global(dst.block(0));
+      pressure.distribute_local_to_global(dst.block(1));
+    }
+}
+
+
+
+template <int dim,
+          int degree_velocity,
+          int degree_pressure,
+          int n_q_points_1d,
+          typename Number,
+          typename VectorizedArrayType>
+std::size_t
+MatrixFreeVanka<dim,
+                degree_velocity,
+                degree_pressure,
+                n_q_points_1d,
+                Number,
+                VectorizedArrayType>::memory_consumption() const
+{
+  std::size_t size = sizeof(*this) + weights.memory_consumption();
+  for (const auto &matrix : cell_inverses)
+    size += matrix.memory_consumption();
+  return size;
+}
+
+#endif
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
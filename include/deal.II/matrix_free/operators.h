@@ -33,6 +33,7 @@
 
 #include <deal.II/multigrid/mg_constrained_dofs.h>
 
+#include <functional>
 #include <limits>
 
 DEAL_II_NAMESPACE_OPEN
@@ -117,6 +118,22 @@ namespace MatrixFreeOperators
    * LinearAlgebra::distributed::Vector and
    * LinearAlgebra::distributed::BlockVector.
    *
+   * <h4>Fusing vector operations into the operator evaluation</h4>
+   *
+   * Besides the plain vmult(), this class provides a variant of vmult() that
+   * takes two additional functors that run vector updates on sub-ranges of
+   * the locally owned degrees of freedom before and after the operator
+   * touches them, see the description of MatrixFree::cell_loop() with the
+   * `operation_before_loop` and `operation_after_loop` arguments. This is the
+   * interface picked up by SolverCG and PreconditionChebyshev to merge their
+   * vector updates and inner products into the matrix-vector product, which
+   * reduces the number of times each vector entry is loaded from main
+   * memory. By default, the functors are simply run on the full range before
+   * and after apply_add(). Derived classes that evaluate the operator in a
+   * single MatrixFree::cell_loop() should override apply_fused() and pass the
+   * two functors on to the loop, as done by MassOperator and
+   * LaplaceOperator.
+   *
    * <h4>Selective use of blocks in MatrixFree</h4>
    *
    * MatrixFree allows to use several DoFHandler/AffineConstraints combinations
@@ -312,6 +329,32 @@ namespace MatrixFreeOperators
     void
     vmult(VectorType &dst, const VectorType &src) const;
 
+    /**
+     * Matrix-vector multiplication with vector operations interleaved with the
+     * operator evaluation. The functor @p operation_before_matrix_vector_product
+     * is run on a range of locally owned degrees of freedom (in MPI-local
+     * numbering of the first selected block) before the operator accesses
+     * those entries in @p src or @p dst, and
+     * @p operation_after_matrix_vector_product once the operator does not
+     * access them any more. Note that, as opposed to the other vmult()
+     * function, @p dst is not set to zero by this function. Instead, the
+     * caller is expected to clear the entries of @p dst in
+     * @p operation_before_matrix_vector_product. Constrained entries are
+     * treated in the same way as in the other vmult() function.
+     *
+     * This function is only implemented for non-block vectors. If the
+     * operator is used in a multigrid context with edge constraints, the two
+     * functors are run on the full range before and after the operator
+     * evaluation, respectively.
+     */
+    void
+    vmult(VectorType &      dst,
+          const VectorType &src,
+          const std::function<void(const unsigned int, const unsigned int)>
+            &operation_before_matrix_vector_product,
+          const std::function<void(const unsigned int, const unsigned int)>
+            &operation_after_matrix_vector_product) const;
+
     /**
      * Transpose matrix-vector multiplication.
      */
@@ -429,6 +472,30 @@ namespace MatrixFreeOperators
     virtual void
     Tapply_add(VectorType &dst, const VectorType &src) const;
 
+    /**
+     * Apply the operator to @p src and write the result into @p dst,
+     * running @p operation_before_loop and @p operation_after_loop on ranges
+     * of the locally owned degrees of freedom as described in
+     * MatrixFree::cell_loop(). The constrained degrees of freedom must be
+     * set to the respective entries of @p src before @p operation_after_loop
+     * touches them, which MatrixFree::cell_loop() does automatically.
+     *
+     * The default implementation runs @p operation_before_loop on the whole
+     * locally owned range, calls apply_add(), fills the constrained entries
+     * and finally runs @p operation_after_loop on the whole range. Derived
+     * classes can override this function to pass the two functors to
+     * MatrixFree::cell_loop() directly.
+     */
+    virtual void
+    apply_fused(VectorType &      dst,
+                const VectorType &src,
+                const std::function<void(const unsigned int,
+                                         const unsigned int)>
+                  &operation_before_loop,
+                const std::function<void(const unsigned int,
+                                         const unsigned int)>
+                  &operation_after_loop) const;
+
     /**
      * MatrixFree object to be used with this operator.
      */
@@ -725,6 +792,81 @@ namespace MatrixFreeOperators
 
 
 
+  /**
+   * Perform the vector updates of one stage of a low-storage Runge-Kutta
+   * method on the range `[start_range, end_range)` of locally owned entries
+   * (in MPI-local numbering), as requested by the variant of
+   * TimeStepping::LowStorageRungeKutta::evolve_one_time_step() that takes a
+   * stage function. With $k_i$ denoting the entries of @p vec_ki, multiplied
+   * by the entries of @p inverse_diagonal if the latter is not `nullptr`,
+   * the function computes
+   * @code
+   *   if (factor_ai != 0.)
+   *     next_ri = solution + factor_ai * k_i;
+   *   solution += factor_solution * k_i;
+   * @endcode
+   * The arguments are laid out such that the function can directly be called
+   * from the `operation_after_loop` of MatrixFree::cell_loop() that
+   * evaluates the differential operator into @p vec_ki, with all updates in
+   * one sweep through the vectors while the entries are still in caches. The
+   * vector @p next_ri is allowed to be the source vector of that loop. The
+   * optional @p inverse_diagonal is typically the inverse of a lumped mass
+   * matrix, e.g. from MassOperator::get_matrix_lumped_diagonal_inverse().
+   */
+  template <typename Number>
+  void
+  update_low_storage_runge_kutta_stage(
+    const unsigned int                                start_range,
+    const unsigned int                                end_range,
+    const double                                      factor_solution,
+    const double                                      factor_ai,
+    const LinearAlgebra::distributed::Vector<Number> &vec_ki,
+    LinearAlgebra::distributed::Vector<Number> &      solution,
+    LinearAlgebra::distributed::Vector<Number> &      next_ri,
+    const LinearAlgebra::distributed::Vector<Number> *inverse_diagonal =
+      nullptr);
+
+
+
+  /**
+   * Apply the inverse mass matrix of a discontinuous element cell by cell
+   * via CellwiseInverseMassMatrix to the integrated right hand side @p rhs
+   * and perform the vector updates of one stage of a low-storage
+   * Runge-Kutta method on the result, as requested by the variant of
+   * TimeStepping::LowStorageRungeKutta::evolve_one_time_step() that takes a
+   * stage function, in a single MatrixFree::cell_loop(). With $k_i = M^{-1}
+   * \text{rhs}$, the function computes
+   * @code
+   *   if (factor_ai != 0.)
+   *     next_ri = solution + factor_ai * k_i;
+   *   solution += factor_solution * k_i;
+   * @endcode
+   * such that $k_i$ is never written to memory. This is the scheme used in
+   * step-67. Since the inverse mass matrix is applied on each cell
+   * separately, the function is only valid for discontinuous elements of
+   * degree @p fe_degree, with the quadrature formula selected by @p quad_no
+   * having `fe_degree+1` points per direction. The vector @p next_ri must not
+   * be the same as @p rhs or @p solution.
+   */
+  template <int dim,
+            int fe_degree,
+            int n_components,
+            typename Number,
+            typename VectorizedArrayType>
+  void
+  apply_inverse_mass_and_update_low_storage_runge_kutta_stage(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    const double                                        factor_solution,
+    const double                                        factor_ai,
+    const LinearAlgebra::distributed::Vector<Number> &  rhs,
+    LinearAlgebra::distributed::Vector<Number> &        solution,
+    LinearAlgebra::distributed::Vector<Number> &        next_ri,
+    const unsigned int                                  dof_no  = 0,
+    const unsigned int                                  quad_no = 0,
+    const unsigned int first_selected_component                 = 0);
+
+
+
   /**
    * This class implements the operation of the action of a mass matrix.
    *
@@ -804,6 +946,20 @@ namespace MatrixFreeOperators
     virtual void
     apply_add(VectorType &dst, const VectorType &src) const override;
 
+    /**
+     * Applies the mass matrix operation with vector operations interleaved
+     * into the cell loop, see Base::apply_fused().
+     */
+    virtual void
+    apply_fused(VectorType &      dst,
+                const VectorType &src,
+                const std::function<void(const unsigned int,
+                                         const unsigned int)>
+                  &operation_before_loop,
+                const std::function<void(const unsigned int,
+                                         const unsigned int)>
+                  &operation_after_loop) const override;
+
     /**
      * For this operator, there is just a cell contribution.
      */
@@ -954,6 +1110,20 @@ namespace MatrixFreeOperators
     virtual void
     apply_add(VectorType &dst, const VectorType &src) const override;
 
+    /**
+     * Applies the Laplace operator with vector operations interleaved into
+     * the cell loop, see Base::apply_fused().
+     */
+    virtual void
+    apply_fused(VectorType &      dst,
+                const VectorType &src,
+                const std::function<void(const unsigned int,
+                                         const unsigned int)>
+                  &operation_before_loop,
+                const std::function<void(const unsigned int,
+                                         const unsigned int)>
+                  &operation_after_loop) const override;
+
     /**
      * Applies the Laplace operator on a cell.
      */
@@ -1148,6 +1318,162 @@ namespace MatrixFreeOperators
 
 
 
+  //----------------- Low-storage Runge-Kutta stages -------------------
+  template <typename Number>
+  inline void
+  update_low_storage_runge_kutta_stage(
+    const unsigned int                                start_range,
+    const unsigned int                                end_range,
+    const double                                      factor_solution,
+    const double                                      factor_ai,
+    const LinearAlgebra::distributed::Vector<Number> &vec_ki,
+    LinearAlgebra::distributed::Vector<Number> &      solution,
+    LinearAlgebra::distributed::Vector<Number> &      next_ri,
+    const LinearAlgebra::distributed::Vector<Number> *inverse_diagonal)
+  {
+    AssertIndexRange(start_range, end_range + 1);
+    AssertIndexRange(end_range, vec_ki.locally_owned_size() + 1);
+    AssertDimension(vec_ki.locally_owned_size(), solution.locally_owned_size());
+    Assert(&vec_ki != &solution && &next_ri != &solution,
+           ExcMessage("The vector solution must not alias the other vectors"));
+
+    const Number  ai  = factor_ai;
+    const Number  bi  = factor_solution;
+    const Number *k   = vec_ki.begin();
+    Number *      sol = solution.begin();
+
+    if (inverse_diagonal != nullptr)
+      {
+        AssertDimension(inverse_diagonal->locally_owned_size(),
+                        vec_ki.locally_owned_size());
+        const Number *inv = inverse_diagonal->begin();
+        if (ai == Number())
+          {
+            DEAL_II_OPENMP_SIMD_PRAGMA
+            for (unsigned int i = start_range; i < end_range; ++i)
+              sol[i] += bi * (inv[i] * k[i]);
+          }
+        else
+          {
+            AssertDimension(next_ri.locally_owned_size(),
+                            vec_ki.locally_owned_size());
+            Number *ri = next_ri.begin();
+            DEAL_II_OPENMP_SIMD_PRAGMA
+            for (unsigned int i = start_range; i < end_range; ++i)
+              {
+                const Number k_i   = inv[i] * k[i];
+                const Number sol_i = sol[i];
+                ri[i]              = sol_i + ai * k_i;
+                sol[i]             = sol_i + bi * k_i;
+              }
+          }
+      }
+    else
+      {
+        if (ai == Number())
+          {
+            DEAL_II_OPENMP_SIMD_PRAGMA
+            for (unsigned int i = start_range; i < end_range; ++i)
+              sol[i] += bi * k[i];
+          }
+        else
+          {
+            AssertDimension(next_ri.locally_owned_size(),
+                            vec_ki.locally_owned_size());
+            Number *ri = next_ri.begin();
+            DEAL_II_OPENMP_SIMD_PRAGMA
+            for (unsigned int i = start_range; i < end_range; ++i)
+              {
+                const Number k_i   = k[i];
+                const Number sol_i = sol[i];
+                ri[i]              = sol_i + ai * k_i;
+                sol[i]             = sol_i + bi * k_i;
+              }
+          }
+      }
+  }
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_components,
+            typename Number,
+            typename VectorizedArrayType>
+  void
+  apply_inverse_mass_and_update_low_storage_runge_kutta_stage(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    const double                                        factor_solution,
+    const double                                        factor_ai,
+    const LinearAlgebra::distributed::Vector<Number> &  rhs,
+    LinearAlgebra::distributed::Vector<Number> &        solution,
+    LinearAlgebra::distributed::Vector<Number> &        next_ri,
+    const unsigned int                                  dof_no,
+    const unsigned int                                  quad_no,
+    const unsigned int first_selected_component)
+  {
+    Assert(&next_ri != &rhs && &next_ri != &solution,
+           ExcMessage("The vector next_ri must not alias the other vectors"));
+
+    using VectorType = LinearAlgebra::distributed::Vector<Number>;
+    const Number ai  = factor_ai;
+    const Number bi  = factor_solution;
+
+    matrix_free.template cell_loop<VectorType, VectorType>(
+      [&](const MatrixFree<dim, Number, VectorizedArrayType> &data,
+          VectorType &                                        dst,
+          const VectorType &                                  src,
+          const std::pair<unsigned int, unsigned int> &       cell_range) {
+        FEEvaluation<dim,
+                     fe_degree,
+                     fe_degree + 1,
+                     n_components,
+                     Number,
+                     VectorizedArrayType>
+          phi(data, dof_no, quad_no, first_selected_component),
+          phi_solution(data, dof_no, quad_no, first_selected_component);
+        CellwiseInverseMassMatrix<dim,
+                                  fe_degree,
+                                  n_components,
+                                  Number,
+                                  VectorizedArrayType>
+          inverse(phi);
+
+        for (unsigned int cell = cell_range.first; cell < cell_range.second;
+             ++cell)
+          {
+            phi.reinit(cell);
+            phi.read_dof_values(src);
+            inverse.apply(phi.begin_dof_values(), phi.begin_dof_values());
+
+            phi_solution.reinit(cell);
+            phi_solution.read_dof_values(dst);
+
+            VectorizedArrayType *k_i   = phi.begin_dof_values();
+            VectorizedArrayType *sol_i = phi_solution.begin_dof_values();
+            if (ai != Number())
+              {
+                for (unsigned int i = 0; i < phi.dofs_per_cell; ++i)
+                  {
+                    const VectorizedArrayType k = k_i[i];
+                    k_i[i]                      = sol_i[i] + ai * k;
+                    sol_i[i] += bi * k;
+                  }
+                phi.set_dof_values(next_ri);
+              }
+            else
+              for (unsigned int i = 0; i < phi.dofs_per_cell; ++i)
+                sol_i[i] += bi * k_i[i];
+
+            phi_solution.set_dof_values(dst);
+          }
+      },
+      solution,
+      rhs);
+  }
+
+
+
   //----------------- Base operator -----------------------------
   template <int dim, typename VectorType, typename VectorizedArrayType>
   Base<dim, VectorType, VectorizedArrayType>::Base()
@@ -1406,6 +1732,77 @@ namespace MatrixFreeOperators
 
 
 
+  template <int dim, typename VectorType, typename VectorizedArrayType>
+  void
+  Base<dim, VectorType, VectorizedArrayType>::vmult(
+    VectorType &      dst,
+    const VectorType &src,
+    const std::function<void(const unsigned int, const unsigned int)>
+      &operation_before_matrix_vector_product,
+    const std::function<void(const unsigned int, const unsigned int)>
+      &operation_after_matrix_vector_product) const
+  {
+    AssertDimension(dst.size(), src.size());
+    Assert(BlockHelper::n_blocks(dst) == 1 && selected_rows.size() == 1,
+           ExcMessage("The vmult() variant with vector operations is only "
+                      "implemented for non-block vectors."));
+
+    const unsigned int locally_owned_size =
+      BlockHelper::subblock(dst, 0).locally_owned_size();
+
+    // the edge constraints of the multigrid case modify src and dst before
+    // and after the operator evaluation, which does not fit with the
+    // interleaved vector operations, so run them on the whole range
+    if (!edge_constrained_indices[0].empty())
+      {
+        if (operation_before_matrix_vector_product)
+          operation_before_matrix_vector_product(0, locally_owned_size);
+        mult_add(dst, src, false);
+        if (operation_after_matrix_vector_product)
+          operation_after_matrix_vector_product(0, locally_owned_size);
+        return;
+      }
+
+    adjust_ghost_range_if_necessary(src, false);
+    adjust_ghost_range_if_necessary(dst, true);
+    apply_fused(dst,
+                src,
+                operation_before_matrix_vector_product,
+                operation_after_matrix_vector_product);
+  }
+
+
+
+  template <int dim, typename VectorType, typename VectorizedArrayType>
+  void
+  Base<dim, VectorType, VectorizedArrayType>::apply_fused(
+    VectorType &      dst,
+    const VectorType &src,
+    const std::function<void(const unsigned int, const unsigned int)>
+      &operation_before_loop,
+    const std::function<void(const unsigned int, const unsigned int)>
+      &operation_after_loop) const
+  {
+    const unsigned int locally_owned_size =
+      BlockHelper::subblock(dst, 0).locally_owned_size();
+
+    if (operation_before_loop)
+      operation_before_loop(0, locally_owned_size);
+
+    apply_add(dst, src);
+
+    const std::vector<unsigned int> &constrained_dofs =
+      data->get_constrained_dofs(selected_rows[0]);
+    for (const auto constrained_dof : constrained_dofs)
+      BlockHelper::subblock(dst, 0).local_element(constrained_dof) =
+        BlockHelper::subblock(src, 0).local_element(constrained_dof);
+
+    if (operation_after_loop)
+      operation_after_loop(0, locally_owned_size);
+  }
+
+
+
   template <int dim, typename VectorType, typename VectorizedArrayType>
   void
   Base<dim, VectorType, VectorizedArrayType>::vmult_add(
@@ -2045,6 +2442,40 @@ namespace MatrixFreeOperators
 
 
 
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components,
+            typename VectorType,
+            typename VectorizedArrayType>
+  void
+  MassOperator<dim,
+               fe_degree,
+               n_q_points_1d,
+               n_components,
+               VectorType,
+               VectorizedArrayType>::
+    apply_fused(VectorType &      dst,
+                const VectorType &src,
+                const std::function<void(const unsigned int,
+                                         const unsigned int)>
+                  &operation_before_loop,
+                const std::function<void(const unsigned int,
+                                         const unsigned int)>
+                  &operation_after_loop) const
+  {
+    Base<dim, VectorType, VectorizedArrayType>::data->cell_loop(
+      &MassOperator::local_apply_cell,
+      this,
+      dst,
+      src,
+      operation_before_loop,
+      operation_after_loop,
+      this->selected_rows[0]);
+  }
+
+
+
   template <int dim,
             int fe_degree,
             int n_q_points_1d,
@@ -2238,6 +2669,40 @@ namespace MatrixFreeOperators
       &LaplaceOperator::local_apply_cell, this, dst, src);
   }
 
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components,
+            typename VectorType,
+            typename VectorizedArrayType>
+  void
+  LaplaceOperator<dim,
+                  fe_degree,
+                  n_q_points_1d,
+                  n_components,
+                  VectorType,
+                  VectorizedArrayType>::
+    apply_fused(VectorType &      dst,
+                const VectorType &src,
+                const std::function<void(const unsigned int,
+                                         const unsigned int)>
+                  &operation_before_loop,
+                const std::function<void(const unsigned int,
+                                         const unsigned int)>
+                  &operation_after_loop) const
+  {
+    Base<dim, VectorType, VectorizedArrayType>::data->cell_loop(
+      &LaplaceOperator::local_apply_cell,
+      this,
+      dst,
+      src,
+      operation_before_loop,
+      operation_after_loop,
+      this->selected_rows[0]);
+  }
+
   namespace Implementation
   {
     template <typename VectorizedArrayType>
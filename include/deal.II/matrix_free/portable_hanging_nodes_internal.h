@@ -0,0 +1,350 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+#ifndef dealii_portable_hanging_nodes_internal_h
+#define dealii_portable_hanging_nodes_internal_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/matrix_free/hanging_nodes_internal.h>
+#include <deal.II/matrix_free/portable_tensor_product_kernels.h>
+
+#include <Kokkos_Core.hpp>
+
+DEAL_II_NAMESPACE_OPEN
+namespace Portable
+{
+  namespace internal
+  {
+    //------------------------------------------------------------------------//
+    // Functions for resolving the hanging node constraints with Kokkos       //
+    //------------------------------------------------------------------------//
+    template <unsigned int size>
+    DEAL_II_HOST_DEVICE inline unsigned int
+    index2(unsigned int i, unsigned int j)
+    {
+      return i + size * j;
+    }
+
+
+
+    template <unsigned int size>
+    DEAL_II_HOST_DEVICE inline unsigned int
+    index3(unsigned int i, unsigned int j, unsigned int k)
+    {
+      return i + size * j + size * size * k;
+    }
+
+
+
+    template <unsigned int fe_degree,
+              unsigned int direction,
+              bool         transpose,
+              typename Number>
+    DEAL_II_HOST_DEVICE inline void
+    interpolate_boundary_2d(
+      const TeamHandle &team_member,
+      const Number *    constraint_weights,
+      const dealii::internal::MatrixFreeFunctions::ConstraintKinds
+              constraint_mask,
+      Number *values,
+      Number *scratch)
+    {
+      const auto this_type =
+        (direction == 0) ?
+          dealii::internal::MatrixFreeFunctions::ConstraintKinds::subcell_x :
+          dealii::internal::MatrixFreeFunctions::ConstraintKinds::subcell_y;
+
+      // Flag is true if dof is constrained for the given direction and the
+      // given face.
+      const bool constrained_face =
+        (constraint_mask &
+         (((direction == 0) ?
+             dealii::internal::MatrixFreeFunctions::ConstraintKinds::face_y :
+             dealii::internal::MatrixFreeFunctions::ConstraintKinds::
+               unconstrained) |
+          ((direction == 1) ?
+             dealii::internal::MatrixFreeFunctions::ConstraintKinds::face_x :
+             dealii::internal::MatrixFreeFunctions::ConstraintKinds::
+               unconstrained))) !=
+        dealii::internal::MatrixFreeFunctions::ConstraintKinds::unconstrained;
+
+      const bool type = (constraint_mask & this_type) !=
+                        dealii::internal::MatrixFreeFunctions::ConstraintKinds::
+                          unconstrained;
+
+      // As opposed to the CUDA implementation, a thread might work on
+      // several dofs, so the interpolated values are first written into the
+      // scratch array and copied back after a barrier.
+      Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(team_member, (fe_degree + 1) * (fe_degree + 1)),
+        [&](const unsigned int index) {
+          const unsigned int x_idx = index % (fe_degree + 1);
+          const unsigned int y_idx = index / (fe_degree + 1);
+
+          const unsigned int interp_idx = (direction == 0) ? x_idx : y_idx;
+
+          // Flag is true if for the given direction, the dof is constrained
+          // with the right type and is on the correct side (left (= 0) or
+          // right (= fe_degree))
+          const bool constrained_dof =
+            ((direction == 0) &&
+             (((constraint_mask & dealii::internal::MatrixFreeFunctions::
+                                    ConstraintKinds::subcell_y) !=
+               dealii::internal::MatrixFreeFunctions::ConstraintKinds::
+                 unconstrained) ?
+                (y_idx == 0) :
+                (y_idx == fe_degree))) ||
+            ((direction == 1) &&
+             (((constraint_mask & dealii::internal::MatrixFreeFunctions::
+                                    ConstraintKinds::subcell_x) !=
+               dealii::internal::MatrixFreeFunctions::ConstraintKinds::
+                 unconstrained) ?
+                (x_idx == 0) :
+                (x_idx == fe_degree)));
+
+          if (constrained_face && constrained_dof)
+            {
+              Number t = 0;
+              for (unsigned int i = 0; i <= fe_degree; ++i)
+                {
+                  const unsigned int real_idx =
+                    (direction == 0) ? index2<fe_degree + 1>(i, y_idx) :
+                                       index2<fe_degree + 1>(x_idx, i);
+
+                  const Number w =
+                    type ?
+                      (transpose ?
+                         constraint_weights[i * (fe_degree + 1) + interp_idx] :
+                         constraint_weights[interp_idx * (fe_degree + 1) + i]) :
+                      (transpose ?
+                         constraint_weights[(fe_degree - i) * (fe_degree + 1) +
+                                            fe_degree - interp_idx] :
+                         constraint_weights[(fe_degree - interp_idx) *
+                                              (fe_degree + 1) +
+                                            fe_degree - i]);
+                  t += w * values[real_idx];
+                }
+              scratch[index] = t;
+            }
+          else
+            scratch[index] = values[index];
+        });
+
+      team_member.team_barrier();
+
+      Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(team_member, (fe_degree + 1) * (fe_degree + 1)),
+        [&](const unsigned int index) { values[index] = scratch[index]; });
+
+      team_member.team_barrier();
+    }
+
+
+
+    template <unsigned int fe_degree,
+              unsigned int direction,
+              bool         transpose,
+              typename Number>
+    DEAL_II_HOST_DEVICE inline void
+    interpolate_boundary_3d(
+      const TeamHandle &team_member,
+      const Number *    constraint_weights,
+      const dealii::internal::MatrixFreeFunctions::ConstraintKinds
+              constraint_mask,
+      Number *values,
+      Number *scratch)
+    {
+      const auto this_type =
+        (direction == 0) ?
+          dealii::internal::MatrixFreeFunctions::ConstraintKinds::subcell_x :
+        (direction == 1) ?
+          dealii::internal::MatrixFreeFunctions::ConstraintKinds::subcell_y :
+          dealii::internal::MatrixFreeFunctions::ConstraintKinds::subcell_z;
+      const auto face1_type =
+        (direction == 0) ?
+          dealii::internal::MatrixFreeFunctions::ConstraintKinds::subcell_y :
+        (direction == 1) ?
+          dealii::internal::MatrixFreeFunctions::ConstraintKinds::subcell_z :
+          dealii::internal::MatrixFreeFunctions::ConstraintKinds::subcell_x;
+      const auto face2_type =
+        (direction == 0) ?
+          dealii::internal::MatrixFreeFunctions::ConstraintKinds::subcell_z :
+        (direction == 1) ?
+          dealii::internal::MatrixFreeFunctions::ConstraintKinds::subcell_x :
+          dealii::internal::MatrixFreeFunctions::ConstraintKinds::subcell_y;
+
+      // If computing in x-direction, need to match against face_y or
+      // face_z
+      const auto face1 =
+        (direction == 0) ?
+          dealii::internal::MatrixFreeFunctions::ConstraintKinds::face_y :
+        (direction == 1) ?
+          dealii::internal::MatrixFreeFunctions::ConstraintKinds::face_z :
+          dealii::internal::MatrixFreeFunctions::ConstraintKinds::face_x;
+      const auto face2 =
+        (direction == 0) ?
+          dealii::internal::MatrixFreeFunctions::ConstraintKinds::face_z :
+        (direction == 1) ?
+          dealii::internal::MatrixFreeFunctions::ConstraintKinds::face_x :
+          dealii::internal::MatrixFreeFunctions::ConstraintKinds::face_y;
+      const auto edge =
+        (direction == 0) ?
+          dealii::internal::MatrixFreeFunctions::ConstraintKinds::edge_x :
+        (direction == 1) ?
+          dealii::internal::MatrixFreeFunctions::ConstraintKinds::edge_y :
+          dealii::internal::MatrixFreeFunctions::ConstraintKinds::edge_z;
+      const auto constrained_face = constraint_mask & (face1 | face2 | edge);
+
+      const bool type = (constraint_mask & this_type) !=
+                        dealii::internal::MatrixFreeFunctions::ConstraintKinds::
+                          unconstrained;
+
+      Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(team_member,
+                                (fe_degree + 1) * (fe_degree + 1) *
+                                  (fe_degree + 1)),
+        [&](const unsigned int index) {
+          const unsigned int x_idx = index % (fe_degree + 1);
+          const unsigned int y_idx = (index / (fe_degree + 1)) % (fe_degree + 1);
+          const unsigned int z_idx = index / ((fe_degree + 1) * (fe_degree + 1));
+
+          const unsigned int interp_idx = (direction == 0) ? x_idx :
+                                          (direction == 1) ? y_idx :
+                                                             z_idx;
+          const unsigned int face1_idx  = (direction == 0) ? y_idx :
+                                          (direction == 1) ? z_idx :
+                                                             x_idx;
+          const unsigned int face2_idx  = (direction == 0) ? z_idx :
+                                          (direction == 1) ? x_idx :
+                                                             y_idx;
+
+          const bool on_face1 = ((constraint_mask & face1_type) !=
+                                 dealii::internal::MatrixFreeFunctions::
+                                   ConstraintKinds::unconstrained) ?
+                                  (face1_idx == 0) :
+                                  (face1_idx == fe_degree);
+          const bool on_face2 = ((constraint_mask & face2_type) !=
+                                 dealii::internal::MatrixFreeFunctions::
+                                   ConstraintKinds::unconstrained) ?
+                                  (face2_idx == 0) :
+                                  (face2_idx == fe_degree);
+          const bool constrained_dof =
+            ((((constraint_mask & face1) !=
+               dealii::internal::MatrixFreeFunctions::ConstraintKinds::
+                 unconstrained) &&
+              on_face1) ||
+             (((constraint_mask & face2) !=
+               dealii::internal::MatrixFreeFunctions::ConstraintKinds::
+                 unconstrained) &&
+              on_face2) ||
+             (((constraint_mask & edge) !=
+               dealii::internal::MatrixFreeFunctions::ConstraintKinds::
+                 unconstrained) &&
+              on_face1 && on_face2));
+
+          if ((constrained_face != dealii::internal::MatrixFreeFunctions::
+                                     ConstraintKinds::unconstrained) &&
+              constrained_dof)
+            {
+              Number t = 0;
+              for (unsigned int i = 0; i <= fe_degree; ++i)
+                {
+                  const unsigned int real_idx =
+                    (direction == 0) ? index3<fe_degree + 1>(i, y_idx, z_idx) :
+                    (direction == 1) ? index3<fe_degree + 1>(x_idx, i, z_idx) :
+                                       index3<fe_degree + 1>(x_idx, y_idx, i);
+
+                  const Number w =
+                    type ?
+                      (transpose ?
+                         constraint_weights[i * (fe_degree + 1) + interp_idx] :
+                         constraint_weights[interp_idx * (fe_degree + 1) + i]) :
+                      (transpose ?
+                         constraint_weights[(fe_degree - i) * (fe_degree + 1) +
+                                            fe_degree - interp_idx] :
+                         constraint_weights[(fe_degree - interp_idx) *
+                                              (fe_degree + 1) +
+                                            fe_degree - i]);
+                  t += w * values[real_idx];
+                }
+              scratch[index] = t;
+            }
+          else
+            scratch[index] = values[index];
+        });
+
+      team_member.team_barrier();
+
+      Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(team_member,
+                                (fe_degree + 1) * (fe_degree + 1) *
+                                  (fe_degree + 1)),
+        [&](const unsigned int index) { values[index] = scratch[index]; });
+
+      team_member.team_barrier();
+    }
+
+
+
+    /**
+     * This function resolves the hanging nodes using tensor product. It is
+     * the counterpart of CUDAWrappers::internal::resolve_hanging_nodes() for
+     * all execution spaces supported by Kokkos, with the 1d interpolation
+     * matrix of the constraints passed in @p constraint_weights (in device
+     * memory) and a @p scratch array of the size of the cell's degrees of
+     * freedom, typically in the scratch memory of the team.
+     *
+     * The implementation of this class is explained in Section 3 of
+     * @cite ljungkvist2017matrix and in Section 3.4 of
+     * @cite kronbichler2019multigrid.
+     */
+    template <int dim, int fe_degree, bool transpose, typename Number>
+    DEAL_II_HOST_DEVICE void
+    resolve_hanging_nodes(
+      const TeamHandle &team_member,
+      const Number *    constraint_weights,
+      const dealii::internal::MatrixFreeFunctions::ConstraintKinds
+              constraint_mask,
+      Number *values,
+      Number *scratch)
+    {
+      if (dim == 2)
+        {
+          interpolate_boundary_2d<fe_degree, 0, transpose>(
+            team_member, constraint_weights, constraint_mask, values, scratch);
+
+          interpolate_boundary_2d<fe_degree, 1, transpose>(
+            team_member, constraint_weights, constraint_mask, values, scratch);
+        }
+      else if (dim == 3)
+        {
+          // Interpolate y and z faces (x-direction)
+          interpolate_boundary_3d<fe_degree, 0, transpose>(
+            team_member, constraint_weights, constraint_mask, values, scratch);
+          // Interpolate x and z faces (y-direction)
+          interpolate_boundary_3d<fe_degree, 1, transpose>(
+            team_member, constraint_weights, constraint_mask, values, scratch);
+          // Interpolate x and y faces (z-direction)
+          interpolate_boundary_3d<fe_degree, 2, transpose>(
+            team_member, constraint_weights, constraint_mask, values, scratch);
+        }
+    }
+  } // namespace internal
+} // namespace Portable
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
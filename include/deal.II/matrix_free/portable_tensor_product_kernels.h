@@ -0,0 +1,557 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+
+#ifndef dealii_portable_tensor_product_kernels_h
+#define dealii_portable_tensor_product_kernels_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/utilities.h>
+
+#include <Kokkos_Core.hpp>
+
+DEAL_II_NAMESPACE_OPEN
+
+
+/**
+ * A namespace for matrix-free kernels that are written in terms of Kokkos
+ * and therefore run on all the execution spaces Kokkos has been configured
+ * with, e.g., CUDA, HIP, SYCL, OpenMP, or serial execution on the host.
+ */
+namespace Portable
+{
+  namespace internal
+  {
+    /**
+     * The handle of a team of threads working on a single cell in the
+     * default execution space of Kokkos.
+     */
+    using TeamHandle =
+      Kokkos::TeamPolicy<Kokkos::DefaultExecutionSpace>::member_type;
+
+
+
+    /**
+     * In this namespace, the evaluator routines that evaluate the tensor
+     * products are implemented.
+     */
+    // TODO: for now only the general variant is implemented
+    enum EvaluatorVariant
+    {
+      evaluate_general,
+      evaluate_symmetric,
+      evaluate_evenodd
+    };
+
+
+
+    /**
+     * Generic evaluator framework.
+     */
+    template <EvaluatorVariant variant,
+              int              dim,
+              int              fe_degree,
+              int              n_q_points_1d,
+              typename Number>
+    struct EvaluatorTensorProduct
+    {};
+
+
+
+    /**
+     * Internal evaluator for 1d-3d shape function using the tensor product
+     * form of the basis functions. This is the counterpart of
+     * CUDAWrappers::internal::EvaluatorTensorProduct written in terms of the
+     * hierarchical parallelism of Kokkos: all the threads of a team
+     * (corresponding to a CUDA or HIP block, or a SYCL work group) work on
+     * the same cell, with the entries of one sweep distributed among the
+     * threads with Kokkos::TeamThreadRange and Kokkos barriers between the
+     * sweeps.
+     *
+     * As opposed to the CUDA implementation, the 1d shape data is not read
+     * from constant memory but passed as pointers into device memory, and
+     * the sweeps are never done in place: A scratch array of size
+     * @p n_q_points, typically allocated in the scratch memory of the team,
+     * is used as intermediate storage. This makes the kernels independent of
+     * the number of threads per team. Like the CUDA implementation, the
+     * kernels assume that the number of quadrature points in 1d equals the
+     * number of shape functions in 1d.
+     *
+     * The 1d shape data is expected in the layout of
+     * internal::MatrixFreeFunctions::UnivariateShapeData, i.e., the value of
+     * shape function $i$ in quadrature point $q$ is stored at position
+     * <code>i * n_q_points_1d + q</code>.
+     */
+    template <int dim, int fe_degree, int n_q_points_1d, typename Number>
+    struct EvaluatorTensorProduct<evaluate_general,
+                                  dim,
+                                  fe_degree,
+                                  n_q_points_1d,
+                                  Number>
+    {
+      static_assert(n_q_points_1d == fe_degree + 1,
+                    "The portable tensor product kernels require the number "
+                    "of quadrature points in 1d to be fe_degree+1.");
+
+      static constexpr unsigned int dofs_per_cell =
+        Utilities::pow(fe_degree + 1, dim);
+      static constexpr unsigned int n_q_points =
+        Utilities::pow(n_q_points_1d, dim);
+
+      /**
+       * Constructor. The arrays @p shape_values, @p shape_gradients, and
+       * @p co_shape_gradients hold the 1d shape data, whereas @p scratch
+       * needs to provide space for @p n_q_points numbers.
+       */
+      DEAL_II_HOST_DEVICE
+      EvaluatorTensorProduct(const TeamHandle &team_member,
+                             const Number *    shape_values,
+                             const Number *    shape_gradients,
+                             const Number *    co_shape_gradients,
+                             Number *          scratch);
+
+      /**
+       * Apply the 1d matrix @p shape_data along the given @p direction to
+       * the tensor @p in and write (or add, if @p add is true) the result
+       * into @p out. The arrays @p in and @p out must not overlap.
+       */
+      template <int direction, bool dof_to_quad, bool add>
+      DEAL_II_HOST_DEVICE void
+      apply(const Number *shape_data, const Number *in, Number *out) const;
+
+      /**
+       * Evaluate the finite element function at the quadrature points.
+       */
+      DEAL_II_HOST_DEVICE void
+      value_at_quad_pts(Number *u) const;
+
+      /**
+       * Helper function for integrate(). Integrate the finite element
+       * function.
+       */
+      DEAL_II_HOST_DEVICE void
+      integrate_value(Number *u) const;
+
+      /**
+       * Evaluate the gradients of the finite element function at the
+       * quadrature points.
+       */
+      DEAL_II_HOST_DEVICE void
+      gradient_at_quad_pts(const Number *const u, Number *grad_u[dim]) const;
+
+      /**
+       * Evaluate the values and the gradients of the finite element function
+       * at the quadrature points.
+       */
+      DEAL_II_HOST_DEVICE void
+      value_and_gradient_at_quad_pts(Number *const u,
+                                     Number *      grad_u[dim]) const;
+
+      /**
+       * Helper function for integrate(). Integrate the gradients of the
+       * finite element function. The content of @p grad_u is overwritten.
+       */
+      template <bool add>
+      DEAL_II_HOST_DEVICE void
+      integrate_gradient(Number *u, Number *grad_u[dim]) const;
+
+      /**
+       * Helper function for integrate(). Integrate the values and the
+       * gradients of the finite element function.
+       */
+      DEAL_II_HOST_DEVICE void
+      integrate_value_and_gradient(Number *u, Number *grad_u[dim]) const;
+
+    private:
+      /**
+       * Copy @p in into @p out with all threads of the team.
+       */
+      DEAL_II_HOST_DEVICE void
+      copy(const Number *in, Number *out) const;
+
+      const TeamHandle &team_member;
+      const Number *    shape_values;
+      const Number *    shape_gradients;
+      const Number *    co_shape_gradients;
+      Number *          scratch;
+    };
+
+
+
+    template <int dim, int fe_degree, int n_q_points_1d, typename Number>
+    DEAL_II_HOST_DEVICE
+    EvaluatorTensorProduct<evaluate_general,
+                           dim,
+                           fe_degree,
+                           n_q_points_1d,
+                           Number>::
+      EvaluatorTensorProduct(const TeamHandle &team_member,
+                             const Number *    shape_values,
+                             const Number *    shape_gradients,
+                             const Number *    co_shape_gradients,
+                             Number *          scratch)
+      : team_member(team_member)
+      , shape_values(shape_values)
+      , shape_gradients(shape_gradients)
+      , co_shape_gradients(co_shape_gradients)
+      , scratch(scratch)
+    {}
+
+
+
+    template <int dim, int fe_degree, int n_q_points_1d, typename Number>
+    template <int direction, bool dof_to_quad, bool add>
+    DEAL_II_HOST_DEVICE void
+    EvaluatorTensorProduct<evaluate_general,
+                           dim,
+                           fe_degree,
+                           n_q_points_1d,
+                           Number>::apply(const Number *shape_data,
+                                          const Number *in,
+                                          Number *      out) const
+    {
+      constexpr int n = n_q_points_1d;
+
+      Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(team_member, n_q_points),
+        [&](const int index) {
+          // the index along the direction of the sweep and the two remaining
+          // indices of the tensor
+          const int q = (direction == 0) ? (index % n) :
+                        (direction == 1) ? ((index / n) % n) :
+                                           (index / (n * n));
+          const int i = (direction == 0) ? ((index / n) % n) : (index % n);
+          const int j =
+            (direction == 2) ? ((index / n) % n) : (index / (n * n));
+
+          Number t = 0;
+          for (int k = 0; k < n; ++k)
+            {
+              const int shape_idx = dof_to_quad ? (q + k * n) : (k + q * n);
+              const int source_idx = (direction == 0) ? (k + n * (i + n * j)) :
+                                     (direction == 1) ? (i + n * (k + n * j)) :
+                                                        (i + n * (j + n * k));
+              t += shape_data[shape_idx] * in[source_idx];
+            }
+
+          if (add)
+            out[index] += t;
+          else
+            out[index] = t;
+        });
+
+      team_member.team_barrier();
+    }
+
+
+
+    template <int dim, int fe_degree, int n_q_points_1d, typename Number>
+    inline DEAL_II_HOST_DEVICE void
+    EvaluatorTensorProduct<evaluate_general,
+                           dim,
+                           fe_degree,
+                           n_q_points_1d,
+                           Number>::copy(const Number *in, Number *out) const
+    {
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(team_member, n_q_points),
+                           [&](const int index) { out[index] = in[index]; });
+
+      team_member.team_barrier();
+    }
+
+
+
+    template <int dim, int fe_degree, int n_q_points_1d, typename Number>
+    inline DEAL_II_HOST_DEVICE void
+    EvaluatorTensorProduct<evaluate_general,
+                           dim,
+                           fe_degree,
+                           n_q_points_1d,
+                           Number>::value_at_quad_pts(Number *u) const
+    {
+      // alternate between u and the scratch array such that the result ends
+      // up in u
+      switch (dim)
+        {
+          case 1:
+            {
+              apply<0, true, false>(shape_values, u, scratch);
+              copy(scratch, u);
+
+              break;
+            }
+          case 2:
+            {
+              apply<0, true, false>(shape_values, u, scratch);
+              apply<1, true, false>(shape_values, scratch, u);
+
+              break;
+            }
+          case 3:
+            {
+              apply<0, true, false>(shape_values, u, scratch);
+              apply<1, true, false>(shape_values, scratch, u);
+              apply<2, true, false>(shape_values, u, scratch);
+              copy(scratch, u);
+
+              break;
+            }
+          default:
+            {
+              // Do nothing. We should throw but we can't from a device
+              // function.
+            }
+        }
+    }
+
+
+
+    template <int dim, int fe_degree, int n_q_points_1d, typename Number>
+    inline DEAL_II_HOST_DEVICE void
+    EvaluatorTensorProduct<evaluate_general,
+                           dim,
+                           fe_degree,
+                           n_q_points_1d,
+                           Number>::integrate_value(Number *u) const
+    {
+      switch (dim)
+        {
+          case 1:
+            {
+              apply<0, false, false>(shape_values, u, scratch);
+              copy(scratch, u);
+
+              break;
+            }
+          case 2:
+            {
+              apply<0, false, false>(shape_values, u, scratch);
+              apply<1, false, false>(shape_values, scratch, u);
+
+              break;
+            }
+          case 3:
+            {
+              apply<0, false, false>(shape_values, u, scratch);
+              apply<1, false, false>(shape_values, scratch, u);
+              apply<2, false, false>(shape_values, u, scratch);
+              copy(scratch, u);
+
+              break;
+            }
+          default:
+            {
+              // Do nothing. We should throw but we can't from a device
+              // function.
+            }
+        }
+    }
+
+
+
+    template <int dim, int fe_degree, int n_q_points_1d, typename Number>
+    inline DEAL_II_HOST_DEVICE void
+    EvaluatorTensorProduct<evaluate_general,
+                           dim,
+                           fe_degree,
+                           n_q_points_1d,
+                           Number>::gradient_at_quad_pts(const Number *const u,
+                                                         Number *grad_u[dim])
+      const
+    {
+      // each component of the gradient applies the derivative in its own
+      // direction and the values in all other directions
+      switch (dim)
+        {
+          case 1:
+            {
+              apply<0, true, false>(shape_gradients, u, grad_u[0]);
+
+              break;
+            }
+          case 2:
+            {
+              for (unsigned int d = 0; d < 2; ++d)
+                {
+                  apply<0, true, false>(d == 0 ? shape_gradients :
+                                                 shape_values,
+                                        u,
+                                        scratch);
+                  apply<1, true, false>(d == 1 ? shape_gradients :
+                                                 shape_values,
+                                        scratch,
+                                        grad_u[d]);
+                }
+
+              break;
+            }
+          case 3:
+            {
+              for (unsigned int d = 0; d < 3; ++d)
+                {
+                  apply<0, true, false>(d == 0 ? shape_gradients :
+                                                 shape_values,
+                                        u,
+                                        grad_u[d]);
+                  apply<1, true, false>(d == 1 ? shape_gradients :
+                                                 shape_values,
+                                        grad_u[d],
+                                        scratch);
+                  apply<2, true, false>(d == 2 ? shape_gradients :
+                                                 shape_values,
+                                        scratch,
+                                        grad_u[d]);
+                }
+
+              break;
+            }
+          default:
+            {
+              // Do nothing. We should throw but we can't from a device
+              // function.
+            }
+        }
+    }
+
+
+
+    template <int dim, int fe_degree, int n_q_points_1d, typename Number>
+    inline DEAL_II_HOST_DEVICE void
+    EvaluatorTensorProduct<
+      evaluate_general,
+      dim,
+      fe_degree,
+      n_q_points_1d,
+      Number>::value_and_gradient_at_quad_pts(Number *const u,
+                                              Number *grad_u[dim]) const
+    {
+      value_at_quad_pts(u);
+
+      // the gradients are computed in the collocation space of the
+      // quadrature points
+      apply<0, true, false>(co_shape_gradients, u, grad_u[0]);
+      if (dim > 1)
+        apply<1, true, false>(co_shape_gradients, u, grad_u[1]);
+      if (dim > 2)
+        apply<2, true, false>(co_shape_gradients, u, grad_u[2]);
+    }
+
+
+
+    template <int dim, int fe_degree, int n_q_points_1d, typename Number>
+    template <bool add>
+    inline DEAL_II_HOST_DEVICE void
+    EvaluatorTensorProduct<evaluate_general,
+                           dim,
+                           fe_degree,
+                           n_q_points_1d,
+                           Number>::integrate_gradient(Number *u,
+                                                       Number *grad_u[dim])
+      const
+    {
+      switch (dim)
+        {
+          case 1:
+            {
+              apply<0, false, add>(shape_gradients, grad_u[0], u);
+
+              break;
+            }
+          case 2:
+            {
+              for (unsigned int d = 0; d < 2; ++d)
+                {
+                  apply<0, false, false>(d == 0 ? shape_gradients :
+                                                  shape_values,
+                                         grad_u[d],
+                                         scratch);
+                  if (add || d > 0)
+                    apply<1, false, true>(d == 1 ? shape_gradients :
+                                                   shape_values,
+                                          scratch,
+                                          u);
+                  else
+                    apply<1, false, false>(d == 1 ? shape_gradients :
+                                                    shape_values,
+                                           scratch,
+                                           u);
+                }
+
+              break;
+            }
+          case 3:
+            {
+              for (unsigned int d = 0; d < 3; ++d)
+                {
+                  apply<0, false, false>(d == 0 ? shape_gradients :
+                                                  shape_values,
+                                         grad_u[d],
+                                         scratch);
+                  apply<1, false, false>(d == 1 ? shape_gradients :
+                                                  shape_values,
+                                         scratch,
+                                         grad_u[d]);
+                  if (add || d > 0)
+                    apply<2, false, true>(d == 2 ? shape_gradients :
+                                                   shape_values,
+                                          grad_u[d],
+                                          u);
+                  else
+                    apply<2, false, false>(d == 2 ? shape_gradients :
+                                                    shape_values,
+                                           grad_u[d],
+                                           u);
+                }
+
+              break;
+            }
+          default:
+            {
+              // Do nothing. We should throw but we can't from a device
+              // function.
+            }
+        }
+    }
+
+
+
+    template <int dim, int fe_degree, int n_q_points_1d, typename Number>
+    inline DEAL_II_HOST_DEVICE void
+    EvaluatorTensorProduct<evaluate_general,
+                           dim,
+                           fe_degree,
+                           n_q_points_1d,
+                           Number>::integrate_value_and_gradient(Number *u,
+                                                                 Number
+                                                                   *grad_u[dim])
+      const
+    {
+      // add the gradients in the collocation space to the values submitted
+      // in u before transforming back to the space of shape functions
+      apply<0, false, true>(co_shape_gradients, grad_u[0], u);
+      if (dim > 1)
+        apply<1, false, true>(co_shape_gradients, grad_u[1], u);
+      if (dim > 2)
+        apply<2, false, true>(co_shape_gradients, grad_u[2], u);
+
+      integrate_value(u);
+    }
+  } // namespace internal
+} // namespace Portable
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -26,6 +26,10 @@
 #include <deal.II/base/table.h>
 #include <deal.II/base/vectorization.h>
 
+#include <deal.II/matrix_free/util.h>
+
+#include <memory>
+
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -138,6 +142,16 @@ namespace internal
        */
       UnivariateShapeData();
 
+      /**
+       * Fill the data fields of this class from another object with a
+       * possibly different number type (e.g. a lower precision), converting
+       * all entries. The two number types must have the same number of
+       * vectorization lanes.
+       */
+      template <typename Number2>
+      void
+      copy_from(const UnivariateShapeData<Number2> &other);
+
       /**
        * Return the memory consumption of this class in bytes.
        */
@@ -382,6 +396,27 @@ namespace internal
              const FiniteElement<dim, spacedim> &fe_dim,
              const unsigned int                  base_element = 0);
 
+      /**
+       * Return a ShapeInfo object initialized with the given arguments as in
+       * reinit(), shared with all other callers that ask for the same
+       * element, base element, and quadrature formula.
+       *
+       * The objects are stored in a process-wide cache that only holds weak
+       * references, so an object is deleted once the last user releases it.
+       * MatrixFree uses this function to avoid setting up and storing the
+       * same tables on all levels of a multigrid hierarchy and in several
+       * MatrixFree objects for the same element. Two elements are considered
+       * the same if they have the same name, see FiniteElement::get_name(),
+       * and their base element @p base_element has the same unit support
+       * points. This function can be called concurrently from several
+       * threads.
+       */
+      template <int dim, int spacedim, int dim_q>
+      static std::shared_ptr<const ShapeInfo<Number>>
+      get_shared(const Quadrature<dim_q> &           quad,
+                 const FiniteElement<dim, spacedim> &fe,
+                 const unsigned int                  base_element = 0);
+
       /**
        * Return which kinds of elements are supported by MatrixFree.
        */
@@ -406,6 +441,16 @@ namespace internal
       get_shape_data(const unsigned int dimension = 0,
                      const unsigned int component = 0) const;
 
+      /**
+       * Fill the data fields of this class from another object with a
+       * possibly different number type (e.g. a lower precision), converting
+       * all entries. This is much cheaper than a call to reinit() because
+       * the finite element needs not be evaluated again.
+       */
+      template <typename Number2>
+      void
+      copy_from(const ShapeInfo<Number2> &other);
+
       /**
        * Return the memory consumption of this class in bytes.
        */
@@ -602,6 +647,92 @@ namespace internal
       return *(data_access(dimension, component));
     }
 
+
+
+    template <typename Number>
+    template <typename Number2>
+    inline void
+    UnivariateShapeData<Number>::copy_from(
+      const UnivariateShapeData<Number2> &other)
+    {
+      element_type = other.element_type;
+      convert_value(other.shape_values, shape_values);
+      convert_value(other.shape_gradients, shape_gradients);
+      convert_value(other.shape_hessians, shape_hessians);
+      convert_value(other.shape_gradients_collocation,
+                    shape_gradients_collocation);
+      convert_value(other.shape_hessians_collocation,
+                    shape_hessians_collocation);
+      convert_value(other.shape_values_eo, shape_values_eo);
+      convert_value(other.shape_gradients_eo, shape_gradients_eo);
+      convert_value(other.shape_hessians_eo, shape_hessians_eo);
+      convert_value(other.shape_gradients_collocation_eo,
+                    shape_gradients_collocation_eo);
+      convert_value(other.shape_hessians_collocation_eo,
+                    shape_hessians_collocation_eo);
+      convert_value(other.inverse_shape_values, inverse_shape_values);
+      convert_value(other.inverse_shape_values_eo, inverse_shape_values_eo);
+      for (unsigned int i = 0; i < 2; ++i)
+        {
+          convert_value(other.shape_data_on_face[i], shape_data_on_face[i]);
+          convert_value(other.quadrature_data_on_face[i],
+                        quadrature_data_on_face[i]);
+          convert_value(other.values_within_subface[i],
+                        values_within_subface[i]);
+          convert_value(other.gradients_within_subface[i],
+                        gradients_within_subface[i]);
+          convert_value(other.hessians_within_subface[i],
+                        hessians_within_subface[i]);
+          convert_value(other.subface_interpolation_matrices[i],
+                        subface_interpolation_matrices[i]);
+          convert_value(other.subface_interpolation_matrices_scalar[i],
+                        subface_interpolation_matrices_scalar[i]);
+        }
+      quadrature               = other.quadrature;
+      fe_degree                = other.fe_degree;
+      n_q_points_1d            = other.n_q_points_1d;
+      nodal_at_cell_boundaries = other.nodal_at_cell_boundaries;
+      convert_value(other.shape_values_face, shape_values_face);
+      convert_value(other.shape_gradients_face, shape_gradients_face);
+    }
+
+
+
+    template <typename Number>
+    template <typename Number2>
+    inline void
+    ShapeInfo<Number>::copy_from(const ShapeInfo<Number2> &other)
+    {
+      element_type            = other.element_type;
+      lexicographic_numbering = other.lexicographic_numbering;
+
+      data.resize(other.data.size());
+      for (unsigned int i = 0; i < data.size(); ++i)
+        data[i].copy_from(other.data[i]);
+
+      // the entries in data_access point into the data field of the other
+      // object, so translate them to the local field
+      data_access.reinit(other.data_access.size(0), other.data_access.size(1));
+      for (unsigned int d = 0; d < data_access.size(0); ++d)
+        for (unsigned int c = 0; c < data_access.size(1); ++c)
+          data_access(d, c) =
+            other.data_access(d, c) != nullptr ?
+              &data[other.data_access(d, c) - other.data.data()] :
+              nullptr;
+
+      n_dimensions               = other.n_dimensions;
+      n_components               = other.n_components;
+      n_q_points                 = other.n_q_points;
+      dofs_per_component_on_cell = other.dofs_per_component_on_cell;
+      n_q_points_face            = other.n_q_points_face;
+      n_q_points_faces           = other.n_q_points_faces;
+      dofs_per_component_on_face = other.dofs_per_component_on_face;
+      face_to_cell_index_nodal   = other.face_to_cell_index_nodal;
+      face_to_cell_index_hermite = other.face_to_cell_index_hermite;
+      face_orientations_dofs     = other.face_orientations_dofs;
+      face_orientations_quad     = other.face_orientations_quad;
+    }
+
   } // end of namespace MatrixFreeFunctions
 
 } // end of namespace internal
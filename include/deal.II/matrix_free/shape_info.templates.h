@@ -48,6 +48,11 @@
 #include <deal.II/matrix_free/shape_info.h>
 #include <deal.II/matrix_free/util.h>
 
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <string>
+
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -1310,6 +1315,69 @@ namespace internal
 
 
 
+    template <typename Number>
+    template <int dim, int spacedim, int dim_q>
+    std::shared_ptr<const ShapeInfo<Number>>
+    ShapeInfo<Number>::get_shared(const Quadrature<dim_q> &           quad,
+                                  const FiniteElement<dim, spacedim> &fe,
+                                  const unsigned int base_element)
+    {
+      struct CacheEntry
+      {
+        std::string                            fe_name;
+        unsigned int                           base_element;
+        std::vector<Point<dim>>                unit_support_points;
+        Quadrature<dim_q>                      quadrature;
+        std::weak_ptr<const ShapeInfo<Number>> shape_info;
+      };
+      static std::vector<CacheEntry> cache;
+      static std::mutex              mutex;
+
+      // The name does not identify elements with arbitrary nodes that are
+      // not known to the element, so also compare the support points
+      const std::string             fe_name = fe.get_name();
+      const std::vector<Point<dim>> unit_support_points =
+        fe.base_element(base_element).get_unit_support_points();
+
+      const auto find_in_cache = [&]() {
+        for (const CacheEntry &entry : cache)
+          if (entry.base_element == base_element && entry.fe_name == fe_name &&
+              entry.unit_support_points == unit_support_points &&
+              entry.quadrature == quad)
+            if (const auto shape_info = entry.shape_info.lock())
+              return shape_info;
+        return std::shared_ptr<const ShapeInfo<Number>>();
+      };
+
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (const auto shape_info = find_in_cache())
+          return shape_info;
+      }
+
+      // Set up the new object without holding the lock, since MatrixFree
+      // creates the objects for different elements concurrently
+      const auto new_shape_info =
+        std::make_shared<const ShapeInfo<Number>>(quad, fe, base_element);
+
+      std::lock_guard<std::mutex> lock(mutex);
+      // Another thread might have added the same object in the meantime
+      if (const auto shape_info = find_in_cache())
+        return shape_info;
+
+      cache.erase(std::remove_if(cache.begin(),
+                                 cache.end(),
+                                 [](const CacheEntry &entry) {
+                                   return entry.shape_info.expired();
+                                 }),
+                  cache.end());
+      cache.push_back(CacheEntry{
+        fe_name, base_element, unit_support_points, quad, new_shape_info});
+      return new_shape_info;
+    }
+
+
+
     template <typename Number>
     std::size_t
     ShapeInfo<Number>::memory_consumption() const
@@ -55,6 +55,12 @@ namespace internal
     virtual void
     vector_update_ghosts_finish() = 0;
 
+    /// Checks without blocking whether the ghost values sent by the MPI
+    /// process with the given rank have arrived for all source vectors,
+    /// such that the cells and faces depending on them can be processed
+    virtual bool
+    vector_update_ghosts_test(const unsigned int rank) = 0;
+
     /// Starts the communication for the vector compress operation
     virtual void
     vector_compress_start() = 0;
@@ -118,6 +124,15 @@ namespace internal
         color
       };
 
+      // enum for the choice of the order of the cell batches within the
+      // partitions of the serial setup
+      enum CellBatchOrdering
+      {
+        default_ordering,
+        hilbert_curve,
+        reverse_cuthill_mckee
+      };
+
       /**
        * Constructor.
        */
@@ -136,6 +151,15 @@ namespace internal
       void
       loop(MFWorkerInterface &worker) const;
 
+      /**
+       * Runs the part of the loop without threads that involves MPI
+       * communication, processing each partition as soon as the ghost data
+       * of all processes it depends on has arrived, as described by
+       * @p partition_ghost_ranks_index.
+       */
+      void
+      loop_progress_ghost_ranks(MFWorkerInterface &worker) const;
+
       /**
        * Make the number of cells which can only be treated in the
        * communication overlap divisible by the vectorization length.
@@ -152,6 +176,13 @@ namespace internal
        * the partitioning to make sure cell loops that overlap communication
        * with communication have the ghost data ready.
        *
+       * @param cells_with_comm_rank If not empty, this array contains for
+       * each entry in @p cells_with_comm the lowest rank of the MPI processes
+       * the cell exchanges data with. The cell batches with communication
+       * are then sorted by this rank and the partitions are split whenever
+       * the rank changes, such that the partitions depend on the data of as
+       * few processes as possible.
+       *
        * @param dofs_per_cell Gives an expected value for the number of degrees
        * of freedom on a cell, which is used to determine the block size for
        * interleaving cell and face integrals.
@@ -175,6 +206,12 @@ namespace internal
        * have the same parent cell. Cells with the same ancestor are grouped
        * together into the same batch(es) with vectorization across cells.
        *
+       * @param cell_order If not empty, this array contains for each locally
+       * owned cell its position in a preferred traversal order, e.g. along
+       * a space-filling curve. The cells are then grouped into batches and
+       * the batches within each partition sorted according to this order,
+       * instead of the order of the cell indices.
+       *
        * @param renumbering When leaving this function, the vector contains a
        * new numbering of the cells that aligns with the grouping stored in
        * this class.
@@ -188,11 +225,13 @@ namespace internal
       void
       create_blocks_serial(
         const std::vector<unsigned int> &cells_with_comm,
+        const std::vector<unsigned int> &cells_with_comm_rank,
         const unsigned int               dofs_per_cell,
         const bool                       categories_are_hp,
         const std::vector<unsigned int> &cell_vectorization_categories,
         const bool                       cell_vectorization_categories_strict,
         const std::vector<unsigned int> &parent_relation,
+        const std::vector<unsigned int> &cell_order,
         std::vector<unsigned int> &      renumbering,
         std::vector<unsigned char> &     incompletely_filled_vectorization);
 
@@ -458,6 +497,16 @@ namespace internal
        */
       TasksParallelScheme scheme;
 
+      /**
+       * Estimated relative cost of a cell batch for each active FE index. In
+       * hp-mode, make_thread_graph_partition_partition() weights the cell
+       * batches by these numbers when it rounds the size of the second-level
+       * partitions to multiples of the cluster size, so that partitions made
+       * of expensive cell batches contain fewer of them. If empty, all cell
+       * batches count as equally expensive.
+       */
+      std::vector<unsigned int> fe_index_cost;
+
       /**
        * The blocks are organized by a vector-of-vector concept, and this data
        * field @p partition_row_index stores the distance from one 'vector' to
@@ -605,6 +654,25 @@ namespace internal
        */
       std::vector<unsigned char> task_at_mpi_boundary;
 
+      /**
+       * For each partition of cells as given by @p cell_partition_data, the
+       * ranks of the MPI processes owning ghost values that are read by the
+       * cells and faces of the partition, building a range of indices of the
+       * form partition_ghost_ranks[partition_ghost_ranks_index[idx]] to
+       * partition_ghost_ranks[partition_ghost_ranks_index[idx+1]]. If this
+       * field is not empty, the loop without threads processes the
+       * partitions with MPI communication in the order in which the ghost
+       * data of the respective processes arrives, rather than waiting for
+       * the data of all processes before starting any of these partitions.
+       */
+      std::vector<unsigned int> partition_ghost_ranks_index;
+
+      /**
+       * The ranks of the MPI processes for each partition, see
+       * @p partition_ghost_ranks_index.
+       */
+      std::vector<unsigned int> partition_ghost_ranks;
+
       /**
        * MPI communicator
        */
@@ -620,6 +688,20 @@ namespace internal
        */
       bool allow_ghosted_vectors_in_loops;
 
+      /**
+       * Process the cells with MPI communication in the order in which the
+       * ghost data of the neighboring processes arrives, see
+       * @p partition_ghost_ranks_index.
+       */
+      bool overlap_communication_per_process;
+
+      /**
+       * The order in which the cell batches within each partition are
+       * arranged by create_blocks_serial(), see
+       * MatrixFree::AdditionalData::cell_batch_ordering.
+       */
+      CellBatchOrdering cell_batch_ordering;
+
       /**
        * Rank of MPI process
        */
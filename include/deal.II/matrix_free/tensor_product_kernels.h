@@ -1623,7 +1623,17 @@ namespace internal
     // this code may look very inefficient at first sight due to the many
     // different cases with if's at the innermost loop part, but all of the
     // conditionals can be evaluated at compile time because they are
-    // templates, so the compiler should optimize everything away
+    // templates, so the compiler should optimize everything away.
+    //
+    // Note that the stripes i1 are deliberately processed one at a time:
+    // With compile-time loop bounds, the compiler fully unrolls the loop
+    // over 'col' and interleaves the independent accumulation chains of
+    // several output columns, which already keeps the FMA units busy, and
+    // the shape values enter as broadcast memory operands of the FMA
+    // instructions. Blocking two adjacent stripes to re-use the shape values
+    // from registers has been measured to be 5-50% slower for degrees 4 to
+    // 14 with AVX-512, because the additional live registers for xp/xm of
+    // the second stripe cause spills.
     for (int i2 = 0; i2 < n_blocks2; ++i2)
       {
         for (int i1 = 0; i1 < n_blocks1; ++i1)
@@ -18,12 +18,25 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/mg_level_object.h>
+#include <deal.II/base/multithread_info.h>
+#include <deal.II/base/parallel.h>
+#include <deal.II/base/thread_management.h>
+
 #include <deal.II/grid/tria.h>
 
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/vector.h>
+
 #include <deal.II/matrix_free/fe_evaluation.h>
 #include <deal.II/matrix_free/matrix_free.h>
 #include <deal.II/matrix_free/vector_access_internal.h>
 
+#include <deal.II/numerics/vector_tools_common.h>
+
+#include <mutex>
+#include <set>
+
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -43,6 +56,26 @@ namespace MatrixFreeTools
   categorize_by_boundary_ids(const Triangulation<dim> &tria,
                              AdditionalData &          additional_data);
 
+  /**
+   * Refresh the geometry data of the MatrixFree objects on all multigrid
+   * levels given by @p matrix_free after the geometry described by
+   * @p mapping has changed, e.g. after moving the support points of a
+   * MappingQCache in an arbitrary Lagrangian-Eulerian (ALE) simulation. This
+   * calls MatrixFree::update_mapping() on each level. The levels are
+   * processed concurrently, which keeps all threads busy also on the coarse
+   * levels with few cells. Levels with an empty pointer are skipped.
+   *
+   * @note The mapping must provide the geometry of the level cells, e.g. a
+   * MappingQCache initialized on all levels of the triangulation.
+   */
+  template <int dim, typename Number, typename VectorizedArrayType>
+  void
+  update_mapping(
+    const MGLevelObject<
+      std::shared_ptr<MatrixFree<dim, Number, VectorizedArrayType>>>
+      &                 matrix_free,
+    const Mapping<dim> &mapping);
+
   /**
    * Compute the diagonal of a linear operator (@p diagonal_global), given
    * @p matrix_free and the local cell integral operation @p local_vmult. The
@@ -98,12 +131,113 @@ namespace MatrixFreeTools
     const unsigned int quad_no                  = 0,
     const unsigned int first_selected_component = 0);
 
+  /**
+   * Compute the diagonal (@p diagonal_global) of the operator
+   * @f[
+   *   a(u, v) = \alpha (u, v) + \beta (\nabla u, \nabla v)
+   * @f]
+   * with constant coefficients $\alpha$ (@p mass_coefficient) and $\beta$
+   * (@p laplace_coefficient) for a scalar tensor-product element, given
+   * @p matrix_free. The result is the same as the one of compute_diagonal()
+   * with the respective cell operation, but rather than applying the cell
+   * operation to all unit vectors at a cost of $\mathcal O(p^{2d+1})$ per
+   * cell, the tensor-product structure of the shape functions is used: The
+   * diagonal entries are sums over the quadrature points of the geometric
+   * factors times products of squared 1d shape values and derivatives, which
+   * are computed by sum factorization at a cost of $\mathcal O(d^2
+   * p^{d+1})$ per cell.
+   *
+   * Cell batches with hanging-node constraints or other constraints that
+   * couple several degrees of freedom fall back to the algorithm of
+   * compute_diagonal(). Degrees of freedom with homogeneous constraints, such
+   * as Dirichlet boundary conditions, get a zero entry as in
+   * compute_diagonal().
+   *
+   * The vector needs to be initialized with MatrixFree::initialize_dof_vector()
+   * before calling this function, and its content is overwritten. The
+   * MatrixFree object must have been set up with @p update_JxW_values and
+   * @p update_gradients. The parameters @p dof_no, @p quad_no, and
+   * @p first_selected_component are passed to the constructor of the
+   * FEEvaluation that is internally set up.
+   */
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            typename Number,
+            typename VectorizedArrayType,
+            typename VectorType>
+  void
+  compute_diagonal_laplace_like(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    VectorType &                                        diagonal_global,
+    const Number                                        mass_coefficient,
+    const Number                                        laplace_coefficient,
+    const unsigned int                                  dof_no  = 0,
+    const unsigned int                                  quad_no = 0,
+    const unsigned int first_selected_component             = 0);
+
+  /**
+   * Compute the cell matrices of a linear operator given by @p matrix_free
+   * and the local cell integral operation @p local_vmult, e.g. for a block
+   * Jacobi method. The matrix of the cells in one batch is computed in a
+   * single pass, applying the cell operation to the unit vectors of all
+   * SIMD lanes at once, and stored in @p cell_matrices in a vectorized
+   * format: The entry $(i,j)$ of the matrix of cell batch @p cell is at
+   * position <code>(cell * dofs_per_cell + i) * dofs_per_cell + j</code>,
+   * where $i$ and $j$ refer to the numbering of the unknowns in
+   * FEEvaluation::begin_dof_values() and @p dofs_per_cell is
+   * FEEvaluation::dofs_per_cell. This allows to apply the block-diagonal
+   * matrices or their inverses in a loop over cell batches with the data
+   * read by FEEvaluation::read_dof_values(). The vector is resized to the
+   * correct size in this function.
+   *
+   * The matrices represent the cell operator without constraints. The
+   * parameters @p dof_no, @p quad_no, and @p first_selected_component are
+   * passed to the constructor of the FEEvaluation that is internally set up.
+   */
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components,
+            typename Number,
+            typename VectorizedArrayType>
+  void
+  compute_cell_block_diagonal(
+    const MatrixFree<dim, Number, VectorizedArrayType> &            matrix_free,
+    AlignedVector<VectorizedArrayType> &                            cell_matrices,
+    const std::function<void(FEEvaluation<dim,
+                                          fe_degree,
+                                          n_q_points_1d,
+                                          n_components,
+                                          Number,
+                                          VectorizedArrayType> &)> &local_vmult,
+    const unsigned int                                              dof_no  = 0,
+    const unsigned int                                              quad_no = 0,
+    const unsigned int first_selected_component = 0);
+
 
   /**
    * Compute the matrix representation of a linear operator (@p matrix), given
    * @p matrix_free and the local cell integral operation @p local_vmult.
    * Constrained entries on the diagonal are set to one.
    *
+   * The @p matrix needs to be preallocated with a sparsity pattern that
+   * contains all couplings of the cells, e.g., as generated by
+   * DoFTools::make_sparsity_pattern() with the same @p constraints. This
+   * enables to set up a sparse matrix for the coarse level of a multigrid
+   * hierarchy or for an algebraic multigrid preconditioner directly from
+   * the matrix-free operator.
+   *
+   * The cell matrices are computed batch by batch, obtaining the columns of
+   * all lanes of a batch by a single application of @p local_vmult, and
+   * chunks of cell batches are processed in parallel with the task-based
+   * framework of the library, independently of the setting of
+   * MatrixFree::AdditionalData::tasks_parallel_scheme. The insertion into
+   * @p matrix is serialized, such that any of the sparse matrix classes of
+   * deal.II as well as the Trilinos and PETSc wrappers can be used. As a
+   * consequence, @p local_vmult must be safe to be called concurrently from
+   * several threads on different FEEvaluation objects.
+   *
    * The parameters @p dof_no, @p quad_no, and @p first_selected_component are
    * passed to the constructor of the FEEvaluation that is internally set up.
    */
@@ -158,6 +292,196 @@ namespace MatrixFreeTools
 
 
 
+  /**
+   * Compute the error indicator of KellyErrorEstimator for the finite element
+   * field @p solution with the face integrals of MatrixFree, i.e., with
+   * FEFaceEvaluation operating on batches of faces and sum factorization.
+   * The result is the same as the one of KellyErrorEstimator::estimate()
+   * with a coefficient of one, the strategy
+   * KellyErrorEstimator::cell_diameter_over_24, and homogeneous Neumann
+   * conditions on the boundaries listed in @p neumann_boundary_ids: For each
+   * cell $K$,
+   * @f[
+   *   \eta_K^2 = \frac{h_K}{24} \int_{\partial K}
+   *     \left[\frac{\partial u_h}{\partial n}\right]^2 \, ds,
+   * @f]
+   * where the jump is summed over all components and only the normal
+   * derivative $\partial u_h/\partial n$ itself enters on the Neumann
+   * boundaries. The contributions of all other boundary faces are zero.
+   * Faces with hanging nodes are evaluated on the subfaces of the coarser
+   * cell, such that both neighbors see the same integral.
+   *
+   * The vector @p error is resized to the number of active cells of the
+   * triangulation and the indicators are stored at the index
+   * CellAccessor::active_cell_index(). The entries of cells that are not
+   * locally owned are set to zero. On distributed triangulations, where
+   * each face at a processor boundary is processed by only one of the two
+   * processes, the face contributions to ghost cells are sent to their
+   * owners, which makes this function collective.
+   *
+   * The MatrixFree object must have been set up with
+   * @p update_gradients, @p update_JxW_values, and @p update_normal_vectors
+   * in both AdditionalData::mapping_update_flags_inner_faces and
+   * AdditionalData::mapping_update_flags_boundary_faces, and @p solution
+   * needs to be compatible with MatrixFree::initialize_dof_vector(). The
+   * parameters @p dof_no, @p quad_no, and @p first_selected_component are
+   * passed to the constructor of the FEFaceEvaluation objects that are
+   * internally set up; the element must be continuous.
+   */
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components,
+            typename Number,
+            typename VectorizedArrayType,
+            typename VectorType>
+  void
+  estimate_kelly_error(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    const VectorType &                                  solution,
+    Vector<float> &                                     error,
+    const std::set<types::boundary_id> &neumann_boundary_ids = {},
+    const unsigned int                  dof_no               = 0,
+    const unsigned int                  quad_no              = 0,
+    const unsigned int                  first_selected_component = 0);
+
+  /**
+   * Compute the cellwise error of the finite element solution @p solution
+   * with respect to @p exact_solution like
+   * VectorTools::integrate_difference(), but with a single loop over the
+   * cell batches of @p matrix_free: The finite element solution and its
+   * gradient are interpolated to the quadrature points of all cells of a
+   * batch at once with FEEvaluation and the difference to the reference
+   * function is integrated in the same pass. The function @p exact_solution
+   * is evaluated point by point on the quadrature points of the lanes of a
+   * batch, since Function works on scalar points.
+   *
+   * The norms NormType::L2_norm, NormType::H1_seminorm, and
+   * NormType::H1_norm are supported. The vector @p difference is resized to
+   * the number of active cells of the triangulation and contains the error
+   * of each locally owned cell at the index CellAccessor::active_cell_index()
+   * and zero otherwise, such that it can be passed to
+   * VectorTools::compute_global_error().
+   *
+   * The entries of @p solution are read without applying constraints, as
+   * with FEEvaluation::read_dof_values_plain(), so constrained entries must
+   * hold their correct values, e.g., after AffineConstraints::distribute().
+   * The MatrixFree object must have been set up with @p update_values,
+   * @p update_gradients, @p update_JxW_values, and
+   * @p update_quadrature_points, and the mapping and quadrature formula
+   * selected by @p quad_no are used for the integration. The parameters
+   * @p dof_no, @p quad_no, and @p first_selected_component are passed to
+   * the constructor of the FEEvaluation that is internally set up.
+   */
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components,
+            typename Number,
+            typename VectorizedArrayType,
+            typename VectorType,
+            typename OutVector>
+  void
+  integrate_difference(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    const VectorType &                                  solution,
+    const Function<dim, Number> &                       exact_solution,
+    OutVector &                                         difference,
+    const VectorTools::NormType &                       norm,
+    const unsigned int                                  dof_no  = 0,
+    const unsigned int                                  quad_no = 0,
+    const unsigned int first_selected_component             = 0);
+
+  /**
+   * Compute derived quantities of the finite element solution @p solution,
+   * such as the vorticity or the stresses, at the points where
+   * DataOut::build_patches() evaluates the output data, and store them in
+   * the vector @p derived_quantities of a discontinuous output field that
+   * can be passed to DataOut::add_data_vector().
+   *
+   * This function serves the same purpose as a DataPostprocessor, but the
+   * solution is interpolated to the output points with FEEvaluation for a
+   * whole batch of cells at once, the function @p postprocessor computing
+   * the derived quantities works on VectorizedArray data and is inlined
+   * into the loop rather than called through a virtual function, and the
+   * loop over
+   * the cell batches is run with MatrixFree::cell_loop() and hence in
+   * parallel if requested by MatrixFree::AdditionalData::tasks_parallel_scheme.
+   * The function object @p postprocessor is called for each quadrature point
+   * of a cell batch with the FEEvaluation object, on which
+   * FEEvaluation::evaluate() has been called with @p evaluation_flags, and
+   * the index of the quadrature point, and returns the
+   * @p n_output_components derived quantities at this point as a
+   * <tt>Tensor<1, n_output_components, VectorizedArrayType></tt>.
+   *
+   * To produce output with <tt>n_subdivisions</tt> subdivisions, the
+   * MatrixFree object needs to be set up with the quadrature formula
+   * <tt>QIterated<1>(QTrapezoid<1>(), n_subdivisions)</tt> at the index
+   * @p quad_no, whose points are the points DataOut uses, and with a
+   * DoFHandler at the index @p output_dof_no that uses an FE_DGQ element of
+   * degree <tt>n_subdivisions</tt>, or an FESystem of @p n_output_components
+   * such elements, whose nodes coincide with these points. The value of a
+   * derived quantity at a point can then be written to the degree of freedom
+   * of this point, and the vector @p derived_quantities, which needs to be
+   * compatible with MatrixFree::initialize_dof_vector() for @p output_dof_no,
+   * yields the same output as a DataPostprocessor when passed to
+   * DataOut::add_data_vector() together with this DoFHandler and
+   * DataOut::build_patches() is called with <tt>n_subdivisions</tt>. For
+   * example, the vorticity of a two-dimensional velocity field can be written
+   * as follows:
+   * @code
+   *   // matrix_free is set up with {&dof_handler, &dof_handler_dgq} and
+   *   // {QGauss<1>(degree + 1), QIterated<1>(QTrapezoid<1>(), degree)},
+   *   // where dof_handler_dgq uses FE_DGQ<2>(degree)
+   *   MatrixFreeTools::compute_derived_quantities<2, degree, degree + 1, 2, 1>(
+   *     matrix_free,
+   *     velocity,
+   *     vorticity,
+   *     EvaluationFlags::gradients,
+   *     [](const auto &phi, const unsigned int q) {
+   *       Tensor<1, 1, VectorizedArray<double>> result;
+   *       result[0] = phi.get_curl(q)[0];
+   *       return result;
+   *     },
+   *     0,
+   *     1,
+   *     1);
+   *
+   *   data_out.add_data_vector(dof_handler_dgq, vorticity, "vorticity");
+   *   data_out.build_patches(degree);
+   * @endcode
+   *
+   * The entries of @p solution are read with
+   * FEEvaluation::read_dof_values_plain(), so constrained entries must hold
+   * their correct values, e.g., after AffineConstraints::distribute(). The
+   * MatrixFree object must have been set up with the update flags needed by
+   * @p evaluation_flags and by @p postprocessor in
+   * MatrixFree::AdditionalData::mapping_update_flags. The parameters
+   * @p dof_no, @p quad_no, and @p first_selected_component are passed to the
+   * constructor of the FEEvaluation that is internally set up to evaluate
+   * @p solution.
+   */
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components,
+            int n_output_components,
+            typename Number,
+            typename VectorizedArrayType,
+            typename VectorType,
+            typename PostprocessorType>
+  void
+  compute_derived_quantities(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    const VectorType &                                  solution,
+    VectorType &                                        derived_quantities,
+    const EvaluationFlags::EvaluationFlags              evaluation_flags,
+    const PostprocessorType &                           postprocessor,
+    const unsigned int                                  dof_no,
+    const unsigned int                                  output_dof_no,
+    const unsigned int                                  quad_no,
+    const unsigned int first_selected_component = 0);
+
   /**
    * A wrapper around MatrixFree to help users to deal with DoFHandler
    * objects involving cells without degrees of freedom, i.e.,
@@ -417,6 +741,25 @@ namespace MatrixFreeTools
       additional_data.mapping_update_flags_boundary_faces;
   }
 
+  template <int dim, typename Number, typename VectorizedArrayType>
+  void
+  update_mapping(
+    const MGLevelObject<
+      std::shared_ptr<MatrixFree<dim, Number, VectorizedArrayType>>>
+      &                 matrix_free,
+    const Mapping<dim> &mapping)
+  {
+    Threads::TaskGroup<> tasks;
+    for (unsigned int level = matrix_free.min_level();
+         level <= matrix_free.max_level();
+         ++level)
+      if (matrix_free[level] != nullptr)
+        tasks += Threads::new_task([&matrix_free, &mapping, level]() {
+          matrix_free[level]->update_mapping(mapping);
+        });
+    tasks.join_all();
+  }
+
   namespace internal
   {
     template <typename Number>
@@ -1124,6 +1467,340 @@ namespace MatrixFreeTools
       first_selected_component);
   }
 
+  namespace internal
+  {
+    /**
+     * Contract the quadrature point data @p data of size n_q_points_1d^dim
+     * with the 1d matrices @p shapes (of size n_dofs_1d * n_q_points_1d,
+     * quadrature points running fastest), one for each direction, and add
+     * the result to @p result of size n_dofs_1d^dim. The arrays @p tmp0 and
+     * @p tmp1 need to hold max(n_dofs_1d, n_q_points_1d)^dim entries each.
+     */
+    template <int dim, typename Number>
+    void
+    contract_tensor_product_diagonal(
+      const std::array<const Number *, dim> &shapes,
+      const unsigned int                     n_dofs_1d,
+      const unsigned int                     n_q_points_1d,
+      const Number *                         data,
+      Number *                               tmp0,
+      Number *                               tmp1,
+      Number *                               result)
+    {
+      const Number *in      = data;
+      unsigned int  n_inner = 1;
+      unsigned int  n_outer = Utilities::pow(n_q_points_1d, dim - 1);
+      Number *      tmp[2]  = {tmp0, tmp1};
+      for (unsigned int d = 0; d < dim; ++d)
+        {
+          Number *out = tmp[d % 2];
+          for (unsigned int o = 0; o < n_outer; ++o)
+            for (unsigned int i = 0; i < n_dofs_1d; ++i)
+              for (unsigned int l = 0; l < n_inner; ++l)
+                {
+                  Number sum = shapes[d][i * n_q_points_1d] *
+                               in[o * n_q_points_1d * n_inner + l];
+                  for (unsigned int q = 1; q < n_q_points_1d; ++q)
+                    sum += shapes[d][i * n_q_points_1d + q] *
+                           in[(o * n_q_points_1d + q) * n_inner + l];
+                  out[(o * n_dofs_1d + i) * n_inner + l] = sum;
+                }
+          in = out;
+          n_inner *= n_dofs_1d;
+          if (d + 1 < dim)
+            n_outer /= n_q_points_1d;
+        }
+      for (unsigned int i = 0; i < n_inner; ++i)
+        result[i] += in[i];
+    }
+  } // namespace internal
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            typename Number,
+            typename VectorizedArrayType,
+            typename VectorType>
+  void
+  compute_diagonal_laplace_like(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    VectorType &                                        diagonal_global,
+    const Number                                        mass_coefficient,
+    const Number                                        laplace_coefficient,
+    const unsigned int                                  dof_no,
+    const unsigned int                                  quad_no,
+    const unsigned int first_selected_component)
+  {
+    using FEEvalType =
+      FEEvaluation<dim, fe_degree, n_q_points_1d, 1, Number, VectorizedArrayType>;
+
+    // the cell operation for the cell batches with general constraints
+    const auto local_vmult = [&](FEEvalType &phi) {
+      EvaluationFlags::EvaluationFlags flags = EvaluationFlags::nothing;
+      if (mass_coefficient != Number())
+        flags |= EvaluationFlags::values;
+      if (laplace_coefficient != Number())
+        flags |= EvaluationFlags::gradients;
+      phi.evaluate(flags);
+      for (const unsigned int q : phi.quadrature_point_indices())
+        {
+          if (mass_coefficient != Number())
+            phi.submit_value(mass_coefficient * phi.get_value(q), q);
+          if (laplace_coefficient != Number())
+            phi.submit_gradient(laplace_coefficient * phi.get_gradient(q), q);
+        }
+      phi.integrate(flags);
+    };
+
+    int dummy = 0;
+    matrix_free.template cell_loop<VectorType, int>(
+      [&](const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+          VectorType &                                        diagonal,
+          const int &,
+          const std::pair<unsigned int, unsigned int> &range) {
+        FEEvalType phi(
+          matrix_free, range, dof_no, quad_no, first_selected_component);
+
+        const auto &shape_info = phi.get_shape_info();
+        Assert(shape_info.element_type <=
+                 dealii::internal::MatrixFreeFunctions::tensor_general,
+               ExcNotImplemented());
+        const auto &       shape_data     = shape_info.data.front();
+        const unsigned int n_dofs_1d      = shape_data.fe_degree + 1;
+        const unsigned int n_q_points_1d_ = shape_data.n_q_points_1d;
+        AssertDimension(Utilities::pow(n_dofs_1d, dim), phi.dofs_per_cell);
+        AssertDimension(Utilities::pow(n_q_points_1d_, dim), phi.n_q_points);
+
+        // the products of 1d shape values and derivatives that appear in the
+        // diagonal entries of the mass and Laplace matrices
+        AlignedVector<VectorizedArrayType> values_values(n_dofs_1d *
+                                                         n_q_points_1d_);
+        AlignedVector<VectorizedArrayType> values_gradients(n_dofs_1d *
+                                                            n_q_points_1d_);
+        AlignedVector<VectorizedArrayType> gradients_gradients(
+          n_dofs_1d * n_q_points_1d_);
+        for (unsigned int i = 0; i < n_dofs_1d * n_q_points_1d_; ++i)
+          {
+            values_values[i] =
+              shape_data.shape_values[i] * shape_data.shape_values[i];
+            values_gradients[i] =
+              shape_data.shape_values[i] * shape_data.shape_gradients[i];
+            gradients_gradients[i] =
+              shape_data.shape_gradients[i] * shape_data.shape_gradients[i];
+          }
+
+        const unsigned int n_entries =
+          Utilities::pow(std::max(n_dofs_1d, n_q_points_1d_), dim);
+        AlignedVector<VectorizedArrayType> quadrature_data(phi.n_q_points);
+        AlignedVector<VectorizedArrayType> tmp0(n_entries), tmp1(n_entries);
+
+        internal::ComputeDiagonalHelper<dim,
+                                        fe_degree,
+                                        n_q_points_1d,
+                                        1,
+                                        Number,
+                                        VectorizedArrayType>
+          helper(phi);
+        std::array<VectorType *, 1> diagonal_components = {{&diagonal}};
+
+        const auto &       dof_info        = phi.get_dof_info();
+        const unsigned int n_fe_components = dof_info.start_components.back();
+        constexpr unsigned int n_lanes = VectorizedArrayType::size();
+
+        for (unsigned int cell = range.first; cell < range.second; ++cell)
+          {
+            // check whether some of the lanes have constraints other than
+            // homogeneous ones, which couple the diagonal with further
+            // entries of the cell matrix
+            bool has_general_constraints = false;
+            for (unsigned int v = 0;
+                 v < matrix_free.n_active_entries_per_cell_batch(cell);
+                 ++v)
+              {
+                const unsigned int index =
+                  (cell * n_lanes + v) * n_fe_components +
+                  (n_fe_components == 1 ? 0 : first_selected_component);
+                for (unsigned int c = dof_info.row_starts[index].second;
+                     c < dof_info.row_starts[index + 1].second;
+                     ++c)
+                  if (matrix_free.constraint_pool_begin(
+                        dof_info.constraint_indicator[c].second) !=
+                      matrix_free.constraint_pool_end(
+                        dof_info.constraint_indicator[c].second))
+                    has_general_constraints = true;
+                if (dof_info.hanging_node_constraint_masks.size() > 0 &&
+                    dof_info.hanging_node_constraint_masks_comp.size() > 0 &&
+                    dof_info.hanging_node_constraint_masks[cell * n_lanes +
+                                                           v] !=
+                      dealii::internal::MatrixFreeFunctions::
+                        unconstrained_compressed_constraint_kind &&
+                    dof_info.hanging_node_constraint_masks_comp
+                      [phi.get_active_fe_index()][first_selected_component])
+                  has_general_constraints = true;
+              }
+
+            if (has_general_constraints)
+              {
+                helper.reinit(cell);
+                for (unsigned int i = 0; i < phi.dofs_per_cell; ++i)
+                  {
+                    helper.prepare_basis_vector(i);
+                    local_vmult(phi);
+                    helper.submit();
+                  }
+                helper.distribute_local_to_global(diagonal_components);
+                continue;
+              }
+
+            phi.reinit(cell);
+            VectorizedArrayType *diagonal_local = phi.begin_dof_values();
+            for (unsigned int i = 0; i < phi.dofs_per_cell; ++i)
+              diagonal_local[i] = VectorizedArrayType();
+
+            std::array<const VectorizedArrayType *, dim> shapes;
+
+            // mass matrix: squared values in all directions
+            if (mass_coefficient != Number())
+              {
+                for (const unsigned int q : phi.quadrature_point_indices())
+                  quadrature_data[q] = mass_coefficient * phi.JxW(q);
+                shapes.fill(values_values.data());
+                internal::contract_tensor_product_diagonal<dim>(
+                  shapes,
+                  n_dofs_1d,
+                  n_q_points_1d_,
+                  quadrature_data.data(),
+                  tmp0.data(),
+                  tmp1.data(),
+                  diagonal_local);
+              }
+
+            // Laplace matrix: the gradient in real space is J^{-T} times the
+            // unit gradient, so the contributions are the entries of the
+            // metric tensor J^{-1} J^{-T} times products of derivatives in
+            // two directions and values in the other directions
+            if (laplace_coefficient != Number())
+              for (unsigned int e = 0; e < dim; ++e)
+                for (unsigned int f = e; f < dim; ++f)
+                  {
+                    // off-diagonal entries of the metric tensor vanish on
+                    // Cartesian cells
+                    if (e != f && phi.get_cell_type() ==
+                                    dealii::internal::MatrixFreeFunctions::
+                                      cartesian)
+                      continue;
+
+                    const Number factor =
+                      (e == f ? 1. : 2.) * laplace_coefficient;
+                    for (const unsigned int q : phi.quadrature_point_indices())
+                      {
+                        const Tensor<2, dim, VectorizedArrayType> inv_jac =
+                          phi.inverse_jacobian(q);
+                        VectorizedArrayType metric =
+                          inv_jac[0][e] * inv_jac[0][f];
+                        for (unsigned int d = 1; d < dim; ++d)
+                          metric += inv_jac[d][e] * inv_jac[d][f];
+                        quadrature_data[q] = factor * metric * phi.JxW(q);
+                      }
+                    for (unsigned int d = 0; d < dim; ++d)
+                      shapes[d] =
+                        (d == e && d == f) ?
+                          gradients_gradients.data() :
+                          ((d == e || d == f) ? values_gradients.data() :
+                                                values_values.data());
+                    internal::contract_tensor_product_diagonal<dim>(
+                      shapes,
+                      n_dofs_1d,
+                      n_q_points_1d_,
+                      quadrature_data.data(),
+                      tmp0.data(),
+                      tmp1.data(),
+                      diagonal_local);
+                  }
+
+            phi.distribute_local_to_global(diagonal);
+          }
+      },
+      diagonal_global,
+      dummy,
+      true);
+  }
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components,
+            typename Number,
+            typename VectorizedArrayType>
+  void
+  compute_cell_block_diagonal(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    AlignedVector<VectorizedArrayType> &                cell_matrices,
+    const std::function<void(FEEvaluation<dim,
+                                          fe_degree,
+                                          n_q_points_1d,
+                                          n_components,
+                                          Number,
+                                          VectorizedArrayType> &)> &local_vmult,
+    const unsigned int                                              dof_no,
+    const unsigned int                                              quad_no,
+    const unsigned int first_selected_component)
+  {
+    Assert(matrix_free.get_dof_handler(dof_no).get_fe_collection().size() == 1,
+           ExcNotImplemented());
+
+    FEEvaluation<dim,
+                 fe_degree,
+                 n_q_points_1d,
+                 n_components,
+                 Number,
+                 VectorizedArrayType>
+                       phi(matrix_free, dof_no, quad_no, first_selected_component);
+    const unsigned int dofs_per_cell = phi.dofs_per_cell;
+
+    cell_matrices.resize_fast(static_cast<std::size_t>(
+                                matrix_free.n_cell_batches()) *
+                              dofs_per_cell * dofs_per_cell);
+
+    int dummy = 0;
+    matrix_free.template cell_loop<int, int>(
+      [&](const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+          int &,
+          const int &,
+          const std::pair<unsigned int, unsigned int> &range) {
+        FEEvaluation<dim,
+                     fe_degree,
+                     n_q_points_1d,
+                     n_components,
+                     Number,
+                     VectorizedArrayType>
+          phi(matrix_free, range, dof_no, quad_no, first_selected_component);
+
+        for (unsigned int cell = range.first; cell < range.second; ++cell)
+          {
+            phi.reinit(cell);
+            VectorizedArrayType *matrix =
+              cell_matrices.data() +
+              static_cast<std::size_t>(cell) * dofs_per_cell * dofs_per_cell;
+
+            // the unit vectors are applied to all SIMD lanes at once, giving
+            // column j of the matrices of all cells in the batch
+            for (unsigned int j = 0; j < dofs_per_cell; ++j)
+              {
+                for (unsigned int i = 0; i < dofs_per_cell; ++i)
+                  phi.begin_dof_values()[i] = static_cast<Number>(i == j);
+
+                local_vmult(phi);
+
+                for (unsigned int i = 0; i < dofs_per_cell; ++i)
+                  matrix[i * dofs_per_cell + j] = phi.begin_dof_values()[i];
+              }
+          }
+      },
+      dummy,
+      dummy);
+  }
+
   namespace internal
   {
     /**
@@ -1202,84 +1879,124 @@ namespace MatrixFreeTools
                                                         constraints_in,
                                                         constraints_for_matrix);
 
-    matrix_free.template cell_loop<MatrixType, MatrixType>(
-      [&](const auto &, auto &dst, const auto &, const auto range) {
-        FEEvaluation<dim,
-                     fe_degree,
-                     n_q_points_1d,
-                     n_components,
-                     Number,
-                     VectorizedArrayType>
-          integrator(
-            matrix_free, range, dof_no, quad_no, first_selected_component);
-
-        const unsigned int dofs_per_cell = integrator.dofs_per_cell;
-
-        std::vector<types::global_dof_index> dof_indices(dofs_per_cell);
-        std::vector<types::global_dof_index> dof_indices_mf(dofs_per_cell);
+    // split the locally owned cell batches into chunks with a uniform
+    // active FE index, which are then processed by independent tasks
+    const unsigned int n_cell_batches = matrix_free.n_cell_batches();
+    const unsigned int chunk_size =
+      std::max(1U, n_cell_batches / (4 * MultithreadInfo::n_threads()));
 
-        std::array<FullMatrix<typename MatrixType::value_type>,
-                   VectorizedArrayType::size()>
-          matrices;
-
-        std::fill_n(matrices.begin(),
-                    VectorizedArrayType::size(),
-                    FullMatrix<typename MatrixType::value_type>(dofs_per_cell,
-                                                                dofs_per_cell));
+    std::vector<std::pair<unsigned int, unsigned int>> chunks;
+    for (unsigned int cell = 0; cell < n_cell_batches;)
+      {
+        const unsigned int fe_index =
+          matrix_free.get_cell_active_fe_index({cell, cell + 1});
+        unsigned int end = cell + 1;
+        while (end < n_cell_batches && end - cell < chunk_size &&
+               matrix_free.get_cell_active_fe_index({end, end + 1}) ==
+                 fe_index)
+          ++end;
+        chunks.emplace_back(cell, end);
+        cell = end;
+      }
 
-        const auto lexicographic_numbering =
-          matrix_free
-            .get_shape_info(dof_no,
-                            quad_no,
-                            first_selected_component,
-                            integrator.get_active_fe_index(),
-                            integrator.get_active_quadrature_index())
-            .lexicographic_numbering;
+    // the cell matrices are computed concurrently, whereas the insertion
+    // into the global matrix is serialized because neither the sparse
+    // matrix classes of deal.II nor the wrappers to Trilinos and PETSc
+    // support concurrent writes
+    std::mutex mutex;
 
-        for (auto cell = range.first; cell < range.second; ++cell)
-          {
-            integrator.reinit(cell);
+    const auto compute_chunk = [&](const std::pair<unsigned int, unsigned int>
+                                     range) {
+      FEEvaluation<dim,
+                   fe_degree,
+                   n_q_points_1d,
+                   n_components,
+                   Number,
+                   VectorizedArrayType>
+        integrator(
+          matrix_free, range, dof_no, quad_no, first_selected_component);
+
+      const unsigned int dofs_per_cell = integrator.dofs_per_cell;
+
+      std::vector<types::global_dof_index> dof_indices(dofs_per_cell);
+      std::array<std::vector<types::global_dof_index>,
+                 VectorizedArrayType::size()>
+        dof_indices_mf;
+      std::fill_n(dof_indices_mf.begin(),
+                  VectorizedArrayType::size(),
+                  std::vector<types::global_dof_index>(dofs_per_cell));
+
+      std::array<FullMatrix<typename MatrixType::value_type>,
+                 VectorizedArrayType::size()>
+        matrices;
+
+      std::fill_n(matrices.begin(),
+                  VectorizedArrayType::size(),
+                  FullMatrix<typename MatrixType::value_type>(dofs_per_cell,
+                                                              dofs_per_cell));
+
+      const auto lexicographic_numbering =
+        matrix_free
+          .get_shape_info(dof_no,
+                          quad_no,
+                          first_selected_component,
+                          integrator.get_active_fe_index(),
+                          integrator.get_active_quadrature_index())
+          .lexicographic_numbering;
+
+      for (auto cell = range.first; cell < range.second; ++cell)
+        {
+          integrator.reinit(cell);
 
-            const unsigned int n_filled_lanes =
-              matrix_free.n_active_entries_per_cell_batch(cell);
+          const unsigned int n_filled_lanes =
+            matrix_free.n_active_entries_per_cell_batch(cell);
 
-            for (unsigned int v = 0; v < n_filled_lanes; ++v)
-              matrices[v] = 0.0;
+          // all lanes of the batch are filled by a single application of
+          // the cell operation per unit vector
+          for (unsigned int j = 0; j < dofs_per_cell; ++j)
+            {
+              for (unsigned int i = 0; i < dofs_per_cell; ++i)
+                integrator.begin_dof_values()[i] = static_cast<Number>(i == j);
 
-            for (unsigned int j = 0; j < dofs_per_cell; ++j)
-              {
-                for (unsigned int i = 0; i < dofs_per_cell; ++i)
-                  integrator.begin_dof_values()[i] =
-                    static_cast<Number>(i == j);
+              local_vmult(integrator);
 
-                local_vmult(integrator);
+              for (unsigned int i = 0; i < dofs_per_cell; ++i)
+                for (unsigned int v = 0; v < n_filled_lanes; ++v)
+                  matrices[v](i, j) = integrator.begin_dof_values()[i][v];
+            }
 
-                for (unsigned int i = 0; i < dofs_per_cell; ++i)
-                  for (unsigned int v = 0; v < n_filled_lanes; ++v)
-                    matrices[v](i, j) = integrator.begin_dof_values()[i][v];
-              }
+          for (unsigned int v = 0; v < n_filled_lanes; ++v)
+            {
+              const auto cell_v =
+                matrix_free.get_cell_iterator(cell, v, dof_no);
 
-            for (unsigned int v = 0; v < n_filled_lanes; ++v)
-              {
-                const auto cell_v =
-                  matrix_free.get_cell_iterator(cell, v, dof_no);
+              if (matrix_free.get_mg_level() != numbers::invalid_unsigned_int)
+                cell_v->get_mg_dof_indices(dof_indices);
+              else
+                cell_v->get_dof_indices(dof_indices);
 
-                if (matrix_free.get_mg_level() != numbers::invalid_unsigned_int)
-                  cell_v->get_mg_dof_indices(dof_indices);
-                else
-                  cell_v->get_dof_indices(dof_indices);
+              for (unsigned int j = 0; j < dof_indices.size(); ++j)
+                dof_indices_mf[v][j] = dof_indices[lexicographic_numbering[j]];
+            }
 
-                for (unsigned int j = 0; j < dof_indices.size(); ++j)
-                  dof_indices_mf[j] = dof_indices[lexicographic_numbering[j]];
+          // write all lanes of the batch with a single acquisition of the
+          // lock
+          std::lock_guard<std::mutex> lock(mutex);
+          for (unsigned int v = 0; v < n_filled_lanes; ++v)
+            constraints.distribute_local_to_global(matrices[v],
+                                                   dof_indices_mf[v],
+                                                   matrix);
+        }
+    };
 
-                constraints.distribute_local_to_global(matrices[v],
-                                                       dof_indices_mf,
-                                                       dst);
-              }
-          }
+    parallel::apply_to_subranges(
+      0U,
+      static_cast<unsigned int>(chunks.size()),
+      [&](const unsigned int begin, const unsigned int end) {
+        for (unsigned int c = begin; c < end; ++c)
+          compute_chunk(chunks[c]);
       },
-      matrix,
-      matrix);
+      1);
 
     matrix.compress(VectorOperation::add);
   }
@@ -1324,6 +2041,402 @@ namespace MatrixFreeTools
       first_selected_component);
   }
 
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components,
+            typename Number,
+            typename VectorizedArrayType,
+            typename VectorType>
+  void
+  estimate_kelly_error(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    const VectorType &                                  solution,
+    Vector<float> &                                     error,
+    const std::set<types::boundary_id> &                neumann_boundary_ids,
+    const unsigned int                                  dof_no,
+    const unsigned int                                  quad_no,
+    const unsigned int first_selected_component)
+  {
+    using FaceEvaluationType = FEFaceEvaluation<dim,
+                                                fe_degree,
+                                                n_q_points_1d,
+                                                n_components,
+                                                Number,
+                                                VectorizedArrayType>;
+
+    // squared jump of the normal derivative integrated over each face batch,
+    // with one slot per batch such that the face loop can run in parallel
+    AlignedVector<VectorizedArrayType> face_integrals(
+      matrix_free.n_inner_face_batches() +
+        matrix_free.n_boundary_face_batches(),
+      VectorizedArrayType());
+
+    int dummy = 0;
+    matrix_free.template loop<int, VectorType>(
+      [](const MatrixFree<dim, Number, VectorizedArrayType> &,
+         int &,
+         const VectorType &,
+         const std::pair<unsigned int, unsigned int> &) {},
+      [&](const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+          int &,
+          const VectorType &                           src,
+          const std::pair<unsigned int, unsigned int> &range) {
+        FaceEvaluationType phi_m(
+          matrix_free, true, dof_no, quad_no, first_selected_component);
+        FaceEvaluationType phi_p(
+          matrix_free, false, dof_no, quad_no, first_selected_component);
+
+        for (unsigned int face = range.first; face < range.second; ++face)
+          {
+            phi_m.reinit(face);
+            phi_m.gather_evaluate(src, EvaluationFlags::gradients);
+            phi_p.reinit(face);
+            phi_p.gather_evaluate(src, EvaluationFlags::gradients);
+
+            // both evaluators use the normal vector of the interior side
+            VectorizedArrayType integral = VectorizedArrayType();
+            for (unsigned int q = 0; q < phi_m.n_q_points; ++q)
+              {
+                const auto jump = phi_m.get_normal_derivative(q) -
+                                  phi_p.get_normal_derivative(q);
+                integral += (jump * jump) * phi_m.JxW(q);
+              }
+            face_integrals[face] = integral;
+          }
+      },
+      [&](const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+          int &,
+          const VectorType &                           src,
+          const std::pair<unsigned int, unsigned int> &range) {
+        if (neumann_boundary_ids.empty())
+          return;
+
+        FaceEvaluationType phi(
+          matrix_free, true, dof_no, quad_no, first_selected_component);
+
+        for (unsigned int face = range.first; face < range.second; ++face)
+          {
+            if (neumann_boundary_ids.find(matrix_free.get_boundary_id(face)) ==
+                neumann_boundary_ids.end())
+              continue;
+
+            phi.reinit(face);
+            phi.gather_evaluate(src, EvaluationFlags::gradients);
+
+            VectorizedArrayType integral = VectorizedArrayType();
+            for (unsigned int q = 0; q < phi.n_q_points; ++q)
+              {
+                const auto normal_derivative = phi.get_normal_derivative(q);
+                integral +=
+                  (normal_derivative * normal_derivative) * phi.JxW(q);
+              }
+            face_integrals[face] = integral;
+          }
+      },
+      dummy,
+      solution,
+      false,
+      MatrixFree<dim, Number, VectorizedArrayType>::DataAccessOnFaces::
+        gradients,
+      MatrixFree<dim, Number, VectorizedArrayType>::DataAccessOnFaces::
+        gradients);
+
+    // add the face integrals to the adjacent cells, using a vector over the
+    // global active cell indices to send the contributions to ghost cells
+    // to their owners
+    const Triangulation<dim> &tria =
+      matrix_free.get_dof_handler(dof_no).get_triangulation();
+    LinearAlgebra::distributed::Vector<double> cell_integrals(
+      tria.global_active_cell_index_partitioner().lock());
+
+    const unsigned int n_inner_face_batches =
+      matrix_free.n_inner_face_batches();
+    for (unsigned int face = 0; face < face_integrals.size(); ++face)
+      for (unsigned int v = 0;
+           v < matrix_free.n_active_entries_per_face_batch(face);
+           ++v)
+        {
+          const double integral = face_integrals[face][v];
+          if (integral == 0.)
+            continue;
+
+          cell_integrals(matrix_free.get_face_iterator(face, v, true, dof_no)
+                           .first->global_active_cell_index()) += integral;
+          if (face < n_inner_face_batches)
+            cell_integrals(
+              matrix_free.get_face_iterator(face, v, false, dof_no)
+                .first->global_active_cell_index()) += integral;
+        }
+    cell_integrals.compress(VectorOperation::add);
+
+    error.reinit(tria.n_active_cells());
+    for (const auto &cell : tria.active_cell_iterators())
+      if (cell->is_locally_owned())
+        error[cell->active_cell_index()] = std::sqrt(
+          cell_integrals(cell->global_active_cell_index()) * cell->diameter() /
+          24.);
+  }
+
+  namespace internal
+  {
+    /**
+     * Return component @p c of a value or gradient of FEEvaluation, where
+     * the last argument indicates whether the FEEvaluation object has a
+     * single component and thus returns the value itself.
+     */
+    template <typename Type>
+    inline const Type &
+    get_component(const Type &value, const unsigned int, std::true_type)
+    {
+      return value;
+    }
+
+
+
+    template <int n_components, typename Type>
+    inline const Type &
+    get_component(const Tensor<1, n_components, Type> &value,
+                  const unsigned int                  c,
+                  std::false_type)
+    {
+      return value[c];
+    }
+
+
+
+    template <int n, typename Type>
+    inline const Tensor<1, n, Type> &
+    get_component(const Tensor<2, n, Type> &value,
+                  const unsigned int        c,
+                  std::false_type)
+    {
+      return value[c];
+    }
+  } // namespace internal
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components,
+            typename Number,
+            typename VectorizedArrayType,
+            typename VectorType,
+            typename OutVector>
+  void
+  integrate_difference(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    const VectorType &                                  solution,
+    const Function<dim, Number> &                       exact_solution,
+    OutVector &                                         difference,
+    const VectorTools::NormType &                       norm,
+    const unsigned int                                  dof_no,
+    const unsigned int                                  quad_no,
+    const unsigned int first_selected_component)
+  {
+    Assert(norm == VectorTools::L2_norm || norm == VectorTools::H1_seminorm ||
+             norm == VectorTools::H1_norm,
+           ExcNotImplemented());
+    AssertDimension(exact_solution.n_components, n_components);
+
+    const bool need_values = (norm != VectorTools::H1_seminorm);
+    const bool need_gradients = (norm != VectorTools::L2_norm);
+    const EvaluationFlags::EvaluationFlags evaluation_flags =
+      (need_values ? EvaluationFlags::values : EvaluationFlags::nothing) |
+      (need_gradients ? EvaluationFlags::gradients : EvaluationFlags::nothing);
+    const std::integral_constant<bool, n_components == 1> is_scalar;
+
+    AlignedVector<VectorizedArrayType> cell_errors(
+      matrix_free.n_cell_batches());
+
+    int dummy = 0;
+    matrix_free.template cell_loop<int, VectorType>(
+      [&](const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+          int &,
+          const VectorType &                           src,
+          const std::pair<unsigned int, unsigned int> &range) {
+        FEEvaluation<dim,
+                     fe_degree,
+                     n_q_points_1d,
+                     n_components,
+                     Number,
+                     VectorizedArrayType>
+          phi(matrix_free, range, dof_no, quad_no, first_selected_component);
+
+        for (unsigned int cell = range.first; cell < range.second; ++cell)
+          {
+            phi.reinit(cell);
+            phi.read_dof_values_plain(src);
+            phi.evaluate(evaluation_flags);
+
+            const unsigned int n_lanes =
+              matrix_free.n_active_entries_per_cell_batch(cell);
+            VectorizedArrayType error = VectorizedArrayType();
+            for (unsigned int q = 0; q < phi.n_q_points; ++q)
+              {
+                const Point<dim, VectorizedArrayType> point_batch =
+                  phi.quadrature_point(q);
+                std::array<VectorizedArrayType, n_components> exact_values =
+                  {};
+                std::array<Tensor<1, dim, VectorizedArrayType>, n_components>
+                  exact_gradients;
+                for (unsigned int v = 0; v < n_lanes; ++v)
+                  {
+                    Point<dim> point;
+                    for (unsigned int d = 0; d < dim; ++d)
+                      point[d] = point_batch[d][v];
+                    for (unsigned int c = 0; c < n_components; ++c)
+                      {
+                        if (need_values)
+                          exact_values[c][v] = exact_solution.value(point, c);
+                        if (need_gradients)
+                          {
+                            const Tensor<1, dim, Number> gradient =
+                              exact_solution.gradient(point, c);
+                            for (unsigned int d = 0; d < dim; ++d)
+                              exact_gradients[c][d][v] = gradient[d];
+                          }
+                      }
+                  }
+
+                VectorizedArrayType local_error = VectorizedArrayType();
+                if (need_values)
+                  {
+                    const auto value = phi.get_value(q);
+                    for (unsigned int c = 0; c < n_components; ++c)
+                      {
+                        const VectorizedArrayType diff =
+                          internal::get_component(value, c, is_scalar) -
+                          exact_values[c];
+                        local_error += diff * diff;
+                      }
+                  }
+                if (need_gradients)
+                  {
+                    const auto gradient = phi.get_gradient(q);
+                    for (unsigned int c = 0; c < n_components; ++c)
+                      {
+                        const Tensor<1, dim, VectorizedArrayType> diff =
+                          internal::get_component(gradient, c, is_scalar) -
+                          exact_gradients[c];
+                        local_error += diff * diff;
+                      }
+                  }
+                error += local_error * phi.JxW(q);
+              }
+            cell_errors[cell] = error;
+          }
+      },
+      dummy,
+      solution);
+
+    difference.reinit(matrix_free.get_dof_handler(dof_no)
+                        .get_triangulation()
+                        .n_active_cells());
+    for (unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+      for (unsigned int v = 0;
+           v < matrix_free.n_active_entries_per_cell_batch(cell);
+           ++v)
+        difference[matrix_free.get_cell_iterator(cell, v, dof_no)
+                     ->active_cell_index()] = std::sqrt(cell_errors[cell][v]);
+  }
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components,
+            int n_output_components,
+            typename Number,
+            typename VectorizedArrayType,
+            typename VectorType,
+            typename PostprocessorType>
+  void
+  compute_derived_quantities(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    const VectorType &                                  solution,
+    VectorType &                                        derived_quantities,
+    const EvaluationFlags::EvaluationFlags              evaluation_flags,
+    const PostprocessorType &                           postprocessor,
+    const unsigned int                                  dof_no,
+    const unsigned int                                  output_dof_no,
+    const unsigned int                                  quad_no,
+    const unsigned int first_selected_component)
+  {
+    // The output element has as many nodes per direction as there are
+    // quadrature points
+    constexpr int output_degree = (fe_degree == -1) ? -1 : n_q_points_1d - 1;
+
+    AssertDimension(
+      matrix_free.get_dof_handler(output_dof_no).get_fe().n_components(),
+      n_output_components);
+#ifdef DEBUG
+    {
+      // The output element must be nodal in the quadrature points, i.e., its
+      // 1d shape functions evaluated in the quadrature points must be the
+      // identity matrix. The shape data is stored in vectorized form with
+      // the same value in all lanes.
+      const auto &shape_data =
+        matrix_free.get_shape_info(output_dof_no, quad_no).data.front();
+      Assert(shape_data.fe_degree + 1 == shape_data.n_q_points_1d,
+             ExcMessage("The number of 1d quadrature points must be one more "
+                        "than the degree of the output element."));
+      for (unsigned int i = 0; i < shape_data.n_q_points_1d; ++i)
+        for (unsigned int q = 0; q < shape_data.n_q_points_1d; ++q)
+          Assert(std::abs(shape_data.shape_values[i * shape_data.n_q_points_1d +
+                                                  q][0] -
+                          (i == q ? 1. : 0.)) < 1e-6,
+                 ExcMessage("The nodes of the output element must coincide "
+                            "with the quadrature points."));
+    }
+#endif
+
+    matrix_free.template cell_loop<VectorType, VectorType>(
+      [&](const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+          VectorType &                                        dst,
+          const VectorType &                                  src,
+          const std::pair<unsigned int, unsigned int> &       range) {
+        FEEvaluation<dim,
+                     fe_degree,
+                     n_q_points_1d,
+                     n_components,
+                     Number,
+                     VectorizedArrayType>
+          phi(matrix_free, range, dof_no, quad_no, first_selected_component);
+        FEEvaluation<dim,
+                     output_degree,
+                     n_q_points_1d,
+                     n_output_components,
+                     Number,
+                     VectorizedArrayType>
+          phi_output(matrix_free, range, output_dof_no, quad_no);
+
+        for (unsigned int cell = range.first; cell < range.second; ++cell)
+          {
+            phi.reinit(cell);
+            phi.read_dof_values_plain(src);
+            phi.evaluate(evaluation_flags);
+            phi_output.reinit(cell);
+
+            // Since the output element is nodal in the quadrature points, the
+            // derived quantities are the values of its degrees of freedom
+            VectorizedArrayType *output_values = phi_output.begin_dof_values();
+            for (unsigned int q = 0; q < phi.n_q_points; ++q)
+              {
+                const Tensor<1, n_output_components, VectorizedArrayType>
+                  result = postprocessor(phi, q);
+                for (unsigned int c = 0; c < n_output_components; ++c)
+                  output_values[c * phi_output.dofs_per_component + q] =
+                    result[c];
+              }
+            phi_output.set_dof_values_plain(dst);
+          }
+      },
+      derived_quantities,
+      solution);
+  }
+
 #endif // DOXYGEN
 
 } // namespace MatrixFreeTools
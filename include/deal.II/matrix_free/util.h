@@ -20,8 +20,13 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/point.h>
 #include <deal.II/base/quadrature.h>
 #include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/table.h>
+#include <deal.II/base/tensor.h>
+#include <deal.II/base/vectorization.h>
 
 #include <deal.II/grid/reference_cell.h>
 
@@ -161,6 +166,93 @@ namespace internal
 
       return {Quadrature<dim - 1>(), Quadrature<dim - 1>()};
     }
+
+
+    /**
+     * Convert a (possibly vectorized) number of type @p Number2 to another
+     * (possibly vectorized) number of type @p Number, lane by lane. Both
+     * types must have the same number of lanes. This is used to derive
+     * data structures in a different precision from existing ones, e.g.,
+     * for creating a MatrixFree object in single precision out of one in
+     * double precision.
+     */
+    template <typename Number, typename Number2>
+    inline void
+    convert_value(const Number2 &in, Number &out)
+    {
+      static_assert(VectorizedArrayTrait<Number>::width ==
+                      VectorizedArrayTrait<Number2>::width,
+                    "The number of lanes must coincide");
+      for (unsigned int v = 0; v < VectorizedArrayTrait<Number>::width; ++v)
+        VectorizedArrayTrait<Number>::get(out, v) =
+          VectorizedArrayTrait<Number2>::get(in, v);
+    }
+
+
+
+    /**
+     * Same as above, but for tensor-valued data.
+     */
+    template <int rank, int dim, typename Number, typename Number2>
+    inline void
+    convert_value(const Tensor<rank, dim, Number2> &in,
+                  Tensor<rank, dim, Number> &       out)
+    {
+      for (unsigned int d = 0; d < dim; ++d)
+        convert_value(in[d], out[d]);
+    }
+
+
+
+    /**
+     * Same as above, but for points.
+     */
+    template <int dim, typename Number, typename Number2>
+    inline void
+    convert_value(const Point<dim, Number2> &in, Point<dim, Number> &out)
+    {
+      for (unsigned int d = 0; d < dim; ++d)
+        convert_value(in[d], out[d]);
+    }
+
+
+
+    /**
+     * Same as above, but for an array of (possibly vectorized) data.
+     */
+    template <typename T, typename T2>
+    inline void
+    convert_value(const AlignedVector<T2> &in, AlignedVector<T> &out)
+    {
+      out.resize(in.size());
+      for (unsigned int i = 0; i < in.size(); ++i)
+        convert_value(in[i], out[i]);
+    }
+
+
+
+    /**
+     * Same as above, but for a table of (possibly vectorized) data.
+     */
+    template <int N, typename T, typename T2>
+    inline void
+    convert_value(const Table<N, T2> &in, Table<N, T> &out)
+    {
+      out.reinit(in.size(), true);
+      TableIndices<N> indices;
+      for (std::size_t i = 0; i < in.n_elements(); ++i)
+        {
+          // tables are stored in C-style ordering, with the last index
+          // running fastest
+          std::size_t remainder = i;
+          for (int d = N - 1; d >= 0; --d)
+            {
+              indices[d] = remainder % in.size(d);
+              remainder /= in.size(d);
+            }
+          convert_value(in(indices), out(indices));
+        }
+    }
   } // end of namespace MatrixFreeFunctions
 } // end of namespace internal
 
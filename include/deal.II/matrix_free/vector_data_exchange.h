@@ -79,6 +79,25 @@ namespace internal
           const ArrayView<double> &                   ghost_array,
           std::vector<MPI_Request> &                  requests) const = 0;
 
+        /**
+         * Check without blocking whether the ghost values sent by the MPI
+         * process @p rank in export_to_ghosted_array_start() have arrived,
+         * and make them available at their final position in
+         * @p ghost_array. Returns true if the values are available, which
+         * includes the case that no data is received from @p rank. This
+         * function can be called repeatedly between
+         * export_to_ghosted_array_start() and
+         * export_to_ghosted_array_finish(), the latter of which must still
+         * be called to complete the communication.
+         */
+        virtual bool
+        export_to_ghosted_array_test(
+          const unsigned int                          rank,
+          const ArrayView<const double> &             locally_owned_array,
+          const std::vector<ArrayView<const double>> &shared_arrays,
+          const ArrayView<double> &                   ghost_array,
+          std::vector<MPI_Request> &                  requests) const = 0;
+
         virtual void
         import_from_ghosted_array_start(
           const VectorOperation::values               vector_operation,
@@ -117,6 +136,14 @@ namespace internal
           const ArrayView<float> &                   ghost_array,
           std::vector<MPI_Request> &                 requests) const = 0;
 
+        virtual bool
+        export_to_ghosted_array_test(
+          const unsigned int                         rank,
+          const ArrayView<const float> &             locally_owned_array,
+          const std::vector<ArrayView<const float>> &shared_arrays,
+          const ArrayView<float> &                   ghost_array,
+          std::vector<MPI_Request> &                 requests) const = 0;
+
         virtual void
         import_from_ghosted_array_start(
           const VectorOperation::values              vector_operation,
@@ -184,6 +211,14 @@ namespace internal
           const ArrayView<double> &                   ghost_array,
           std::vector<MPI_Request> &                  requests) const override;
 
+        bool
+        export_to_ghosted_array_test(
+          const unsigned int                          rank,
+          const ArrayView<const double> &             locally_owned_array,
+          const std::vector<ArrayView<const double>> &shared_arrays,
+          const ArrayView<double> &                   ghost_array,
+          std::vector<MPI_Request> &                  requests) const override;
+
         void
         import_from_ghosted_array_start(
           const VectorOperation::values               vector_operation,
@@ -222,6 +257,14 @@ namespace internal
           const ArrayView<float> &                   ghost_array,
           std::vector<MPI_Request> &                 requests) const override;
 
+        bool
+        export_to_ghosted_array_test(
+          const unsigned int                         rank,
+          const ArrayView<const float> &             locally_owned_array,
+          const std::vector<ArrayView<const float>> &shared_arrays,
+          const ArrayView<float> &                   ghost_array,
+          std::vector<MPI_Request> &                 requests) const override;
+
         void
         import_from_ghosted_array_start(
           const VectorOperation::values              vector_operation,
@@ -249,6 +292,34 @@ namespace internal
         void
         reset_ghost_values_impl(const ArrayView<Number> &ghost_array) const;
 
+        template <typename Number>
+        bool
+        export_to_ghosted_array_test_impl(
+          const unsigned int        rank,
+          const ArrayView<Number> & ghost_array,
+          std::vector<MPI_Request> &requests) const;
+
+        template <typename Number>
+        void
+        export_to_ghosted_array_finish_impl(
+          const ArrayView<Number> & ghost_array,
+          std::vector<MPI_Request> &requests) const;
+
+        /**
+         * In case the partitioner describes a subset of a larger set of ghost
+         * indices, the ghost values of the subset are received into the end
+         * of the ghost array and need to be moved to their final position.
+         * This function moves the values received from the process with
+         * index @p ghost_target_index in Partitioner::ghost_targets(), which
+         * must be done in increasing order of the index to not overwrite
+         * data that has not been moved yet.
+         */
+        template <typename Number>
+        void
+        move_ghost_values_to_larger_set(
+          const unsigned int       ghost_target_index,
+          const ArrayView<Number> &ghost_array) const;
+
         const std::shared_ptr<const Utilities::MPI::Partitioner> partitioner;
       };
 
@@ -300,6 +371,14 @@ namespace internal
           const ArrayView<double> &                   ghost_array,
           std::vector<MPI_Request> &                  requests) const override;
 
+        bool
+        export_to_ghosted_array_test(
+          const unsigned int                          rank,
+          const ArrayView<const double> &             locally_owned_array,
+          const std::vector<ArrayView<const double>> &shared_arrays,
+          const ArrayView<double> &                   ghost_array,
+          std::vector<MPI_Request> &                  requests) const override;
+
         void
         import_from_ghosted_array_start(
           const VectorOperation::values               vector_operation,
@@ -338,6 +417,14 @@ namespace internal
           const ArrayView<float> &                   ghost_array,
           std::vector<MPI_Request> &                 requests) const override;
 
+        bool
+        export_to_ghosted_array_test(
+          const unsigned int                         rank,
+          const ArrayView<const float> &             locally_owned_array,
+          const std::vector<ArrayView<const float>> &shared_arrays,
+          const ArrayView<float> &                   ghost_array,
+          std::vector<MPI_Request> &                 requests) const override;
+
         void
         import_from_ghosted_array_start(
           const VectorOperation::values              vector_operation,
@@ -31,9 +31,11 @@
 #include <deal.II/meshworker/integration_info.h>
 #include <deal.II/meshworker/local_integrator.h>
 #include <deal.II/meshworker/loop.h>
+#include <deal.II/meshworker/scratch_data_pool.h>
 
 #include <functional>
 #include <type_traits>
+#include <vector>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -97,6 +99,318 @@ namespace MeshWorker
       // remove the template layers to retrieve the underlying iterator type.
       using type = typename CellIteratorBaseType<CellIteratorType>::type;
     };
+
+    /**
+     * Check that the @p flags passed to mesh_loop() are consistent with the
+     * given workers, and return the function that mesh_loop() runs on each
+     * cell. This function calls the @p cell_worker, @p boundary_worker, and
+     * @p face_worker on the cell and its faces as requested by the
+     * @p flags. The returned function refers to the arguments of this
+     * function, which therefore need to live as long as it is used.
+     */
+    template <class CellIteratorBaseType, class ScratchData, class CopyData>
+    std::function<void(const CellIteratorBaseType &, ScratchData &, CopyData &)>
+    make_cell_action(
+      const std::function<
+        void(const CellIteratorBaseType &, ScratchData &, CopyData &)>
+        &                 cell_worker,
+      const CopyData &    sample_copy_data,
+      const AssembleFlags flags,
+      const std::function<void(const CellIteratorBaseType &,
+                               const unsigned int,
+                               ScratchData &,
+                               CopyData &)> &boundary_worker,
+      const std::function<void(const CellIteratorBaseType &,
+                               const unsigned int,
+                               const unsigned int,
+                               const CellIteratorBaseType &,
+                               const unsigned int,
+                               const unsigned int,
+                               ScratchData &,
+                               CopyData &)> &face_worker)
+    {
+      Assert(
+        (!cell_worker) == !(flags & work_on_cells),
+        ExcMessage(
+          "If you provide a cell worker function, you also need to request "
+          "that work should be done on cells by setting the 'work_on_cells' flag. "
+          "Conversely, if you don't provide a cell worker function, you "
+          "cannot set the 'work_on_cells' flag. One of these two "
+          "conditions is not satisfied."));
+
+      Assert(
+        (flags & (assemble_own_interior_faces_once |
+                  assemble_own_interior_faces_both)) !=
+          (assemble_own_interior_faces_once | assemble_own_interior_faces_both),
+        ExcMessage(
+          "If you provide a face worker function, you also need to request "
+          "that work should be done on interior faces by setting either the "
+          "'assemble_own_interior_faces_once' flag or the "
+          "'assemble_own_interior_faces_both' flag. "
+          "Conversely, if you don't provide a face worker function, you "
+          "cannot set either of these two flags. One of these two "
+          "conditions is not satisfied."));
+
+      Assert(
+        (flags & (assemble_ghost_faces_once | assemble_ghost_faces_both)) !=
+          (assemble_ghost_faces_once | assemble_ghost_faces_both),
+        ExcMessage(
+          "You can only 'specify assemble_ghost_faces_once' "
+          "OR 'assemble_ghost_faces_both', but not both of these flags."));
+
+      Assert(
+        !(flags & cells_after_faces) ||
+          (flags & (assemble_own_cells | assemble_ghost_cells)),
+        ExcMessage(
+          "The option 'cells_after_faces' only makes sense if you assemble on cells."));
+
+      Assert(
+        (!face_worker) == !(flags & work_on_faces),
+        ExcMessage(
+          "If you provide a face worker function, you also need to request "
+          "that work should be done on faces by setting the 'work_on_faces' flag. "
+          "Conversely, if you don't provide a face worker function, you "
+          "cannot set the 'work_on_faces' flag. One of these two "
+          "conditions is not satisfied."));
+
+      Assert(
+        (!boundary_worker) == !(flags & assemble_boundary_faces),
+        ExcMessage(
+          "If you provide a boundary face worker function, you also need to request "
+          "that work should be done on boundary faces by setting the 'assemble_boundary_faces' flag. "
+          "Conversely, if you don't provide a boundary face worker function, you "
+          "cannot set the 'assemble_boundary_faces' flag. One of these two "
+          "conditions is not satisfied."));
+
+      return [&](const CellIteratorBaseType &cell,
+                 ScratchData &               scratch,
+                 CopyData &                  copy) {
+        // First reset the CopyData class to the empty copy_data given by the
+        // user.
+        copy = sample_copy_data;
+
+        // Store the dimension in which we are working for later use
+        const auto dim = cell->get_triangulation().dimension;
+
+        const bool ignore_subdomain =
+          (cell->get_triangulation().locally_owned_subdomain() ==
+           numbers::invalid_subdomain_id);
+
+        types::subdomain_id current_subdomain_id =
+          (cell->is_level_cell() ? cell->level_subdomain_id() :
+                                   cell->subdomain_id());
+
+        const bool own_cell =
+          ignore_subdomain ||
+          (current_subdomain_id ==
+           cell->get_triangulation().locally_owned_subdomain());
+
+        if ((!ignore_subdomain) &&
+            (current_subdomain_id == numbers::artificial_subdomain_id))
+          return;
+
+        if (!(flags & (cells_after_faces)) &&
+            (((flags & (assemble_own_cells)) && own_cell) ||
+             ((flags & assemble_ghost_cells) && !own_cell)))
+          cell_worker(cell, scratch, copy);
+
+        if (flags & (work_on_faces | work_on_boundary))
+          for (const unsigned int face_no : cell->face_indices())
+            {
+              if (cell->at_boundary(face_no) &&
+                  !cell->has_periodic_neighbor(face_no))
+                {
+                  // only integrate boundary faces of own cells
+                  if ((flags & assemble_boundary_faces) && own_cell)
+                    boundary_worker(cell, face_no, scratch, copy);
+                }
+              else
+                {
+                  // interior face, potentially assemble
+                  TriaIterator<typename CellIteratorBaseType::AccessorType>
+                    neighbor = cell->neighbor_or_periodic_neighbor(face_no);
+
+                  types::subdomain_id neighbor_subdomain_id =
+                    numbers::artificial_subdomain_id;
+                  if (neighbor->is_level_cell())
+                    neighbor_subdomain_id = neighbor->level_subdomain_id();
+                  // subdomain id is only valid for active cells
+                  else if (neighbor->is_active())
+                    neighbor_subdomain_id = neighbor->subdomain_id();
+
+                  const bool own_neighbor =
+                    ignore_subdomain ||
+                    (neighbor_subdomain_id ==
+                     cell->get_triangulation().locally_owned_subdomain());
+
+                  // skip all faces between two ghost cells
+                  if (!own_cell && !own_neighbor)
+                    continue;
+
+                  // skip if the user doesn't want faces between own cells
+                  if (own_cell && own_neighbor &&
+                      !(flags & (assemble_own_interior_faces_both |
+                                 assemble_own_interior_faces_once)))
+                    continue;
+
+                  // skip face to ghost
+                  if (own_cell != own_neighbor &&
+                      !(flags & (assemble_ghost_faces_both |
+                                 assemble_ghost_faces_once)))
+                    continue;
+
+                  // Deal with refinement edges from the refined side. Assuming
+                  // one-irregular meshes, this situation should only occur if
+                  // both cells are active.
+                  const bool periodic_neighbor =
+                    cell->has_periodic_neighbor(face_no);
+
+                  if (dim > 1 &&
+                      ((!periodic_neighbor &&
+                        cell->neighbor_is_coarser(face_no) &&
+                        neighbor->is_active()) ||
+                       (periodic_neighbor &&
+                        cell->periodic_neighbor_is_coarser(face_no) &&
+                        neighbor->is_active())))
+                    {
+                      Assert(cell->is_active(), ExcInternalError());
+
+                      // skip if only one processor needs to assemble the face
+                      // to a ghost cell and the fine cell is not ours.
+                      if (!own_cell && (flags & assemble_ghost_faces_once))
+                        continue;
+
+                      const std::pair<unsigned int, unsigned int>
+                        neighbor_face_no =
+                          periodic_neighbor ?
+                            cell
+                              ->periodic_neighbor_of_coarser_periodic_neighbor(
+                                face_no) :
+                            cell->neighbor_of_coarser_neighbor(face_no);
+
+                      face_worker(cell,
+                                  face_no,
+                                  numbers::invalid_unsigned_int,
+                                  neighbor,
+                                  neighbor_face_no.first,
+                                  neighbor_face_no.second,
+                                  scratch,
+                                  copy);
+
+                      if (flags & assemble_own_interior_faces_both)
+                        {
+                          // If own faces are to be assembled from both sides,
+                          // call the faceworker again with swapped arguments.
+                          // This is because we won't be looking at an
+                          // adaptively refined edge coming from the other
+                          // side.
+                          face_worker(neighbor,
+                                      neighbor_face_no.first,
+                                      neighbor_face_no.second,
+                                      cell,
+                                      face_no,
+                                      numbers::invalid_unsigned_int,
+                                      scratch,
+                                      copy);
+                        }
+                    }
+                  else if (dim == 1 && cell->level() > neighbor->level())
+                    {
+                      // In one dimension, there is no other check to do
+                      const unsigned int neighbor_face_no =
+                        periodic_neighbor ?
+                          cell->periodic_neighbor_face_no(face_no) :
+                          cell->neighbor_face_no(face_no);
+                      Assert(periodic_neighbor ||
+                               neighbor->face(neighbor_face_no) ==
+                                 cell->face(face_no),
+                             ExcInternalError());
+
+                      face_worker(cell,
+                                  face_no,
+                                  numbers::invalid_unsigned_int,
+                                  neighbor,
+                                  neighbor_face_no,
+                                  numbers::invalid_unsigned_int,
+                                  scratch,
+                                  copy);
+
+                      if (flags & assemble_own_interior_faces_both)
+                        {
+                          // If own faces are to be assembled from both sides,
+                          // call the faceworker again with swapped arguments.
+                          face_worker(neighbor,
+                                      neighbor_face_no,
+                                      numbers::invalid_unsigned_int,
+                                      cell,
+                                      face_no,
+                                      numbers::invalid_unsigned_int,
+                                      scratch,
+                                      copy);
+                        }
+                    }
+                  else
+                    {
+                      // If iterator is active and neighbor is refined, skip
+                      // internal face.
+                      if (dealii::internal::is_active_iterator(cell) &&
+                          neighbor->has_children())
+                        continue;
+
+                      // Now neighbor is on the same refinement level.
+                      // Double check.
+                      Assert(!cell->neighbor_is_coarser(face_no),
+                             ExcInternalError());
+
+                      // If we own both cells only do faces from one side
+                      // (unless AssembleFlags says otherwise). Here, we rely
+                      // on cell comparison that will look at cell->index().
+                      if (own_cell && own_neighbor &&
+                          (flags & assemble_own_interior_faces_once) &&
+                          (neighbor < cell))
+                        continue;
+
+                      // We only look at faces to ghost on the same level once
+                      // (only where own_cell=true and own_neighbor=false)
+                      if (!own_cell)
+                        continue;
+
+                      // now only one processor assembles faces_to_ghost. We let
+                      // the processor with the smaller (level-)subdomain id
+                      // assemble the face.
+                      if (own_cell && !own_neighbor &&
+                          (flags & assemble_ghost_faces_once) &&
+                          (neighbor_subdomain_id < current_subdomain_id))
+                        continue;
+
+                      const unsigned int neighbor_face_no =
+                        periodic_neighbor ?
+                          cell->periodic_neighbor_face_no(face_no) :
+                          cell->neighbor_face_no(face_no);
+                      Assert(periodic_neighbor ||
+                               neighbor->face(neighbor_face_no) ==
+                                 cell->face(face_no),
+                             ExcInternalError());
+
+                      face_worker(cell,
+                                  face_no,
+                                  numbers::invalid_unsigned_int,
+                                  neighbor,
+                                  neighbor_face_no,
+                                  numbers::invalid_unsigned_int,
+                                  scratch,
+                                  copy);
+                    }
+                }
+            } // faces
+
+        // Execute the cell_worker if faces are handled before cells
+        if ((flags & cells_after_faces) &&
+            (((flags & assemble_own_cells) && own_cell) ||
+             ((flags & assemble_ghost_cells) && !own_cell)))
+          cell_worker(cell, scratch, copy);
+      };
+    }
   } // namespace internal
 
 #ifdef DOXYGEN
@@ -344,283 +658,13 @@ namespace MeshWorker
 #endif
   )
   {
-    Assert(
-      (!cell_worker) == !(flags & work_on_cells),
-      ExcMessage(
-        "If you provide a cell worker function, you also need to request "
-        "that work should be done on cells by setting the 'work_on_cells' flag. "
-        "Conversely, if you don't provide a cell worker function, you "
-        "cannot set the 'work_on_cells' flag. One of these two "
-        "conditions is not satisfied."));
-
-    Assert((flags & (assemble_own_interior_faces_once |
-                     assemble_own_interior_faces_both)) !=
-             (assemble_own_interior_faces_once |
-              assemble_own_interior_faces_both),
-           ExcMessage(
-             "If you provide a face worker function, you also need to request "
-             "that work should be done on interior faces by setting either the "
-             "'assemble_own_interior_faces_once' flag or the "
-             "'assemble_own_interior_faces_both' flag. "
-             "Conversely, if you don't provide a face worker function, you "
-             "cannot set either of these two flags. One of these two "
-             "conditions is not satisfied."));
-
-    Assert((flags & (assemble_ghost_faces_once | assemble_ghost_faces_both)) !=
-             (assemble_ghost_faces_once | assemble_ghost_faces_both),
-           ExcMessage(
-             "You can only 'specify assemble_ghost_faces_once' "
-             "OR 'assemble_ghost_faces_both', but not both of these flags."));
-
-    Assert(
-      !(flags & cells_after_faces) ||
-        (flags & (assemble_own_cells | assemble_ghost_cells)),
-      ExcMessage(
-        "The option 'cells_after_faces' only makes sense if you assemble on cells."));
-
-    Assert(
-      (!face_worker) == !(flags & work_on_faces),
-      ExcMessage(
-        "If you provide a face worker function, you also need to request "
-        "that work should be done on faces by setting the 'work_on_faces' flag. "
-        "Conversely, if you don't provide a face worker function, you "
-        "cannot set the 'work_on_faces' flag. One of these two "
-        "conditions is not satisfied."));
-
-    Assert(
-      (!boundary_worker) == !(flags & assemble_boundary_faces),
-      ExcMessage(
-        "If you provide a boundary face worker function, you also need to request "
-        "that work should be done on boundary faces by setting the 'assemble_boundary_faces' flag. "
-        "Conversely, if you don't provide a boundary face worker function, you "
-        "cannot set the 'assemble_boundary_faces' flag. One of these two "
-        "conditions is not satisfied."));
-
-    auto cell_action = [&](const CellIteratorBaseType &cell,
-                           ScratchData &               scratch,
-                           CopyData &                  copy) {
-      // First reset the CopyData class to the empty copy_data given by the
-      // user.
-      copy = sample_copy_data;
-
-      // Store the dimension in which we are working for later use
-      const auto dim = cell->get_triangulation().dimension;
-
-      const bool ignore_subdomain =
-        (cell->get_triangulation().locally_owned_subdomain() ==
-         numbers::invalid_subdomain_id);
-
-      types::subdomain_id current_subdomain_id =
-        (cell->is_level_cell() ? cell->level_subdomain_id() :
-                                 cell->subdomain_id());
-
-      const bool own_cell =
-        ignore_subdomain ||
-        (current_subdomain_id ==
-         cell->get_triangulation().locally_owned_subdomain());
-
-      if ((!ignore_subdomain) &&
-          (current_subdomain_id == numbers::artificial_subdomain_id))
-        return;
-
-      if (!(flags & (cells_after_faces)) &&
-          (((flags & (assemble_own_cells)) && own_cell) ||
-           ((flags & assemble_ghost_cells) && !own_cell)))
-        cell_worker(cell, scratch, copy);
-
-      if (flags & (work_on_faces | work_on_boundary))
-        for (const unsigned int face_no : cell->face_indices())
-          {
-            if (cell->at_boundary(face_no) &&
-                !cell->has_periodic_neighbor(face_no))
-              {
-                // only integrate boundary faces of own cells
-                if ((flags & assemble_boundary_faces) && own_cell)
-                  boundary_worker(cell, face_no, scratch, copy);
-              }
-            else
-              {
-                // interior face, potentially assemble
-                TriaIterator<typename CellIteratorBaseType::AccessorType>
-                  neighbor = cell->neighbor_or_periodic_neighbor(face_no);
-
-                types::subdomain_id neighbor_subdomain_id =
-                  numbers::artificial_subdomain_id;
-                if (neighbor->is_level_cell())
-                  neighbor_subdomain_id = neighbor->level_subdomain_id();
-                // subdomain id is only valid for active cells
-                else if (neighbor->is_active())
-                  neighbor_subdomain_id = neighbor->subdomain_id();
-
-                const bool own_neighbor =
-                  ignore_subdomain ||
-                  (neighbor_subdomain_id ==
-                   cell->get_triangulation().locally_owned_subdomain());
-
-                // skip all faces between two ghost cells
-                if (!own_cell && !own_neighbor)
-                  continue;
-
-                // skip if the user doesn't want faces between own cells
-                if (own_cell && own_neighbor &&
-                    !(flags & (assemble_own_interior_faces_both |
-                               assemble_own_interior_faces_once)))
-                  continue;
-
-                // skip face to ghost
-                if (own_cell != own_neighbor &&
-                    !(flags &
-                      (assemble_ghost_faces_both | assemble_ghost_faces_once)))
-                  continue;
-
-                // Deal with refinement edges from the refined side. Assuming
-                // one-irregular meshes, this situation should only occur if
-                // both cells are active.
-                const bool periodic_neighbor =
-                  cell->has_periodic_neighbor(face_no);
-
-                if (dim > 1 && ((!periodic_neighbor &&
-                                 cell->neighbor_is_coarser(face_no) &&
-                                 neighbor->is_active()) ||
-                                (periodic_neighbor &&
-                                 cell->periodic_neighbor_is_coarser(face_no) &&
-                                 neighbor->is_active())))
-                  {
-                    Assert(cell->is_active(), ExcInternalError());
-
-                    // skip if only one processor needs to assemble the face
-                    // to a ghost cell and the fine cell is not ours.
-                    if (!own_cell && (flags & assemble_ghost_faces_once))
-                      continue;
-
-                    const std::pair<unsigned int, unsigned int>
-                      neighbor_face_no =
-                        periodic_neighbor ?
-                          cell->periodic_neighbor_of_coarser_periodic_neighbor(
-                            face_no) :
-                          cell->neighbor_of_coarser_neighbor(face_no);
-
-                    face_worker(cell,
-                                face_no,
-                                numbers::invalid_unsigned_int,
-                                neighbor,
-                                neighbor_face_no.first,
-                                neighbor_face_no.second,
-                                scratch,
-                                copy);
-
-                    if (flags & assemble_own_interior_faces_both)
-                      {
-                        // If own faces are to be assembled from both sides,
-                        // call the faceworker again with swapped arguments.
-                        // This is because we won't be looking at an adaptively
-                        // refined edge coming from the other side.
-                        face_worker(neighbor,
-                                    neighbor_face_no.first,
-                                    neighbor_face_no.second,
-                                    cell,
-                                    face_no,
-                                    numbers::invalid_unsigned_int,
-                                    scratch,
-                                    copy);
-                      }
-                  }
-                else if (dim == 1 && cell->level() > neighbor->level())
-                  {
-                    // In one dimension, there is no other check to do
-                    const unsigned int neighbor_face_no =
-                      periodic_neighbor ?
-                        cell->periodic_neighbor_face_no(face_no) :
-                        cell->neighbor_face_no(face_no);
-                    Assert(periodic_neighbor ||
-                             neighbor->face(neighbor_face_no) ==
-                               cell->face(face_no),
-                           ExcInternalError());
-
-                    face_worker(cell,
-                                face_no,
-                                numbers::invalid_unsigned_int,
-                                neighbor,
-                                neighbor_face_no,
-                                numbers::invalid_unsigned_int,
-                                scratch,
-                                copy);
-
-                    if (flags & assemble_own_interior_faces_both)
-                      {
-                        // If own faces are to be assembled from both sides,
-                        // call the faceworker again with swapped arguments.
-                        face_worker(neighbor,
-                                    neighbor_face_no,
-                                    numbers::invalid_unsigned_int,
-                                    cell,
-                                    face_no,
-                                    numbers::invalid_unsigned_int,
-                                    scratch,
-                                    copy);
-                      }
-                  }
-                else
-                  {
-                    // If iterator is active and neighbor is refined, skip
-                    // internal face.
-                    if (dealii::internal::is_active_iterator(cell) &&
-                        neighbor->has_children())
-                      continue;
-
-                    // Now neighbor is on the same refinement level.
-                    // Double check.
-                    Assert(!cell->neighbor_is_coarser(face_no),
-                           ExcInternalError());
-
-                    // If we own both cells only do faces from one side (unless
-                    // AssembleFlags says otherwise). Here, we rely on cell
-                    // comparison that will look at cell->index().
-                    if (own_cell && own_neighbor &&
-                        (flags & assemble_own_interior_faces_once) &&
-                        (neighbor < cell))
-                      continue;
-
-                    // We only look at faces to ghost on the same level once
-                    // (only where own_cell=true and own_neighbor=false)
-                    if (!own_cell)
-                      continue;
-
-                    // now only one processor assembles faces_to_ghost. We let
-                    // the processor with the smaller (level-)subdomain id
-                    // assemble the face.
-                    if (own_cell && !own_neighbor &&
-                        (flags & assemble_ghost_faces_once) &&
-                        (neighbor_subdomain_id < current_subdomain_id))
-                      continue;
-
-                    const unsigned int neighbor_face_no =
-                      periodic_neighbor ?
-                        cell->periodic_neighbor_face_no(face_no) :
-                        cell->neighbor_face_no(face_no);
-                    Assert(periodic_neighbor ||
-                             neighbor->face(neighbor_face_no) ==
-                               cell->face(face_no),
-                           ExcInternalError());
-
-                    face_worker(cell,
-                                face_no,
-                                numbers::invalid_unsigned_int,
-                                neighbor,
-                                neighbor_face_no,
-                                numbers::invalid_unsigned_int,
-                                scratch,
-                                copy);
-                  }
-              }
-          } // faces
-
-      // Execute the cell_worker if faces are handled before cells
-      if ((flags & cells_after_faces) &&
-          (((flags & assemble_own_cells) && own_cell) ||
-           ((flags & assemble_ghost_cells) && !own_cell)))
-        cell_worker(cell, scratch, copy);
-    };
+    const auto cell_action =
+      internal::make_cell_action<CellIteratorBaseType, ScratchData, CopyData>(
+        cell_worker,
+        sample_copy_data,
+        flags,
+        boundary_worker,
+        face_worker);
 
     // Submit to workstream
     WorkStream::run(begin,
@@ -767,6 +811,287 @@ namespace MeshWorker
                                     chunk_size);
   }
 
+  /**
+   * Same as the first function above, but for cells that have been split
+   * into colors such that the @p copier can be called concurrently on
+   * cells of the same color, as in the WorkStream::run() function that
+   * takes colored iterators. The colors are processed one after the other.
+   *
+   * The other mesh_loop() functions call the @p copier on one cell after the
+   * other, which limits the parallel scalability if the copier is as
+   * expensive as, for example, for discontinuous Galerkin methods where the
+   * CopyData object also holds the contributions of the faces. With this
+   * function, the copiers of all cells of a color run in parallel instead.
+   *
+   * The colors must be chosen such that the copiers of two cells of the same
+   * color never write into the same entries of a matrix or vector. If the
+   * @p face_worker adds contributions of a face to the rows of the
+   * neighboring cell, the conflicts of a cell therefore include the degrees
+   * of freedom of its face neighbors. Such a coloring can be computed with
+   * GraphColoring::make_graph_coloring():
+   * @code
+   * using CellIteratorType = decltype(dof_handler.begin_active());
+   *
+   * // This version assumes a mesh without hanging nodes.
+   * const auto get_conflict_indices = [](const CellIteratorType &cell) {
+   *   std::vector<types::global_dof_index> conflicts;
+   *   std::vector<types::global_dof_index> dof_indices;
+   *   const auto add_dof_indices = [&](const auto &c) {
+   *     dof_indices.resize(c->get_fe().n_dofs_per_cell());
+   *     c->get_dof_indices(dof_indices);
+   *     conflicts.insert(conflicts.end(),
+   *                      dof_indices.begin(),
+   *                      dof_indices.end());
+   *   };
+   *
+   *   add_dof_indices(cell);
+   *   for (const unsigned int f : cell->face_indices())
+   *     if (!cell->at_boundary(f))
+   *       add_dof_indices(cell->neighbor(f));
+   *   return conflicts;
+   * };
+   *
+   * const std::vector<std::vector<CellIteratorType>> colored_cells =
+   *   GraphColoring::make_graph_coloring(dof_handler.begin_active(),
+   *                                      dof_handler.end(),
+   *                                      get_conflict_indices);
+   *
+   * MeshWorker::mesh_loop(colored_cells,
+   *                       cell_worker, copier,
+   *                       scratch, copy,
+   *                       MeshWorker::assemble_own_cells |
+   *                         MeshWorker::assemble_boundary_faces |
+   *                         MeshWorker::assemble_own_interior_faces_once,
+   *                       boundary_worker,
+   *                       face_worker);
+   * @endcode
+   *
+   * @ingroup MeshWorker
+   */
+  template <class CellIteratorType,
+            class ScratchData,
+            class CopyData,
+            class CellIteratorBaseType =
+              typename internal::CellIteratorBaseType<CellIteratorType>::type>
+  void
+  mesh_loop(
+    const std::vector<std::vector<CellIteratorType>> &colored_iterators,
+    const typename identity<std::function<
+      void(const CellIteratorBaseType &, ScratchData &, CopyData &)>>::type
+      &cell_worker,
+    const typename identity<std::function<void(const CopyData &)>>::type
+      &copier,
+
+    const ScratchData &sample_scratch_data,
+    const CopyData &   sample_copy_data,
+
+    const AssembleFlags flags = assemble_own_cells,
+
+    const typename identity<std::function<void(const CellIteratorBaseType &,
+                                               const unsigned int,
+                                               ScratchData &,
+                                               CopyData &)>>::type
+      &boundary_worker = std::function<void(const CellIteratorBaseType &,
+                                            const unsigned int,
+                                            ScratchData &,
+                                            CopyData &)>(),
+
+    const typename identity<std::function<void(const CellIteratorBaseType &,
+                                               const unsigned int,
+                                               const unsigned int,
+                                               const CellIteratorBaseType &,
+                                               const unsigned int,
+                                               const unsigned int,
+                                               ScratchData &,
+                                               CopyData &)>>::type
+      &face_worker = std::function<void(const CellIteratorBaseType &,
+                                        const unsigned int,
+                                        const unsigned int,
+                                        const CellIteratorBaseType &,
+                                        const unsigned int,
+                                        const unsigned int,
+                                        ScratchData &,
+                                        CopyData &)>(),
+
+    const unsigned int queue_length = 2 * MultithreadInfo::n_threads(),
+    const unsigned int chunk_size   = 8)
+  {
+    const auto cell_action =
+      internal::make_cell_action<CellIteratorBaseType, ScratchData, CopyData>(
+        cell_worker,
+        sample_copy_data,
+        flags,
+        boundary_worker,
+        face_worker);
+
+    // Submit to workstream, which runs the copiers of each color in parallel
+    WorkStream::run(colored_iterators,
+                    std::function<void(const CellIteratorType &,
+                                       ScratchData &,
+                                       CopyData &)>(cell_action),
+                    copier,
+                    sample_scratch_data,
+                    sample_copy_data,
+                    queue_length,
+                    chunk_size);
+  }
+
+  /**
+   * Same as the first function above, but the scratch data of the threads
+   * is taken from the @p scratch_data_pool instead of being copied from a
+   * sample scratch data object, and is returned to the pool at the end of
+   * the loop. Repeated loops, e.g., in every time step of a transient
+   * problem, therefore reuse the scratch data objects, including the
+   * FEValues objects created by them. See the documentation of
+   * ScratchDataPool for an example.
+   *
+   * @ingroup MeshWorker
+   */
+  template <class CellIteratorType,
+            class ScratchData,
+            class CopyData,
+            class CellIteratorBaseType =
+              typename internal::CellIteratorBaseType<CellIteratorType>::type>
+  void
+  mesh_loop(
+    const CellIteratorType &                         begin,
+    const typename identity<CellIteratorType>::type &end,
+    const typename identity<std::function<
+      void(const CellIteratorBaseType &, ScratchData &, CopyData &)>>::type
+      &cell_worker,
+    const typename identity<std::function<void(const CopyData &)>>::type
+      &copier,
+
+    ScratchDataPool<ScratchData> &scratch_data_pool,
+    const CopyData &              sample_copy_data,
+
+    const AssembleFlags flags = assemble_own_cells,
+
+    const typename identity<std::function<void(const CellIteratorBaseType &,
+                                               const unsigned int,
+                                               ScratchData &,
+                                               CopyData &)>>::type
+      &boundary_worker = std::function<void(const CellIteratorBaseType &,
+                                            const unsigned int,
+                                            ScratchData &,
+                                            CopyData &)>(),
+
+    const typename identity<std::function<void(const CellIteratorBaseType &,
+                                               const unsigned int,
+                                               const unsigned int,
+                                               const CellIteratorBaseType &,
+                                               const unsigned int,
+                                               const unsigned int,
+                                               ScratchData &,
+                                               CopyData &)>>::type
+      &face_worker = std::function<void(const CellIteratorBaseType &,
+                                        const unsigned int,
+                                        const unsigned int,
+                                        const CellIteratorBaseType &,
+                                        const unsigned int,
+                                        const unsigned int,
+                                        ScratchData &,
+                                        CopyData &)>(),
+
+    const unsigned int queue_length = 2 * MultithreadInfo::n_threads(),
+    const unsigned int chunk_size   = 8)
+  {
+    const auto cell_action =
+      internal::make_cell_action<CellIteratorBaseType, ScratchData, CopyData>(
+        cell_worker,
+        sample_copy_data,
+        flags,
+        boundary_worker,
+        face_worker);
+
+    // Submit to workstream, and hand the ScratchData object of the pooled
+    // scratch data to the workers
+    WorkStream::run(
+      begin,
+      end,
+      [&cell_action](const CellIteratorBaseType &             cell,
+                     internal::PooledScratchData<ScratchData> &scratch,
+                     CopyData &                               copy) {
+        cell_action(cell, scratch.get(), copy);
+      },
+      copier,
+      internal::PooledScratchData<ScratchData>(scratch_data_pool),
+      sample_copy_data,
+      queue_length,
+      chunk_size);
+  }
+
+  /**
+   * Same as the function above, but for iterator ranges (and, therefore,
+   * filtered iterators).
+   *
+   * @ingroup MeshWorker
+   */
+  template <class CellIteratorType,
+            class ScratchData,
+            class CopyData,
+            class CellIteratorBaseType =
+              typename internal::CellIteratorBaseType<CellIteratorType>::type>
+  void
+  mesh_loop(
+    IteratorRange<CellIteratorType> iterator_range,
+    const typename identity<std::function<
+      void(const CellIteratorBaseType &, ScratchData &, CopyData &)>>::type
+      &cell_worker,
+    const typename identity<std::function<void(const CopyData &)>>::type
+      &copier,
+
+    ScratchDataPool<ScratchData> &scratch_data_pool,
+    const CopyData &              sample_copy_data,
+
+    const AssembleFlags flags = assemble_own_cells,
+
+    const typename identity<std::function<void(const CellIteratorBaseType &,
+                                               const unsigned int,
+                                               ScratchData &,
+                                               CopyData &)>>::type
+      &boundary_worker = std::function<void(const CellIteratorBaseType &,
+                                            const unsigned int,
+                                            ScratchData &,
+                                            CopyData &)>(),
+
+    const typename identity<std::function<void(const CellIteratorBaseType &,
+                                               const unsigned int,
+                                               const unsigned int,
+                                               const CellIteratorBaseType &,
+                                               const unsigned int,
+                                               const unsigned int,
+                                               ScratchData &,
+                                               CopyData &)>>::type
+      &face_worker = std::function<void(const CellIteratorBaseType &,
+                                        const unsigned int,
+                                        const unsigned int,
+                                        const CellIteratorBaseType &,
+                                        const unsigned int,
+                                        const unsigned int,
+                                        ScratchData &,
+                                        CopyData &)>(),
+
+    const unsigned int queue_length = 2 * MultithreadInfo::n_threads(),
+    const unsigned int chunk_size   = 8)
+  {
+    // Call the function above
+    mesh_loop<typename IteratorRange<CellIteratorType>::IteratorOverIterators,
+              ScratchData,
+              CopyData,
+              CellIteratorBaseType>(iterator_range.begin(),
+                                    iterator_range.end(),
+                                    cell_worker,
+                                    copier,
+                                    scratch_data_pool,
+                                    sample_copy_data,
+                                    flags,
+                                    boundary_worker,
+                                    face_worker,
+                                    queue_length,
+                                    chunk_size);
+  }
+
   /**
    * This is a variant of the mesh_loop() function that can be used for worker
    * and copier functions that are member functions of a class.
@@ -0,0 +1,311 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+#ifndef dealii_meshworker_scratch_data_pool_h
+#define dealii_meshworker_scratch_data_pool_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/exceptions.h>
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace MeshWorker
+{
+  // Forward declaration
+#ifndef DOXYGEN
+  template <class ScratchData>
+  class ScratchDataPool;
+#endif
+
+  namespace internal
+  {
+    /**
+     * The scratch data type that mesh_loop() passes to WorkStream::run() when
+     * it is called with a ScratchDataPool. Copying an object of this class,
+     * which is what WorkStream does to create the scratch data of each task,
+     * takes a ScratchData object from the pool instead of copying the sample
+     * scratch data, and the destructor returns it to the pool.
+     */
+    template <class ScratchData>
+    class PooledScratchData
+    {
+    public:
+      /**
+       * Constructor. The object created here is only used as the sample that
+       * is copied, and does not hold a ScratchData object itself.
+       */
+      explicit PooledScratchData(ScratchDataPool<ScratchData> &pool)
+        : pool(&pool)
+      {}
+
+      /**
+       * Copy constructor. Take a ScratchData object from the pool of
+       * @p other.
+       */
+      PooledScratchData(const PooledScratchData &other)
+        : pool(other.pool)
+        , scratch_data(pool->acquire())
+      {}
+
+      /**
+       * Destructor. Return the ScratchData object to the pool.
+       */
+      ~PooledScratchData()
+      {
+        if (scratch_data != nullptr)
+          pool->release(std::move(scratch_data));
+      }
+
+      PooledScratchData &
+      operator=(const PooledScratchData &) = delete;
+
+      /**
+       * Return the ScratchData object taken from the pool.
+       */
+      ScratchData &
+      get()
+      {
+        Assert(scratch_data != nullptr, ExcNotInitialized());
+        return *scratch_data;
+      }
+
+    private:
+      /**
+       * The pool the ScratchData object is taken from.
+       */
+      ScratchDataPool<ScratchData> *pool;
+
+      /**
+       * The ScratchData object taken from the pool.
+       */
+      std::unique_ptr<ScratchData> scratch_data;
+    };
+  } // namespace internal
+
+
+
+  /**
+   * A collection of ScratchData objects that is kept alive across several
+   * calls to mesh_loop().
+   *
+   * WorkStream::run() and hence mesh_loop() create the scratch data of each
+   * thread as a copy of the sample scratch data passed to them, and destroy
+   * these copies at the end of the loop. For a MeshWorker::ScratchData
+   * object, this means that all FEValues objects, including the data of the
+   * mapping and the values of the shape functions at the quadrature points,
+   * are created anew in every loop, which can be a significant cost for
+   * transient problems where the same loop is run in every time step. If a
+   * ScratchDataPool is passed to mesh_loop() instead of the sample scratch
+   * data, the scratch data objects used by the threads are taken from the
+   * pool and returned to it at the end of the loop, so that the next loop
+   * reuses them:
+   * @code
+   *   MeshWorker::ScratchDataPool<ScratchData> scratch_data_pool(
+   *     ScratchData(mapping, fe, quadrature, update_flags));
+   *
+   *   for (unsigned int step = 0; step < n_steps; ++step)
+   *     MeshWorker::mesh_loop(dof_handler.active_cell_iterators(),
+   *                           cell_worker,
+   *                           copier,
+   *                           scratch_data_pool,
+   *                           copy_data,
+   *                           MeshWorker::assemble_own_cells);
+   * @endcode
+   *
+   * New objects are only created as copies of the sample scratch data if
+   * more objects are in use at the same time than ever before. The workers
+   * must therefore not rely on the state of a ScratchData object at the
+   * beginning of the work on a cell, which is also true when the objects
+   * are created anew for each loop since WorkStream reuses them for many
+   * cells. The objects in the pool refer to the same objects as the sample
+   * scratch data, e.g., to the Mapping and the FiniteElement, so the pool
+   * needs to be cleared if these change.
+   *
+   * @ingroup MeshWorker
+   */
+  template <class ScratchData>
+  class ScratchDataPool
+  {
+  public:
+    /**
+     * Constructor. Store a copy of @p sample_scratch_data, from which the
+     * objects of the pool are created.
+     */
+    explicit ScratchDataPool(const ScratchData &sample_scratch_data);
+
+    /**
+     * Destructor. Asserts that no object of the pool is in use.
+     */
+    ~ScratchDataPool();
+
+    /**
+     * Return the sample scratch data passed to the constructor.
+     */
+    const ScratchData &
+    get_sample_scratch_data() const;
+
+    /**
+     * Return the number of ScratchData objects that are currently stored in
+     * the pool.
+     */
+    std::size_t
+    n_available_objects() const;
+
+    /**
+     * Delete all ScratchData objects stored in the pool.
+     */
+    void
+    clear();
+
+  private:
+    /**
+     * Take an object from the pool, or create a new one if the pool is
+     * empty.
+     */
+    std::unique_ptr<ScratchData>
+    acquire();
+
+    /**
+     * Return an object taken with acquire() to the pool.
+     */
+    void
+    release(std::unique_ptr<ScratchData> &&scratch_data);
+
+    /**
+     * The sample scratch data.
+     */
+    const ScratchData sample_scratch_data;
+
+    /**
+     * The objects that are currently not in use.
+     */
+    std::vector<std::unique_ptr<ScratchData>> available_objects;
+
+    /**
+     * The number of objects that are currently in use.
+     */
+    std::size_t n_objects_in_use;
+
+    /**
+     * A mutex that guards the access to the pool by several threads.
+     */
+    mutable std::mutex mutex;
+
+    friend class internal::PooledScratchData<ScratchData>;
+  };
+
+
+
+#ifndef DOXYGEN
+  /*------------------------ Inline functions -------------------------*/
+
+
+
+  template <class ScratchData>
+  ScratchDataPool<ScratchData>::ScratchDataPool(
+    const ScratchData &sample_scratch_data)
+    : sample_scratch_data(sample_scratch_data)
+    , n_objects_in_use(0)
+  {}
+
+
+
+  template <class ScratchData>
+  ScratchDataPool<ScratchData>::~ScratchDataPool()
+  {
+    Assert(n_objects_in_use == 0,
+           ExcMessage("A ScratchDataPool is destroyed while some of its "
+                      "objects are still in use."));
+  }
+
+
+
+  template <class ScratchData>
+  const ScratchData &
+  ScratchDataPool<ScratchData>::get_sample_scratch_data() const
+  {
+    return sample_scratch_data;
+  }
+
+
+
+  template <class ScratchData>
+  std::size_t
+  ScratchDataPool<ScratchData>::n_available_objects() const
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    return available_objects.size();
+  }
+
+
+
+  template <class ScratchData>
+  void
+  ScratchDataPool<ScratchData>::clear()
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    Assert(n_objects_in_use == 0,
+           ExcMessage("The pool cannot be cleared while some of its objects "
+                      "are in use."));
+    available_objects.clear();
+  }
+
+
+
+  template <class ScratchData>
+  std::unique_ptr<ScratchData>
+  ScratchDataPool<ScratchData>::acquire()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      ++n_objects_in_use;
+      if (!available_objects.empty())
+        {
+          std::unique_ptr<ScratchData> scratch_data =
+            std::move(available_objects.back());
+          available_objects.pop_back();
+          return scratch_data;
+        }
+    }
+
+    // Copy the sample outside of the lock, since this can be expensive
+    return std::make_unique<ScratchData>(sample_scratch_data);
+  }
+
+
+
+  template <class ScratchData>
+  void
+  ScratchDataPool<ScratchData>::release(
+    std::unique_ptr<ScratchData> &&scratch_data)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    Assert(n_objects_in_use > 0, ExcInternalError());
+    --n_objects_in_use;
+    available_objects.push_back(std::move(scratch_data));
+  }
+
+#endif // DOXYGEN
+
+} // namespace MeshWorker
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -85,6 +85,19 @@ public:
              VectorType &       dst,
              const VectorType & src) const = 0;
 
+  /**
+   * Compute the residual $dst = rhs - A\,src$ on a certain level. The
+   * default implementation calls vmult() and subtracts the result from
+   * @p rhs in a separate pass over the vectors. Derived classes can override
+   * this function to compute the subtraction while the level matrix is
+   * applied, saving one read and one write of the level vectors.
+   */
+  virtual void
+  residual(const unsigned int level,
+           VectorType &       dst,
+           const VectorType & src,
+           const VectorType & rhs) const;
+
   /**
    * Return the minimal level for which matrices are stored.
    */
@@ -19,12 +19,19 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/partitioner.h>
+
 #include <deal.II/lac/full_matrix.h>
 #include <deal.II/lac/householder.h>
+#include <deal.II/lac/la_parallel_vector.h>
 #include <deal.II/lac/linear_operator.h>
 
 #include <deal.II/multigrid/mg_base.h>
 
+#include <functional>
+#include <memory>
+
 DEAL_II_NAMESPACE_OPEN
 
 /**
@@ -239,6 +246,170 @@ private:
   LAPACKFullMatrix<number> matrix;
 };
 
+/**
+ * Coarse grid solver that runs on the subset of MPI processes that own
+ * elements of the coarse level vectors, leaving the other processes idle.
+ *
+ * When the coarse levels of a multigrid hierarchy, e.g., the ones of
+ * MGTransferGlobalCoarsening, have been repartitioned onto fewer processes
+ * with the classes in the RepartitioningPolicyTools namespace, most processes
+ * do not own any cells or degrees of freedom on the coarse level. The
+ * smoothers and transfer operators then only involve the point-to-point
+ * communication between the processes that actually own data. A coarse
+ * solver set up on the communicator of the coarse level vectors, however,
+ * makes all processes take part in each of its global reductions. This
+ * class instead builds a communicator that only contains the processes that
+ * own elements of the coarse vectors, copies the coarse vectors into
+ * vectors with the same locally owned ranges on this subcommunicator, and
+ * calls a user-provided coarse solver on these vectors. The other processes
+ * skip the coarse solve altogether.
+ *
+ * The coarse solver, e.g., a direct or an algebraic multigrid solver for a
+ * matrix distributed over the subcommunicator, is set up for the
+ * communicator returned by get_communicator() once initialize() has been
+ * called:
+ * @code
+ *   MGCoarseGridSubcommunicator<double> mg_coarse;
+ *   mg_coarse.initialize(
+ *     level_matrices[min_level].get_vector_partitioner());
+ *   if (mg_coarse.is_active())
+ *     {
+ *       // build the matrix and solver on mg_coarse.get_communicator()
+ *       ...
+ *       mg_coarse.set_solver(
+ *         [&](LinearAlgebra::distributed::Vector<double> &      dst,
+ *             const LinearAlgebra::distributed::Vector<double> &src) {
+ *           coarse_solver.vmult(dst, src);
+ *         });
+ *     }
+ * @endcode
+ */
+template <typename Number>
+class MGCoarseGridSubcommunicator
+  : public MGCoarseGridBase<LinearAlgebra::distributed::Vector<Number>>
+{
+public:
+  /**
+   * The vector type of the multigrid levels and of the coarse solver.
+   */
+  using VectorType = LinearAlgebra::distributed::Vector<Number>;
+
+  /**
+   * Type of the function that solves the coarse problem with the vectors on
+   * the subcommunicator.
+   */
+  using SolverFunction =
+    std::function<void(VectorType &dst, const VectorType &src)>;
+
+  /**
+   * Constructor leaving an uninitialized object.
+   */
+  MGCoarseGridSubcommunicator() = default;
+
+  /**
+   * This class owns an MPI communicator and can therefore not be copied.
+   */
+  MGCoarseGridSubcommunicator(const MGCoarseGridSubcommunicator &) = delete;
+
+  /**
+   * This class owns an MPI communicator and can therefore not be copied.
+   */
+  MGCoarseGridSubcommunicator &
+  operator=(const MGCoarseGridSubcommunicator &) = delete;
+
+  /**
+   * Destructor. Frees the subcommunicator.
+   */
+  ~MGCoarseGridSubcommunicator() override;
+
+  /**
+   * Set up the subcommunicator of the processes that own elements for the
+   * coarse level vectors described by @p partitioner. This function is
+   * collective over the communicator of @p partitioner.
+   */
+  void
+  initialize(
+    const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner);
+
+  /**
+   * Set the function that solves the coarse problem on the vectors of the
+   * subcommunicator. Only needs to be called on the active processes.
+   */
+  void
+  set_solver(const SolverFunction &solver);
+
+  /**
+   * Return whether the current process is part of the subcommunicator,
+   * i.e., owns elements of the coarse level vectors.
+   */
+  bool
+  is_active() const;
+
+  /**
+   * Return the subcommunicator, or MPI_COMM_NULL on processes that do not
+   * own elements of the coarse level vectors.
+   */
+  const MPI_Comm &
+  get_communicator() const;
+
+  /**
+   * Return the partitioner of the vectors passed to the coarse solver, which
+   * has the same locally owned ranges as the coarse level vectors but is
+   * defined on the subcommunicator. Only valid on the active processes.
+   */
+  const std::shared_ptr<const Utilities::MPI::Partitioner> &
+  get_partitioner() const;
+
+  /**
+   * Copy @p src to the subcommunicator, run the coarse solver there, and
+   * copy the result back to @p dst. Processes that are not active return
+   * immediately.
+   */
+  void
+  operator()(const unsigned int level,
+             VectorType &       dst,
+             const VectorType & src) const override;
+
+private:
+  /**
+   * Release the subcommunicator.
+   */
+  void
+  free_communicator();
+
+  /**
+   * The communicator of the processes owning elements.
+   */
+  MPI_Comm communicator = MPI_COMM_NULL;
+
+  /**
+   * Whether the communicator has been created by this class and needs to be
+   * freed.
+   */
+  bool owns_communicator = false;
+
+  /**
+   * Whether the current process owns elements of the coarse level vectors.
+   */
+  bool active = false;
+
+  /**
+   * The partitioner on the subcommunicator.
+   */
+  std::shared_ptr<const Utilities::MPI::Partitioner> partitioner;
+
+  /**
+   * The coarse solver.
+   */
+  SolverFunction solver;
+
+  /**
+   * Vectors on the subcommunicator.
+   */
+  mutable VectorType src_subcommunicator;
+  mutable VectorType dst_subcommunicator;
+};
+
 /** @} */
 
 #ifndef DOXYGEN
@@ -503,6 +674,138 @@ MGCoarseGridSVD<number, VectorType>::log() const
 }
 
 
+//---------------------------------------------------------------------------
+
+
+
+template <typename Number>
+MGCoarseGridSubcommunicator<Number>::~MGCoarseGridSubcommunicator()
+{
+  free_communicator();
+}
+
+
+
+template <typename Number>
+void
+MGCoarseGridSubcommunicator<Number>::free_communicator()
+{
+#  ifdef DEAL_II_WITH_MPI
+  if (owns_communicator && communicator != MPI_COMM_NULL)
+    Utilities::MPI::free_communicator(communicator);
+#  endif
+  communicator      = MPI_COMM_NULL;
+  owns_communicator = false;
+}
+
+
+
+template <typename Number>
+void
+MGCoarseGridSubcommunicator<Number>::initialize(
+  const std::shared_ptr<const Utilities::MPI::Partitioner> &level_partitioner)
+{
+  Assert(level_partitioner != nullptr, ExcNotInitialized());
+
+  free_communicator();
+  partitioner.reset();
+  solver = SolverFunction();
+  src_subcommunicator.reinit(0);
+  dst_subcommunicator.reinit(0);
+
+  active = level_partitioner->locally_owned_size() > 0;
+
+#  ifdef DEAL_II_WITH_MPI
+  const MPI_Comm &level_communicator =
+    level_partitioner->get_mpi_communicator();
+  const int ierr =
+    MPI_Comm_split(level_communicator,
+                   active ? 0 : MPI_UNDEFINED,
+                   Utilities::MPI::this_mpi_process(level_communicator),
+                   &communicator);
+  AssertThrowMPI(ierr);
+  owns_communicator = true;
+#  else
+  communicator = level_partitioner->get_mpi_communicator();
+#  endif
+
+  if (is_active())
+    {
+      partitioner = std::make_shared<Utilities::MPI::Partitioner>(
+        level_partitioner->locally_owned_range(), communicator);
+      src_subcommunicator.reinit(partitioner);
+      dst_subcommunicator.reinit(partitioner);
+    }
+}
+
+
+
+template <typename Number>
+void
+MGCoarseGridSubcommunicator<Number>::set_solver(const SolverFunction &solver)
+{
+  Assert(is_active(),
+         ExcMessage("The coarse solver is only used on the processes that "
+                    "own elements of the coarse level vectors."));
+  this->solver = solver;
+}
+
+
+
+template <typename Number>
+bool
+MGCoarseGridSubcommunicator<Number>::is_active() const
+{
+  return active;
+}
+
+
+
+template <typename Number>
+const MPI_Comm &
+MGCoarseGridSubcommunicator<Number>::get_communicator() const
+{
+  return communicator;
+}
+
+
+
+template <typename Number>
+const std::shared_ptr<const Utilities::MPI::Partitioner> &
+MGCoarseGridSubcommunicator<Number>::get_partitioner() const
+{
+  return partitioner;
+}
+
+
+
+template <typename Number>
+void
+MGCoarseGridSubcommunicator<Number>::operator()(const unsigned int /*level*/,
+                                                VectorType &      dst,
+                                                const VectorType &src) const
+{
+  if (is_active() == false)
+    {
+      AssertDimension(src.locally_owned_size(), 0);
+      return;
+    }
+
+  Assert(solver, ExcMessage("No coarse solver has been set."));
+  AssertDimension(src.locally_owned_size(),
+                  src_subcommunicator.locally_owned_size());
+  AssertDimension(dst.locally_owned_size(),
+                  dst_subcommunicator.locally_owned_size());
+
+  std::copy(src.begin(), src.end(), src_subcommunicator.begin());
+  dst_subcommunicator = Number();
+  solver(dst_subcommunicator, src_subcommunicator);
+  std::copy(dst_subcommunicator.begin(),
+            dst_subcommunicator.end(),
+            dst.begin());
+}
+
+
 #endif // DOXYGEN
 
 DEAL_II_NAMESPACE_CLOSE
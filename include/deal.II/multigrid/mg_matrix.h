@@ -19,13 +19,16 @@
 #include <deal.II/base/config.h>
 
 #include <deal.II/base/mg_level_object.h>
+#include <deal.II/base/template_constraints.h>
 
+#include <deal.II/lac/la_parallel_vector.h>
 #include <deal.II/lac/linear_operator.h>
 #include <deal.II/lac/sparse_matrix.h>
 #include <deal.II/lac/vector.h>
 
 #include <deal.II/multigrid/mg_base.h>
 
+#include <functional>
 #include <memory>
 
 DEAL_II_NAMESPACE_OPEN
@@ -94,6 +97,24 @@ namespace mg
     Tvmult_add(const unsigned int level,
                VectorType &       dst,
                const VectorType & src) const override;
+
+    /**
+     * Compute the residual $dst = rhs - A\,src$ on a certain level. If the
+     * matrices passed to initialize() provide a
+     * <code>vmult(dst, src, operation_before, operation_after)</code>
+     * function, like the operators derived from MatrixFreeOperators::Base,
+     * and the vectors are of type Vector or
+     * LinearAlgebra::distributed::Vector, the subtraction is computed in
+     * @p operation_after on the entries the operator has finished with,
+     * while they are still in cache. Otherwise, the implementation of the
+     * base class is used.
+     */
+    virtual void
+    residual(const unsigned int level,
+             VectorType &       dst,
+             const VectorType & src,
+             const VectorType & rhs) const override;
+
     virtual unsigned int
     get_minlevel() const override;
     virtual unsigned int
@@ -107,6 +128,14 @@ namespace mg
 
   private:
     MGLevelObject<LinearOperator<VectorType>> matrices;
+
+    /**
+     * Functions computing the residual with the fused vector operations
+     * described in residual(), if supported by the level matrices.
+     */
+    MGLevelObject<std::function<
+      void(VectorType &dst, const VectorType &src, const VectorType &rhs)>>
+      fused_residuals;
   };
 
 } // namespace mg
@@ -199,12 +228,82 @@ private:
 
 namespace mg
 {
+  namespace internal
+  {
+    // a helper type-trait to figure out if MatrixType has a function
+    // MatrixType::vmult(VectorType &, const VectorType&,
+    // std::function<...>, std::function<...>) const
+    template <typename MatrixType, typename VectorType>
+    using vmult_functions_t = decltype(std::declval<MatrixType const>().vmult(
+      std::declval<VectorType &>(),
+      std::declval<const VectorType &>(),
+      std::declval<
+        const std::function<void(const unsigned int, const unsigned int)> &>(),
+      std::declval<const std::function<void(const unsigned int,
+                                            const unsigned int)> &>()));
+
+    template <typename MatrixType, typename VectorType>
+    constexpr bool has_fused_residual =
+      dealii::internal::
+        is_supported_operation<vmult_functions_t, MatrixType, VectorType> &&
+      (std::is_same<VectorType,
+                    dealii::Vector<typename VectorType::value_type>>::value ||
+       std::is_same<
+         VectorType,
+         LinearAlgebra::distributed::Vector<typename VectorType::value_type,
+                                            MemorySpace::Host>>::value);
+
+
+
+    template <typename VectorType,
+              typename MatrixType,
+              std::enable_if_t<!has_fused_residual<MatrixType, VectorType>,
+                               MatrixType> * = nullptr>
+    std::function<void(VectorType &, const VectorType &, const VectorType &)>
+    create_fused_residual(const MatrixType &)
+    {
+      return {};
+    }
+
+
+
+    template <typename VectorType,
+              typename MatrixType,
+              std::enable_if_t<has_fused_residual<MatrixType, VectorType>,
+                               MatrixType> * = nullptr>
+    std::function<void(VectorType &, const VectorType &, const VectorType &)>
+    create_fused_residual(const MatrixType &matrix)
+    {
+      return [&matrix](VectorType &      dst,
+                       const VectorType &src,
+                       const VectorType &rhs) {
+        using Number = typename VectorType::value_type;
+        Number *const       dst_ptr = dst.begin();
+        const Number *const rhs_ptr = rhs.begin();
+        matrix.vmult(
+          dst,
+          src,
+          [&](const unsigned int begin, const unsigned int end) {
+            std::fill(dst_ptr + begin, dst_ptr + end, Number());
+          },
+          [&](const unsigned int begin, const unsigned int end) {
+            DEAL_II_OPENMP_SIMD_PRAGMA
+            for (unsigned int i = begin; i < end; ++i)
+              dst_ptr[i] = rhs_ptr[i] - dst_ptr[i];
+          });
+      };
+    }
+  } // namespace internal
+
+
+
   template <typename VectorType>
   template <typename MatrixType>
   inline void
   Matrix<VectorType>::initialize(const MGLevelObject<MatrixType> &p)
   {
     matrices.resize(p.min_level(), p.max_level());
+    fused_residuals.resize(p.min_level(), p.max_level());
     for (unsigned int level = p.min_level(); level <= p.max_level(); ++level)
       {
         // Workaround: Unfortunately, not every "p[level]" object has a
@@ -214,6 +313,8 @@ namespace mg
           linear_operator<VectorType>(LinearOperator<VectorType>(),
                                       Utilities::get_underlying_value(
                                         p[level]));
+        fused_residuals[level] = internal::create_fused_residual<VectorType>(
+          Utilities::get_underlying_value(p[level]));
       }
   }
 
@@ -224,6 +325,7 @@ namespace mg
   Matrix<VectorType>::reset()
   {
     matrices.resize(0, 0);
+    fused_residuals.resize(0, 0);
   }
 
 
@@ -290,6 +392,21 @@ namespace mg
 
 
 
+  template <typename VectorType>
+  void
+  Matrix<VectorType>::residual(const unsigned int level,
+                               VectorType &       dst,
+                               const VectorType & src,
+                               const VectorType & rhs) const
+  {
+    if (fused_residuals[level])
+      fused_residuals[level](dst, src, rhs);
+    else
+      MGMatrixBase<VectorType>::residual(level, dst, src, rhs);
+  }
+
+
+
   template <typename VectorType>
   unsigned int
   Matrix<VectorType>::get_minlevel() const
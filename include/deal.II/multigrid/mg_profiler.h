@@ -0,0 +1,347 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+#ifndef dealii_mg_profiler_h
+#define dealii_mg_profiler_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/mg_level_object.h>
+#include <deal.II/base/mpi.h>
+
+#include <deal.II/multigrid/multigrid.h>
+
+#include <boost/signals2.hpp>
+
+#include <array>
+#include <chrono>
+#include <ostream>
+#include <string>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * @addtogroup mg
+ * @{
+ */
+
+/**
+ * A class that collects the run time of the operations of a multigrid cycle
+ * on each level, by connecting to the signals of a Multigrid object (see
+ * mg::Signals). For each level and each of the operations pre-smoothing,
+ * residual computation, restriction, coarse solve, prolongation, edge
+ * prolongation, and post-smoothing, the number of calls and the accumulated
+ * wall time are recorded. If level vectors are given to connect(), the
+ * number of bytes moved through memory is estimated from their sizes, and
+ * the resulting memory throughput indicates whether an operation runs at
+ * the bandwidth limit of the machine or, typically on coarse levels, is
+ * dominated by latency.
+ *
+ * The estimate of the memory traffic only counts the accesses to the
+ * vectors, but not the ones to the matrix or other data of the level
+ * operators: a smoothing step and the residual computation read two vectors
+ * and write one, the restriction reads the vector on the fine level and
+ * writes the one on the coarse level, the prolongation reads the coarse
+ * vector and reads and writes the fine one, and the coarse solve reads one
+ * and writes one vector. No traffic is attributed to the edge prolongation,
+ * which only does work on locally refined meshes. Thus, the throughput reported by this class is a
+ * lower bound for the actual one.
+ *
+ * In parallel computations, the times of all processes are combined by
+ * print_summary(). Since the signals do not reveal the time spent in
+ * communication routines, the time the processes wait for each other is
+ * estimated as the difference between the maximal and the average time over
+ * all processes, i.e., the time lost due to load imbalance and slow
+ * communication on a level.
+ *
+ * A typical use is as follows:
+ * @code
+ *   Multigrid<VectorType> mg(mg_matrix, mg_coarse, mg_transfer, mg_smoother,
+ *                            mg_smoother);
+ *   MGProfiler profiler(MPI_COMM_WORLD);
+ *   profiler.connect(mg, level_vectors);
+ *
+ *   // ... solve with PreconditionMG ...
+ *
+ *   profiler.print_summary(std::cout);
+ * @endcode
+ * The output follows the format of TimerOutput::print_wall_time_statistics()
+ * with one section per level and operation.
+ *
+ * @note The signals of the additive cycle of Multigrid are emitted from
+ * several threads at once for different levels. This is supported since the
+ * data of different levels is kept separately.
+ */
+class MGProfiler
+{
+public:
+  /**
+   * The operations of a multigrid cycle for which the run time is recorded.
+   */
+  enum Operation
+  {
+    /**
+     * The pre-smoothing step, see mg::Signals::pre_smoother_step.
+     */
+    pre_smoother_step,
+    /**
+     * The residual computation, see mg::Signals::residual_step.
+     */
+    residual_step,
+    /**
+     * The restriction from the given level to the next coarser one, see
+     * mg::Signals::restriction.
+     */
+    restriction,
+    /**
+     * The coarse solve, see mg::Signals::coarse_solve.
+     */
+    coarse_solve,
+    /**
+     * The prolongation from the next coarser level to the given one, see
+     * mg::Signals::prolongation.
+     */
+    prolongation,
+    /**
+     * The prolongation along the edges of a locally refined mesh, see
+     * mg::Signals::edge_prolongation.
+     */
+    edge_prolongation,
+    /**
+     * The post-smoothing step, see mg::Signals::post_smoother_step.
+     */
+    post_smoother_step,
+    /**
+     * The number of operations.
+     */
+    n_operations
+  };
+
+  /**
+   * The data recorded for one operation on one level.
+   */
+  struct Data
+  {
+    /**
+     * The number of calls.
+     */
+    unsigned long int n_calls = 0;
+
+    /**
+     * The accumulated wall time in seconds.
+     */
+    double wall_time = 0.;
+
+    /**
+     * The estimated number of bytes moved through memory in all calls.
+     */
+    double bytes = 0.;
+  };
+
+  /**
+   * Constructor. The communicator @p mpi_comm is used to combine the times
+   * of all processes in print_summary().
+   */
+  MGProfiler(const MPI_Comm mpi_comm = MPI_COMM_SELF);
+
+  /**
+   * Destructor. Disconnects from the signals.
+   */
+  ~MGProfiler();
+
+  /**
+   * Connect to the signals of @p mg, without an estimate of the memory
+   * traffic.
+   */
+  template <typename VectorType>
+  void
+  connect(Multigrid<VectorType> &mg);
+
+  /**
+   * Connect to the signals of @p mg and estimate the memory traffic from
+   * the locally owned sizes of the vectors in @p level_vectors, which must
+   * be defined on the levels of @p mg. Only the sizes of the vectors are
+   * used, so they may also be vectors that are otherwise unused.
+   */
+  template <typename VectorType>
+  void
+  connect(Multigrid<VectorType> &          mg,
+          const MGLevelObject<VectorType> &level_vectors);
+
+  /**
+   * Disconnect from the signals of the Multigrid object. The data recorded
+   * so far is kept.
+   */
+  void
+  disconnect();
+
+  /**
+   * Set all recorded data to zero.
+   */
+  void
+  reset();
+
+  /**
+   * Return the data recorded for @p operation on @p level on this process.
+   */
+  const Data &
+  get_data(const unsigned int level, const Operation operation) const;
+
+  /**
+   * Return the name of @p operation as printed by print_summary().
+   */
+  static std::string
+  get_operation_name(const Operation operation);
+
+  /**
+   * Print a table with the number of calls, the average wall time over all
+   * processes, its fraction of the total time, the estimated waiting time,
+   * and the memory throughput of each operation on each level to @p out on
+   * the first process of the communicator. The throughput is the estimated
+   * memory traffic of all processes divided by the maximal time over the
+   * processes. Only the operations that have been called are listed. This
+   * function is collective over all processes of the communicator passed to
+   * the constructor.
+   */
+  void
+  print_summary(std::ostream &out) const;
+
+private:
+  /**
+   * Connect to the signals of @p mg, with the locally owned sizes
+   * @p level_sizes of the level vectors in bytes, or an empty vector if the
+   * memory traffic is not estimated.
+   */
+  template <typename VectorType>
+  void
+  connect_signals(Multigrid<VectorType> &    mg,
+                  const std::vector<double> &level_sizes);
+
+  /**
+   * Resize the data structures for the levels up to @p max_level and set
+   * the number of bytes per call of each operation from the locally owned
+   * sizes @p level_sizes of the level vectors (given in bytes), if
+   * non-empty.
+   */
+  void
+  setup_levels(const unsigned int         min_level,
+               const unsigned int         max_level,
+               const std::vector<double> &level_sizes);
+
+  /**
+   * Start or stop the timer of @p operation on @p level.
+   */
+  void
+  record(const Operation    operation,
+         const bool         before,
+         const unsigned int level);
+
+  /**
+   * The communicator over which the data is combined.
+   */
+  const MPI_Comm mpi_comm;
+
+  /**
+   * The recorded data, indexed by level and operation.
+   */
+  std::vector<std::array<Data, n_operations>> data;
+
+  /**
+   * The estimated number of bytes moved by one call of each operation,
+   * indexed by level and operation.
+   */
+  std::vector<std::array<double, n_operations>> bytes_per_call;
+
+  /**
+   * The point in time when each operation was started the last time.
+   */
+  std::vector<
+    std::array<std::chrono::time_point<std::chrono::steady_clock>,
+               n_operations>>
+    start_times;
+
+  /**
+   * The connections to the signals.
+   */
+  std::vector<boost::signals2::connection> connections;
+};
+
+/** @} */
+
+#ifndef DOXYGEN
+
+template <typename VectorType>
+void
+MGProfiler::connect(Multigrid<VectorType> &mg)
+{
+  connect_signals(mg, std::vector<double>());
+}
+
+
+
+template <typename VectorType>
+void
+MGProfiler::connect(Multigrid<VectorType> &          mg,
+                    const MGLevelObject<VectorType> &level_vectors)
+{
+  Assert(level_vectors.min_level() <= mg.get_minlevel() &&
+           level_vectors.max_level() >= mg.get_maxlevel(),
+         ExcMessage("The level vectors must be defined on all levels "
+                    "of the multigrid object."));
+
+  std::vector<double> level_sizes(mg.get_maxlevel() + 1);
+  for (unsigned int l = mg.get_minlevel(); l <= mg.get_maxlevel(); ++l)
+    level_sizes[l] =
+      static_cast<double>(level_vectors[l].locally_owned_size()) *
+      sizeof(typename VectorType::value_type);
+
+  connect_signals(mg, level_sizes);
+}
+
+
+
+template <typename VectorType>
+void
+MGProfiler::connect_signals(Multigrid<VectorType> &    mg,
+                            const std::vector<double> &level_sizes)
+{
+  disconnect();
+  setup_levels(mg.get_minlevel(), mg.get_maxlevel(), level_sizes);
+
+  const auto slot = [this](const Operation operation) {
+    return [this, operation](const bool before, const unsigned int level) {
+      record(operation, before, level);
+    };
+  };
+
+  connections.push_back(
+    mg.connect_pre_smoother_step(slot(pre_smoother_step)));
+  connections.push_back(mg.connect_residual_step(slot(residual_step)));
+  connections.push_back(mg.connect_restriction(slot(restriction)));
+  connections.push_back(mg.connect_coarse_solve(slot(coarse_solve)));
+  connections.push_back(mg.connect_prolongation(slot(prolongation)));
+  connections.push_back(
+    mg.connect_edge_prolongation(slot(edge_prolongation)));
+  connections.push_back(
+    mg.connect_post_smoother_step(slot(post_smoother_step)));
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -487,6 +487,17 @@ public:
   void
   print_indices(std::ostream &os) const;
 
+  /**
+   * Return whether copy_to_mg() and copy_from_mg() are plain copies between
+   * the global vector and the vector on the finest level, i.e., the mesh
+   * has no adaptive refinement and the numbering on the finest level is the
+   * same as the global one. In that case, PreconditionMG lets the solution
+   * on the finest level use the memory of the destination vector, see the
+   * documentation of that class.
+   */
+  bool
+  performs_plain_copy() const;
+
 protected:
   /**
    * Internal function to perform transfer of residuals or solutions
@@ -30,6 +30,8 @@
 #include <deal.II/multigrid/mg_base.h>
 #include <deal.II/multigrid/mg_transfer_matrix_free.h>
 
+#include <functional>
+
 DEAL_II_NAMESPACE_OPEN
 
 // Forward declarations
@@ -149,6 +151,87 @@ namespace MGTransferGlobalCoarseningTools
     const RepartitioningPolicyTools::Base<dim, spacedim> &policy,
     const bool repartition_fine_triangulation = false);
 
+  /**
+   * A level of a multigrid hierarchy that combines geometric and polynomial
+   * coarsening, as determined by create_hybrid_coarsening_sequence().
+   */
+  struct HybridCoarseningLevel
+  {
+    /**
+     * Index of the triangulation in the geometric coarsening sequence, with
+     * zero denoting the coarsest one.
+     */
+    unsigned int geometric_level;
+
+    /**
+     * Polynomial degree of the finite element on this level.
+     */
+    unsigned int degree;
+  };
+
+  /**
+   * Costs used by create_hybrid_coarsening_sequence() to compare different
+   * multigrid hierarchies. The costs are typically obtained by measuring the
+   * run time of the operators of a given application, but any consistent
+   * measure of work works as well.
+   */
+  struct HybridCoarseningCosts
+  {
+    /**
+     * Cost of all operations that a V-cycle performs on a level with @p n_cells
+     * cells of polynomial degree @p degree, i.e., the smoothing steps, the
+     * residual computation, and the transfer to the next coarser level.
+     */
+    std::function<double(const unsigned int             degree,
+                         const types::global_cell_index n_cells)>
+      level_cost;
+
+    /**
+     * Cost of solving the coarse grid problem on a level with @p n_cells
+     * cells of polynomial degree @p degree.
+     */
+    std::function<double(const unsigned int             degree,
+                         const types::global_cell_index n_cells)>
+      coarse_solver_cost;
+  };
+
+  /**
+   * Determine the multigrid hierarchy with the smallest cost of a V-cycle
+   * among all hierarchies that start with the finest triangulation and the
+   * polynomial degree @p fine_degree, and reach the coarser levels by steps
+   * that either coarsen the mesh by one level of the geometric coarsening
+   * sequence or reduce the degree according to one of the sequences in
+   * PolynomialCoarseningSequenceType. The argument @p n_cells contains the
+   * global number of cells of each triangulation of the geometric
+   * coarsening sequence in ascending order, e.g., as returned by
+   * <code>tria->n_global_active_cells()</code> for each entry of the result
+   * of create_geometric_coarsening_sequence().
+   *
+   * The cost of a hierarchy is the sum of HybridCoarseningCosts::level_cost
+   * of all levels except the coarsest one, plus
+   * HybridCoarseningCosts::coarse_solver_cost on the coarsest one, so the
+   * function also decides at which level to stop coarsening and call the
+   * coarse grid solver. Since the best solution is found by dynamic
+   * programming over all pairs of geometric level and degree, the effort is
+   * negligible compared to the setup of a multigrid method.
+   *
+   * The levels are returned from the coarsest to the finest one, i.e., in
+   * the same order as for the other functions in this namespace. The
+   * polynomial steps are restricted to the degree pairs precompiled in
+   * MGTwoLevelTransfer (see
+   * MGTwoLevelTransfer::fast_polynomial_transfer_supported()), and
+   * geometric steps keep the degree.
+   *
+   * @note The cost model only compares the work of a single V-cycle, not the
+   * number of iterations. Coarsening sequences with much worse convergence
+   * can be avoided by adding a penalty to the respective level costs.
+   */
+  std::vector<HybridCoarseningLevel>
+  create_hybrid_coarsening_sequence(
+    const std::vector<types::global_cell_index> &n_cells,
+    const unsigned int                           fine_degree,
+    const HybridCoarseningCosts &                costs);
+
 } // namespace MGTransferGlobalCoarseningTools
 
 
@@ -336,6 +419,13 @@ private:
   zero_out_ghost_values(
     const LinearAlgebra::distributed::Vector<Number> &) const;
 
+  /**
+   * Fill #level_dof_indices_fine_contiguous from #level_dof_indices_fine.
+   * Needs to be called whenever the latter changes.
+   */
+  void
+  setup_contiguous_dof_indices_fine();
+
   /**
    * A multigrid transfer scheme. A multrigrid transfer class can have different
    * transfer schemes to enable p-adaptivity (one transfer scheme per
@@ -491,6 +581,19 @@ private:
    */
   std::vector<unsigned int> level_dof_indices_fine;
 
+  /**
+   * For each batch of fine cells, the index of the first DoF of the cell in
+   * each lane, if the DoF indices of all cells of the batch are contiguous.
+   * In that case, the DoF values can be read and written with
+   * vectorized_load_and_transpose() and vectorized_transpose_and_store()
+   * instead of one indirect access per DoF and lane. Batches that are not
+   * contiguous or not completely filled are marked with
+   * numbers::invalid_unsigned_int in the first lane. This is only set up for
+   * discontinuous elements on the fine cells, otherwise it is left empty.
+   */
+  std::vector<std::array<unsigned int, VectorizedArray<Number>::size()>>
+    level_dof_indices_fine_contiguous;
+
   /**
    * Number of components.
    */
@@ -1733,6 +1733,8 @@ namespace internal
           if (is_feq)
             compress_weights(transfer);
         }
+
+      transfer.setup_contiguous_dof_indices_fine();
     }
 
 
@@ -2221,6 +2223,8 @@ namespace internal
           if (is_feq)
             compress_weights(transfer);
         }
+
+      transfer.setup_contiguous_dof_indices_fine();
     }
   };
 
@@ -2624,6 +2628,11 @@ MGTwoLevelTransfer<dim, LinearAlgebra::distributed::Vector<Number>>::
   const Number *                 weights      = nullptr;
   const VectorizedArray<Number> *weights_compressed = nullptr;
 
+  const std::array<unsigned int, n_lanes> *indices_fine_contiguous =
+    level_dof_indices_fine_contiguous.empty() ?
+      nullptr :
+      level_dof_indices_fine_contiguous.data();
+
   if (fine_element_is_continuous)
     {
       weights            = this->weights.data();
@@ -2705,23 +2714,39 @@ MGTwoLevelTransfer<dim, LinearAlgebra::distributed::Vector<Number>>::
               weights_compressed += Utilities::pow(3, dim);
             }
 
-          for (unsigned int v = 0; v < n_lanes_filled; ++v)
+          if (indices_fine_contiguous != nullptr &&
+              (*indices_fine_contiguous)[0] != numbers::invalid_unsigned_int)
             {
-              if (fine_element_is_continuous &&
-                  this->weights_compressed.size() == 0)
-                for (unsigned int i = 0; i < scheme.n_dofs_per_cell_fine; ++i)
-                  vec_fine_ptr->local_element(indices_fine[i]) +=
-                    evaluation_data_fine[i][v] * weights[i];
-              else
-                for (unsigned int i = 0; i < scheme.n_dofs_per_cell_fine; ++i)
-                  vec_fine_ptr->local_element(indices_fine[i]) +=
-                    evaluation_data_fine[i][v];
+              vectorized_transpose_and_store(true,
+                                             scheme.n_dofs_per_cell_fine,
+                                             evaluation_data_fine.data(),
+                                             indices_fine_contiguous->data(),
+                                             vec_fine_ptr->begin());
+              indices_fine += n_lanes * scheme.n_dofs_per_cell_fine;
+            }
+          else
+            for (unsigned int v = 0; v < n_lanes_filled; ++v)
+              {
+                if (fine_element_is_continuous &&
+                    this->weights_compressed.size() == 0)
+                  for (unsigned int i = 0; i < scheme.n_dofs_per_cell_fine;
+                       ++i)
+                    vec_fine_ptr->local_element(indices_fine[i]) +=
+                      evaluation_data_fine[i][v] * weights[i];
+                else
+                  for (unsigned int i = 0; i < scheme.n_dofs_per_cell_fine;
+                       ++i)
+                    vec_fine_ptr->local_element(indices_fine[i]) +=
+                      evaluation_data_fine[i][v];
 
-              indices_fine += scheme.n_dofs_per_cell_fine;
+                indices_fine += scheme.n_dofs_per_cell_fine;
 
-              if (fine_element_is_continuous)
-                weights += scheme.n_dofs_per_cell_fine;
-            }
+                if (fine_element_is_continuous)
+                  weights += scheme.n_dofs_per_cell_fine;
+              }
+
+          if (indices_fine_contiguous != nullptr)
+            ++indices_fine_contiguous;
         }
     }
 
@@ -2776,6 +2801,11 @@ MGTwoLevelTransfer<dim, LinearAlgebra::distributed::Vector<Number>>::
   const Number *                 weights      = nullptr;
   const VectorizedArray<Number> *weights_compressed = nullptr;
 
+  const std::array<unsigned int, n_lanes> *indices_fine_contiguous =
+    level_dof_indices_fine_contiguous.empty() ?
+      nullptr :
+      level_dof_indices_fine_contiguous.data();
+
   if (fine_element_is_continuous)
     {
       weights            = this->weights.data();
@@ -2812,23 +2842,39 @@ MGTwoLevelTransfer<dim, LinearAlgebra::distributed::Vector<Number>>::
               n_lanes;
 
           // read from source vector and weight
-          for (unsigned int v = 0; v < n_lanes_filled; ++v)
+          if (indices_fine_contiguous != nullptr &&
+              (*indices_fine_contiguous)[0] != numbers::invalid_unsigned_int)
             {
-              if (fine_element_is_continuous &&
-                  this->weights_compressed.size() == 0)
-                for (unsigned int i = 0; i < scheme.n_dofs_per_cell_fine; ++i)
-                  evaluation_data_fine[i][v] =
-                    vec_fine_ptr->local_element(indices_fine[i]) * weights[i];
-              else
-                for (unsigned int i = 0; i < scheme.n_dofs_per_cell_fine; ++i)
-                  evaluation_data_fine[i][v] =
-                    vec_fine_ptr->local_element(indices_fine[i]);
+              vectorized_load_and_transpose(scheme.n_dofs_per_cell_fine,
+                                            vec_fine_ptr->begin(),
+                                            indices_fine_contiguous->data(),
+                                            evaluation_data_fine.data());
+              indices_fine += n_lanes * scheme.n_dofs_per_cell_fine;
+            }
+          else
+            for (unsigned int v = 0; v < n_lanes_filled; ++v)
+              {
+                if (fine_element_is_continuous &&
+                    this->weights_compressed.size() == 0)
+                  for (unsigned int i = 0; i < scheme.n_dofs_per_cell_fine;
+                       ++i)
+                    evaluation_data_fine[i][v] =
+                      vec_fine_ptr->local_element(indices_fine[i]) *
+                      weights[i];
+                else
+                  for (unsigned int i = 0; i < scheme.n_dofs_per_cell_fine;
+                       ++i)
+                    evaluation_data_fine[i][v] =
+                      vec_fine_ptr->local_element(indices_fine[i]);
 
-              indices_fine += scheme.n_dofs_per_cell_fine;
+                indices_fine += scheme.n_dofs_per_cell_fine;
 
-              if (fine_element_is_continuous)
-                weights += scheme.n_dofs_per_cell_fine;
-            }
+                if (fine_element_is_continuous)
+                  weights += scheme.n_dofs_per_cell_fine;
+              }
+
+          if (indices_fine_contiguous != nullptr)
+            ++indices_fine_contiguous;
 
           if (fine_element_is_continuous && this->weights_compressed.size() > 0)
             {
@@ -3110,6 +3156,7 @@ MGTwoLevelTransfer<dim, LinearAlgebra::distributed::Vector<Number>>::
       for (auto &i : level_dof_indices_fine)
         i = external_partitioner_fine->global_to_local(
           this->partitioner_fine->local_to_global(i));
+      setup_contiguous_dof_indices_fine();
 
       this->partitioner_fine_embedded =
         create_embedded_partitioner(this->partitioner_fine,
@@ -3294,6 +3341,8 @@ MGTwoLevelTransfer<dim, LinearAlgebra::distributed::Vector<Number>>::
   size += vec_coarse.memory_consumption();
   size += MemoryConsumption::memory_consumption(weights);
   size += MemoryConsumption::memory_consumption(level_dof_indices_fine);
+  size +=
+    MemoryConsumption::memory_consumption(level_dof_indices_fine_contiguous);
   size += constraint_info.memory_consumption();
 
   return size;
@@ -3301,6 +3350,68 @@ MGTwoLevelTransfer<dim, LinearAlgebra::distributed::Vector<Number>>::
 
 
 
+template <int dim, typename Number>
+void
+MGTwoLevelTransfer<dim, LinearAlgebra::distributed::Vector<Number>>::
+  setup_contiguous_dof_indices_fine()
+{
+  level_dof_indices_fine_contiguous.clear();
+
+  // continuous elements share DoFs between cells, so there is nothing to
+  // gain
+  if (fine_element_is_continuous)
+    return;
+
+  const unsigned int n_lanes = VectorizedArray<Number>::size();
+
+  std::vector<std::array<unsigned int, n_lanes>> contiguous;
+  bool                                           any_contiguous = false;
+
+  const unsigned int *indices_fine = level_dof_indices_fine.data();
+
+  for (const auto &scheme : schemes)
+    for (unsigned int cell = 0; cell < scheme.n_coarse_cells; cell += n_lanes)
+      {
+        const unsigned int n_lanes_filled =
+          (cell + n_lanes > scheme.n_coarse_cells) ?
+            (scheme.n_coarse_cells - cell) :
+            n_lanes;
+
+        std::array<unsigned int, n_lanes> offsets;
+        offsets.fill(numbers::invalid_unsigned_int);
+
+        bool is_contiguous = n_lanes_filled == n_lanes;
+        for (unsigned int v = 0; v < n_lanes_filled && is_contiguous; ++v)
+          {
+            const unsigned int *indices =
+              indices_fine + v * scheme.n_dofs_per_cell_fine;
+            for (unsigned int i = 1; i < scheme.n_dofs_per_cell_fine; ++i)
+              if (indices[i] != indices[0] + i)
+                {
+                  is_contiguous = false;
+                  break;
+                }
+            offsets[v] = indices[0];
+          }
+
+        if (is_contiguous)
+          any_contiguous = true;
+        else
+          offsets[0] = numbers::invalid_unsigned_int;
+
+        contiguous.push_back(offsets);
+        indices_fine += n_lanes_filled * scheme.n_dofs_per_cell_fine;
+      }
+
+  AssertDimension(indices_fine - level_dof_indices_fine.data(),
+                  level_dof_indices_fine.size());
+
+  if (any_contiguous)
+    level_dof_indices_fine_contiguous = std::move(contiguous);
+}
+
+
+
 template <int dim, typename Number>
 void
 MGTwoLevelTransfer<dim, LinearAlgebra::distributed::Vector<Number>>::
@@ -22,6 +22,7 @@
 #include <deal.II/base/mg_level_object.h>
 #include <deal.II/base/smartpointer.h>
 #include <deal.II/base/subscriptor.h>
+#include <deal.II/base/template_constraints.h>
 
 #include <deal.II/distributed/tria.h>
 
@@ -173,7 +174,35 @@ public:
     /// The W-cycle
     w_cycle,
     /// The F-cycle
-    f_cycle
+    f_cycle,
+    /**
+     * An additive cycle in the spirit of the BPX preconditioner. The
+     * defect is first restricted to all levels. Then, the smoother is
+     * applied with zero initial guess on all levels above #minlevel and
+     * the coarse grid solver on #minlevel. Since these operations are
+     * independent of each other, they are run as concurrent tasks. Finally,
+     * the corrections are prolongated and summed up from the coarsest to
+     * the finest level.
+     *
+     * Unlike the multiplicative cycles, each level only sees the restricted
+     * original defect, so the additive cycle typically needs more outer
+     * iterations. It must therefore be used as a preconditioner in a Krylov
+     * method, and the smoothers should be symmetric if this is SolverCG. In
+     * exchange, there is no sequential dependence between the levels, which
+     * helps on the coarser levels where there is too little work to keep
+     * all processes or threads busy.
+     *
+     * @note The smoothers and the coarse grid solver are called from
+     * different threads at the same time, so they must not share mutable
+     * state across levels. If they communicate via MPI, the levels need to
+     * use different communicators, or MPI must be initialized with
+     * <code>MPI_THREAD_MULTIPLE</code>. The slots connected to the
+     * pre-smoother and coarse solve signals are also called concurrently.
+     *
+     * @note The edge matrices of set_edge_matrices() and
+     * set_edge_flux_matrices() are not supported by this cycle.
+     */
+    additive_cycle
   };
 
   using vector_type       = VectorType;
@@ -381,6 +410,14 @@ private:
   void
   level_step(const unsigned int level, Cycle cycle);
 
+  /**
+   * The additive cycle, see Cycle::additive_cycle. Contrary to the other
+   * cycle types, all levels are treated in one function rather than
+   * recursively.
+   */
+  void
+  additive_step();
+
   /**
    * Cycle type performed by the method cycle().
    */
@@ -415,7 +452,8 @@ private:
   MGLevelObject<VectorType> t;
 
   /**
-   * Auxiliary vector for W- and F-cycles. Left uninitialized in V-cycle.
+   * Auxiliary vector for W-, F-, and additive cycles. Left uninitialized in
+   * V-cycle.
    */
   MGLevelObject<VectorType> defect2;
 
@@ -496,6 +534,18 @@ private:
  * If VectorType is in fact a block vector and the TRANSFER object supports
  * use of a separate DoFHandler for each block, this class also allows
  * to be initialized with a separate DoFHandler for each block.
+ *
+ * If the transfer is a plain copy between the global vector and the finest
+ * level (see MGLevelGlobalTransfer::performs_plain_copy()), and the
+ * destination vector of vmult() uses the same Utilities::MPI::Partitioner
+ * object as the level vectors on the finest level, the multigrid cycle
+ * writes its solution on the finest level directly into the destination
+ * vector, and Multigrid::solution on the finest level is left empty between
+ * calls to vmult(). This saves one vector of the size of the finest level
+ * and the copy from it. To make use of this for
+ * LinearAlgebra::distributed::Vector and a matrix-free operator, pass the
+ * partitioner of the vectors of the outer solver to
+ * MGTransferMatrixFree::build() for the finest level.
  */
 template <int dim, typename VectorType, class TRANSFER>
 class PreconditionMG : public Subscriptor
@@ -704,6 +754,59 @@ namespace internal
 {
   namespace PreconditionMGImplementation
   {
+    template <typename TRANSFER>
+    using performs_plain_copy_t =
+      decltype(std::declval<const TRANSFER &>().performs_plain_copy());
+
+    template <typename VectorType>
+    using get_partitioner_t =
+      decltype(std::declval<const VectorType &>().get_partitioner());
+
+    /**
+     * Return whether the solution vector on the finest level of @p multigrid
+     * can use the memory of @p dst instead of being copied into it. This is
+     * the case if the transfer is a plain copy, the vectors have the same
+     * type and share the same partitioner object (so that the setup of the
+     * level vectors in Multigrid::cycle() does not reallocate), and the
+     * level vectors of @p multigrid have been set up by a previous cycle.
+     */
+    template <typename VectorType,
+              class TRANSFER,
+              typename OtherVectorType,
+              std::enable_if_t<
+                std::is_same<VectorType, OtherVectorType>::value &&
+                  is_supported_operation<performs_plain_copy_t, TRANSFER> &&
+                  is_supported_operation<get_partitioner_t, VectorType>,
+                int> = 0>
+    bool
+    solution_can_use_dst(const dealii::Multigrid<VectorType> &multigrid,
+                         const TRANSFER &                     transfer,
+                         const OtherVectorType &              dst)
+    {
+      const unsigned int max_level = multigrid.get_maxlevel();
+      return transfer.performs_plain_copy() &&
+             multigrid.solution.min_level() == multigrid.get_minlevel() &&
+             multigrid.solution.max_level() == max_level &&
+             dst.get_partitioner().get() ==
+               multigrid.defect[max_level].get_partitioner().get();
+    }
+
+    template <typename VectorType,
+              class TRANSFER,
+              typename OtherVectorType,
+              std::enable_if_t<
+                !(std::is_same<VectorType, OtherVectorType>::value &&
+                  is_supported_operation<performs_plain_copy_t, TRANSFER> &&
+                  is_supported_operation<get_partitioner_t, VectorType>),
+                int> = 0>
+    bool
+    solution_can_use_dst(const dealii::Multigrid<VectorType> &,
+                         const TRANSFER &,
+                         const OtherVectorType &)
+    {
+      return false;
+    }
+
     template <int dim,
               typename VectorType,
               class TRANSFER,
@@ -726,10 +829,24 @@ namespace internal
         transfer.copy_to_mg(*dof_handler_vector[0], multigrid.defect, src);
       signals.transfer_to_mg(false);
 
+      // If possible, let the cycle write the solution on the finest level
+      // directly into dst and do not keep a separate vector for it
+      const bool use_dst =
+        uses_dof_handler_vector == false &&
+        solution_can_use_dst(multigrid, transfer, dst);
+      if (use_dst)
+        dst.swap(multigrid.solution[multigrid.get_maxlevel()]);
+
       multigrid.cycle();
 
       signals.transfer_to_global(true);
-      if (uses_dof_handler_vector)
+      if (use_dst)
+        {
+          dst.swap(multigrid.solution[multigrid.get_maxlevel()]);
+          dst.zero_out_ghost_values();
+          multigrid.solution[multigrid.get_maxlevel()].reinit(0);
+        }
+      else if (uses_dof_handler_vector)
         transfer.copy_from_mg(dof_handler_vector, dst, multigrid.solution);
       else
         transfer.copy_from_mg(*dof_handler_vector[0], dst, multigrid.solution);
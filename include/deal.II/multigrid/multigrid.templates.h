@@ -20,6 +20,8 @@
 #include <deal.II/base/config.h>
 
 #include <deal.II/base/logstream.h>
+#include <deal.II/base/thread_management.h>
+#include <deal.II/base/tracing.h>
 
 #include <deal.II/multigrid/multigrid.h>
 
@@ -113,6 +115,8 @@ template <typename VectorType>
 void
 Multigrid<VectorType>::level_v_step(const unsigned int level)
 {
+  DEAL_II_TRACE_SCOPE("Multigrid::level_v_step", "multigrid");
+
   if (level == minlevel)
     {
       this->signals.coarse_solve(true, level);
@@ -128,12 +132,14 @@ Multigrid<VectorType>::level_v_step(const unsigned int level)
 
   // compute residual on level, which includes the (CG) edge matrix
   this->signals.residual_step(true, level);
-  matrix->vmult(level, t[level], solution[level]);
-  if (edge_out != nullptr)
+  if (edge_out == nullptr)
+    matrix->residual(level, t[level], solution[level], defect[level]);
+  else
     {
+      matrix->vmult(level, t[level], solution[level]);
       edge_out->vmult_add(level, t[level], solution[level]);
+      t[level].sadd(-1.0, 1.0, defect[level]);
     }
-  t[level].sadd(-1.0, 1.0, defect[level]);
 
   // Get the defect on the next coarser level as part of the (DG) edge matrix
   // and then the main part by the restriction of the transfer
@@ -202,10 +208,14 @@ Multigrid<VectorType>::level_step(const unsigned int level, Cycle cycle)
 
   // compute residual on level, which includes the (CG) edge matrix
   this->signals.residual_step(true, level);
-  matrix->vmult(level, t[level], solution[level]);
-  if (edge_out != nullptr)
-    edge_out->vmult_add(level, t[level], solution[level]);
-  t[level].sadd(-1.0, 1.0, defect2[level]);
+  if (edge_out == nullptr)
+    matrix->residual(level, t[level], solution[level], defect2[level]);
+  else
+    {
+      matrix->vmult(level, t[level], solution[level]);
+      edge_out->vmult_add(level, t[level], solution[level]);
+      t[level].sadd(-1.0, 1.0, defect2[level]);
+    }
 
   // Get the defect on the next coarser level as part of the (DG) edge matrix
   // and then the main part by the restriction of the transfer
@@ -265,6 +275,54 @@ Multigrid<VectorType>::level_step(const unsigned int level, Cycle cycle)
 
 
 
+template <typename VectorType>
+void
+Multigrid<VectorType>::additive_step()
+{
+  Assert(edge_out == nullptr && edge_in == nullptr && edge_down == nullptr &&
+           edge_up == nullptr,
+         ExcMessage("The additive cycle does not support edge matrices."));
+
+  // Restrict the defect to all levels, combining it with the contribution
+  // from the initial copy_to_mg on each level
+  for (unsigned int level = maxlevel; level > minlevel; --level)
+    {
+      defect2[level] += defect[level];
+      defect2[level - 1] = typename VectorType::value_type(0.);
+
+      this->signals.restriction(true, level);
+      transfer->restrict_and_add(level, defect2[level - 1], defect2[level]);
+      this->signals.restriction(false, level);
+    }
+  defect2[minlevel] += defect[minlevel];
+
+  // Run the smoothers and the coarse grid solver concurrently. The last
+  // level is done by the current thread rather than a new task
+  Threads::TaskGroup<void> tasks;
+  for (unsigned int level = maxlevel; level > minlevel; --level)
+    tasks += Threads::new_task([this, level]() {
+      this->signals.pre_smoother_step(true, level);
+      pre_smooth->apply(level, solution[level], defect2[level]);
+      this->signals.pre_smoother_step(false, level);
+    });
+
+  this->signals.coarse_solve(true, minlevel);
+  (*coarse)(minlevel, solution[minlevel], defect2[minlevel]);
+  this->signals.coarse_solve(false, minlevel);
+
+  tasks.join_all();
+
+  // Sum up the corrections from the coarsest to the finest level
+  for (unsigned int level = minlevel + 1; level <= maxlevel; ++level)
+    {
+      this->signals.prolongation(true, level);
+      transfer->prolongate_and_add(level, solution[level], solution[level - 1]);
+      this->signals.prolongation(false, level);
+    }
+}
+
+
+
 template <typename VectorType>
 void
 Multigrid<VectorType>::cycle()
@@ -293,6 +351,8 @@ Multigrid<VectorType>::cycle()
 
   if (cycle_type == v_cycle)
     level_v_step(maxlevel);
+  else if (cycle_type == additive_cycle)
+    additive_step();
   else
     level_step(maxlevel, cycle_type);
 }
@@ -82,10 +82,16 @@ namespace NonMatching
    * For both spaces, it is possible to specify a custom Mapping, which
    * defaults to StaticMappingQ1 for both.
    *
-   * This function will also work in parallel, provided that the immersed
-   * triangulation is of type parallel::shared::Triangulation<dim1,spacedim>.
-   * An exception is thrown if you use an immersed
-   * parallel::distributed::Triangulation<dim1,spacedim>.
+   * This function will also work in parallel, both if the immersed
+   * triangulation is of type parallel::shared::Triangulation<dim1,spacedim>
+   * and if it is of type parallel::distributed::Triangulation<dim1,spacedim>.
+   * In the latter case, each process only computes the quadrature points of
+   * its locally owned immersed cells and sends them, together with the
+   * immersed degrees of freedom and, if needed, the shape function values, to
+   * the processes owning the embedding cells around them with
+   * Utilities::MPI::RemotePointEvaluation. Both finite elements then need to
+   * be primitive, and the immersed constraints are not supported, i.e.,
+   * `immersed_constraints` must not contain any constraints.
    *
    * See the tutorial program step-60 for an example on how to use this
    * function.
@@ -166,10 +172,16 @@ namespace NonMatching
    * For both spaces, it is possible to specify a custom Mapping, which
    * defaults to StaticMappingQ1 for both.
    *
-   * This function will also work in parallel, provided that the immersed
-   * triangulation is of type parallel::shared::Triangulation<dim1,spacedim>.
-   * An exception is thrown if you use an immersed
-   * parallel::distributed::Triangulation<dim1,spacedim>.
+   * This function will also work in parallel, both if the immersed
+   * triangulation is of type parallel::shared::Triangulation<dim1,spacedim>
+   * and if it is of type parallel::distributed::Triangulation<dim1,spacedim>.
+   * In the latter case, each process only computes the quadrature points of
+   * its locally owned immersed cells and sends them, together with the
+   * immersed degrees of freedom and, if needed, the shape function values, to
+   * the processes owning the embedding cells around them with
+   * Utilities::MPI::RemotePointEvaluation. Both finite elements then need to
+   * be primitive, and the immersed constraints are not supported, i.e.,
+   * `immersed_constraints` must not contain any constraints.
    *
    * See the tutorial program step-60 for an example on how to use this
    * function.
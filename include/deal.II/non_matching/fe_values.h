@@ -34,9 +34,11 @@
 
 #include <deal.II/non_matching/fe_immersed_values.h>
 #include <deal.II/non_matching/mesh_classifier.h>
+#include <deal.II/non_matching/quadrature_cache.h>
 #include <deal.II/non_matching/quadrature_generator.h>
 
 #include <deque>
+#include <memory>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -213,6 +215,24 @@ namespace NonMatching
              const VectorType &                level_set,
              const AdditionalData &additional_data = AdditionalData());
 
+    /**
+     * Constructor. Instead of generating the immersed quadrature rules on
+     * each intersected cell passed to reinit(), take them from
+     * @p quadrature_cache, which needs to be updated by the user whenever
+     * the level set function changes. The remaining arguments are the same
+     * as for the constructor above.
+     *
+     * @note Pointers to @p mapping_collection, @p fe_collection,
+     * @p mesh_classifier, and @p quadrature_cache are stored internally, so
+     * these need to have a longer life span than the instance of this class.
+     */
+    FEValues(const hp::MappingCollection<dim> &mapping_collection,
+             const hp::FECollection<dim> &     fe_collection,
+             const hp::QCollection<dim> &      q_collection,
+             const RegionUpdateFlags           region_update_flags,
+             const MeshClassifier<dim> &       mesh_classifier,
+             const QuadratureCache<dim> &      quadrature_cache);
+
     /**
      * Reinitialize the various FEValues-like objects for the 3 different
      * regions of the cell. After calling this function an FEValues-like object
@@ -364,9 +384,15 @@ namespace NonMatching
       fe_values_surface;
 
     /**
-     * Object that generates the immersed quadrature rules.
+     * Object that generates the immersed quadrature rules, unless they are
+     * taken from #quadrature_cache.
+     */
+    std::unique_ptr<DiscreteQuadratureGenerator<dim>> quadrature_generator;
+
+    /**
+     * Pointer to the QuadratureCache passed to the constructor, if any.
      */
-    DiscreteQuadratureGenerator<dim> quadrature_generator;
+    const SmartPointer<const QuadratureCache<dim>> quadrature_cache;
   };
 
 
@@ -22,6 +22,8 @@
 
 #include <deal.II/base/aligned_vector.h>
 #include <deal.II/base/exceptions.h>
+#include <deal.II/base/parallel.h>
+#include <deal.II/base/quadrature.h>
 #include <deal.II/base/vectorization.h>
 
 #include <deal.II/fe/fe_dgq.h>
@@ -39,6 +41,16 @@ namespace NonMatching
   /**
    * This class provides the mapping information computation and mapping data
    * storage to be used together with FEPointEvaluation.
+   *
+   * The mapping information can either be computed for one cell at a time
+   * with reinit(), or be precomputed for many cells with reinit_cells(), for
+   * example for all intersected cells of a mesh with their immersed
+   * quadrature rules. In the latter case, FEPointEvaluation selects the data
+   * of one of these cells by its index, see FEPointEvaluation::reinit(const
+   * unsigned int), which avoids computing the mapping information anew every
+   * time an operator is applied. Since the stored data is not changed by the
+   * selection, several FEPointEvaluation objects can work on the same
+   * MappingInfo object concurrently.
    */
   template <int dim, int spacedim = dim>
   class MappingInfo : public Subscriptor
@@ -52,6 +64,8 @@ namespace NonMatching
      * @param update_flags Specify the quantities to be computed by the mapping
      * during the call of reinit(). These update flags are also handed to a
      * FEEvaluation object if you construct it with this MappingInfo object.
+     * The flag update_JxW_values is only supported by reinit_cells(), which
+     * receives quadrature weights.
      */
     MappingInfo(const Mapping<dim> &mapping, const UpdateFlags update_flags);
 
@@ -64,19 +78,55 @@ namespace NonMatching
            const ArrayView<const Point<dim>> &unit_points);
 
     /**
-     * Getter function for current unit points.
+     * Compute and store the mapping information for all cells in @p cells,
+     * evaluated at the points of the respective element of @p quadratures.
+     * The cells are processed in parallel. If the update flags passed to the
+     * constructor contain update_JxW_values, the quadrature weights
+     * multiplied by the volume element of the mapping are also computed.
+     *
+     * Afterwards, the data of the cell with index `i` in @p cells is
+     * returned by the getter functions of this class called with the argument
+     * `cell_index = i`.
+     */
+    void
+    reinit_cells(
+      const std::vector<typename Triangulation<dim, spacedim>::cell_iterator>
+        &                                 cells,
+      const std::vector<Quadrature<dim>> &quadratures);
+
+    /**
+     * Return the number of cells whose data is stored, i.e., the number of
+     * cells passed to the last call of reinit_cells(), or one after a call
+     * to reinit() for a single cell.
+     */
+    unsigned int
+    n_cells() const;
+
+    /**
+     * Getter function for current unit points. After reinit_cells(), return
+     * the unit points of the cell with index @p cell_index.
      */
     const std::vector<Point<dim>> &
-    get_unit_points() const;
+    get_unit_points(const unsigned int cell_index = 0) const;
+
+    /**
+     * Getter function for the quadrature weights multiplied by the volume
+     * element of the mapping at the unit points of the cell with index
+     * @p cell_index. Only available after reinit_cells() if the update flags
+     * passed to the constructor contain update_JxW_values.
+     */
+    const std::vector<double> &
+    get_JxW_values(const unsigned int cell_index = 0) const;
 
     /**
-     * Getter function for computed mapping data. This function accesses
+     * Getter function for computed mapping data. After reinit_cells(), return
+     * the data of the cell with index @p cell_index. This function accesses
      * internal data and is therefore not a stable interface.
      */
     const dealii::internal::FEValuesImplementation::MappingRelatedData<dim,
                                                                        spacedim>
       &
-      get_mapping_data() const;
+      get_mapping_data(const unsigned int cell_index = 0) const;
 
     /**
      * Getter function for underlying mapping.
@@ -99,12 +149,21 @@ namespace NonMatching
     void
     compute_mapping_data_for_generic_points(
       const typename Triangulation<dim, spacedim>::cell_iterator &cell,
-      const ArrayView<const Point<dim>> &                         unit_points);
+      const ArrayView<const Point<dim>> &                         unit_points,
+      dealii::internal::FEValuesImplementation::MappingRelatedData<dim,
+                                                                   spacedim>
+        &mapping_data) const;
+
+    /**
+     * The reference points specified at reinit() or reinit_cells(), for each
+     * cell.
+     */
+    std::vector<std::vector<Point<dim>>> unit_points;
 
     /**
-     * The reference points specified at reinit().
+     * The JxW values computed by reinit_cells(), for each cell.
      */
-    std::vector<Point<dim>> unit_points;
+    std::vector<std::vector<double>> JxW_values;
 
     /**
      * A pointer to the underlying mapping.
@@ -122,10 +181,12 @@ namespace NonMatching
     UpdateFlags update_flags_mapping;
 
     /**
-     * The internal data container for mapping information. The implementation
-     * is subject to future changes.
+     * The internal data container for mapping information, for each cell. The
+     * implementation is subject to future changes.
      */
-    dealii::internal::FEValuesImplementation::MappingRelatedData<dim, spacedim>
+    std::vector<
+      dealii::internal::FEValuesImplementation::MappingRelatedData<dim,
+                                                                   spacedim>>
       mapping_data;
   };
 
@@ -140,7 +201,7 @@ namespace NonMatching
   {
     update_flags_mapping = update_default;
     // translate update flags
-    if (update_flags & update_jacobians)
+    if (update_flags & update_jacobians || update_flags & update_JxW_values)
       update_flags_mapping |= update_jacobians;
     if (update_flags & update_gradients ||
         update_flags & update_inverse_jacobians)
@@ -158,18 +219,85 @@ namespace NonMatching
     const typename Triangulation<dim, spacedim>::cell_iterator &cell,
     const ArrayView<const Point<dim>> &                         unit_points)
   {
-    this->unit_points =
+    this->unit_points.resize(1);
+    this->unit_points[0] =
       std::vector<Point<dim>>(unit_points.begin(), unit_points.end());
-    compute_mapping_data_for_generic_points(cell, unit_points);
+    JxW_values.clear();
+    mapping_data.resize(1);
+    compute_mapping_data_for_generic_points(cell,
+                                            unit_points,
+                                            mapping_data[0]);
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  MappingInfo<dim, spacedim>::reinit_cells(
+    const std::vector<typename Triangulation<dim, spacedim>::cell_iterator>
+      &                                 cells,
+    const std::vector<Quadrature<dim>> &quadratures)
+  {
+    AssertDimension(cells.size(), quadratures.size());
+
+    const bool compute_JxW = update_flags & update_JxW_values;
+    unit_points.resize(cells.size());
+    mapping_data.resize(cells.size());
+    JxW_values.resize(compute_JxW ? cells.size() : 0);
+
+    parallel::apply_to_subranges(
+      0U,
+      static_cast<unsigned int>(cells.size()),
+      [&](const unsigned int begin, const unsigned int end) {
+        for (unsigned int c = begin; c < end; ++c)
+          {
+            unit_points[c] = quadratures[c].get_points();
+            compute_mapping_data_for_generic_points(
+              cells[c], make_array_view(unit_points[c]), mapping_data[c]);
+            if (compute_JxW)
+              {
+                JxW_values[c].resize(quadratures[c].size());
+                for (unsigned int q = 0; q < quadratures[c].size(); ++q)
+                  JxW_values[c][q] =
+                    quadratures[c].weight(q) *
+                    std::abs(mapping_data[c].jacobians[q].determinant());
+              }
+          }
+      },
+      8);
+  }
+
+
+
+  template <int dim, int spacedim>
+  unsigned int
+  MappingInfo<dim, spacedim>::n_cells() const
+  {
+    return mapping_data.size();
   }
 
 
 
   template <int dim, int spacedim>
   const std::vector<Point<dim>> &
-  MappingInfo<dim, spacedim>::get_unit_points() const
+  MappingInfo<dim, spacedim>::get_unit_points(
+    const unsigned int cell_index) const
   {
-    return unit_points;
+    AssertIndexRange(cell_index, unit_points.size());
+    return unit_points[cell_index];
+  }
+
+
+
+  template <int dim, int spacedim>
+  const std::vector<double> &
+  MappingInfo<dim, spacedim>::get_JxW_values(
+    const unsigned int cell_index) const
+  {
+    Assert(cell_index < JxW_values.size(),
+           ExcMessage("The JxW values are only computed by reinit_cells() "
+                      "with update_JxW_values."));
+    return JxW_values[cell_index];
   }
 
 
@@ -177,9 +305,11 @@ namespace NonMatching
   template <int dim, int spacedim>
   const dealii::internal::FEValuesImplementation::MappingRelatedData<dim,
                                                                      spacedim> &
-  MappingInfo<dim, spacedim>::get_mapping_data() const
+  MappingInfo<dim, spacedim>::get_mapping_data(
+    const unsigned int cell_index) const
   {
-    return mapping_data;
+    AssertIndexRange(cell_index, mapping_data.size());
+    return mapping_data[cell_index];
   }
 
 
@@ -206,7 +336,9 @@ namespace NonMatching
   void
   MappingInfo<dim, spacedim>::compute_mapping_data_for_generic_points(
     const typename Triangulation<dim, spacedim>::cell_iterator &cell,
-    const ArrayView<const Point<dim>> &                         unit_points)
+    const ArrayView<const Point<dim>> &                         unit_points,
+    dealii::internal::FEValuesImplementation::MappingRelatedData<dim, spacedim>
+      &mapping_data) const
   {
     if (const MappingQ<dim, spacedim> *mapping_q =
           dynamic_cast<const MappingQ<dim, spacedim> *>(&(*mapping)))
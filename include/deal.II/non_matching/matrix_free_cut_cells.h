@@ -0,0 +1,453 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+#ifndef dealii_non_matching_matrix_free_cut_cells_h
+#define dealii_non_matching_matrix_free_cut_cells_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/smartpointer.h>
+#include <deal.II/base/subscriptor.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/matrix_free/evaluation_flags.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include <deal.II/non_matching/mapping_info.h>
+#include <deal.II/non_matching/mesh_classifier.h>
+#include <deal.II/non_matching/quadrature_cache.h>
+
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace NonMatching
+{
+  /**
+   * A class that integrates cut cells into matrix-free operator evaluation
+   * with MatrixFree::cell_loop(). On a cell batch, the cells that lie
+   * completely in the region of integration are handled by FEEvaluation
+   * with the usual tensor-product quadrature, whereas the cells intersected
+   * by the zero contour of the level set function are handled one after the
+   * other by FEPointEvaluation, using the immersed quadrature rules stored
+   * in a QuadratureCache. FEPointEvaluation in turn evaluates and integrates
+   * on the points of such a quadrature rule in batches of the SIMD width.
+   * Cells outside the region of integration do not contribute.
+   *
+   * Since the mapping information of the cut cells does not change between
+   * operator applications, reinit() precomputes it for all locally owned cut
+   * cells with NonMatching::MappingInfo::reinit_cells(), in parallel over the
+   * cells. The FEPointEvaluation objects passed to evaluate_and_integrate()
+   * need to be constructed with the MappingInfo object returned by
+   * get_mapping_info(). As the FEPointEvaluation objects, and not the
+   * MappingInfo object, keep track of the current cell, the cell operations
+   * may run on several threads concurrently, with one FEEvaluation and one
+   * FEPointEvaluation object per thread, like the cell operations of
+   * MatrixFree::cell_loop() with FEEvaluation alone.
+   *
+   * An operator for a Laplace-type problem on the inside region may be
+   * implemented as follows:
+   * @code
+   *   NonMatching::MatrixFreeCutCells<dim> cut_cells(
+   *     mapping, update_gradients | update_JxW_values);
+   *   cut_cells.reinit(matrix_free, mesh_classifier, quadrature_cache);
+   *
+   *   matrix_free.template cell_loop<VectorType, VectorType>(
+   *     [&](const MatrixFree<dim> &                      matrix_free,
+   *         VectorType &                                 dst,
+   *         const VectorType &                           src,
+   *         const std::pair<unsigned int, unsigned int> &range) {
+   *       FEEvaluation<dim, -1>     phi(matrix_free);
+   *       FEPointEvaluation<1, dim> phi_point(cut_cells.get_mapping_info(),
+   *                                           fe);
+   *       for (unsigned int cell = range.first; cell < range.second; ++cell)
+   *         if (cut_cells.has_cells_in_region(cell))
+   *           {
+   *             phi.reinit(cell);
+   *             phi.read_dof_values(src);
+   *             cut_cells.evaluate_and_integrate(
+   *               phi,
+   *               phi_point,
+   *               EvaluationFlags::gradients,
+   *               EvaluationFlags::gradients,
+   *               [](auto &phi) {
+   *                 for (unsigned int q = 0; q < phi.n_q_points; ++q)
+   *                   phi.submit_gradient(phi.get_gradient(q), q);
+   *               },
+   *               [](auto &phi_point, const unsigned int n_points) {
+   *                 for (unsigned int q = 0; q < n_points; ++q)
+   *                   phi_point.submit_gradient(phi_point.get_gradient(q) *
+   *                                               phi_point.JxW(q),
+   *                                             q);
+   *               });
+   *             phi.distribute_local_to_global(dst);
+   *           }
+   *     },
+   *     dst,
+   *     src,
+   *     true);
+   * @endcode
+   *
+   * The class supports finite elements made of a single base element with
+   * tensor product structure, e.g., FE_Q or FESystem(FE_Q(degree), dim), for
+   * which FEPointEvaluation uses its fast evaluation path.
+   *
+   * @note The partitioning of the cells among threads in MatrixFree counts
+   * all cell batches as equally expensive. Since a cut cell is significantly
+   * more expensive than a cell batch of intact cells, cut cells should be
+   * spread over the mesh rather than be grouped in a few partitions for good
+   * load balance, which is the case for the usual interfaces that cross the
+   * mesh.
+   */
+  template <int dim,
+            typename Number              = double,
+            typename VectorizedArrayType = VectorizedArray<Number>>
+  class MatrixFreeCutCells : public Subscriptor
+  {
+  public:
+    /**
+     * Constructor. The @p mapping and @p update_flags are used to compute the
+     * mapping information of the cut cells, see NonMatching::MappingInfo.
+     * The flags need to contain update_JxW_values for FEPointEvaluation::JxW()
+     * to be available.
+     */
+    MatrixFreeCutCells(const Mapping<dim> &mapping,
+                       const UpdateFlags   update_flags);
+
+    /**
+     * Classify the cells of all locally owned cell batches of @p matrix_free
+     * with @p mesh_classifier and compute the mapping information on all cut
+     * cells for the quadrature rules of @p quadrature_cache for the given
+     * @p region, which must be either LocationToLevelSet::inside or
+     * LocationToLevelSet::outside. The cells are taken from the DoFHandler
+     * with index @p dof_no in @p matrix_free.
+     *
+     * This function needs to be called again whenever the level set function
+     * or the MatrixFree object changes.
+     */
+    void
+    reinit(const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+           const MeshClassifier<dim> &                         mesh_classifier,
+           const QuadratureCache<dim> &quadrature_cache,
+           const LocationToLevelSet    region = LocationToLevelSet::inside,
+           const unsigned int          dof_no = 0);
+
+    /**
+     * Return whether any cell of the given @p cell_batch lies in the region
+     * of integration or is cut, i.e., whether the cell batch contributes to
+     * the integral.
+     */
+    bool
+    has_cells_in_region(const unsigned int cell_batch) const;
+
+    /**
+     * Return whether any cell of the given @p cell_batch is cut.
+     */
+    bool
+    has_cut_cells(const unsigned int cell_batch) const;
+
+    /**
+     * Return the number of locally owned cut cells.
+     */
+    unsigned int
+    n_cut_cells() const;
+
+    /**
+     * Return the mapping information of the cut cells, with which the
+     * FEPointEvaluation objects passed to evaluate_and_integrate() must be
+     * constructed.
+     */
+    MappingInfo<dim> &
+    get_mapping_info();
+
+    /**
+     * Evaluate the finite element function given by the degrees of freedom
+     * in @p phi according to @p evaluation_flags, apply the operation at the
+     * quadrature points, and integrate the result according to
+     * @p integration_flags back into the degrees of freedom in @p phi. The
+     * object @p phi must have been reinitialized for a cell batch and contain
+     * the degrees of freedom of the cells, e.g., by a call to
+     * FEEvaluation::read_dof_values(). Afterwards, the result can be written
+     * into a global vector by FEEvaluation::distribute_local_to_global().
+     *
+     * If the cell batch contains cells in the region of integration that are
+     * not cut, @p cell_operation is called with @p phi after
+     * FEEvaluation::evaluate(). It is called for all cells of the batch, and
+     * the contributions of the cells that are cut or outside of the region
+     * are discarded afterwards. For every cut cell, @p point_operation is
+     * called with @p phi_point after FEPointEvaluation::evaluate() on the
+     * points of the immersed quadrature rule of the cell, and with the number
+     * of these points. Unlike FEEvaluation, FEPointEvaluation does not
+     * include the quadrature weight in the submitted values and gradients,
+     * so @p point_operation needs to multiply them by FEPointEvaluation::JxW().
+     */
+    template <typename FEEvaluationType,
+              typename FEPointEvaluationType,
+              typename CellOperation,
+              typename PointOperation>
+    void
+    evaluate_and_integrate(
+      FEEvaluationType &                     phi,
+      FEPointEvaluationType &                phi_point,
+      const EvaluationFlags::EvaluationFlags evaluation_flags,
+      const EvaluationFlags::EvaluationFlags integration_flags,
+      const CellOperation &                  cell_operation,
+      const PointOperation &                 point_operation) const;
+
+  private:
+    /**
+     * The mapping information of the cut cells.
+     */
+    MappingInfo<dim> mapping_info;
+
+    /**
+     * The index of each lane of each cell batch in the cells of
+     * #mapping_info if the cell is cut, or one of the values
+     * #intact_cell or #outside_cell otherwise.
+     */
+    std::vector<unsigned int> lane_data;
+
+    /**
+     * The value of #lane_data for a cell that is completely in the region of
+     * integration.
+     */
+    static constexpr unsigned int intact_cell = numbers::invalid_unsigned_int;
+
+    /**
+     * The value of #lane_data for a cell that is completely outside of the
+     * region of integration, or for an unused lane of a cell batch.
+     */
+    static constexpr unsigned int outside_cell =
+      numbers::invalid_unsigned_int - 1;
+
+    /**
+     * The number of degrees of freedom per cell of the finite element.
+     */
+    unsigned int n_dofs_per_cell;
+  };
+
+
+
+  // ----------------------- template functions ----------------------
+
+
+  template <int dim, typename Number, typename VectorizedArrayType>
+  MatrixFreeCutCells<dim, Number, VectorizedArrayType>::MatrixFreeCutCells(
+    const Mapping<dim> &mapping,
+    const UpdateFlags   update_flags)
+    : mapping_info(mapping, update_flags)
+    , n_dofs_per_cell(0)
+  {}
+
+
+
+  template <int dim, typename Number, typename VectorizedArrayType>
+  void
+  MatrixFreeCutCells<dim, Number, VectorizedArrayType>::reinit(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    const MeshClassifier<dim> &                         mesh_classifier,
+    const QuadratureCache<dim> &                        quadrature_cache,
+    const LocationToLevelSet                            region,
+    const unsigned int                                  dof_no)
+  {
+    Assert(region == LocationToLevelSet::inside ||
+             region == LocationToLevelSet::outside,
+           ExcMessage("The region of integration must be either the inside "
+                      "or the outside region."));
+
+    const FiniteElement<dim> &fe =
+      matrix_free.get_dof_handler(dof_no).get_fe();
+    Assert(fe.n_base_elements() == 1,
+           ExcMessage("Only finite elements with a single base element are "
+                      "supported."));
+    n_dofs_per_cell = fe.n_dofs_per_cell();
+
+    const unsigned int n_lanes = VectorizedArrayType::size();
+    lane_data.clear();
+    lane_data.resize(matrix_free.n_cell_batches() * n_lanes, outside_cell);
+
+    std::vector<typename Triangulation<dim>::cell_iterator> cut_cells;
+    std::vector<Quadrature<dim>>                            quadratures;
+    for (unsigned int batch = 0; batch < matrix_free.n_cell_batches(); ++batch)
+      for (unsigned int v = 0;
+           v < matrix_free.n_active_entries_per_cell_batch(batch);
+           ++v)
+        {
+          const auto cell = matrix_free.get_cell_iterator(batch, v, dof_no);
+          const LocationToLevelSet location =
+            mesh_classifier.location_to_level_set(cell);
+          if (location == region)
+            lane_data[batch * n_lanes + v] = intact_cell;
+          else if (location == LocationToLevelSet::intersected)
+            {
+              lane_data[batch * n_lanes + v] = cut_cells.size();
+              cut_cells.push_back(cell);
+              quadratures.push_back(
+                region == LocationToLevelSet::inside ?
+                  quadrature_cache.get_inside_quadrature(cell) :
+                  quadrature_cache.get_outside_quadrature(cell));
+            }
+        }
+
+    mapping_info.reinit_cells(cut_cells, quadratures);
+  }
+
+
+
+  template <int dim, typename Number, typename VectorizedArrayType>
+  bool
+  MatrixFreeCutCells<dim, Number, VectorizedArrayType>::has_cells_in_region(
+    const unsigned int cell_batch) const
+  {
+    const unsigned int n_lanes = VectorizedArrayType::size();
+    AssertIndexRange(cell_batch * n_lanes, lane_data.size());
+    for (unsigned int v = 0; v < n_lanes; ++v)
+      if (lane_data[cell_batch * n_lanes + v] != outside_cell)
+        return true;
+    return false;
+  }
+
+
+
+  template <int dim, typename Number, typename VectorizedArrayType>
+  bool
+  MatrixFreeCutCells<dim, Number, VectorizedArrayType>::has_cut_cells(
+    const unsigned int cell_batch) const
+  {
+    const unsigned int n_lanes = VectorizedArrayType::size();
+    AssertIndexRange(cell_batch * n_lanes, lane_data.size());
+    for (unsigned int v = 0; v < n_lanes; ++v)
+      if (lane_data[cell_batch * n_lanes + v] < outside_cell)
+        return true;
+    return false;
+  }
+
+
+
+  template <int dim, typename Number, typename VectorizedArrayType>
+  unsigned int
+  MatrixFreeCutCells<dim, Number, VectorizedArrayType>::n_cut_cells() const
+  {
+    return mapping_info.n_cells();
+  }
+
+
+
+  template <int dim, typename Number, typename VectorizedArrayType>
+  MappingInfo<dim> &
+  MatrixFreeCutCells<dim, Number, VectorizedArrayType>::get_mapping_info()
+  {
+    return mapping_info;
+  }
+
+
+
+  template <int dim, typename Number, typename VectorizedArrayType>
+  template <typename FEEvaluationType,
+            typename FEPointEvaluationType,
+            typename CellOperation,
+            typename PointOperation>
+  void
+  MatrixFreeCutCells<dim, Number, VectorizedArrayType>::evaluate_and_integrate(
+    FEEvaluationType &                     phi,
+    FEPointEvaluationType &                phi_point,
+    const EvaluationFlags::EvaluationFlags evaluation_flags,
+    const EvaluationFlags::EvaluationFlags integration_flags,
+    const CellOperation &                  cell_operation,
+    const PointOperation &                 point_operation) const
+  {
+    constexpr unsigned int n_lanes      = VectorizedArrayType::size();
+    constexpr unsigned int n_components = FEEvaluationType::n_components;
+    const unsigned int     cell_batch   = phi.get_current_cell_index();
+    AssertIndexRange(cell_batch * n_lanes, lane_data.size());
+
+    const unsigned int dofs_per_component = phi.dofs_per_component;
+    const unsigned int component_offset =
+      phi.get_first_selected_component() * dofs_per_component;
+    const std::vector<unsigned int> &lexicographic_numbering =
+      phi.get_shape_info().lexicographic_numbering;
+    VectorizedArrayType *dof_values = phi.begin_dof_values();
+
+    // Evaluate and integrate on the cut cells first, before the degrees of
+    // freedom in phi are overwritten by the integration on the intact cells.
+    // The degrees of freedom of FEEvaluation are sorted lexicographically
+    // per component, whereas FEPointEvaluation uses the numbering of the
+    // finite element.
+    unsigned int n_cut_cells_in_batch = 0;
+    bool         has_intact_cells     = false;
+    for (unsigned int v = 0; v < n_lanes; ++v)
+      if (lane_data[cell_batch * n_lanes + v] == intact_cell)
+        has_intact_cells = true;
+      else if (lane_data[cell_batch * n_lanes + v] != outside_cell)
+        ++n_cut_cells_in_batch;
+
+    std::vector<Number> cut_cell_dof_values(n_cut_cells_in_batch *
+                                            n_dofs_per_cell);
+    for (unsigned int v = 0, c = 0; v < n_lanes; ++v)
+      {
+        const unsigned int cut_cell_index = lane_data[cell_batch * n_lanes + v];
+        if (cut_cell_index >= outside_cell)
+          continue;
+
+        const ArrayView<Number> cell_dof_values(cut_cell_dof_values.data() +
+                                                  c * n_dofs_per_cell,
+                                                n_dofs_per_cell);
+        for (unsigned int i = 0; i < n_components * dofs_per_component; ++i)
+          cell_dof_values[lexicographic_numbering[component_offset + i]] =
+            dof_values[i][v];
+
+        phi_point.reinit(cut_cell_index);
+        phi_point.evaluate(cell_dof_values, evaluation_flags);
+        point_operation(
+          phi_point,
+          static_cast<unsigned int>(
+            mapping_info.get_unit_points(cut_cell_index).size()));
+        phi_point.integrate(cell_dof_values, integration_flags);
+        ++c;
+      }
+
+    if (has_intact_cells)
+      {
+        phi.evaluate(evaluation_flags);
+        cell_operation(phi);
+        phi.integrate(integration_flags);
+      }
+
+    for (unsigned int v = 0, c = 0; v < n_lanes; ++v)
+      {
+        const unsigned int index = lane_data[cell_batch * n_lanes + v];
+        if (index == intact_cell)
+          continue;
+        else if (index == outside_cell)
+          for (unsigned int i = 0; i < n_components * dofs_per_component; ++i)
+            dof_values[i][v] = Number();
+        else
+          {
+            for (unsigned int i = 0; i < n_components * dofs_per_component;
+                 ++i)
+              dof_values[i][v] =
+                cut_cell_dof_values[c * n_dofs_per_cell +
+                                    lexicographic_numbering[component_offset +
+                                                            i]];
+            ++c;
+          }
+      }
+  }
+} // namespace NonMatching
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -25,6 +25,7 @@
 
 #include <deal.II/lac/lapack_full_matrix.h>
 
+#include <memory>
 #include <vector>
 
 DEAL_II_NAMESPACE_OPEN
@@ -104,6 +105,23 @@ namespace NonMatching
    * When the level set function is described as a Function, the level set
    * function is locally interpolated to an FE_Q element and we proceed in the
    * same way as for the discrete level set function.
+   *
+   * The faces are classified in parallel, using the threads available to
+   * the library. When the level set function moves only slightly, e.g., in
+   * a time step of a moving interface, only the cells close to the previous
+   * position of the zero contour can change their location. In this case, the
+   * classification can be updated on these cells only, which are found with
+   * get_cells_near_interface():
+   *
+   * @code
+   * classifier.reclassify();
+   * for (unsigned int step = 0; step < n_steps; ++step)
+   *   {
+   *     const auto band = classifier.get_cells_near_interface(2);
+   *     // move the level set function by less than one cell
+   *     classifier.reclassify(band);
+   *   }
+   * @endcode
    */
   template <int dim>
   class MeshClassifier : public Subscriptor
@@ -136,6 +154,32 @@ namespace NonMatching
     void
     reclassify();
 
+    /**
+     * Update the classification of the cells in @p cells_to_check and of
+     * their faces, and leave the classification of all other cells and faces
+     * unchanged. This function can be used in place of reclassify() if the
+     * level set function has only changed in such a way that the location of
+     * the other cells has stayed the same, for example for the cells returned
+     * by get_cells_near_interface() before a small change of the level set
+     * function. The cells must not be artificial, and reclassify() must have
+     * been called before on the current triangulation.
+     */
+    void
+    reclassify(
+      const std::vector<typename Triangulation<dim>::active_cell_iterator>
+        &cells_to_check);
+
+    /**
+     * Return the non artificial cells that are intersected by the zero
+     * contour of the level set function, together with the cells that can be
+     * reached from those by crossing at most @p n_layers faces, i.e., a
+     * narrow band of cells around the zero contour. The cells of the band
+     * are ordered by their distance to the intersected cells in this
+     * face-neighbor graph.
+     */
+    std::vector<typename Triangulation<dim>::active_cell_iterator>
+    get_cells_near_interface(const unsigned int n_layers = 1) const;
+
     /**
      * Return how the incoming cell is located relative to the level set
      * function.
@@ -161,14 +205,27 @@ namespace NonMatching
     void
     initialize();
 
+    /**
+     * Determine the location of the cells in @p cells and of their faces, in
+     * parallel over the faces and the cells.
+     */
+    void
+    classify_cells(
+      const std::vector<typename Triangulation<dim>::active_cell_iterator>
+        &cells);
+
     /**
      * Computes how the face with the given index on the incoming cell is
-     * located relative to the level set function.
+     * located relative to the level set function described by
+     * @p level_set, using @p local_levelset_values as scratch space.
      */
     LocationToLevelSet
     determine_face_location_to_levelset(
       const typename Triangulation<dim>::active_cell_iterator &cell,
-      const unsigned int                                       face_index);
+      const unsigned int                                       face_index,
+      internal::MeshClassifierImplementation::LevelSetDescription<dim>
+        &             level_set,
+      Vector<double> &local_levelset_values) const;
 
     /**
      * Pointer to the triangulation that should be classified.
@@ -228,6 +285,13 @@ namespace NonMatching
          */
         virtual ~LevelSetDescription() = default;
 
+        /**
+         * Return a copy of this object, which can be used concurrently with
+         * this object.
+         */
+        virtual std::unique_ptr<LevelSetDescription<dim>>
+        clone() const = 0;
+
         /**
          * Return a collection to all the elements that are used to locally
          * describe the level set function.
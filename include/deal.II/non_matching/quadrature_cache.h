@@ -0,0 +1,239 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+#ifndef dealii_non_matching_quadrature_cache_h
+#define dealii_non_matching_quadrature_cache_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/quadrature.h>
+#include <deal.II/base/smartpointer.h>
+#include <deal.II/base/subscriptor.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/hp/q_collection.h>
+
+#include <deal.II/non_matching/immersed_surface_quadrature.h>
+#include <deal.II/non_matching/mesh_classifier.h>
+#include <deal.II/non_matching/quadrature_generator.h>
+
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace NonMatching
+{
+  /**
+   * A class that stores the immersed quadrature rules generated by
+   * DiscreteQuadratureGenerator on all intersected cells of a mesh, and
+   * which updates them only on the cells where they can have changed.
+   *
+   * Generating immersed quadrature rules is expensive, and the
+   * NonMatching::FEValues class generates them anew whenever reinit() is
+   * called on an intersected cell. If the level set function changes only
+   * slowly, e.g., for an interface moving in a time-dependent problem, most of
+   * the quadrature rules stay the same from one time step to the next. The
+   * update() function of this class compares, for each cell that the
+   * MeshClassifier passed to the constructor classifies as intersected, the
+   * degrees of freedom of the level set function on the cell with those used
+   * for the quadrature rules stored for the cell, and only generates the
+   * quadrature rules anew if they differ or if the cell was not intersected
+   * before. The quadrature rules are generated in parallel over the cells,
+   * with one DiscreteQuadratureGenerator per task.
+   *
+   * The stored quadrature rules can be accessed with get_inside_quadrature(),
+   * get_outside_quadrature(), and get_surface_quadrature(), or used by
+   * NonMatching::FEValues by passing this object to its constructor:
+   * @code
+   *   NonMatching::QuadratureCache<dim> quadrature_cache(quadrature_1D,
+   *                                                      mesh_classifier);
+   *   NonMatching::FEValues<dim> non_matching_fe_values(mapping_collection,
+   *                                                     fe_collection,
+   *                                                     q_collection,
+   *                                                     region_update_flags,
+   *                                                     mesh_classifier,
+   *                                                     quadrature_cache);
+   *   for (unsigned int step = 0; step < n_steps; ++step)
+   *     {
+   *       // compute the new level set function
+   *       mesh_classifier.reclassify();
+   *       quadrature_cache.update(level_set_dof_handler, level_set);
+   *       assemble_system(non_matching_fe_values);
+   *     }
+   * @endcode
+   *
+   * The quadrature rules of a cell are generated with the 1d quadrature
+   * rule of the hp::QCollection passed to the constructor with the index
+   * given by the active FE index of the cell in the DoFHandler of the level
+   * set function, or with the only quadrature rule if the collection has a
+   * single element.
+   *
+   * The cache refers to the active cells of the triangulation by their
+   * active cell index. After the triangulation has changed, clear() needs to
+   * be called before calling update() again.
+   */
+  template <int dim>
+  class QuadratureCache : public Subscriptor
+  {
+  public:
+    using AdditionalData = AdditionalQGeneratorData;
+
+    /**
+     * Constructor. The quadrature rules are generated from the
+     * @p quadratures1D and @p additional_data as described for the
+     * QuadratureGenerator class. A pointer to the @p mesh_classifier is stored
+     * internally, so it must live longer than this object.
+     */
+    QuadratureCache(const hp::QCollection<1> & quadratures1D,
+                    const MeshClassifier<dim> &mesh_classifier,
+                    const AdditionalData &additional_data = AdditionalData());
+
+    /**
+     * Update the quadrature rules on all active cells that are not
+     * artificial for the discrete level set function described by
+     * @p dof_handler and @p level_set, as explained in the documentation of
+     * this class. The MeshClassifier passed to the constructor needs to be
+     * up to date with @p level_set, i.e., MeshClassifier::reclassify() must
+     * have been called after the last change of @p level_set.
+     *
+     * Since the cells are processed in parallel, @p level_set must support
+     * concurrent read access, as is the case for the vector classes of
+     * deal.II.
+     *
+     * Return the number of cells on which the quadrature rules have been
+     * generated.
+     */
+    template <class VectorType>
+    unsigned int
+    update(const DoFHandler<dim> &dof_handler, const VectorType &level_set);
+
+    /**
+     * Delete all stored quadrature rules.
+     */
+    void
+    clear();
+
+    /**
+     * Return the quadrature rule for the inside region of the intersected
+     * cell @p cell, see QuadratureGenerator::get_inside_quadrature().
+     */
+    const Quadrature<dim> &
+    get_inside_quadrature(
+      const typename Triangulation<dim>::cell_iterator &cell) const;
+
+    /**
+     * Return the quadrature rule for the outside region of the intersected
+     * cell @p cell, see QuadratureGenerator::get_outside_quadrature().
+     */
+    const Quadrature<dim> &
+    get_outside_quadrature(
+      const typename Triangulation<dim>::cell_iterator &cell) const;
+
+    /**
+     * Return the quadrature rule for the surface region of the intersected
+     * cell @p cell, see QuadratureGenerator::get_surface_quadrature().
+     */
+    const ImmersedSurfaceQuadrature<dim> &
+    get_surface_quadrature(
+      const typename Triangulation<dim>::cell_iterator &cell) const;
+
+    /**
+     * Return the 1d quadrature rules passed to the constructor.
+     */
+    const hp::QCollection<1> &
+    get_quadratures_1D() const;
+
+    /**
+     * Return an estimate for the memory consumption, in bytes, of this
+     * object.
+     */
+    std::size_t
+    memory_consumption() const;
+
+  private:
+    /**
+     * The data stored for each active cell.
+     */
+    struct CellData
+    {
+      /**
+       * Whether the cell was intersected in the last call to update(). If
+       * not, all other members are empty.
+       */
+      bool is_intersected = false;
+
+      /**
+       * The index of the 1d quadrature used to generate the quadrature
+       * rules.
+       */
+      unsigned int q_index = numbers::invalid_unsigned_int;
+
+      /**
+       * The values of the degrees of freedom of the level set function on
+       * the cell that the quadrature rules have been generated for.
+       */
+      std::vector<double> level_set_values;
+
+      /**
+       * The quadrature rule for the inside region.
+       */
+      Quadrature<dim> inside_quadrature;
+
+      /**
+       * The quadrature rule for the outside region.
+       */
+      Quadrature<dim> outside_quadrature;
+
+      /**
+       * The quadrature rule for the surface region.
+       */
+      ImmersedSurfaceQuadrature<dim> surface_quadrature;
+    };
+
+    /**
+     * Return the data of the intersected cell @p cell.
+     */
+    const CellData &
+    get_cell_data(const typename Triangulation<dim>::cell_iterator &cell) const;
+
+    /**
+     * The 1d quadrature rules passed to the constructor.
+     */
+    const hp::QCollection<1> quadratures1D;
+
+    /**
+     * Pointer to the MeshClassifier passed to the constructor.
+     */
+    const SmartPointer<const MeshClassifier<dim>> mesh_classifier;
+
+    /**
+     * The additional data passed to the constructor.
+     */
+    const AdditionalData additional_data;
+
+    /**
+     * The data of each active cell, indexed by the active cell index.
+     */
+    std::vector<CellData> cell_data;
+  };
+
+} // namespace NonMatching
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
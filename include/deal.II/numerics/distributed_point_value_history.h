@@ -0,0 +1,364 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+#ifndef dealii_distributed_point_value_history_h
+#define dealii_distributed_point_value_history_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/mpi_remote_point_evaluation.h>
+#include <deal.II/base/point.h>
+#include <deal.II/base/smartpointer.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/mapping.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+// Forward declarations
+#ifndef DOXYGEN
+template <int n_components, int dim, int spacedim, typename Number>
+class FEPointEvaluation;
+
+namespace NonMatching
+{
+  template <int dim, int spacedim>
+  class MappingInfo;
+}
+#endif
+
+/**
+ * A class that records the values of finite element fields at a fixed set of
+ * points over the course of a (typically time-dependent) simulation and
+ * writes them to files, meant for a large number of probe points in
+ * parallel computations with any kind of triangulation.
+ *
+ * Unlike PointValueHistory, which finds the support point closest to each
+ * requested location on a serial DoFHandler and keeps all data in memory,
+ * this class evaluates the finite element fields exactly at the requested
+ * points, which may lie on any process. The points are located with
+ * Utilities::MPI::RemotePointEvaluation the first time values are recorded,
+ * and again only after the triangulation has changed, and the geometry data
+ * of the cells containing points is computed once per location. Each call to
+ * record() then evaluates all fields in a single round of communication.
+ *
+ * Each process passes the points it wants to monitor to the constructor,
+ * e.g., all points on one process and none on the others, or a part of the
+ * points on each process. The recorded values are buffered and, whenever
+ * @p n_buffered_steps steps have been recorded and in flush(), appended to
+ * the file <tt>file_name_base_RRRR.bin</tt> of the process with rank
+ * <tt>RRRR</tt>, so that the memory of the class does not grow with the
+ * number of steps. Processes without points do not write files. The binary
+ * file contains, for each recorded step, the time followed by the values of
+ * all fields at all points of the process, stored as <tt>double</tt> in the
+ * native byte order of the machine. The meaning of these numbers is described
+ * in the text file <tt>file_name_base_RRRR.txt</tt>, which lists the number
+ * of points and values, the names of the values, and the coordinates of the
+ * points, and is written together with the first data. Points that are not
+ * found in the domain get the value NaN.
+ *
+ * The following code snippet shows a typical use:
+ * @code
+ *   DistributedPointValueHistory<dim> probes(mapping,
+ *                                            probe_locations,
+ *                                            "probes");
+ *   probes.add_field("velocity", dof_handler_u);
+ *   probes.add_field("pressure", dof_handler_p);
+ *
+ *   for (; time < end_time; time += time_step)
+ *     {
+ *       // ... solve ...
+ *       velocity.update_ghost_values();
+ *       pressure.update_ghost_values();
+ *       probes.record(time, std::vector<const VectorType *>{&velocity,
+ *                                                            &pressure});
+ *     }
+ *   probes.flush();
+ * @endcode
+ *
+ * The fields need to be given in terms of DoFHandler objects on the same
+ * triangulation, and the vectors passed to record() need to contain the
+ * values of the degrees of freedom of all locally owned cells, i.e., ghost
+ * values need to be updated for distributed vectors. The components of the
+ * fields are evaluated as scalar quantities, so only primitive finite
+ * elements are supported, see FEPointEvaluation.
+ *
+ * @ingroup numerics
+ */
+template <int dim>
+class DistributedPointValueHistory
+{
+public:
+  /**
+   * Constructor. The values at the points @p points are evaluated with the
+   * mapping @p mapping and written to files whose names start with
+   * @p file_name_base, every @p n_buffered_steps steps. The argument
+   * @p tolerance is passed to Utilities::MPI::RemotePointEvaluation and
+   * determines, in terms of unit cell coordinates, which cells are found
+   * around a point.
+   */
+  DistributedPointValueHistory(const Mapping<dim> &           mapping,
+                               const std::vector<Point<dim>> &points,
+                               const std::string &            file_name_base,
+                               const unsigned int n_buffered_steps = 100,
+                               const double       tolerance        = 1e-6);
+
+  /**
+   * Destructor. Writes the values that are still buffered to the files.
+   */
+  ~DistributedPointValueHistory();
+
+  /**
+   * Add a field described by @p dof_handler under the name @p name. The
+   * components @p first_component to <code>first_component + n_components -
+   * 1</code> of the finite element are recorded; by default, all components
+   * from @p first_component on. The fields need to be added in the same
+   * order on all processes, and before record() is called for the first
+   * time.
+   */
+  void
+  add_field(
+    const std::string &    name,
+    const DoFHandler<dim> &dof_handler,
+    const unsigned int     first_component = 0,
+    const unsigned int     n_components    = numbers::invalid_unsigned_int);
+
+  /**
+   * Evaluate the vectors @p vectors, one for each field in the order the
+   * fields have been added, at all points, and store the values together
+   * with @p time. If the points have not been located yet or if the
+   * triangulation has changed since, they are located first.
+   *
+   * @warning This is a collective call that needs to be executed by all
+   *   processors in the communicator of the triangulation.
+   */
+  template <typename VectorType>
+  void
+  record(const double time, const std::vector<const VectorType *> &vectors);
+
+  /**
+   * Same as above, for the case of a single field.
+   */
+  template <typename VectorType>
+  void
+  record(const double time, const VectorType &vector);
+
+  /**
+   * Locate the points in the triangulation of the fields anew. This is done
+   * automatically by record() after the triangulation has changed, but needs
+   * to be called by the user if only the mapping has changed, e.g., because
+   * the displacement vector of a MappingQEulerian object has been updated.
+   *
+   * @warning This is a collective call that needs to be executed by all
+   *   processors in the communicator of the triangulation.
+   */
+  void
+  locate_points();
+
+  /**
+   * Append the buffered values to the file of the current process and clear
+   * the buffer. This function is not collective.
+   */
+  void
+  flush();
+
+  /**
+   * Return the number of steps recorded so far, including the ones that have
+   * already been written to file.
+   */
+  unsigned int
+  n_recorded_steps() const;
+
+  /**
+   * Return the number of values recorded per point and step, i.e., the sum
+   * of the number of components of all fields.
+   */
+  unsigned int
+  n_values_per_point() const;
+
+  /**
+   * Return the names of the values recorded per point, i.e., the names of
+   * the fields, followed by the index of the component for fields with more
+   * than one component.
+   */
+  std::vector<std::string>
+  get_value_names() const;
+
+  /**
+   * Return the values of the last recorded step. The value with index
+   * @p v at point @p p is at position <code>p * n_values_per_point() +
+   * v</code>.
+   */
+  std::vector<double>
+  get_last_values() const;
+
+  /**
+   * Return an estimate for the memory consumption, in bytes, of this
+   * object.
+   */
+  std::size_t
+  memory_consumption() const;
+
+private:
+  /**
+   * A field to be recorded.
+   */
+  struct Field
+  {
+    /**
+     * The name of the field.
+     */
+    std::string name;
+
+    /**
+     * The DoFHandler the field is described by.
+     */
+    SmartPointer<const DoFHandler<dim>> dof_handler;
+
+    /**
+     * The first component of the finite element that is recorded.
+     */
+    unsigned int first_component;
+
+    /**
+     * The number of components that are recorded.
+     */
+    unsigned int n_components;
+  };
+
+  /**
+   * Set up the evaluators for all fields, finite elements, and components,
+   * and the geometry data of the cells with points, if this has not been
+   * done since the points have been located.
+   */
+  void
+  setup_evaluators(
+    const typename Utilities::MPI::RemotePointEvaluation<dim>::CellData
+      &cell_data);
+
+  /**
+   * Return the name of the file of the current process with the ending
+   * @p suffix.
+   */
+  std::string
+  get_file_name(const std::string &suffix) const;
+
+  /**
+   * The mapping used to locate the points and to evaluate the fields.
+   */
+  SmartPointer<const Mapping<dim>> mapping;
+
+  /**
+   * The points of the current process.
+   */
+  const std::vector<Point<dim>> points;
+
+  /**
+   * The beginning of the names of the output files.
+   */
+  const std::string file_name_base;
+
+  /**
+   * The number of steps after which the buffered values are written to the
+   * files.
+   */
+  const unsigned int n_buffered_steps;
+
+  /**
+   * The fields to be recorded.
+   */
+  std::vector<Field> fields;
+
+  /**
+   * The sum of the number of components of all fields.
+   */
+  unsigned int n_values;
+
+  /**
+   * The object used to locate the points and to exchange the values.
+   */
+  Utilities::MPI::RemotePointEvaluation<dim> remote_point_evaluation;
+
+  /**
+   * The geometry data of the cells that contain points, computed once per
+   * location of the points if the mapping and all finite elements support
+   * the fast evaluation path of FEPointEvaluation, and a null pointer
+   * otherwise, in which case the evaluators compute the geometry data on
+   * the fly.
+   */
+  std::unique_ptr<NonMatching::MappingInfo<dim, dim>> mapping_info;
+
+  /**
+   * The evaluators for each field, finite element of the FECollection of the
+   * DoFHandler of the field, and component. The vector is empty until the
+   * first evaluation after the points have been located.
+   */
+  std::vector<std::vector<
+    std::vector<std::unique_ptr<FEPointEvaluation<1, dim, dim, double>>>>>
+    evaluators;
+
+  /**
+   * The times of the steps that have not been written to file yet.
+   */
+  std::vector<double> buffered_times;
+
+  /**
+   * The values of the steps that have not been written to file yet, with the
+   * values of one step stored as described in get_last_values().
+   */
+  std::vector<double> buffered_values;
+
+  /**
+   * The values of the last recorded step.
+   */
+  std::vector<double> last_values;
+
+  /**
+   * The number of steps recorded so far.
+   */
+  unsigned int n_steps;
+
+  /**
+   * The number of steps written to file so far.
+   */
+  unsigned int n_written_steps;
+};
+
+
+
+#ifndef DOXYGEN
+/*------------------------ Inline functions -------------------------*/
+
+
+
+template <int dim>
+template <typename VectorType>
+inline void
+DistributedPointValueHistory<dim>::record(const double      time,
+                                          const VectorType &vector)
+{
+  record(time, std::vector<const VectorType *>{&vector});
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -67,7 +67,15 @@ namespace Functions
    * Once the FEFieldFunction knows where the points lie, it creates a
    * quadrature formula for those points, and calls
    * FEValues::get_function_values or FEValues::get_function_gradients with
-   * the given quadrature points.
+   * the given quadrature points. The functions value_list(),
+   * vector_value_list(), gradient_list(), and vector_gradient_list() instead
+   * sort the points by the cells they lie in, using the GridTools::Cache of
+   * this object, and evaluate the points of each cell at once with
+   * FEPointEvaluation, processing the cells in parallel, if the mapping and
+   * the finite elements support the fast tensor-product path of
+   * FEPointEvaluation (e.g., MappingQ with FE_Q or FE_DGQ elements and
+   * systems of these). Evaluating many points with a single call to these
+   * functions is therefore much faster than calling value() point by point.
    *
    * If you only need the quadrature points but not the values of the finite
    * element function (you might want this for the adjoint interpolation), you
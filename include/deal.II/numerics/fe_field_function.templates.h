@@ -20,6 +20,7 @@
 #include <deal.II/base/config.h>
 
 #include <deal.II/base/logstream.h>
+#include <deal.II/base/parallel.h>
 
 #include <deal.II/fe/fe_values.h>
 
@@ -31,17 +32,174 @@
 #include <deal.II/hp/mapping_collection.h>
 #include <deal.II/hp/q_collection.h>
 
+#include <deal.II/matrix_free/fe_point_evaluation.h>
+
+#include <deal.II/non_matching/mapping_info.h>
+
 #include <deal.II/numerics/fe_field_function.h>
 #include <deal.II/numerics/vector_tools_common.h>
 
+#include <memory>
 #include <tuple>
+#include <type_traits>
 
 
 
 DEAL_II_NAMESPACE_OPEN
 
+namespace internal
+{
+  namespace FEFieldFunctionImplementation
+  {
+    /**
+     * Evaluate the values of the field given by @p dof_handler and
+     * @p data_vector, if @p values is not a null pointer, and its
+     * gradients, if @p gradients is not a null pointer, at the points
+     * @p qpoints of the cells @p cells as returned by
+     * FEFieldFunction::compute_point_locations(), and store them at the
+     * positions given by @p maps.
+     *
+     * The points of a cell are evaluated at once with FEPointEvaluation
+     * and the cells are processed in parallel. Return false without
+     * evaluating anything if FEPointEvaluation cannot use its fast
+     * tensor-product path for the mapping or the elements, in which case
+     * the caller needs to fall back to FEValues.
+     *
+     * This is the version for vectors of complex numbers, which
+     * FEPointEvaluation does not support.
+     */
+    template <int dim, int spacedim, typename VectorType>
+    bool
+    evaluate_with_fe_point_evaluation(
+      const Mapping<dim> &,
+      const DoFHandler<dim, spacedim> &,
+      const VectorType &,
+      const std::vector<
+        typename DoFHandler<dim, spacedim>::active_cell_iterator> &,
+      const std::vector<std::vector<Point<dim>>> &,
+      const std::vector<std::vector<unsigned int>> &,
+      std::vector<Vector<typename VectorType::value_type>> *,
+      std::vector<
+        std::vector<Tensor<1, dim, typename VectorType::value_type>>> *,
+      std::false_type)
+    {
+      return false;
+    }
+
+
+
+    /**
+     * Same as above, for vectors of real numbers.
+     */
+    template <int dim, int spacedim, typename VectorType>
+    bool
+    evaluate_with_fe_point_evaluation(
+      const Mapping<dim> &             mapping,
+      const DoFHandler<dim, spacedim> &dof_handler,
+      const VectorType &               data_vector,
+      const std::vector<
+        typename DoFHandler<dim, spacedim>::active_cell_iterator> &cells,
+      const std::vector<std::vector<Point<dim>>> &                qpoints,
+      const std::vector<std::vector<unsigned int>> &              maps,
+      std::vector<Vector<typename VectorType::value_type>> *      values,
+      std::vector<
+        std::vector<Tensor<1, dim, typename VectorType::value_type>>>
+        *gradients,
+      std::true_type)
+    {
+      using Number    = typename VectorType::value_type;
+      using Evaluator = dealii::FEPointEvaluation<1, dim, dim, Number>;
+
+      const dealii::hp::FECollection<dim, spacedim> &fe_collection =
+        dof_handler.get_fe_collection();
+      if (!FEPointEvaluation::is_fast_path_supported(mapping))
+        return false;
+      for (unsigned int i = 0; i < fe_collection.size(); ++i)
+        for (unsigned int b = 0; b < fe_collection[i].n_base_elements(); ++b)
+          if (!FEPointEvaluation::is_fast_path_supported(fe_collection[i],
+                                                         b))
+            return false;
+
+      for (const auto &cell : cells)
+        AssertThrow(!cell->is_artificial(),
+                    VectorTools::ExcPointNotAvailableHere());
+
+      const unsigned int n_components = fe_collection.n_components();
+      if (values != nullptr)
+        for (auto &value : *values)
+          value.reinit(n_components);
+
+      const UpdateFlags  update_flags =
+        (values != nullptr ? update_values : update_default) |
+        (gradients != nullptr ? update_gradients : update_default);
+      const EvaluationFlags::EvaluationFlags evaluation_flags =
+        (values != nullptr ? EvaluationFlags::values :
+                             EvaluationFlags::nothing) |
+        (gradients != nullptr ? EvaluationFlags::gradients :
+                                EvaluationFlags::nothing);
+
+      dealii::parallel::apply_to_subranges(
+        0U,
+        static_cast<unsigned int>(cells.size()),
+        [&](const unsigned int begin, const unsigned int end) {
+          // The mapping data of a cell is computed once and shared by the
+          // evaluators of all components, which are set up for each
+          // element the first time a cell with this element is visited
+          NonMatching::MappingInfo<dim, spacedim> mapping_info(mapping,
+                                                               update_flags);
+          std::vector<std::vector<std::unique_ptr<Evaluator>>> evaluators(
+            fe_collection.size());
+          std::vector<Number> local_values;
+
+          for (unsigned int i = begin; i < end; ++i)
+            {
+              const auto &       cell     = cells[i];
+              const unsigned int fe_index = cell->active_fe_index();
+              if (evaluators[fe_index].empty())
+                for (unsigned int c = 0; c < n_components; ++c)
+                  evaluators[fe_index].push_back(
+                    std::make_unique<Evaluator>(mapping_info,
+                                                fe_collection[fe_index],
+                                                c));
+
+              local_values.resize(cell->get_fe().n_dofs_per_cell());
+              cell->get_dof_values(data_vector,
+                                   local_values.begin(),
+                                   local_values.end());
+              mapping_info.reinit(cell, make_array_view(qpoints[i]));
+
+              for (unsigned int c = 0; c < n_components; ++c)
+                {
+                  Evaluator &evaluator = *evaluators[fe_index][c];
+                  evaluator.reinit(0);
+                  evaluator.evaluate(make_array_view(local_values),
+                                     evaluation_flags);
+                  for (unsigned int q = 0; q < qpoints[i].size(); ++q)
+                    {
+                      if (values != nullptr)
+                        (*values)[maps[i][q]](c) = evaluator.get_value(q);
+                      if (gradients != nullptr)
+                        {
+                          (*gradients)[maps[i][q]].resize(n_components);
+                          (*gradients)[maps[i][q]][c] =
+                            evaluator.get_gradient(q);
+                        }
+                    }
+                }
+            }
+        },
+        16);
+
+      return true;
+    }
+  } // namespace FEFieldFunctionImplementation
+} // namespace internal
+
+
+
 namespace Functions
 {
+
   template <int dim, typename VectorType, int spacedim>
   FEFieldFunction<dim, VectorType, spacedim>::FEFieldFunction(
     const DoFHandler<dim, spacedim> &mydh,
@@ -284,6 +442,21 @@ namespace Functions
     const unsigned int n_cells =
       compute_point_locations(points, cells, qpoints, maps);
 
+    // Evaluate the points of each cell at once with FEPointEvaluation if
+    // possible, which avoids setting up an FEValues object per cell
+    if (internal::FEFieldFunctionImplementation::
+          evaluate_with_fe_point_evaluation<dim, spacedim, VectorType>(
+            mapping,
+            *dh,
+            data_vector,
+            cells,
+            qpoints,
+            maps,
+            &values,
+            nullptr,
+            std::is_floating_point<typename VectorType::value_type>()))
+      return;
+
     // Create quadrature collection
     hp::QCollection<dim> quadrature_collection;
     for (unsigned int i = 0; i < n_cells; ++i)
@@ -364,6 +537,21 @@ namespace Functions
     const unsigned int n_cells =
       compute_point_locations(points, cells, qpoints, maps);
 
+    // Evaluate the points of each cell at once with FEPointEvaluation if
+    // possible, see vector_value_list()
+    if (internal::FEFieldFunctionImplementation::
+          evaluate_with_fe_point_evaluation<dim, spacedim, VectorType>(
+            mapping,
+            *dh,
+            data_vector,
+            cells,
+            qpoints,
+            maps,
+            nullptr,
+            &values,
+            std::is_floating_point<typename VectorType::value_type>()))
+      return;
+
     // Create quadrature collection
     hp::QCollection<dim> quadrature_collection;
     for (unsigned int i = 0; i < n_cells; ++i)
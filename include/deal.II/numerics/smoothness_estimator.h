@@ -123,6 +123,9 @@ namespace SmoothnessEstimator
      *
      * For a finite element approximation @p solution, this function writes the
      * decay rate for every cell into the output vector @p smoothness_indicators.
+     * The expansion coefficients are computed for batches of cells sharing the
+     * same finite element with a single matrix-matrix product each, and the
+     * decay rates of the cells in a batch are fitted in parallel.
      *
      * @param [in] fe_legendre FESeries::Legendre object to calculate coefficients.
      * This object needs to be initialized to have at least $p+1$ coefficients
@@ -382,6 +385,9 @@ namespace SmoothnessEstimator
      * @p dof_handler, this function returns a vector @p smoothness_indicators
      * with as many elements as there are cells where each element contains the
      * estimated regularity $\sigma$.
+     * As for the Legendre variant, the expansion coefficients are computed
+     * for batches of cells at once and the regularities are fitted in
+     * parallel.
      *
      * A series expansion object @p fe_fourier has to be supplied, which needs
      * to be constructed with the same FECollection object as the @p dof_handler.
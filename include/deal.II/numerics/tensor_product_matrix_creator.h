@@ -19,6 +19,7 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/function.h>
 #include <deal.II/base/quadrature.h>
 
 #include <deal.II/dofs/dof_handler.h>
@@ -88,6 +89,61 @@ namespace TensorProductMatrixCreator
     const dealii::ndarray<double, dim, 3> &           cell_extent,
     const unsigned int                                n_overlap = 1);
 
+  /**
+   * Compute the extent of a Cartesian surrogate of a possibly deformed
+   * @p cell and its face neighbors, in the format expected by
+   * create_laplace_tensor_product_matrix(). In each coordinate direction
+   * $d$ of the reference cell, the extent is the length of the averaged
+   * Jacobian column $\bar J e_d$, which is computed from the mean of the
+   * edges of the cell parallel to that direction, using the vertex
+   * positions given by @p mapping. For the neighbors, the extent in the
+   * direction normal to the shared face is used, which need not be the
+   * same coordinate direction as on @p cell. Entries for neighbors that do
+   * not exist are set to zero.
+   *
+   * For parallelograms and parallelepipeds, the extents are exact edge
+   * lengths and the surrogate only misses the shear of the cell.
+   */
+  template <int dim>
+  dealii::ndarray<double, dim, 3>
+  compute_surrogate_cell_extent(
+    const Mapping<dim> &                              mapping,
+    const typename Triangulation<dim>::cell_iterator &cell);
+
+  /**
+   * Create the 1D mass and derivative matrices of a separable approximation
+   * of the operator $-\nabla \cdot (\kappa \nabla u)$ on a possibly
+   * deformed @p cell with a variable coefficient $\kappa$ given by
+   * @p coefficient. The cell and its neighbors are replaced by Cartesian
+   * surrogate cells with the extents from compute_surrogate_cell_extent(),
+   * and the derivative matrices are scaled by the mean value of the
+   * coefficient on @p cell, evaluated at the points of the tensor product of
+   * @p quadrature mapped by @p mapping. If @p coefficient is a null pointer,
+   * the coefficient is one.
+   *
+   * The result is passed to TensorProductMatrixSymmetricSum or
+   * TensorProductMatrixSymmetricSumCollection, which gives a fast
+   * diagonalization inverse of the surrogate operator that can be used in an
+   * overlapping Schwarz smoother on meshes where the exact patch matrices
+   * are not separable, instead of dense inverses of the patch matrices.
+   * Since the surrogate matrices of cells with the same shape and
+   * coefficient are the same up to roundoff, the compression of
+   * TensorProductMatrixSymmetricSumCollection still applies, e.g., in parts
+   * of the mesh that are extruded or uniformly refined.
+   */
+  template <int dim, typename Number>
+  std::pair<std::array<FullMatrix<Number>, dim>,
+            std::array<FullMatrix<Number>, dim>>
+  create_laplace_tensor_product_matrix(
+    const Mapping<dim> &                              mapping,
+    const typename Triangulation<dim>::cell_iterator &cell,
+    const std::set<types::boundary_id> &              dirichlet_boundaries,
+    const std::set<types::boundary_id> &              neumann_boundaries,
+    const FiniteElement<1> &                          fe,
+    const Quadrature<1> &                             quadrature,
+    const Function<dim> *                             coefficient = nullptr,
+    const unsigned int                                n_overlap   = 1);
+
 } // namespace TensorProductMatrixCreator
 
 
@@ -166,6 +222,31 @@ namespace TensorProductMatrixCreator
       return std::tuple<FullMatrix<Number>, FullMatrix<Number>, bool>{
         mass_matrix_reference, derivative_matrix_reference, false};
     }
+
+
+
+    template <int dim>
+    std::array<double, dim>
+    compute_averaged_jacobian_column_lengths(
+      const Mapping<dim> &                              mapping,
+      const typename Triangulation<dim>::cell_iterator &cell)
+    {
+      const auto vertices = mapping.get_vertices(cell);
+
+      // the vertices are numbered lexicographically, so bit d of the vertex
+      // index gives the position along coordinate direction d
+      std::array<double, dim> lengths;
+      for (unsigned int d = 0; d < dim; ++d)
+        {
+          Tensor<1, dim> edge;
+          for (unsigned int v = 0; v < vertices.size(); ++v)
+            if ((v & (1U << d)) == 0)
+              edge += vertices[v | (1U << d)] - vertices[v];
+          lengths[d] = edge.norm() / (vertices.size() / 2);
+        }
+
+      return lengths;
+    }
   } // namespace internal
 
 
@@ -380,6 +461,100 @@ namespace TensorProductMatrixCreator
       fe, quadrature, boundary_ids, cell_extent, n_overlap);
   }
 
+
+
+  template <int dim>
+  dealii::ndarray<double, dim, 3>
+  compute_surrogate_cell_extent(
+    const Mapping<dim> &                              mapping,
+    const typename Triangulation<dim>::cell_iterator &cell)
+  {
+    Assert(cell->reference_cell() == ReferenceCells::get_hypercube<dim>(),
+           ExcNotImplemented());
+
+    const auto lengths =
+      internal::compute_averaged_jacobian_column_lengths(mapping, cell);
+
+    dealii::ndarray<double, dim, 3> cell_extent;
+    for (unsigned int d = 0; d < dim; ++d)
+      {
+        cell_extent[d][1] = lengths[d];
+
+        for (unsigned int side = 0; side < 2; ++side)
+          {
+            const unsigned int face = 2 * d + side;
+
+            double neighbor_extent = 0.0;
+            if ((cell->at_boundary(face) == false) ||
+                cell->has_periodic_neighbor(face))
+              {
+                const auto neighbor = cell->neighbor_or_periodic_neighbor(face);
+                const unsigned int neighbor_face =
+                  cell->has_periodic_neighbor(face) ?
+                    cell->periodic_neighbor_face_no(face) :
+                    cell->neighbor_face_no(face);
+
+                neighbor_extent =
+                  internal::compute_averaged_jacobian_column_lengths(
+                    mapping, neighbor)[neighbor_face / 2];
+              }
+
+            cell_extent[d][2 * side] = neighbor_extent;
+          }
+      }
+
+    return cell_extent;
+  }
+
+
+
+  template <int dim, typename Number>
+  std::pair<std::array<FullMatrix<Number>, dim>,
+            std::array<FullMatrix<Number>, dim>>
+  create_laplace_tensor_product_matrix(
+    const Mapping<dim> &                              mapping,
+    const typename Triangulation<dim>::cell_iterator &cell,
+    const std::set<types::boundary_id> &              dirichlet_boundaries,
+    const std::set<types::boundary_id> &              neumann_boundaries,
+    const FiniteElement<1> &                          fe,
+    const Quadrature<1> &                             quadrature,
+    const Function<dim> *                             coefficient,
+    const unsigned int                                n_overlap)
+  {
+    auto matrices = create_laplace_tensor_product_matrix<dim, Number>(
+      cell,
+      dirichlet_boundaries,
+      neumann_boundaries,
+      fe,
+      quadrature,
+      compute_surrogate_cell_extent(mapping, cell),
+      n_overlap);
+
+    if (coefficient != nullptr)
+      {
+        // every term of the separable operator contains exactly one
+        // derivative matrix, so scaling these scales the whole operator
+        const Quadrature<dim> quadrature_dim(quadrature);
+
+        double mean_coefficient = 0.0;
+        for (unsigned int q = 0; q < quadrature_dim.size(); ++q)
+          mean_coefficient +=
+            coefficient->value(
+              mapping.transform_unit_to_real_cell(cell,
+                                                  quadrature_dim.point(q))) *
+            quadrature_dim.weight(q);
+
+        Assert(mean_coefficient > 0.0,
+               ExcMessage("The mean value of the coefficient must be "
+                          "positive."));
+
+        for (unsigned int d = 0; d < dim; ++d)
+          matrices.second[d] *= static_cast<Number>(mean_coefficient);
+      }
+
+    return matrices;
+  }
+
 } // namespace TensorProductMatrixCreator
 
 
@@ -19,6 +19,7 @@
 
 #include <deal.II/base/qprojector.h>
 #include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/work_stream.h>
 
 #include <deal.II/dofs/dof_tools.h>
 
@@ -148,20 +149,6 @@ namespace VectorTools
         {
           const bool fe_is_system = (n_components != 1);
 
-          // field to store the indices
-          std::vector<types::global_dof_index> face_dofs;
-          face_dofs.reserve(dof.get_fe_collection().max_dofs_per_face());
-
-          // array to store the values of the boundary function at the boundary
-          // points. have two arrays for scalar and vector functions to use the
-          // more efficient one respectively
-          std::vector<number>         dof_values_scalar;
-          std::vector<Vector<number>> dof_values_system;
-          dof_values_scalar.reserve(
-            dof.get_fe_collection().max_dofs_per_face());
-          dof_values_system.reserve(
-            dof.get_fe_collection().max_dofs_per_face());
-
           // before we start with the loop over all cells create an hp::FEValues
           // object that holds the interpolation points of all finite elements
           // that may ever be in use
@@ -232,159 +219,147 @@ namespace VectorTools
             q_collection,
             update_quadrature_points);
 
-          for (auto const &cell : dof.active_cell_iterators())
-            if (!cell->is_artificial())
+          // collect the faces on the boundary parts listed in the function
+          // map first, such that the work below only visits those faces
+          using FaceDescriptor =
+            std::pair<typename DoFHandler<dim, spacedim>::active_cell_iterator,
+                      unsigned int>;
+          std::vector<FaceDescriptor> boundary_faces;
+          for (const auto &cell : dof.active_cell_iterators())
+            if (!cell->is_artificial() && cell->at_boundary())
               for (const unsigned int face_no : cell->face_indices())
+                if (cell->at_boundary(face_no) &&
+                    (function_map.find(cell->face(face_no)->boundary_id()) !=
+                     function_map.end()) &&
+                    (cell->get_fe().n_dofs_per_face(face_no) > 0))
+                  boundary_faces.emplace_back(cell, face_no);
+
+          // evaluate the boundary functions on the faces in parallel. the
+          // copier enters the values into the output map in the order of the
+          // faces, so the result is the same as the one of a serial loop
+          using CopyData =
+            std::vector<std::pair<types::global_dof_index, number>>;
+          WorkStream::run(
+            boundary_faces.begin(),
+            boundary_faces.end(),
+            [&](const typename std::vector<FaceDescriptor>::iterator
+                  &                                      face_descriptor,
+                dealii::hp::FEFaceValues<dim, spacedim> &x_fe_values,
+                CopyData &                               copy_data) {
+              const auto &       cell    = face_descriptor->first;
+              const unsigned int face_no = face_descriptor->second;
+              const FiniteElement<dim, spacedim> &fe = cell->get_fe();
+
+              // we can presently deal only with primitive elements for
+              // boundary values. this does not preclude us using
+              // non-primitive elements in components that we aren't
+              // interested in, however. make sure that all shape functions
+              // that are non-zero for the components we are interested in,
+              // are in fact primitive
+              for (unsigned int i = 0; i < fe.n_dofs_per_cell(); ++i)
                 {
-                  const FiniteElement<dim, spacedim> &fe = cell->get_fe();
-
-                  // we can presently deal only with primitive elements for
-                  // boundary values. this does not preclude us using
-                  // non-primitive elements in components that we aren't
-                  // interested in, however. make sure that all shape functions
-                  // that are non-zero for the components we are interested in,
-                  // are in fact primitive
-                  for (unsigned int i = 0; i < fe.n_dofs_per_cell(); ++i)
-                    {
-                      const ComponentMask &nonzero_component_array =
-                        fe.get_nonzero_components(i);
-                      for (unsigned int c = 0; c < n_components; ++c)
-                        if ((nonzero_component_array[c] == true) &&
-                            (component_mask[c] == true))
-                          Assert(
-                            fe.is_primitive(i),
-                            ExcMessage(
-                              "This function can only deal with requested boundary "
-                              "values that correspond to primitive (scalar) base "
-                              "elements. You may want to look up in the deal.II "
-                              "glossary what the term 'primitive' means."
-                              "\n\n"
-                              "There are alternative boundary value interpolation "
-                              "functions in namespace 'VectorTools' that you can "
-                              "use for non-primitive finite elements."));
-                    }
+                  const ComponentMask &nonzero_component_array =
+                    fe.get_nonzero_components(i);
+                  for (unsigned int c = 0; c < n_components; ++c)
+                    if ((nonzero_component_array[c] == true) &&
+                        (component_mask[c] == true))
+                      Assert(
+                        fe.is_primitive(i),
+                        ExcMessage(
+                          "This function can only deal with requested boundary "
+                          "values that correspond to primitive (scalar) base "
+                          "elements. You may want to look up in the deal.II "
+                          "glossary what the term 'primitive' means."
+                          "\n\n"
+                          "There are alternative boundary value interpolation "
+                          "functions in namespace 'VectorTools' that you can "
+                          "use for non-primitive finite elements."));
+                }
 
-                  const typename DoFHandler<dim, spacedim>::face_iterator face =
-                    cell->face(face_no);
-                  const types::boundary_id boundary_component =
-                    face->boundary_id();
-
-                  // see if this face is part of the boundaries for which we are
-                  // supposed to do something, and also see if the finite
-                  // element in use here has DoFs on the face at all
-                  if ((function_map.find(boundary_component) !=
-                       function_map.end()) &&
-                      (fe.n_dofs_per_face(face_no) > 0))
+              const typename DoFHandler<dim, spacedim>::face_iterator face =
+                cell->face(face_no);
+              const Function<spacedim, number> &boundary_function =
+                *function_map.find(face->boundary_id())->second;
+
+              x_fe_values.reinit(cell, face_no);
+              const dealii::FEFaceValues<dim, spacedim> &fe_values =
+                x_fe_values.get_present_fe_values();
+
+              // get indices, physical location and boundary values of dofs
+              // on this face
+              const unsigned int n_face_dofs = fe.n_dofs_per_face(face_no);
+              std::vector<types::global_dof_index> face_dofs(n_face_dofs);
+              face->get_dof_indices(face_dofs, cell->active_fe_index());
+              std::vector<Point<spacedim>> dof_locations =
+                fe_values.get_quadrature_points();
+              dof_locations.resize(n_face_dofs);
+
+              copy_data.clear();
+              if (fe_is_system)
+                {
+                  std::vector<Vector<number>> dof_values_system(
+                    n_face_dofs, Vector<number>(fe.n_components()));
+                  boundary_function.vector_value_list(dof_locations,
+                                                      dof_values_system);
+
+                  // enter those dofs into the list that match the component
+                  // signature. avoid the usual complication that we can't
+                  // just use *_system_to_component_index for non-primitive
+                  // FEs
+                  for (unsigned int i = 0; i < n_face_dofs; ++i)
                     {
-                      // face is of the right component
-                      x_fe_values.reinit(cell, face_no);
-                      const dealii::FEFaceValues<dim, spacedim> &fe_values =
-                        x_fe_values.get_present_fe_values();
-
-                      // get indices, physical location and boundary values of
-                      // dofs on this face
-                      face_dofs.resize(fe.n_dofs_per_face(face_no));
-                      face->get_dof_indices(face_dofs, cell->active_fe_index());
-                      std::vector<Point<spacedim>> dof_locations =
-                        fe_values.get_quadrature_points();
-                      dof_locations.resize(fe.n_dofs_per_face(face_no));
-
-                      if (fe_is_system)
-                        {
-                          dof_values_system.resize(fe.n_dofs_per_face(face_no),
-                                                   Vector<number>(
-                                                     fe.n_components()));
-
-                          function_map.find(boundary_component)
-                            ->second->vector_value_list(dof_locations,
-                                                        dof_values_system);
-
-                          // enter those dofs into the list that match the
-                          // component signature. avoid the usual complication
-                          // that we can't just use *_system_to_component_index
-                          // for non-primitive FEs
-                          for (unsigned int i = 0; i < face_dofs.size(); ++i)
-                            {
-                              unsigned int component;
-                              if (fe.is_primitive())
-                                component =
-                                  fe.face_system_to_component_index(i, face_no)
-                                    .first;
-                              else
-                                {
-                                  // non-primitive case. make sure that this
-                                  // particular shape function _is_ primitive,
-                                  // and get at it's component. use usual trick
-                                  // to transfer face dof index to cell dof
-                                  // index
-                                  const unsigned int cell_i =
-                                    (dim == 1 ?
-                                       i :
-                                       (dim == 2 ?
-                                          (i < 2 * fe.n_dofs_per_vertex() ?
-                                             i :
-                                             i + 2 * fe.n_dofs_per_vertex()) :
-                                          (dim == 3 ?
-                                             (i < 4 * fe.n_dofs_per_vertex() ?
-                                                i :
-                                                (i < 4 * fe.n_dofs_per_vertex() +
-                                                       4 *
-                                                         fe.n_dofs_per_line() ?
-                                                   i +
-                                                     4 *
-                                                       fe.n_dofs_per_vertex() :
-                                                   i +
-                                                     4 *
-                                                       fe.n_dofs_per_vertex() +
-                                                     8 *
-                                                       fe.n_dofs_per_line())) :
-                                             numbers::invalid_unsigned_int)));
-                                  Assert(cell_i < fe.n_dofs_per_cell(),
-                                         ExcInternalError());
-
-                                  // make sure that if this is not a primitive
-                                  // shape function, then all the corresponding
-                                  // components in the mask are not set
-                                  if (!fe.is_primitive(cell_i))
-                                    for (unsigned int c = 0; c < n_components;
-                                         ++c)
-                                      if (fe.get_nonzero_components(cell_i)[c])
-                                        Assert(component_mask[c] == false,
-                                               FETools::ExcFENotPrimitive());
-
-                                  // let's pick the first of possibly more than
-                                  // one non-zero components. if shape function
-                                  // is non-primitive, then we will ignore the
-                                  // result in the following anyway, otherwise
-                                  // there's only one non-zero component which
-                                  // we will use
-                                  component = fe.get_nonzero_components(cell_i)
-                                                .first_selected_component();
-                                }
-
-                              if (component_mask[component] == true)
-                                boundary_values[face_dofs[i]] =
-                                  dof_values_system[i](component);
-                            }
-                        }
+                      unsigned int component;
+                      if (fe.is_primitive())
+                        component =
+                          fe.face_system_to_component_index(i, face_no).first;
                       else
-                        // FE has only one component, so save some computations
                         {
-                          // get only the one component that this function has
-                          dof_values_scalar.resize(fe.n_dofs_per_face(face_no));
-                          function_map.find(boundary_component)
-                            ->second->value_list(dof_locations,
-                                                 dof_values_scalar,
-                                                 0);
-
-                          // enter into list
-
-                          for (unsigned int i = 0; i < face_dofs.size(); ++i)
-                            boundary_values[face_dofs[i]] =
-                              dof_values_scalar[i];
+                          // non-primitive case. make sure that this
+                          // particular shape function _is_ primitive, and
+                          // get at its component
+                          const unsigned int cell_i =
+                            fe.face_to_cell_index(i, face_no);
+
+                          // make sure that if this is not a primitive shape
+                          // function, then all the corresponding components
+                          // in the mask are not set
+                          if (!fe.is_primitive(cell_i))
+                            for (unsigned int c = 0; c < n_components; ++c)
+                              if (fe.get_nonzero_components(cell_i)[c])
+                                Assert(component_mask[c] == false,
+                                       FETools::ExcFENotPrimitive());
+
+                          // let's pick the first of possibly more than one
+                          // non-zero components. if shape function is
+                          // non-primitive, then we will ignore the result in
+                          // the following anyway, otherwise there's only one
+                          // non-zero component which we will use
+                          component = fe.get_nonzero_components(cell_i)
+                                        .first_selected_component();
                         }
+
+                      if (component_mask[component] == true)
+                        copy_data.emplace_back(face_dofs[i],
+                                               dof_values_system[i](component));
                     }
                 }
+              else
+                // FE has only one component, so save some computations
+                {
+                  std::vector<number> dof_values_scalar(n_face_dofs);
+                  boundary_function.value_list(dof_locations,
+                                               dof_values_scalar,
+                                               0);
+                  for (unsigned int i = 0; i < n_face_dofs; ++i)
+                    copy_data.emplace_back(face_dofs[i], dof_values_scalar[i]);
+                }
+            },
+            [&boundary_values](const CopyData &copy_data) {
+              for (const auto &entry : copy_data)
+                boundary_values[entry.first] = entry.second;
+            },
+            x_fe_values,
+            CopyData());
         }
     } // end of interpolate_boundary_values
   }   // namespace internal
@@ -181,6 +181,31 @@ namespace VectorTools
     const EvaluationFlags::EvaluationFlags flags = EvaluationFlags::avg,
     const unsigned int                     first_selected_component = 0);
 
+  /**
+   * Evaluate the values of several (distributed) solution vectors
+   * @p vectors, all associated with @p dof_handler, at the points specified
+   * by @p cache. The result is the same as the one of calling the function
+   * above for each vector, but the shape functions are evaluated only once
+   * per cell and the values of all vectors are exchanged in a single round
+   * of communication. Entry <code>[v][p]</code> of the returned object
+   * contains the value of vector <code>*vectors[v]</code> at point $p$.
+   *
+   * @warning This is a collective call that needs to be executed by all
+   *   processors in the communicator.
+   */
+  template <int n_components, int dim, int spacedim, typename VectorType>
+  std::vector<std::vector<
+    typename FEPointEvaluation<n_components,
+                               dim,
+                               spacedim,
+                               typename VectorType::value_type>::value_type>>
+  point_values(
+    const Utilities::MPI::RemotePointEvaluation<dim, spacedim> &cache,
+    const DoFHandler<dim, spacedim> &                           dof_handler,
+    const std::vector<const VectorType *> &                     vectors,
+    const EvaluationFlags::EvaluationFlags flags = EvaluationFlags::avg,
+    const unsigned int                     first_selected_component = 0);
+
   /**
    * Given a (distributed) solution vector @p vector, evaluate the gradients at
    * the (arbitrary and even remote) points specified by @p evaluation_points.
@@ -735,6 +760,123 @@ namespace VectorTools
       });
   }
 
+  template <int n_components, int dim, int spacedim, typename VectorType>
+  inline std::vector<std::vector<
+    typename FEPointEvaluation<n_components,
+                               dim,
+                               spacedim,
+                               typename VectorType::value_type>::value_type>>
+  point_values(
+    const Utilities::MPI::RemotePointEvaluation<dim, spacedim> &cache,
+    const DoFHandler<dim, spacedim> &                           dof_handler,
+    const std::vector<const VectorType *> &                     vectors,
+    const EvaluationFlags::EvaluationFlags                      flags,
+    const unsigned int first_selected_component)
+  {
+    using Number = typename VectorType::value_type;
+    using value_type =
+      typename FEPointEvaluation<n_components, dim, spacedim, Number>::
+        value_type;
+
+    Assert(cache.is_ready(),
+           ExcMessage(
+             "Utilities::MPI::RemotePointEvaluation is not ready yet! "
+             "Please call Utilities::MPI::RemotePointEvaluation::reinit() "
+             "yourself or another function that does this for you."));
+    Assert(&dof_handler.get_triangulation() == &cache.get_triangulation(),
+           ExcMessage("The provided Utilities::MPI::RemotePointEvaluation "
+                      "and DoFHandler object have been set up with different "
+                      "Triangulation objects, a scenario not supported!"));
+
+    const unsigned int n_vectors = vectors.size();
+    if (n_vectors == 0)
+      return {};
+
+    // evaluate all vectors on each cell with the same evaluator, storing the
+    // values of one point for all vectors next to each other
+    const auto evaluation_function =
+      [&](const ArrayView<value_type> &values,
+          const typename Utilities::MPI::RemotePointEvaluation<dim, spacedim>::
+            CellData &cell_data) {
+        std::vector<Number> solution_values;
+        std::vector<std::unique_ptr<
+          FEPointEvaluation<n_components, dim, spacedim, Number>>>
+          evaluators(dof_handler.get_fe_collection().size());
+
+        for (unsigned int i = 0; i < cell_data.cells.size(); ++i)
+          {
+            typename DoFHandler<dim, spacedim>::active_cell_iterator cell = {
+              &cache.get_triangulation(),
+              cell_data.cells[i].first,
+              cell_data.cells[i].second,
+              &dof_handler};
+
+            const unsigned int first_point = cell_data.reference_point_ptrs[i];
+            const ArrayView<const Point<dim>> unit_points(
+              cell_data.reference_point_values.data() + first_point,
+              cell_data.reference_point_ptrs[i + 1] - first_point);
+
+            auto &evaluator = evaluators[cell->active_fe_index()];
+            if (evaluator == nullptr)
+              evaluator = std::make_unique<
+                FEPointEvaluation<n_components, dim, spacedim, Number>>(
+                cache.get_mapping(),
+                cell->get_fe(),
+                update_values,
+                first_selected_component);
+            evaluator->reinit(cell, unit_points);
+
+            solution_values.resize(cell->get_fe().n_dofs_per_cell());
+            for (unsigned int v = 0; v < n_vectors; ++v)
+              {
+                cell->get_dof_values(*vectors[v],
+                                     solution_values.begin(),
+                                     solution_values.end());
+                evaluator->evaluate(solution_values,
+                                    dealii::EvaluationFlags::values);
+                for (unsigned int q = 0; q < unit_points.size(); ++q)
+                  values[(first_point + q) * n_vectors + v] =
+                    evaluator->get_value(q);
+              }
+          }
+      };
+
+    std::vector<value_type> evaluation_point_results;
+    std::vector<value_type> buffer;
+    cache.template evaluate_and_process<value_type>(evaluation_point_results,
+                                                    buffer,
+                                                    evaluation_function,
+                                                    n_vectors);
+
+    const auto &                         ptr = cache.get_point_ptrs();
+    std::vector<std::vector<value_type>> results(
+      n_vectors, std::vector<value_type>(ptr.size() - 1));
+    std::vector<value_type> entries;
+    for (unsigned int i = 0; i < ptr.size() - 1; ++i)
+      {
+        const unsigned int n_entries = ptr[i + 1] - ptr[i];
+        if (n_entries == 0)
+          continue;
+
+        for (unsigned int v = 0; v < n_vectors; ++v)
+          if (cache.is_map_unique())
+            results[v][i] = evaluation_point_results[i * n_vectors + v];
+          else
+            {
+              // map is not unique (multiple or no results): reduce the
+              // results of all cells around the point
+              entries.resize(n_entries);
+              for (unsigned int e = 0; e < n_entries; ++e)
+                entries[e] =
+                  evaluation_point_results[(ptr[i] + e) * n_vectors + v];
+              results[v][i] =
+                internal::reduce(flags, ArrayView<const value_type>(entries));
+            }
+      }
+
+    return results;
+  }
+
   template <int n_components,
             template <int, int>
             class MeshType,
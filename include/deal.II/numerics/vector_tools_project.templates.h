@@ -183,6 +183,66 @@ namespace VectorTools
       AssertDimension(dof.get_fe(0).n_components(), function.n_components);
       AssertDimension(dof.get_fe(0).n_components(), components);
 
+      // For discontinuous tensor-product elements without constraints, the
+      // mass matrix is block-diagonal and its inverse can be applied cell by
+      // cell with the tensor-product kernels of CellwiseInverseMassMatrix.
+      // This gives the projection directly, without an iterative solver.
+      if (constraints.n_constraints() == 0 &&
+          dof.get_triangulation().all_reference_cells_are_hyper_cube() &&
+          dynamic_cast<const FE_DGQ<dim, spacedim> *>(
+            &dof.get_fe(0).base_element(0)) != nullptr)
+        {
+          typename MatrixFree<dim, Number>::AdditionalData additional_data;
+          additional_data.tasks_parallel_scheme =
+            MatrixFree<dim, Number>::AdditionalData::partition_color;
+          additional_data.mapping_update_flags =
+            (update_values | update_JxW_values);
+          MatrixFree<dim, Number> matrix_free;
+          matrix_free.reinit(mapping,
+                             dof,
+                             constraints,
+                             QGauss<dim>(dof.get_fe().degree + 1),
+                             additional_data);
+
+          // the inverse tensor-product kernels need symmetric 1d bases
+          if (matrix_free.get_shape_info().element_type <=
+              dealii::internal::MatrixFreeFunctions::
+                tensor_symmetric_no_collocation)
+            {
+              LinearAlgebra::distributed::Vector<Number> rhs;
+              matrix_free.initialize_dof_vector(work_result);
+              matrix_free.initialize_dof_vector(rhs);
+              create_right_hand_side(
+                mapping, dof, quadrature, function, rhs, constraints);
+
+              matrix_free.template cell_loop<
+                LinearAlgebra::distributed::Vector<Number>,
+                LinearAlgebra::distributed::Vector<Number>>(
+                [](const MatrixFree<dim, Number> &              matrix_free,
+                   LinearAlgebra::distributed::Vector<Number> & dst,
+                   const LinearAlgebra::distributed::Vector<Number> &src,
+                   const std::pair<unsigned int, unsigned int> &range) {
+                  FEEvaluation<dim, -1, 0, components, Number> phi(
+                    matrix_free, range);
+                  MatrixFreeOperators::
+                    CellwiseInverseMassMatrix<dim, -1, components, Number>
+                      inverse_mass(phi);
+                  for (unsigned int cell = range.first; cell < range.second;
+                       ++cell)
+                    {
+                      phi.reinit(cell);
+                      phi.read_dof_values(src);
+                      inverse_mass.apply(phi.begin_dof_values(),
+                                         phi.begin_dof_values());
+                      phi.set_dof_values(dst);
+                    }
+                },
+                work_result,
+                rhs);
+              return;
+            }
+        }
+
       Quadrature<dim> quadrature_mf;
 
       if (dof.get_fe(0).reference_cell() ==
@@ -130,6 +130,50 @@ namespace Particles
       data_component_interpretations;
   };
 
+  /**
+   * Collectively write the particles stored by @p particles on all
+   * processes of @p comm into the single vtu file @p filename, using MPI I/O
+   * in the same way as DataOutInterface::write_vtu_in_parallel(). The output
+   * is the same as that of DataOut::build_patches() followed by
+   * DataOut::write_vtu_in_parallel(), but the positions, ids, and properties
+   * of the particles are copied directly into the arrays that are written,
+   * without creating a DataOutBase::Patch object for every particle. The
+   * memory needed for the output is hence proportional to the amount of
+   * data written, which makes this function the preferred way to write
+   * large numbers of particles.
+   *
+   * @param [in] particles The particles to be written.
+   * @param [in] filename The name of the vtu file.
+   * @param [in] comm The communicator of the processes that own particles.
+   * @param [in] data_component_names The names of the particle properties
+   * to be written. Only the particle ids are written if this vector is
+   * empty.
+   * @param [in] data_component_interpretations A vector that controls if the
+   * particle properties are interpreted as scalars, vectors, or tensors. Has
+   * to be of the same length as @p data_component_names.
+   * @param [in] property_indices The indices of the properties to be written,
+   * which makes it possible to write only a subset of the properties of the
+   * particles. The entry <code>property_indices[i]</code> is the property
+   * with the name <code>data_component_names[i]</code>. If this vector is
+   * empty, the first <code>data_component_names.size()</code> properties
+   * are written.
+   * @param [in] flags The flags controlling the vtu output, e.g., the
+   * compression level.
+   *
+   * @ingroup Particle
+   */
+  template <int dim, int spacedim>
+  void
+  write_vtu_in_parallel(
+    const Particles::ParticleHandler<dim, spacedim> &particles,
+    const std::string &                              filename,
+    const MPI_Comm &                                 comm,
+    const std::vector<std::string> &data_component_names = {},
+    const std::vector<DataComponentInterpretation::DataComponentInterpretation>
+      &                              data_component_interpretations = {},
+    const std::vector<unsigned int> &property_indices               = {},
+    const DataOutBase::VtkFlags &    flags = DataOutBase::VtkFlags());
+
 } // namespace Particles
 
 DEAL_II_NAMESPACE_CLOSE
@@ -156,7 +156,11 @@ namespace Particles
      * select cells randomly based on the probability density function and the
      * cell size
      * (if option @p random_cell_selection set to true). In either case the position of
-     * individual particles inside the cell is computed randomly.
+     * individual particles inside the cell is computed randomly. The
+     * positions are computed in parallel over the cells, using a random
+     * number generator per cell that is seeded with @p random_number_seed,
+     * the MPI rank, and the index of the cell, so that the result does not
+     * depend on the number of threads.
      *
      * The algorithm implemented in the function is described in
      * @cite GLHPW2018.
@@ -0,0 +1,207 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+#ifndef dealii_particles_neighbor_list_h
+#define dealii_particles_neighbor_list_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/point.h>
+#include <deal.II/base/smartpointer.h>
+
+#include <deal.II/particles/particle_handler.h>
+
+#include <unordered_map>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace Particles
+{
+  /**
+   * A list of the neighbors of all locally owned particles of a
+   * ParticleHandler, i.e., of the particles whose distance is smaller than a
+   * given cutoff radius, as needed for short-range particle-particle
+   * interactions in methods like the discrete element method (DEM) or
+   * smoothed particle hydrodynamics (SPH).
+   *
+   * The list is built from the particles grouped by cells: The particles of
+   * each cell are enclosed in a bounding box, and the boxes are stored in an
+   * RTree. For the particles of a locally owned cell, only the particles of
+   * those cells are tested whose boxes are closer than the cutoff radius.
+   * The cells are processed in parallel. Ghost particles, which have to be
+   * created beforehand with ParticleHandler::exchange_ghost_particles(), are
+   * considered as neighbors, but no neighbors are computed for them. In
+   * parallel computations, the list is hence only complete if the cutoff
+   * radius is smaller than the width of the layer of ghost cells.
+   *
+   * The neighbors of a particle are identified by their ids, which, unlike
+   * the memory locations of the particles, do not change when the particles
+   * are sorted into cells or their data is reordered. The list therefore
+   * stays valid as long as the particles do not move too far. To reduce the
+   * number of times the list is built, it contains all pairs of particles
+   * closer than the cutoff radius plus a @p skin distance, as in the
+   * Verlet list technique of molecular dynamics. As long as no particle has
+   * moved farther than half of the skin distance since the list has been
+   * built, all pairs of particles closer than the cutoff radius are
+   * contained in the list. needs_rebuild() checks this condition, and
+   * update() rebuilds the list only if it is violated. A typical time loop
+   * looks like this:
+   * @code
+   *   particle_handler.exchange_ghost_particles();
+   *   Particles::NeighborList<dim> neighbor_list(particle_handler,
+   *                                              cutoff_radius,
+   *                                              0.2 * cutoff_radius);
+   *   for (unsigned int step = 0; step < n_steps; ++step)
+   *     {
+   *       for (const auto &particle : particle_handler)
+   *         for (const types::particle_index neighbor :
+   *              neighbor_list.get_neighbors(particle.get_id()))
+   *           {
+   *             // compute the interaction of the particle with the
+   *             // neighbor, after checking the actual distance
+   *           }
+   *
+   *       move_particles(particle_handler);
+   *       particle_handler.exchange_ghost_particles();
+   *       neighbor_list.update();
+   *     }
+   * @endcode
+   *
+   * @ingroup Particle
+   */
+  template <int dim, int spacedim = dim>
+  class NeighborList
+  {
+  public:
+    /**
+     * Default constructor. Call reinit() before using the object.
+     */
+    NeighborList();
+
+    /**
+     * Constructor. Build the list of the neighbors of the particles of
+     * @p particle_handler, see reinit().
+     */
+    NeighborList(const ParticleHandler<dim, spacedim> &particle_handler,
+                 const double                          cutoff_radius,
+                 const double                          skin = 0.);
+
+    /**
+     * Build the list of all pairs of particles of @p particle_handler whose
+     * distance is smaller than @p cutoff_radius plus @p skin. The particle
+     * handler must stay alive as long as this object is used.
+     */
+    void
+    reinit(const ParticleHandler<dim, spacedim> &particle_handler,
+           const double                          cutoff_radius,
+           const double                          skin = 0.);
+
+    /**
+     * Build the list anew for the current locations of the particles.
+     */
+    void
+    rebuild();
+
+    /**
+     * Return whether the list needs to be rebuilt, i.e., whether a particle
+     * has moved farther than half of the skin distance since the list has
+     * been built, or whether particles have been added or removed.
+     */
+    bool
+    needs_rebuild() const;
+
+    /**
+     * Rebuild the list if needs_rebuild() returns true. Return whether the
+     * list has been rebuilt.
+     */
+    bool
+    update();
+
+    /**
+     * Return the ids of the neighbors of the locally owned particle with the
+     * id @p particle_id, i.e., of all locally owned and ghost particles other
+     * than the particle itself that were closer than the cutoff radius plus
+     * the skin distance when the list was built.
+     */
+    ArrayView<const types::particle_index>
+    get_neighbors(const types::particle_index particle_id) const;
+
+    /**
+     * Return the number of locally owned particles in the list.
+     */
+    unsigned int
+    n_particles() const;
+
+    /**
+     * Return the total number of neighbors of all locally owned particles.
+     */
+    std::size_t
+    n_neighbors() const;
+
+  private:
+    /**
+     * The particles whose neighbors are stored.
+     */
+    SmartPointer<const ParticleHandler<dim, spacedim>,
+                 NeighborList<dim, spacedim>>
+      particle_handler;
+
+    /**
+     * The radius of the neighborhood of each particle.
+     */
+    double cutoff_radius;
+
+    /**
+     * The additional distance by which the neighborhoods are enlarged.
+     */
+    double skin;
+
+    /**
+     * The number of locally owned particles when the list was built.
+     */
+    unsigned int n_locally_owned_particles;
+
+    /**
+     * A map from the ids of the locally owned and the ghost particles to
+     * their index in #build_locations. The locally owned particles come
+     * first, so that the index of a locally owned particle is also its row
+     * in #row_starts.
+     */
+    std::unordered_map<types::particle_index, unsigned int> particle_indices;
+
+    /**
+     * The locations of the particles when the list was built.
+     */
+    std::vector<Point<spacedim>> build_locations;
+
+    /**
+     * The start of the neighbors of each locally owned particle in
+     * #neighbor_ids.
+     */
+    std::vector<std::size_t> row_starts;
+
+    /**
+     * The ids of the neighbors of all locally owned particles.
+     */
+    std::vector<types::particle_index> neighbor_ids;
+  };
+
+} // namespace Particles
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -81,6 +81,36 @@ namespace Particles
     using particle_container =
       typename ParticleAccessor<dim, spacedim>::particle_container;
 
+    /**
+     * A view of the data of all particles in one cell in the form of a
+     * structure of arrays, as returned by get_particle_data_in_cell(). The
+     * entries of the arrays refer to the particles in the order of
+     * particles_in_cell().
+     */
+    struct ParticleDataInCell
+    {
+      /**
+       * The locations of the particles.
+       */
+      ArrayView<Point<spacedim>> locations;
+
+      /**
+       * The reference locations of the particles.
+       */
+      ArrayView<Point<dim>> reference_locations;
+
+      /**
+       * The properties of the particles, with the n_properties entries of
+       * one particle stored next to each other.
+       */
+      ArrayView<double> properties;
+
+      /**
+       * The number of properties per particle.
+       */
+      unsigned int n_properties;
+    };
+
     /**
      * Default constructor.
      */
@@ -259,6 +289,48 @@ namespace Particles
       const typename Triangulation<dim, spacedim>::active_cell_iterator &cell)
       const;
 
+    /**
+     * Return whether the data of the particles in the given cell is stored
+     * in consecutive slots of the property pool, which is the requirement
+     * for get_particle_data_in_cell(). This is the case for all cells after
+     * sort_particles_into_subdomains_and_cells() or
+     * sort_particle_data_by_cell() have been called, until particles are
+     * inserted, removed, or exchanged.
+     */
+    bool
+    has_contiguous_particle_data(
+      const typename Triangulation<dim, spacedim>::active_cell_iterator &cell)
+      const;
+
+    /**
+     * Return views of the locations, reference locations, and properties of
+     * all particles in the given cell as contiguous arrays. In contrast to
+     * a loop over particles_in_cell(), which accesses the data of one
+     * particle at a time through a ParticleAccessor, this allows kernels
+     * that advect particles or interpolate fields to the particles to work
+     * on arrays and be vectorized by the compiler.
+     *
+     * The data can be modified through the returned views. If the locations
+     * of particles are changed, sort_particles_into_subdomains_and_cells()
+     * needs to be called afterwards, as for ParticleAccessor::set_location().
+     *
+     * @pre has_contiguous_particle_data() returns true for @p cell.
+     */
+    ParticleDataInCell
+    get_particle_data_in_cell(
+      const typename Triangulation<dim, spacedim>::active_cell_iterator &cell);
+
+    /**
+     * Reorder the data of all particles in the property pool in the order of
+     * the cells, such that the data of the particles in each cell is stored
+     * contiguously, see has_contiguous_particle_data(). This function is
+     * called at the end of sort_particles_into_subdomains_and_cells() and
+     * only needs to be called explicitly if particles have been inserted or
+     * removed afterwards.
+     */
+    void
+    sort_particle_data_by_cell();
+
     /**
      * Remove a particle pointed to by the iterator. Note that @p particle
      * and all iterators that point to other particles in the same cell
@@ -717,6 +789,22 @@ namespace Particles
     void
     sort_particles_into_subdomains_and_cells();
 
+    /**
+     * Like the function above, but only find new cells for the particles
+     * in @p particles_out_of_cell, which are typically the particles that
+     * have left their cells after a change of their locations. All other
+     * locally owned particles must still be located in their current cells
+     * and have up-to-date reference locations, as is the case after
+     * Particles::Utilities::advect_particles(). Since the reference
+     * locations of the other particles do not need to be recomputed, this
+     * function is considerably cheaper than the one above if only a small
+     * fraction of the particles changes cells. Like the function above,
+     * this function needs to be called on all processes.
+     */
+    void
+    sort_particles_into_subdomains_and_cells(
+      const std::vector<particle_iterator> &particles_out_of_cell);
+
     /**
      * Exchange all particles that live in cells that are ghost cells to
      * other processes. Clears and re-populates the ghost_neighbors
@@ -735,6 +823,54 @@ namespace Particles
     void
     update_ghost_particles();
 
+    /**
+     * Options for the transfer of the locations of the ghost particles in
+     * update_ghost_particles(const std::vector<unsigned int> &,
+     * const GhostLocationUpdate).
+     */
+    enum class GhostLocationUpdate
+    {
+      /**
+       * Do not update the locations of the ghost particles.
+       */
+      none,
+      /**
+       * Send the locations in double precision.
+       */
+      full,
+      /**
+       * Send the change of the locations since the last update in single
+       * precision. The receiving processes add this change to the current
+       * location of their ghost particles. The sending process keeps track
+       * of the locations as they are known to the receiving processes, so
+       * that the rounding errors of subsequent updates do not accumulate.
+       * The first update after the ghost particles have been exchanged or
+       * updated in another way sends the full locations.
+       */
+      single_precision_delta
+    };
+
+    /**
+     * Like update_ghost_particles(), but only send the properties with the
+     * indices given in @p property_indices and update the locations as
+     * specified by @p location_update. This reduces the amount of data that
+     * is communicated in applications where only some of the properties,
+     * e.g., the velocities, change between updates. Data registered with
+     * register_additional_store_load_functions() is not transferred.
+     *
+     * The communication uses persistent MPI requests that are set up at the
+     * first call and re-used as long as the ghost particles have not been
+     * exchanged again and the amount of data per particle does not change.
+     *
+     * As update_ghost_particles(), this function requires that
+     * exchange_ghost_particles() has been called with the ghost cache
+     * enabled.
+     */
+    void
+    update_ghost_particles(const std::vector<unsigned int> &property_indices,
+                           const GhostLocationUpdate        location_update =
+                             GhostLocationUpdate::full);
+
     /**
      * This function prepares the particle handler for a coarsening and
      * refinement cycle, by storing the necessary information to transfer
@@ -747,6 +883,36 @@ namespace Particles
     void
     prepare_for_coarsening_and_refinement();
 
+    /**
+     * Return the computational load of @p cell due to the particles it
+     * contains, namely @p particle_weight times the number of particles,
+     * in the form expected by the Triangulation::Signals::weight signal.
+     * If @p cell is going to be coarsened, the particles of all of its
+     * children are counted. If it is going to be refined, the function is
+     * called once for each future child with the parent @p cell, and the
+     * particles of the parent are distributed evenly among the children.
+     */
+    unsigned int
+    cell_weight(
+      const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+      const typename Triangulation<dim, spacedim>::CellStatus     status,
+      const unsigned int particle_weight) const;
+
+    /**
+     * Let the particles contribute to the cell weights used for the
+     * repartitioning of the triangulation. Once this function has been
+     * called with a nonzero @p particle_weight, the particle handler
+     * connects cell_weight() to the Triangulation::Signals::weight signal
+     * of its triangulation, so that each particle adds @p particle_weight
+     * to the weight of its cell. This replaces the function that
+     * applications like step-68 connect to the signal by hand. The weights
+     * are added to those of other functions connected to the signal, e.g.,
+     * by parallel::CellWeights. A @p particle_weight of zero disconnects
+     * the particle handler from the signal.
+     */
+    void
+    set_particle_weight(const unsigned int particle_weight);
+
     /**
      * This function unpacks the particle data after a coarsening and
      * refinement cycle, by reading the necessary information to transfer
@@ -1083,6 +1249,18 @@ namespace Particles
       const std::map<types::subdomain_id, std::vector<particle_iterator>>
         &particles_to_send);
 
+    /**
+     * Transfer the locations and the properties with the indices in
+     * @p property_indices of the ghost particles, assuming that the
+     * particles have not changed cells. This is the implementation of
+     * update_ghost_particles(const std::vector<unsigned int> &,
+     * const GhostLocationUpdate).
+     */
+    void
+    send_recv_particles_properties_subset(
+      const std::vector<unsigned int> &property_indices,
+      const GhostLocationUpdate        location_update);
+
 #endif
 
     /**
@@ -1106,6 +1284,12 @@ namespace Particles
      */
     std::vector<boost::signals2::connection> tria_listeners;
 
+    /**
+     * The weight of a particle for the repartitioning of the
+     * triangulation, see set_particle_weight().
+     */
+    unsigned int particle_weight;
+
     /**
      * Function that gets called by the triangulation signals if
      * the structure of the mesh has changed. This function is
@@ -18,8 +18,13 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/mpi_stub.h>
+#include <deal.II/base/point.h>
+
 #include <deal.II/particles/particle_iterator.h>
 
+#include <memory>
+
 DEAL_II_NAMESPACE_OPEN
 
 namespace Particles
@@ -111,6 +116,55 @@ namespace Particles
        * send_recv_particles_properties_and_location()
        */
       std::vector<char> recv_data;
+
+      /**
+       * Number of particles sent to (or received from) each of the
+       * neighbors, used by the update of a subset of the particle data in
+       * ParticleHandler::update_ghost_particles().
+       */
+      std::vector<unsigned int> n_send_particles;
+
+      /**
+       * Number of particles received from each of the neighbors.
+       */
+      std::vector<unsigned int> n_recv_particles;
+
+      /**
+       * Send buffer of the update of a subset of the particle data.
+       */
+      std::vector<char> subset_send_data;
+
+      /**
+       * Receive buffer of the update of a subset of the particle data.
+       */
+      std::vector<char> subset_recv_data;
+
+      /**
+       * The locations of the sent particles, in the order in which they are
+       * sent, as they are known to the receiving processes. These are the
+       * reference for sending the change of the locations only.
+       */
+      std::vector<Point<spacedim>> sent_locations;
+
+      /**
+       * Indicates if #sent_locations agrees with the locations of the ghost
+       * particles on the receiving processes.
+       */
+      bool sent_locations_valid = false;
+
+      /**
+       * Persistent MPI requests for the update of a subset of the particle
+       * data, first those of the receive and then those of the send
+       * operations. They operate on #subset_send_data and #subset_recv_data
+       * and are freed when the last copy of the pointer is destroyed.
+       */
+      std::shared_ptr<std::vector<MPI_Request>> persistent_requests;
+
+      /**
+       * The number of bytes per particle the #persistent_requests have been
+       * set up for.
+       */
+      unsigned int persistent_requests_bytes_per_particle = 0;
     };
   } // namespace internal
 
@@ -198,6 +198,37 @@ namespace Particles
     ArrayView<double>
     get_properties(const Handle handle);
 
+    /**
+     * Return an ArrayView to the locations of the @p n_handles particles
+     * with the consecutive handles starting at @p first_handle. Since the
+     * locations are stored in a separate array indexed by the handles, this
+     * gives direct access to the data in the form of a structure of arrays,
+     * which allows loops over the particles to be vectorized. The handles of
+     * the particles in one cell are consecutive after
+     * ParticleHandler::sort_particle_data_by_cell() has been called.
+     */
+    ArrayView<Point<spacedim>>
+    get_locations(const Handle first_handle, const unsigned int n_handles);
+
+    /**
+     * Return an ArrayView to the reference locations of the @p n_handles
+     * particles with the consecutive handles starting at @p first_handle, see
+     * get_locations().
+     */
+    ArrayView<Point<dim>>
+    get_reference_locations(const Handle       first_handle,
+                            const unsigned int n_handles);
+
+    /**
+     * Return an ArrayView to the properties of the @p n_handles particles
+     * with the consecutive handles starting at @p first_handle, see
+     * get_locations(). The view contains n_properties_per_slot() entries per
+     * particle, with the properties of one particle stored next to each
+     * other.
+     */
+    ArrayView<double>
+    get_properties(const Handle first_handle, const unsigned int n_handles);
+
     /**
      * Reserve the dynamic memory needed for storing the properties of
      * @p size particles.
@@ -448,6 +479,53 @@ namespace Particles
 
 
 
+  template <int dim, int spacedim>
+  inline ArrayView<Point<spacedim>>
+  PropertyPool<dim, spacedim>::get_locations(const Handle       first_handle,
+                                             const unsigned int n_handles)
+  {
+    if (n_handles == 0)
+      return ArrayView<Point<spacedim>>();
+
+    AssertIndexRange(first_handle + n_handles, locations.size() + 1);
+    return ArrayView<Point<spacedim>>(locations.data() + first_handle,
+                                      n_handles);
+  }
+
+
+
+  template <int dim, int spacedim>
+  inline ArrayView<Point<dim>>
+  PropertyPool<dim, spacedim>::get_reference_locations(
+    const Handle       first_handle,
+    const unsigned int n_handles)
+  {
+    if (n_handles == 0)
+      return ArrayView<Point<dim>>();
+
+    AssertIndexRange(first_handle + n_handles, reference_locations.size() + 1);
+    return ArrayView<Point<dim>>(reference_locations.data() + first_handle,
+                                 n_handles);
+  }
+
+
+
+  template <int dim, int spacedim>
+  inline ArrayView<double>
+  PropertyPool<dim, spacedim>::get_properties(const Handle       first_handle,
+                                              const unsigned int n_handles)
+  {
+    if (n_handles == 0 || n_properties == 0)
+      return ArrayView<double>();
+
+    AssertIndexRange((first_handle + n_handles) * n_properties,
+                     properties.size() + 1);
+    return ArrayView<double>(properties.data() + first_handle * n_properties,
+                             n_handles * n_properties);
+  }
+
+
+
   template <int dim, int spacedim>
   inline unsigned int
   PropertyPool<dim, spacedim>::n_slots() const
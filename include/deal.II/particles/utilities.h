@@ -19,19 +19,25 @@
 #include <deal.II/base/config.h>
 
 #include <deal.II/base/index_set.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/point.h>
 #include <deal.II/base/quadrature.h>
+#include <deal.II/base/work_stream.h>
 
 #include <deal.II/dofs/dof_handler.h>
 
 #include <deal.II/fe/component_mask.h>
 #include <deal.II/fe/fe.h>
+#include <deal.II/fe/mapping.h>
 
 #include <deal.II/grid/grid_tools_cache.h>
 
 #include <deal.II/lac/affine_constraints.h>
 #include <deal.II/lac/sparsity_pattern_base.h>
 
+#include <deal.II/matrix_free/evaluation_flags.h>
+#include <deal.II/matrix_free/fe_point_evaluation.h>
+
 #include <deal.II/particles/particle_handler.h>
 
 
@@ -248,6 +254,550 @@ namespace Particles
       interpolated_field.compress(VectorOperation::add);
     }
 
+
+
+    /**
+     * Given a DoFHandler and a particle handler, interpolate several vectors
+     * representing fields defined on the DoFHandler to the positions of the
+     * particles. This function computes the same result as the function
+     * above for each pair of `field_vectors[f]` and
+     * `interpolated_fields[f]`, but is designed for the case of many
+     * particles:
+     * - The evaluation is done with FEPointEvaluation, which for tensor
+     *   product elements such as FE_Q or FE_DGQ (also within an FESystem)
+     *   evaluates the solution by sum factorization for batches of
+     *   VectorizedArray::size() particles at once rather than computing every
+     *   shape function in every particle location.
+     * - The mapping data of a cell is computed only once by
+     *   FEPointEvaluation::reinit() and then re-used for all fields.
+     * - The cells are processed in parallel with parallel::apply_to_subranges,
+     *   each task working on its own FEPointEvaluation object. The results
+     *   are written into the output vectors sequentially after the parallel
+     *   loop, so that @p OutputVectorType need not be thread-safe.
+     *
+     * Since the input vectors are read by several threads at once,
+     * @p InputVectorType must support concurrent read access, as is the case
+     * for the vector classes of deal.II.
+     *
+     * @tparam n_components The number of vector components to interpolate,
+     * starting at @p first_selected_component.
+     *
+     * @param[in] mapping The mapping used to compute the geometry data of
+     * FEPointEvaluation.
+     *
+     * @param[in] field_dh The DoF Handler which was used to generate the
+     * field vectors that are to be interpolated.
+     *
+     * @param[in] particle_handler The particle handler whose particles serve as
+     * the interpolation points.
+     *
+     * @param[in] field_vectors The vectors of the fields to be interpolated,
+     * which must be coherent with @p field_dh.
+     *
+     * @param[in,out] interpolated_fields The vectors receiving the
+     * interpolated values of the corresponding entry of @p field_vectors at
+     * the position of the particles. As for the function above, the value of
+     * component `c` of the particle with id `id` is added to the entry
+     * `id * n_components + c`.
+     *
+     * @param[in] first_selected_component The first component of the finite
+     * element of @p field_dh to be interpolated.
+     */
+    template <int n_components,
+              int dim,
+              typename InputVectorType,
+              typename OutputVectorType>
+    void
+    interpolate_field_on_particles(
+      const Mapping<dim> &                        mapping,
+      const DoFHandler<dim> &                     field_dh,
+      const Particles::ParticleHandler<dim> &     particle_handler,
+      const std::vector<const InputVectorType *> &field_vectors,
+      const std::vector<OutputVectorType *> &     interpolated_fields,
+      const unsigned int                          first_selected_component = 0)
+    {
+      AssertDimension(field_vectors.size(), interpolated_fields.size());
+      const unsigned int n_fields = field_vectors.size();
+
+      const auto &fe = field_dh.get_fe();
+      AssertIndexRange(first_selected_component + n_components,
+                       fe.n_components() + 1);
+      for (unsigned int f = 0; f < n_fields; ++f)
+        {
+          AssertDimension(field_vectors[f]->size(), field_dh.n_dofs());
+          AssertDimension(interpolated_fields[f]->size(),
+                          particle_handler.get_next_free_particle_index() *
+                            n_components);
+        }
+
+      // Gather the cells with particles and the ids and reference locations
+      // of their particles into contiguous arrays
+      const unsigned int n_particles =
+        particle_handler.n_locally_owned_particles();
+      std::vector<typename Triangulation<dim>::active_cell_iterator> cells;
+      std::vector<unsigned int>         first_particle_of_cell;
+      std::vector<types::particle_index> particle_ids;
+      std::vector<Point<dim>>            reference_locations;
+      particle_ids.reserve(n_particles);
+      reference_locations.reserve(n_particles);
+
+      auto particle = particle_handler.begin();
+      while (particle != particle_handler.end())
+        {
+          const auto cell = particle->get_surrounding_cell();
+          const auto pic  = particle_handler.particles_in_cell(cell);
+
+          Assert(pic.begin() == particle, ExcInternalError());
+          cells.push_back(cell);
+          first_particle_of_cell.push_back(particle_ids.size());
+          for (; particle != pic.end(); ++particle)
+            {
+              particle_ids.push_back(particle->get_id());
+              reference_locations.push_back(particle->get_reference_location());
+            }
+        }
+      first_particle_of_cell.push_back(particle_ids.size());
+
+      // Evaluate all fields in the particle locations, cell by cell
+      std::vector<double> values(n_fields * particle_ids.size() *
+                                 n_components);
+      const auto evaluate_on_cells = [&](const unsigned int begin,
+                                         const unsigned int end) {
+        FEPointEvaluation<n_components, dim> evaluator(
+          mapping, fe, update_values, first_selected_component);
+        std::vector<double> local_values(fe.n_dofs_per_cell());
+
+        for (unsigned int c = begin; c < end; ++c)
+          {
+            const unsigned int first = first_particle_of_cell[c];
+            const unsigned int n_particles_in_cell =
+              first_particle_of_cell[c + 1] - first;
+            evaluator.reinit(cells[c],
+                             make_array_view(reference_locations.data() +
+                                               first,
+                                             reference_locations.data() +
+                                               first + n_particles_in_cell));
+
+            const typename DoFHandler<dim>::cell_iterator dh_cell(*cells[c],
+                                                                  &field_dh);
+            for (unsigned int f = 0; f < n_fields; ++f)
+              {
+                dh_cell->get_dof_values(*field_vectors[f],
+                                        local_values.begin(),
+                                        local_values.end());
+                evaluator.evaluate(make_array_view(local_values),
+                                   EvaluationFlags::values);
+
+                double *field_values =
+                  values.data() + (f * particle_ids.size() + first) *
+                                    n_components;
+                for (unsigned int q = 0; q < n_particles_in_cell; ++q)
+                  for (unsigned int d = 0; d < n_components; ++d)
+                    field_values[q * n_components + d] =
+                      dealii::internal::FEPointEvaluation::
+                        EvaluatorTypeTraits<dim, n_components, double>::access(
+                          evaluator.get_value(q), d);
+              }
+          }
+      };
+      parallel::apply_to_subranges(0U, cells.size(), evaluate_on_cells, 16);
+
+      // Write the results into the output vectors
+      for (unsigned int f = 0; f < n_fields; ++f)
+        {
+          const double *field_values =
+            values.data() + f * particle_ids.size() * n_components;
+          for (unsigned int i = 0; i < particle_ids.size(); ++i)
+            for (unsigned int d = 0; d < n_components; ++d)
+              (*interpolated_fields[f])[particle_ids[i] * n_components + d] +=
+                field_values[i * n_components + d];
+          interpolated_fields[f]->compress(VectorOperation::add);
+        }
+    }
+
+
+
+
+    namespace internal
+    {
+      /**
+       * Scratch data for deposit_particle_properties_on_field(). Since
+       * FEPointEvaluation cannot be copied, the copy constructor creates a
+       * new evaluator from the same mapping and finite element.
+       */
+      template <int n_components, int dim>
+      struct DepositionScratchData
+      {
+        DepositionScratchData(const Mapping<dim> &      mapping,
+                              const FiniteElement<dim> &fe,
+                              const unsigned int first_selected_component)
+          : mapping(mapping)
+          , fe(fe)
+          , first_selected_component(first_selected_component)
+          , evaluator(mapping, fe, update_values, first_selected_component)
+        {}
+
+        DepositionScratchData(const DepositionScratchData &scratch_data)
+          : DepositionScratchData(scratch_data.mapping,
+                                  scratch_data.fe,
+                                  scratch_data.first_selected_component)
+        {}
+
+        const Mapping<dim> &                 mapping;
+        const FiniteElement<dim> &           fe;
+        const unsigned int                   first_selected_component;
+        FEPointEvaluation<n_components, dim> evaluator;
+        std::vector<Point<dim>>              reference_locations;
+      };
+
+      /**
+       * Copy data for deposit_particle_properties_on_field(), holding the
+       * contributions of the particles of one cell.
+       */
+      struct DepositionCopyData
+      {
+        std::vector<double>                  local_values;
+        std::vector<types::global_dof_index> dof_indices;
+      };
+    } // namespace internal
+
+
+
+    /**
+     * Deposit particle quantities onto a finite element field, as needed
+     * for the charge or mass deposition of particle-in-cell methods. For
+     * each particle $p$ at the location $x_p$ with the properties
+     * $q_p$ (the @p n_components properties starting at @p first_property),
+     * this function adds
+     * \f[
+     * F_i \mathrel{+}= \sum_p \varphi_i(x_p) \cdot q_p
+     * \f]
+     * to @p field_vector, where $\varphi_i$ are the shape functions of the
+     * @p n_components vector components of the finite element of @p field_dh
+     * starting at @p first_selected_component. This is the right-hand side
+     * of the $L_2$ projection of the point measures $\sum_p q_p
+     * \delta(x-x_p)$ onto the finite element space, so a projection of the
+     * particle quantities is obtained by solving a system with the mass
+     * matrix afterwards.
+     *
+     * The contributions of the particles of a cell are computed with
+     * FEPointEvaluation::integrate(), which works on batches of particles
+     * with VectorizedArray for tensor product elements. The cells are
+     * processed in parallel with WorkStream::run(), which adds the
+     * contributions of the cells into @p field_vector one at a time, so no
+     * two threads write into the vector at the same time. Contributions to
+     * ghost entries are sent to their owners by a call to
+     * `field_vector.compress(VectorOperation::add)` at the end, so
+     * @p field_vector is typically a LinearAlgebra::distributed::Vector
+     * with the locally relevant DoFs as ghost entries. The vector is not
+     * zeroed by this function.
+     *
+     * @param[in] mapping The mapping used to compute the geometry data of
+     * FEPointEvaluation.
+     *
+     * @param[in] field_dh The DoF handler of the field.
+     *
+     * @param[in] particle_handler The particle handler whose particles carry
+     * the quantities to be deposited.
+     *
+     * @param[in,out] field_vector The vector the contributions are added to.
+     *
+     * @param[in] constraints The constraints used to distribute the local
+     * contributions into @p field_vector.
+     *
+     * @param[in] first_property The index of the first of the @p n_components
+     * particle properties to be deposited.
+     *
+     * @param[in] first_selected_component The first component of the finite
+     * element of @p field_dh that receives the particle quantities.
+     */
+    template <int n_components, int dim, typename VectorType>
+    void
+    deposit_particle_properties_on_field(
+      const Mapping<dim> &                   mapping,
+      const DoFHandler<dim> &                field_dh,
+      const Particles::ParticleHandler<dim> &particle_handler,
+      VectorType &                           field_vector,
+      const AffineConstraints<typename VectorType::value_type> &constraints,
+      const unsigned int first_property           = 0,
+      const unsigned int first_selected_component = 0)
+    {
+      const auto &fe = field_dh.get_fe();
+      AssertIndexRange(first_selected_component + n_components,
+                       fe.n_components() + 1);
+      AssertIndexRange(first_property + n_components,
+                       particle_handler.n_properties_per_particle() + 1);
+      AssertDimension(field_vector.size(), field_dh.n_dofs());
+
+      using CellIterator = typename Triangulation<dim>::active_cell_iterator;
+      using ValueType =
+        typename FEPointEvaluation<n_components, dim>::value_type;
+
+      std::vector<CellIterator> cells;
+      for (auto particle = particle_handler.begin();
+           particle != particle_handler.end();)
+        {
+          const auto cell = particle->get_surrounding_cell();
+          cells.push_back(cell);
+          particle = particle_handler.particles_in_cell(cell).end();
+        }
+
+      const auto worker =
+        [&](const typename std::vector<CellIterator>::const_iterator &cell,
+            internal::DepositionScratchData<n_components, dim> &scratch_data,
+            internal::DepositionCopyData &                      copy_data) {
+          const auto particles = particle_handler.particles_in_cell(*cell);
+
+          scratch_data.reference_locations.clear();
+          for (const auto &particle : particles)
+            scratch_data.reference_locations.push_back(
+              particle.get_reference_location());
+
+          auto &evaluator = scratch_data.evaluator;
+          evaluator.reinit(*cell,
+                           make_array_view(scratch_data.reference_locations));
+
+          unsigned int q = 0;
+          for (const auto &particle : particles)
+            {
+              const ArrayView<const double> properties =
+                particle.get_properties();
+              ValueType value;
+              for (unsigned int d = 0; d < n_components; ++d)
+                dealii::internal::FEPointEvaluation::
+                  EvaluatorTypeTraits<dim, n_components, double>::access(
+                    value, d) = properties[first_property + d];
+              evaluator.submit_value(value, q);
+              ++q;
+            }
+
+          copy_data.local_values.resize(fe.n_dofs_per_cell());
+          evaluator.integrate(make_array_view(copy_data.local_values),
+                              EvaluationFlags::values);
+
+          copy_data.dof_indices.resize(fe.n_dofs_per_cell());
+          const typename DoFHandler<dim>::cell_iterator dh_cell(**cell,
+                                                                &field_dh);
+          dh_cell->get_dof_indices(copy_data.dof_indices);
+        };
+
+      const auto copier = [&](const internal::DepositionCopyData &copy_data) {
+        constraints.distribute_local_to_global(copy_data.local_values.begin(),
+                                               copy_data.local_values.end(),
+                                               copy_data.dof_indices.begin(),
+                                               field_vector);
+      };
+
+      WorkStream::run(
+        cells.cbegin(),
+        cells.cend(),
+        worker,
+        copier,
+        internal::DepositionScratchData<n_components, dim>(
+          mapping, fe, first_selected_component),
+        internal::DepositionCopyData());
+
+      field_vector.compress(VectorOperation::add);
+    }
+
+    /**
+     * Move the particles of @p particle_handler by one time step of size
+     * @p time_step in the velocity field @p velocity, which is described by
+     * the components @p first_selected_component to
+     * <code>first_selected_component + dim - 1</code> of the finite element
+     * of @p velocity_dh, and find the new cells of the particles.
+     *
+     * The time step is done with an explicit Runge-Kutta method with
+     * @p n_stages stages, which can be 1 (forward Euler), 2 (explicit
+     * midpoint rule), or 4 (the classical fourth order method). In contrast
+     * to setting new particle locations with
+     * ParticleHandler::set_particle_positions(), which computes the reference
+     * locations of all particles anew by inverting the mapping, the
+     * Runge-Kutta method is applied to the reference locations of the
+     * particles: In each stage, the velocity is evaluated in the reference
+     * locations of the particles with FEPointEvaluation and transformed into
+     * the velocity in reference coordinates with the inverse Jacobian of the
+     * mapping. Hence, the reference and real locations of the particles are
+     * updated together with a fixed amount of arithmetic operations, and a
+     * search for the new cell with
+     * ParticleHandler::sort_particles_into_subdomains_and_cells() is only
+     * performed for the particles that end up outside the reference cell.
+     * For a MappingQCache, the mapping data used in each stage is computed
+     * from the cached support points of the cells.
+     *
+     * The stages of particles close to the boundary of their cell may lie
+     * slightly outside the cell, where both the velocity and the mapping are
+     * extrapolated. The resulting error is of the order of the error of the
+     * time stepping method for smooth velocity fields and mappings.
+     *
+     * The cells are processed in parallel, and the function needs to be
+     * called on all processes, since particles may move to other processes.
+     *
+     * @param[in] mapping The mapping of the triangulation of the particles.
+     *
+     * @param[in] velocity_dh The DoFHandler describing @p velocity.
+     *
+     * @param[in] velocity The vector of the velocity field, which must
+     * provide access to the degrees of freedom of all locally owned cells.
+     *
+     * @param[in,out] particle_handler The particles to be moved.
+     *
+     * @param[in] time_step The size of the time step.
+     *
+     * @param[in] n_stages The number of stages of the Runge-Kutta method.
+     *
+     * @param[in] first_selected_component The first component of the finite
+     * element of @p velocity_dh that describes the velocity.
+     */
+    template <int dim, typename VectorType>
+    void
+    advect_particles(const Mapping<dim> &             mapping,
+                     const DoFHandler<dim> &          velocity_dh,
+                     const VectorType &               velocity,
+                     Particles::ParticleHandler<dim> &particle_handler,
+                     const double                     time_step,
+                     const unsigned int               n_stages = 2,
+                     const unsigned int first_selected_component = 0)
+    {
+      Assert(n_stages == 1 || n_stages == 2 || n_stages == 4,
+             ExcMessage("Only Runge-Kutta methods with 1, 2, or 4 stages "
+                        "are implemented."));
+      const auto &fe = velocity_dh.get_fe();
+      AssertIndexRange(first_selected_component + dim, fe.n_components() + 1);
+
+      // the coefficients of the explicit methods, where stage s is evaluated
+      // at x + stage_factors[s] * time_step * k_{s-1} and the new location
+      // is x + sum_s weights[s] * time_step * k_s
+      std::vector<double> stage_factors, weights;
+      if (n_stages == 1)
+        {
+          stage_factors = {0.};
+          weights       = {1.};
+        }
+      else if (n_stages == 2)
+        {
+          stage_factors = {0., 0.5};
+          weights       = {0., 1.};
+        }
+      else
+        {
+          stage_factors = {0., 0.5, 0.5, 1.};
+          weights       = {1. / 6., 1. / 3., 1. / 3., 1. / 6.};
+        }
+
+      // Gather the cells with particles and iterators to their particles
+      using particle_iterator =
+        typename Particles::ParticleHandler<dim>::particle_iterator;
+      std::vector<typename Triangulation<dim>::active_cell_iterator> cells;
+      std::vector<unsigned int>      first_particle_of_cell;
+      std::vector<particle_iterator> particles;
+      particles.reserve(particle_handler.n_locally_owned_particles());
+
+      auto particle = particle_handler.begin();
+      while (particle != particle_handler.end())
+        {
+          const auto cell = particle->get_surrounding_cell();
+          const auto pic  = particle_handler.particles_in_cell(cell);
+
+          Assert(pic.begin() == particle, ExcInternalError());
+          cells.push_back(cell);
+          first_particle_of_cell.push_back(particles.size());
+          for (; particle != pic.end(); ++particle)
+            particles.push_back(particle);
+        }
+      first_particle_of_cell.push_back(particles.size());
+
+      // Integrate in reference coordinates, cell by cell. Each cell collects
+      // the particles that have left it in a list of its own, so that the
+      // order of the particles to be sorted does not depend on the number
+      // of threads.
+      std::vector<std::vector<particle_iterator>> particles_out_of_cell_by_cell(
+        cells.size());
+      const auto advect_on_cells = [&](const unsigned int begin,
+                                       const unsigned int end) {
+        FEPointEvaluation<dim, dim> evaluator(mapping,
+                                              fe,
+                                              update_values |
+                                                update_inverse_jacobians,
+                                              first_selected_component);
+        std::vector<double>         local_values(fe.n_dofs_per_cell());
+        std::vector<Point<dim>>     old_locations, stage_locations,
+          new_locations;
+        std::vector<Tensor<1, dim>> stage_velocities;
+
+        for (unsigned int c = begin; c < end; ++c)
+          {
+            const unsigned int first = first_particle_of_cell[c];
+            const unsigned int n_particles_in_cell =
+              first_particle_of_cell[c + 1] - first;
+
+            const typename DoFHandler<dim>::cell_iterator dh_cell(*cells[c],
+                                                                  &velocity_dh);
+            dh_cell->get_dof_values(velocity,
+                                    local_values.begin(),
+                                    local_values.end());
+
+            old_locations.resize(n_particles_in_cell);
+            for (unsigned int q = 0; q < n_particles_in_cell; ++q)
+              old_locations[q] = particles[first + q]->get_reference_location();
+            new_locations   = old_locations;
+            stage_locations = old_locations;
+            stage_velocities.resize(n_particles_in_cell);
+
+            for (unsigned int s = 0; s < n_stages; ++s)
+              {
+                if (s > 0)
+                  for (unsigned int q = 0; q < n_particles_in_cell; ++q)
+                    stage_locations[q] =
+                      old_locations[q] +
+                      stage_factors[s] * time_step * stage_velocities[q];
+
+                evaluator.reinit(cells[c], make_array_view(stage_locations));
+                evaluator.evaluate(make_array_view(local_values),
+                                   EvaluationFlags::values);
+
+                // transform the velocity into reference coordinates
+                for (unsigned int q = 0; q < n_particles_in_cell; ++q)
+                  {
+                    Tensor<1, dim> real_velocity;
+                    for (unsigned int d = 0; d < dim; ++d)
+                      real_velocity[d] = dealii::internal::FEPointEvaluation::
+                        EvaluatorTypeTraits<dim, dim, double>::access(
+                          evaluator.get_value(q), d);
+                    stage_velocities[q] =
+                      apply_transformation(evaluator.inverse_jacobian(q),
+                                           real_velocity);
+                    new_locations[q] +=
+                      weights[s] * time_step * stage_velocities[q];
+                  }
+              }
+
+            // compute the new real locations by the mapping of the cell,
+            // and flag the particles that have left the cell
+            evaluator.reinit(cells[c], make_array_view(new_locations));
+            for (unsigned int q = 0; q < n_particles_in_cell; ++q)
+              {
+                particle_iterator p = particles[first + q];
+                p->set_location(evaluator.real_point(q));
+                if (GeometryInfo<dim>::is_inside_unit_cell(new_locations[q]))
+                  p->set_reference_location(new_locations[q]);
+                else
+                  particles_out_of_cell_by_cell[c].push_back(p);
+              }
+          }
+      };
+      parallel::apply_to_subranges(0U, cells.size(), advect_on_cells, 16);
+
+      std::vector<particle_iterator> particles_out_of_cell;
+      for (const auto &particles_of_cell : particles_out_of_cell_by_cell)
+        particles_out_of_cell.insert(particles_out_of_cell.end(),
+                                     particles_of_cell.begin(),
+                                     particles_of_cell.end());
+
+      particle_handler.sort_particles_into_subdomains_and_cells(
+        particles_out_of_cell);
+    }
+
   } // namespace Utilities
 } // namespace Particles
 DEAL_II_NAMESPACE_CLOSE
@@ -361,6 +361,16 @@ namespace SUNDIALS
        *
        * @param absolute_tolerance Absolute error tolerance
        * @param relative_tolerance Relative error tolerance
+       *
+       * Linear solver setup parameters:
+       *
+       * @param maximum_steps_between_linear_solver_setups Maximum number of
+       *   time steps between calls to the linear solver setup
+       * @param maximum_steps_between_jacobian_evaluations Maximum number of
+       *   time steps after which the Jacobian data of the preconditioner is
+       *   recomputed
+       * @param maximum_relative_gamma_change Maximum relative change of
+       *   $\gamma$ before the linear solver setup is called
        */
       AdditionalData(
         // Initial parameters
@@ -378,7 +388,11 @@ namespace SUNDIALS
         const int          anderson_acceleration_subspace        = 3,
         // Error parameters
         const double absolute_tolerance = 1e-6,
-        const double relative_tolerance = 1e-5);
+        const double relative_tolerance = 1e-5,
+        // Linear solver setup parameters
+        const unsigned int maximum_steps_between_linear_solver_setups = 20,
+        const unsigned int maximum_steps_between_jacobian_evaluations = 51,
+        const double       maximum_relative_gamma_change              = 0.2);
 
       /**
        * Add all AdditionalData() parameters to the given ParameterHandler
@@ -466,6 +480,35 @@ namespace SUNDIALS
        * meaningful if the packaged SUNDIALS fixed-point solver is used.
        */
       int anderson_acceleration_subspace;
+
+      /**
+       * The maximum number of time steps between two calls to the setup of
+       * the linear solver, i.e., to jacobian_times_setup() and
+       * jacobian_preconditioner_setup(). In between, the linear solver and
+       * the preconditioner are reused for all stages and nonlinear
+       * iterations. ARKode calls the setup earlier if the nonlinear solver
+       * fails to converge or if $\gamma$ changes too much, see
+       * #maximum_relative_gamma_change. A value of one calls the setup in
+       * every time step, and zero selects the SUNDIALS default.
+       */
+      unsigned int maximum_steps_between_linear_solver_setups;
+
+      /**
+       * The maximum number of time steps after which ARKode asks
+       * jacobian_preconditioner_setup() to recompute the Jacobian data,
+       * i.e., calls it with `jok` set to `SUNFALSE`. In between, the
+       * preconditioner setup may reuse its Jacobian data and only update
+       * it for the current value of $\gamma$. Zero selects the SUNDIALS
+       * default.
+       */
+      unsigned int maximum_steps_between_jacobian_evaluations;
+
+      /**
+       * The maximum relative change of $\gamma$ in $M-\gamma J$, compared
+       * to the value at the last linear solver setup, before the setup is
+       * called again. Zero selects the SUNDIALS default.
+       */
+      double maximum_relative_gamma_change;
     };
 
     /**
@@ -825,6 +868,12 @@ namespace SUNDIALS
      * If the jacobian_preconditioner_setup() function is not provided, then
      * jacobian_preconditioner_solve() should do all the work by itself.
      *
+     * How often ARKode calls this function, and how often it asks for the
+     * Jacobian data to be recomputed via the `jok` argument, is controlled
+     * by AdditionalData::maximum_steps_between_linear_solver_setups,
+     * AdditionalData::maximum_steps_between_jacobian_evaluations, and
+     * AdditionalData::maximum_relative_gamma_change.
+     *
      * @note No assumption is made by this interface on what the user
      *   should do in this function. ARKode only assumes that after a call to
      *   jacobian_preconditioner_setup() it is possible to call
@@ -1110,7 +1159,11 @@ namespace SUNDIALS
     const int          anderson_acceleration_subspace,
     // Error parameters
     const double absolute_tolerance,
-    const double relative_tolerance)
+    const double relative_tolerance,
+    // Linear solver setup parameters
+    const unsigned int maximum_steps_between_linear_solver_setups,
+    const unsigned int maximum_steps_between_jacobian_evaluations,
+    const double       maximum_relative_gamma_change)
     : initial_time(initial_time)
     , final_time(final_time)
     , initial_step_size(initial_step_size)
@@ -1125,6 +1178,11 @@ namespace SUNDIALS
         implicit_function_is_time_independent)
     , mass_is_time_independent(mass_is_time_independent)
     , anderson_acceleration_subspace(anderson_acceleration_subspace)
+    , maximum_steps_between_linear_solver_setups(
+        maximum_steps_between_linear_solver_setups)
+    , maximum_steps_between_jacobian_evaluations(
+        maximum_steps_between_jacobian_evaluations)
+    , maximum_relative_gamma_change(maximum_relative_gamma_change)
   {}
 
 
@@ -1154,6 +1212,14 @@ namespace SUNDIALS
     prm.add_parameter("Absolute error tolerance", absolute_tolerance);
     prm.add_parameter("Relative error tolerance", relative_tolerance);
     prm.leave_subsection();
+    prm.enter_subsection("Linear solver setup");
+    prm.add_parameter("Maximum steps between linear solver setups",
+                      maximum_steps_between_linear_solver_setups);
+    prm.add_parameter("Maximum steps between Jacobian evaluations",
+                      maximum_steps_between_jacobian_evaluations);
+    prm.add_parameter("Maximum relative change of gamma",
+                      maximum_relative_gamma_change);
+    prm.leave_subsection();
   }
 
 } // namespace SUNDIALS
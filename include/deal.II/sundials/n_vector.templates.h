@@ -24,6 +24,7 @@
 #ifdef DEAL_II_WITH_SUNDIALS
 
 #  include <deal.II/base/exceptions.h>
+#  include <deal.II/base/mpi.h>
 
 #  include <deal.II/lac/block_vector.h>
 #  include <deal.II/lac/la_parallel_block_vector.h>
@@ -35,7 +36,9 @@
 #  include <deal.II/lac/trilinos_vector.h>
 #  include <deal.II/lac/vector_memory.h>
 
+#  include <algorithm>
 #  include <limits>
+#  include <type_traits>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -176,6 +179,22 @@ namespace SUNDIALS
       realtype
       dot_product(N_Vector x, N_Vector y);
 
+      template <typename VectorType>
+      int
+      linear_combination(int nv, realtype *c, N_Vector *X, N_Vector z);
+
+      template <typename VectorType>
+      int
+      scale_add_multi(int       nv,
+                      realtype *a,
+                      N_Vector  x,
+                      N_Vector *Y,
+                      N_Vector *Z);
+
+      template <typename VectorType>
+      int
+      dot_product_multi(int nv, N_Vector x, N_Vector *Y, realtype *d);
+
       template <typename VectorType>
       realtype
       weighted_l2_norm(N_Vector x, N_Vector y);
@@ -617,6 +636,366 @@ namespace SUNDIALS
 
 
 
+      /**
+       * A type trait that is true for the vector classes of deal.II that store
+       * the locally owned elements of each block contiguously in memory,
+       * accessible through begin(). For these vectors, the fused operations
+       * below process all vectors in a single sweep over the elements.
+       */
+      template <typename VectorType>
+      struct HasContiguousLocalElements : std::false_type
+      {};
+
+      template <typename Number>
+      struct HasContiguousLocalElements<dealii::Vector<Number>>
+        : std::true_type
+      {};
+
+      template <typename Number>
+      struct HasContiguousLocalElements<dealii::BlockVector<Number>>
+        : std::true_type
+      {};
+
+      template <typename Number>
+      struct HasContiguousLocalElements<
+        LinearAlgebra::distributed::Vector<Number, MemorySpace::Host>>
+        : std::true_type
+      {};
+
+      template <typename Number>
+      struct HasContiguousLocalElements<
+        LinearAlgebra::distributed::BlockVector<Number>> : std::true_type
+      {};
+
+
+
+      /**
+       * Return the number of blocks of @p v, which is one for vectors that
+       * are not block vectors.
+       */
+      template <typename VectorType,
+                std::enable_if_t<!IsBlockVector<VectorType>::value, int> = 0>
+      unsigned int
+      n_local_blocks(const VectorType &)
+      {
+        return 1;
+      }
+
+
+
+      template <typename VectorType,
+                std::enable_if_t<IsBlockVector<VectorType>::value, int> = 0>
+      unsigned int
+      n_local_blocks(const VectorType &v)
+      {
+        return v.n_blocks();
+      }
+
+
+
+      /**
+       * Return the block @p b of @p v, or @p v itself for vectors that are
+       * not block vectors.
+       */
+      template <typename VectorType,
+                std::enable_if_t<!IsBlockVector<VectorType>::value, int> = 0>
+      VectorType &
+      local_block(VectorType &v, const unsigned int)
+      {
+        return v;
+      }
+
+
+
+      template <typename VectorType,
+                std::enable_if_t<!IsBlockVector<VectorType>::value, int> = 0>
+      const VectorType &
+      local_block(const VectorType &v, const unsigned int)
+      {
+        return v;
+      }
+
+
+
+      template <typename VectorType,
+                std::enable_if_t<IsBlockVector<VectorType>::value, int> = 0>
+      typename VectorType::BlockType &
+      local_block(VectorType &v, const unsigned int b)
+      {
+        return v.block(b);
+      }
+
+
+
+      template <typename VectorType,
+                std::enable_if_t<IsBlockVector<VectorType>::value, int> = 0>
+      const typename VectorType::BlockType &
+      local_block(const VectorType &v, const unsigned int b)
+      {
+        return v.block(b);
+      }
+
+
+
+      /**
+       * Compute z = sum_i c[i] x[i] in a single sweep over the locally owned
+       * elements.
+       */
+      template <typename VectorType>
+      void
+      fused_linear_combination(const realtype *                       c,
+                               const std::vector<const VectorType *> &x,
+                               VectorType &                           z,
+                               std::true_type)
+      {
+        using Number = typename VectorType::value_type;
+        std::vector<const Number *> x_values(x.size());
+        for (unsigned int b = 0; b < n_local_blocks<VectorType>(z); ++b)
+          {
+            auto &     z_block  = local_block<VectorType>(z, b);
+            const auto n        = z_block.locally_owned_size();
+            Number *   z_values = z_block.begin();
+            for (unsigned int i = 0; i < x.size(); ++i)
+              {
+                AssertDimension(
+                  local_block<VectorType>(*x[i], b).locally_owned_size(), n);
+                x_values[i] = local_block<VectorType>(*x[i], b).begin();
+              }
+
+            for (std::size_t j = 0; j < n; ++j)
+              {
+                Number sum = c[0] * x_values[0][j];
+                for (unsigned int i = 1; i < x.size(); ++i)
+                  sum += c[i] * x_values[i][j];
+                z_values[j] = sum;
+              }
+          }
+      }
+
+
+
+      /**
+       * Compute z = sum_i c[i] x[i] with the vector operations of
+       * @p VectorType, adding two vectors at a time.
+       */
+      template <typename VectorType>
+      void
+      fused_linear_combination(const realtype *                       c,
+                               const std::vector<const VectorType *> &x,
+                               VectorType &                           z,
+                               std::false_type)
+      {
+        if (&z == x[0])
+          z *= c[0];
+        else
+          z.equ(c[0], *x[0]);
+
+        unsigned int i = 1;
+        for (; i + 1 < x.size(); i += 2)
+          z.add(c[i], *x[i], c[i + 1], *x[i + 1]);
+        if (i < x.size())
+          z.add(c[i], *x[i]);
+      }
+
+
+
+      template <typename VectorType>
+      int
+      linear_combination(int nv, realtype *c, N_Vector *X, N_Vector z)
+      {
+        Assert(nv > 0, ExcInternalError());
+        std::vector<const VectorType *> x_dealii(nv);
+        for (int i = 0; i < nv; ++i)
+          x_dealii[i] = unwrap_nvector_const<VectorType>(X[i]);
+        auto *z_dealii = unwrap_nvector<VectorType>(z);
+
+        fused_linear_combination(c,
+                                 x_dealii,
+                                 *z_dealii,
+                                 HasContiguousLocalElements<VectorType>());
+        return 0;
+      }
+
+
+
+      /**
+       * Compute z[i] = a[i] x + y[i] for all i in a single sweep over the
+       * locally owned elements.
+       */
+      template <typename VectorType>
+      void
+      fused_scale_add_multi(const realtype *                       a,
+                            const VectorType &                     x,
+                            const std::vector<const VectorType *> &y,
+                            const std::vector<VectorType *> &      z,
+                            std::true_type)
+      {
+        using Number = typename VectorType::value_type;
+        std::vector<const Number *> y_values(y.size());
+        std::vector<Number *>       z_values(z.size());
+        for (unsigned int b = 0; b < n_local_blocks<VectorType>(x); ++b)
+          {
+            const auto &  x_block  = local_block<VectorType>(x, b);
+            const auto    n        = x_block.locally_owned_size();
+            const Number *x_values = x_block.begin();
+            for (unsigned int i = 0; i < y.size(); ++i)
+              {
+                AssertDimension(
+                  local_block<VectorType>(*y[i], b).locally_owned_size(), n);
+                AssertDimension(
+                  local_block<VectorType>(*z[i], b).locally_owned_size(), n);
+                y_values[i] = local_block<VectorType>(*y[i], b).begin();
+                z_values[i] = local_block<VectorType>(*z[i], b).begin();
+              }
+
+            for (std::size_t j = 0; j < n; ++j)
+              {
+                const Number x_j = x_values[j];
+                for (unsigned int i = 0; i < y.size(); ++i)
+                  z_values[i][j] = a[i] * x_j + y_values[i][j];
+              }
+          }
+      }
+
+
+
+      /**
+       * Compute z[i] = a[i] x + y[i] for all i with the vector operations of
+       * @p VectorType.
+       */
+      template <typename VectorType>
+      void
+      fused_scale_add_multi(const realtype *                       a,
+                            const VectorType &                     x,
+                            const std::vector<const VectorType *> &y,
+                            const std::vector<VectorType *> &      z,
+                            std::false_type)
+      {
+        for (unsigned int i = 0; i < y.size(); ++i)
+          if (z[i] == y[i])
+            z[i]->add(a[i], x);
+          else if (z[i] == &x)
+            z[i]->sadd(a[i], 1., *y[i]);
+          else
+            {
+              z[i]->equ(a[i], x);
+              z[i]->add(1., *y[i]);
+            }
+      }
+
+
+
+      template <typename VectorType>
+      int
+      scale_add_multi(int       nv,
+                      realtype *a,
+                      N_Vector  x,
+                      N_Vector *Y,
+                      N_Vector *Z)
+      {
+        std::vector<const VectorType *> y_dealii(nv);
+        std::vector<VectorType *>       z_dealii(nv);
+        for (int i = 0; i < nv; ++i)
+          {
+            y_dealii[i] = unwrap_nvector_const<VectorType>(Y[i]);
+            z_dealii[i] = unwrap_nvector<VectorType>(Z[i]);
+          }
+
+        fused_scale_add_multi(a,
+                              *unwrap_nvector_const<VectorType>(x),
+                              y_dealii,
+                              z_dealii,
+                              HasContiguousLocalElements<VectorType>());
+        return 0;
+      }
+
+
+
+      /**
+       * Compute the dot products of the locally owned elements of @p x with
+       * those of all vectors @p y in a single sweep, reading @p x only once.
+       * Return whether the results still need to be summed over all
+       * processes.
+       */
+      template <typename VectorType>
+      bool
+      fused_dot_product_multi(const VectorType &                     x,
+                              const std::vector<const VectorType *> &y,
+                              realtype *                             d,
+                              std::true_type)
+      {
+        using Number = typename VectorType::value_type;
+        std::fill(d, d + y.size(), realtype());
+        std::vector<const Number *> y_values(y.size());
+        for (unsigned int b = 0; b < n_local_blocks<VectorType>(x); ++b)
+          {
+            const auto &  x_block  = local_block<VectorType>(x, b);
+            const auto    n        = x_block.locally_owned_size();
+            const Number *x_values = x_block.begin();
+            for (unsigned int i = 0; i < y.size(); ++i)
+              {
+                AssertDimension(
+                  local_block<VectorType>(*y[i], b).locally_owned_size(), n);
+                y_values[i] = local_block<VectorType>(*y[i], b).begin();
+              }
+
+            for (std::size_t j = 0; j < n; ++j)
+              {
+                const Number x_j = x_values[j];
+                for (unsigned int i = 0; i < y.size(); ++i)
+                  d[i] += x_j * y_values[i][j];
+              }
+          }
+        return true;
+      }
+
+
+
+      /**
+       * Compute the dot products of @p x with all vectors @p y with the
+       * vector operations of @p VectorType, which already sum over all
+       * processes.
+       */
+      template <typename VectorType>
+      bool
+      fused_dot_product_multi(const VectorType &                     x,
+                              const std::vector<const VectorType *> &y,
+                              realtype *                             d,
+                              std::false_type)
+      {
+        for (unsigned int i = 0; i < y.size(); ++i)
+          d[i] = x * (*y[i]);
+        return false;
+      }
+
+
+
+      template <typename VectorType>
+      int
+      dot_product_multi(int nv, N_Vector x, N_Vector *Y, realtype *d)
+      {
+        std::vector<const VectorType *> y_dealii(nv);
+        for (int i = 0; i < nv; ++i)
+          y_dealii[i] = unwrap_nvector_const<VectorType>(Y[i]);
+
+        const bool needs_reduction =
+          fused_dot_product_multi(*unwrap_nvector_const<VectorType>(x),
+                                  y_dealii,
+                                  d,
+                                  HasContiguousLocalElements<VectorType>());
+
+        // sum the local dot products over all processes with a single
+        // reduction
+        void *communicator = get_communicator_as_void_ptr<VectorType>(x);
+        if (needs_reduction && communicator != nullptr)
+          Utilities::MPI::sum(ArrayView<const realtype>(d, nv),
+                              *static_cast<MPI_Comm *>(communicator),
+                              ArrayView<realtype>(d, nv));
+        return 0;
+      }
+
+
+
       template <typename VectorType>
       realtype
       weighted_l2_norm(N_Vector x, N_Vector w)
@@ -1007,7 +1386,14 @@ namespace SUNDIALS
       //  v->ops->nvconstrmask   = undef;
       //  v->ops->nvminquotient  = undef;
 
-      /* fused and vector array operations are disabled (NULL) by default */
+      /* fused vector operations */
+      v->ops->nvlinearcombination =
+        &NVectorOperations::linear_combination<VectorType>;
+      v->ops->nvscaleaddmulti = &NVectorOperations::scale_add_multi<VectorType>;
+      v->ops->nvdotprodmulti =
+        &NVectorOperations::dot_product_multi<VectorType>;
+
+      /* vector array operations are disabled (NULL) by default */
 
       /* local reduction operations */
       //  v->ops->nvdotprodlocal     = undef;
@@ -35,6 +35,7 @@
 #include <deal.II/base/memory_consumption.h>
 #include <deal.II/base/mpi.h>
 #include <deal.II/base/mpi_large_count.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/parameter_handler.h>
 #include <deal.II/base/thread_management.h>
 #include <deal.II/base/utilities.h>
@@ -149,6 +150,13 @@ namespace
   /**
    * Do a zlib compression followed by a base64 encoding of the given data. The
    * result is then returned as a string object.
+   *
+   * The data is split into blocks of at most `block_size` bytes that are
+   * compressed independently, and in parallel, as described by the
+   * multi-block header of the VTK compressed binary format. Besides making
+   * use of several threads for large arrays, this also allows for arrays
+   * larger than the 4 GB that a single block with 32-bit size information
+   * can describe.
    */
   template <typename T>
   std::string
@@ -158,50 +166,80 @@ namespace
 #ifdef DEAL_II_WITH_ZLIB
     if (data.size() != 0)
       {
+        const std::size_t block_size        = std::size_t(1) << 20;
         const std::size_t uncompressed_size = (data.size() * sizeof(T));
-
-        // While zlib's compress2 uses unsigned long (which is 64bits
-        // on Linux), the vtu compression header stores the block size
-        // as an std::uint32_t (see below). While we could implement
-        // writing several smaller blocks, we haven't done that. Let's
-        // trigger an error for the user instead:
-        AssertThrow(uncompressed_size <=
-                      std::numeric_limits<std::uint32_t>::max(),
-                    ExcNotImplemented());
-
-        // allocate a buffer for compressing data and do so
-        auto compressed_data_length = compressBound(uncompressed_size);
-        AssertThrow(compressed_data_length <=
-                      std::numeric_limits<std::uint32_t>::max(),
+        const std::size_t n_blocks =
+          (uncompressed_size + block_size - 1) / block_size;
+        const std::size_t last_block_size =
+          uncompressed_size - (n_blocks - 1) * block_size;
+        AssertThrow(n_blocks <= std::numeric_limits<std::uint32_t>::max(),
                     ExcNotImplemented());
 
-        std::vector<unsigned char> compressed_data(compressed_data_length);
-
-        int err = compress2(&compressed_data[0],
-                            &compressed_data_length,
-                            reinterpret_cast<const Bytef *>(data.data()),
-                            uncompressed_size,
-                            get_zlib_compression_level(compression_level));
-        (void)err;
-        Assert(err == Z_OK, ExcInternalError());
-
-        // Discard the unnecessary bytes
-        compressed_data.resize(compressed_data_length);
-
-        // now encode the compression header
-        const std::uint32_t compression_header[4] = {
-          1,                                             /* number of blocks */
-          static_cast<std::uint32_t>(uncompressed_size), /* size of block */
-          static_cast<std::uint32_t>(
-            uncompressed_size), /* size of last block */
-          static_cast<std::uint32_t>(
-            compressed_data_length)}; /* list of compressed sizes of blocks */
+        const Bytef *uncompressed_data =
+          reinterpret_cast<const Bytef *>(data.data());
+
+        // compress the blocks on separate tasks, each into a buffer of its
+        // own, since we do not know the compressed sizes in advance
+        std::vector<std::vector<unsigned char>> compressed_blocks(n_blocks);
+        parallel::apply_to_subranges(
+          std::size_t(0),
+          n_blocks,
+          [&](const std::size_t begin, const std::size_t end) {
+            for (std::size_t b = begin; b < end; ++b)
+              {
+                const std::size_t size =
+                  (b == n_blocks - 1 ? last_block_size : block_size);
+                auto compressed_length = compressBound(size);
+                compressed_blocks[b].resize(compressed_length);
+
+                int err = compress2(compressed_blocks[b].data(),
+                                    &compressed_length,
+                                    uncompressed_data + b * block_size,
+                                    size,
+                                    get_zlib_compression_level(
+                                      compression_level));
+                (void)err;
+                Assert(err == Z_OK, ExcInternalError());
+
+                // Discard the unnecessary bytes
+                compressed_blocks[b].resize(compressed_length);
+              }
+          },
+          1);
+
+        // now encode the compression header: the number of blocks, the size
+        // of all but the last block, the size of the last block, and the
+        // list of compressed sizes of the blocks
+        std::vector<std::uint32_t> compression_header;
+        compression_header.reserve(3 + n_blocks);
+        compression_header.push_back(n_blocks);
+        compression_header.push_back(
+          static_cast<std::uint32_t>(n_blocks > 1 ? block_size :
+                                                    last_block_size));
+        compression_header.push_back(
+          static_cast<std::uint32_t>(last_block_size));
+        std::size_t total_compressed_size = 0;
+        for (const auto &block : compressed_blocks)
+          {
+            compression_header.push_back(
+              static_cast<std::uint32_t>(block.size()));
+            total_compressed_size += block.size();
+          }
 
         const auto header_start =
-          reinterpret_cast<const unsigned char *>(&compression_header[0]);
+          reinterpret_cast<const unsigned char *>(compression_header.data());
+
+        std::vector<unsigned char> compressed_data;
+        compressed_data.reserve(total_compressed_size);
+        for (const auto &block : compressed_blocks)
+          compressed_data.insert(compressed_data.end(),
+                                 block.begin(),
+                                 block.end());
 
         return (Utilities::encode_base64(
-                  {header_start, header_start + 4 * sizeof(std::uint32_t)}) +
+                  {header_start,
+                   header_start +
+                     compression_header.size() * sizeof(std::uint32_t)}) +
                 Utilities::encode_base64(compressed_data));
       }
     else
@@ -267,6 +305,28 @@ namespace
     std::uint64_t n_ranks;
     std::uint64_t n_patches;
   };
+
+
+
+  /**
+   * The beginning of the XDMF files written by
+   * DataOutInterface::write_xdmf_file(), up to the first entry.
+   */
+  const char *const xdmf_file_header =
+    "<?xml version=\"1.0\" ?>\n"
+    "<!DOCTYPE Xdmf SYSTEM \"Xdmf.dtd\" []>\n"
+    "<Xdmf Version=\"2.0\">\n"
+    "  <Domain>\n"
+    "    <Grid Name=\"CellTime\" GridType=\"Collection\" "
+    "CollectionType=\"Temporal\">\n";
+
+  /**
+   * The end of the XDMF files written by DataOutInterface::write_xdmf_file(),
+   * after the last entry.
+   */
+  const char *const xdmf_file_footer = "    </Grid>\n"
+                                       "  </Domain>\n"
+                                       "</Xdmf>\n";
 } // namespace
 
 
@@ -2759,6 +2819,7 @@ namespace DataOutBase
     , compression_level(compression_level)
     , write_higher_order_cells(write_higher_order_cells)
     , physical_units(physical_units)
+    , aggregate_on_shared_memory_nodes(false)
   {}
 
 
@@ -6500,11 +6561,11 @@ namespace DataOutBase
     const auto stringize_nonscalar_data_range =
       [&flags,
        &data_names,
+       &patches,
        ascii_or_binary,
        n_data_sets,
        n_nodes,
-       output_precision = out.precision()](const Table<2, float> &data_vectors,
-                                           const auto &           range) {
+       output_precision = out.precision()](const auto &range) {
         std::ostringstream o;
 
         const auto  first_component = std::get<0>(range);
@@ -6569,81 +6630,84 @@ namespace DataOutBase
         std::vector<float> data;
         data.reserve(n_nodes * n_components);
 
-        for (unsigned int n = 0; n < n_nodes; ++n)
-          {
-            if (!is_tensor)
-              {
-                switch (last_component - first_component)
-                  {
-                    case 0:
-                      data.push_back(data_vectors(first_component, n));
-                      data.push_back(0);
-                      data.push_back(0);
-                      break;
-
-                    case 1:
-                      data.push_back(data_vectors(first_component, n));
-                      data.push_back(data_vectors(first_component + 1, n));
-                      data.push_back(0);
-                      break;
-
-                    case 2:
-                      data.push_back(data_vectors(first_component, n));
-                      data.push_back(data_vectors(first_component + 1, n));
-                      data.push_back(data_vectors(first_component + 2, n));
-                      break;
-
-                    default:
-                      // Anything else is not yet implemented
-                      Assert(false, ExcInternalError());
-                  }
-              }
-            else
-              {
-                Tensor<2, 3> vtk_data;
-                vtk_data = 0.;
+        for (const auto &patch : patches)
+          for (unsigned int n = 0; n < patch.data.n_cols(); ++n)
+            {
+              if (!is_tensor)
+                {
+                  switch (last_component - first_component)
+                    {
+                      case 0:
+                        data.push_back(patch.data(first_component, n));
+                        data.push_back(0);
+                        data.push_back(0);
+                        break;
 
-                const unsigned int size = last_component - first_component + 1;
-                if (size == 1)
-                  // 1D, 1 element
-                  {
-                    vtk_data[0][0] = data_vectors(first_component, n);
-                  }
-                else if (size == 4)
-                  // 2D, 4 elements
-                  {
-                    for (unsigned int c = 0; c < size; ++c)
-                      {
-                        const auto ind =
-                          Tensor<2, 2>::unrolled_to_component_indices(c);
-                        vtk_data[ind[0]][ind[1]] =
-                          data_vectors(first_component + c, n);
-                      }
-                  }
-                else if (size == 9)
-                  // 3D 9 elements
-                  {
-                    for (unsigned int c = 0; c < size; ++c)
-                      {
-                        const auto ind =
-                          Tensor<2, 3>::unrolled_to_component_indices(c);
-                        vtk_data[ind[0]][ind[1]] =
-                          data_vectors(first_component + c, n);
-                      }
-                  }
-                else
-                  {
-                    Assert(false, ExcInternalError());
-                  }
+                      case 1:
+                        data.push_back(patch.data(first_component, n));
+                        data.push_back(patch.data(first_component + 1, n));
+                        data.push_back(0);
+                        break;
 
-                // now put the tensor into data
-                // note we pad with zeros because VTK format always wants to
-                // see a 3x3 tensor, regardless of dimension
-                for (unsigned int i = 0; i < 3; ++i)
-                  for (unsigned int j = 0; j < 3; ++j)
-                    data.push_back(vtk_data[i][j]);
-              }
-          } // loop over nodes
+                      case 2:
+                        data.push_back(patch.data(first_component, n));
+                        data.push_back(patch.data(first_component + 1, n));
+                        data.push_back(patch.data(first_component + 2, n));
+                        break;
+
+                      default:
+                        // Anything else is not yet implemented
+                        Assert(false, ExcInternalError());
+                    }
+                }
+              else
+                {
+                  Tensor<2, 3> vtk_data;
+                  vtk_data = 0.;
+
+                  const unsigned int size =
+                    last_component - first_component + 1;
+                  if (size == 1)
+                    // 1D, 1 element
+                    {
+                      vtk_data[0][0] = patch.data(first_component, n);
+                    }
+                  else if (size == 4)
+                    // 2D, 4 elements
+                    {
+                      for (unsigned int c = 0; c < size; ++c)
+                        {
+                          const auto ind =
+                            Tensor<2, 2>::unrolled_to_component_indices(c);
+                          vtk_data[ind[0]][ind[1]] =
+                            patch.data(first_component + c, n);
+                        }
+                    }
+                  else if (size == 9)
+                    // 3D 9 elements
+                    {
+                      for (unsigned int c = 0; c < size; ++c)
+                        {
+                          const auto ind =
+                            Tensor<2, 3>::unrolled_to_component_indices(c);
+                          vtk_data[ind[0]][ind[1]] =
+                            patch.data(first_component + c, n);
+                        }
+                    }
+                  else
+                    {
+                      Assert(false, ExcInternalError());
+                    }
+
+                  // now put the tensor into data
+                  // note we pad with zeros because VTK format always wants to
+                  // see a 3x3 tensor, regardless of dimension
+                  for (unsigned int i = 0; i < 3; ++i)
+                    for (unsigned int j = 0; j < 3; ++j)
+                      data.push_back(vtk_data[i][j]);
+                }
+            } // loop over nodes of all patches
+        AssertDimension(data.size(), n_nodes * n_components);
 
         o << vtu_stringize_array(data,
                                  flags.compression_level,
@@ -6657,9 +6721,10 @@ namespace DataOutBase
     const auto stringize_scalar_data_set =
       [&flags,
        &data_names,
+       &patches,
        ascii_or_binary,
-       output_precision = out.precision()](const Table<2, float> &data_vectors,
-                                           const unsigned int     data_set) {
+       n_nodes,
+       output_precision = out.precision()](const unsigned int data_set) {
         std::ostringstream o;
 
         o << "    <DataArray type=\"Float32\" Name=\"" << data_names[data_set]
@@ -6672,8 +6737,14 @@ namespace DataOutBase
 
         o << ">\n";
 
-        const std::vector<float> data(data_vectors[data_set].begin(),
-                                      data_vectors[data_set].end());
+        std::vector<float> data;
+        data.reserve(n_nodes);
+        for (const auto &patch : patches)
+          data.insert(data.end(),
+                      patch.data[data_set].begin(),
+                      patch.data[data_set].end());
+        AssertDimension(data.size(), n_nodes);
+
         o << vtu_stringize_array(data,
                                  flags.compression_level,
                                  output_precision);
@@ -6685,20 +6756,13 @@ namespace DataOutBase
 
 
     // For the format we write here, we need to write all node values relating
-    // to one variable at a time. We could in principle do this by looping
-    // over all patches and extracting the values corresponding to the one
-    // variable we're dealing with right now, and then start the process over
-    // for the next variable with another loop over all patches.
-    //
-    // An easier way is to create a global table that for each variable
-    // lists all values. This copying of data vectors can be done in the
-    // background while we're already working on vertices and cells,
-    // so do this on a separate task and when wanting to write out the
-    // data, we wait for that task to finish.
-    Threads::Task<std::unique_ptr<Table<2, float>>>
-      create_global_data_table_task = Threads::new_task([&patches]() {
-        return create_global_data_table<dim, spacedim, float>(patches);
-      });
+    // to one variable at a time. Rather than first copying the data of all
+    // patches into a global table that lists all values of each variable
+    // (which would double the memory needed for the output data), each of
+    // the tasks below loops over all patches and extracts the values of the
+    // variables it deals with right into the array it converts to a string.
+    // The rows of the patch data tables are contiguous, so this is a
+    // sequence of block copies for scalar data sets.
 
     // -----------------------------
     // Now finally get around to actually doing anything. Let's start with
@@ -6708,11 +6772,6 @@ namespace DataOutBase
     mesh_tasks += Threads::new_task(stringize_cell_to_vertex_information);
     mesh_tasks += Threads::new_task(stringize_cell_offset_and_type_information);
 
-    // For what follows, we have to have the reordered data available. So wait
-    // for that task to conclude and get the resulting data table:
-    const Table<2, float> data_vectors =
-      std::move(*create_global_data_table_task.return_value());
-
     // Then create the strings for the actual values of the solution vectors,
     // again on separate tasks:
     Threads::TaskGroup<std::string> data_tasks;
@@ -6727,7 +6786,7 @@ namespace DataOutBase
           data_set_handled[i] = true;
 
         data_tasks += Threads::new_task([&, range]() {
-          return stringize_nonscalar_data_range(data_vectors, range);
+          return stringize_nonscalar_data_range(range);
         });
       }
 
@@ -6736,7 +6795,7 @@ namespace DataOutBase
       if (data_set_handled[data_set] == false)
         {
           data_tasks += Threads::new_task([&, data_set]() {
-            return stringize_scalar_data_set(data_vectors, data_set);
+            return stringize_scalar_data_set(data_set);
           });
         }
 
@@ -6761,6 +6820,206 @@ namespace DataOutBase
 
 
 
+  template <int spacedim>
+  void
+  write_vtu_point_cloud_main(
+    const std::vector<Point<spacedim>> &points,
+    const Table<2, float> &             data,
+    const std::vector<std::string> &    data_names,
+    const std::vector<
+      std::tuple<unsigned int,
+                 unsigned int,
+                 std::string,
+                 DataComponentInterpretation::DataComponentInterpretation>>
+      &             nonscalar_data_ranges,
+    const VtkFlags &flags,
+    std::ostream &  out)
+  {
+    AssertThrow(out.fail() == false, ExcIO());
+
+    const unsigned int n_points    = points.size();
+    const unsigned int n_data_sets = data_names.size();
+    AssertDimension(data.n_rows(), n_data_sets);
+    if (n_data_sets > 0)
+      AssertDimension(data.n_cols(), n_points);
+
+    const char *ascii_or_binary =
+      (deal_ii_with_zlib &&
+       (flags.compression_level != CompressionLevel::plain_text)) ?
+        "binary" :
+        "ascii";
+    const auto output_precision = out.precision();
+
+    // As in write_vtu_main(), the different parts of the file are converted
+    // to strings on separate tasks. The positions are padded to three
+    // dimensions and each point forms a vertex cell.
+    const auto stringize_points = [&]() {
+      std::ostringstream o;
+      o << "  <Points>\n";
+      o << "    <DataArray type=\"Float32\" NumberOfComponents=\"3\" format=\""
+        << ascii_or_binary << "\">\n";
+      std::vector<float> coordinates(3 * n_points, 0.0f);
+      for (unsigned int i = 0; i < n_points; ++i)
+        for (unsigned int d = 0; d < spacedim; ++d)
+          coordinates[3 * i + d] = points[i][d];
+      o << vtu_stringize_array(coordinates,
+                               flags.compression_level,
+                               output_precision)
+        << '\n';
+      o << "    </DataArray>\n";
+      o << "  </Points>\n\n";
+      return o.str();
+    };
+
+    const auto stringize_cells = [&]() {
+      std::ostringstream o;
+      o << "  <Cells>\n";
+      o << "    <DataArray type=\"Int32\" Name=\"connectivity\" format=\""
+        << ascii_or_binary << "\">\n";
+      std::vector<int32_t> indices(n_points);
+      for (unsigned int i = 0; i < n_points; ++i)
+        indices[i] = i;
+      o << vtu_stringize_array(indices,
+                               flags.compression_level,
+                               output_precision)
+        << '\n';
+      o << "    </DataArray>\n";
+
+      o << "    <DataArray type=\"Int32\" Name=\"offsets\" format=\""
+        << ascii_or_binary << "\">\n";
+      for (unsigned int i = 0; i < n_points; ++i)
+        indices[i] = i + 1;
+      o << vtu_stringize_array(indices,
+                               flags.compression_level,
+                               output_precision)
+        << '\n';
+      o << "    </DataArray>\n";
+
+      // all cells are of type VTK_VERTEX
+      o << "    <DataArray type=\"UInt8\" Name=\"types\" format=\""
+        << ascii_or_binary << "\">\n";
+      if (deal_ii_with_zlib &&
+          (flags.compression_level != CompressionLevel::plain_text))
+        o << vtu_stringize_array(std::vector<std::uint8_t>(n_points, 1),
+                                 flags.compression_level,
+                                 output_precision);
+      else
+        o << vtu_stringize_array(std::vector<unsigned int>(n_points, 1),
+                                 flags.compression_level,
+                                 output_precision);
+      o << '\n';
+      o << "    </DataArray>\n";
+      o << "  </Cells>\n";
+      return o.str();
+    };
+
+    const auto write_data_array_header = [&](std::ostream &     o,
+                                             const std::string &name,
+                                             const unsigned int n_components) {
+      o << "    <DataArray type=\"Float32\" Name=\"" << name << '"';
+      if (n_components > 1)
+        o << " NumberOfComponents=\"" << n_components << '"';
+      o << " format=\"" << ascii_or_binary << '"';
+      if (flags.physical_units.find(name) != flags.physical_units.end())
+        o << " units=\"" << flags.physical_units.at(name) << '"';
+      o << ">\n";
+    };
+
+    const auto stringize_nonscalar_data_range = [&](const auto &range) {
+      std::ostringstream o;
+
+      const unsigned int first_component = std::get<0>(range);
+      const unsigned int last_component  = std::get<1>(range);
+      const unsigned int size = last_component + 1 - first_component;
+      const bool         is_tensor =
+        (std::get<3>(range) ==
+         DataComponentInterpretation::component_is_part_of_tensor);
+      const unsigned int n_components = (is_tensor ? 9 : 3);
+      AssertThrow(last_component >= first_component,
+                  ExcLowerRange(last_component, first_component));
+      AssertThrow(last_component < n_data_sets,
+                  ExcIndexRange(last_component, 0, n_data_sets));
+      AssertThrow(size <= 3 || (is_tensor && (size == 4 || size == 9)),
+                  ExcMessage("VTU output only supports vectors with up to "
+                             "three components and tensors with 1, 4, or "
+                             "9 components."));
+
+      // use the name of the range, or all component names concatenated with
+      // double underscores if it has none, as in write_vtu_main()
+      std::string name = std::get<2>(range);
+      if (name.empty())
+        {
+          for (unsigned int i = first_component; i < last_component; ++i)
+            name += data_names[i] + "__";
+          name += data_names[last_component];
+        }
+      write_data_array_header(o, name, n_components);
+
+      // pad vectors to three components and tensors to 3x3, where a tensor
+      // of size 4 is a 2x2 tensor
+      const unsigned int tensor_dim = (size == 4 ? 2 : 3);
+      std::vector<float> values(n_points * n_components, 0.0f);
+      for (unsigned int c = 0; c < size; ++c)
+        {
+          const unsigned int offset =
+            is_tensor ? (c / tensor_dim) * 3 + c % tensor_dim : c;
+          for (unsigned int i = 0; i < n_points; ++i)
+            values[i * n_components + offset] = data(first_component + c, i);
+        }
+
+      o << vtu_stringize_array(values,
+                               flags.compression_level,
+                               output_precision)
+        << '\n';
+      o << "    </DataArray>\n";
+      return o.str();
+    };
+
+    const auto stringize_scalar_data_set = [&](const unsigned int data_set) {
+      std::ostringstream o;
+      write_data_array_header(o, data_names[data_set], 1);
+      o << vtu_stringize_array(std::vector<float>(data[data_set].begin(),
+                                                  data[data_set].end()),
+                               flags.compression_level,
+                               output_precision)
+        << '\n';
+      o << "    </DataArray>\n";
+      return o.str();
+    };
+
+    Threads::TaskGroup<std::string> tasks;
+    tasks += Threads::new_task(stringize_points);
+    tasks += Threads::new_task(stringize_cells);
+
+    std::vector<bool> data_set_handled(n_data_sets, false);
+    for (const auto &range : nonscalar_data_ranges)
+      {
+        for (unsigned int i = std::get<0>(range); i <= std::get<1>(range); ++i)
+          data_set_handled[i] = true;
+        tasks += Threads::new_task(
+          [&, range]() { return stringize_nonscalar_data_range(range); });
+      }
+    for (unsigned int data_set = 0; data_set < n_data_sets; ++data_set)
+      if (data_set_handled[data_set] == false)
+        tasks += Threads::new_task(
+          [&, data_set]() { return stringize_scalar_data_set(data_set); });
+
+    const std::vector<std::string> parts = tasks.return_values();
+    out << "<Piece NumberOfPoints=\"" << n_points << "\" NumberOfCells=\""
+        << n_points << "\" >\n";
+    out << parts[0] << parts[1];
+    out << "  <PointData Scalars=\"scalars\">\n";
+    for (unsigned int i = 2; i < parts.size(); ++i)
+      out << parts[i];
+    out << "  </PointData>\n";
+    out << " </Piece>\n";
+
+    out.flush();
+    AssertThrow(out.fail() == false, ExcIO());
+  }
+
+
+
   void
   write_pvtu_record(
     std::ostream &                  out,
@@ -8372,125 +8631,358 @@ DataOutInterface<dim, spacedim>::write_svg(std::ostream &out) const
 }
 
 
-template <int dim, int spacedim>
-void
-DataOutInterface<dim, spacedim>::write_vtu_in_parallel(
-  const std::string &filename,
-  const MPI_Comm &   comm) const
+namespace
 {
-#ifndef DEAL_II_WITH_MPI
-  // without MPI fall back to the normal way to write a vtu file:
-  (void)comm;
+#ifdef DEAL_II_WITH_MPI
+  /**
+   * Collectively write the VTU header, the pieces @p piece of all
+   * processes in @p comm in the order of their ranks, and the VTU footer to
+   * the file @p filename using MPI I/O.
+   */
+  void
+  write_vtu_pieces_in_parallel(const std::string &         filename,
+                               const std::string &         piece,
+                               const DataOutBase::VtkFlags &vtk_flags,
+                               const MPI_Comm &            comm)
+  {
+    const unsigned int myrank  = Utilities::MPI::this_mpi_process(comm);
+    const unsigned int n_ranks = Utilities::MPI::n_mpi_processes(comm);
+    MPI_Info           info;
+    int                ierr = MPI_Info_create(&info);
+    AssertThrowMPI(ierr);
+    for (const auto &hint : vtk_flags.mpi_io_hints)
+      {
+        ierr = MPI_Info_set(info, hint.first.c_str(), hint.second.c_str());
+        AssertThrowMPI(ierr);
+      }
+    MPI_File fh;
+    ierr = MPI_File_open(
+      comm, filename.c_str(), MPI_MODE_CREATE | MPI_MODE_WRONLY, info, &fh);
+    AssertThrow(ierr == MPI_SUCCESS, ExcFileNotOpen(filename));
 
-  std::ofstream f(filename);
-  AssertThrow(f, ExcFileNotOpen(filename));
-  write_vtu(f);
-#else
+    ierr = MPI_File_set_size(fh, 0); // delete the file contents
+    AssertThrowMPI(ierr);
+    // this barrier is necessary, because otherwise others might already write
+    // while one core is still setting the size to zero.
+    ierr = MPI_Barrier(comm);
+    AssertThrowMPI(ierr);
+    ierr = MPI_Info_free(&info);
+    AssertThrowMPI(ierr);
 
-  const unsigned int myrank  = Utilities::MPI::this_mpi_process(comm);
-  const unsigned int n_ranks = Utilities::MPI::n_mpi_processes(comm);
-  MPI_Info           info;
-  int                ierr = MPI_Info_create(&info);
-  AssertThrowMPI(ierr);
-  MPI_File fh;
-  ierr = MPI_File_open(
-    comm, filename.c_str(), MPI_MODE_CREATE | MPI_MODE_WRONLY, info, &fh);
-  AssertThrow(ierr == MPI_SUCCESS, ExcFileNotOpen(filename));
+    // Define header size so we can broadcast later.
+    unsigned int  header_size;
+    std::uint64_t footer_offset;
 
-  ierr = MPI_File_set_size(fh, 0); // delete the file contents
-  AssertThrowMPI(ierr);
-  // this barrier is necessary, because otherwise others might already write
-  // while one core is still setting the size to zero.
-  ierr = MPI_Barrier(comm);
-  AssertThrowMPI(ierr);
-  ierr = MPI_Info_free(&info);
-  AssertThrowMPI(ierr);
+    // write header
+    if (myrank == 0)
+      {
+        std::stringstream ss;
+        DataOutBase::write_vtu_header(ss, vtk_flags);
+        header_size = ss.str().size();
+        // Write the header on rank 0 at the start of a file, i.e., offset 0.
+        ierr = Utilities::MPI::LargeCount::File_write_at_c(
+          fh, 0, ss.str().c_str(), header_size, MPI_CHAR, MPI_STATUS_IGNORE);
+        AssertThrowMPI(ierr);
+      }
 
-  // Define header size so we can broadcast later.
-  unsigned int  header_size;
-  std::uint64_t footer_offset;
+    ierr = MPI_Bcast(&header_size, 1, MPI_UNSIGNED, 0, comm);
+    AssertThrowMPI(ierr);
 
-  // write header
-  if (myrank == 0)
     {
-      std::stringstream ss;
-      DataOutBase::write_vtu_header(ss, vtk_flags);
-      header_size = ss.str().size();
-      // Write the header on rank 0 at the start of a file, i.e., offset 0.
-      ierr = Utilities::MPI::LargeCount::File_write_at_c(
-        fh, 0, ss.str().c_str(), header_size, MPI_CHAR, MPI_STATUS_IGNORE);
+      // Use prefix sum to find specific offset to write at.
+      const std::uint64_t size_on_proc = piece.size();
+      std::uint64_t       prefix_sum   = 0;
+      ierr =
+        MPI_Exscan(&size_on_proc, &prefix_sum, 1, MPI_UINT64_T, MPI_SUM, comm);
       AssertThrowMPI(ierr);
-    }
 
-  ierr = MPI_Bcast(&header_size, 1, MPI_UNSIGNED, 0, comm);
-  AssertThrowMPI(ierr);
+      // Locate specific offset for each processor.
+      const MPI_Offset offset =
+        static_cast<MPI_Offset>(header_size) + prefix_sum;
+
+      ierr = Utilities::MPI::LargeCount::File_write_at_all_c(fh,
+                                                             offset,
+                                                             piece.c_str(),
+                                                             piece.size(),
+                                                             MPI_CHAR,
+                                                             MPI_STATUS_IGNORE);
+      AssertThrowMPI(ierr);
 
-  {
-    const auto &                  patches      = get_patches();
-    const types::global_dof_index my_n_patches = patches.size();
-    const types::global_dof_index global_n_patches =
-      Utilities::MPI::sum(my_n_patches, comm);
+      if (myrank == n_ranks - 1)
+        {
+          // Locating Footer with offset on last rank.
+          footer_offset = size_on_proc + offset;
+
+          std::stringstream ss;
+          DataOutBase::write_vtu_footer(ss);
+          const unsigned int footer_size = ss.str().size();
+
+          // Writing footer:
+          ierr =
+            Utilities::MPI::LargeCount::File_write_at_c(fh,
+                                                        footer_offset,
+                                                        ss.str().c_str(),
+                                                        footer_size,
+                                                        MPI_CHAR,
+                                                        MPI_STATUS_IGNORE);
+          AssertThrowMPI(ierr);
+        }
+    }
 
-    // Do not write pieces with 0 cells as this will crash paraview if this is
-    // the first piece written. But if nobody has any pieces to write (file is
-    // empty), let processor 0 write their empty data, otherwise the vtk file is
-    // invalid.
-    std::stringstream ss;
-    if (my_n_patches > 0 || (global_n_patches == 0 && myrank == 0))
-      DataOutBase::write_vtu_main(patches,
-                                  get_dataset_names(),
-                                  get_nonscalar_data_ranges(),
-                                  vtk_flags,
-                                  ss);
-
-    // Use prefix sum to find specific offset to write at.
-    const std::uint64_t size_on_proc = ss.str().size();
-    std::uint64_t       prefix_sum   = 0;
-    ierr =
-      MPI_Exscan(&size_on_proc, &prefix_sum, 1, MPI_UINT64_T, MPI_SUM, comm);
+    // Make sure we sync to disk. As written in the standard,
+    // MPI_File_close() actually already implies a sync but there seems
+    // to be a bug on at least one configuration (running with multiple
+    // nodes using OpenMPI 4.1) that requires it. Without this call, the
+    // footer is sometimes missing.
+    ierr = MPI_File_sync(fh);
     AssertThrowMPI(ierr);
 
-    // Locate specific offset for each processor.
-    const MPI_Offset offset = static_cast<MPI_Offset>(header_size) + prefix_sum;
+    ierr = MPI_File_close(&fh);
+    AssertThrowMPI(ierr);
+  }
+
+
+
+  /**
+   * Send the VTU pieces of all processes of @p comm that share a node to the
+   * first process of that node, which appends them to its own @p piece.
+   * Return a new communicator of the first processes of all nodes, which
+   * then jointly write the file, or MPI_COMM_NULL on all other processes,
+   * whose @p piece is cleared.
+   */
+  MPI_Comm
+  aggregate_vtu_pieces_on_nodes(std::string &piece, const MPI_Comm &comm)
+  {
+    const unsigned int myrank = Utilities::MPI::this_mpi_process(comm);
 
-    ierr = Utilities::MPI::LargeCount::File_write_at_all_c(fh,
-                                                           offset,
-                                                           ss.str().c_str(),
-                                                           ss.str().size(),
-                                                           MPI_CHAR,
-                                                           MPI_STATUS_IGNORE);
+    MPI_Comm node_comm;
+    int      ierr = MPI_Comm_split_type(
+      comm, MPI_COMM_TYPE_SHARED, myrank, MPI_INFO_NULL, &node_comm);
     AssertThrowMPI(ierr);
 
-    if (myrank == n_ranks - 1)
-      {
-        // Locating Footer with offset on last rank.
-        footer_offset = size_on_proc + offset;
+    const unsigned int node_rank = Utilities::MPI::this_mpi_process(node_comm);
+    const unsigned int node_size = Utilities::MPI::n_mpi_processes(node_comm);
 
-        std::stringstream ss;
-        DataOutBase::write_vtu_footer(ss);
-        const unsigned int footer_size = ss.str().size();
-
-        // Writing footer:
-        ierr = Utilities::MPI::LargeCount::File_write_at_c(fh,
-                                                           footer_offset,
-                                                           ss.str().c_str(),
-                                                           footer_size,
-                                                           MPI_CHAR,
-                                                           MPI_STATUS_IGNORE);
+    const int tag = Utilities::MPI::internal::Tags::data_out_aggregate_pieces;
+    if (node_rank == 0)
+      for (unsigned int p = 1; p < node_size; ++p)
+        {
+          std::uint64_t size = 0;
+          ierr               = MPI_Recv(
+            &size, 1, MPI_UINT64_T, p, tag, node_comm, MPI_STATUS_IGNORE);
+          AssertThrowMPI(ierr);
+          if (size > 0)
+            {
+              const std::size_t old_size = piece.size();
+              piece.resize(old_size + size);
+              const auto type =
+                Utilities::MPI::create_mpi_data_type_n_bytes(size);
+              ierr = MPI_Recv(&piece[old_size],
+                              1,
+                              *type,
+                              p,
+                              tag,
+                              node_comm,
+                              MPI_STATUS_IGNORE);
+              AssertThrowMPI(ierr);
+            }
+        }
+    else
+      {
+        const std::uint64_t size = piece.size();
+        ierr = MPI_Send(&size, 1, MPI_UINT64_T, 0, tag, node_comm);
         AssertThrowMPI(ierr);
+        if (size > 0)
+          {
+            const auto type =
+              Utilities::MPI::create_mpi_data_type_n_bytes(size);
+            ierr = MPI_Send(piece.data(), 1, *type, 0, tag, node_comm);
+            AssertThrowMPI(ierr);
+          }
+        piece.clear();
       }
+
+    ierr = MPI_Comm_free(&node_comm);
+    AssertThrowMPI(ierr);
+
+    // the first process of each node writes. since the processes keep their
+    // relative order, the first process of comm is among the writers and
+    // writes the header, as required for the case of an empty output
+    MPI_Comm writer_comm;
+    ierr = MPI_Comm_split(
+      comm, node_rank == 0 ? 0 : MPI_UNDEFINED, myrank, &writer_comm);
+    AssertThrowMPI(ierr);
+
+    return writer_comm;
   }
+#endif
+} // namespace
+
 
-  // Make sure we sync to disk. As written in the standard,
-  // MPI_File_close() actually already implies a sync but there seems
-  // to be a bug on at least one configuration (running with multiple
-  // nodes using OpenMPI 4.1) that requires it. Without this call, the
-  // footer is sometimes missing.
-  ierr = MPI_File_sync(fh);
-  AssertThrowMPI(ierr);
 
-  ierr = MPI_File_close(&fh);
+namespace DataOutBase
+{
+  template <int spacedim>
+  void
+  write_vtu_point_cloud_in_parallel(
+    const std::string &                 filename,
+    const std::vector<Point<spacedim>> &points,
+    const Table<2, float> &             data,
+    const std::vector<std::string> &    data_names,
+    const std::vector<
+      std::tuple<unsigned int,
+                 unsigned int,
+                 std::string,
+                 DataComponentInterpretation::DataComponentInterpretation>>
+      &             nonscalar_data_ranges,
+    const VtkFlags &flags,
+    const MPI_Comm &comm)
+  {
+#ifndef DEAL_II_WITH_MPI
+    (void)comm;
+
+    std::ofstream f(filename);
+    AssertThrow(f, ExcFileNotOpen(filename));
+    write_vtu_header(f, flags);
+    write_vtu_point_cloud_main(
+      points, data, data_names, nonscalar_data_ranges, flags, f);
+    write_vtu_footer(f);
+#else
+    // as in DataOutInterface::create_vtu_piece(), only write empty pieces
+    // if there are no points at all
+    const types::global_dof_index n_points = points.size();
+    const types::global_dof_index global_n_points =
+      Utilities::MPI::sum(n_points, comm);
+    std::stringstream ss;
+    if (n_points > 0 ||
+        (global_n_points == 0 && Utilities::MPI::this_mpi_process(comm) == 0))
+      write_vtu_point_cloud_main(
+        points, data, data_names, nonscalar_data_ranges, flags, ss);
+    write_vtu_pieces_in_parallel(filename, ss.str(), flags, comm);
+#endif
+  }
+} // namespace DataOutBase
+
+
+
+template <int dim, int spacedim>
+std::string
+DataOutInterface<dim, spacedim>::create_vtu_piece(const MPI_Comm &comm) const
+{
+  const auto &                  patches      = get_patches();
+  const types::global_dof_index my_n_patches = patches.size();
+  const types::global_dof_index global_n_patches =
+    Utilities::MPI::sum(my_n_patches, comm);
+
+  // Do not write pieces with 0 cells as this will crash paraview if this is
+  // the first piece written. But if nobody has any pieces to write (file is
+  // empty), let processor 0 write their empty data, otherwise the vtk file is
+  // invalid.
+  std::stringstream ss;
+  if (my_n_patches > 0 ||
+      (global_n_patches == 0 && Utilities::MPI::this_mpi_process(comm) == 0))
+    DataOutBase::write_vtu_main(patches,
+                                get_dataset_names(),
+                                get_nonscalar_data_ranges(),
+                                vtk_flags,
+                                ss);
+  return ss.str();
+}
+
+
+
+template <int dim, int spacedim>
+void
+DataOutInterface<dim, spacedim>::write_vtu_in_parallel(
+  const std::string &filename,
+  const MPI_Comm &   comm) const
+{
+#ifndef DEAL_II_WITH_MPI
+  // without MPI fall back to the normal way to write a vtu file:
+  (void)comm;
+
+  std::ofstream f(filename);
+  AssertThrow(f, ExcFileNotOpen(filename));
+  write_vtu(f);
+#else
+  if (vtk_flags.aggregate_on_shared_memory_nodes)
+    {
+      std::string piece       = create_vtu_piece(comm);
+      MPI_Comm    writer_comm = aggregate_vtu_pieces_on_nodes(piece, comm);
+      if (writer_comm != MPI_COMM_NULL)
+        {
+          write_vtu_pieces_in_parallel(filename, piece, vtk_flags, writer_comm);
+          Utilities::MPI::free_communicator(writer_comm);
+        }
+
+      // make sure the file is complete on all processes upon return, as in
+      // the case without aggregation
+      const int ierr = MPI_Barrier(comm);
+      AssertThrowMPI(ierr);
+    }
+  else
+    write_vtu_pieces_in_parallel(filename,
+                                 create_vtu_piece(comm),
+                                 vtk_flags,
+                                 comm);
+#endif
+}
+
+
+
+template <int dim, int spacedim>
+Threads::Task<void>
+DataOutInterface<dim, spacedim>::write_vtu_in_parallel_async(
+  const std::string &filename,
+  const MPI_Comm &   comm) const
+{
+#ifndef DEAL_II_WITH_MPI
+  // without MPI, create the file contents here and only write them to disk
+  // on a separate task
+  (void)comm;
+
+  std::ostringstream ss;
+  write_vtu(ss);
+  return Threads::new_task([filename, contents = ss.str()]() {
+    std::ofstream f(filename);
+    AssertThrow(f, ExcFileNotOpen(filename));
+    f << contents;
+    f.close();
+    AssertThrow(f, ExcIO());
+  });
+#else
+  int thread_support = MPI_THREAD_SINGLE;
+  int ierr           = MPI_Query_thread(&thread_support);
   AssertThrowMPI(ierr);
+
+  // the collective MPI I/O calls can only be made from another thread if
+  // MPI was initialized with full thread support. otherwise write
+  // synchronously and return a task that has nothing left to do
+  if (thread_support < MPI_THREAD_MULTIPLE)
+    {
+      write_vtu_in_parallel(filename, comm);
+      return Threads::new_task([]() {});
+    }
+
+  // the task gets its own communicator, so that the collective operations of
+  // several outstanding writes and the ones of the caller cannot interfere.
+  // the piece is created here, as the patches may change as soon as this
+  // function returns
+  std::string piece = create_vtu_piece(comm);
+  MPI_Comm    task_comm =
+    (vtk_flags.aggregate_on_shared_memory_nodes ?
+       aggregate_vtu_pieces_on_nodes(piece, comm) :
+       Utilities::MPI::duplicate_communicator(comm));
+  if (task_comm == MPI_COMM_NULL)
+    return Threads::new_task([]() {});
+
+  return Threads::new_task([filename,
+                            piece     = std::move(piece),
+                            vtk_flags = this->vtk_flags,
+                            task_comm]() mutable {
+    write_vtu_pieces_in_parallel(filename, piece, vtk_flags, task_comm);
+    Utilities::MPI::free_communicator(task_comm);
+  });
 #endif
 }
 
@@ -8797,23 +9289,79 @@ DataOutInterface<dim, spacedim>::write_xdmf_file(
     {
       std::ofstream xdmf_file(filename);
 
-      xdmf_file << "<?xml version=\"1.0\" ?>\n";
-      xdmf_file << "<!DOCTYPE Xdmf SYSTEM \"Xdmf.dtd\" []>\n";
-      xdmf_file << "<Xdmf Version=\"2.0\">\n";
-      xdmf_file << "  <Domain>\n";
-      xdmf_file
-        << "    <Grid Name=\"CellTime\" GridType=\"Collection\" CollectionType=\"Temporal\">\n";
+      xdmf_file << xdmf_file_header;
 
       for (const auto &entry : entries)
         {
           xdmf_file << entry.get_xdmf_content(3);
         }
 
-      xdmf_file << "    </Grid>\n";
-      xdmf_file << "  </Domain>\n";
-      xdmf_file << "</Xdmf>\n";
+      xdmf_file << xdmf_file_footer;
+
+      xdmf_file.close();
+    }
+}
+
+
+
+template <int dim, int spacedim>
+void
+DataOutInterface<dim, spacedim>::append_xdmf_entry(
+  const XDMFEntry &  entry,
+  const std::string &filename,
+  const MPI_Comm &   comm) const
+{
+#ifdef DEAL_II_WITH_MPI
+  const int myrank = Utilities::MPI::this_mpi_process(comm);
+#else
+  (void)comm;
+  const int myrank = 0;
+#endif
+
+  // Only rank 0 process writes the XDMF file
+  if (myrank == 0)
+    {
+      const std::size_t footer_size = std::strlen(xdmf_file_footer);
+
+      std::fstream xdmf_file(filename,
+                             std::ios::in | std::ios::out | std::ios::binary);
+      std::streamoff file_size = 0;
+      if (xdmf_file)
+        {
+          xdmf_file.seekg(0, std::ios::end);
+          file_size = xdmf_file.tellg();
+        }
+
+      if (file_size <= 0)
+        {
+          // start a new file
+          xdmf_file.close();
+          xdmf_file.open(filename, std::ios::out | std::ios::trunc);
+          AssertThrow(xdmf_file, ExcFileNotOpen(filename));
+          xdmf_file << xdmf_file_header;
+        }
+      else
+        {
+          // check that the file ends in the footer we wrote and overwrite it
+          // with the new entry
+          AssertThrow(file_size >= static_cast<std::streamoff>(footer_size),
+                      ExcMessage("The file <" + filename +
+                                 "> is not a valid XDMF file."));
+          std::string footer(footer_size, '\0');
+          xdmf_file.seekg(file_size - footer_size);
+          xdmf_file.read(&footer[0], footer_size);
+          AssertThrow(xdmf_file && footer == xdmf_file_footer,
+                      ExcMessage("The file <" + filename +
+                                 "> was not written by write_xdmf_file() or "
+                                 "append_xdmf_entry()."));
+          xdmf_file.seekp(file_size - footer_size);
+        }
+
+      xdmf_file << entry.get_xdmf_content(3);
+      xdmf_file << xdmf_file_footer;
 
       xdmf_file.close();
+      AssertThrow(xdmf_file, ExcIO());
     }
 }
 
@@ -8838,17 +9386,87 @@ DataOutInterface<dim, spacedim>::write_filtered_data(
 namespace
 {
 #ifdef DEAL_II_WITH_HDF5
+  /**
+   * Return a dataset creation property list that stores a two-dimensional
+   * dataset of size @p dims, with elements of @p element_size bytes, in
+   * chunks of about one megabyte compressed with the deflate filter, or
+   * H5P_DEFAULT if @p compression does not ask for compression. A property
+   * list different from H5P_DEFAULT needs to be closed with H5Pclose().
+   */
+  hid_t
+  create_hdf5_dataset_properties(
+    const hsize_t *                     dims,
+    const std::size_t                   element_size,
+    const DataOutBase::CompressionLevel compression)
+  {
+    if (compression == DataOutBase::CompressionLevel::no_compression ||
+        compression == DataOutBase::CompressionLevel::plain_text ||
+        dims[0] == 0 || dims[1] == 0)
+      return H5P_DEFAULT;
+
+#  if defined(H5_HAVE_PARALLEL) && !H5_VERSION_GE(1, 10, 2)
+    AssertThrow(false,
+                ExcMessage("Writing compressed datasets with parallel HDF5 "
+                           "requires HDF5 version 1.10.2 or later."));
+#  endif
+
+    unsigned int level = 6;
+    switch (compression)
+      {
+        case DataOutBase::CompressionLevel::best_speed:
+          level = 1;
+          break;
+        case DataOutBase::CompressionLevel::best_compression:
+          level = 9;
+          break;
+        default:
+          level = 6;
+      }
+
+    const hid_t properties = H5Pcreate(H5P_DATASET_CREATE);
+    AssertThrow(properties >= 0, ExcIO());
+
+    const hsize_t chunk_rows = std::max<hsize_t>(
+      1, std::min<hsize_t>(dims[0], (1 << 20) / (element_size * dims[1])));
+    const hsize_t chunk_dims[2] = {chunk_rows, dims[1]};
+    herr_t        status        = H5Pset_chunk(properties, 2, chunk_dims);
+    AssertThrow(status >= 0, ExcIO());
+    status = H5Pset_deflate(properties, level);
+    AssertThrow(status >= 0, ExcIO());
+
+    return properties;
+  }
+
+
+
+  /**
+   * Close the property list returned by create_hdf5_dataset_properties().
+   */
+  void
+  close_hdf5_dataset_properties(const hid_t properties)
+  {
+    if (properties != H5P_DEFAULT)
+      {
+        const herr_t status = H5Pclose(properties);
+        AssertThrow(status >= 0, ExcIO());
+      }
+  }
+
+
+
   /**
    * Helper function to actually perform the HDF5 output.
    */
   template <int dim, int spacedim>
   void
-  do_write_hdf5(const std::vector<DataOutBase::Patch<dim, spacedim>> &patches,
-                const DataOutBase::DataOutFilter &data_filter,
-                const bool                        write_mesh_file,
-                const std::string &               mesh_filename,
-                const std::string &               solution_filename,
-                const MPI_Comm &                  comm)
+  do_write_hdf5(
+    const std::vector<DataOutBase::Patch<dim, spacedim>> &patches,
+    const DataOutBase::DataOutFilter &                    data_filter,
+    const bool                                            write_mesh_file,
+    const std::string &                                   mesh_filename,
+    const std::string &                                   solution_filename,
+    const MPI_Comm &                                      comm,
+    const DataOutBase::CompressionLevel                   compression)
   {
     hid_t h5_mesh_file_id = -1, h5_solution_file_id, file_plist_id, plist_id;
     hid_t node_dataspace, node_dataset, node_file_dataspace,
@@ -8939,38 +9557,45 @@ namespace
         AssertThrow(cell_dataspace >= 0, ExcIO());
 
         // Create the dataset for the nodes and cells
+        const hid_t node_properties = create_hdf5_dataset_properties(
+          node_ds_dim, sizeof(double), compression);
 #  if H5Gcreate_vers == 1
         node_dataset = H5Dcreate(h5_mesh_file_id,
                                  "nodes",
                                  H5T_NATIVE_DOUBLE,
                                  node_dataspace,
-                                 H5P_DEFAULT);
+                                 node_properties);
 #  else
         node_dataset    = H5Dcreate(h5_mesh_file_id,
                                  "nodes",
                                  H5T_NATIVE_DOUBLE,
                                  node_dataspace,
                                  H5P_DEFAULT,
-                                 H5P_DEFAULT,
+                                 node_properties,
                                  H5P_DEFAULT);
 #  endif
         AssertThrow(node_dataset >= 0, ExcIO());
+        close_hdf5_dataset_properties(node_properties);
+
+        const hid_t cell_properties = create_hdf5_dataset_properties(
+          cell_ds_dim, sizeof(unsigned int), compression);
 #  if H5Gcreate_vers == 1
         cell_dataset = H5Dcreate(h5_mesh_file_id,
                                  "cells",
                                  H5T_NATIVE_UINT,
                                  cell_dataspace,
-                                 H5P_DEFAULT);
+                                 cell_properties);
 #  else
         cell_dataset    = H5Dcreate(h5_mesh_file_id,
                                  "cells",
                                  H5T_NATIVE_UINT,
                                  cell_dataspace,
                                  H5P_DEFAULT,
-                                 H5P_DEFAULT,
+                                 cell_properties,
                                  H5P_DEFAULT);
 #  endif
         AssertThrow(cell_dataset >= 0, ExcIO());
+        close_hdf5_dataset_properties(cell_properties);
 
         // Close the node and cell dataspaces since we're done with them
         status = H5Sclose(node_dataspace);
@@ -9090,22 +9715,25 @@ namespace
         pt_data_dataspace = H5Screate_simple(2, node_ds_dim, nullptr);
         AssertThrow(pt_data_dataspace >= 0, ExcIO());
 
+        const hid_t pt_data_properties = create_hdf5_dataset_properties(
+          node_ds_dim, sizeof(double), compression);
 #  if H5Gcreate_vers == 1
         pt_data_dataset = H5Dcreate(h5_solution_file_id,
                                     vector_name.c_str(),
                                     H5T_NATIVE_DOUBLE,
                                     pt_data_dataspace,
-                                    H5P_DEFAULT);
+                                    pt_data_properties);
 #  else
         pt_data_dataset = H5Dcreate(h5_solution_file_id,
                                     vector_name.c_str(),
                                     H5T_NATIVE_DOUBLE,
                                     pt_data_dataspace,
                                     H5P_DEFAULT,
-                                    H5P_DEFAULT,
+                                    pt_data_properties,
                                     H5P_DEFAULT);
 #  endif
         AssertThrow(pt_data_dataset >= 0, ExcIO());
+        close_hdf5_dataset_properties(pt_data_properties);
 
         // Create the data subset we'll use to read from memory
         count[0]                 = local_node_cell_count[0];
@@ -9302,18 +9930,20 @@ DataOutInterface<dim, spacedim>::write_hdf5_parallel(
 template <int dim, int spacedim>
 void
 DataOutInterface<dim, spacedim>::write_hdf5_parallel(
-  const DataOutBase::DataOutFilter &data_filter,
-  const bool                        write_mesh_file,
-  const std::string &               mesh_filename,
-  const std::string &               solution_filename,
-  const MPI_Comm &                  comm) const
+  const DataOutBase::DataOutFilter &  data_filter,
+  const bool                          write_mesh_file,
+  const std::string &                 mesh_filename,
+  const std::string &                 solution_filename,
+  const MPI_Comm &                    comm,
+  const DataOutBase::CompressionLevel compression) const
 {
   DataOutBase::write_hdf5_parallel(get_patches(),
                                    data_filter,
                                    write_mesh_file,
                                    mesh_filename,
                                    solution_filename,
-                                   comm);
+                                   comm,
+                                   compression);
 }
 
 
@@ -9339,7 +9969,8 @@ DataOutBase::write_hdf5_parallel(
   const bool                               write_mesh_file,
   const std::string &                      mesh_filename,
   const std::string &                      solution_filename,
-  const MPI_Comm &                         comm)
+  const MPI_Comm &                         comm,
+  const CompressionLevel                   compression)
 {
   AssertThrow(
     spacedim >= 2,
@@ -9358,6 +9989,7 @@ DataOutBase::write_hdf5_parallel(
   (void)mesh_filename;
   (void)solution_filename;
   (void)comm;
+  (void)compression;
   AssertThrow(false, ExcNeedsHDF5());
 #else
 
@@ -9402,7 +10034,8 @@ DataOutBase::write_hdf5_parallel(
                                    write_mesh_file,
                                    mesh_filename,
                                    solution_filename,
-                                   split_comm);
+                                   split_comm,
+                                   compression);
     }
 
   ierr = MPI_Comm_free(&split_comm);
@@ -17,6 +17,7 @@
 #include <deal.II/base/memory_consumption.h>
 #include <deal.II/base/mpi.h>
 
+#include <array>
 #include <vector>
 
 #ifdef DEAL_II_WITH_TRILINOS
@@ -42,6 +43,7 @@ IndexSet::IndexSet(const Epetra_BlockMap &map)
   : is_compressed(true)
   , index_space_size(1 + map.MaxAllGID64())
   , largest_range(numbers::invalid_unsigned_int)
+  , range_lookup_shift(0)
 {
   Assert(map.MinAllGID64() == 0,
          ExcMessage(
@@ -69,6 +71,7 @@ IndexSet::IndexSet(const Epetra_BlockMap &map)
   : is_compressed(true)
   , index_space_size(1 + map.MaxAllGID())
   , largest_range(numbers::invalid_unsigned_int)
+  , range_lookup_shift(0)
 {
   Assert(map.MinAllGID() == 0,
          ExcMessage(
@@ -150,6 +153,31 @@ IndexSet::do_compress() const
           largest_range      = i - ranges.begin();
         }
     }
+
+  // for sets with many ranges, build the table for finding the range of an
+  // index in index_within_set(). choose the block size as the smallest power
+  // of two for which there are no more blocks than ranges
+  range_lookup.clear();
+  range_lookup_shift = 0;
+  if (ranges.size() >= 16)
+    {
+      while ((index_space_size >> range_lookup_shift) > ranges.size())
+        ++range_lookup_shift;
+      const size_type n_blocks =
+        ((index_space_size - 1) >> range_lookup_shift) + 1;
+
+      range_lookup.resize(n_blocks + 1);
+      unsigned int r = 0;
+      for (size_type b = 0; b < n_blocks; ++b)
+        {
+          const size_type block_begin = b << range_lookup_shift;
+          while (r < ranges.size() && ranges[r].end <= block_begin)
+            ++r;
+          range_lookup[b] = r;
+        }
+      range_lookup[n_blocks] = ranges.size();
+    }
+
   is_compressed = true;
 
   // check that next_index is correct. needs to be after the previous
@@ -487,6 +515,80 @@ IndexSet::add_indices(const IndexSet &other, const size_type offset)
 }
 
 
+namespace
+{
+  /**
+   * Sort the given indices, all of which are less than @p index_space_size,
+   * with a least-significant-digit radix sort that processes eight bits per
+   * pass. Only as many passes are done as there are bytes in
+   * <tt>index_space_size-1</tt>.
+   */
+  void
+  radix_sort_indices(std::vector<IndexSet::size_type> &indices,
+                     const IndexSet::size_type         index_space_size)
+  {
+    using size_type = IndexSet::size_type;
+
+    std::vector<size_type> sorted(indices.size());
+    const size_type        max_index = index_space_size - 1;
+    for (unsigned int shift = 0;
+         shift < 8 * sizeof(size_type) && (max_index >> shift) > 0;
+         shift += 8)
+      {
+        std::array<std::size_t, 257> offsets = {};
+        for (const size_type i : indices)
+          ++offsets[((i >> shift) & 0xff) + 1];
+        for (unsigned int d = 0; d < 256; ++d)
+          offsets[d + 1] += offsets[d];
+        for (const size_type i : indices)
+          sorted[offsets[(i >> shift) & 0xff]++] = i;
+        indices.swap(sorted);
+      }
+  }
+} // namespace
+
+
+
+void
+IndexSet::add_unsorted_indices(std::vector<size_type> &indices)
+{
+  if (indices.empty())
+    return;
+
+  // radix sorting only pays off beyond a certain size
+  if (indices.size() > 256)
+    {
+      for (const size_type i : indices)
+        AssertIndexRange(i, index_space_size);
+      radix_sort_indices(indices, index_space_size);
+    }
+  else
+    std::sort(indices.begin(), indices.end());
+  indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+  AssertIndexRange(indices.back(), index_space_size);
+
+  // form the ranges of consecutive indices in one sweep
+  IndexSet new_indices(index_space_size);
+  for (std::size_t p = 0; p < indices.size();)
+    {
+      std::size_t q = p + 1;
+      while (q < indices.size() && indices[q] == indices[q - 1] + 1)
+        ++q;
+      new_indices.ranges.emplace_back(indices[p], indices[q - 1] + 1);
+      p = q;
+    }
+  new_indices.is_compressed = false;
+
+  if (ranges.empty())
+    {
+      new_indices.compress();
+      std::swap(*this, new_indices);
+    }
+  else
+    add_indices(new_indices);
+}
+
+
 
 void
 IndexSet::write(std::ostream &out) const
@@ -618,9 +720,27 @@ IndexSet::index_within_set_binary_search(const size_type n) const
   // we could try to use the main range for splitting up the search range, but
   // since we only come here when the largest range did not contain the index,
   // there is little gain from doing a first step manually.
+  //
+  // if there is a lookup table, it narrows the search down to the few ranges
+  // that overlap with the block of the index space that n lies in (plus the
+  // first range that extends beyond that block)
+  std::vector<Range>::const_iterator search_begin = ranges.begin(),
+                                     search_end   = ranges.end();
+  if (!range_lookup.empty())
+    {
+      const size_type block = n >> range_lookup_shift;
+      AssertIndexRange(block + 1, range_lookup.size());
+      search_begin = ranges.begin() + range_lookup[block];
+      search_end   = ranges.begin() +
+                   std::min<std::size_t>(range_lookup[block + 1] + 1,
+                                         ranges.size());
+    }
+
   Range                              r(n, n);
   std::vector<Range>::const_iterator p =
-    Utilities::lower_bound(ranges.begin(), ranges.end(), r, Range::end_compare);
+    Utilities::lower_bound(search_begin, search_end, r, Range::end_compare);
+  if (p == search_end)
+    p = ranges.end();
 
   // if n is not in this set
   if (p == ranges.end() || p->end == n || p->begin > n)
@@ -915,6 +1035,7 @@ IndexSet::memory_consumption() const
   return (MemoryConsumption::memory_consumption(ranges) +
           MemoryConsumption::memory_consumption(is_compressed) +
           MemoryConsumption::memory_consumption(index_space_size) +
+          MemoryConsumption::memory_consumption(range_lookup) +
           sizeof(compress_mutex));
 }
 
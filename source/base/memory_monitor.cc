@@ -0,0 +1,199 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/memory_monitor.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/utilities.h>
+
+#include <boost/io/ios_state.hpp>
+
+#include <algorithm>
+#include <iomanip>
+
+DEAL_II_NAMESPACE_OPEN
+
+
+MemoryMonitor::MemoryMonitor(const MPI_Comm &mpi_comm, std::ostream &stream)
+  : mpi_comm(mpi_comm)
+  , out_stream(stream, Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+{}
+
+
+
+MemoryMonitor::MemoryMonitor(const MPI_Comm &    mpi_comm,
+                             ConditionalOStream &stream)
+  : mpi_comm(mpi_comm)
+  , out_stream(stream.get_stream(),
+               stream.is_active() &&
+                 Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+{}
+
+
+
+void
+MemoryMonitor::add(const std::string &                 subsystem,
+                   const std::function<std::size_t()> &memory_function)
+{
+  Assert(memory_function, ExcMessage("The memory function must not be empty."));
+  subsystems[subsystem].memory_functions.push_back(memory_function);
+}
+
+
+
+void
+MemoryMonitor::remove(const std::string &subsystem)
+{
+  subsystems.erase(subsystem);
+}
+
+
+
+void
+MemoryMonitor::update()
+{
+  for (auto &entry : subsystems)
+    {
+      Subsystem &data     = entry.second;
+      data.current_memory = 0;
+      for (const auto &memory_function : data.memory_functions)
+        data.current_memory += memory_function();
+      data.peak_memory = std::max(data.peak_memory, data.current_memory);
+    }
+}
+
+
+
+std::size_t
+MemoryMonitor::get_current_memory(const std::string &subsystem) const
+{
+  const auto it = subsystems.find(subsystem);
+  Assert(it != subsystems.end(),
+         ExcMessage("No subsystem named <" + subsystem +
+                    "> has been registered."));
+  return it->second.current_memory;
+}
+
+
+
+std::size_t
+MemoryMonitor::get_peak_memory(const std::string &subsystem) const
+{
+  const auto it = subsystems.find(subsystem);
+  Assert(it != subsystems.end(),
+         ExcMessage("No subsystem named <" + subsystem +
+                    "> has been registered."));
+  return it->second.peak_memory;
+}
+
+
+
+void
+MemoryMonitor::print_summary() const
+{
+  // we are going to change the precision and width of output below. store the
+  // old values so the get restored when exiting this function
+  const boost::io::ios_base_all_saver restore_stream(out_stream.get_stream());
+
+  AssertDimension(subsystems.size(),
+                  Utilities::MPI::max(subsystems.size(), mpi_comm));
+
+  // collect the rows of the table, the subsystems followed by the memory
+  // obtained from allocate_aligned() and the memory of the process
+  std::vector<std::string>                         names;
+  std::vector<std::pair<std::size_t, std::size_t>> memory;
+  for (const auto &entry : subsystems)
+    {
+      names.push_back(entry.first);
+      memory.emplace_back(entry.second.current_memory,
+                          entry.second.peak_memory);
+    }
+
+  const Utilities::System::AlignedMemoryStatistics aligned_statistics =
+    Utilities::System::get_aligned_memory_statistics();
+  names.emplace_back("Aligned memory (all)");
+  memory.emplace_back(aligned_statistics.bytes_in_use,
+                      aligned_statistics.peak_bytes_in_use);
+
+  Utilities::System::MemoryStats process_statistics;
+  Utilities::System::get_memory_stats(process_statistics);
+  names.emplace_back("Process (VmRSS, VmHWM)");
+  memory.emplace_back(process_statistics.VmRSS * 1024,
+                      process_statistics.VmHWM * 1024);
+
+  // get the maximum width among all rows; 24 is the default width until the
+  // first | character
+  unsigned int max_width = 0;
+  for (const std::string &name : names)
+    max_width = std::max(max_width, static_cast<unsigned int>(name.size()));
+  max_width                    = std::max(max_width + 1, 24U);
+  const std::string extra_dash = std::string(max_width - 24, '-');
+
+  const unsigned int n_ranks = Utilities::MPI::n_mpi_processes(mpi_comm);
+
+  const auto print_statistics = [&](const std::size_t bytes) {
+    const Utilities::MPI::MinMaxAvg data =
+      Utilities::MPI::min_max_avg(bytes / 1024. / 1024., mpi_comm);
+
+    out_stream << std::setw(10) << std::setprecision(4) << std::right;
+    out_stream << data.min << " ";
+    out_stream << std::setw(5) << std::right;
+    out_stream << data.min_index << (n_ranks > 99999 ? "" : " ") << "|";
+    out_stream << std::setw(10) << std::setprecision(4) << std::right;
+    out_stream << data.avg << " |";
+    out_stream << std::setw(10) << std::setprecision(4) << std::right;
+    out_stream << data.max << " ";
+    out_stream << std::setw(5) << std::right;
+    out_stream << data.max_index << (n_ranks > 99999 ? "" : " ") << "|";
+  };
+
+  const std::string statistics_dash =
+    "-----------------+-----------+-----------------+";
+  const std::string statistics_header =
+    " min      rank   |    avg    | max      rank   |";
+
+  out_stream << '\n'
+             << "+-------------------------" << extra_dash << "+"
+             << statistics_dash << statistics_dash << '\n'
+             << "| Memory in MB            " << std::string(max_width - 24, ' ')
+             << "|" << std::setw(47) << std::left << " current"
+             << "|" << std::setw(47) << std::left << " peak"
+             << "|\n"
+             << "| Subsystem               " << std::string(max_width - 24, ' ')
+             << "|" << statistics_header << statistics_header << '\n'
+             << "+-------------------------" << extra_dash << "+"
+             << statistics_dash << statistics_dash << '\n';
+
+  for (unsigned int i = 0; i < names.size(); ++i)
+    {
+      std::string name_out = names[i];
+      name_out.resize(max_width, ' ');
+      out_stream << "| " << name_out << "|";
+      print_statistics(memory[i].first);
+      print_statistics(memory[i].second);
+      out_stream << '\n';
+
+      // separate the subsystems from the totals
+      if (i + 3 == names.size())
+        out_stream << "+-------------------------" << extra_dash << "+"
+                   << statistics_dash << statistics_dash << '\n';
+    }
+
+  out_stream << "+-------------------------" << extra_dash << "+"
+             << statistics_dash << statistics_dash << '\n'
+             << std::endl;
+}
+
+DEAL_II_NAMESPACE_CLOSE
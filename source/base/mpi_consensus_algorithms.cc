@@ -0,0 +1,416 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/mpi_consensus_algorithms.h>
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <memory>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace Utilities
+{
+  namespace MPI
+  {
+    namespace ConsensusAlgorithms
+    {
+#ifdef DEAL_II_WITH_MPI
+      namespace internal
+      {
+        namespace
+        {
+          /**
+           * The header stored in front of the payload of each message by
+           * append_message().
+           */
+          struct MessageHeader
+          {
+            unsigned int  sender;
+            unsigned int  receiver;
+            std::uint64_t payload_size;
+          };
+
+
+
+          /**
+           * The function called by MPI when a communicator with an attached
+           * NodeTopology is freed.
+           */
+          int
+          delete_node_topology(MPI_Comm, int, void *attribute, void *)
+          {
+            NodeTopology *topology = static_cast<NodeTopology *>(attribute);
+
+            int ierr = MPI_Comm_free(&topology->node_comm);
+            if (ierr != MPI_SUCCESS)
+              return ierr;
+            if (topology->leader_comm != MPI_COMM_NULL)
+              {
+                ierr = MPI_Comm_free(&topology->leader_comm);
+                if (ierr != MPI_SUCCESS)
+                  return ierr;
+              }
+
+            delete topology;
+            return MPI_SUCCESS;
+          }
+
+
+
+          /**
+           * Compute the offsets of the blocks of a buffer with the given
+           * block sizes, as needed by the vector variants of MPI_Gather and
+           * MPI_Scatter.
+           */
+          std::vector<int>
+          compute_offsets(const std::vector<int> &sizes)
+          {
+            std::vector<int> offsets(sizes.size() + 1, 0);
+            for (unsigned int i = 0; i < sizes.size(); ++i)
+              {
+                AssertThrow(static_cast<std::int64_t>(offsets[i]) + sizes[i] <=
+                              std::numeric_limits<int>::max(),
+                            ExcMessage("The messages of a node are too large "
+                                       "to be communicated."));
+                offsets[i + 1] = offsets[i] + sizes[i];
+              }
+            return offsets;
+          }
+        } // namespace
+
+
+
+        const NodeTopology &
+        get_node_topology(const MPI_Comm &comm)
+        {
+          static const int keyval = []() {
+            int       keyval;
+            const int ierr = MPI_Comm_create_keyval(MPI_COMM_NULL_COPY_FN,
+                                                    &delete_node_topology,
+                                                    &keyval,
+                                                    nullptr);
+            AssertThrowMPI(ierr);
+            return keyval;
+          }();
+
+          void *attribute = nullptr;
+          int   flag      = 0;
+          int   ierr      = MPI_Comm_get_attr(comm, keyval, &attribute, &flag);
+          AssertThrowMPI(ierr);
+          if (flag != 0)
+            return *static_cast<NodeTopology *>(attribute);
+
+          auto topology = std::make_unique<NodeTopology>();
+
+          const unsigned int my_rank = Utilities::MPI::this_mpi_process(comm);
+          ierr                       = MPI_Comm_split_type(comm,
+                                     MPI_COMM_TYPE_SHARED,
+                                     my_rank,
+                                     MPI_INFO_NULL,
+                                     &topology->node_comm);
+          AssertThrowMPI(ierr);
+
+          const unsigned int node_size =
+            Utilities::MPI::n_mpi_processes(topology->node_comm);
+          topology->node_ranks.resize(node_size);
+          ierr = MPI_Allgather(&my_rank,
+                               1,
+                               MPI_UNSIGNED,
+                               topology->node_ranks.data(),
+                               1,
+                               MPI_UNSIGNED,
+                               topology->node_comm);
+          AssertThrowMPI(ierr);
+
+          const bool is_leader =
+            (Utilities::MPI::this_mpi_process(topology->node_comm) == 0);
+          ierr = MPI_Comm_split(comm,
+                                is_leader ? 0 : MPI_UNDEFINED,
+                                my_rank,
+                                &topology->leader_comm);
+          AssertThrowMPI(ierr);
+
+          topology->max_node_size = Utilities::MPI::max(node_size, comm);
+
+          // Let the leaders know the node of each process
+          if (is_leader)
+            {
+              const unsigned int n_nodes =
+                Utilities::MPI::n_mpi_processes(topology->leader_comm);
+              std::vector<int> node_sizes(n_nodes);
+              const int        my_node_size = node_size;
+              ierr                          = MPI_Allgather(&my_node_size,
+                                   1,
+                                   MPI_INT,
+                                   node_sizes.data(),
+                                   1,
+                                   MPI_INT,
+                                   topology->leader_comm);
+              AssertThrowMPI(ierr);
+
+              const std::vector<int> offsets = compute_offsets(node_sizes);
+              std::vector<unsigned int> all_ranks(offsets.back());
+              ierr = MPI_Allgatherv(topology->node_ranks.data(),
+                                    my_node_size,
+                                    MPI_UNSIGNED,
+                                    all_ranks.data(),
+                                    node_sizes.data(),
+                                    offsets.data(),
+                                    MPI_UNSIGNED,
+                                    topology->leader_comm);
+              AssertThrowMPI(ierr);
+
+              topology->leader_of_rank.resize(
+                Utilities::MPI::n_mpi_processes(comm));
+              for (unsigned int node = 0; node < n_nodes; ++node)
+                for (int i = offsets[node]; i < offsets[node + 1]; ++i)
+                  topology->leader_of_rank[all_ranks[i]] = node;
+            }
+
+          ierr = MPI_Comm_set_attr(comm, keyval, topology.get());
+          AssertThrowMPI(ierr);
+
+          return *topology.release();
+        }
+
+
+
+        void
+        append_message(const unsigned int                       sender,
+                       const unsigned int                       receiver,
+                       const std::vector<char>::const_iterator &payload_begin,
+                       const std::vector<char>::const_iterator &payload_end,
+                       std::vector<char> &                      buffer)
+        {
+          MessageHeader header;
+          header.sender       = sender;
+          header.receiver     = receiver;
+          header.payload_size = payload_end - payload_begin;
+
+          const std::size_t old_size = buffer.size();
+          buffer.resize(old_size + sizeof(MessageHeader));
+          std::memcpy(buffer.data() + old_size, &header, sizeof(MessageHeader));
+          buffer.insert(buffer.end(), payload_begin, payload_end);
+        }
+
+
+
+        void
+        for_each_message(
+          const std::vector<char> &buffer,
+          const std::function<void(const unsigned int,
+                                   const unsigned int,
+                                   const std::vector<char>::const_iterator &,
+                                   const std::vector<char>::const_iterator &)>
+            &function)
+        {
+          auto position = buffer.cbegin();
+          while (position != buffer.cend())
+            {
+              Assert(static_cast<std::size_t>(buffer.cend() - position) >=
+                       sizeof(MessageHeader),
+                     ExcInternalError());
+              MessageHeader header;
+              std::memcpy(&header, &*position, sizeof(MessageHeader));
+              position += sizeof(MessageHeader);
+
+              Assert(static_cast<std::uint64_t>(buffer.cend() - position) >=
+                       header.payload_size,
+                     ExcInternalError());
+              const auto payload_end = position + header.payload_size;
+              function(header.sender, header.receiver, position, payload_end);
+              position = payload_end;
+            }
+        }
+
+
+
+        std::vector<char>
+        gather_messages_on_leader(const std::vector<char> &messages,
+                                  const NodeTopology &     topology)
+        {
+          const bool is_leader = (topology.leader_comm != MPI_COMM_NULL);
+
+          AssertThrow(messages.size() <=
+                        static_cast<std::size_t>(
+                          std::numeric_limits<int>::max()),
+                      ExcMessage("The messages of a process are too large "
+                                 "to be communicated."));
+          const int        my_size = messages.size();
+          std::vector<int> sizes(is_leader ? topology.node_ranks.size() : 0);
+          int              ierr = MPI_Gather(&my_size,
+                                1,
+                                MPI_INT,
+                                sizes.data(),
+                                1,
+                                MPI_INT,
+                                0,
+                                topology.node_comm);
+          AssertThrowMPI(ierr);
+
+          const std::vector<int> offsets = compute_offsets(sizes);
+          std::vector<char>      node_messages(offsets.back());
+          ierr = MPI_Gatherv(messages.data(),
+                             my_size,
+                             MPI_CHAR,
+                             node_messages.data(),
+                             sizes.data(),
+                             offsets.data(),
+                             MPI_CHAR,
+                             0,
+                             topology.node_comm);
+          AssertThrowMPI(ierr);
+
+          return node_messages;
+        }
+
+
+
+        std::vector<char>
+        route_messages_between_nodes(const std::vector<char> &messages,
+                                     const NodeTopology &     topology)
+        {
+          if (topology.leader_comm == MPI_COMM_NULL)
+            return {};
+
+          const unsigned int my_node =
+            Utilities::MPI::this_mpi_process(topology.leader_comm);
+
+          // Sort the messages by the node of their receivers. The messages
+          // for the own node do not need to be sent.
+          std::vector<char>                         node_messages;
+          std::map<unsigned int, std::vector<char>> send_buffers;
+          for_each_message(
+            messages,
+            [&](const unsigned int                       sender,
+                const unsigned int                       receiver,
+                const std::vector<char>::const_iterator &begin,
+                const std::vector<char>::const_iterator &end) {
+              AssertIndexRange(receiver, topology.leader_of_rank.size());
+              const unsigned int node = topology.leader_of_rank[receiver];
+              append_message(sender,
+                             receiver,
+                             begin,
+                             end,
+                             node == my_node ? node_messages :
+                                               send_buffers[node]);
+            });
+
+          std::vector<unsigned int> target_nodes;
+          target_nodes.reserve(send_buffers.size());
+          for (const auto &buffer : send_buffers)
+            target_nodes.push_back(buffer.first);
+
+          nbx<std::vector<char>>(
+            target_nodes,
+            [&send_buffers](const unsigned int node) {
+              return send_buffers[node];
+            },
+            [&node_messages](const unsigned int,
+                             const std::vector<char> &buffer) {
+              node_messages.insert(node_messages.end(),
+                                   buffer.begin(),
+                                   buffer.end());
+            },
+            topology.leader_comm);
+
+          return node_messages;
+        }
+
+
+
+        std::vector<char>
+        scatter_messages_from_leader(const std::vector<char> &messages,
+                                     const NodeTopology &     topology)
+        {
+          const bool is_leader = (topology.leader_comm != MPI_COMM_NULL);
+
+          // On the leader, sort the messages by their receivers
+          std::vector<char> send_buffer;
+          std::vector<int>  sizes;
+          if (is_leader)
+            {
+              std::map<unsigned int, unsigned int> rank_on_node;
+              for (unsigned int i = 0; i < topology.node_ranks.size(); ++i)
+                rank_on_node[topology.node_ranks[i]] = i;
+
+              std::vector<std::vector<char>> buffers(
+                topology.node_ranks.size());
+              for_each_message(
+                messages,
+                [&](const unsigned int                       sender,
+                    const unsigned int                       receiver,
+                    const std::vector<char>::const_iterator &begin,
+                    const std::vector<char>::const_iterator &end) {
+                  const auto it = rank_on_node.find(receiver);
+                  Assert(it != rank_on_node.end(), ExcInternalError());
+                  append_message(
+                    sender, receiver, begin, end, buffers[it->second]);
+                });
+
+              sizes.resize(buffers.size());
+              for (unsigned int i = 0; i < buffers.size(); ++i)
+                {
+                  AssertThrow(buffers[i].size() <=
+                                static_cast<std::size_t>(
+                                  std::numeric_limits<int>::max()),
+                              ExcMessage("The messages of a process are too "
+                                         "large to be communicated."));
+                  sizes[i] = buffers[i].size();
+                  send_buffer.insert(send_buffer.end(),
+                                     buffers[i].begin(),
+                                     buffers[i].end());
+                }
+            }
+          const std::vector<int> offsets = compute_offsets(sizes);
+
+          int my_size = 0;
+          int ierr    = MPI_Scatter(sizes.data(),
+                                 1,
+                                 MPI_INT,
+                                 &my_size,
+                                 1,
+                                 MPI_INT,
+                                 0,
+                                 topology.node_comm);
+          AssertThrowMPI(ierr);
+
+          std::vector<char> my_messages(my_size);
+          ierr = MPI_Scatterv(send_buffer.data(),
+                              sizes.data(),
+                              offsets.data(),
+                              MPI_CHAR,
+                              my_messages.data(),
+                              my_size,
+                              MPI_CHAR,
+                              0,
+                              topology.node_comm);
+          AssertThrowMPI(ierr);
+
+          return my_messages;
+        }
+      } // namespace internal
+#endif
+    } // namespace ConsensusAlgorithms
+  }   // namespace MPI
+} // namespace Utilities
+
+DEAL_II_NAMESPACE_CLOSE
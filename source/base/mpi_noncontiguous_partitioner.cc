@@ -29,6 +29,23 @@ namespace Utilities
 {
   namespace MPI
   {
+    NoncontiguousPartitioner::PersistentRequests::~PersistentRequests()
+    {
+#ifdef DEAL_II_WITH_MPI
+      int finalized;
+      MPI_Finalized(&finalized);
+      if (finalized == 0)
+        for (auto &request : requests)
+          if (request != MPI_REQUEST_NULL)
+            {
+              const int ierr = MPI_Request_free(&request);
+              AssertNothrow(ierr == MPI_SUCCESS, ExcMPI(ierr));
+            }
+#endif
+    }
+
+
+
     NoncontiguousPartitioner::NoncontiguousPartitioner(
       const IndexSet &indexset_has,
       const IndexSet &indexset_want,
@@ -70,12 +87,19 @@ namespace Utilities
     {
       return MemoryConsumption::memory_consumption(send_ranks) +
              MemoryConsumption::memory_consumption(send_ptr) +
-             MemoryConsumption::memory_consumption(send_indices) +
+             MemoryConsumption::memory_consumption(send_indices_data) +
+             MemoryConsumption::memory_consumption(
+               send_indices_chunks_by_rank) +
              MemoryConsumption::memory_consumption(recv_ranks) +
              MemoryConsumption::memory_consumption(recv_ptr) +
-             MemoryConsumption::memory_consumption(recv_indices) +
+             MemoryConsumption::memory_consumption(recv_indices_data) +
+             MemoryConsumption::memory_consumption(
+               recv_indices_chunks_by_rank) +
              MemoryConsumption::memory_consumption(buffers) +
-             MemoryConsumption::memory_consumption(requests);
+             (persistent_requests != nullptr ?
+                MemoryConsumption::memory_consumption(
+                  persistent_requests->requests) :
+                0);
     }
 
 
@@ -92,6 +116,23 @@ namespace Utilities
     NoncontiguousPartitioner::reinit(const IndexSet &indexset_has,
                                      const IndexSet &indexset_want,
                                      const MPI_Comm &communicator)
+    {
+      std::vector<types::global_dof_index> send_indices;
+      std::vector<types::global_dof_index> recv_indices;
+      setup_communication_pattern(
+        indexset_has, indexset_want, communicator, send_indices, recv_indices);
+      compress_indices(send_indices, recv_indices);
+    }
+
+
+
+    void
+    NoncontiguousPartitioner::setup_communication_pattern(
+      const IndexSet &                      indexset_has,
+      const IndexSet &                      indexset_want,
+      const MPI_Comm &                      communicator,
+      std::vector<types::global_dof_index> &send_indices,
+      std::vector<types::global_dof_index> &recv_indices)
     {
       this->communicator = communicator;
 
@@ -103,7 +144,7 @@ namespace Utilities
       recv_ptr.clear();
       recv_indices.clear();
       buffers.clear();
-      requests.clear();
+      persistent_requests.reset();
 
       // setup communication pattern
       std::vector<unsigned int> owning_ranks_of_ghosts(
@@ -165,6 +206,52 @@ namespace Utilities
 
 
 
+    void
+    NoncontiguousPartitioner::compress_indices(
+      const std::vector<types::global_dof_index> &send_indices,
+      const std::vector<types::global_dof_index> &recv_indices)
+    {
+      // merge consecutive indices of each process into ranges, starting
+      // a new range at the beginning of the data of each process
+      const auto compress =
+        [](const std::vector<types::global_dof_index> &indices,
+           const std::vector<types::global_dof_index> &ptr,
+           const types::global_dof_index               offset,
+           std::vector<std::pair<types::global_dof_index,
+                                 types::global_dof_index>> &indices_data,
+           std::vector<unsigned int> &chunks_by_rank) {
+          indices_data.clear();
+          chunks_by_rank.clear();
+          chunks_by_rank.push_back(0);
+          for (unsigned int i = 0; i + 1 < ptr.size(); ++i)
+            {
+              for (types::global_dof_index j = ptr[i] - offset;
+                   j < ptr[i + 1] - offset;
+                   ++j)
+                if (j > ptr[i] - offset &&
+                    indices_data.back().second == indices[j])
+                  ++indices_data.back().second;
+                else
+                  indices_data.emplace_back(indices[j], indices[j] + 1);
+              chunks_by_rank.push_back(indices_data.size());
+            }
+          indices_data.shrink_to_fit();
+        };
+
+      compress(send_indices,
+               send_ptr,
+               recv_ptr.back(),
+               send_indices_data,
+               send_indices_chunks_by_rank);
+      compress(recv_indices,
+               recv_ptr,
+               0,
+               recv_indices_data,
+               recv_indices_chunks_by_rank);
+    }
+
+
+
     void
     NoncontiguousPartitioner::reinit(
       const std::vector<types::global_dof_index> &indices_has,
@@ -216,7 +303,13 @@ namespace Utilities
                                  indices_want_clean.end());
 
       // step 2) setup internal data structures with indexset
-      this->reinit(index_set_has, index_set_want, communicator);
+      std::vector<types::global_dof_index> send_indices;
+      std::vector<types::global_dof_index> recv_indices;
+      setup_communication_pattern(index_set_has,
+                                  index_set_want,
+                                  communicator,
+                                  send_indices,
+                                  recv_indices);
 
       // step 3) fix inner data structures so that it is sorted as
       //         in the original vector
@@ -243,6 +336,9 @@ namespace Utilities
         for (auto &i : recv_indices)
           i = temp_map_recv[i];
       }
+
+      // step 4) compress the indices into ranges
+      compress_indices(send_indices, recv_indices);
     }
   } // namespace MPI
 } // namespace Utilities
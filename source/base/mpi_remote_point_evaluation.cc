@@ -80,6 +80,7 @@ namespace Utilities
 
       this->tria    = &tria;
       this->mapping = &mapping;
+      this->points  = points;
 
       std::vector<BoundingBox<spacedim>> local_boxes;
       for (const auto &cell :
@@ -178,8 +179,9 @@ namespace Utilities
       Assert(enforce_unique_mapping == false || unique_mapping,
              ExcInternalError());
 
-      cell_data        = {};
-      send_permutation = {};
+      cell_data         = {};
+      cell_point_values = {};
+      send_permutation  = {};
 
       std::pair<int, int> dummy{-1, -1};
       for (const auto &i : data.send_components)
@@ -193,6 +195,7 @@ namespace Utilities
             }
 
           cell_data.reference_point_values.emplace_back(std::get<3>(i));
+          cell_point_values.emplace_back(std::get<4>(i));
           send_permutation.emplace_back(std::get<5>(i));
         }
 
@@ -204,6 +207,137 @@ namespace Utilities
     }
 
 
+    template <int dim, int spacedim>
+    bool
+    RemotePointEvaluation<dim, spacedim>::update_point_locations(
+      const Mapping<dim, spacedim> &mapping)
+    {
+#ifndef DEAL_II_WITH_MPI
+      Assert(false, ExcNeedsMPI());
+      (void)mapping;
+      return false;
+#else
+      Assert(tria != nullptr,
+             ExcMessage("This function can only be called after reinit()."));
+
+      // with multiple or no cells per point, the number of results per point
+      // might change, which requires a new communication pattern
+      bool needs_reinit = !unique_mapping;
+
+      // the points are evaluated on the same process as before if they are
+      // still in a locally owned cell, so only the cells and reference
+      // positions on the evaluation side need to be updated
+      std::vector<std::tuple<std::pair<int, int>,
+                             Point<dim>,
+                             Point<spacedim>,
+                             unsigned int>>
+                                                     new_components;
+      std::unique_ptr<GridTools::Cache<dim, spacedim>> cache;
+      for (unsigned int c = 0; c < cell_data.cells.size() && !needs_reinit;
+           ++c)
+        {
+          const typename Triangulation<dim, spacedim>::active_cell_iterator
+            cell(tria, cell_data.cells[c].first, cell_data.cells[c].second);
+
+          for (unsigned int j = cell_data.reference_point_ptrs[c];
+               j < cell_data.reference_point_ptrs[c + 1];
+               ++j)
+            {
+              const Point<spacedim> &point = cell_point_values[j];
+
+              // first try the cell the point has been found in before
+              try
+                {
+                  const Point<dim> reference_point =
+                    mapping.transform_real_to_unit_cell(cell, point);
+                  if (cell->reference_cell().contains_point(reference_point,
+                                                            tolerance))
+                    {
+                      new_components.emplace_back(cell_data.cells[c],
+                                                  reference_point,
+                                                  point,
+                                                  send_permutation[j]);
+                      continue;
+                    }
+                }
+              catch (typename Mapping<dim, spacedim>::ExcTransformationFailed &)
+                {}
+
+              // then search around that cell
+              if (cache == nullptr)
+                cache =
+                  std::make_unique<GridTools::Cache<dim, spacedim>>(*tria,
+                                                                     mapping);
+              const auto cell_and_reference_point =
+                GridTools::find_active_cell_around_point(
+                  *cache,
+                  point,
+                  cell,
+                  marked_vertices ? marked_vertices() : std::vector<bool>(),
+                  tolerance);
+
+              if (cell_and_reference_point.first == tria->end() ||
+                  !cell_and_reference_point.first->is_locally_owned())
+                {
+                  needs_reinit = true;
+                  break;
+                }
+
+              new_components.emplace_back(
+                std::make_pair(cell_and_reference_point.first->level(),
+                               cell_and_reference_point.first->index()),
+                cell_and_reference_point.second,
+                point,
+                send_permutation[j]);
+            }
+        }
+
+      if (Utilities::MPI::logical_or(needs_reinit, tria->get_communicator()))
+        {
+          const std::vector<Point<spacedim>> points = this->points;
+          reinit(points, *tria, mapping);
+          return false;
+        }
+
+      // group the points by cells again
+      std::stable_sort(new_components.begin(),
+                       new_components.end(),
+                       [](const auto &a, const auto &b) {
+                         return std::get<0>(a) < std::get<0>(b);
+                       });
+
+      cell_data         = {};
+      cell_point_values = {};
+      send_permutation  = {};
+
+      std::pair<int, int> dummy{-1, -1};
+      for (const auto &i : new_components)
+        {
+          if (dummy != std::get<0>(i))
+            {
+              dummy = std::get<0>(i);
+              cell_data.cells.emplace_back(dummy);
+              cell_data.reference_point_ptrs.emplace_back(
+                cell_data.reference_point_values.size());
+            }
+
+          cell_data.reference_point_values.emplace_back(std::get<1>(i));
+          cell_point_values.emplace_back(std::get<2>(i));
+          send_permutation.emplace_back(std::get<3>(i));
+        }
+
+      cell_data.reference_point_ptrs.emplace_back(
+        cell_data.reference_point_values.size());
+
+      this->mapping    = &mapping;
+      this->ready_flag = true;
+
+      return true;
+#endif
+    }
+
+
+
     template <int dim, int spacedim>
     const std::vector<unsigned int> &
     RemotePointEvaluation<dim, spacedim>::get_point_ptrs() const
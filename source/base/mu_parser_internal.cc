@@ -17,6 +17,8 @@
 #include <deal.II/base/thread_management.h>
 #include <deal.II/base/utilities.h>
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <ctime>
 #include <limits>
@@ -283,7 +285,8 @@ namespace internal
 
       // initialize the objects for the current thread
       data.parsers.reserve(n_components);
-      data.vars.resize(this->var_names.size());
+      data.vars.resize(this->var_names.size() *
+                       ParserData::max_bulk_size);
       for (unsigned int component = 0; component < n_components; ++component)
         {
           data.parsers.emplace_back(std::make_unique<Parser>());
@@ -293,7 +296,8 @@ namespace internal
             parser.DefineConst(constant.first, constant.second);
 
           for (unsigned int iv = 0; iv < this->var_names.size(); ++iv)
-            parser.DefineVar(this->var_names[iv], &data.vars[iv]);
+            parser.DefineVar(this->var_names[iv],
+                             &data.vars[iv * ParserData::max_bulk_size]);
 
           // define some compatibility functions:
           parser.DefineFun("if", mu_if, true);
@@ -388,9 +392,9 @@ namespace internal
         init_muparser();
 
       for (unsigned int i = 0; i < dim; ++i)
-        data.vars[i] = p(i);
+        data.vars[i * ParserData::max_bulk_size] = p(i);
       if (dim != this->n_vars)
-        data.vars[dim] = time;
+        data.vars[dim * ParserData::max_bulk_size] = time;
 
       try
         {
@@ -436,9 +440,9 @@ namespace internal
         init_muparser();
 
       for (unsigned int i = 0; i < dim; ++i)
-        data.vars[i] = p(i);
+        data.vars[i * ParserData::max_bulk_size] = p(i);
       if (dim != this->n_vars)
-        data.vars[dim] = time;
+        data.vars[dim * ParserData::max_bulk_size] = time;
 
       AssertDimension(values.size(), data.parsers.size());
       try
@@ -472,6 +476,73 @@ namespace internal
 #endif
     }
 
+
+
+    template <int dim, typename Number>
+    void
+    ParserImplementation<dim, Number>::do_value_list(
+      const ArrayView<const Point<dim>> &points,
+      const double                       time,
+      const unsigned int                 component,
+      const ArrayView<Number> &          values) const
+    {
+#ifdef DEAL_II_WITH_MUPARSER
+      Assert(this->initialized == true, ExcNotInitialized());
+      AssertDimension(points.size(), values.size());
+
+      // initialize the parser if that hasn't happened yet on the current
+      // thread
+      internal::FunctionParser::ParserData &data = this->parser_data.get();
+      if (data.vars.size() == 0)
+        init_muparser();
+
+      AssertIndexRange(component, data.parsers.size());
+      Assert(dynamic_cast<Parser *>(data.parsers[component].get()),
+             ExcInternalError());
+      // NOLINTNEXTLINE don't warn about using static_cast once we check
+      mu::Parser &parser = static_cast<Parser &>(*data.parsers[component]);
+
+      constexpr unsigned int max_bulk_size = ParserData::max_bulk_size;
+      std::array<double, max_bulk_size> results;
+      try
+        {
+          for (unsigned int begin = 0; begin < points.size();
+               begin += max_bulk_size)
+            {
+              const unsigned int n_points =
+                std::min<unsigned int>(points.size() - begin, max_bulk_size);
+              for (unsigned int q = 0; q < n_points; ++q)
+                {
+                  for (unsigned int i = 0; i < dim; ++i)
+                    data.vars[i * max_bulk_size + q] = points[begin + q][i];
+                  if (dim != this->n_vars)
+                    data.vars[dim * max_bulk_size + q] = time;
+                }
+
+              parser.Eval(results.data(), n_points);
+
+              for (unsigned int q = 0; q < n_points; ++q)
+                values[begin + q] = results[q];
+            }
+        } // try
+      catch (mu::ParserError &e)
+        {
+          std::cerr << "Message:  <" << e.GetMsg() << ">\n";
+          std::cerr << "Formula:  <" << e.GetExpr() << ">\n";
+          std::cerr << "Token:    <" << e.GetToken() << ">\n";
+          std::cerr << "Position: <" << e.GetPos() << ">\n";
+          std::cerr << "Errc:     <" << e.GetCode() << ">" << std::endl;
+          AssertThrow(false, ExcParseError(e.GetCode(), e.GetMsg()));
+        } // catch
+#else
+      (void)points;
+      (void)time;
+      (void)component;
+      (void)values;
+      AssertThrow(false, ExcNeedsFunctionparser());
+#endif
+    }
+
 // explicit instantiations
 #include "mu_parser_internal.inst"
 
@@ -17,9 +17,12 @@
 #include <deal.II/base/utilities.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cstdlib> // for std::getenv
 #include <mutex>
+#include <string>
 #include <thread>
+#include <vector>
 
 #ifdef DEAL_II_WITH_TBB
 #  ifdef DEAL_II_TBB_WITH_ONEAPI
@@ -27,6 +30,11 @@
 #  else
 #    include <tbb/task_scheduler_init.h>
 #  endif
+#  include <tbb/task_scheduler_observer.h>
+#endif
+
+#ifdef __linux__
+#  include <sched.h>
 #endif
 
 
@@ -39,6 +47,101 @@ DEAL_II_ENABLE_EXTRA_DIAGNOSTICS
 DEAL_II_NAMESPACE_OPEN
 
 
+namespace
+{
+  /**
+   * Bind the calling thread to the core with the given index, modulo the
+   * number of cores.
+   */
+  void
+  pin_calling_thread(const unsigned int index)
+  {
+#ifdef __linux__
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    CPU_SET(index % MultithreadInfo::n_cores(), &cpu_set);
+    sched_setaffinity(0, sizeof(cpu_set), &cpu_set);
+#else
+    (void)index;
+#endif
+  }
+
+
+
+#ifdef DEAL_II_WITH_TBB
+  /**
+   * An observer that binds each thread joining the TBB scheduler to the next
+   * core.
+   */
+  class TBBPinningObserver : public tbb::task_scheduler_observer
+  {
+  public:
+    TBBPinningObserver()
+      : next_core(0)
+    {
+      observe(true);
+    }
+
+    ~TBBPinningObserver() override
+    {
+      observe(false);
+    }
+
+    void
+    on_scheduler_entry(bool) override
+    {
+      pin_calling_thread(next_core++);
+    }
+
+  private:
+    std::atomic<unsigned int> next_core;
+  };
+
+  std::unique_ptr<TBBPinningObserver> tbb_pinning_observer;
+#endif
+
+
+
+#ifdef DEAL_II_WITH_TASKFLOW
+  /**
+   * An observer that binds each worker of the taskflow executor to the core
+   * with the index of the worker before it runs its first task.
+   */
+  class TaskflowPinningObserver : public tf::ObserverInterface
+  {
+  public:
+    void
+    set_up(size_t num_workers) override
+    {
+      // each worker only accesses its own entry, so no synchronization is
+      // needed
+      is_pinned.assign(num_workers, 0);
+    }
+
+    void
+    on_entry(size_t worker_id, tf::TaskView) override
+    {
+      if (is_pinned[worker_id] == 0)
+        {
+          pin_calling_thread(worker_id);
+          is_pinned[worker_id] = 1;
+        }
+    }
+
+    void
+    on_exit(size_t, tf::TaskView) override
+    {}
+
+  private:
+    std::vector<char> is_pinned;
+  };
+
+  std::shared_ptr<TaskflowPinningObserver> taskflow_pinning_observer;
+#endif
+} // namespace
+
+
+
 unsigned int
 MultithreadInfo::n_cores()
 {
@@ -96,6 +199,25 @@ MultithreadInfo::set_thread_limit(const unsigned int max_threads)
   if (n_max_threads == numbers::invalid_unsigned_int)
     n_max_threads = n_cores();
 
+  // see if a task backend was requested in the environment
+  if (const char *penv = std::getenv("DEAL_II_TASK_BACKEND"))
+    {
+      const std::string name(penv);
+      if (name == "sequential")
+        set_task_backend(TaskBackend::sequential);
+      else if (name == "tbb")
+        set_task_backend(TaskBackend::tbb);
+      else if (name == "taskflow")
+        set_task_backend(TaskBackend::taskflow);
+      else
+        AssertThrow(false,
+                    ExcMessage("When specifying the <DEAL_II_TASK_BACKEND> "
+                               "environment variable, it needs to be one of "
+                               "<sequential>, <tbb>, or <taskflow>. The text "
+                               "you have in the environment variable is <" +
+                               name + ">"));
+    }
+
 #ifdef DEAL_II_WITH_TBB
 #  ifdef DEAL_II_TBB_WITH_ONEAPI
   // tbb::global_control is a class that affects the specified behavior of
@@ -121,11 +243,120 @@ MultithreadInfo::set_thread_limit(const unsigned int max_threads)
 
 #ifdef DEAL_II_WITH_TASKFLOW
   executor = std::make_unique<tf::Executor>(n_max_threads);
+  if (thread_pinning)
+    taskflow_pinning_observer =
+      executor->make_observer<TaskflowPinningObserver>();
+#endif
+
+  if (const char *penv = std::getenv("DEAL_II_PIN_THREADS"))
+    if (std::string(penv) == "1")
+      {
+        set_static_partitioning(true);
+        set_thread_pinning(true);
+      }
+}
+
+
+
+void
+MultithreadInfo::set_static_partitioning(const bool use_static_partitioning)
+{
+  static_partitioning = use_static_partitioning;
+}
+
+
+
+bool
+MultithreadInfo::use_static_partitioning()
+{
+  return static_partitioning;
+}
+
+
+
+void
+MultithreadInfo::set_thread_pinning(const bool pin_threads)
+{
+  if (pin_threads == thread_pinning)
+    return;
+  thread_pinning = pin_threads;
+
+#ifdef DEAL_II_WITH_TBB
+  if (pin_threads)
+    tbb_pinning_observer = std::make_unique<TBBPinningObserver>();
+  else
+    tbb_pinning_observer.reset();
+#endif
+
+#ifdef DEAL_II_WITH_TASKFLOW
+  if (executor != nullptr)
+    {
+      if (pin_threads)
+        taskflow_pinning_observer =
+          executor->make_observer<TaskflowPinningObserver>();
+      else if (taskflow_pinning_observer != nullptr)
+        executor->remove_observer(std::move(taskflow_pinning_observer));
+    }
 #endif
 }
 
 
 
+bool
+MultithreadInfo::use_thread_pinning()
+{
+  return thread_pinning;
+}
+
+
+
+bool
+MultithreadInfo::is_task_backend_available(const TaskBackend backend)
+{
+  switch (backend)
+    {
+      case TaskBackend::sequential:
+        return true;
+      case TaskBackend::tbb:
+#ifdef DEAL_II_WITH_TBB
+        return true;
+#else
+        return false;
+#endif
+      case TaskBackend::taskflow:
+#ifdef DEAL_II_WITH_TASKFLOW
+        return true;
+#else
+        return false;
+#endif
+      default:
+        Assert(false, ExcNotImplemented());
+        return false;
+    }
+}
+
+
+
+void
+MultithreadInfo::set_task_backend(const TaskBackend backend)
+{
+  AssertThrow(is_task_backend_available(backend),
+              ExcMessage("The requested task backend is not available "
+                         "because deal.II was not configured with the "
+                         "corresponding library."));
+  task_backend = backend;
+}
+
+
+
+MultithreadInfo::TaskBackend
+MultithreadInfo::get_task_backend()
+{
+  return task_backend;
+}
+
+
+
 unsigned int
 MultithreadInfo::n_threads()
 {
@@ -182,6 +413,21 @@ std::unique_ptr<tf::Executor> MultithreadInfo::executor = nullptr;
 
 unsigned int MultithreadInfo::n_max_threads = numbers::invalid_unsigned_int;
 
+bool MultithreadInfo::static_partitioning = false;
+
+bool MultithreadInfo::thread_pinning = false;
+
+#if defined(DEAL_II_WITH_TBB)
+MultithreadInfo::TaskBackend MultithreadInfo::task_backend =
+  MultithreadInfo::TaskBackend::tbb;
+#elif defined(DEAL_II_WITH_TASKFLOW)
+MultithreadInfo::TaskBackend MultithreadInfo::task_backend =
+  MultithreadInfo::TaskBackend::taskflow;
+#else
+MultithreadInfo::TaskBackend MultithreadInfo::task_backend =
+  MultithreadInfo::TaskBackend::sequential;
+#endif
+
 namespace
 {
   // Force the first call to set_thread_limit happen before any tasks in TBB are
@@ -19,6 +19,8 @@
 
 #include <boost/serialization/utility.hpp>
 
+#include <cstdlib>
+#include <cstring>
 #include <limits>
 
 DEAL_II_NAMESPACE_OPEN
@@ -27,6 +29,149 @@ namespace Utilities
 {
   namespace MPI
   {
+    namespace
+    {
+      /**
+       * Return the communication mode selected by the environment variable
+       * DEAL_II_PARTITIONER_COMMUNICATION, or point-to-point communication if
+       * the variable is not set.
+       */
+      Partitioner::CommunicationMode
+      default_communication_mode()
+      {
+        const char *mode = std::getenv("DEAL_II_PARTITIONER_COMMUNICATION");
+        if (mode == nullptr || std::strcmp(mode, "point_to_point") == 0)
+          return Partitioner::CommunicationMode::point_to_point;
+        else if (std::strcmp(mode, "persistent") == 0)
+          return Partitioner::CommunicationMode::persistent_requests;
+        else if (std::strcmp(mode, "neighborhood") == 0)
+          return Partitioner::CommunicationMode::neighborhood_collectives;
+
+        AssertThrow(false,
+                    ExcMessage(std::string("The environment variable "
+                                           "DEAL_II_PARTITIONER_COMMUNICATION "
+                                           "has the unknown value <") +
+                               mode +
+                               ">. Valid values are <point_to_point>, "
+                               "<persistent>, and <neighborhood>."));
+        return Partitioner::CommunicationMode::point_to_point;
+      }
+    } // namespace
+
+
+
+    namespace internal
+    {
+      PartitionerCommunicationData::PartitionerCommunicationData()
+        : export_graph(MPI_COMM_NULL)
+        , import_graph(MPI_COMM_NULL)
+      {}
+
+
+
+      PartitionerCommunicationData::~PartitionerCommunicationData()
+      {
+#ifdef DEAL_II_WITH_MPI
+        // the object might be destroyed after MPI has been finalized, for
+        // example as part of a static object, in which case the MPI objects
+        // cannot be freed anymore
+        int finalized = 0;
+        MPI_Finalized(&finalized);
+        if (finalized)
+          return;
+
+        for (Entry &entry : entries)
+          for (MPI_Request &request : entry.requests)
+            if (request != MPI_REQUEST_NULL)
+              MPI_Request_free(&request);
+        if (export_graph != MPI_COMM_NULL)
+          Utilities::MPI::free_communicator(export_graph);
+        if (import_graph != MPI_COMM_NULL)
+          Utilities::MPI::free_communicator(import_graph);
+#endif
+      }
+
+
+
+      PartitionerCommunicationData::Entry &
+      PartitionerCommunicationData::get_entry(
+        const bool         is_export,
+        const unsigned int channel,
+        const void *       ghost_array,
+        const std::size_t  ghost_array_size,
+        const void *       temporary_storage,
+        const std::size_t  number_size,
+        bool &             is_new)
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        for (Entry &entry : entries)
+          if (entry.is_export == is_export && entry.channel == channel &&
+              entry.ghost_array == ghost_array &&
+              entry.ghost_array_size == ghost_array_size &&
+              entry.temporary_storage == temporary_storage &&
+              entry.number_size == number_size)
+            {
+              Assert(entry.in_flight == false,
+                     ExcMessage("Another operation on the same arrays seems "
+                                "to still be running."));
+              entry.in_flight = true;
+              is_new          = false;
+              return entry;
+            }
+
+        // make room for the new entry by removing the oldest one that is
+        // not in use
+        if (entries.size() >= max_entries)
+          for (auto it = entries.begin(); it != entries.end(); ++it)
+            if (it->in_flight == false)
+              {
+#ifdef DEAL_II_WITH_MPI
+                for (MPI_Request &request : it->requests)
+                  if (request != MPI_REQUEST_NULL)
+                    {
+                      const int ierr = MPI_Request_free(&request);
+                      AssertThrowMPI(ierr);
+                    }
+#endif
+                entries.erase(it);
+                break;
+              }
+
+        entries.emplace_back();
+        Entry &entry            = entries.back();
+        entry.is_export         = is_export;
+        entry.channel           = channel;
+        entry.ghost_array       = ghost_array;
+        entry.ghost_array_size  = ghost_array_size;
+        entry.temporary_storage = temporary_storage;
+        entry.number_size       = number_size;
+        entry.in_flight         = true;
+        is_new                  = true;
+        return entry;
+      }
+
+
+
+      void
+      PartitionerCommunicationData::finish_entries(
+        const bool        is_export,
+        const void *      ghost_array,
+        const std::size_t ghost_array_size,
+        const std::size_t number_size)
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (Entry &entry : entries)
+          if (entry.is_export == is_export &&
+              entry.ghost_array == ghost_array &&
+              entry.ghost_array_size == ghost_array_size &&
+              entry.number_size == number_size)
+            entry.in_flight = false;
+      }
+    } // namespace internal
+
+
+
     Partitioner::Partitioner()
       : global_size(0)
       , local_range_data(
@@ -38,6 +183,7 @@ namespace Utilities
       , n_procs(1)
       , communicator(MPI_COMM_SELF)
       , have_ghost_indices(false)
+      , communication_mode(default_communication_mode())
     {}
 
 
@@ -54,6 +200,7 @@ namespace Utilities
       , n_procs(1)
       , communicator(MPI_COMM_SELF)
       , have_ghost_indices(false)
+      , communication_mode(default_communication_mode())
     {
       locally_owned_range_data.add_range(0, size);
       locally_owned_range_data.compress();
@@ -76,6 +223,7 @@ namespace Utilities
       , n_procs(Utilities::MPI::n_mpi_processes(communicator))
       , communicator(communicator)
       , have_ghost_indices(true)
+      , communication_mode(default_communication_mode())
     {
       types::global_dof_index prefix_sum = 0;
 
@@ -110,6 +258,7 @@ namespace Utilities
       , n_procs(1)
       , communicator(communicator_in)
       , have_ghost_indices(false)
+      , communication_mode(default_communication_mode())
     {
       set_owned_indices(locally_owned_indices);
       set_ghost_indices(ghost_indices_in);
@@ -128,6 +277,7 @@ namespace Utilities
       , n_procs(1)
       , communicator(communicator_in)
       , have_ghost_indices(false)
+      , communication_mode(default_communication_mode())
     {
       set_owned_indices(locally_owned_indices);
     }
@@ -200,6 +350,9 @@ namespace Utilities
              ExcDimensionMismatch(ghost_indices_in.size(),
                                   locally_owned_range_data.size()));
 
+      // the communication data depends on the ghost indices, so discard it
+      communication_data.reset();
+
       ghost_indices_data = ghost_indices_in;
       if (ghost_indices_data.size() != locally_owned_range_data.size())
         ghost_indices_data.set_size(locally_owned_range_data.size());
@@ -331,7 +484,9 @@ namespace Utilities
               i.second.n_intervals());
           }
 
-      // transform import indices to local index space
+      // transform import indices to local index space, invalidating the
+      // expanded indices on the device that are set up lazily
+      import_indices_plain_dev.reset();
       import_indices_data = {};
       import_indices_data.reserve(import_indices_chunks_by_rank_data.back());
       for (const auto &i : import_data)
@@ -347,6 +502,8 @@ namespace Utilities
                                                local_range_data.first);
         }
 
+      setup_communication_data();
+
 #  ifdef DEBUG
 
       // simple check: the number of processors to which we want to send
@@ -471,6 +628,189 @@ namespace Utilities
 
 
 
+    void
+    Partitioner::set_communication_mode(const CommunicationMode mode)
+    {
+      communication_mode = mode;
+      setup_communication_data();
+    }
+
+
+
+    void
+    Partitioner::setup_communication_data()
+    {
+      communication_data.reset();
+
+#ifdef DEAL_II_WITH_MPI
+      if (communication_mode == CommunicationMode::point_to_point ||
+          n_procs < 2)
+        return;
+
+      communication_data =
+        std::make_shared<internal::PartitionerCommunicationData>();
+
+      if (communication_mode == CommunicationMode::neighborhood_collectives)
+        {
+          // in the direction of export_to_ghosted_array_start(), we receive
+          // from the owners of our ghost indices and send to the processes
+          // that import from us
+          std::vector<int> ghost_ranks, import_ranks;
+          ghost_ranks.reserve(ghost_targets_data.size());
+          for (const auto &target : ghost_targets_data)
+            ghost_ranks.push_back(target.first);
+          import_ranks.reserve(import_targets_data.size());
+          for (const auto &target : import_targets_data)
+            import_ranks.push_back(target.first);
+
+          int ierr = MPI_Dist_graph_create_adjacent(
+            communicator,
+            ghost_ranks.size(),
+            ghost_ranks.data(),
+            MPI_UNWEIGHTED,
+            import_ranks.size(),
+            import_ranks.data(),
+            MPI_UNWEIGHTED,
+            MPI_INFO_NULL,
+            /* reorder */ 0,
+            &communication_data->export_graph);
+          AssertThrowMPI(ierr);
+
+          ierr = MPI_Dist_graph_create_adjacent(
+            communicator,
+            import_ranks.size(),
+            import_ranks.data(),
+            MPI_UNWEIGHTED,
+            ghost_ranks.size(),
+            ghost_ranks.data(),
+            MPI_UNWEIGHTED,
+            MPI_INFO_NULL,
+            /* reorder */ 0,
+            &communication_data->import_graph);
+          AssertThrowMPI(ierr);
+        }
+#endif
+    }
+
+
+
+    Partitioner::CommunicationMode
+    Partitioner::active_communication_mode() const
+    {
+      if (communication_data == nullptr ||
+          (communication_mode == CommunicationMode::neighborhood_collectives &&
+           communication_data->export_graph == MPI_COMM_NULL))
+        return CommunicationMode::point_to_point;
+      else
+        return communication_mode;
+    }
+
+
+
+    void
+    Partitioner::setup_communication_entry(
+      internal::PartitionerCommunicationData::Entry &entry,
+      const unsigned int                             mpi_tag,
+      void *                                         ghost_array,
+      void *                                         temporary_storage) const
+    {
+#ifdef DEAL_II_WITH_MPI
+      const std::size_t number_size = entry.number_size;
+
+      // when exporting into the larger ghost index set, the data is received
+      // at the end of the ghost array and moved into place later, see
+      // export_to_ghosted_array_start()
+      char *ghost_ptr = static_cast<char *>(ghost_array);
+      if (entry.is_export &&
+          n_ghost_indices_in_larger_set > n_ghost_indices() &&
+          entry.ghost_array_size == n_ghost_indices_in_larger_set)
+        ghost_ptr +=
+          (n_ghost_indices_in_larger_set - n_ghost_indices()) * number_size;
+      char *temp_ptr = static_cast<char *>(temporary_storage);
+
+      if (communication_mode == CommunicationMode::persistent_requests)
+        {
+          // the receive operations come first, in the order of the
+          // respective targets, followed by the send operations
+          const auto &receive_targets =
+            entry.is_export ? ghost_targets_data : import_targets_data;
+          const auto &send_targets =
+            entry.is_export ? import_targets_data : ghost_targets_data;
+          char *receive_ptr = entry.is_export ? ghost_ptr : temp_ptr;
+          char *send_ptr    = entry.is_export ? temp_ptr : ghost_ptr;
+
+          entry.requests.resize(receive_targets.size() + send_targets.size(),
+                                MPI_REQUEST_NULL);
+          for (unsigned int i = 0; i < receive_targets.size(); ++i)
+            {
+              const int ierr =
+                MPI_Recv_init(receive_ptr,
+                              receive_targets[i].second * number_size,
+                              MPI_BYTE,
+                              receive_targets[i].first,
+                              mpi_tag,
+                              communicator,
+                              &entry.requests[i]);
+              AssertThrowMPI(ierr);
+              receive_ptr += receive_targets[i].second * number_size;
+            }
+          for (unsigned int i = 0; i < send_targets.size(); ++i)
+            {
+              const int ierr =
+                MPI_Send_init(send_ptr,
+                              send_targets[i].second * number_size,
+                              MPI_BYTE,
+                              send_targets[i].first,
+                              mpi_tag,
+                              communicator,
+                              &entry.requests[receive_targets.size() + i]);
+              AssertThrowMPI(ierr);
+              send_ptr += send_targets[i].second * number_size;
+            }
+        }
+      else if (communication_mode ==
+               CommunicationMode::neighborhood_collectives)
+        {
+          // the counts and offsets are given in bytes and follow the order of
+          // the sources and destinations of the graph communicators
+          using TargetList =
+            std::vector<std::pair<unsigned int, unsigned int>>;
+          const auto fill = [number_size](const TargetList &targets,
+                                          std::vector<int> & counts,
+                                          std::vector<int> & offsets) {
+            counts.resize(targets.size());
+            offsets.resize(targets.size());
+            std::size_t offset = 0;
+            for (unsigned int i = 0; i < targets.size(); ++i)
+              {
+                AssertThrow(offset + targets[i].second * number_size <
+                              static_cast<std::size_t>(
+                                std::numeric_limits<int>::max()),
+                            ExcMessage("Index overflow: Neighborhood "
+                                       "collectives support at most 2GB of "
+                                       "data per process."));
+                counts[i]  = targets[i].second * number_size;
+                offsets[i] = offset;
+                offset += targets[i].second * number_size;
+              }
+          };
+          fill(entry.is_export ? import_targets_data : ghost_targets_data,
+               entry.send_counts,
+               entry.send_offsets);
+          fill(entry.is_export ? ghost_targets_data : import_targets_data,
+               entry.receive_counts,
+               entry.receive_offsets);
+        }
+#else
+      (void)entry;
+      (void)mpi_tag;
+      (void)ghost_array;
+      (void)temporary_storage;
+#endif
+    }
+
+
+
     bool
     Partitioner::is_compatible(const Partitioner &part) const
     {
@@ -27,37 +27,21 @@ namespace Utilities
     void
     Partitioner::initialize_import_indices_plain_dev() const
     {
-      const unsigned int n_import_targets = import_targets_data.size();
-      import_indices_plain_dev.reserve(n_import_targets);
-      for (unsigned int i = 0; i < n_import_targets; ++i)
-        {
-          // Expand the indices on the host
-          std::vector<std::pair<unsigned int, unsigned int>>::const_iterator
-            my_imports = import_indices_data.begin() +
-                         import_indices_chunks_by_rank_data[i],
-            end_my_imports = import_indices_data.begin() +
-                             import_indices_chunks_by_rank_data[i + 1];
-          std::vector<unsigned int> import_indices_plain_host;
-          for (; my_imports != end_my_imports; ++my_imports)
-            {
-              const unsigned int chunk_size =
-                my_imports->second - my_imports->first;
-              for (unsigned int j = 0; j < chunk_size; ++j)
-                import_indices_plain_host.push_back(my_imports->first + j);
-            }
-
-          // Move the indices to the device
-          import_indices_plain_dev.emplace_back(std::make_pair(
-            std::unique_ptr<unsigned int[], void (*)(unsigned int *)>(
-              nullptr, Utilities::CUDA::delete_device_data<unsigned int>),
-            import_indices_plain_host.size()));
-
-          import_indices_plain_dev[i].first.reset(
-            Utilities::CUDA::allocate_device_data<unsigned int>(
-              import_indices_plain_dev[i].second));
-          Utilities::CUDA::copy_to_dev(import_indices_plain_host,
-                                       import_indices_plain_dev[i].first.get());
-        }
+      // Expand the indices of all import targets on the host
+      std::vector<unsigned int> import_indices_plain_host;
+      import_indices_plain_host.reserve(n_import_indices_data);
+      for (const auto &import_range : import_indices_data)
+        for (unsigned int j = import_range.first; j < import_range.second; ++j)
+          import_indices_plain_host.push_back(j);
+      AssertDimension(import_indices_plain_host.size(), n_import_indices_data);
+
+      // Move the indices to the device
+      import_indices_plain_dev.reset(
+        Utilities::CUDA::allocate_device_data<unsigned int>(
+          import_indices_plain_host.size()),
+        Utilities::CUDA::delete_device_data<unsigned int>);
+      Utilities::CUDA::copy_to_dev(import_indices_plain_host,
+                                   import_indices_plain_dev.get());
     }
   } // namespace MPI
 } // namespace Utilities
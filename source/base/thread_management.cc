@@ -18,6 +18,7 @@
 #include <atomic>
 #include <cstdlib>
 #include <iostream>
+#include <utility>
 
 #ifdef DEAL_II_HAVE_UNISTD_H
 #  include <unistd.h>
@@ -141,6 +142,105 @@ namespace Threads
       }
     return return_values;
   }
+
+
+
+  unsigned int
+  TaskGraph::add_task(const std::function<void()> &     function,
+                      const std::vector<unsigned int> &prerequisites)
+  {
+    for (const unsigned int p : prerequisites)
+      {
+        (void)p;
+        Assert(p < functions.size(),
+               ExcMessage("A task can only depend on tasks that have been "
+                          "added to the graph before it."));
+      }
+
+    functions.push_back(function);
+    this->prerequisites.push_back(prerequisites);
+    return functions.size() - 1;
+  }
+
+
+
+  void
+  TaskGraph::run() const
+  {
+    const unsigned int n_functions = functions.size();
+
+    std::vector<unsigned int>              n_missing(n_functions, 0);
+    std::vector<std::vector<unsigned int>> dependents(n_functions);
+    std::vector<unsigned int>              ready;
+    for (unsigned int i = 0; i < n_functions; ++i)
+      {
+        for (const unsigned int p : prerequisites[i])
+          {
+            ++n_missing[i];
+            dependents[p].push_back(i);
+          }
+        if (n_missing[i] == 0)
+          ready.push_back(i);
+      }
+
+    // The tasks report back through this list once they are done, and the
+    // calling thread waits on the condition variable for new entries. We
+    // never hold the mutex while starting a task because new_task() runs
+    // the function right away if only one thread is available.
+    std::mutex                                 mutex;
+    std::condition_variable                    condition;
+    std::vector<std::pair<unsigned int, bool>> finished;
+
+    std::vector<Task<void>> tasks;
+    tasks.reserve(n_functions);
+    unsigned int n_finished = 0;
+    while (!ready.empty() || n_finished < tasks.size())
+      {
+        for (const unsigned int i : ready)
+          tasks.push_back(new_task([&, i]() {
+            bool success = false;
+            const auto report = [&]() {
+              std::lock_guard<std::mutex> lock(mutex);
+              finished.emplace_back(i, success);
+              condition.notify_one();
+            };
+            try
+              {
+                functions[i]();
+                success = true;
+              }
+            catch (...)
+              {
+                report();
+                throw;
+              }
+            report();
+          }));
+        ready.clear();
+
+        std::vector<std::pair<unsigned int, bool>> newly_finished;
+        {
+          std::unique_lock<std::mutex> lock(mutex);
+          condition.wait(lock, [&]() { return !finished.empty(); });
+          newly_finished.swap(finished);
+        }
+
+        for (const auto &f : newly_finished)
+          {
+            ++n_finished;
+            if (f.second == true)
+              for (const unsigned int d : dependents[f.first])
+                if (--n_missing[d] == 0)
+                  ready.push_back(d);
+          }
+      }
+
+    // re-throw a possible exception
+    for (const auto &task : tasks)
+      task.join();
+
+    Assert(tasks.size() == n_functions, ExcInternalError());
+  }
 } // namespace Threads
 
 
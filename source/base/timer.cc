@@ -38,6 +38,14 @@
 #  include <windows.h>
 #endif
 
+#ifdef __linux__
+#  include <linux/perf_event.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+
+#  include <cstring>
+#endif
+
 
 
 DEAL_II_NAMESPACE_OPEN
@@ -306,7 +314,9 @@ TimerOutput::TimerOutput(std::ostream &        stream,
   , out_stream(stream, true)
   , output_is_enabled(true)
   , mpi_communicator(MPI_COMM_SELF)
-{}
+{
+  hardware_counter_fds.fill(-1);
+}
 
 
 
@@ -318,7 +328,9 @@ TimerOutput::TimerOutput(ConditionalOStream &  stream,
   , out_stream(stream)
   , output_is_enabled(true)
   , mpi_communicator(MPI_COMM_SELF)
-{}
+{
+  hardware_counter_fds.fill(-1);
+}
 
 
 
@@ -331,7 +343,9 @@ TimerOutput::TimerOutput(const MPI_Comm &      mpi_communicator,
   , out_stream(stream, true)
   , output_is_enabled(true)
   , mpi_communicator(mpi_communicator)
-{}
+{
+  hardware_counter_fds.fill(-1);
+}
 
 
 
@@ -344,7 +358,9 @@ TimerOutput::TimerOutput(const MPI_Comm &      mpi_communicator,
   , out_stream(stream)
   , output_is_enabled(true)
   , mpi_communicator(mpi_communicator)
-{}
+{
+  hardware_counter_fds.fill(-1);
+}
 
 
 
@@ -395,6 +411,8 @@ TimerOutput::~TimerOutput()
 #else
   do_exit();
 #endif
+
+  disable_hardware_counters();
 }
 
 
@@ -430,8 +448,12 @@ TimerOutput::enter_subsection(const std::string &section_name)
       sections[section_name].total_cpu_time  = 0;
       sections[section_name].total_wall_time = 0;
       sections[section_name].n_calls         = 0;
+      sections[section_name].total_counter_values.fill(0.);
+      sections[section_name].total_flops = 0;
+      sections[section_name].total_bytes = 0;
     }
 
+  read_hardware_counters(sections[section_name].counter_start_values);
   sections[section_name].timer.reset();
   sections[section_name].timer.start();
   ++sections[section_name].n_calls;
@@ -475,6 +497,17 @@ TimerOutput::leave_subsection(const std::string &section_name)
   const double cpu_time = sections[actual_section_name].timer.last_cpu_time();
   sections[actual_section_name].total_cpu_time += cpu_time;
 
+  {
+    std::array<std::uint64_t, n_hardware_counters> counter_values;
+    read_hardware_counters(counter_values);
+    Section &section = sections[actual_section_name];
+    for (unsigned int c = 0; c < n_hardware_counters; ++c)
+      if (counter_values[c] >= section.counter_start_values[c])
+        section.total_counter_values[c] +=
+          static_cast<double>(counter_values[c] -
+                              section.counter_start_values[c]);
+  }
+
   // in case we have to print out something, do that here...
   if ((output_frequency == every_call ||
        output_frequency == every_call_and_summary) &&
@@ -1016,6 +1049,213 @@ TimerOutput::print_wall_time_statistics(const MPI_Comm &mpi_comm,
 
 
 
+bool
+TimerOutput::enable_hardware_counters()
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  Assert(active_sections.empty(),
+         ExcMessage("Hardware counters can only be enabled while no section "
+                    "is active."));
+
+#ifdef __linux__
+  const std::array<std::uint64_t, n_hardware_counters> events = {
+    {PERF_COUNT_HW_CPU_CYCLES,
+     PERF_COUNT_HW_INSTRUCTIONS,
+     PERF_COUNT_HW_CACHE_REFERENCES,
+     PERF_COUNT_HW_CACHE_MISSES}};
+
+  bool success = true;
+  for (unsigned int c = 0; c < n_hardware_counters; ++c)
+    if (hardware_counter_fds[c] < 0)
+      {
+        perf_event_attr attributes;
+        std::memset(&attributes, 0, sizeof(attributes));
+        attributes.type           = PERF_TYPE_HARDWARE;
+        attributes.size           = sizeof(attributes);
+        attributes.config         = events[c];
+        attributes.inherit        = 1;
+        attributes.exclude_kernel = 1;
+        attributes.exclude_hv     = 1;
+
+        // measure the calling thread (pid 0) on any CPU (-1), without a
+        // group leader (-1)
+        hardware_counter_fds[c] = static_cast<int>(
+          syscall(__NR_perf_event_open, &attributes, 0, -1, -1, 0));
+        if (hardware_counter_fds[c] < 0)
+          success = false;
+      }
+  return success;
+#else
+  return false;
+#endif
+}
+
+
+
+void
+TimerOutput::disable_hardware_counters()
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  for (int &fd : hardware_counter_fds)
+    {
+#ifdef __linux__
+      if (fd >= 0)
+        close(fd);
+#endif
+      fd = -1;
+    }
+}
+
+
+
+void
+TimerOutput::read_hardware_counters(
+  std::array<std::uint64_t, n_hardware_counters> &values) const
+{
+  for (unsigned int c = 0; c < n_hardware_counters; ++c)
+    {
+      values[c] = 0;
+#ifdef __linux__
+      if (hardware_counter_fds[c] >= 0 &&
+          read(hardware_counter_fds[c], &values[c], sizeof(values[c])) !=
+            static_cast<ssize_t>(sizeof(values[c])))
+        values[c] = 0;
+#endif
+    }
+}
+
+
+
+void
+TimerOutput::add_flops(const double n_flops, const std::string &section_name)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  Assert(section_name.empty() == false || active_sections.empty() == false,
+         ExcMessage("No section is active to add the operations to."));
+  const std::string &actual_section_name =
+    (section_name.empty() ? active_sections.back() : section_name);
+  Assert(sections.find(actual_section_name) != sections.end(),
+         ExcMessage("Cannot add operations to a section that was never "
+                    "created."));
+
+  sections[actual_section_name].total_flops += n_flops;
+}
+
+
+
+void
+TimerOutput::add_memory_transfer(const double       n_bytes,
+                                 const std::string &section_name)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  Assert(section_name.empty() == false || active_sections.empty() == false,
+         ExcMessage("No section is active to add the memory transfer to."));
+  const std::string &actual_section_name =
+    (section_name.empty() ? active_sections.back() : section_name);
+  Assert(sections.find(actual_section_name) != sections.end(),
+         ExcMessage("Cannot add memory transfer to a section that was never "
+                    "created."));
+
+  sections[actual_section_name].total_bytes += n_bytes;
+}
+
+
+
+void
+TimerOutput::print_hardware_counter_statistics(const MPI_Comm &mpi_comm) const
+{
+  // we are going to change the precision and width of output below. store the
+  // old values so the get restored when exiting this function
+  const boost::io::ios_base_all_saver restore_stream(out_stream.get_stream());
+
+  AssertDimension(sections.size(),
+                  Utilities::MPI::max(sections.size(), mpi_comm));
+
+  // get the maximum width among all sections
+  unsigned int max_width = 0;
+  for (const auto &i : sections)
+    max_width = std::max(max_width, static_cast<unsigned int>(i.first.size()));
+
+  // 17 is the default width until | character
+  max_width = std::max(max_width + 1, static_cast<unsigned int>(17));
+  const std::string extra_dash  = std::string(max_width - 17, '-');
+  const std::string extra_space = std::string(max_width - 17, ' ');
+
+  const std::string separator =
+    "+------------------" + extra_dash +
+    "+-----------+--------------------------+--------------------------+"
+    "-----------+-------+-----------+\n";
+
+  out_stream << '\n'
+             << separator << "| Section          " << extra_space
+             << "| no. calls "
+             << "|     GFlop/s min/avg/max  "
+             << "|      GB/s min/avg/max    "
+             << "| Flop/Byte "
+             << "|  IPC  "
+             << "| LLC miss  |\n"
+             << separator;
+
+  for (const auto &i : sections)
+    {
+      const Section &section = i.second;
+
+      // compute the rates on the present rank; without explicitly given
+      // memory transfer, estimate it from the last-level cache misses
+      const double wall_time = std::max(section.total_wall_time, 1e-300);
+      const double bytes     = section.total_bytes > 0. ?
+                                 section.total_bytes :
+                                 64. * section.total_counter_values[3];
+      const double gflops    = 1e-9 * section.total_flops / wall_time;
+      const double gbytes    = 1e-9 * bytes / wall_time;
+
+      const Utilities::MPI::MinMaxAvg flop_data =
+        Utilities::MPI::min_max_avg(gflops, mpi_comm);
+      const Utilities::MPI::MinMaxAvg byte_data =
+        Utilities::MPI::min_max_avg(gbytes, mpi_comm);
+      const double intensity = Utilities::MPI::min_max_avg(
+                                 bytes > 0. ? section.total_flops / bytes : 0.,
+                                 mpi_comm)
+                                 .avg;
+      const double ipc =
+        Utilities::MPI::min_max_avg(section.total_counter_values[0] > 0. ?
+                                      section.total_counter_values[1] /
+                                        section.total_counter_values[0] :
+                                      0.,
+                                    mpi_comm)
+          .avg;
+      const double miss_rate =
+        Utilities::MPI::min_max_avg(section.total_counter_values[2] > 0. ?
+                                      section.total_counter_values[3] /
+                                        section.total_counter_values[2] :
+                                      0.,
+                                    mpi_comm)
+          .avg;
+
+      std::string name_out = i.first;
+
+      // resize the array so that it is always of the same size
+      unsigned int pos_non_space = name_out.find_first_not_of(' ');
+      name_out.erase(0, pos_non_space);
+      name_out.resize(max_width, ' ');
+      out_stream << "| " << name_out << "| " << std::setw(9)
+                 << section.n_calls << " |" << std::setprecision(3)
+                 << std::setw(8) << flop_data.min << std::setw(8)
+                 << flop_data.avg << std::setw(8) << flop_data.max << "  |"
+                 << std::setw(8) << byte_data.min << std::setw(8)
+                 << byte_data.avg << std::setw(8) << byte_data.max << "  |"
+                 << std::setw(10) << intensity << " |" << std::setw(6) << ipc
+                 << " |" << std::setw(9) << 100. * miss_rate << "% |\n";
+    }
+  out_stream << separator;
+}
+
+
+
 void
 TimerOutput::disable_output()
 {
@@ -0,0 +1,269 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/tracing.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <list>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace Tracing
+{
+  namespace
+  {
+    /**
+     * A recorded event, with times in nanoseconds of the steady clock.
+     */
+    struct Event
+    {
+      const char * name;
+      const char * category;
+      std::int64_t start_time;
+      std::int64_t duration;
+    };
+
+    /**
+     * The events recorded by one thread.
+     */
+    struct ThreadBuffer
+    {
+      unsigned int       thread_id;
+      std::vector<Event> events;
+    };
+
+    /**
+     * The buffers of all threads that have recorded events. The object is
+     * intentionally never destroyed, so that threads that are still running
+     * during the destruction of static objects can record events safely.
+     */
+    struct Registry
+    {
+      std::mutex              mutex;
+      std::list<ThreadBuffer> buffers;
+    };
+
+    Registry &
+    get_registry()
+    {
+      static Registry *registry = new Registry();
+      return *registry;
+    }
+
+    std::atomic<bool> tracing_active(false);
+
+    /**
+     * Return the buffer of the calling thread, creating it on first use.
+     * Since std::list does not invalidate references when elements are
+     * added, the buffer can be filled without holding the lock.
+     */
+    ThreadBuffer &
+    get_thread_buffer()
+    {
+      thread_local ThreadBuffer *buffer = nullptr;
+      if (buffer == nullptr)
+        {
+          Registry &                  registry = get_registry();
+          std::lock_guard<std::mutex> lock(registry.mutex);
+          registry.buffers.emplace_back();
+          buffer            = &registry.buffers.back();
+          buffer->thread_id = registry.buffers.size() - 1;
+        }
+      return *buffer;
+    }
+
+    std::int64_t
+    steady_time()
+    {
+      return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+    }
+
+    /**
+     * Return the difference between the system clock and the steady clock
+     * in nanoseconds, which translates the recorded times into times that
+     * can be compared between processes.
+     */
+    std::int64_t
+    steady_to_system_offset()
+    {
+      const std::int64_t system_time =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::system_clock::now().time_since_epoch())
+          .count();
+      return system_time - steady_time();
+    }
+
+    /**
+     * Write @p text to @p out as a JSON string, escaping quotes and
+     * backslashes.
+     */
+    void
+    write_json_string(std::ostream &out, const char *text)
+    {
+      out << '"';
+      for (const char *c = text; *c != '\0'; ++c)
+        {
+          if (*c == '"' || *c == '\\')
+            out << '\\';
+          out << *c;
+        }
+      out << '"';
+    }
+  } // namespace
+
+
+
+  void
+  start()
+  {
+    tracing_active = true;
+  }
+
+
+
+  void
+  stop()
+  {
+    tracing_active = false;
+  }
+
+
+
+  bool
+  is_active()
+  {
+    return tracing_active;
+  }
+
+
+
+  void
+  clear()
+  {
+    Registry &                  registry = get_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (ThreadBuffer &buffer : registry.buffers)
+      buffer.events.clear();
+  }
+
+
+
+  std::size_t
+  n_events()
+  {
+    Registry &                  registry = get_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    std::size_t                 count = 0;
+    for (const ThreadBuffer &buffer : registry.buffers)
+      count += buffer.events.size();
+    return count;
+  }
+
+
+
+  void
+  write_chrome_trace(const std::string &filename, const MPI_Comm &mpi_comm)
+  {
+    const unsigned int my_rank = Utilities::MPI::this_mpi_process(mpi_comm);
+
+    // express all times relative to the earliest event on any rank, in
+    // microseconds of the system clock
+    const std::int64_t offset = steady_to_system_offset();
+
+    Registry &                  registry = get_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    unsigned long long int first_time =
+      std::numeric_limits<unsigned long long int>::max();
+    for (const ThreadBuffer &buffer : registry.buffers)
+      for (const Event &event : buffer.events)
+        first_time =
+          std::min(first_time,
+                   static_cast<unsigned long long int>(event.start_time +
+                                                       offset));
+    first_time = Utilities::MPI::min(first_time, mpi_comm);
+
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(3);
+    out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << my_rank
+        << ",\"args\":{\"name\":\"rank " << my_rank << "\"}},\n"
+        << "{\"name\":\"process_sort_index\",\"ph\":\"M\",\"pid\":" << my_rank
+        << ",\"args\":{\"sort_index\":" << my_rank << "}}";
+    for (const ThreadBuffer &buffer : registry.buffers)
+      for (const Event &event : buffer.events)
+        {
+          out << ",\n{\"name\":";
+          write_json_string(out, event.name);
+          out << ",\"cat\":";
+          write_json_string(out, event.category);
+          out << ",\"ph\":\"X\",\"pid\":" << my_rank
+              << ",\"tid\":" << buffer.thread_id << ",\"ts\":"
+              << 1e-3 * static_cast<double>(
+                          static_cast<unsigned long long int>(
+                            event.start_time + offset) -
+                          first_time)
+              << ",\"dur\":" << 1e-3 * event.duration << '}';
+        }
+
+    const std::vector<std::string> all_events =
+      Utilities::MPI::gather(mpi_comm, out.str(), 0);
+
+    if (my_rank == 0)
+      {
+        std::ofstream file(filename);
+        AssertThrow(file, ExcIO());
+        file << "{\"traceEvents\":[\n";
+        for (unsigned int r = 0; r < all_events.size(); ++r)
+          file << (r > 0 ? ",\n" : "") << all_events[r];
+        file << "\n],\"displayTimeUnit\":\"ms\"}\n";
+      }
+  }
+
+
+
+  Scope::Scope(const char *name, const char *category)
+    : name(name)
+    , category(category)
+    , start_time(tracing_active.load(std::memory_order_relaxed) ?
+                   steady_time() :
+                   -1)
+  {}
+
+
+
+  Scope::~Scope()
+  {
+    if (start_time >= 0)
+      {
+        const std::int64_t end_time = steady_time();
+        get_thread_buffer().events.push_back(
+          Event{name, category, start_time, end_time - start_time});
+      }
+  }
+} // namespace Tracing
+
+DEAL_II_NAMESPACE_CLOSE
@@ -40,6 +40,7 @@ DEAL_II_DISABLE_EXTRA_DIAGNOSTICS
 DEAL_II_ENABLE_EXTRA_DIAGNOSTICS
 
 #include <algorithm>
+#include <atomic>
 #include <bitset>
 #include <cctype>
 #include <cerrno>
@@ -51,6 +52,8 @@ DEAL_II_ENABLE_EXTRA_DIAGNOSTICS
 #include <iomanip>
 #include <iostream>
 #include <limits>
+#include <map>
+#include <mutex>
 #include <sstream>
 #include <string>
 
@@ -62,6 +65,10 @@ DEAL_II_ENABLE_EXTRA_DIAGNOSTICS
 #  include <cstdlib>
 #endif
 
+#ifdef __linux__
+#  include <sys/mman.h>
+#endif
+
 
 #ifdef DEAL_II_WITH_TRILINOS
 #  ifdef DEAL_II_WITH_MPI
@@ -1062,6 +1069,271 @@ namespace Utilities
 
 
 
+    namespace
+    {
+      /**
+       * The bookkeeping of the blocks allocated by allocate_aligned()
+       * according to a policy other than plain posix_memalign().
+       */
+      struct LargeBlockRegistry
+      {
+        std::mutex mutex;
+
+        /**
+         * The size of each block, and whether it was obtained from mmap.
+         */
+        std::map<void *, std::pair<std::size_t, bool>> blocks;
+
+        /**
+         * The released blocks available for reuse, sorted by size.
+         */
+        std::multimap<std::size_t, void *> pool;
+
+        std::size_t pool_size = 0;
+      };
+
+      // This object is never destroyed because AlignedVector objects with
+      // static storage duration may release their memory after the end of
+      // main().
+      LargeBlockRegistry &
+      get_large_block_registry()
+      {
+        static LargeBlockRegistry *registry = new LargeBlockRegistry();
+        return *registry;
+      }
+
+      // The number of blocks in the registry, which allows free_aligned() to
+      // skip the lock in the common case that no such blocks exist.
+      std::atomic<std::size_t> n_registered_blocks(0);
+
+      MemoryAllocationPolicy memory_allocation_policy;
+
+      // The accounting of the memory returned by allocate_aligned(). The
+      // counters are only updated with relaxed atomic operations, which are
+      // cheap compared to the allocation itself.
+      std::atomic<std::size_t> aligned_bytes_in_use(0);
+      std::atomic<std::size_t> aligned_peak_bytes_in_use(0);
+      std::atomic<std::size_t> aligned_n_blocks_in_use(0);
+
+      void
+      record_aligned_allocation(const std::size_t size)
+      {
+        const std::size_t in_use =
+          aligned_bytes_in_use.fetch_add(size, std::memory_order_relaxed) +
+          size;
+        aligned_n_blocks_in_use.fetch_add(1, std::memory_order_relaxed);
+        std::size_t peak =
+          aligned_peak_bytes_in_use.load(std::memory_order_relaxed);
+        while (in_use > peak &&
+               !aligned_peak_bytes_in_use.compare_exchange_weak(
+                 peak, in_use, std::memory_order_relaxed))
+          {
+          }
+      }
+
+      void
+      record_aligned_deallocation(const std::size_t size)
+      {
+        aligned_bytes_in_use.fetch_sub(size, std::memory_order_relaxed);
+        aligned_n_blocks_in_use.fetch_sub(1, std::memory_order_relaxed);
+      }
+
+      void
+      release_block(void *ptr, const std::pair<std::size_t, bool> &block)
+      {
+#ifdef __linux__
+        if (block.second)
+          {
+            munmap(ptr, block.first);
+            return;
+          }
+#endif
+        std::free(ptr);
+      }
+    } // namespace
+
+
+
+    void
+    set_memory_allocation_policy(const MemoryAllocationPolicy &policy)
+    {
+      AssertThrow(policy.huge_page_size > 0 &&
+                    (policy.huge_page_size & (policy.huge_page_size - 1)) == 0,
+                  ExcMessage("The huge page size must be a power of two."));
+      memory_allocation_policy = policy;
+    }
+
+
+
+    const MemoryAllocationPolicy &
+    get_memory_allocation_policy()
+    {
+      return memory_allocation_policy;
+    }
+
+
+
+    void *
+    allocate_aligned(const std::size_t size, const std::size_t alignment)
+    {
+      const MemoryAllocationPolicy &policy = memory_allocation_policy;
+      if (size < policy.huge_page_size ||
+          (policy.use_transparent_huge_pages == false &&
+           policy.use_explicit_huge_pages == false &&
+           policy.use_memory_pool == false))
+        {
+          void *ptr;
+          posix_memalign(&ptr, alignment, size);
+          record_aligned_allocation(size);
+          return ptr;
+        }
+
+      const std::size_t capacity =
+        (size + policy.huge_page_size - 1) / policy.huge_page_size *
+        policy.huge_page_size;
+      LargeBlockRegistry &registry = get_large_block_registry();
+
+      // reuse a block from the pool that is not more than 50% larger
+      if (policy.use_memory_pool)
+        {
+          std::lock_guard<std::mutex> lock(registry.mutex);
+          const auto it = registry.pool.lower_bound(capacity);
+          if (it != registry.pool.end() && it->first <= capacity + capacity / 2)
+            {
+              void *ptr = it->second;
+              registry.pool_size -= it->first;
+              registry.pool.erase(it);
+              record_aligned_allocation(size);
+              return ptr;
+            }
+        }
+
+      void *ptr    = nullptr;
+      bool  mapped = false;
+#ifdef __linux__
+      if (policy.use_explicit_huge_pages)
+        {
+          ptr = mmap(nullptr,
+                     capacity,
+                     PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB,
+                     -1,
+                     0);
+          if (ptr == MAP_FAILED)
+            ptr = nullptr;
+          else
+            mapped = true;
+        }
+#endif
+      if (ptr == nullptr)
+        {
+          posix_memalign(&ptr,
+                         std::max(alignment, policy.huge_page_size),
+                         capacity);
+#ifdef __linux__
+          if (policy.use_transparent_huge_pages ||
+              policy.use_explicit_huge_pages)
+            madvise(ptr, capacity, MADV_HUGEPAGE);
+#endif
+        }
+
+      std::lock_guard<std::mutex> lock(registry.mutex);
+      registry.blocks[ptr] = std::make_pair(capacity, mapped);
+      ++n_registered_blocks;
+      record_aligned_allocation(size);
+      return ptr;
+    }
+
+
+
+    void
+    free_aligned(void *ptr, const std::size_t size)
+    {
+      if (ptr == nullptr)
+        return;
+      record_aligned_deallocation(size);
+      if (n_registered_blocks == 0)
+        {
+          std::free(ptr);
+          return;
+        }
+
+      LargeBlockRegistry &        registry = get_large_block_registry();
+      std::lock_guard<std::mutex> lock(registry.mutex);
+      const auto                  it = registry.blocks.find(ptr);
+      if (it == registry.blocks.end())
+        std::free(ptr);
+      else if (memory_allocation_policy.use_memory_pool &&
+               registry.pool_size + it->second.first <=
+                 memory_allocation_policy.max_pool_size)
+        {
+          registry.pool.emplace(it->second.first, ptr);
+          registry.pool_size += it->second.first;
+        }
+      else
+        {
+          release_block(ptr, it->second);
+          registry.blocks.erase(it);
+          --n_registered_blocks;
+        }
+    }
+
+
+
+    void
+    release_memory_pool()
+    {
+      LargeBlockRegistry &        registry = get_large_block_registry();
+      std::lock_guard<std::mutex> lock(registry.mutex);
+      for (const auto &entry : registry.pool)
+        {
+          const auto it = registry.blocks.find(entry.second);
+          Assert(it != registry.blocks.end(), ExcInternalError());
+          release_block(it->first, it->second);
+          registry.blocks.erase(it);
+          --n_registered_blocks;
+        }
+      registry.pool.clear();
+      registry.pool_size = 0;
+    }
+
+
+
+    std::size_t
+    memory_pool_size()
+    {
+      LargeBlockRegistry &        registry = get_large_block_registry();
+      std::lock_guard<std::mutex> lock(registry.mutex);
+      return registry.pool_size;
+    }
+
+
+
+    AlignedMemoryStatistics
+    get_aligned_memory_statistics()
+    {
+      AlignedMemoryStatistics statistics;
+      statistics.bytes_in_use =
+        aligned_bytes_in_use.load(std::memory_order_relaxed);
+      statistics.peak_bytes_in_use =
+        aligned_peak_bytes_in_use.load(std::memory_order_relaxed);
+      statistics.n_blocks_in_use =
+        aligned_n_blocks_in_use.load(std::memory_order_relaxed);
+      return statistics;
+    }
+
+
+
+    void
+    reset_aligned_memory_peak()
+    {
+      aligned_peak_bytes_in_use.store(
+        aligned_bytes_in_use.load(std::memory_order_relaxed),
+        std::memory_order_relaxed);
+    }
+
+
+
     bool
     job_supports_mpi()
     {
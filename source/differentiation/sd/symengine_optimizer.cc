@@ -17,12 +17,21 @@
 
 #ifdef DEAL_II_WITH_SYMENGINE
 
+#  include <deal.II/base/mpi.h>
+
 #  include <deal.II/differentiation/sd/symengine_optimizer.h>
 #  include <deal.II/differentiation/sd/symengine_utilities.h>
 
+#  include <boost/archive/binary_iarchive.hpp>
+#  include <boost/archive/binary_oarchive.hpp>
 #  include <boost/archive/text_iarchive.hpp>
 #  include <boost/archive/text_oarchive.hpp>
+#  include <boost/functional/hash.hpp>
 
+#  include <cstdio>
+#  include <fstream>
+#  include <iterator>
+#  include <sstream>
 #  include <utility>
 
 DEAL_II_NAMESPACE_OPEN
@@ -390,6 +399,116 @@ namespace Differentiation
 
 
 
+    template <typename ReturnType>
+    void
+    BatchOptimizer<ReturnType>::optimize(const MPI_Comm &   mpi_communicator,
+                                         const std::string &cache_directory)
+    {
+      Assert(optimized() == false,
+             ExcMessage("Cannot call optimize() more than once."));
+
+      const std::size_t key = hash();
+      const std::string cache_file_name =
+        (cache_directory.empty() ?
+           std::string() :
+           cache_directory + "/sd_batch_optimizer_" + std::to_string(key) +
+             ".bin");
+
+      // Optimize the expressions on the root process, or read the result of
+      // an earlier optimization from the cache
+      std::vector<char> serialized_optimizer;
+      bool              optimized_here = false;
+      if (dealii::Utilities::MPI::this_mpi_process(mpi_communicator) == 0)
+        {
+          std::ifstream cache_file;
+          if (!cache_file_name.empty())
+            cache_file.open(cache_file_name, std::ios::binary);
+
+          if (cache_file)
+            serialized_optimizer.assign(std::istreambuf_iterator<char>(
+                                          cache_file),
+                                        std::istreambuf_iterator<char>());
+          else
+            {
+              optimize();
+              optimized_here = true;
+
+              std::ostringstream oss;
+              {
+                boost::archive::binary_oarchive oa(oss);
+                save(oa, 0);
+              }
+              const std::string buffer = oss.str();
+              serialized_optimizer.assign(buffer.begin(), buffer.end());
+
+              // Write to a temporary file first, so that other programs
+              // sharing the cache never read an incomplete file
+              if (!cache_file_name.empty())
+                {
+                  const std::string temporary_file_name =
+                    cache_file_name + ".tmp";
+                  {
+                    std::ofstream out(temporary_file_name, std::ios::binary);
+                    out.write(buffer.data(), buffer.size());
+                    AssertThrow(out, ExcIO());
+                  }
+                  std::rename(temporary_file_name.c_str(),
+                              cache_file_name.c_str());
+                }
+            }
+        }
+
+      if (dealii::Utilities::MPI::n_mpi_processes(mpi_communicator) > 1)
+        {
+          AssertThrow(dealii::Utilities::MPI::broadcast(mpi_communicator,
+                                                        key,
+                                                        0) == key,
+                      ExcMessage(
+                        "The symbols, functions, or optimization settings of "
+                        "this process differ from those of the root "
+                        "process."));
+          serialized_optimizer =
+            dealii::Utilities::MPI::broadcast(mpi_communicator,
+                                              serialized_optimizer,
+                                              0);
+        }
+
+      if (optimized_here == false)
+        {
+          // The registered symbols and functions are part of the serialized
+          // data, and load() expects them not to be set yet
+          independent_variables_symbols.clear();
+          dependent_variables_functions.clear();
+          map_dep_expr_vec_entry.clear();
+
+          std::istringstream iss(
+            std::string(serialized_optimizer.begin(),
+                        serialized_optimizer.end()));
+          boost::archive::binary_iarchive ia(iss);
+          load(ia, 0);
+        }
+    }
+
+
+
+    template <typename ReturnType>
+    std::size_t
+    BatchOptimizer<ReturnType>::hash() const
+    {
+      std::size_t seed = 0;
+      boost::hash_combine(seed,
+                          dealii::Utilities::type_to_string(ReturnType()));
+      boost::hash_combine(seed, static_cast<int>(method));
+      boost::hash_combine(seed, static_cast<int>(flags));
+      for (const auto &entry : independent_variables_symbols)
+        boost::hash_combine(seed, entry.first.get_RCP()->hash());
+      for (const Expression &function : dependent_variables_functions)
+        boost::hash_combine(seed, function.get_RCP()->hash());
+      return seed;
+    }
+
+
+
     template <typename ReturnType>
     void
     BatchOptimizer<ReturnType>::substitute(
@@ -18,6 +18,7 @@
 
 #include <deal.II/dofs/dof_accessor.h>
 
+#include <cmath>
 #include <limits>
 
 DEAL_II_NAMESPACE_OPEN
@@ -25,6 +26,104 @@ DEAL_II_NAMESPACE_OPEN
 
 namespace parallel
 {
+  // ---------- class MeasuredCellCosts ----------
+
+  template <int dim, int spacedim>
+  MeasuredCellCosts<dim, spacedim>::Scope::Scope(
+    MeasuredCellCosts<dim, spacedim> & costs,
+    const CellAccessor<dim, spacedim> &cell)
+    : costs(costs)
+    , active_cell_index(cell.active_cell_index())
+    , start(std::chrono::steady_clock::now())
+  {
+    AssertIndexRange(active_cell_index, costs.costs.size());
+  }
+
+
+
+  template <int dim, int spacedim>
+  MeasuredCellCosts<dim, spacedim>::Scope::~Scope()
+  {
+    costs.costs[active_cell_index] +=
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+        .count();
+  }
+
+
+
+  template <int dim, int spacedim>
+  MeasuredCellCosts<dim, spacedim>::MeasuredCellCosts(
+    const dealii::Triangulation<dim, spacedim> &tria)
+    : tria(&tria)
+    , costs(tria.n_active_cells())
+  {
+    connection = tria.signals.any_change.connect([this]() { reset(); });
+  }
+
+
+
+  template <int dim, int spacedim>
+  MeasuredCellCosts<dim, spacedim>::~MeasuredCellCosts()
+  {
+    connection.disconnect();
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  MeasuredCellCosts<dim, spacedim>::reset()
+  {
+    costs.assign(tria->n_active_cells(), 0.);
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  MeasuredCellCosts<dim, spacedim>::add(const CellAccessor<dim, spacedim> &cell,
+                                        const double                       cost)
+  {
+    Assert(&cell.get_triangulation() == tria,
+           ExcMessage("The cell does not belong to the triangulation "
+                      "the costs are recorded for."));
+    AssertIndexRange(cell.active_cell_index(), costs.size());
+
+    costs[cell.active_cell_index()] += cost;
+  }
+
+
+
+  template <int dim, int spacedim>
+  double
+  MeasuredCellCosts<dim, spacedim>::get_cost(
+    const CellAccessor<dim, spacedim> &cell) const
+  {
+    if (cell.is_active())
+      {
+        AssertIndexRange(cell.active_cell_index(), costs.size());
+        return costs[cell.active_cell_index()];
+      }
+
+    double cost = 0.;
+    for (unsigned int c = 0; c < cell.n_children(); ++c)
+      cost += get_cost(*cell.child(c));
+    return cost;
+  }
+
+
+
+  template <int dim, int spacedim>
+  const std::vector<double> &
+  MeasuredCellCosts<dim, spacedim>::get_costs() const
+  {
+    return costs;
+  }
+
+
+
+  // ---------- class CellWeights ----------
+
   template <int dim, int spacedim>
   CellWeights<dim, spacedim>::CellWeights(
     const dealii::DoFHandler<dim, spacedim> &dof_handler,
@@ -123,6 +222,34 @@ namespace parallel
 
 
 
+  template <int dim, int spacedim>
+  typename CellWeights<dim, spacedim>::WeightingFunction
+  CellWeights<dim, spacedim>::measured_weighting(
+    const MeasuredCellCosts<dim, spacedim> &costs,
+    const double                            weight_per_cost,
+    const unsigned int                      minimum_weight)
+  {
+    Assert(weight_per_cost >= 0.,
+           ExcMessage("The weight per cost must not be negative."));
+
+    return [&costs, weight_per_cost, minimum_weight](
+             const typename DoFHandler<dim, spacedim>::cell_iterator &cell,
+             const FiniteElement<dim, spacedim> &) -> unsigned int {
+      const double result =
+        std::round(minimum_weight + weight_per_cost * costs.get_cost(*cell));
+
+      Assert(result >= 0. &&
+               result <=
+                 static_cast<double>(std::numeric_limits<unsigned int>::max()),
+             ExcMessage(
+               "Cannot cast determined weight for this cell to unsigned int!"));
+
+      return static_cast<unsigned int>(result);
+    };
+  }
+
+
+
   // ---------- handling callback functions ----------
 
   template <int dim, int spacedim>
@@ -23,6 +23,9 @@
 #include <deal.II/grid/cell_id_translator.h>
 #include <deal.II/grid/filtered_iterator.h>
 
+#include <algorithm>
+#include <numeric>
+
 DEAL_II_NAMESPACE_OPEN
 
 
@@ -343,6 +346,128 @@ namespace RepartitioningPolicyTools
   }
 
 
+  template <int dim, int spacedim>
+  NodeAwarePolicy<dim, spacedim>::NodeAwarePolicy(
+    const std::function<
+      unsigned int(const typename Triangulation<dim, spacedim>::cell_iterator &,
+                   const typename Triangulation<dim, spacedim>::CellStatus)>
+      &weighting_function)
+    : weighting_function(weighting_function)
+  {}
+
+
+
+  template <int dim, int spacedim>
+  LinearAlgebra::distributed::Vector<double>
+  NodeAwarePolicy<dim, spacedim>::partition(
+    const Triangulation<dim, spacedim> &tria_in) const
+  {
+#ifndef DEAL_II_WITH_MPI
+    (void)tria_in;
+    return {};
+#else
+
+    const auto tria =
+      dynamic_cast<const parallel::TriangulationBase<dim, spacedim> *>(
+        &tria_in);
+
+    Assert(tria, ExcNotImplemented());
+
+    const auto partitioner =
+      tria->global_active_cell_index_partitioner().lock();
+
+    const auto mpi_communicator = tria_in.get_communicator();
+    const auto n_subdomains = Utilities::MPI::n_mpi_processes(mpi_communicator);
+    const auto my_rank = Utilities::MPI::this_mpi_process(mpi_communicator);
+
+    // step 1) discover the layout of the machine: identify each node by the
+    // smallest rank running on it and collect the ranks node by node. The
+    // ranks are then numbered in this order, so that the ranks of one node
+    // get consecutive slots.
+    std::vector<unsigned int> rank_of_slot(n_subdomains);
+    {
+      MPI_Comm node_communicator;
+      int      ierr = MPI_Comm_split_type(mpi_communicator,
+                                     MPI_COMM_TYPE_SHARED,
+                                     my_rank,
+                                     MPI_INFO_NULL,
+                                     &node_communicator);
+      AssertThrowMPI(ierr);
+
+      const unsigned int node_id =
+        Utilities::MPI::min(my_rank, node_communicator);
+
+      Utilities::MPI::free_communicator(node_communicator);
+
+      const std::vector<unsigned int> node_ids =
+        Utilities::MPI::all_gather(mpi_communicator, node_id);
+
+      std::iota(rank_of_slot.begin(), rank_of_slot.end(), 0);
+      std::stable_sort(rank_of_slot.begin(),
+                       rank_of_slot.end(),
+                       [&](const unsigned int a, const unsigned int b) {
+                         return node_ids[a] < node_ids[b];
+                       });
+    }
+
+    // step 2) determine weight of each cell
+    std::vector<unsigned int> weights(partitioner->locally_owned_size(), 1);
+
+    if (weighting_function)
+      for (const auto &cell :
+           tria->active_cell_iterators() | IteratorFilters::LocallyOwnedCell())
+        weights[partitioner->global_to_local(
+          cell->global_active_cell_index())] =
+          weighting_function(
+            cell, Triangulation<dim, spacedim>::CellStatus::CELL_PERSIST);
+
+    std::uint64_t process_local_weight = 0;
+    for (const auto &weight : weights)
+      process_local_weight += weight;
+
+    std::uint64_t process_local_weight_offset = 0;
+
+    int ierr = MPI_Exscan(
+      &process_local_weight,
+      &process_local_weight_offset,
+      1,
+      Utilities::MPI::mpi_type_id_for_type<decltype(process_local_weight)>,
+      MPI_SUM,
+      mpi_communicator);
+    AssertThrowMPI(ierr);
+
+    std::uint64_t total_weight =
+      process_local_weight_offset + process_local_weight;
+
+    ierr =
+      MPI_Bcast(&total_weight,
+                1,
+                Utilities::MPI::mpi_type_id_for_type<decltype(total_weight)>,
+                n_subdomains - 1,
+                mpi_communicator);
+    AssertThrowMPI(ierr);
+
+    // step 3) split the curve into equally weighted slots. Since the slots
+    // of a node are consecutive, this first splits the cells among the nodes
+    // according to their number of processes and then among the processes
+    // of each node.
+    LinearAlgebra::distributed::Vector<double> partition(partitioner);
+
+    for (std::uint64_t i = 0, weight = process_local_weight_offset;
+         i < partition.locally_owned_size();
+         weight += weights[i], ++i)
+      {
+        const unsigned int slot =
+          (total_weight == 0) ? 0 : (weight * n_subdomains / total_weight);
+        partition.local_element(i) = rank_of_slot[slot];
+      }
+
+    return partition;
+#endif
+  }
+
+
+
 } // namespace RepartitioningPolicyTools
 
 
@@ -36,6 +36,7 @@
 #  include <deal.II/lac/trilinos_vector.h>
 #  include <deal.II/lac/vector.h>
 
+#  include <cstring>
 #  include <functional>
 #  include <numeric>
 
@@ -43,70 +44,6 @@
 DEAL_II_NAMESPACE_OPEN
 
 
-namespace
-{
-  /**
-   * Optimized pack function for values assigned on degrees of freedom.
-   *
-   * Given that the elements of @p dof_values are stored in consecutive
-   * locations, we can just memcpy them. Since floating point values don't
-   * compress well, we also waive the compression that the default
-   * Utilities::pack() and Utilities::unpack() functions offer.
-   */
-  template <typename value_type>
-  std::vector<char>
-  pack_dof_values(std::vector<Vector<value_type>> &dof_values,
-                  const unsigned int               dofs_per_cell)
-  {
-    for (const auto &values : dof_values)
-      {
-        AssertDimension(values.size(), dofs_per_cell);
-        (void)values;
-      }
-
-    const std::size_t bytes_per_entry = sizeof(value_type) * dofs_per_cell;
-
-    std::vector<char> buffer(dof_values.size() * bytes_per_entry);
-    for (unsigned int i = 0; i < dof_values.size(); ++i)
-      std::memcpy(&buffer[i * bytes_per_entry],
-                  &dof_values[i](0),
-                  bytes_per_entry);
-
-    return buffer;
-  }
-
-
-
-  /**
-   * Optimized unpack function for values assigned on degrees of freedom.
-   */
-  template <typename value_type>
-  std::vector<Vector<value_type>>
-  unpack_dof_values(
-    const boost::iterator_range<std::vector<char>::const_iterator> &data_range,
-    const unsigned int dofs_per_cell)
-  {
-    const std::size_t  bytes_per_entry = sizeof(value_type) * dofs_per_cell;
-    const unsigned int n_elements      = data_range.size() / bytes_per_entry;
-
-    Assert((data_range.size() % bytes_per_entry == 0), ExcInternalError());
-
-    std::vector<Vector<value_type>> unpacked_data;
-    unpacked_data.reserve(n_elements);
-    for (unsigned int i = 0; i < n_elements; ++i)
-      {
-        Vector<value_type> dof_values(dofs_per_cell);
-        std::memcpy(&dof_values(0),
-                    &(*std::next(data_range.begin(), i * bytes_per_entry)),
-                    bytes_per_entry);
-        unpacked_data.emplace_back(std::move(dof_values));
-      }
-
-    return unpacked_data;
-  }
-} // namespace
-
-
 
 namespace parallel
 {
@@ -315,10 +252,6 @@ namespace parallel
       typename DoFHandler<dim, spacedim>::cell_iterator cell(*cell_,
                                                              dof_handler);
 
-      // create buffer for each individual object
-      std::vector<::dealii::Vector<typename VectorType::value_type>> dof_values(
-        input_vectors.size());
-
       unsigned int fe_index = 0;
       if (dof_handler->has_hp_capabilities())
         {
@@ -363,16 +296,42 @@ namespace parallel
       if (dofs_per_cell == 0)
         return std::vector<char>(); // nothing to do for FE_Nothing
 
-      auto it_input  = input_vectors.cbegin();
-      auto it_output = dof_values.begin();
-      for (; it_input != input_vectors.cend(); ++it_input, ++it_output)
+      // The values of all vectors are packed one after the other into a
+      // single buffer. Since floating point values don't compress well, we
+      // waive the compression that the default Utilities::pack() offers and
+      // write them directly into the buffer.
+      using value_type                  = typename VectorType::value_type;
+      const std::size_t bytes_per_entry = sizeof(value_type) * dofs_per_cell;
+      std::vector<char> buffer(input_vectors.size() * bytes_per_entry);
+
+      // On active cells that keep their finite element, the values can be
+      // read directly into the buffer, which is suitably aligned since all
+      // entries are of the same type. Otherwise, we need to interpolate.
+      const bool read_values_directly =
+        cell->is_active() && (dof_handler->has_hp_capabilities() == false ||
+                              fe_index == cell->active_fe_index());
+
+      for (unsigned int i = 0; i < input_vectors.size(); ++i)
         {
-          it_output->reinit(dofs_per_cell);
-          cell->get_interpolated_dof_values(*(*it_input), *it_output, fe_index);
+          value_type *buffer_values =
+            reinterpret_cast<value_type *>(&buffer[i * bytes_per_entry]);
+          if (read_values_directly)
+            cell->get_dof_values(*input_vectors[i],
+                                 buffer_values,
+                                 buffer_values + dofs_per_cell);
+          else
+            {
+              cell_dof_values.reinit(dofs_per_cell);
+              cell->get_interpolated_dof_values(*input_vectors[i],
+                                                cell_dof_values,
+                                                fe_index);
+              std::memcpy(buffer_values,
+                          cell_dof_values.begin(),
+                          bytes_per_entry);
+            }
         }
 
-      return pack_dof_values<typename VectorType::value_type>(dof_values,
-                                                              dofs_per_cell);
+      return buffer;
     }
 
 
@@ -434,45 +393,41 @@ namespace parallel
       if (dofs_per_cell == 0)
         return; // nothing to do for FE_Nothing
 
-      const std::vector<::dealii::Vector<typename VectorType::value_type>>
-        dof_values =
-          unpack_dof_values<typename VectorType::value_type>(data_range,
-                                                             dofs_per_cell);
+      using value_type                  = typename VectorType::value_type;
+      const std::size_t bytes_per_entry = sizeof(value_type) * dofs_per_cell;
 
       // check if sizes match
-      Assert(dof_values.size() == all_out.size(), ExcInternalError());
-
-      // check if we have enough dofs provided by the FE object
-      // to interpolate the transferred data correctly
-      for (auto it_dof_values = dof_values.begin();
-           it_dof_values != dof_values.end();
-           ++it_dof_values)
-        Assert(
-          dofs_per_cell == it_dof_values->size(),
-          ExcMessage(
-            "The transferred data was packed with a different number of dofs than the "
-            "currently registered FE object assigned to the DoFHandler has."));
-
-      // distribute data for each registered vector on mesh
-      auto it_input  = dof_values.cbegin();
-      auto it_output = all_out.begin();
-      for (; it_input != dof_values.cend(); ++it_input, ++it_output)
-        if (average_values)
-          cell->distribute_local_to_global_by_interpolation(*it_input,
-                                                            *(*it_output),
-                                                            fe_index);
-        else
-          cell->set_dof_values_by_interpolation(*it_input,
-                                                *(*it_output),
-                                                fe_index,
-                                                true);
+      Assert(data_range.size() == all_out.size() * bytes_per_entry,
+             ExcMessage(
+               "The transferred data was packed with a different number of "
+               "dofs or vectors than the currently registered FE object "
+               "assigned to the DoFHandler has or than vectors were given."));
+
+      // distribute data for each registered vector on mesh, reusing the
+      // storage of the local values for all cells
+      cell_dof_values.reinit(dofs_per_cell, /*omit_zeroing_entries=*/true);
+      for (unsigned int i = 0; i < all_out.size(); ++i)
+        {
+          std::memcpy(cell_dof_values.begin(),
+                      &(*std::next(data_range.begin(), i * bytes_per_entry)),
+                      bytes_per_entry);
+
+          if (average_values)
+            cell->distribute_local_to_global_by_interpolation(cell_dof_values,
+                                                              *all_out[i],
+                                                              fe_index);
+          else
+            cell->set_dof_values_by_interpolation(cell_dof_values,
+                                                  *all_out[i],
+                                                  fe_index,
+                                                  true);
+        }
 
       if (average_values)
         {
           // compute valence vector if averaging should be performed
-          Vector<typename VectorType::value_type> ones(dofs_per_cell);
-          ones = 1.0;
-          cell->distribute_local_to_global_by_interpolation(ones,
+          cell_dof_values = 1.0;
+          cell->distribute_local_to_global_by_interpolation(cell_dof_values,
                                                             valence,
                                                             fe_index);
         }
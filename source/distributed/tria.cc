@@ -16,7 +16,10 @@
 
 #include <deal.II/base/logstream.h>
 #include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/point.h>
+#include <deal.II/base/thread_management.h>
+#include <deal.II/base/tracing.h>
 #include <deal.II/base/utilities.h>
 
 #include <deal.II/distributed/p4est_wrappers.h>
@@ -28,9 +31,11 @@
 #include <deal.II/grid/tria_iterator.h>
 
 #include <algorithm>
+#include <array>
 #include <fstream>
 #include <iostream>
 #include <limits>
+#include <map>
 #include <numeric>
 
 
@@ -571,7 +576,21 @@ namespace
   class PartitionSearch
   {
   public:
-    PartitionSearch()
+    /**
+     * The type of the key by which the mappings of the visited quadrants are
+     * stored, consisting of the index of the tree, the level, and the
+     * coordinates of the quadrant.
+     */
+    using QuadrantKey = std::array<std::int64_t, 5>;
+
+    /**
+     * Constructor. The mappings of the quadrants visited by the search are
+     * looked up in and added to @p quadrant_mappings, which can be kept
+     * between searches on the same forest.
+     */
+    PartitionSearch(
+      std::map<QuadrantKey, FullMatrix<double>> &quadrant_mappings)
+      : quadrant_mappings(quadrant_mappings)
     {
       Assert(dim > 1, ExcNotImplemented());
     }
@@ -640,6 +659,20 @@ namespace
       void
       initialize_mapping();
 
+      /**
+       * Return the coefficients of the mapping, which must have been
+       * initialized before.
+       */
+      const FullMatrix<double> &
+      get_mapping() const;
+
+      /**
+       * Set the coefficients of the mapping to @p mapping, as previously
+       * obtained by get_mapping() for the same quadrant.
+       */
+      void
+      set_mapping(const FullMatrix<double> &mapping);
+
       Point<dim>
       map_real_to_unit_cell(const Point<dim> &p) const;
 
@@ -660,14 +693,46 @@ namespace
       bool is_reference_mapping_initialized;
     };
 
+    /**
+     * Return the key of @p quadrant in the tree with index @p which_tree.
+     */
+    static QuadrantKey
+    get_quadrant_key(
+      const typename internal::p4est::types<dim>::topidx    which_tree,
+      const typename internal::p4est::types<dim>::quadrant &quadrant);
+
     /**
      * Quadrant data to be filled upon call of `local_quadrant_fn`.
      */
     QuadrantData quadrant_data;
+
+    /**
+     * The mappings of all quadrants visited so far.
+     */
+    std::map<QuadrantKey, FullMatrix<double>> &quadrant_mappings;
   }; // class PartitionSearch
 
 
 
+  template <int dim>
+  typename PartitionSearch<dim>::QuadrantKey
+  PartitionSearch<dim>::get_quadrant_key(
+    const typename internal::p4est::types<dim>::topidx    which_tree,
+    const typename internal::p4est::types<dim>::quadrant &quadrant)
+  {
+    QuadrantKey key = {{static_cast<std::int64_t>(which_tree),
+                        static_cast<std::int64_t>(quadrant.level),
+                        static_cast<std::int64_t>(quadrant.x),
+                        static_cast<std::int64_t>(quadrant.y),
+                        0}};
+    if constexpr (dim == 3)
+      key[4] = static_cast<std::int64_t>(quadrant.z);
+
+    return key;
+  }
+
+
+
   template <int dim>
   int
   PartitionSearch<dim>::local_quadrant_fn(
@@ -695,6 +760,16 @@ namespace
               static_cast<typename internal::p4est::types<dim>::quadrant_coord>(
                 quadrant->level));
 
+    // the mapping of a quadrant only depends on the vertices of the coarse
+    // cell, so we can reuse it if this quadrant has been visited before
+    const QuadrantKey key = get_quadrant_key(which_tree, *quadrant);
+    const auto        stored_mapping = this_object->quadrant_mappings.find(key);
+    if (stored_mapping != this_object->quadrant_mappings.end())
+      {
+        this_object->quadrant_data.set_mapping(stored_mapping->second);
+        return /* true */ 1;
+      }
+
     this_object->quadrant_data.set_cell_vertices(forest,
                                                  which_tree,
                                                  quadrant,
@@ -702,6 +777,8 @@ namespace
 
     // from cell vertices we can initialize the mapping
     this_object->quadrant_data.initialize_mapping();
+    this_object->quadrant_mappings.emplace(
+      key, this_object->quadrant_data.get_mapping());
 
     // always return true since we must decide by point
     return /* true */ 1;
@@ -909,6 +986,32 @@ namespace
 
 
 
+  template <int dim>
+  const FullMatrix<double> &
+  PartitionSearch<dim>::QuadrantData::get_mapping() const
+  {
+    Assert(is_reference_mapping_initialized,
+           dealii::ExcMessage("The mapping has not been initialized."));
+
+    return quadrant_mapping_matrix;
+  }
+
+
+
+  template <int dim>
+  void
+  PartitionSearch<dim>::QuadrantData::set_mapping(
+    const FullMatrix<double> &mapping)
+  {
+    AssertDimension(mapping.m(), quadrant_mapping_matrix.m());
+    AssertDimension(mapping.n(), quadrant_mapping_matrix.n());
+
+    quadrant_mapping_matrix          = mapping;
+    is_reference_mapping_initialized = true;
+  }
+
+
+
   template <>
   void
   PartitionSearch<2>::QuadrantData::set_cell_vertices(
@@ -1695,6 +1798,24 @@ namespace parallel
   namespace distributed
   {
     /*----------------- class Triangulation<dim,spacedim> ---------------\*/
+    /**
+     * The data find_point_owner_rank() keeps between calls, reset whenever
+     * the mesh changes.
+     */
+    template <int dim, int spacedim>
+    struct Triangulation<dim, spacedim>::PointOwnerSearchCache
+    {
+#  ifdef P4EST_SEARCH_LOCAL
+      /**
+       * The mappings of the quadrants visited by the searches so far.
+       */
+      std::map<typename PartitionSearch<dim>::QuadrantKey, FullMatrix<double>>
+        quadrant_mappings;
+#  endif
+    };
+
+
+
     template <int dim, int spacedim>
     Triangulation<dim, spacedim>::Triangulation(
       const MPI_Comm &mpi_communicator,
@@ -1838,6 +1959,8 @@ namespace parallel
       coarse_cell_to_p4est_tree_permutation.resize(0);
       p4est_tree_to_coarse_cell_permutation.resize(0);
 
+      point_owner_search_cache.reset();
+
       dealii::parallel::DistributedTriangulationBase<dim, spacedim>::clear();
 
       this->update_number_cache();
@@ -2082,17 +2205,30 @@ namespace parallel
         connectivity);
       connectivity = nullptr;
 
-      unsigned int version, numcpus, attached_count_fixed,
-        attached_count_variable, n_coarse_cells;
-      {
-        std::string   fname = std::string(filename) + ".info";
-        std::ifstream f(fname.c_str());
-        AssertThrow(f.fail() == false, ExcIO());
-        std::string firstline;
-        getline(f, firstline); // skip first line
-        f >> version >> numcpus >> attached_count_fixed >>
-          attached_count_variable >> n_coarse_cells;
-      }
+      // Only the first process reads the .info file and sends its content
+      // to all others, which avoids that all processes access the same
+      // file at once when restarting on many processes. The last entry
+      // denotes whether the file could be read.
+      std::array<unsigned int, 6> info = {};
+      if (myrank == 0)
+        {
+          std::string   fname = std::string(filename) + ".info";
+          std::ifstream f(fname.c_str());
+          std::string   firstline;
+          getline(f, firstline); // skip first line
+          f >> info[0] >> info[1] >> info[2] >> info[3] >> info[4];
+          info[5] = f.fail() ? 0 : 1;
+        }
+      Utilities::MPI::broadcast(info.data(),
+                                info.size(),
+                                0,
+                                this->mpi_communicator);
+      AssertThrow(info[5] == 1, ExcIO());
+
+      const unsigned int version                 = info[0];
+      const unsigned int attached_count_fixed    = info[2];
+      const unsigned int attached_count_variable = info[3];
+      const unsigned int n_coarse_cells          = info[4];
 
       AssertThrow(version == 5,
                   ExcMessage("Incompatible version found in .info file."));
@@ -2772,6 +2908,9 @@ namespace parallel
     void
     Triangulation<dim, spacedim>::copy_local_forest_to_triangulation()
     {
+      // the mesh changes, so the data of previous point searches is invalid
+      point_owner_search_cache.reset();
+
       // Disable mesh smoothing for recreating the deal.II triangulation,
       // otherwise we might not be able to reproduce the p4est mesh
       // exactly. We restore the original smoothing at the end of this
@@ -3004,9 +3143,15 @@ namespace parallel
 
           // step 2: make sure all the neighbors to our level_cells exist.
           // Need to look up in p4est...
+          // the levels are independent of each other, so mark the vertices
+          // on all levels in parallel
           std::vector<std::vector<bool>> marked_vertices(this->n_levels());
+          Threads::TaskGroup<void>       tasks;
           for (unsigned int lvl = 0; lvl < this->n_levels(); ++lvl)
-            marked_vertices[lvl] = mark_locally_active_vertices_on_level(lvl);
+            tasks += Threads::new_task([this, lvl, &marked_vertices]() {
+              marked_vertices[lvl] = mark_locally_active_vertices_on_level(lvl);
+            });
+          tasks.join_all();
 
           for (const auto &cell : this->cell_iterators_on_level(0))
             {
@@ -3135,25 +3280,34 @@ namespace parallel
       return std::vector<unsigned int>(1,
                                        dealii::numbers::invalid_subdomain_id);
 #  else
-      // We can only use this function if vertices are communicated to p4est
-      AssertThrow(this->are_vertices_communicated_to_p4est(),
-                  ExcMessage(
-                    "Vertices need to be communicated to p4est to use this "
-                    "function. This must explicitly be turned on in the "
-                    "settings of the triangulation's constructor."));
-
-      // We can only use this function if all manifolds are flat
-      for (const auto &manifold_id : this->get_manifold_ids())
+      // The requirements are only checked once after each change of the mesh,
+      // since collecting the manifold ids requires a loop over all cells
+      if (point_owner_search_cache == nullptr)
         {
-          AssertThrow(
-            manifold_id == numbers::flat_manifold_id,
-            ExcMessage(
-              "This function can only be used if the triangulation "
-              "has no other manifold than a Cartesian (flat) manifold attached."));
+          // We can only use this function if vertices are communicated to
+          // p4est
+          AssertThrow(this->are_vertices_communicated_to_p4est(),
+                      ExcMessage(
+                        "Vertices need to be communicated to p4est to use this "
+                        "function. This must explicitly be turned on in the "
+                        "settings of the triangulation's constructor."));
+
+          // We can only use this function if all manifolds are flat
+          for (const auto &manifold_id : this->get_manifold_ids())
+            {
+              AssertThrow(
+                manifold_id == numbers::flat_manifold_id,
+                ExcMessage(
+                  "This function can only be used if the triangulation "
+                  "has no other manifold than a Cartesian (flat) manifold attached."));
+            }
+
+          point_owner_search_cache = std::make_unique<PointOwnerSearchCache>();
         }
 
       // Create object for callback
-      PartitionSearch<dim> partition_search;
+      PartitionSearch<dim> partition_search(
+        point_owner_search_cache->quadrant_mappings);
 
       // Pointer should be this triangulation before we set it to something else
       Assert(parallel_forest->user_pointer == this, ExcInternalError());
@@ -3224,6 +3378,11 @@ namespace parallel
     void
     Triangulation<dim, spacedim>::execute_coarsening_and_refinement()
     {
+      DEAL_II_TRACE_SCOPE(
+        "parallel::distributed::Triangulation::"
+        "execute_coarsening_and_refinement",
+        "grid");
+
       // do not allow anisotropic refinement
 #  ifdef DEBUG
       for (const auto &cell : this->active_cell_iterators())
@@ -3593,6 +3752,172 @@ namespace parallel
 
 
 
+    template <int dim, int spacedim>
+    typename Triangulation<dim, spacedim>::RepartitionEstimate
+    Triangulation<dim, spacedim>::estimate_repartition() const
+    {
+      Assert(this->local_cell_relations.size() ==
+               static_cast<unsigned int>(parallel_forest->local_num_quadrants),
+             ExcInternalError());
+
+      const unsigned int n_procs = parallel_forest->mpisize;
+      const unsigned int my_rank = parallel_forest->mpirank;
+
+      // without a function connected to the weight signal, p4est balances
+      // the number of cells, which corresponds to unit weights
+      const std::vector<unsigned int> cell_weights =
+        this->signals.weight.empty() ?
+          std::vector<unsigned int>(this->local_cell_relations.size(), 1U) :
+          get_cell_weights();
+
+      std::uint64_t local_weight = 0;
+      for (const auto weight : cell_weights)
+        local_weight += weight;
+
+      std::uint64_t local_weight_offset = 0;
+      const int     ierr                = MPI_Exscan(
+        &local_weight,
+        &local_weight_offset,
+        1,
+        Utilities::MPI::mpi_type_id_for_type<decltype(local_weight)>,
+        MPI_SUM,
+        this->mpi_communicator);
+      AssertThrowMPI(ierr);
+
+      const std::uint64_t total_weight =
+        Utilities::MPI::sum(local_weight, this->mpi_communicator);
+
+      RepartitionEstimate estimate;
+      estimate.current_max_weight =
+        Utilities::MPI::max(local_weight, this->mpi_communicator);
+
+      // p4est cuts the space-filling curve where the prefix sum of the
+      // weights passes a multiple of total_weight/n_procs. assign each
+      // locally owned cell to its new owner accordingly and add up the
+      // weights on the new owners as well as the size of the data that
+      // leaves this process
+      std::vector<std::uint64_t> new_weights(n_procs, 0);
+      types::global_cell_index   n_migrated_cells       = 0;
+      std::uint64_t              n_migrated_bytes       = 0;
+      std::uint64_t              fixed_bytes_per_cell   = 0;
+      bool                       fixed_bytes_determined = false;
+
+      std::uint64_t prefix_weight = local_weight_offset;
+      for (unsigned int c = 0; c < cell_weights.size(); ++c)
+        {
+          const unsigned int new_owner =
+            total_weight > 0 ?
+              std::min<unsigned int>(
+                static_cast<unsigned int>(static_cast<double>(prefix_weight) /
+                                          total_weight * n_procs),
+                n_procs - 1) :
+              my_rank;
+          new_weights[new_owner] += cell_weights[c];
+          prefix_weight += cell_weights[c];
+
+          if (new_owner == my_rank)
+            continue;
+
+          ++n_migrated_cells;
+
+          const auto &cell_it     = this->local_cell_relations[c].first;
+          const auto &cell_status = this->local_cell_relations[c].second;
+
+          // all cells have the same size of fixed data, so it suffices to
+          // pack the first cell to determine it
+          if (fixed_bytes_determined == false)
+            {
+              for (const auto &callback :
+                   this->cell_attached_data.pack_callbacks_fixed)
+                fixed_bytes_per_cell += callback(cell_it, cell_status).size();
+              fixed_bytes_determined = true;
+            }
+          n_migrated_bytes += fixed_bytes_per_cell;
+
+          // for variable size data, the size of the data of each cell is
+          // sent in addition
+          if (this->cell_attached_data.pack_callbacks_variable.size() > 0)
+            n_migrated_bytes += sizeof(unsigned int);
+          for (const auto &callback :
+               this->cell_attached_data.pack_callbacks_variable)
+            n_migrated_bytes += callback(cell_it, cell_status).size();
+        }
+
+      Utilities::MPI::sum(new_weights, this->mpi_communicator, new_weights);
+      estimate.predicted_max_weight =
+        *std::max_element(new_weights.begin(), new_weights.end());
+
+      estimate.n_migrated_cells =
+        Utilities::MPI::sum(n_migrated_cells, this->mpi_communicator);
+      estimate.n_migrated_bytes =
+        Utilities::MPI::sum(n_migrated_bytes, this->mpi_communicator);
+      estimate.max_migrated_bytes_per_process =
+        Utilities::MPI::max(n_migrated_bytes, this->mpi_communicator);
+
+      if (total_weight > 0)
+        {
+          const double average_weight =
+            static_cast<double>(total_weight) / n_procs;
+          estimate.current_imbalance =
+            estimate.current_max_weight / average_weight - 1.;
+          estimate.predicted_imbalance =
+            estimate.predicted_max_weight / average_weight - 1.;
+        }
+
+      return estimate;
+    }
+
+
+
+    template <int dim, int spacedim>
+    bool
+    Triangulation<dim, spacedim>::repartition_if_imbalanced(
+      const double imbalance_tolerance,
+      const double cost_per_migrated_byte)
+    {
+      Assert(imbalance_tolerance >= 0.,
+             ExcMessage("The imbalance tolerance must not be negative."));
+      Assert(cost_per_migrated_byte >= 0.,
+             ExcMessage("The cost per migrated byte must not be negative."));
+
+      const RepartitionEstimate estimate = estimate_repartition();
+
+      // all quantities of the estimate are global, so all processes take the
+      // same decision
+      bool do_repartition = estimate.current_imbalance > imbalance_tolerance;
+      if (do_repartition && cost_per_migrated_byte > 0.)
+        {
+          const double gain =
+            static_cast<double>(estimate.current_max_weight) -
+            static_cast<double>(estimate.predicted_max_weight);
+          const double cost = cost_per_migrated_byte *
+                              estimate.max_migrated_bytes_per_process;
+          do_repartition = gain > cost;
+        }
+
+      if (do_repartition)
+        {
+          repartition();
+          return true;
+        }
+
+      // hand the attached data back to the cells on this process, so that it
+      // can be unpacked the same way as after repartition()
+      if (this->cell_attached_data.n_attached_data_sets > 0)
+        {
+          this->data_transfer.pack_data(
+            this->local_cell_relations,
+            this->cell_attached_data.pack_callbacks_fixed,
+            this->cell_attached_data.pack_callbacks_variable);
+          this->execute_transfer(parallel_forest,
+                                 parallel_forest->global_first_quadrant);
+        }
+
+      return false;
+    }
+
+
+
     template <int dim, int spacedim>
     const std::vector<types::global_dof_index> &
     Triangulation<dim, spacedim>::get_p4est_tree_to_coarse_cell_permutation()
@@ -3996,27 +4321,39 @@ namespace parallel
       this->local_cell_relations.resize(parallel_forest->local_num_quadrants);
       this->local_cell_relations.shrink_to_fit();
 
-      // recurse over p4est
-      for (const auto &cell : this->cell_iterators_on_level(0))
-        {
-          // skip coarse cells that are not ours
-          if (tree_exists_locally<dim, spacedim>(
-                parallel_forest,
-                coarse_cell_to_p4est_tree_permutation[cell->index()]) == false)
-            continue;
+      // recurse over p4est. the relations of the cells of each tree are
+      // stored at the positions of the quadrants of that tree, so the trees
+      // can be worked on in parallel
+      parallel::apply_to_subranges(
+        0U,
+        this->n_cells(0),
+        [this](const unsigned int begin, const unsigned int end) {
+          for (unsigned int index = begin; index < end; ++index)
+            {
+              // skip coarse cells that are not ours
+              if (tree_exists_locally<dim, spacedim>(
+                    parallel_forest,
+                    coarse_cell_to_p4est_tree_permutation[index]) == false)
+                continue;
 
-          // initialize auxiliary top level p4est quadrant
-          typename dealii::internal::p4est::types<dim>::quadrant
-            p4est_coarse_cell;
-          dealii::internal::p4est::init_coarse_quadrant<dim>(p4est_coarse_cell);
+              const typename dealii::Triangulation<dim, spacedim>::
+                cell_iterator cell(this, 0, index);
 
-          // determine tree to start recursion on
-          typename dealii::internal::p4est::types<dim>::tree *tree =
-            init_tree(cell->index());
+              // initialize auxiliary top level p4est quadrant
+              typename dealii::internal::p4est::types<dim>::quadrant
+                p4est_coarse_cell;
+              dealii::internal::p4est::init_coarse_quadrant<dim>(
+                p4est_coarse_cell);
 
-          update_cell_relations_recursively<dim, spacedim>(
-            this->local_cell_relations, *tree, cell, p4est_coarse_cell);
-        }
+              // determine tree to start recursion on
+              typename dealii::internal::p4est::types<dim>::tree *tree =
+                init_tree(index);
+
+              update_cell_relations_recursively<dim, spacedim>(
+                this->local_cell_relations, *tree, cell, p4est_coarse_cell);
+            }
+        },
+        /* grainsize */ 1);
     }
 
 
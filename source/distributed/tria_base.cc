@@ -36,6 +36,7 @@
 #include <fstream>
 #include <iostream>
 #include <limits>
+#include <memory>
 #include <numeric>
 
 
@@ -645,10 +646,55 @@ namespace parallel
         check_for_distorted_cells)
     , cell_attached_data({0, 0, {}, {}})
     , data_transfer(mpi_communicator)
+    , asynchronous_save(false)
   {}
 
 
 
+  template <int dim, int spacedim>
+  void
+  DistributedTriangulationBase<dim, spacedim>::set_asynchronous_save(
+    const bool asynchronous)
+  {
+    asynchronous_save = asynchronous;
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  DistributedTriangulationBase<dim, spacedim>::wait_for_save() const
+  {
+    // all processes need to wait for each other, since another process
+    // might read from the region of the files written by this one
+    const bool is_pending =
+      Utilities::MPI::max(pending_save.joinable() ? 1 : 0,
+                          this->mpi_communicator) != 0;
+    if (is_pending == false)
+      return;
+
+    // make sure that all processes get to the reduction below even if
+    // writing has failed on some of them
+    bool success = true;
+    if (pending_save.joinable())
+      {
+        try
+          {
+            pending_save.join();
+          }
+        catch (...)
+          {
+            success = false;
+          }
+        pending_save = Threads::Task<void>();
+      }
+    AssertThrow(Utilities::MPI::min(success ? 1 : 0, this->mpi_communicator) !=
+                  0,
+                ExcIO());
+  }
+
+
+
   template <int dim, int spacedim>
   void
   DistributedTriangulationBase<dim, spacedim>::clear()
@@ -672,6 +718,9 @@ namespace parallel
     auto tria = const_cast<
       dealii::parallel::DistributedTriangulationBase<dim, spacedim> *>(this);
 
+    // the files of a previous call might be the same as the ones written now
+    wait_for_save();
+
     if (this->cell_attached_data.n_attached_data_sets > 0)
       {
         // pack attached data first
@@ -680,8 +729,16 @@ namespace parallel
           tria->cell_attached_data.pack_callbacks_fixed,
           tria->cell_attached_data.pack_callbacks_variable);
 
-        // then store buffers in file
-        tria->data_transfer.save(global_first_cell, global_num_cells, filename);
+        // then store buffers in file, possibly in the background
+        if (asynchronous_save)
+          pending_save =
+            tria->data_transfer.save_in_background(global_first_cell,
+                                                   global_num_cells,
+                                                   filename);
+        else
+          tria->data_transfer.save(global_first_cell,
+                                   global_num_cells,
+                                   filename);
 
         // and release the memory afterwards
         tria->data_transfer.clear();
@@ -735,6 +792,9 @@ namespace parallel
     const unsigned int n_attached_deserialize_fixed,
     const unsigned int n_attached_deserialize_variable)
   {
+    // the data might still be written in the background
+    wait_for_save();
+
     // load saved data, if any was stored
     if (this->cell_attached_data.n_attached_deserialize > 0)
       {
@@ -1570,6 +1630,130 @@ namespace parallel
 
 
 
+  template <int dim, int spacedim>
+  Threads::Task<void>
+  DistributedTriangulationBase<dim, spacedim>::DataTransfer::save_in_background(
+    const unsigned int global_first_cell,
+    const unsigned int global_num_cells,
+    const std::string &filename)
+  {
+#ifdef DEAL_II_WITH_MPI
+    Assert(sizes_fixed_cumulative.size() > 0,
+           ExcMessage("No data has been packed!"));
+
+    const int myrank = Utilities::MPI::this_mpi_process(mpi_communicator);
+
+    const std::string fname_fixed    = std::string(filename) + "_fixed.data";
+    const std::string fname_variable = std::string(filename) + "_variable.data";
+
+    // The first process creates the files, or deletes their contents, and
+    // writes the header of the fixed size data. The reduction makes sure that
+    // no other process opens the files before, and lets all processes fail
+    // if the files could not be created.
+    bool files_created = true;
+    if (myrank == 0)
+      {
+        std::ofstream file_fixed(fname_fixed,
+                                 std::ios::binary | std::ios::trunc);
+        file_fixed.write(reinterpret_cast<const char *>(
+                           sizes_fixed_cumulative.data()),
+                         sizes_fixed_cumulative.size() * sizeof(unsigned int));
+        files_created = file_fixed.good();
+
+        if (variable_size_data_stored)
+          {
+            std::ofstream file_variable(fname_variable,
+                                        std::ios::binary | std::ios::trunc);
+            files_created = files_created && file_variable.good();
+          }
+      }
+    AssertThrow(Utilities::MPI::min(files_created ? 1 : 0, mpi_communicator) !=
+                  0,
+                ExcIO());
+
+    // Compute the positions to write to in 64 bit integers to be able to
+    // handle 4GB+ files, with the same layout as in save().
+    const std::uint64_t bytes_per_cell = sizes_fixed_cumulative.back();
+    const std::uint64_t position_fixed =
+      sizes_fixed_cumulative.size() * sizeof(unsigned int) +
+      static_cast<std::uint64_t>(global_first_cell) * bytes_per_cell;
+
+    const std::uint64_t position_sizes_variable =
+      static_cast<std::uint64_t>(global_first_cell) * sizeof(unsigned int);
+    std::uint64_t position_data_variable = 0;
+    if (variable_size_data_stored)
+      {
+        const std::uint64_t size_on_proc = src_data_variable.size();
+        std::uint64_t       prefix_sum   = 0;
+        const int           ierr         = MPI_Exscan(&size_on_proc,
+                                    &prefix_sum,
+                                    1,
+                                    MPI_UINT64_T,
+                                    MPI_SUM,
+                                    mpi_communicator);
+        AssertThrowMPI(ierr);
+
+        position_data_variable =
+          static_cast<std::uint64_t>(global_num_cells) * sizeof(unsigned int) +
+          prefix_sum;
+      }
+
+    // Move the buffers into shared objects, so that the task function can be
+    // copied without copying the data.
+    const auto data_fixed =
+      std::make_shared<std::vector<char>>(std::move(src_data_fixed));
+    const auto sizes_variable =
+      std::make_shared<std::vector<int>>(std::move(src_sizes_variable));
+    const auto data_variable =
+      std::make_shared<std::vector<char>>(std::move(src_data_variable));
+    src_data_fixed.clear();
+    src_sizes_variable.clear();
+    src_data_variable.clear();
+
+    const bool write_variable_size_data = variable_size_data_stored;
+
+    return Threads::new_task([=]() {
+      const auto write_at = [](const std::string & fname,
+                               const std::uint64_t position,
+                               const char *        data,
+                               const std::size_t   size) {
+        std::fstream file(fname,
+                          std::ios::binary | std::ios::in | std::ios::out);
+        AssertThrow(file.good(), ExcFileNotOpen(fname));
+        file.seekp(position);
+        file.write(data, size);
+        AssertThrow(file.good(), ExcIO());
+      };
+
+      write_at(fname_fixed,
+               position_fixed,
+               data_fixed->data(),
+               data_fixed->size());
+
+      if (write_variable_size_data)
+        {
+          write_at(fname_variable,
+                   position_sizes_variable,
+                   reinterpret_cast<const char *>(sizes_variable->data()),
+                   sizes_variable->size() * sizeof(int));
+          write_at(fname_variable,
+                   position_data_variable,
+                   data_variable->data(),
+                   data_variable->size());
+        }
+    });
+#else
+    (void)global_first_cell;
+    (void)global_num_cells;
+    (void)filename;
+
+    AssertThrow(false, ExcNeedsMPI());
+    return Threads::Task<void>();
+#endif
+  }
+
+
+
   template <int dim, int spacedim>
   void
   DistributedTriangulationBase<dim, spacedim>::DataTransfer::load(
@@ -1610,17 +1794,26 @@ namespace parallel
 
       // Read cumulative sizes from file.
       // Since all processors need the same information about the data
-      // sizes, let each of them retrieve it by reading from the same
-      // location in the file.
+      // sizes, let the first processor read it and broadcast it, rather
+      // than letting all processors access the same location in the file.
       sizes_fixed_cumulative.resize(1 + n_attached_deserialize_fixed +
                                     (variable_size_data_stored ? 1 : 0));
-      ierr = Utilities::MPI::LargeCount::File_read_at_c(
-        fh,
-        0,
-        sizes_fixed_cumulative.data(),
-        sizes_fixed_cumulative.size(),
-        MPI_UNSIGNED,
-        MPI_STATUS_IGNORE);
+      if (Utilities::MPI::this_mpi_process(mpi_communicator) == 0)
+        {
+          ierr = Utilities::MPI::LargeCount::File_read_at_c(
+            fh,
+            0,
+            sizes_fixed_cumulative.data(),
+            sizes_fixed_cumulative.size(),
+            MPI_UNSIGNED,
+            MPI_STATUS_IGNORE);
+          AssertThrowMPI(ierr);
+        }
+      ierr = MPI_Bcast(sizes_fixed_cumulative.data(),
+                       sizes_fixed_cumulative.size(),
+                       MPI_UNSIGNED,
+                       0,
+                       mpi_communicator);
       AssertThrowMPI(ierr);
 
       // Allocate sufficient memory.
@@ -1628,7 +1821,10 @@ namespace parallel
       dest_data_fixed.resize(static_cast<size_t>(local_num_cells) *
                              bytes_per_cell);
 
-      // Read packed data from file simultaneously.
+      // Read packed data from file simultaneously. Each processor only
+      // reads the range of its own cells, and the collective read lets the
+      // MPI-IO layer aggregate the requests of many processors into few
+      // large accesses to the file system.
       const MPI_Offset size_header =
         sizes_fixed_cumulative.size() * sizeof(unsigned int);
 
@@ -1638,12 +1834,13 @@ namespace parallel
         size_header +
         static_cast<MPI_Offset>(global_first_cell) * bytes_per_cell;
 
-      ierr = Utilities::MPI::LargeCount::File_read_at_c(fh,
-                                                        my_global_file_position,
-                                                        dest_data_fixed.data(),
-                                                        dest_data_fixed.size(),
-                                                        MPI_BYTE,
-                                                        MPI_STATUS_IGNORE);
+      ierr =
+        Utilities::MPI::LargeCount::File_read_at_all_c(fh,
+                                                       my_global_file_position,
+                                                       dest_data_fixed.data(),
+                                                       dest_data_fixed.size(),
+                                                       MPI_BYTE,
+                                                       MPI_STATUS_IGNORE);
       AssertThrowMPI(ierr);
 
 
@@ -1677,7 +1874,7 @@ namespace parallel
         const MPI_Offset my_global_file_position_sizes =
           static_cast<MPI_Offset>(global_first_cell) * sizeof(unsigned int);
 
-        ierr = Utilities::MPI::LargeCount::File_read_at_c(
+        ierr = Utilities::MPI::LargeCount::File_read_at_all_c(
           fh,
           my_global_file_position_sizes,
           dest_sizes_variable.data(),
@@ -1709,13 +1906,13 @@ namespace parallel
 
         dest_data_variable.resize(size_on_proc);
 
-        ierr =
-          Utilities::MPI::LargeCount::File_read_at_c(fh,
-                                                     my_global_file_position,
-                                                     dest_data_variable.data(),
-                                                     dest_data_variable.size(),
-                                                     MPI_BYTE,
-                                                     MPI_STATUS_IGNORE);
+        ierr = Utilities::MPI::LargeCount::File_read_at_all_c(
+          fh,
+          my_global_file_position,
+          dest_data_variable.data(),
+          dest_data_variable.size(),
+          MPI_BYTE,
+          MPI_STATUS_IGNORE);
         AssertThrowMPI(ierr);
 
         ierr = MPI_File_close(&fh);
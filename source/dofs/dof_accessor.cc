@@ -294,6 +294,30 @@ DoFCellAccessor<dimension_, space_dimension_, level_dof_access>::
 
 
 
+template <int dimension_, int space_dimension_, bool level_dof_access>
+inline void
+DoFCellAccessor<dimension_, space_dimension_, level_dof_access>::
+  get_dof_indices(const ArrayView<types::global_dof_index> &dof_indices) const
+{
+  Assert(this->is_active(),
+         ExcMessage("get_dof_indices() only works on active cells."));
+  Assert(this->is_artificial() == false,
+         ExcMessage("Can't ask for DoF indices on artificial cells."));
+  AssertDimension(dof_indices.size(), this->get_fe().n_dofs_per_cell());
+
+  dealii::internal::DoFAccessorImplementation::Implementation::
+    process_dof_indices(
+      *this,
+      dof_indices,
+      this->active_fe_index(),
+      dealii::internal::DoFAccessorImplementation::Implementation::
+        DoFIndexProcessor<dimension_, space_dimension_>(),
+      [](auto stored_index, auto dof_ptr) { *dof_ptr = stored_index; },
+      false);
+}
+
+
+
 template <int dimension_, int space_dimension_, bool level_dof_access>
 inline void
 DoFCellAccessor<dimension_, space_dimension_, level_dof_access>::
@@ -16,6 +16,7 @@
 
 #include <deal.II/base/geometry_info.h>
 #include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/partitioner.h>
 #include <deal.II/base/thread_management.h>
 #include <deal.II/base/types.h>
@@ -1802,6 +1803,52 @@ namespace internal
         /* --------------------- renumber_dofs functionality ---------------- */
 
 
+        /**
+         * Replace all valid entries of the given array of DoF indices by
+         * their new numbers. This is the common part of the renumbering of
+         * the DoF indices stored on vertices, lines, quads, and cells when
+         * no hp-capabilities are enabled, where the indices are stored in
+         * one contiguous array per kind of object. Each entry is processed
+         * independently of all others, so the work is split over all
+         * available threads and the result does not depend on their number.
+         *
+         * See renumber_dofs() for the meaning of the arguments.
+         */
+        static void
+        renumber_dof_index_array(
+          std::vector<types::global_dof_index> &      dof_indices,
+          const std::vector<types::global_dof_index> &new_numbers,
+          const IndexSet &                            indices_we_care_about)
+        {
+          // make sure the index set does not need to be compressed by
+          // several threads at the same time
+          indices_we_care_about.compress();
+
+          dealii::parallel::apply_to_subranges(
+            std::size_t(0),
+            dof_indices.size(),
+            [&](const std::size_t begin, const std::size_t end) {
+              for (std::size_t k = begin; k < end; ++k)
+                {
+                  types::global_dof_index &i = dof_indices[k];
+                  if (i != numbers::invalid_dof_index)
+                    {
+                      Assert((indices_we_care_about.size() > 0 ?
+                                indices_we_care_about.is_element(i) :
+                                (i < new_numbers.size())),
+                             ExcInternalError());
+                      i = (indices_we_care_about.size() == 0) ?
+                            new_numbers[i] :
+                            new_numbers[indices_we_care_about.index_within_set(
+                              i)];
+                    }
+                }
+            },
+            4096);
+        }
+
+
+
         /**
          * The part of the renumber_dofs() functionality that operates on faces.
          * This part is dimension dependent and so needs to be implemented in
@@ -1817,11 +1864,9 @@ namespace internal
           DoFHandler<dim, spacedim> &                 dof_handler)
         {
           for (unsigned int d = 1; d < dim; ++d)
-            for (auto &i : dof_handler.object_dof_indices[0][d])
-              if (i != numbers::invalid_dof_index)
-                i = ((indices_we_care_about.size() == 0) ?
-                       new_numbers[i] :
-                       new_numbers[indices_we_care_about.index_within_set(i)]);
+            renumber_dof_index_array(dof_handler.object_dof_indices[0][d],
+                                     new_numbers,
+                                     indices_we_care_about);
         }
 
 
@@ -1842,22 +1887,26 @@ namespace internal
               // correct but also faster; note, however, that dof numbers
               // may be invalid_dof_index, namely when the appropriate
               // vertex/line/etc is unused
-              for (std::vector<types::global_dof_index>::iterator i =
-                     dof_handler.object_dof_indices[0][0].begin();
-                   i != dof_handler.object_dof_indices[0][0].end();
-                   ++i)
-                if (*i != numbers::invalid_dof_index)
-                  *i =
-                    (indices_we_care_about.size() == 0) ?
-                      (new_numbers[*i]) :
-                      (new_numbers[indices_we_care_about.index_within_set(*i)]);
-                else if (check_validity)
-                  // if index is invalid_dof_index: check if this one
-                  // really is unused
-                  Assert(dof_handler.get_triangulation().vertex_used(
-                           (i - dof_handler.object_dof_indices[0][0].begin()) /
-                           dof_handler.get_fe().n_dofs_per_vertex()) == false,
-                         ExcInternalError());
+#ifdef DEBUG
+              if (check_validity)
+                for (std::vector<types::global_dof_index>::iterator i =
+                       dof_handler.object_dof_indices[0][0].begin();
+                     i != dof_handler.object_dof_indices[0][0].end();
+                     ++i)
+                  if (*i == numbers::invalid_dof_index)
+                    // if index is invalid_dof_index: check if this one
+                    // really is unused
+                    Assert(dof_handler.get_triangulation().vertex_used(
+                             (i -
+                              dof_handler.object_dof_indices[0][0].begin()) /
+                             dof_handler.get_fe().n_dofs_per_vertex()) ==
+                             false,
+                           ExcInternalError());
+#endif
+
+              renumber_dof_index_array(dof_handler.object_dof_indices[0][0],
+                                       new_numbers,
+                                       indices_we_care_about);
               return;
             }
 
@@ -1995,12 +2044,10 @@ namespace internal
               for (unsigned int level = 0;
                    level < dof_handler.object_dof_indices.size();
                    ++level)
-                for (auto &i : dof_handler.object_dof_indices[level][dim])
-                  if (i != numbers::invalid_dof_index)
-                    i = ((indices_we_care_about.size() == 0) ?
-                           new_numbers[i] :
-                           new_numbers[indices_we_care_about.index_within_set(
-                             i)]);
+                renumber_dof_index_array(
+                  dof_handler.object_dof_indices[level][dim],
+                  new_numbers,
+                  indices_we_care_about);
               return;
             }
 
@@ -2081,12 +2128,9 @@ namespace internal
           if (dof_handler.hp_capability_enabled == false)
             {
               for (unsigned int d = 1; d < dim; ++d)
-                for (auto &i : dof_handler.object_dof_indices[0][d])
-                  if (i != numbers::invalid_dof_index)
-                    i = ((indices_we_care_about.size() == 0) ?
-                           new_numbers[i] :
-                           new_numbers[indices_we_care_about.index_within_set(
-                             i)]);
+                renumber_dof_index_array(dof_handler.object_dof_indices[0][d],
+                                         new_numbers,
+                                         indices_we_care_about);
               return;
             }
 
@@ -2176,12 +2220,9 @@ namespace internal
           if (dof_handler.hp_capability_enabled == false)
             {
               for (unsigned int d = 1; d < dim; ++d)
-                for (auto &i : dof_handler.object_dof_indices[0][d])
-                  if (i != numbers::invalid_dof_index)
-                    i = ((indices_we_care_about.size() == 0) ?
-                           new_numbers[i] :
-                           new_numbers[indices_we_care_about.index_within_set(
-                             i)]);
+                renumber_dof_index_array(dof_handler.object_dof_indices[0][d],
+                                         new_numbers,
+                                         indices_we_care_about);
               return;
             }
 
@@ -2443,23 +2484,10 @@ namespace internal
           DoFHandler<dim, spacedim> &dof_handler,
           const unsigned int         level)
         {
-          for (std::vector<types::global_dof_index>::iterator i =
-                 dof_handler.mg_levels[level]->dof_object.dofs.begin();
-               i != dof_handler.mg_levels[level]->dof_object.dofs.end();
-               ++i)
-            {
-              if (*i != numbers::invalid_dof_index)
-                {
-                  Assert((indices_we_care_about.size() > 0 ?
-                            indices_we_care_about.is_element(*i) :
-                            (*i < new_numbers.size())),
-                         ExcInternalError());
-                  *i =
-                    (indices_we_care_about.size() == 0) ?
-                      (new_numbers[*i]) :
-                      (new_numbers[indices_we_care_about.index_within_set(*i)]);
-                }
-            }
+          renumber_dof_index_array(
+            dof_handler.mg_levels[level]->dof_object.dofs,
+            new_numbers,
+            indices_we_care_about);
         }
 
 
@@ -64,6 +64,7 @@ DEAL_II_ENABLE_EXTRA_DIAGNOSTICS
 #include <cmath>
 #include <functional>
 #include <map>
+#include <numeric>
 #include <vector>
 
 
@@ -650,6 +651,150 @@ namespace DoFRenumbering
 
 
 
+  template <int dim, int spacedim>
+  void
+  Cuthill_McKee_on_cells(DoFHandler<dim, spacedim> &dof_handler,
+                         const bool                 reversed_numbering)
+  {
+    std::vector<types::global_dof_index> renumbering(
+      dof_handler.n_locally_owned_dofs());
+    compute_Cuthill_McKee_on_cells(renumbering,
+                                   dof_handler,
+                                   reversed_numbering);
+
+    dof_handler.renumber_dofs(renumbering);
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  compute_Cuthill_McKee_on_cells(
+    std::vector<types::global_dof_index> &new_indices,
+    const DoFHandler<dim, spacedim> &     dof_handler,
+    const bool                            reversed_numbering)
+  {
+    using active_cell_iterator =
+      typename DoFHandler<dim, spacedim>::active_cell_iterator;
+
+    // collect the locally owned cells and give them a local number
+    std::vector<active_cell_iterator> cells;
+    std::vector<unsigned int>         local_index(
+      dof_handler.get_triangulation().n_active_cells(),
+      numbers::invalid_unsigned_int);
+    for (const auto &cell : dof_handler.active_cell_iterators())
+      if (cell->is_locally_owned())
+        {
+          local_index[cell->active_cell_index()] = cells.size();
+          cells.push_back(cell);
+        }
+
+    const unsigned int n_cells = cells.size();
+
+    // build the face-neighbor graph of the locally owned cells in compressed
+    // row storage. where a neighbor is refined, connect to the children of
+    // the neighbor adjacent to the face
+    std::vector<unsigned int> row_starts(n_cells + 1, 0);
+    std::vector<unsigned int> column_indices;
+    column_indices.reserve(n_cells * GeometryInfo<dim>::faces_per_cell);
+
+    const auto add_neighbor = [&](const active_cell_iterator &neighbor) {
+      const unsigned int index = local_index[neighbor->active_cell_index()];
+      if (index != numbers::invalid_unsigned_int)
+        column_indices.push_back(index);
+    };
+
+    for (unsigned int c = 0; c < n_cells; ++c)
+      {
+        const active_cell_iterator &cell = cells[c];
+        for (const unsigned int f : cell->face_indices())
+          if (!cell->at_boundary(f))
+            {
+              const auto neighbor = cell->neighbor(f);
+              if (neighbor->is_active())
+                add_neighbor(neighbor);
+              else if (dim == 1)
+                {
+                  auto child = neighbor;
+                  while (child->has_children())
+                    child = child->child(1 - f);
+                  add_neighbor(child);
+                }
+              else
+                for (unsigned int sf = 0; sf < cell->face(f)->n_children();
+                     ++sf)
+                  {
+                    const auto child = cell->neighbor_child_on_subface(f, sf);
+                    if (child->is_active())
+                      add_neighbor(child);
+                  }
+            }
+        row_starts[c + 1] = column_indices.size();
+      }
+
+    const auto degree = [&](const unsigned int c) {
+      return row_starts[c + 1] - row_starts[c];
+    };
+
+    // breadth-first traversal, visiting the neighbors of each cell in order
+    // of increasing degree. every connected component is started from an
+    // unvisited cell of minimal degree
+    std::vector<unsigned int> cells_by_degree(n_cells);
+    std::iota(cells_by_degree.begin(), cells_by_degree.end(), 0U);
+    std::stable_sort(cells_by_degree.begin(),
+                     cells_by_degree.end(),
+                     [&](const unsigned int a, const unsigned int b) {
+                       return degree(a) < degree(b);
+                     });
+
+    std::vector<bool>         visited(n_cells, false);
+    std::vector<unsigned int> order;
+    order.reserve(n_cells);
+    std::vector<unsigned int> next_neighbors;
+
+    for (const unsigned int start : cells_by_degree)
+      {
+        if (visited[start])
+          continue;
+
+        visited[start] = true;
+        order.push_back(start);
+        for (std::size_t i = order.size() - 1; i < order.size(); ++i)
+          {
+            const unsigned int c = order[i];
+            next_neighbors.clear();
+            for (unsigned int j = row_starts[c]; j < row_starts[c + 1]; ++j)
+              if (!visited[column_indices[j]])
+                {
+                  visited[column_indices[j]] = true;
+                  next_neighbors.push_back(column_indices[j]);
+                }
+            std::stable_sort(next_neighbors.begin(),
+                             next_neighbors.end(),
+                             [&](const unsigned int a, const unsigned int b) {
+                               return degree(a) < degree(b);
+                             });
+            order.insert(order.end(),
+                         next_neighbors.begin(),
+                         next_neighbors.end());
+          }
+      }
+    AssertDimension(order.size(), n_cells);
+
+    if (reversed_numbering)
+      std::reverse(order.begin(), order.end());
+
+    std::vector<active_cell_iterator> ordered_cells;
+    ordered_cells.reserve(n_cells);
+    for (const unsigned int c : order)
+      ordered_cells.push_back(cells[c]);
+
+    std::vector<types::global_dof_index> reverse(new_indices.size());
+    compute_cell_wise(new_indices, reverse, dof_handler, ordered_cells);
+  }
+
+
+
   template <int dim, int spacedim>
   void
   Cuthill_McKee(DoFHandler<dim, spacedim> &                 dof_handler,
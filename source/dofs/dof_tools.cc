@@ -1051,10 +1051,11 @@ namespace DoFTools
     IndexSet dof_set = dof_handler.locally_owned_dofs();
 
     // add the DoF on the adjacent ghost cells to the IndexSet, cache them
-    // in a set. need to check each dof manually because we can't be sure
-    // that the dof range of locally_owned_dofs is really contiguous.
+    // in a vector that is sorted and made unique only once at the end. need
+    // to check each dof manually because we can't be sure that the dof range
+    // of locally_owned_dofs is really contiguous.
     std::vector<types::global_dof_index> dof_indices;
-    std::set<types::global_dof_index>    global_dof_indices;
+    std::vector<types::global_dof_index> global_dof_indices;
 
     for (const auto &cell : dof_handler.active_cell_iterators() |
                               IteratorFilters::LocallyOwnedCell())
@@ -1064,10 +1065,10 @@ namespace DoFTools
 
         for (const types::global_dof_index dof_index : dof_indices)
           if (!dof_set.is_element(dof_index))
-            global_dof_indices.insert(dof_index);
+            global_dof_indices.push_back(dof_index);
       }
 
-    dof_set.add_indices(global_dof_indices.begin(), global_dof_indices.end());
+    dof_set.add_unsorted_indices(global_dof_indices);
 
     dof_set.compress();
 
@@ -1096,10 +1097,11 @@ namespace DoFTools
     IndexSet dof_set = dof_handler.locally_owned_mg_dofs(level);
 
     // add the DoF on the adjacent ghost cells to the IndexSet, cache them
-    // in a set. need to check each dof manually because we can't be sure
-    // that the dof range of locally_owned_dofs is really contiguous.
+    // in a vector that is sorted and made unique only once at the end. need
+    // to check each dof manually because we can't be sure that the dof range
+    // of locally_owned_dofs is really contiguous.
     std::vector<types::global_dof_index> dof_indices;
-    std::set<types::global_dof_index>    global_dof_indices;
+    std::vector<types::global_dof_index> global_dof_indices;
 
     const auto filtered_iterators_range =
       filter_iterators(dof_handler.cell_iterators_on_level(level),
@@ -1111,10 +1113,10 @@ namespace DoFTools
 
         for (const types::global_dof_index dof_index : dof_indices)
           if (!dof_set.is_element(dof_index))
-            global_dof_indices.insert(dof_index);
+            global_dof_indices.push_back(dof_index);
       }
 
-    dof_set.add_indices(global_dof_indices.begin(), global_dof_indices.end());
+    dof_set.add_unsorted_indices(global_dof_indices);
 
     dof_set.compress();
 
@@ -1164,10 +1166,7 @@ namespace DoFTools
         }
 
     // sort, compress out duplicates, fill into index set
-    std::sort(dofs_on_ghosts.begin(), dofs_on_ghosts.end());
-    dof_set.add_indices(dofs_on_ghosts.begin(),
-                        std::unique(dofs_on_ghosts.begin(),
-                                    dofs_on_ghosts.end()));
+    dof_set.add_unsorted_indices(dofs_on_ghosts);
     dof_set.compress();
 
     return dof_set;
@@ -1222,10 +1221,7 @@ namespace DoFTools
       }
 
     // sort, compress out duplicates, fill into index set
-    std::sort(dofs_on_ghosts.begin(), dofs_on_ghosts.end());
-    dof_set.add_indices(dofs_on_ghosts.begin(),
-                        std::unique(dofs_on_ghosts.begin(),
-                                    dofs_on_ghosts.end()));
+    dof_set.add_unsorted_indices(dofs_on_ghosts);
 
     dof_set.compress();
 
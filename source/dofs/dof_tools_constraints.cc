@@ -337,28 +337,29 @@ namespace DoFTools
 
       /**
        * Make sure that the given @p face_interpolation_matrix pointer points
-       * to a valid matrix. If the pointer is zero beforehand, create an entry
-       * with the correct data. If it is nonzero, don't touch it.
+       * to a valid matrix. If the pointer is zero beforehand, let it point to
+       * the matrix stored in the FECollection, which computes it the first
+       * time it is requested and then keeps it around for later calls. If it
+       * is nonzero, don't touch it.
        */
       template <int dim, int spacedim>
       void
       ensure_existence_of_face_matrix(
-        const FiniteElement<dim, spacedim> & fe1,
-        const FiniteElement<dim, spacedim> & fe2,
-        std::unique_ptr<FullMatrix<double>> &matrix)
+        const hp::FECollection<dim, spacedim> &fe_collection,
+        const unsigned int                     fe_index_1,
+        const unsigned int                     fe_index_2,
+        const FullMatrix<double> *&            matrix)
       {
         // TODO: the implementation makes the assumption that all faces have the
         // same number of dofs
-        AssertDimension(fe1.n_unique_faces(), 1);
-        AssertDimension(fe2.n_unique_faces(), 1);
+        AssertDimension(fe_collection[fe_index_1].n_unique_faces(), 1);
+        AssertDimension(fe_collection[fe_index_2].n_unique_faces(), 1);
         const unsigned int face_no = 0;
 
         if (matrix == nullptr)
-          {
-            matrix = std::make_unique<FullMatrix<double>>(
-              fe2.n_dofs_per_face(face_no), fe1.n_dofs_per_face(face_no));
-            fe1.get_face_interpolation_matrix(fe2, *matrix, face_no);
-          }
+          matrix = &fe_collection.get_face_interpolation_matrix(fe_index_1,
+                                                                fe_index_2,
+                                                                face_no);
       }
 
 
@@ -369,26 +370,23 @@ namespace DoFTools
       template <int dim, int spacedim>
       void
       ensure_existence_of_subface_matrix(
-        const FiniteElement<dim, spacedim> & fe1,
-        const FiniteElement<dim, spacedim> & fe2,
-        const unsigned int                   subface,
-        std::unique_ptr<FullMatrix<double>> &matrix)
+        const hp::FECollection<dim, spacedim> &fe_collection,
+        const unsigned int                     fe_index_1,
+        const unsigned int                     fe_index_2,
+        const unsigned int                     subface,
+        const FullMatrix<double> *&            matrix)
       {
         // TODO: the implementation makes the assumption that all faces have the
         // same number of dofs
-        AssertDimension(fe1.n_unique_faces(), 1);
-        AssertDimension(fe2.n_unique_faces(), 1);
+        AssertDimension(fe_collection[fe_index_1].n_unique_faces(), 1);
+        AssertDimension(fe_collection[fe_index_2].n_unique_faces(), 1);
         const unsigned int face_no = 0;
 
         if (matrix == nullptr)
-          {
-            matrix = std::make_unique<FullMatrix<double>>(
-              fe2.n_dofs_per_face(face_no), fe1.n_dofs_per_face(face_no));
-            fe1.get_subface_interpolation_matrix(fe2,
-                                                 subface,
-                                                 *matrix,
-                                                 face_no);
-          }
+          matrix = &fe_collection.get_subface_interpolation_matrix(fe_index_1,
+                                                                   fe_index_2,
+                                                                   subface,
+                                                                   face_no);
       }
 
 
@@ -509,6 +507,8 @@ namespace DoFTools
           Assert(primary_dofs[col] != numbers::invalid_dof_index,
                  ExcInternalError());
 
+        std::vector<std::pair<types::global_dof_index, number2>> entries;
+        entries.reserve(n_primary_dofs);
 
         for (unsigned int row = 0; row != n_dependent_dofs; ++row)
           if (constraints.is_constrained(dependent_dofs[row]) == false)
@@ -561,13 +561,19 @@ namespace DoFTools
               // those constraints in here will only lead to problems
               // because it makes sparsity patterns fuller than necessary
               // without producing any significant effect
-              constraints.add_line(dependent_dofs[row]);
+              //
+              // collect the entries first and then hand them to the
+              // AffineConstraints object all at once, rather than looking up
+              // the constraint line anew for every single entry
+              entries.clear();
               for (unsigned int i = 0; i < n_primary_dofs; ++i)
                 if ((face_constraints(row, i) != 0) &&
                     (std::fabs(face_constraints(row, i)) >= 1e-14 * abs_sum))
-                  constraints.add_entry(dependent_dofs[row],
-                                        primary_dofs[i],
-                                        face_constraints(row, i));
+                  entries.emplace_back(primary_dofs[i],
+                                       face_constraints(row, i));
+
+              constraints.add_line(dependent_dofs[row]);
+              constraints.add_entries(dependent_dofs[row], entries);
               constraints.set_inhomogeneity(dependent_dofs[row], 0.);
             }
       }
@@ -1051,16 +1057,21 @@ namespace DoFTools
       std::vector<types::global_dof_index> dependent_dofs;
       std::vector<types::global_dof_index> scratch_dofs;
 
-      // caches for the face and subface interpolation matrices between
-      // different (or the same) finite elements. we compute them only once,
-      // namely the first time they are needed, and then just reuse them
-      Table<2, std::unique_ptr<FullMatrix<double>>> face_interpolation_matrices(
+      const dealii::hp::FECollection<dim, spacedim> &fe_collection =
+        dof_handler.get_fe_collection();
+
+      // pointers to the face and subface interpolation matrices between
+      // different (or the same) finite elements. the matrices themselves are
+      // cached in the FECollection, so they are computed only once, namely the
+      // first time they are needed, and are then reused also in later calls
+      // to this function with the same DoFHandler. the pointers are held here
+      // to avoid looking them up in that cache for every face
+      Table<2, const FullMatrix<double> *> face_interpolation_matrices(
         n_finite_elements(dof_handler), n_finite_elements(dof_handler));
-      Table<3, std::unique_ptr<FullMatrix<double>>>
-        subface_interpolation_matrices(
-          n_finite_elements(dof_handler),
-          n_finite_elements(dof_handler),
-          GeometryInfo<dim>::max_children_per_face);
+      Table<3, const FullMatrix<double> *> subface_interpolation_matrices(
+        n_finite_elements(dof_handler),
+        n_finite_elements(dof_handler),
+        GeometryInfo<dim>::max_children_per_face);
 
       // similarly have a cache for the matrices that are split into their
       // primary and dependent parts, and for which the primary part is
@@ -1251,8 +1262,9 @@ namespace DoFTools
                             // result of projection verifies the approximation
                             // properties of a finite element onto that mesh
                             ensure_existence_of_subface_matrix(
-                              cell->get_fe(),
-                              subface->get_fe(subface_fe_index),
+                              fe_collection,
+                              cell->active_fe_index(),
+                              subface_fe_index,
                               c,
                               subface_interpolation_matrices
                                 [cell->active_fe_index()][subface_fe_index][c]);
@@ -1283,8 +1295,6 @@ namespace DoFTools
                         Assert(dof_handler.has_hp_capabilities() == true,
                                ExcInternalError());
 
-                        const dealii::hp::FECollection<dim, spacedim>
-                          &fe_collection = dof_handler.get_fe_collection();
                         // we first have to find the finite element that is able
                         // to generate a space that all the other ones can be
                         // constrained to. At this point we potentially have
@@ -1332,8 +1342,9 @@ namespace DoFTools
                                ExcInternalError());
 
                         ensure_existence_of_face_matrix(
-                          dominating_fe,
-                          cell->get_fe(),
+                          fe_collection,
+                          dominating_fe_index,
+                          cell->active_fe_index(),
                           face_interpolation_matrices[dominating_fe_index]
                                                      [cell->active_fe_index()]);
 
@@ -1443,8 +1454,9 @@ namespace DoFTools
                                      subface_fe.n_dofs_per_face(face),
                                    ExcInternalError());
                             ensure_existence_of_subface_matrix(
-                              dominating_fe,
-                              subface_fe,
+                              fe_collection,
+                              dominating_fe_index,
+                              subface_fe_index,
                               sf,
                               subface_interpolation_matrices
                                 [dominating_fe_index][subface_fe_index][sf]);
@@ -1543,8 +1555,9 @@ namespace DoFTools
                             // make sure the element constraints for this face
                             // are available
                             ensure_existence_of_face_matrix(
-                              cell->get_fe(),
-                              neighbor->get_fe(),
+                              fe_collection,
+                              cell->active_fe_index(),
+                              neighbor->active_fe_index(),
                               face_interpolation_matrices
                                 [cell->active_fe_index()]
                                 [neighbor->active_fe_index()]);
@@ -1619,8 +1632,6 @@ namespace DoFTools
                             std::set<types::fe_index> fes;
                             fes.insert(this_fe_index);
                             fes.insert(neighbor_fe_index);
-                            const dealii::hp::FECollection<dim, spacedim>
-                              &fe_collection = dof_handler.get_fe_collection();
 
                             // TODO: Change set to types::fe_index
                             const types::fe_index dominating_fe_index =
@@ -1648,8 +1659,9 @@ namespace DoFTools
                                    ExcInternalError());
 
                             ensure_existence_of_face_matrix(
-                              dominating_fe,
-                              cell->get_fe(),
+                              fe_collection,
+                              dominating_fe_index,
+                              cell->active_fe_index(),
                               face_interpolation_matrices
                                 [dominating_fe_index][cell->active_fe_index()]);
 
@@ -1735,8 +1747,9 @@ namespace DoFTools
                                    ExcInternalError());
 
                             ensure_existence_of_face_matrix(
-                              dominating_fe,
-                              neighbor->get_fe(),
+                              fe_collection,
+                              dominating_fe_index,
+                              neighbor->active_fe_index(),
                               face_interpolation_matrices
                                 [dominating_fe_index]
                                 [neighbor->active_fe_index()]);
@@ -13,10 +13,12 @@
 //
 // ---------------------------------------------------------------------
 
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/quadrature_lib.h>
 #include <deal.II/base/table.h>
 #include <deal.II/base/template_constraints.h>
 #include <deal.II/base/utilities.h>
+#include <deal.II/base/work_stream.h>
 
 #include <deal.II/distributed/shared_tria.h>
 #include <deal.II/distributed/tria_base.h>
@@ -39,10 +41,12 @@
 #include <deal.II/hp/q_collection.h>
 
 #include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/sparsity_pattern.h>
 #include <deal.II/lac/sparsity_pattern_base.h>
 #include <deal.II/lac/vector.h>
 
 #include <algorithm>
+#include <mutex>
 #include <numeric>
 
 DEAL_II_NAMESPACE_OPEN
@@ -108,6 +112,100 @@ namespace DoFTools
 
 
 
+  template <int dim, int spacedim, typename number>
+  void
+  make_sparsity_pattern(const DoFHandler<dim, spacedim> &dof,
+                        const unsigned int               block_size,
+                        SparsityPatternBase &            sparsity,
+                        const AffineConstraints<number> &constraints,
+                        const bool                       keep_constrained_dofs,
+                        const types::subdomain_id        subdomain_id)
+  {
+    const types::global_dof_index n_dofs = dof.n_dofs();
+    (void)n_dofs;
+
+    Assert(block_size > 0, ExcMessage("The block size must be positive."));
+    Assert(n_dofs % block_size == 0,
+           ExcMessage("The number of degrees of freedom must be divisible "
+                      "by the block size."));
+    Assert(sparsity.n_rows() == n_dofs / block_size,
+           ExcDimensionMismatch(sparsity.n_rows(), n_dofs / block_size));
+    Assert(sparsity.n_cols() == n_dofs / block_size,
+           ExcDimensionMismatch(sparsity.n_cols(), n_dofs / block_size));
+
+    // If we have a distributed Triangulation only allow locally_owned
+    // subdomain. Not setting a subdomain is also okay, because we skip
+    // ghost cells in the loop below.
+    if (const auto *triangulation = dynamic_cast<
+          const parallel::DistributedTriangulationBase<dim, spacedim> *>(
+          &dof.get_triangulation()))
+      {
+        Assert((subdomain_id == numbers::invalid_subdomain_id) ||
+                 (subdomain_id == triangulation->locally_owned_subdomain()),
+               ExcMessage(
+                 "For distributed Triangulation objects and associated "
+                 "DoFHandler objects, asking for any subdomain other than the "
+                 "locally owned one does not make sense."));
+      }
+
+    std::vector<types::global_dof_index> dofs_on_this_cell;
+    dofs_on_this_cell.reserve(dof.get_fe_collection().max_dofs_per_cell());
+    std::vector<types::global_dof_index> blocks_on_this_cell;
+
+    for (const auto &cell : dof.active_cell_iterators())
+      if (((subdomain_id == numbers::invalid_subdomain_id) ||
+           (subdomain_id == cell->subdomain_id())) &&
+          cell->is_locally_owned())
+        {
+          const unsigned int dofs_per_cell = cell->get_fe().n_dofs_per_cell();
+          dofs_on_this_cell.resize(dofs_per_cell);
+          cell->get_dof_indices(dofs_on_this_cell);
+
+          // The scalar pattern of AffineConstraints::add_entries_local_to_
+          // global() couples all rows with all columns that the degrees of
+          // freedom on the cell get resolved to, i.e., the degree of freedom
+          // itself (unless it is constrained and not kept) and the entries of
+          // its constraint. Since all of these couple with each other, the
+          // pattern on blocks is the dense coupling between the blocks of
+          // all resolved degrees of freedom.
+          blocks_on_this_cell.clear();
+          for (const types::global_dof_index i : dofs_on_this_cell)
+            {
+              const auto *entries = constraints.get_constraint_entries(i);
+              if (entries == nullptr || keep_constrained_dofs ||
+                  !constraints.is_constrained(i))
+                blocks_on_this_cell.push_back(i / block_size);
+              if (entries != nullptr)
+                for (const auto &entry : *entries)
+                  blocks_on_this_cell.push_back(entry.first / block_size);
+            }
+          std::sort(blocks_on_this_cell.begin(), blocks_on_this_cell.end());
+          blocks_on_this_cell.erase(std::unique(blocks_on_this_cell.begin(),
+                                                blocks_on_this_cell.end()),
+                                    blocks_on_this_cell.end());
+
+          for (const types::global_dof_index block_row : blocks_on_this_cell)
+            sparsity.add_row_entries(block_row,
+                                     make_array_view(blocks_on_this_cell),
+                                     true);
+
+          // constrained degrees of freedom that are not kept still get a
+          // diagonal entry, like in the scalar case
+          if (!keep_constrained_dofs)
+            for (const types::global_dof_index i : dofs_on_this_cell)
+              if (constraints.is_constrained(i))
+                {
+                  const types::global_dof_index block = i / block_size;
+                  sparsity.add_row_entries(
+                    block,
+                    ArrayView<const types::global_dof_index>(&block, 1),
+                    true);
+                }
+        }
+  }
+
+
+
   template <int dim, int spacedim, typename number>
   void
   make_sparsity_pattern(const DoFHandler<dim, spacedim> &dof,
@@ -198,6 +296,132 @@ namespace DoFTools
 
 
 
+  namespace
+  {
+    /**
+     * A sparsity pattern that does not store any entries, but only counts
+     * how many entries are added to each row. Since entries that are added
+     * several times are also counted several times, the counts are upper
+     * bounds for the lengths of the rows.
+     */
+    class RowLengthCounter : public SparsityPatternBase
+    {
+    public:
+      RowLengthCounter(const size_type m, const size_type n)
+        : SparsityPatternBase(m, n)
+        , row_lengths(m, 0)
+      {}
+
+      virtual void
+      add_row_entries(const size_type &                 row,
+                      const ArrayView<const size_type> &columns,
+                      const bool) override
+      {
+        AssertIndexRange(row, n_rows());
+        row_lengths[row] = static_cast<unsigned int>(
+          std::min<std::size_t>(row_lengths[row] + columns.size(), n_cols()));
+      }
+
+      std::vector<unsigned int> row_lengths;
+    };
+
+
+
+    /**
+     * Run the two passes of make_static_sparsity_pattern(): The function
+     * @p add_entries is first called with an object that counts the entries
+     * of each row, and then with @p sparsity_pattern reinitialized to these
+     * row lengths.
+     */
+    template <typename Function>
+    void
+    make_static_sparsity_pattern_in_two_passes(
+      const types::global_dof_index n_dofs,
+      SparsityPattern &             sparsity_pattern,
+      const Function &              add_entries)
+    {
+      {
+        RowLengthCounter row_length_counter(n_dofs, n_dofs);
+        add_entries(row_length_counter);
+        sparsity_pattern.reinit(n_dofs,
+                                n_dofs,
+                                row_length_counter.row_lengths);
+      }
+
+      add_entries(sparsity_pattern);
+      sparsity_pattern.compress();
+    }
+  } // namespace
+
+
+
+  template <int dim, int spacedim, typename number>
+  void
+  make_static_sparsity_pattern(const DoFHandler<dim, spacedim> &dof,
+                               SparsityPattern &                sparsity,
+                               const AffineConstraints<number> &constraints,
+                               const bool                keep_constrained_dofs,
+                               const types::subdomain_id subdomain_id)
+  {
+    make_static_sparsity_pattern_in_two_passes(
+      dof.n_dofs(), sparsity, [&](SparsityPatternBase &pattern) {
+        make_sparsity_pattern(
+          dof, pattern, constraints, keep_constrained_dofs, subdomain_id);
+      });
+  }
+
+
+
+  template <int dim, int spacedim, typename number>
+  void
+  make_static_sparsity_pattern(
+    const DoFHandler<dim, spacedim> &dof,
+    const std::vector<std::vector<
+      typename DoFHandler<dim, spacedim>::active_cell_iterator>>
+      &                              colored_cells,
+    SparsityPattern &                sparsity,
+    const AffineConstraints<number> &constraints,
+    const bool                       keep_constrained_dofs)
+  {
+    using CellIterator =
+      typename std::vector<typename DoFHandler<dim, spacedim>::
+                             active_cell_iterator>::const_iterator;
+
+    const unsigned int max_dofs_per_cell =
+      dof.get_fe_collection().max_dofs_per_cell();
+
+    make_static_sparsity_pattern_in_two_passes(
+      dof.n_dofs(), sparsity, [&](SparsityPatternBase &pattern) {
+        // the cells of one color write to disjoint rows of the pattern, and
+        // AffineConstraints::add_entries_local_to_global() uses a
+        // thread-local scratch array, so the cells of one color can be
+        // worked on concurrently
+        for (const auto &color : colored_cells)
+          parallel::apply_to_subranges(
+            color.begin(),
+            color.end(),
+            [&](const CellIterator &begin, const CellIterator &end) {
+              std::vector<types::global_dof_index> dofs_on_this_cell;
+              dofs_on_this_cell.reserve(max_dofs_per_cell);
+              for (CellIterator cell = begin; cell != end; ++cell)
+                if ((*cell)->is_locally_owned())
+                  {
+                    Assert(&(*cell)->get_dof_handler() == &dof,
+                           ExcMessage("The colored cells must be cells of "
+                                      "the given DoFHandler object."));
+                    dofs_on_this_cell.resize(
+                      (*cell)->get_fe().n_dofs_per_cell());
+                    (*cell)->get_dof_indices(dofs_on_this_cell);
+                    constraints.add_entries_local_to_global(
+                      dofs_on_this_cell, pattern, keep_constrained_dofs);
+                  }
+            },
+            32);
+      });
+  }
+
+
+
   template <int dim, int spacedim>
   void
   make_sparsity_pattern(const DoFHandler<dim, spacedim> &dof_row,
@@ -779,11 +1003,6 @@ namespace DoFTools
           {
             const FiniteElement<dim, spacedim> &fe = dof.get_fe();
 
-            std::vector<types::global_dof_index> dofs_on_this_cell(
-              fe.n_dofs_per_cell());
-            std::vector<types::global_dof_index> dofs_on_other_cell(
-              fe.n_dofs_per_cell());
-
             const Table<2, Coupling>
               int_dof_mask =
                 dof_couplings_from_component_couplings(fe, int_mask),
@@ -806,312 +1025,274 @@ namespace DoFTools
                 if (int_dof_mask(i, j) != none)
                   bool_int_dof_mask(i, j) = true;
 
-            for (const auto &cell : dof.active_cell_iterators())
-              if (((subdomain_id == numbers::invalid_subdomain_id) ||
-                   (subdomain_id == cell->subdomain_id())) &&
-                  cell->is_locally_owned())
-                {
-                  cell->get_dof_indices(dofs_on_this_cell);
-                  // make sparsity pattern for this cell
-                  constraints.add_entries_local_to_global(dofs_on_this_cell,
-                                                          sparsity,
-                                                          keep_constrained_dofs,
-                                                          bool_int_dof_mask);
-                  // Loop over all interior neighbors
-                  for (const unsigned int face_n : cell->face_indices())
+            // For every combination of a face of the current cell and the
+            // face of the neighbor through which that face is seen, build
+            // the list of pairs (i,j) of local DoF indices that couple over
+            // the face, together with a bit mask that states in which of the
+            // four blocks (this-other, other-this, this-this, other-other)
+            // they couple. This evaluates flux_dof_mask and support_on_face
+            // only once per combination rather than once per face, and
+            // prunes all pairs that do not couple at all. Boundary faces use
+            // the neighbor face number faces_per_cell and only couple in the
+            // this-this block. The lists are computed the first time the
+            // respective combination is encountered.
+            struct FaceCoupling
+            {
+              unsigned int  i;
+              unsigned int  j;
+              unsigned char blocks;
+            };
+            const unsigned char this_other  = 1;
+            const unsigned char other_this  = 2;
+            const unsigned char this_this   = 4;
+            const unsigned char other_other = 8;
+
+            const unsigned int faces_per_cell =
+              GeometryInfo<dim>::faces_per_cell;
+            std::vector<std::vector<FaceCoupling>> face_couplings(
+              faces_per_cell * (faces_per_cell + 1));
+            std::vector<std::once_flag> face_couplings_are_computed(
+              face_couplings.size());
+
+            const auto get_face_couplings =
+              [&](const unsigned int face_n, const unsigned int neighbor_face_n)
+              -> const std::vector<FaceCoupling> & {
+              const unsigned int index =
+                face_n * (faces_per_cell + 1) + neighbor_face_n;
+              std::call_once(face_couplings_are_computed[index], [&]() {
+                for (unsigned int i = 0; i < fe.n_dofs_per_cell(); ++i)
+                  for (unsigned int j = 0; j < fe.n_dofs_per_cell(); ++j)
                     {
-                      const typename DoFHandler<dim, spacedim>::face_iterator
-                        cell_face = cell->face(face_n);
-
-                      const bool periodic_neighbor =
-                        cell->has_periodic_neighbor(face_n);
+                      const bool i_non_zero_i = support_on_face(i, face_n);
+                      const bool j_non_zero_i = support_on_face(j, face_n);
 
-                      if (cell->at_boundary(face_n) && (!periodic_neighbor))
+                      unsigned char blocks = 0;
+                      if (neighbor_face_n == faces_per_cell)
                         {
-                          for (unsigned int i = 0; i < fe.n_dofs_per_cell();
-                               ++i)
-                            {
-                              const bool i_non_zero_i =
-                                support_on_face(i, face_n);
-                              for (unsigned int j = 0; j < fe.n_dofs_per_cell();
-                                   ++j)
-                                {
-                                  const bool j_non_zero_i =
-                                    support_on_face(j, face_n);
-
-                                  if (flux_dof_mask(i, j) == always ||
-                                      (flux_dof_mask(i, j) == nonzero &&
-                                       i_non_zero_i && j_non_zero_i))
-                                    cell_entries.emplace_back(
-                                      dofs_on_this_cell[i],
-                                      dofs_on_this_cell[j]);
-                                }
-                            }
-                          sparsity.add_entries(make_array_view(cell_entries));
-                          cell_entries.clear();
+                          if (flux_dof_mask(i, j) == always ||
+                              (flux_dof_mask(i, j) == nonzero &&
+                               i_non_zero_i && j_non_zero_i))
+                            blocks = this_this;
                         }
-                      else
+                      else if (flux_dof_mask(i, j) == always)
+                        blocks = this_other | other_this | this_this |
+                                 other_other;
+                      else if (flux_dof_mask(i, j) == nonzero)
                         {
-                          if (!face_has_flux_coupling(cell, face_n))
-                            continue;
-
-                          typename DoFHandler<dim,
-                                              spacedim>::level_cell_iterator
-                            neighbor =
-                              cell->neighbor_or_periodic_neighbor(face_n);
-                          // If the cells are on the same level (and both are
-                          // active, locally-owned cells) then only add to the
-                          // sparsity pattern if the current cell is 'greater'
-                          // in the total ordering.
-                          if (neighbor->level() == cell->level() &&
-                              neighbor->index() > cell->index() &&
-                              neighbor->is_active() &&
-                              neighbor->is_locally_owned())
-                            continue;
-                          // If we are more refined then the neighbor, then we
-                          // will automatically find the active neighbor cell
-                          // when we call 'neighbor (face_n)' above. The
-                          // opposite is not true; if the neighbor is more
-                          // refined then the call 'neighbor (face_n)' will
-                          // *not* return an active cell. Hence, only add things
-                          // to the sparsity pattern if (when the levels are
-                          // different) the neighbor is coarser than the current
-                          // cell.
-                          //
-                          // Like above, do not use this optimization if the
-                          // neighbor is not locally owned.
-                          if (neighbor->level() != cell->level() &&
-                              ((!periodic_neighbor &&
-                                !cell->neighbor_is_coarser(face_n)) ||
-                               (periodic_neighbor &&
-                                !cell->periodic_neighbor_is_coarser(face_n))) &&
-                              neighbor->is_locally_owned())
-                            continue; // (the neighbor is finer)
-
-                          const unsigned int neighbor_face_n =
-                            periodic_neighbor ?
-                              cell->periodic_neighbor_face_no(face_n) :
-                              cell->neighbor_face_no(face_n);
-
-
-                          // In 1D, go straight to the cell behind this
-                          // particular cell's most terminal cell. This makes us
-                          // skip the if (neighbor->has_children()) section
-                          // below. We need to do this since we otherwise
-                          // iterate over the children of the face, which are
-                          // always 0 in 1D.
-                          if (dim == 1)
-                            while (neighbor->has_children())
-                              neighbor = neighbor->child(face_n == 0 ? 1 : 0);
-
-                          if (neighbor->has_children())
-                            {
-                              for (unsigned int sub_nr = 0;
-                                   sub_nr != cell_face->n_children();
-                                   ++sub_nr)
-                                {
-                                  const typename DoFHandler<dim, spacedim>::
-                                    level_cell_iterator sub_neighbor =
-                                      periodic_neighbor ?
-                                        cell
-                                          ->periodic_neighbor_child_on_subface(
-                                            face_n, sub_nr) :
-                                        cell->neighbor_child_on_subface(face_n,
-                                                                        sub_nr);
-
-                                  sub_neighbor->get_dof_indices(
-                                    dofs_on_other_cell);
-                                  for (unsigned int i = 0;
-                                       i < fe.n_dofs_per_cell();
-                                       ++i)
-                                    {
-                                      const bool i_non_zero_i =
-                                        support_on_face(i, face_n);
-                                      const bool i_non_zero_e =
-                                        support_on_face(i, neighbor_face_n);
-                                      for (unsigned int j = 0;
-                                           j < fe.n_dofs_per_cell();
-                                           ++j)
-                                        {
-                                          const bool j_non_zero_i =
-                                            support_on_face(j, face_n);
-                                          const bool j_non_zero_e =
-                                            support_on_face(j, neighbor_face_n);
+                          const bool i_non_zero_e =
+                            support_on_face(i, neighbor_face_n);
+                          const bool j_non_zero_e =
+                            support_on_face(j, neighbor_face_n);
+
+                          if (i_non_zero_i && j_non_zero_e)
+                            blocks |= this_other;
+                          if (i_non_zero_e && j_non_zero_i)
+                            blocks |= other_this;
+                          if (i_non_zero_i && j_non_zero_i)
+                            blocks |= this_this;
+                          if (i_non_zero_e && j_non_zero_e)
+                            blocks |= other_other;
+                        }
 
-                                          if (flux_dof_mask(i, j) == always)
-                                            {
-                                              cell_entries.emplace_back(
-                                                dofs_on_this_cell[i],
-                                                dofs_on_other_cell[j]);
-                                              cell_entries.emplace_back(
-                                                dofs_on_other_cell[i],
-                                                dofs_on_this_cell[j]);
-                                              cell_entries.emplace_back(
-                                                dofs_on_this_cell[i],
-                                                dofs_on_this_cell[j]);
-                                              cell_entries.emplace_back(
-                                                dofs_on_other_cell[i],
-                                                dofs_on_other_cell[j]);
-                                            }
-                                          else if (flux_dof_mask(i, j) ==
-                                                   nonzero)
-                                            {
-                                              if (i_non_zero_i && j_non_zero_e)
-                                                cell_entries.emplace_back(
-                                                  dofs_on_this_cell[i],
-                                                  dofs_on_other_cell[j]);
-                                              if (i_non_zero_e && j_non_zero_i)
-                                                cell_entries.emplace_back(
-                                                  dofs_on_other_cell[i],
-                                                  dofs_on_this_cell[j]);
-                                              if (i_non_zero_i && j_non_zero_i)
-                                                cell_entries.emplace_back(
-                                                  dofs_on_this_cell[i],
-                                                  dofs_on_this_cell[j]);
-                                              if (i_non_zero_e && j_non_zero_e)
-                                                cell_entries.emplace_back(
-                                                  dofs_on_other_cell[i],
-                                                  dofs_on_other_cell[j]);
-                                            }
+                      if (blocks != 0)
+                        face_couplings[index].push_back({i, j, blocks});
+                    }
+              });
+              return face_couplings[index];
+            };
+
+            // Per-cell output of the worker below: the DoF indices of the
+            // cell and the entries due to its faces. The copier enters these
+            // into the sparsity pattern, so that the (expensive) traversal of
+            // faces runs in parallel while the sparsity pattern is only
+            // written to sequentially.
+            struct ScratchData
+            {
+              std::vector<types::global_dof_index> dofs_on_other_cell;
+            };
 
-                                          if (flux_dof_mask(j, i) == always)
-                                            {
-                                              cell_entries.emplace_back(
-                                                dofs_on_this_cell[j],
-                                                dofs_on_other_cell[i]);
-                                              cell_entries.emplace_back(
-                                                dofs_on_other_cell[j],
-                                                dofs_on_this_cell[i]);
-                                              cell_entries.emplace_back(
-                                                dofs_on_this_cell[j],
-                                                dofs_on_this_cell[i]);
-                                              cell_entries.emplace_back(
-                                                dofs_on_other_cell[j],
-                                                dofs_on_other_cell[i]);
-                                            }
-                                          else if (flux_dof_mask(j, i) ==
-                                                   nonzero)
-                                            {
-                                              if (j_non_zero_i && i_non_zero_e)
-                                                cell_entries.emplace_back(
-                                                  dofs_on_this_cell[j],
-                                                  dofs_on_other_cell[i]);
-                                              if (j_non_zero_e && i_non_zero_i)
-                                                cell_entries.emplace_back(
-                                                  dofs_on_other_cell[j],
-                                                  dofs_on_this_cell[i]);
-                                              if (j_non_zero_i && i_non_zero_i)
-                                                cell_entries.emplace_back(
-                                                  dofs_on_this_cell[j],
-                                                  dofs_on_this_cell[i]);
-                                              if (j_non_zero_e && i_non_zero_e)
-                                                cell_entries.emplace_back(
-                                                  dofs_on_other_cell[j],
-                                                  dofs_on_other_cell[i]);
-                                            }
-                                        }
-                                    }
-                                }
-                              sparsity.add_entries(
-                                make_array_view(cell_entries));
-                              cell_entries.clear();
-                            }
-                          else
-                            {
-                              neighbor->get_dof_indices(dofs_on_other_cell);
-                              for (unsigned int i = 0; i < fe.n_dofs_per_cell();
-                                   ++i)
-                                {
-                                  const bool i_non_zero_i =
-                                    support_on_face(i, face_n);
-                                  const bool i_non_zero_e =
-                                    support_on_face(i, neighbor_face_n);
-                                  for (unsigned int j = 0;
-                                       j < fe.n_dofs_per_cell();
-                                       ++j)
-                                    {
-                                      const bool j_non_zero_i =
-                                        support_on_face(j, face_n);
-                                      const bool j_non_zero_e =
-                                        support_on_face(j, neighbor_face_n);
-                                      if (flux_dof_mask(i, j) == always)
-                                        {
-                                          cell_entries.emplace_back(
-                                            dofs_on_this_cell[i],
-                                            dofs_on_other_cell[j]);
-                                          cell_entries.emplace_back(
-                                            dofs_on_other_cell[i],
-                                            dofs_on_this_cell[j]);
-                                          cell_entries.emplace_back(
-                                            dofs_on_this_cell[i],
-                                            dofs_on_this_cell[j]);
-                                          cell_entries.emplace_back(
-                                            dofs_on_other_cell[i],
-                                            dofs_on_other_cell[j]);
-                                        }
-                                      if (flux_dof_mask(i, j) == nonzero)
-                                        {
-                                          if (i_non_zero_i && j_non_zero_e)
-                                            cell_entries.emplace_back(
-                                              dofs_on_this_cell[i],
-                                              dofs_on_other_cell[j]);
-                                          if (i_non_zero_e && j_non_zero_i)
-                                            cell_entries.emplace_back(
-                                              dofs_on_other_cell[i],
-                                              dofs_on_this_cell[j]);
-                                          if (i_non_zero_i && j_non_zero_i)
-                                            cell_entries.emplace_back(
-                                              dofs_on_this_cell[i],
-                                              dofs_on_this_cell[j]);
-                                          if (i_non_zero_e && j_non_zero_e)
-                                            cell_entries.emplace_back(
-                                              dofs_on_other_cell[i],
-                                              dofs_on_other_cell[j]);
-                                        }
+            struct CopyData
+            {
+              bool                                 is_relevant = false;
+              std::vector<types::global_dof_index> dofs_on_this_cell;
+              std::vector<std::pair<SparsityPatternBase::size_type,
+                                    SparsityPatternBase::size_type>>
+                face_entries;
+            };
+
+            const auto add_face_entries =
+              [&](const std::vector<FaceCoupling> &        couplings,
+                  const std::vector<types::global_dof_index> &dofs_on_this_cell,
+                  const std::vector<types::global_dof_index>
+                    &        dofs_on_other_cell,
+                  CopyData &copy_data) {
+                for (const FaceCoupling &coupling : couplings)
+                  {
+                    const types::global_dof_index this_i =
+                      dofs_on_this_cell[coupling.i];
+                    const types::global_dof_index this_j =
+                      dofs_on_this_cell[coupling.j];
+                    if ((coupling.blocks & this_this) != 0)
+                      copy_data.face_entries.emplace_back(this_i, this_j);
+                    if ((coupling.blocks & this_other) != 0)
+                      copy_data.face_entries.emplace_back(
+                        this_i, dofs_on_other_cell[coupling.j]);
+                    if ((coupling.blocks & other_this) != 0)
+                      copy_data.face_entries.emplace_back(
+                        dofs_on_other_cell[coupling.i], this_j);
+                    if ((coupling.blocks & other_other) != 0)
+                      copy_data.face_entries.emplace_back(
+                        dofs_on_other_cell[coupling.i],
+                        dofs_on_other_cell[coupling.j]);
+                  }
+              };
+
+            const auto worker =
+              [&](const typename DoFHandler<dim, spacedim>::
+                    active_cell_iterator &cell,
+                  ScratchData &           scratch_data,
+                  CopyData &              copy_data) {
+                copy_data.face_entries.clear();
+                copy_data.is_relevant =
+                  ((subdomain_id == numbers::invalid_subdomain_id) ||
+                   (subdomain_id == cell->subdomain_id())) &&
+                  cell->is_locally_owned();
+                if (!copy_data.is_relevant)
+                  return;
+
+                std::vector<types::global_dof_index> &dofs_on_this_cell =
+                  copy_data.dofs_on_this_cell;
+                std::vector<types::global_dof_index> &dofs_on_other_cell =
+                  scratch_data.dofs_on_other_cell;
+                dofs_on_this_cell.resize(fe.n_dofs_per_cell());
+                dofs_on_other_cell.resize(fe.n_dofs_per_cell());
+                cell->get_dof_indices(dofs_on_this_cell);
+
+                // Loop over all interior neighbors
+                for (const unsigned int face_n : cell->face_indices())
+                  {
+                    const typename DoFHandler<dim, spacedim>::face_iterator
+                      cell_face = cell->face(face_n);
+
+                    const bool periodic_neighbor =
+                      cell->has_periodic_neighbor(face_n);
+
+                    if (cell->at_boundary(face_n) && (!periodic_neighbor))
+                      {
+                        add_face_entries(get_face_couplings(face_n,
+                                                            faces_per_cell),
+                                         dofs_on_this_cell,
+                                         dofs_on_this_cell,
+                                         copy_data);
+                      }
+                    else
+                      {
+                        if (!face_has_flux_coupling(cell, face_n))
+                          continue;
 
-                                      if (flux_dof_mask(j, i) == always)
-                                        {
-                                          cell_entries.emplace_back(
-                                            dofs_on_this_cell[j],
-                                            dofs_on_other_cell[i]);
-                                          cell_entries.emplace_back(
-                                            dofs_on_other_cell[j],
-                                            dofs_on_this_cell[i]);
-                                          cell_entries.emplace_back(
-                                            dofs_on_this_cell[j],
-                                            dofs_on_this_cell[i]);
-                                          cell_entries.emplace_back(
-                                            dofs_on_other_cell[j],
-                                            dofs_on_other_cell[i]);
-                                        }
-                                      if (flux_dof_mask(j, i) == nonzero)
-                                        {
-                                          if (j_non_zero_i && i_non_zero_e)
-                                            cell_entries.emplace_back(
-                                              dofs_on_this_cell[j],
-                                              dofs_on_other_cell[i]);
-                                          if (j_non_zero_e && i_non_zero_i)
-                                            cell_entries.emplace_back(
-                                              dofs_on_other_cell[j],
-                                              dofs_on_this_cell[i]);
-                                          if (j_non_zero_i && i_non_zero_i)
-                                            cell_entries.emplace_back(
-                                              dofs_on_this_cell[j],
-                                              dofs_on_this_cell[i]);
-                                          if (j_non_zero_e && i_non_zero_e)
-                                            cell_entries.emplace_back(
-                                              dofs_on_other_cell[j],
-                                              dofs_on_other_cell[i]);
-                                        }
-                                    }
-                                }
-                              sparsity.add_entries(
-                                make_array_view(cell_entries));
-                              cell_entries.clear();
-                            }
-                        }
-                    }
-                }
+                        typename DoFHandler<dim, spacedim>::level_cell_iterator
+                          neighbor =
+                            cell->neighbor_or_periodic_neighbor(face_n);
+                        // If the cells are on the same level (and both are
+                        // active, locally-owned cells) then only add to the
+                        // sparsity pattern if the current cell is 'greater'
+                        // in the total ordering.
+                        if (neighbor->level() == cell->level() &&
+                            neighbor->index() > cell->index() &&
+                            neighbor->is_active() &&
+                            neighbor->is_locally_owned())
+                          continue;
+                        // If we are more refined then the neighbor, then we
+                        // will automatically find the active neighbor cell
+                        // when we call 'neighbor (face_n)' above. The
+                        // opposite is not true; if the neighbor is more
+                        // refined then the call 'neighbor (face_n)' will
+                        // *not* return an active cell. Hence, only add things
+                        // to the sparsity pattern if (when the levels are
+                        // different) the neighbor is coarser than the current
+                        // cell.
+                        //
+                        // Like above, do not use this optimization if the
+                        // neighbor is not locally owned.
+                        if (neighbor->level() != cell->level() &&
+                            ((!periodic_neighbor &&
+                              !cell->neighbor_is_coarser(face_n)) ||
+                             (periodic_neighbor &&
+                              !cell->periodic_neighbor_is_coarser(face_n))) &&
+                            neighbor->is_locally_owned())
+                          continue; // (the neighbor is finer)
+
+                        const unsigned int neighbor_face_n =
+                          periodic_neighbor ?
+                            cell->periodic_neighbor_face_no(face_n) :
+                            cell->neighbor_face_no(face_n);
+
+                        const std::vector<FaceCoupling> &couplings =
+                          get_face_couplings(face_n, neighbor_face_n);
+
+                        // In 1D, go straight to the cell behind this
+                        // particular cell's most terminal cell. This makes us
+                        // skip the if (neighbor->has_children()) section
+                        // below. We need to do this since we otherwise
+                        // iterate over the children of the face, which are
+                        // always 0 in 1D.
+                        if (dim == 1)
+                          while (neighbor->has_children())
+                            neighbor = neighbor->child(face_n == 0 ? 1 : 0);
+
+                        if (neighbor->has_children())
+                          {
+                            for (unsigned int sub_nr = 0;
+                                 sub_nr != cell_face->n_children();
+                                 ++sub_nr)
+                              {
+                                const typename DoFHandler<dim, spacedim>::
+                                  level_cell_iterator sub_neighbor =
+                                    periodic_neighbor ?
+                                      cell->periodic_neighbor_child_on_subface(
+                                        face_n, sub_nr) :
+                                      cell->neighbor_child_on_subface(face_n,
+                                                                      sub_nr);
+
+                                sub_neighbor->get_dof_indices(
+                                  dofs_on_other_cell);
+                                add_face_entries(couplings,
+                                                 dofs_on_this_cell,
+                                                 dofs_on_other_cell,
+                                                 copy_data);
+                              }
+                          }
+                        else
+                          {
+                            neighbor->get_dof_indices(dofs_on_other_cell);
+                            add_face_entries(couplings,
+                                             dofs_on_this_cell,
+                                             dofs_on_other_cell,
+                                             copy_data);
+                          }
+                      }
+                  }
+              };
+
+            const auto copier = [&](const CopyData &copy_data) {
+              if (!copy_data.is_relevant)
+                return;
+
+              // make sparsity pattern for this cell
+              constraints.add_entries_local_to_global(
+                copy_data.dofs_on_this_cell,
+                sparsity,
+                keep_constrained_dofs,
+                bool_int_dof_mask);
+              sparsity.add_entries(make_array_view(copy_data.face_entries));
+            };
+
+            WorkStream::run(dof.begin_active(),
+                            dof.end(),
+                            worker,
+                            copier,
+                            ScratchData(),
+                            CopyData());
           }
         else
           {
@@ -748,6 +748,32 @@ FiniteElement<dim, spacedim>::prolongation_is_implemented() const
 
 
 
+template <int dim, int spacedim>
+void
+FiniteElement<dim, spacedim>::clear_prolongation_and_restriction_matrices()
+  const
+{}
+
+
+
+template <int dim, int spacedim>
+void
+FiniteElement<dim, spacedim>::free_prolongation_and_restriction_matrices() const
+{
+  // the matrices are logically part of the const interface of the element,
+  // like in the on-demand initialization in derived classes
+  FiniteElement<dim, spacedim> &this_nonconst =
+    const_cast<FiniteElement<dim, spacedim> &>(*this);
+  for (auto &matrices : this_nonconst.prolongation)
+    for (FullMatrix<double> &matrix : matrices)
+      matrix = FullMatrix<double>();
+  for (auto &matrices : this_nonconst.restriction)
+    for (FullMatrix<double> &matrix : matrices)
+      matrix = FullMatrix<double>();
+}
+
+
+
 template <int dim, int spacedim>
 bool
 FiniteElement<dim, spacedim>::restriction_is_implemented() const
@@ -481,6 +481,16 @@ FE_DGQ<dim, spacedim>::get_prolongation_matrix(
 
 
 
+template <int dim, int spacedim>
+void
+FE_DGQ<dim, spacedim>::clear_prolongation_and_restriction_matrices() const
+{
+  std::lock_guard<std::mutex> lock(this->mutex);
+  this->free_prolongation_and_restriction_matrices();
+}
+
+
+
 template <int dim, int spacedim>
 const FullMatrix<double> &
 FE_DGQ<dim, spacedim>::get_restriction_matrix(
@@ -1041,6 +1041,15 @@ FE_Enriched<dim, spacedim>::get_prolongation_matrix(
 }
 
 
+template <int dim, int spacedim>
+void
+FE_Enriched<dim, spacedim>::clear_prolongation_and_restriction_matrices() const
+{
+  fe_system->clear_prolongation_and_restriction_matrices();
+}
+
+
+
 template <int dim, int spacedim>
 const FullMatrix<double> &
 FE_Enriched<dim, spacedim>::get_restriction_matrix(
@@ -34,8 +34,11 @@
 #include <deal.II/lac/vector.h>
 
 #include <iostream>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <sstream>
+#include <string>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -57,6 +60,31 @@ namespace internal
         // function up to degree 12.
         return 1.e-15 * std::exp(std::pow(p, 1.075));
       }
+
+
+
+      // The interface constraints and the prolongation and restriction
+      // matrices of FE_Nedelec are computed by projections whose cost grows
+      // quickly with the degree. Since elements of the same degree are
+      // typically created several times per program run, we keep a
+      // process-wide cache of these matrices, keyed by the name of the
+      // element.
+      struct CachedMatrices
+      {
+        bool                                         has_interface_constraints;
+        FullMatrix<double>                           interface_constraints;
+        bool                                         has_embedding_matrices;
+        std::vector<std::vector<FullMatrix<double>>> prolongation;
+        std::vector<std::vector<FullMatrix<double>>> restriction;
+
+        CachedMatrices()
+          : has_interface_constraints(false)
+          , has_embedding_matrices(false)
+        {}
+      };
+
+      std::mutex                            matrix_cache_mutex;
+      std::map<std::string, CachedMatrices> matrix_cache;
     } // namespace
   }   // namespace FE_Nedelec
 } // namespace internal
@@ -101,6 +129,43 @@ FE_Nedelec<dim>::FE_Nedelec(const unsigned int order)
   // initialized on demand in get_restriction_matrix and
   // get_prolongation_matrix
 
+  // look up the interface constraints in the process-wide cache before
+  // computing them. the lock is not held during the computation, since
+  // it spawns tasks that might in turn create FE_Nedelec objects
+  bool found_in_cache = false;
+  {
+    std::lock_guard<std::mutex> lock(internal::FE_Nedelec::matrix_cache_mutex);
+    const auto entry = internal::FE_Nedelec::matrix_cache.find(get_name());
+    if (entry != internal::FE_Nedelec::matrix_cache.end() &&
+        entry->second.has_interface_constraints)
+      {
+        this->interface_constraints = entry->second.interface_constraints;
+        found_in_cache              = true;
+      }
+  }
+  if (found_in_cache == false)
+    {
+      initialize_interface_constraints();
+
+      std::lock_guard<std::mutex> lock(
+        internal::FE_Nedelec::matrix_cache_mutex);
+      internal::FE_Nedelec::CachedMatrices &entry =
+        internal::FE_Nedelec::matrix_cache[get_name()];
+      entry.interface_constraints     = this->interface_constraints;
+      entry.has_interface_constraints = true;
+    }
+
+  // We need to initialize the dof permutation table and the one for the sign
+  // change.
+  initialize_quad_dof_index_permutation_and_sign_change();
+}
+
+
+
+template <int dim>
+void
+FE_Nedelec<dim>::initialize_interface_constraints()
+{
 #ifdef DEBUG_NEDELEC
   deallog << "Face Embedding" << std::endl;
 #endif
@@ -120,7 +185,8 @@ FE_Nedelec<dim>::FE_Nedelec(const unsigned int order)
     face_embeddings,
     0,
     0,
-    internal::FE_Nedelec::get_embedding_computation_tolerance(order));
+    internal::FE_Nedelec::get_embedding_computation_tolerance(
+      this->degree - 1));
 
   switch (dim)
     {
@@ -205,10 +271,55 @@ FE_Nedelec<dim>::FE_Nedelec(const unsigned int order)
       default:
         Assert(false, ExcNotImplemented());
     }
+}
 
-  // We need to initialize the dof permutation table and the one for the sign
-  // change.
-  initialize_quad_dof_index_permutation_and_sign_change();
+
+
+template <int dim>
+void
+FE_Nedelec<dim>::initialize_embedding_and_restriction_matrices()
+{
+  bool found_in_cache = false;
+  {
+    std::lock_guard<std::mutex> lock(internal::FE_Nedelec::matrix_cache_mutex);
+    const auto entry = internal::FE_Nedelec::matrix_cache.find(get_name());
+    if (entry != internal::FE_Nedelec::matrix_cache.end() &&
+        entry->second.has_embedding_matrices)
+      {
+        this->prolongation = entry->second.prolongation;
+        this->restriction  = entry->second.restriction;
+        found_in_cache     = true;
+      }
+  }
+  if (found_in_cache)
+    return;
+
+  // Reinit the vectors of
+  // restriction and prolongation
+  // matrices to the right sizes.
+  // Restriction only for isotropic
+  // refinement
+#ifdef DEBUG_NEDELEC
+  deallog << "Embedding" << std::endl;
+#endif
+  this->reinit_restriction_and_prolongation_matrices();
+  // Fill prolongation matrices with embedding operators
+  FETools::compute_embedding_matrices(
+    *this,
+    this->prolongation,
+    true,
+    internal::FE_Nedelec::get_embedding_computation_tolerance(this->degree));
+#ifdef DEBUG_NEDELEC
+  deallog << "Restriction" << std::endl;
+#endif
+  initialize_restriction();
+
+  std::lock_guard<std::mutex> lock(internal::FE_Nedelec::matrix_cache_mutex);
+  internal::FE_Nedelec::CachedMatrices &entry =
+    internal::FE_Nedelec::matrix_cache[get_name()];
+  entry.prolongation           = this->prolongation;
+  entry.restriction            = this->restriction;
+  entry.has_embedding_matrices = true;
 }
 
 
@@ -3051,27 +3162,7 @@ FE_Nedelec<dim>::get_prolongation_matrix(
       // now do the work. need to get a non-const version of data in order to
       // be able to modify them inside a const function
       FE_Nedelec<dim> &this_nonconst = const_cast<FE_Nedelec<dim> &>(*this);
-
-      // Reinit the vectors of
-      // restriction and prolongation
-      // matrices to the right sizes.
-      // Restriction only for isotropic
-      // refinement
-#ifdef DEBUG_NEDELEC
-      deallog << "Embedding" << std::endl;
-#endif
-      this_nonconst.reinit_restriction_and_prolongation_matrices();
-      // Fill prolongation matrices with embedding operators
-      FETools::compute_embedding_matrices(
-        this_nonconst,
-        this_nonconst.prolongation,
-        true,
-        internal::FE_Nedelec::get_embedding_computation_tolerance(
-          this->degree));
-#ifdef DEBUG_NEDELEC
-      deallog << "Restriction" << std::endl;
-#endif
-      this_nonconst.initialize_restriction();
+      this_nonconst.initialize_embedding_and_restriction_matrices();
     }
 
   // we use refinement_case-1 here. the -1 takes care of the origin of the
@@ -3080,6 +3171,16 @@ FE_Nedelec<dim>::get_prolongation_matrix(
   return this->prolongation[refinement_case - 1][child];
 }
 
+template <int dim>
+void
+FE_Nedelec<dim>::clear_prolongation_and_restriction_matrices() const
+{
+  std::lock_guard<std::mutex> lock(this->mutex);
+  this->free_prolongation_and_restriction_matrices();
+}
+
+
+
 template <int dim>
 const FullMatrix<double> &
 FE_Nedelec<dim>::get_restriction_matrix(
@@ -3107,27 +3208,7 @@ FE_Nedelec<dim>::get_restriction_matrix(
       // now do the work. need to get a non-const version of data in order to
       // be able to modify them inside a const function
       FE_Nedelec<dim> &this_nonconst = const_cast<FE_Nedelec<dim> &>(*this);
-
-      // Reinit the vectors of
-      // restriction and prolongation
-      // matrices to the right sizes.
-      // Restriction only for isotropic
-      // refinement
-#ifdef DEBUG_NEDELEC
-      deallog << "Embedding" << std::endl;
-#endif
-      this_nonconst.reinit_restriction_and_prolongation_matrices();
-      // Fill prolongation matrices with embedding operators
-      FETools::compute_embedding_matrices(
-        this_nonconst,
-        this_nonconst.prolongation,
-        true,
-        internal::FE_Nedelec::get_embedding_computation_tolerance(
-          this->degree));
-#ifdef DEBUG_NEDELEC
-      deallog << "Restriction" << std::endl;
-#endif
-      this_nonconst.initialize_restriction();
+      this_nonconst.initialize_embedding_and_restriction_matrices();
     }
 
   // we use refinement_case-1 here. the -1 takes care of the origin of the
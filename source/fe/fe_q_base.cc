@@ -1437,6 +1437,16 @@ FE_Q_Base<dim, spacedim>::get_prolongation_matrix(
 
 
 
+template <int dim, int spacedim>
+void
+FE_Q_Base<dim, spacedim>::clear_prolongation_and_restriction_matrices() const
+{
+  std::lock_guard<std::mutex> lock(this->mutex);
+  this->free_prolongation_and_restriction_matrices();
+}
+
+
+
 template <int dim, int spacedim>
 const FullMatrix<double> &
 FE_Q_Base<dim, spacedim>::get_restriction_matrix(
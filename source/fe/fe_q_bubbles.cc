@@ -481,6 +481,13 @@ FE_Q_Bubbles<dim, spacedim>::get_prolongation_matrix(
 
 
 
+template <int dim, int spacedim>
+void
+FE_Q_Bubbles<dim, spacedim>::clear_prolongation_and_restriction_matrices() const
+{}
+
+
+
 template <int dim, int spacedim>
 const FullMatrix<double> &
 FE_Q_Bubbles<dim, spacedim>::get_restriction_matrix(
@@ -315,6 +315,32 @@ namespace FESeries
 
     legendre_coefficients.fill(unrolled_coefficients.begin());
   }
+
+
+
+  template <int dim, int spacedim>
+  void
+  Legendre<dim, spacedim>::calculate(
+    const FullMatrix<CoefficientType> &local_dof_values,
+    const unsigned int                 active_fe_index,
+    FullMatrix<CoefficientType> &      coefficients)
+  {
+    ensure_existence(n_coefficients_per_direction,
+                     *fe_collection,
+                     q_collection,
+                     active_fe_index,
+                     component,
+                     legendre_transform_matrices);
+
+    const FullMatrix<CoefficientType> &matrix =
+      legendre_transform_matrices[active_fe_index];
+
+    Assert(local_dof_values.m() == matrix.n(),
+           ExcDimensionMismatch(local_dof_values.m(), matrix.n()));
+
+    coefficients.reinit(matrix.m(), local_dof_values.n());
+    matrix.mmult(coefficients, local_dof_values);
+  }
 } // namespace FESeries
 
 
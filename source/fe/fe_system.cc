@@ -874,6 +874,21 @@ FESystem<dim, spacedim>::get_interpolation_matrix(
 
 
 
+template <int dim, int spacedim>
+void
+FESystem<dim, spacedim>::clear_prolongation_and_restriction_matrices() const
+{
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->free_prolongation_and_restriction_matrices();
+  }
+
+  for (unsigned int i = 0; i < this->n_base_elements(); ++i)
+    base_element(i).clear_prolongation_and_restriction_matrices();
+}
+
+
+
 template <int dim, int spacedim>
 const FullMatrix<double> &
 FESystem<dim, spacedim>::get_restriction_matrix(
@@ -45,6 +45,9 @@
 #include <deal.II/lac/vector.h>
 #include <deal.II/lac/vector_element_access.h>
 
+#include <deal.II/matrix_free/shape_info.h>
+#include <deal.II/matrix_free/tensor_product_kernels.h>
+
 DEAL_II_DISABLE_EXTRA_DIAGNOSTICS
 #include <boost/container/small_vector.hpp>
 DEAL_II_ENABLE_EXTRA_DIAGNOSTICS
@@ -173,6 +176,9 @@ namespace FEValuesViews
             shape_function_to_row_table[i * fe.n_components() + component];
         else
           shape_function_data[i].row_index = numbers::invalid_unsigned_int;
+
+        if (shape_function_data[i].is_nonzero_shape_function_component)
+          nonzero_shape_functions.push_back(i);
       }
   }
 
@@ -251,6 +257,9 @@ namespace FEValuesViews
                   break;
                 }
           }
+
+        if (n_nonzero_components > 0)
+          nonzero_shape_functions.push_back(i);
       }
   }
 
@@ -444,17 +453,16 @@ namespace FEValuesViews
       const Table<2, double> & shape_values,
       const std::vector<typename Scalar<dim, spacedim>::ShapeFunctionData>
         &shape_function_data,
+      const std::vector<unsigned int> &nonzero_shape_functions,
       std::vector<typename ProductType<Number, double>::type> &values)
     {
-      const unsigned int dofs_per_cell       = dof_values.size();
       const unsigned int n_quadrature_points = values.size();
 
       std::fill(values.begin(),
                 values.end(),
                 dealii::internal::NumberType<Number>::value(0.0));
 
-      for (unsigned int shape_function = 0; shape_function < dofs_per_cell;
-           ++shape_function)
+      for (const unsigned int shape_function : nonzero_shape_functions)
         if (shape_function_data[shape_function]
               .is_nonzero_shape_function_component)
           {
@@ -484,11 +492,11 @@ namespace FEValuesViews
       const Table<2, dealii::Tensor<order, spacedim>> &shape_derivatives,
       const std::vector<typename Scalar<dim, spacedim>::ShapeFunctionData>
         &shape_function_data,
+      const std::vector<unsigned int> &nonzero_shape_functions,
       std::vector<
         typename ProductType<Number, dealii::Tensor<order, spacedim>>::type>
         &derivatives)
     {
-      const unsigned int dofs_per_cell       = dof_values.size();
       const unsigned int n_quadrature_points = derivatives.size();
 
       std::fill(
@@ -496,8 +504,7 @@ namespace FEValuesViews
         derivatives.end(),
         typename ProductType<Number, dealii::Tensor<order, spacedim>>::type());
 
-      for (unsigned int shape_function = 0; shape_function < dofs_per_cell;
-           ++shape_function)
+      for (const unsigned int shape_function : nonzero_shape_functions)
         if (shape_function_data[shape_function]
               .is_nonzero_shape_function_component)
           {
@@ -526,10 +533,10 @@ namespace FEValuesViews
       const Table<2, dealii::Tensor<2, spacedim>> &shape_hessians,
       const std::vector<typename Scalar<dim, spacedim>::ShapeFunctionData>
         &shape_function_data,
+      const std::vector<unsigned int> &nonzero_shape_functions,
       std::vector<typename Scalar<dim, spacedim>::
                     template solution_laplacian_type<Number>> &laplacians)
     {
-      const unsigned int dofs_per_cell       = dof_values.size();
       const unsigned int n_quadrature_points = laplacians.size();
 
       std::fill(
@@ -538,8 +545,7 @@ namespace FEValuesViews
         typename Scalar<dim,
                         spacedim>::template solution_laplacian_type<Number>());
 
-      for (unsigned int shape_function = 0; shape_function < dofs_per_cell;
-           ++shape_function)
+      for (const unsigned int shape_function : nonzero_shape_functions)
         if (shape_function_data[shape_function]
               .is_nonzero_shape_function_component)
           {
@@ -569,11 +575,11 @@ namespace FEValuesViews
       const Table<2, double> & shape_values,
       const std::vector<typename Vector<dim, spacedim>::ShapeFunctionData>
         &shape_function_data,
+      const std::vector<unsigned int> &nonzero_shape_functions,
       std::vector<
         typename ProductType<Number, dealii::Tensor<1, spacedim>>::type>
         &values)
     {
-      const unsigned int dofs_per_cell       = dof_values.size();
       const unsigned int n_quadrature_points = values.size();
 
       std::fill(
@@ -581,8 +587,7 @@ namespace FEValuesViews
         values.end(),
         typename ProductType<Number, dealii::Tensor<1, spacedim>>::type());
 
-      for (unsigned int shape_function = 0; shape_function < dofs_per_cell;
-           ++shape_function)
+      for (const unsigned int shape_function : nonzero_shape_functions)
         {
           const int snc =
             shape_function_data[shape_function].single_nonzero_component;
@@ -630,11 +635,11 @@ namespace FEValuesViews
       const Table<2, dealii::Tensor<order, spacedim>> &shape_derivatives,
       const std::vector<typename Vector<dim, spacedim>::ShapeFunctionData>
         &shape_function_data,
+      const std::vector<unsigned int> &nonzero_shape_functions,
       std::vector<
         typename ProductType<Number, dealii::Tensor<order + 1, spacedim>>::type>
         &derivatives)
     {
-      const unsigned int dofs_per_cell       = dof_values.size();
       const unsigned int n_quadrature_points = derivatives.size();
 
       std::fill(
@@ -643,8 +648,7 @@ namespace FEValuesViews
         typename ProductType<Number,
                              dealii::Tensor<order + 1, spacedim>>::type());
 
-      for (unsigned int shape_function = 0; shape_function < dofs_per_cell;
-           ++shape_function)
+      for (const unsigned int shape_function : nonzero_shape_functions)
         {
           const int snc =
             shape_function_data[shape_function].single_nonzero_component;
@@ -695,12 +699,12 @@ namespace FEValuesViews
       const Table<2, dealii::Tensor<1, spacedim>> &shape_gradients,
       const std::vector<typename Vector<dim, spacedim>::ShapeFunctionData>
         &shape_function_data,
+      const std::vector<unsigned int> &nonzero_shape_functions,
       std::vector<
         typename ProductType<Number,
                              dealii::SymmetricTensor<2, spacedim>>::type>
         &symmetric_gradients)
     {
-      const unsigned int dofs_per_cell       = dof_values.size();
       const unsigned int n_quadrature_points = symmetric_gradients.size();
 
       std::fill(
@@ -709,8 +713,7 @@ namespace FEValuesViews
         typename ProductType<Number,
                              dealii::SymmetricTensor<2, spacedim>>::type());
 
-      for (unsigned int shape_function = 0; shape_function < dofs_per_cell;
-           ++shape_function)
+      for (const unsigned int shape_function : nonzero_shape_functions)
         {
           const int snc =
             shape_function_data[shape_function].single_nonzero_component;
@@ -765,10 +768,10 @@ namespace FEValuesViews
       const Table<2, dealii::Tensor<1, spacedim>> &shape_gradients,
       const std::vector<typename Vector<dim, spacedim>::ShapeFunctionData>
         &shape_function_data,
+      const std::vector<unsigned int> &nonzero_shape_functions,
       std::vector<typename Vector<dim, spacedim>::
                     template solution_divergence_type<Number>> &divergences)
     {
-      const unsigned int dofs_per_cell       = dof_values.size();
       const unsigned int n_quadrature_points = divergences.size();
 
       std::fill(
@@ -777,8 +780,7 @@ namespace FEValuesViews
         typename Vector<dim,
                         spacedim>::template solution_divergence_type<Number>());
 
-      for (unsigned int shape_function = 0; shape_function < dofs_per_cell;
-           ++shape_function)
+      for (const unsigned int shape_function : nonzero_shape_functions)
         {
           const int snc =
             shape_function_data[shape_function].single_nonzero_component;
@@ -828,11 +830,11 @@ namespace FEValuesViews
       const Table<2, dealii::Tensor<1, spacedim>> &shape_gradients,
       const std::vector<typename Vector<dim, spacedim>::ShapeFunctionData>
         &shape_function_data,
+      const std::vector<unsigned int> &nonzero_shape_functions,
       std::vector<typename ProductType<
         Number,
         typename dealii::internal::CurlType<spacedim>::type>::type> &curls)
     {
-      const unsigned int dofs_per_cell       = dof_values.size();
       const unsigned int n_quadrature_points = curls.size();
 
       std::fill(curls.begin(),
@@ -853,9 +855,7 @@ namespace FEValuesViews
 
           case 2:
             {
-              for (unsigned int shape_function = 0;
-                   shape_function < dofs_per_cell;
-                   ++shape_function)
+              for (const unsigned int shape_function : nonzero_shape_functions)
                 {
                   const int snc = shape_function_data[shape_function]
                                     .single_nonzero_component;
@@ -937,9 +937,7 @@ namespace FEValuesViews
 
           case 3:
             {
-              for (unsigned int shape_function = 0;
-                   shape_function < dofs_per_cell;
-                   ++shape_function)
+              for (const unsigned int shape_function : nonzero_shape_functions)
                 {
                   const int snc = shape_function_data[shape_function]
                                     .single_nonzero_component;
@@ -1090,10 +1088,10 @@ namespace FEValuesViews
       const Table<2, dealii::Tensor<2, spacedim>> &shape_hessians,
       const std::vector<typename Vector<dim, spacedim>::ShapeFunctionData>
         &shape_function_data,
+      const std::vector<unsigned int> &nonzero_shape_functions,
       std::vector<typename Vector<dim, spacedim>::
                     template solution_laplacian_type<Number>> &laplacians)
     {
-      const unsigned int dofs_per_cell       = dof_values.size();
       const unsigned int n_quadrature_points = laplacians.size();
 
       std::fill(
@@ -1102,8 +1100,7 @@ namespace FEValuesViews
         typename Vector<dim,
                         spacedim>::template solution_laplacian_type<Number>());
 
-      for (unsigned int shape_function = 0; shape_function < dofs_per_cell;
-           ++shape_function)
+      for (const unsigned int shape_function : nonzero_shape_functions)
         {
           const int snc =
             shape_function_data[shape_function].single_nonzero_component;
@@ -1567,6 +1564,7 @@ namespace FEValuesViews
       make_array_view(dof_values.begin(), dof_values.end()),
       fe_values->finite_element_output.shape_values,
       shape_function_data,
+      nonzero_shape_functions,
       values);
   }
 
@@ -1591,6 +1589,7 @@ namespace FEValuesViews
       make_array_view(dof_values.begin(), dof_values.end()),
       fe_values->finite_element_output.shape_values,
       shape_function_data,
+      nonzero_shape_functions,
       values);
   }
 
@@ -1621,6 +1620,7 @@ namespace FEValuesViews
       make_array_view(dof_values.begin(), dof_values.end()),
       fe_values->finite_element_output.shape_gradients,
       shape_function_data,
+      nonzero_shape_functions,
       gradients);
   }
 
@@ -1645,6 +1645,7 @@ namespace FEValuesViews
       make_array_view(dof_values.begin(), dof_values.end()),
       fe_values->finite_element_output.shape_gradients,
       shape_function_data,
+      nonzero_shape_functions,
       gradients);
   }
 
@@ -1675,6 +1676,7 @@ namespace FEValuesViews
       make_array_view(dof_values.begin(), dof_values.end()),
       fe_values->finite_element_output.shape_hessians,
       shape_function_data,
+      nonzero_shape_functions,
       hessians);
   }
 
@@ -1699,6 +1701,7 @@ namespace FEValuesViews
       make_array_view(dof_values.begin(), dof_values.end()),
       fe_values->finite_element_output.shape_hessians,
       shape_function_data,
+      nonzero_shape_functions,
       hessians);
   }
 
@@ -1729,6 +1732,7 @@ namespace FEValuesViews
       make_array_view(dof_values.begin(), dof_values.end()),
       fe_values->finite_element_output.shape_hessians,
       shape_function_data,
+      nonzero_shape_functions,
       laplacians);
   }
 
@@ -1753,6 +1757,7 @@ namespace FEValuesViews
       make_array_view(dof_values.begin(), dof_values.end()),
       fe_values->finite_element_output.shape_hessians,
       shape_function_data,
+      nonzero_shape_functions,
       laplacians);
   }
 
@@ -1784,6 +1789,7 @@ namespace FEValuesViews
       make_array_view(dof_values.begin(), dof_values.end()),
       fe_values->finite_element_output.shape_3rd_derivatives,
       shape_function_data,
+      nonzero_shape_functions,
       third_derivatives);
   }
 
@@ -1809,6 +1815,7 @@ namespace FEValuesViews
       make_array_view(dof_values.begin(), dof_values.end()),
       fe_values->finite_element_output.shape_3rd_derivatives,
       shape_function_data,
+      nonzero_shape_functions,
       third_derivatives);
   }
 
@@ -1839,6 +1846,7 @@ namespace FEValuesViews
       make_array_view(dof_values.begin(), dof_values.end()),
       fe_values->finite_element_output.shape_values,
       shape_function_data,
+      nonzero_shape_functions,
       values);
   }
 
@@ -1863,6 +1871,7 @@ namespace FEValuesViews
       make_array_view(dof_values.begin(), dof_values.end()),
       fe_values->finite_element_output.shape_values,
       shape_function_data,
+      nonzero_shape_functions,
       values);
   }
 
@@ -1893,6 +1902,7 @@ namespace FEValuesViews
       make_array_view(dof_values.begin(), dof_values.end()),
       fe_values->finite_element_output.shape_gradients,
       shape_function_data,
+      nonzero_shape_functions,
       gradients);
   }
 
@@ -1917,6 +1927,7 @@ namespace FEValuesViews
       make_array_view(dof_values.begin(), dof_values.end()),
       fe_values->finite_element_output.shape_gradients,
       shape_function_data,
+      nonzero_shape_functions,
       gradients);
   }
 
@@ -1948,6 +1959,7 @@ namespace FEValuesViews
       make_array_view(dof_values.begin(), dof_values.end()),
       fe_values->finite_element_output.shape_gradients,
       shape_function_data,
+      nonzero_shape_functions,
       symmetric_gradients);
   }
 
@@ -1973,6 +1985,7 @@ namespace FEValuesViews
       make_array_view(dof_values.begin(), dof_values.end()),
       fe_values->finite_element_output.shape_gradients,
       shape_function_data,
+      nonzero_shape_functions,
       symmetric_gradients);
   }
 
@@ -2004,6 +2017,7 @@ namespace FEValuesViews
       make_array_view(dof_values.begin(), dof_values.end()),
       fe_values->finite_element_output.shape_gradients,
       shape_function_data,
+      nonzero_shape_functions,
       divergences);
   }
 
@@ -2028,6 +2042,7 @@ namespace FEValuesViews
       make_array_view(dof_values.begin(), dof_values.end()),
       fe_values->finite_element_output.shape_gradients,
       shape_function_data,
+      nonzero_shape_functions,
       divergences);
   }
 
@@ -2058,6 +2073,7 @@ namespace FEValuesViews
       make_array_view(dof_values.begin(), dof_values.end()),
       fe_values->finite_element_output.shape_gradients,
       shape_function_data,
+      nonzero_shape_functions,
       curls);
   }
 
@@ -2082,6 +2098,7 @@ namespace FEValuesViews
       make_array_view(dof_values.begin(), dof_values.end()),
       fe_values->finite_element_output.shape_gradients,
       shape_function_data,
+      nonzero_shape_functions,
       curls);
   }
 
@@ -2112,6 +2129,7 @@ namespace FEValuesViews
       make_array_view(dof_values.begin(), dof_values.end()),
       fe_values->finite_element_output.shape_hessians,
       shape_function_data,
+      nonzero_shape_functions,
       hessians);
   }
 
@@ -2136,6 +2154,7 @@ namespace FEValuesViews
       make_array_view(dof_values.begin(), dof_values.end()),
       fe_values->finite_element_output.shape_hessians,
       shape_function_data,
+      nonzero_shape_functions,
       hessians);
   }
 
@@ -2171,6 +2190,7 @@ namespace FEValuesViews
       make_array_view(dof_values.begin(), dof_values.end()),
       fe_values->finite_element_output.shape_hessians,
       shape_function_data,
+      nonzero_shape_functions,
       laplacians);
   }
 
@@ -2198,6 +2218,7 @@ namespace FEValuesViews
       make_array_view(dof_values.begin(), dof_values.end()),
       fe_values->finite_element_output.shape_hessians,
       shape_function_data,
+      nonzero_shape_functions,
       laplacians);
   }
 
@@ -2229,6 +2250,7 @@ namespace FEValuesViews
       make_array_view(dof_values.begin(), dof_values.end()),
       fe_values->finite_element_output.shape_3rd_derivatives,
       shape_function_data,
+      nonzero_shape_functions,
       third_derivatives);
   }
 
@@ -2254,6 +2276,7 @@ namespace FEValuesViews
       make_array_view(dof_values.begin(), dof_values.end()),
       fe_values->finite_element_output.shape_3rd_derivatives,
       shape_function_data,
+      nonzero_shape_functions,
       third_derivatives);
   }
 
@@ -2941,6 +2964,180 @@ namespace internal
 
 
 
+  // Helper class to apply the one-dimensional interpolation matrices of a
+  // tensor-product element in all directions, using the derivative matrix
+  // in direction 'derivative_direction' (none if it is not smaller than
+  // dim). The data is passed from 'in' through the two temporary arrays to
+  // 'out'.
+  template <int dim>
+  struct TensorProductSweeps;
+
+  template <>
+  struct TensorProductSweeps<1>
+  {
+    template <typename Evaluator, typename Number>
+    static void
+    apply(const Evaluator &  eval,
+          const unsigned int derivative_direction,
+          const Number *     in,
+          Number *,
+          Number *,
+          Number *out)
+    {
+      if (derivative_direction == 0)
+        eval.template gradients<0, true, false>(in, out);
+      else
+        eval.template values<0, true, false>(in, out);
+    }
+  };
+
+  template <>
+  struct TensorProductSweeps<2>
+  {
+    template <typename Evaluator, typename Number>
+    static void
+    apply(const Evaluator &  eval,
+          const unsigned int derivative_direction,
+          const Number *     in,
+          Number *           tmp,
+          Number *,
+          Number *out)
+    {
+      if (derivative_direction == 0)
+        eval.template gradients<0, true, false>(in, tmp);
+      else
+        eval.template values<0, true, false>(in, tmp);
+      if (derivative_direction == 1)
+        eval.template gradients<1, true, false>(tmp, out);
+      else
+        eval.template values<1, true, false>(tmp, out);
+    }
+  };
+
+  template <>
+  struct TensorProductSweeps<3>
+  {
+    template <typename Evaluator, typename Number>
+    static void
+    apply(const Evaluator &  eval,
+          const unsigned int derivative_direction,
+          const Number *     in,
+          Number *           tmp1,
+          Number *           tmp2,
+          Number *           out)
+    {
+      if (derivative_direction == 0)
+        eval.template gradients<0, true, false>(in, tmp1);
+      else
+        eval.template values<0, true, false>(in, tmp1);
+      if (derivative_direction == 1)
+        eval.template gradients<1, true, false>(tmp1, tmp2);
+      else
+        eval.template values<1, true, false>(tmp1, tmp2);
+      if (derivative_direction == 2)
+        eval.template gradients<2, true, false>(tmp2, out);
+      else
+        eval.template values<2, true, false>(tmp2, out);
+    }
+  };
+
+
+
+  // Evaluate the values (derivative_direction >= dim) or one reference-cell
+  // derivative of a scalar tensor-product element by sum factorization,
+  // given the degrees of freedom in lexicographic order. The quadrature
+  // points of a tensor-product formula are numbered lexicographically, so
+  // the result can directly be used as the values in the quadrature points
+  // of FEValues. The array 'tmp' is used as scratch space.
+  template <int dim, typename Number>
+  void
+  do_tensor_product_sweeps(
+    const Number *                                dof_values_lex,
+    const MatrixFreeFunctions::ShapeInfo<double> &shape_info,
+    const unsigned int                            derivative_direction,
+    boost::container::small_vector<Number, 200> & tmp,
+    Number *                                      out)
+  {
+    const MatrixFreeFunctions::UnivariateShapeData<double> &data =
+      shape_info.data[0];
+    const unsigned int n_q_points_1d = data.n_q_points_1d;
+    const unsigned int n_dofs_1d = data.shape_values.size() / n_q_points_1d;
+
+    EvaluatorTensorProduct<evaluate_general, dim, 0, 0, Number, double> eval(
+      data.shape_values,
+      data.shape_gradients,
+      data.shape_hessians,
+      n_dofs_1d,
+      n_q_points_1d);
+
+    const unsigned int n_tmp =
+      Utilities::fixed_power<dim>(std::max(n_dofs_1d, n_q_points_1d));
+    tmp.resize(2 * n_tmp);
+    TensorProductSweeps<dim>::apply(eval,
+                                    derivative_direction,
+                                    dof_values_lex,
+                                    tmp.data(),
+                                    tmp.data() + n_tmp,
+                                    out);
+  }
+
+
+
+  // Return the degrees of freedom of a scalar tensor-product element in the
+  // lexicographic order used by the sum-factorization kernels.
+  template <typename Number>
+  boost::container::small_vector<Number, 200>
+  get_lexicographic_dof_values(
+    const Number *                                dof_values_ptr,
+    const MatrixFreeFunctions::ShapeInfo<double> &shape_info)
+  {
+    const unsigned int n_dofs = shape_info.lexicographic_numbering.size();
+    boost::container::small_vector<Number, 200> dof_values_lex(n_dofs);
+    for (unsigned int i = 0; i < n_dofs; ++i)
+      dof_values_lex[i] = dof_values_ptr[shape_info.lexicographic_numbering[i]];
+    return dof_values_lex;
+  }
+
+
+
+  // Fast path for do_function_values() with scalar tensor-product elements,
+  // returning false if it can not be used.
+  template <int dim, typename Number>
+  typename std::enable_if<!std::is_floating_point<Number>::value, bool>::type
+  do_function_values_tensor_product(
+    const Number *,
+    const MatrixFreeFunctions::ShapeInfo<double> *,
+    std::vector<Number> &)
+  {
+    return false;
+  }
+
+
+
+  template <int dim, typename Number>
+  typename std::enable_if<std::is_floating_point<Number>::value, bool>::type
+  do_function_values_tensor_product(
+    const Number *                                dof_values_ptr,
+    const MatrixFreeFunctions::ShapeInfo<double> *shape_info,
+    std::vector<Number> &                         values)
+  {
+    if (shape_info == nullptr)
+      return false;
+
+    AssertDimension(values.size(), shape_info->n_q_points);
+    const boost::container::small_vector<Number, 200> dof_values_lex =
+      get_lexicographic_dof_values(dof_values_ptr, *shape_info);
+    boost::container::small_vector<Number, 200> tmp;
+    do_tensor_product_sweeps<dim>(dof_values_lex.data(),
+                                  *shape_info,
+                                  numbers::invalid_unsigned_int,
+                                  tmp,
+                                  values.data());
+    return true;
+  }
+
+
+
   template <int dim, int spacedim, typename VectorType>
   void
   do_function_values(
@@ -3092,6 +3289,61 @@ namespace internal
 
 
 
+  // Fast path for the gradients of scalar tensor-product elements: compute
+  // the derivatives with respect to the reference coordinates by sum
+  // factorization and transform them to real space with the inverse
+  // Jacobians. Returns false if it can not be used.
+  template <int dim, int spacedim, typename Number>
+  typename std::enable_if<!std::is_floating_point<Number>::value, bool>::type
+  do_function_gradients_tensor_product(
+    const Number *,
+    const MatrixFreeFunctions::ShapeInfo<double> *,
+    const std::vector<DerivativeForm<1, spacedim, dim>> &,
+    std::vector<Tensor<1, spacedim, Number>> &)
+  {
+    return false;
+  }
+
+
+
+  template <int dim, int spacedim, typename Number>
+  typename std::enable_if<std::is_floating_point<Number>::value, bool>::type
+  do_function_gradients_tensor_product(
+    const Number *                                       dof_values_ptr,
+    const MatrixFreeFunctions::ShapeInfo<double> *       shape_info,
+    const std::vector<DerivativeForm<1, spacedim, dim>> &inverse_jacobians,
+    std::vector<Tensor<1, spacedim, Number>> &           gradients)
+  {
+    if (shape_info == nullptr || inverse_jacobians.empty())
+      return false;
+
+    const unsigned int n_q_points = shape_info->n_q_points;
+    AssertDimension(gradients.size(), n_q_points);
+    AssertDimension(inverse_jacobians.size(), n_q_points);
+
+    const boost::container::small_vector<Number, 200> dof_values_lex =
+      get_lexicographic_dof_values(dof_values_ptr, *shape_info);
+    boost::container::small_vector<Number, 200> tmp, reference_derivative;
+    reference_derivative.resize(n_q_points);
+
+    std::fill_n(gradients.begin(), n_q_points, Tensor<1, spacedim, Number>());
+    for (unsigned int e = 0; e < dim; ++e)
+      {
+        do_tensor_product_sweeps<dim>(dof_values_lex.data(),
+                                      *shape_info,
+                                      e,
+                                      tmp,
+                                      reference_derivative.data());
+        for (unsigned int q = 0; q < n_q_points; ++q)
+          for (unsigned int d = 0; d < spacedim; ++d)
+            gradients[q][d] +=
+              reference_derivative[q] * inverse_jacobians[q][e][d];
+      }
+    return true;
+  }
+
+
+
   template <int order, int dim, int spacedim, typename Number>
   void
   do_function_derivatives(
@@ -3367,9 +3619,11 @@ FEValuesBase<dim, spacedim>::get_function_values(
   // get function values of dofs on this cell
   Vector<Number> dof_values(dofs_per_cell);
   present_cell.get_interpolated_dof_values(fe_function, dof_values);
-  internal::do_function_values(dof_values.begin(),
-                               this->finite_element_output.shape_values,
-                               values);
+  if (internal::do_function_values_tensor_product<dim>(
+        dof_values.begin(), tensor_product_shape_info.get(), values) == false)
+    internal::do_function_values(dof_values.begin(),
+                                 this->finite_element_output.shape_values,
+                                 values);
 }
 
 
@@ -3391,9 +3645,11 @@ FEValuesBase<dim, spacedim>::get_function_values(
   boost::container::small_vector<Number, 200> dof_values(dofs_per_cell);
   for (unsigned int i = 0; i < dofs_per_cell; ++i)
     dof_values[i] = internal::get_vector_element(fe_function, indices[i]);
-  internal::do_function_values(dof_values.data(),
-                               this->finite_element_output.shape_values,
-                               values);
+  if (internal::do_function_values_tensor_product<dim>(
+        dof_values.data(), tensor_product_shape_info.get(), values) == false)
+    internal::do_function_values(dof_values.data(),
+                                 this->finite_element_output.shape_values,
+                                 values);
 }
 
 
@@ -3507,9 +3763,15 @@ FEValuesBase<dim, spacedim>::get_function_gradients(
   // get function values of dofs on this cell
   Vector<Number> dof_values(dofs_per_cell);
   present_cell.get_interpolated_dof_values(fe_function, dof_values);
-  internal::do_function_derivatives(dof_values.begin(),
-                                    this->finite_element_output.shape_gradients,
-                                    gradients);
+  if (internal::do_function_gradients_tensor_product<dim, spacedim>(
+        dof_values.begin(),
+        tensor_product_shape_info.get(),
+        this->mapping_output.inverse_jacobians,
+        gradients) == false)
+    internal::do_function_derivatives(
+      dof_values.begin(),
+      this->finite_element_output.shape_gradients,
+      gradients);
 }
 
 
@@ -3532,9 +3794,15 @@ FEValuesBase<dim, spacedim>::get_function_gradients(
   boost::container::small_vector<Number, 200> dof_values(dofs_per_cell);
   for (unsigned int i = 0; i < dofs_per_cell; ++i)
     dof_values[i] = internal::get_vector_element(fe_function, indices[i]);
-  internal::do_function_derivatives(dof_values.data(),
-                                    this->finite_element_output.shape_gradients,
-                                    gradients);
+  if (internal::do_function_gradients_tensor_product<dim, spacedim>(
+        dof_values.data(),
+        tensor_product_shape_info.get(),
+        this->mapping_output.inverse_jacobians,
+        gradients) == false)
+    internal::do_function_derivatives(
+      dof_values.data(),
+      this->finite_element_output.shape_gradients,
+      gradients);
 }
 
 
@@ -4218,6 +4486,57 @@ FEValues<dim, spacedim>::FEValues(const FiniteElement<dim, spacedim> &fe,
 
 
 
+namespace internal
+{
+  namespace
+  {
+    // The sum-factorization fast path of FEValuesBase is only available for
+    // FEValues with dim == spacedim
+    template <int dim, int spacedim>
+    std::unique_ptr<const MatrixFreeFunctions::ShapeInfo<double>>
+    make_tensor_product_shape_info(const FiniteElement<dim, spacedim> &,
+                                   const Quadrature<dim> &)
+    {
+      return nullptr;
+    }
+
+
+
+    // Set up the one-dimensional shape data for the sum-factorization fast
+    // path of FEValuesBase if 'fe' is a scalar tensor-product element and
+    // 'quadrature' is a tensor product of the same 1D formula in all
+    // directions. Return an empty pointer otherwise.
+    template <int dim>
+    std::unique_ptr<const MatrixFreeFunctions::ShapeInfo<double>>
+    make_tensor_product_shape_info(const FiniteElement<dim, dim> &fe,
+                                   const Quadrature<dim> &        quadrature)
+    {
+      if (fe.n_components() != 1 || quadrature.is_tensor_product() == false ||
+          MatrixFreeFunctions::ShapeInfo<double>::is_supported(fe) == false)
+        return nullptr;
+
+      const std::array<Quadrature<1>, dim> basis =
+        quadrature.get_tensor_basis();
+      for (unsigned int d = 1; d < dim; ++d)
+        if (basis[d].get_points() != basis[0].get_points() ||
+            basis[d].get_weights() != basis[0].get_weights())
+          return nullptr;
+
+      std::unique_ptr<const MatrixFreeFunctions::ShapeInfo<double>>
+        shape_info =
+          std::make_unique<MatrixFreeFunctions::ShapeInfo<double>>(basis[0],
+                                                                   fe);
+      if (shape_info->element_type >
+          MatrixFreeFunctions::tensor_symmetric_no_collocation)
+        return nullptr;
+
+      return shape_info;
+    }
+  } // namespace
+} // namespace internal
+
+
+
 template <int dim, int spacedim>
 void
 FEValues<dim, spacedim>::initialize(const UpdateFlags update_flags)
@@ -4232,7 +4551,17 @@ FEValues<dim, spacedim>::initialize(const UpdateFlags update_flags)
                       "triangulation it refers to is embedded in a higher "
                       "dimensional space."));
 
-  const UpdateFlags flags = this->compute_update_flags(update_flags);
+  // scalar tensor-product elements on tensor-product quadrature formulas
+  // evaluate solutions by sum factorization. the gradients are then
+  // transformed to real space with the inverse Jacobians, which we need to
+  // ask the mapping for
+  this->tensor_product_shape_info =
+    internal::make_tensor_product_shape_info(*this->fe, quadrature);
+  UpdateFlags requested_flags = update_flags;
+  if (this->tensor_product_shape_info && (update_flags & update_gradients))
+    requested_flags |= update_inverse_jacobians;
+
+  const UpdateFlags flags = this->compute_update_flags(requested_flags);
 
   // initialize the base classes
   if (flags & update_mapping)
@@ -4331,10 +4660,109 @@ FEValues<dim, spacedim>::reinit(
 
 
 
+template <int dim, int spacedim>
+FEValues<dim, spacedim>::~FEValues()
+{
+  precomputed_data_listener_refinement.disconnect();
+  precomputed_data_listener_mesh_transform.disconnect();
+}
+
+
+
+template <int dim, int spacedim>
+void
+FEValues<dim, spacedim>::precompute_data(
+  const Triangulation<dim, spacedim> &triangulation)
+{
+  clear_precomputed_data();
+
+  has_precomputed_data.resize(triangulation.n_active_cells(), false);
+  precomputed_mapping_output.resize(triangulation.n_active_cells());
+  precomputed_finite_element_output.resize(triangulation.n_active_cells());
+
+  // compute the data on each cell as usual, and keep a copy of it
+  for (const auto &cell : triangulation.active_cell_iterators())
+    if (cell->is_artificial() == false)
+      {
+        reinit(cell);
+
+        const unsigned int index = cell->active_cell_index();
+        has_precomputed_data[index]       = true;
+        precomputed_mapping_output[index] = this->mapping_output;
+        precomputed_finite_element_output[index] =
+          this->finite_element_output;
+      }
+
+  precomputed_triangulation = &triangulation;
+  precomputed_data_listener_refinement =
+    triangulation.signals.any_change.connect(
+      [this]() { this->clear_precomputed_data(); });
+  precomputed_data_listener_mesh_transform =
+    triangulation.signals.mesh_movement.connect(
+      [this]() { this->clear_precomputed_data(); });
+}
+
+
+
+template <int dim, int spacedim>
+void
+FEValues<dim, spacedim>::clear_precomputed_data()
+{
+  precomputed_data_listener_refinement.disconnect();
+  precomputed_data_listener_mesh_transform.disconnect();
+
+  // the output fields of this object may currently hold the storage of an
+  // entry of the precomputed data. that is fine since they are overwritten
+  // by the next reinit() anyway, but the data can no longer be used to
+  // skip computations on a similar next cell
+  if (swapped_in_cell != numbers::invalid_unsigned_int)
+    this->cell_similarity = CellSimilarity::invalid_next_cell;
+
+  precomputed_triangulation = nullptr;
+  swapped_in_cell           = numbers::invalid_unsigned_int;
+  has_precomputed_data.clear();
+  precomputed_mapping_output.clear();
+  precomputed_finite_element_output.clear();
+}
+
+
+
 template <int dim, int spacedim>
 void
 FEValues<dim, spacedim>::do_reinit()
 {
+  if (precomputed_triangulation != nullptr)
+    {
+      // give the entry of the precomputed data that is currently in use
+      // back to the cache
+      if (swapped_in_cell != numbers::invalid_unsigned_int)
+        {
+          std::swap(this->mapping_output,
+                    precomputed_mapping_output[swapped_in_cell]);
+          std::swap(this->finite_element_output,
+                    precomputed_finite_element_output[swapped_in_cell]);
+          swapped_in_cell = numbers::invalid_unsigned_int;
+        }
+
+      const typename Triangulation<dim, spacedim>::cell_iterator cell =
+        this->present_cell;
+      if (&cell->get_triangulation() == precomputed_triangulation &&
+          cell->is_active() &&
+          has_precomputed_data[cell->active_cell_index()])
+        {
+          swapped_in_cell = cell->active_cell_index();
+          std::swap(this->mapping_output,
+                    precomputed_mapping_output[swapped_in_cell]);
+          std::swap(this->finite_element_output,
+                    precomputed_finite_element_output[swapped_in_cell]);
+
+          // the data computed on the previous cell is no longer in place,
+          // so it must not be reused on the next cell
+          this->cell_similarity = CellSimilarity::invalid_next_cell;
+          return;
+        }
+    }
+
   // first call the mapping and let it generate the data
   // specific to the mapping. also let it inspect the
   // cell similarity flag and, if necessary, update
@@ -4369,8 +4797,12 @@ template <int dim, int spacedim>
 std::size_t
 FEValues<dim, spacedim>::memory_consumption() const
 {
-  return (FEValuesBase<dim, spacedim>::memory_consumption() +
-          MemoryConsumption::memory_consumption(quadrature));
+  return (
+    FEValuesBase<dim, spacedim>::memory_consumption() +
+    MemoryConsumption::memory_consumption(quadrature) +
+    MemoryConsumption::memory_consumption(has_precomputed_data) +
+    MemoryConsumption::memory_consumption(precomputed_mapping_output) +
+    MemoryConsumption::memory_consumption(precomputed_finite_element_output));
 }
 
 
@@ -0,0 +1,96 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+
+#include <deal.II/fe/fe_values_batch.h>
+
+DEAL_II_NAMESPACE_OPEN
+
+
+template <int dim, typename Number>
+FEValuesBatch<dim, Number>::FEValuesBatch(const FiniteElement<dim, dim> &fe,
+                                          const Quadrature<dim> &quadrature)
+  : n_quadrature_points(quadrature.size())
+  , dofs_per_cell(fe.n_dofs_per_cell())
+  , fe(&fe, typeid(*this).name())
+  , weights(quadrature.get_weights())
+  , n_cells(0)
+  , reference_shape_values(dofs_per_cell, n_quadrature_points)
+  , reference_shape_gradients(dofs_per_cell, n_quadrature_points)
+  , vertex_gradients(GeometryInfo<dim>::vertices_per_cell, n_quadrature_points)
+  , shape_gradients(dofs_per_cell, n_quadrature_points)
+  , JxW_values(n_quadrature_points)
+{
+  AssertThrow(fe.is_primitive(),
+              ExcMessage("FEValuesBatch only supports primitive elements."));
+  AssertThrow(fe.reference_cell().is_hyper_cube(), ExcNotImplemented());
+
+  for (unsigned int q = 0; q < n_quadrature_points; ++q)
+    {
+      const Point<dim> &point = quadrature.point(q);
+      for (unsigned int i = 0; i < dofs_per_cell; ++i)
+        {
+          reference_shape_values(i, q) = fe.shape_value(i, point);
+          reference_shape_gradients(i, q) = fe.shape_grad(i, point);
+        }
+      for (unsigned int v = 0; v < GeometryInfo<dim>::vertices_per_cell; ++v)
+        vertex_gradients(v, q) =
+          GeometryInfo<dim>::d_linear_shape_function_gradient(point, v);
+    }
+}
+
+
+
+template <int dim, typename Number>
+void
+FEValuesBatch<dim, Number>::compute_geometry_and_gradients()
+{
+  for (unsigned int q = 0; q < n_quadrature_points; ++q)
+    {
+      // The Jacobian of the d-linear geometry, J_de = sum_v x_v,d dphi_v/de,
+      // for all cells of the batch at once
+      Tensor<2, dim, VectorizedArrayType> jacobian;
+      for (unsigned int v = 0; v < GeometryInfo<dim>::vertices_per_cell; ++v)
+        for (unsigned int d = 0; d < dim; ++d)
+          for (unsigned int e = 0; e < dim; ++e)
+            jacobian[d][e] += vertices[v][d] * vertex_gradients(v, q)[e];
+
+      const VectorizedArrayType determinant_jacobian = determinant(jacobian);
+      JxW_values[q] = determinant_jacobian * Number(weights[q]);
+
+      // The real-space gradients are J^{-T} times the reference gradients
+      const Tensor<2, dim, VectorizedArrayType> inverse_jacobian =
+        invert(jacobian);
+      for (unsigned int i = 0; i < dofs_per_cell; ++i)
+        {
+          const Tensor<1, dim, Number> &reference_gradient =
+            reference_shape_gradients(i, q);
+          Tensor<1, dim, VectorizedArrayType> &gradient =
+            shape_gradients(i, q);
+          for (unsigned int d = 0; d < dim; ++d)
+            {
+              gradient[d] = inverse_jacobian[0][d] * reference_gradient[0];
+              for (unsigned int e = 1; e < dim; ++e)
+                gradient[d] += inverse_jacobian[e][d] * reference_gradient[e];
+            }
+        }
+    }
+}
+
+
+// explicit instantiations
+#include "fe_values_batch.inst"
+
+DEAL_II_NAMESPACE_CLOSE
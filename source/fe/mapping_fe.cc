@@ -65,6 +65,7 @@ MappingFE<dim, spacedim>::InternalData::memory_consumption() const
     Mapping<dim, spacedim>::InternalDataBase::memory_consumption() +
     MemoryConsumption::memory_consumption(shape_values) +
     MemoryConsumption::memory_consumption(shape_derivatives) +
+    MemoryConsumption::memory_consumption(affine_shape_derivatives) +
     MemoryConsumption::memory_consumption(covariant) +
     MemoryConsumption::memory_consumption(contravariant) +
     MemoryConsumption::memory_consumption(unit_tangentials) +
@@ -129,6 +130,27 @@ MappingFE<dim, spacedim>::InternalData::initialize(
   // now also fill the various fields with their correct values
   compute_shape_function_values(q.get_points());
 
+  // the derivatives at the first support point give the Jacobian of cells
+  // that turn out to be affine, see fill_fe_values()
+  if (shape_derivatives.size() != 0)
+    {
+      const auto fe_poly =
+        dynamic_cast<const FE_Poly<dim, spacedim> *>(&this->fe);
+      Assert(fe_poly != nullptr, ExcNotImplemented());
+
+      std::vector<double>         values;
+      std::vector<Tensor<2, dim>> grad2;
+      std::vector<Tensor<3, dim>> grad3;
+      std::vector<Tensor<4, dim>> grad4;
+      affine_shape_derivatives.resize(n_shape_functions);
+      fe_poly->get_poly_space().evaluate(fe.get_unit_support_points()[0],
+                                         values,
+                                         affine_shape_derivatives,
+                                         grad2,
+                                         grad3,
+                                         grad4);
+    }
+
   // copy (projected) quadrature weights
   quadrature_weights = q.get_weights();
 }
@@ -267,6 +289,62 @@ namespace internal
   {
     namespace
     {
+      /**
+       * Check whether the mapping of the cell whose support points are
+       * stored in @p data is affine, i.e., whether all mapping support
+       * points are the images of the unit support points under the affine
+       * function defined by the first support point and the Jacobian at
+       * that point. Since the shape functions of the mapping reproduce
+       * linear functions, the mapping is affine on the whole cell in that
+       * case. If so, the constant Jacobian is returned in @p jacobian.
+       *
+       * For linear simplex elements, this is always the case, whereas
+       * wedges, pyramids, and hypercube cells are affine if they are
+       * straight-sided prisms, pyramids, and parallelepipeds, respectively.
+       */
+      template <int dim, int spacedim>
+      bool
+      is_affine_cell(
+        const typename dealii::MappingFE<dim, spacedim>::InternalData &data,
+        DerivativeForm<1, dim, spacedim> &jacobian)
+      {
+        if (data.affine_shape_derivatives.empty())
+          return false;
+
+        const std::vector<Point<dim>> &unit_points =
+          data.fe.get_unit_support_points();
+        const std::vector<Point<spacedim>> &points =
+          data.mapping_support_points;
+        AssertDimension(points.size(), data.affine_shape_derivatives.size());
+
+        jacobian = DerivativeForm<1, dim, spacedim>();
+        for (unsigned int k = 0; k < points.size(); ++k)
+          for (unsigned int i = 0; i < spacedim; ++i)
+            for (unsigned int j = 0; j < dim; ++j)
+              jacobian[i][j] +=
+                data.affine_shape_derivatives[k][j] * points[k][i];
+
+        // compare the squared deviations against the squared size of the
+        // Jacobian, which scales like the squared diameter of the cell
+        double tolerance = 0;
+        for (unsigned int i = 0; i < spacedim; ++i)
+          tolerance += jacobian[i].norm_square();
+        tolerance *= 1e-24;
+
+        for (unsigned int k = 1; k < points.size(); ++k)
+          {
+            const Tensor<1, spacedim> deviation =
+              points[k] - points[0] -
+              apply_transformation(jacobian, unit_points[k] - unit_points[0]);
+            if (deviation.norm_square() > tolerance)
+              return false;
+          }
+
+        return true;
+      }
+
+
+
       /**
        * Compute the locations of quadrature points on the object described by
        * the first argument (and the cell for which the mapping support points
@@ -1145,17 +1223,59 @@ MappingFE<dim, spacedim>::fill_fe_values(
   const CellSimilarity::Similarity computed_cell_similarity =
     (polynomial_degree == 1 ? cell_similarity : CellSimilarity::none);
 
-  internal::MappingFEImplementation::maybe_compute_q_points<dim, spacedim>(
-    QProjector<dim>::DataSetDescriptor::cell(),
-    data,
-    output_data.quadrature_points,
-    n_q_points);
+  // if the mapping is affine on this cell (e.g., a straight-sided simplex),
+  // the Jacobian is constant and the quadrature points are the images of an
+  // affine function, so we can avoid evaluating the sums over all shape
+  // functions of the mapping in each quadrature point
+  DerivativeForm<1, dim, spacedim> affine_jacobian;
+  const bool                       is_affine =
+    (computed_cell_similarity != CellSimilarity::translation) &&
+    internal::MappingFEImplementation::is_affine_cell<dim, spacedim>(
+      data, affine_jacobian);
+
+  if (is_affine)
+    {
+      const UpdateFlags update_flags = data.update_each;
 
-  internal::MappingFEImplementation::maybe_update_Jacobians<dim, spacedim>(
-    computed_cell_similarity,
-    QProjector<dim>::DataSetDescriptor::cell(),
-    data,
-    n_q_points);
+      if (update_flags & update_quadrature_points)
+        {
+          const Point<dim> &unit_origin = fe->get_unit_support_points()[0];
+          for (unsigned int point = 0; point < n_q_points; ++point)
+            output_data.quadrature_points[point] =
+              data.mapping_support_points[0] +
+              apply_transformation(affine_jacobian,
+                                   quadrature.point(point) - unit_origin);
+        }
+
+      if (update_flags & update_contravariant_transformation)
+        std::fill(data.contravariant.begin(),
+                  data.contravariant.begin() + n_q_points,
+                  affine_jacobian);
+
+      if (update_flags & update_covariant_transformation)
+        std::fill(data.covariant.begin(),
+                  data.covariant.begin() + n_q_points,
+                  affine_jacobian.covariant_form());
+
+      if (update_flags & update_volume_elements)
+        std::fill(data.volume_elements.begin(),
+                  data.volume_elements.begin() + n_q_points,
+                  affine_jacobian.determinant());
+    }
+  else
+    {
+      internal::MappingFEImplementation::maybe_compute_q_points<dim, spacedim>(
+        QProjector<dim>::DataSetDescriptor::cell(),
+        data,
+        output_data.quadrature_points,
+        n_q_points);
+
+      internal::MappingFEImplementation::maybe_update_Jacobians<dim, spacedim>(
+        computed_cell_similarity,
+        QProjector<dim>::DataSetDescriptor::cell(),
+        data,
+        n_q_points);
+    }
 
   internal::MappingFEImplementation::maybe_update_jacobian_grads<dim, spacedim>(
     computed_cell_similarity,
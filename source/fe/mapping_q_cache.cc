@@ -14,8 +14,8 @@
 // ---------------------------------------------------------------------
 
 #include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/utilities.h>
-#include <deal.II/base/work_stream.h>
 
 #include <deal.II/dofs/dof_tools.h>
 
@@ -163,23 +163,28 @@ MappingQCache<dim, spacedim>::initialize(
   for (unsigned int l = 0; l < triangulation.n_levels(); ++l)
     (*support_point_cache)[l].resize(triangulation.n_raw_cells(l));
 
-  WorkStream::run(
-    triangulation.begin(),
-    triangulation.end(),
-    [&](const typename Triangulation<dim, spacedim>::cell_iterator &cell,
-        void *,
-        void *) {
-      (*support_point_cache)[cell->level()][cell->index()] =
-        compute_points_on_cell(cell);
-      AssertDimension(
-        (*support_point_cache)[cell->level()][cell->index()].size(),
-        Utilities::pow(this->get_degree() + 1, dim));
-    },
-    /* copier */ std::function<void(void *)>(),
-    /* scratch_data */ nullptr,
-    /* copy_data */ nullptr,
-    2 * MultithreadInfo::n_threads(),
-    /* chunk_size = */ 1);
+  // Loop over the raw cells level by level rather than with WorkStream over
+  // cell iterators: WorkStream hands out one cell at a time through a
+  // sequential stage, which limits the scaling for large meshes where
+  // compute_points_on_cell() is cheap compared to the scheduling overhead.
+  for (unsigned int l = 0; l < triangulation.n_levels(); ++l)
+    parallel::apply_to_subranges(
+      0U,
+      triangulation.n_raw_cells(l),
+      [&](const unsigned int begin, const unsigned int end) {
+        for (unsigned int index = begin; index < end; ++index)
+          {
+            const typename Triangulation<dim, spacedim>::cell_iterator cell(
+              &triangulation, l, index);
+            if (cell->used() == false)
+              continue;
+
+            (*support_point_cache)[l][index] = compute_points_on_cell(cell);
+            AssertDimension((*support_point_cache)[l][index].size(),
+                            Utilities::pow(this->get_degree() + 1, dim));
+          }
+      },
+      /* grainsize = */ 16);
 
   uses_level_info = true;
 }
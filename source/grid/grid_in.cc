@@ -37,10 +37,12 @@
 
 #include <algorithm>
 #include <cctype>
+#include <cstdint>
 #include <fstream>
 #include <functional>
 #include <limits>
 #include <map>
+#include <unordered_map>
 
 #ifdef DEAL_II_WITH_ASSIMP
 #  include <assimp/Importer.hpp>  // C++ importer interface
@@ -606,6 +608,151 @@ GridIn<dim, spacedim>::read_vtu(std::istream &in)
 }
 
 
+template <int dim, int spacedim>
+void
+GridIn<dim, spacedim>::read_dealii_binary(std::istream &in)
+{
+  Assert(tria != nullptr, ExcNoTriangulationSelected());
+  AssertThrow(in.fail() == false, ExcIO());
+
+  // check the header. its layout is defined by GridOut::write_dealii_binary()
+  char magic[8];
+  in.read(magic, sizeof(magic));
+  AssertThrow(in.fail() == false &&
+                std::string(magic, sizeof(magic)) == "dealiibm",
+              ExcMessage("The input does not contain a mesh in the binary "
+                         "format written by GridOut::write_dealii_binary()."));
+
+  std::uint32_t header[5];
+  in.read(reinterpret_cast<char *>(header), sizeof(header));
+  AssertThrow(in.fail() == false, ExcIO());
+  AssertThrow(header[0] == 0x01020304,
+              ExcMessage("The binary mesh was written on a machine with a "
+                         "different byte order."));
+  AssertThrow(header[1] == 1,
+              ExcMessage("Unsupported version " + std::to_string(header[1]) +
+                         " of the binary mesh format."));
+  AssertThrow(header[2] == dim && header[3] == spacedim,
+              ExcMessage("The binary mesh was written for a triangulation "
+                         "of different dimension."));
+  AssertThrow(header[4] == sizeof(double), ExcNotImplemented());
+
+  // all arrays are stored as their size followed by their raw contents
+  const auto read_array = [&in](auto &array) {
+    std::uint64_t size = 0;
+    in.read(reinterpret_cast<char *>(&size), sizeof(size));
+    AssertThrow(in.fail() == false, ExcIO());
+    array.resize(size);
+    if (size > 0)
+      in.read(reinterpret_cast<char *>(array.data()),
+              size * sizeof(array[0]));
+    AssertThrow(in.fail() == false, ExcIO());
+  };
+
+  std::vector<double>        coordinates;
+  std::vector<std::uint8_t>  cell_n_vertices;
+  std::vector<std::uint32_t> cell_vertices;
+  std::vector<std::uint32_t> cell_material_ids;
+  std::vector<std::uint32_t> cell_manifold_ids;
+  read_array(coordinates);
+  read_array(cell_n_vertices);
+  read_array(cell_vertices);
+  read_array(cell_material_ids);
+  read_array(cell_manifold_ids);
+
+  AssertThrow(coordinates.size() % spacedim == 0, ExcIO());
+  std::vector<Point<spacedim>> vertices(coordinates.size() / spacedim);
+  for (unsigned int v = 0; v < vertices.size(); ++v)
+    for (unsigned int d = 0; d < spacedim; ++d)
+      vertices[v][d] = coordinates[v * spacedim + d];
+
+  AssertThrow(cell_material_ids.size() == cell_n_vertices.size() &&
+                cell_manifold_ids.size() == cell_n_vertices.size(),
+              ExcIO());
+  std::vector<CellData<dim>> cells(cell_n_vertices.size());
+  for (unsigned int c = 0, index = 0; c < cells.size(); ++c)
+    {
+      AssertThrow(index + cell_n_vertices[c] <= cell_vertices.size(),
+                  ExcIO());
+      cells[c].vertices.assign(cell_vertices.begin() + index,
+                               cell_vertices.begin() + index +
+                                 cell_n_vertices[c]);
+      index += cell_n_vertices[c];
+      cells[c].material_id = cell_material_ids[c];
+      cells[c].manifold_id = cell_manifold_ids[c];
+    }
+
+  // the faces and edges with non-default ids, first lines and then quads
+  SubCellData subcelldata;
+  for (unsigned int structdim = 1; structdim <= 2; ++structdim)
+    {
+      std::vector<std::uint8_t>  n_vertices;
+      std::vector<std::uint32_t> face_vertices;
+      std::vector<std::uint32_t> boundary_ids;
+      std::vector<std::uint32_t> manifold_ids;
+      read_array(n_vertices);
+      read_array(face_vertices);
+      read_array(boundary_ids);
+      read_array(manifold_ids);
+
+      AssertThrow(boundary_ids.size() == n_vertices.size() &&
+                    manifold_ids.size() == n_vertices.size(),
+                  ExcIO());
+      for (unsigned int f = 0, index = 0; f < n_vertices.size(); ++f)
+        {
+          AssertThrow(index + n_vertices[f] <= face_vertices.size(), ExcIO());
+          if (structdim == 1)
+            {
+              subcelldata.boundary_lines.emplace_back();
+              subcelldata.boundary_lines.back().vertices.assign(
+                face_vertices.begin() + index,
+                face_vertices.begin() + index + n_vertices[f]);
+              subcelldata.boundary_lines.back().boundary_id = boundary_ids[f];
+              subcelldata.boundary_lines.back().manifold_id = manifold_ids[f];
+            }
+          else
+            {
+              subcelldata.boundary_quads.emplace_back();
+              subcelldata.boundary_quads.back().vertices.assign(
+                face_vertices.begin() + index,
+                face_vertices.begin() + index + n_vertices[f]);
+              subcelldata.boundary_quads.back().boundary_id = boundary_ids[f];
+              subcelldata.boundary_quads.back().manifold_id = manifold_ids[f];
+            }
+          index += n_vertices[f];
+        }
+    }
+
+  // the refinement cases of the cells on all but the finest level
+  std::vector<std::uint64_t> n_cells_on_level;
+  std::vector<std::uint8_t>  refinement_cases;
+  read_array(n_cells_on_level);
+  read_array(refinement_cases);
+
+  tria->create_triangulation(vertices, cells, subcelldata);
+
+  auto refinement_case = refinement_cases.cbegin();
+  for (unsigned int level = 0; level < n_cells_on_level.size(); ++level)
+    {
+      AssertThrow(level < tria->n_levels() &&
+                    tria->n_cells(level) == n_cells_on_level[level] &&
+                    static_cast<std::size_t>(refinement_cases.cend() -
+                                             refinement_case) >=
+                      n_cells_on_level[level],
+                  ExcMessage("The refinement stored in the binary mesh "
+                             "could not be replayed."));
+      for (const auto &cell : tria->cell_iterators_on_level(level))
+        {
+          if (*refinement_case != RefinementCase<dim>::no_refinement)
+            cell->set_refine_flag(RefinementCase<dim>(*refinement_case));
+          ++refinement_case;
+        }
+      tria->execute_coarsening_and_refinement();
+    }
+}
+
+
+
 template <int dim, int spacedim>
 void
 GridIn<dim, spacedim>::read_unv(std::istream &in)
@@ -2199,10 +2346,11 @@ GridIn<dim, spacedim>::read_msh(std::istream &in)
   else
     in >> n_vertices;
   std::vector<Point<spacedim>> vertices(n_vertices);
-  // set up mapping between numbering
-  // in msh-file (nod) and in the
-  // vertices vector
-  std::map<int, int> vertex_indices;
+  // set up mapping between numbering in msh-file (nod) and in the vertices
+  // vector. This map is queried for every vertex of every element, so use a
+  // hash map sized for all vertices up front rather than a tree.
+  std::unordered_map<int, int> vertex_indices;
+  vertex_indices.reserve(n_vertices);
 
   {
     unsigned int global_vertex = 0;
@@ -2227,13 +2375,16 @@ GridIn<dim, spacedim>::read_msh(std::istream &in)
         std::vector<int> vertex_numbers;
         int              vertex_number;
         if (gmsh_file_format > 40)
-          for (unsigned long vertex_per_entity = 0;
-               vertex_per_entity < numNodes;
-               ++vertex_per_entity)
-            {
-              in >> vertex_number;
-              vertex_numbers.push_back(vertex_number);
-            }
+          {
+            vertex_numbers.reserve(numNodes);
+            for (unsigned long vertex_per_entity = 0;
+                 vertex_per_entity < numNodes;
+                 ++vertex_per_entity)
+              {
+                in >> vertex_number;
+                vertex_numbers.push_back(vertex_number);
+              }
+          }
 
         for (unsigned long vertex_per_entity = 0; vertex_per_entity < numNodes;
              ++vertex_per_entity, ++global_vertex)
@@ -2501,16 +2652,16 @@ GridIn<dim, spacedim>::read_msh(std::istream &in)
                 // transform from gmsh to consecutive numbering
                 for (unsigned int i = 0; i < vertices_per_cell; ++i)
                   {
-                    AssertThrow(
-                      vertex_indices.find(cells.back().vertices[i]) !=
-                        vertex_indices.end(),
-                      ExcInvalidVertexIndexGmsh(cell_per_entity,
-                                                elm_number,
-                                                cells.back().vertices[i]));
+                    const auto vertex_index =
+                      vertex_indices.find(cells.back().vertices[i]);
+                    AssertThrow(vertex_index != vertex_indices.end(),
+                                ExcInvalidVertexIndexGmsh(
+                                  cell_per_entity,
+                                  elm_number,
+                                  cells.back().vertices[i]));
 
                     // vertex with this index exists
-                    cells.back().vertices[i] =
-                      vertex_indices[cells.back().vertices[i]];
+                    cells.back().vertices[i] = vertex_index->second;
                   }
               }
             else if ((cell_type == 1) &&
@@ -2540,17 +2691,20 @@ GridIn<dim, spacedim>::read_msh(std::istream &in)
                 // consecutive numbering
                 for (unsigned int &vertex :
                      subcelldata.boundary_lines.back().vertices)
-                  if (vertex_indices.find(vertex) != vertex_indices.end())
-                    // vertex with this index exists
-                    vertex = vertex_indices[vertex];
-                  else
-                    {
-                      // no such vertex index
-                      AssertThrow(false,
-                                  ExcInvalidVertexIndex(cell_per_entity,
-                                                        vertex));
-                      vertex = numbers::invalid_unsigned_int;
-                    }
+                  {
+                    const auto vertex_index = vertex_indices.find(vertex);
+                    if (vertex_index != vertex_indices.end())
+                      // vertex with this index exists
+                      vertex = vertex_index->second;
+                    else
+                      {
+                        // no such vertex index
+                        AssertThrow(false,
+                                    ExcInvalidVertexIndex(cell_per_entity,
+                                                          vertex));
+                        vertex = numbers::invalid_unsigned_int;
+                      }
+                  }
               }
             else if ((cell_type == 2 || cell_type == 3) &&
                      (dim == 3)) // a triangle or a quad in 3d
@@ -2591,16 +2745,19 @@ GridIn<dim, spacedim>::read_msh(std::istream &in)
                 // consecutive numbering
                 for (unsigned int &vertex :
                      subcelldata.boundary_quads.back().vertices)
-                  if (vertex_indices.find(vertex) != vertex_indices.end())
-                    // vertex with this index exists
-                    vertex = vertex_indices[vertex];
-                  else
-                    {
-                      // no such vertex index
-                      Assert(false,
-                             ExcInvalidVertexIndex(cell_per_entity, vertex));
-                      vertex = numbers::invalid_unsigned_int;
-                    }
+                  {
+                    const auto vertex_index = vertex_indices.find(vertex);
+                    if (vertex_index != vertex_indices.end())
+                      // vertex with this index exists
+                      vertex = vertex_index->second;
+                    else
+                      {
+                        // no such vertex index
+                        Assert(false,
+                               ExcInvalidVertexIndex(cell_per_entity, vertex));
+                        vertex = numbers::invalid_unsigned_int;
+                      }
+                  }
               }
             else if (cell_type == 15)
               {
@@ -4089,6 +4246,12 @@ GridIn<dim, spacedim>::read(const std::string &filename, Format format)
     {
       read_exodusii(name);
     }
+  else if (format == dealii_binary ||
+           (format == Default && default_format == dealii_binary))
+    {
+      std::ifstream in(name.c_str(), std::ios::in | std::ios::binary);
+      read(in, format);
+    }
   else
     {
       std::ifstream in(name.c_str());
@@ -4122,6 +4285,10 @@ GridIn<dim, spacedim>::read(std::istream &in, Format format)
         read_vtu(in);
         return;
 
+      case dealii_binary:
+        read_dealii_binary(in);
+        return;
+
       case unv:
         read_unv(in);
         return;
@@ -4191,6 +4358,8 @@ GridIn<dim, spacedim>::default_suffix(const Format format)
         return ".xda";
       case tecplot:
         return ".dat";
+      case dealii_binary:
+        return ".dlb";
       default:
         Assert(false, ExcNotImplemented());
         return ".unknown_format";
@@ -4221,6 +4390,12 @@ GridIn<dim, spacedim>::parse_format(const std::string &format_name)
   if (format_name == "vtu")
     return vtu;
 
+  if (format_name == "dealii_binary")
+    return dealii_binary;
+
+  if (format_name == "dlb")
+    return dealii_binary;
+
   // This is also the typical extension of Abaqus input files.
   if (format_name == "inp")
     return ucd;
@@ -4260,7 +4435,8 @@ template <int dim, int spacedim>
 std::string
 GridIn<dim, spacedim>::get_format_names()
 {
-  return "dbmesh|exodusii|msh|unv|vtk|vtu|ucd|abaqus|xda|tecplot|assimp";
+  return "dbmesh|exodusii|msh|unv|vtk|vtu|ucd|abaqus|xda|tecplot|assimp|"
+         "dealii_binary";
 }
 
 
@@ -24,7 +24,9 @@
 
 #include <deal.II/fe/mapping.h>
 
+#include <deal.II/grid/filtered_iterator.h>
 #include <deal.II/grid/grid_out.h>
+#include <deal.II/grid/grid_tools.h>
 #include <deal.II/grid/tria.h>
 #include <deal.II/grid/tria_accessor.h>
 #include <deal.II/grid/tria_iterator.h>
@@ -39,6 +41,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <cstring>
 #include <ctime>
 #include <fstream>
@@ -582,6 +585,8 @@ GridOut::default_suffix(const OutputFormat output_format)
         return ".vtk";
       case vtu:
         return ".vtu";
+      case dealii_binary:
+        return ".dlb";
       default:
         Assert(false, ExcNotImplemented());
         return "";
@@ -634,6 +639,9 @@ GridOut::parse_output_format(const std::string &format_name)
   if (format_name == "vtu")
     return vtu;
 
+  if (format_name == "dealii_binary")
+    return dealii_binary;
+
   AssertThrow(false, ExcInvalidState());
   // return something weird
   return OutputFormat(-1);
@@ -644,7 +652,7 @@ GridOut::parse_output_format(const std::string &format_name)
 std::string
 GridOut::get_output_format_names()
 {
-  return "none|dx|gnuplot|eps|ucd|xfig|msh|svg|mathgl|vtk|vtu";
+  return "none|dx|gnuplot|eps|ucd|xfig|msh|svg|mathgl|vtk|vtu|dealii_binary";
 }
 
 
@@ -3167,6 +3175,36 @@ namespace
     return v;
   }
 
+
+
+
+  /**
+   * A class that provides the patches of a triangulation to the output
+   * functions of DataOutInterface.
+   */
+  template <int dim, int spacedim>
+  class TriangulationPatchWriter : public DataOutInterface<dim, spacedim>
+  {
+  public:
+    /**
+     * The patches of the cells to write.
+     */
+    std::vector<DataOutBase::Patch<dim, spacedim>> patches;
+
+  protected:
+    virtual const std::vector<DataOutBase::Patch<dim, spacedim>> &
+    get_patches() const override
+    {
+      return patches;
+    }
+
+    virtual std::vector<std::string>
+    get_dataset_names() const override
+    {
+      return triangulation_patch_data_names();
+    }
+  };
+
   /**
    * Return all boundary lines of non-internal faces in three dimension.
    */
@@ -3583,6 +3621,137 @@ GridOut::write_vtu(const Triangulation<dim, spacedim> &tria,
 
 
 
+template <int dim, int spacedim>
+void
+GridOut::write_vtu_in_parallel(const Triangulation<dim, spacedim> &tria,
+                               const std::string &filename) const
+{
+  Assert(vtu_flags.serialize_triangulation == false, ExcNotImplemented());
+
+  const IteratorFilters::LocallyOwnedCell locally_owned_cell;
+  FilteredIterator<typename Triangulation<dim, spacedim>::active_cell_iterator>
+    cell(locally_owned_cell);
+  cell.set_to_next_positive(tria.begin_active());
+
+  TriangulationPatchWriter<dim, spacedim> writer;
+  generate_triangulation_patches(
+    writer.patches,
+    cell,
+    typename Triangulation<dim, spacedim>::active_cell_iterator(tria.end()));
+
+  writer.set_flags(static_cast<const DataOutBase::VtkFlags &>(vtu_flags));
+  writer.write_vtu_in_parallel(filename, tria.get_communicator());
+}
+
+
+
+template <int dim, int spacedim>
+void
+GridOut::write_dealii_binary(const Triangulation<dim, spacedim> &tria,
+                             std::ostream &                      out) const
+{
+  AssertThrow(out.fail() == false, ExcIO());
+
+  // header: format name, byte order marker, version, dimensions and size of
+  // the floating point numbers. GridIn::read_dealii_binary() checks all of
+  // them before reading any of the arrays.
+  out.write("dealiibm", 8);
+  const std::uint32_t header[5] = {
+    0x01020304, 1, dim, spacedim, sizeof(double)};
+  out.write(reinterpret_cast<const char *>(header), sizeof(header));
+
+  // all arrays are stored as their size followed by their raw contents
+  const auto write_array = [&out](const auto &array) {
+    const std::uint64_t size = array.size();
+    out.write(reinterpret_cast<const char *>(&size), sizeof(size));
+    if (size > 0)
+      out.write(reinterpret_cast<const char *>(array.data()),
+                size * sizeof(array[0]));
+  };
+
+  const auto description = GridTools::get_coarse_mesh_description(tria);
+
+  {
+    const std::vector<Point<spacedim>> &vertices = std::get<0>(description);
+    std::vector<double>                 coordinates;
+    coordinates.reserve(vertices.size() * spacedim);
+    for (const Point<spacedim> &vertex : vertices)
+      for (unsigned int d = 0; d < spacedim; ++d)
+        coordinates.push_back(vertex[d]);
+    write_array(coordinates);
+  }
+
+  {
+    const std::vector<CellData<dim>> &cells = std::get<1>(description);
+    std::vector<std::uint8_t>         n_vertices;
+    std::vector<std::uint32_t>        cell_vertices;
+    std::vector<std::uint32_t>        material_ids;
+    std::vector<std::uint32_t>        manifold_ids;
+    n_vertices.reserve(cells.size());
+    material_ids.reserve(cells.size());
+    manifold_ids.reserve(cells.size());
+    for (const CellData<dim> &cell : cells)
+      {
+        n_vertices.push_back(cell.vertices.size());
+        cell_vertices.insert(cell_vertices.end(),
+                             cell.vertices.begin(),
+                             cell.vertices.end());
+        material_ids.push_back(cell.material_id);
+        manifold_ids.push_back(cell.manifold_id);
+      }
+    write_array(n_vertices);
+    write_array(cell_vertices);
+    write_array(material_ids);
+    write_array(manifold_ids);
+  }
+
+  // the lines and quads with non-default ids
+  const SubCellData &subcelldata = std::get<2>(description);
+  const auto         write_faces = [&](const auto &faces) {
+    std::vector<std::uint8_t>  n_vertices;
+    std::vector<std::uint32_t> face_vertices;
+    std::vector<std::uint32_t> boundary_ids;
+    std::vector<std::uint32_t> manifold_ids;
+    for (const auto &face : faces)
+      {
+        n_vertices.push_back(face.vertices.size());
+        face_vertices.insert(face_vertices.end(),
+                             face.vertices.begin(),
+                             face.vertices.end());
+        boundary_ids.push_back(face.boundary_id);
+        manifold_ids.push_back(face.manifold_id);
+      }
+    write_array(n_vertices);
+    write_array(face_vertices);
+    write_array(boundary_ids);
+    write_array(manifold_ids);
+  };
+  write_faces(subcelldata.boundary_lines);
+  write_faces(subcelldata.boundary_quads);
+
+  // the refinement cases of the cells on all but the finest level. in
+  // parallel, not all cells are known to this process, so the refinement
+  // could not be replayed
+  std::vector<std::uint64_t> n_cells_on_level;
+  std::vector<std::uint8_t>  refinement_cases;
+  if (dynamic_cast<const parallel::TriangulationBase<dim, spacedim> *>(
+        &tria) == nullptr)
+    for (unsigned int level = 0; level + 1 < tria.n_levels(); ++level)
+      {
+        n_cells_on_level.push_back(tria.n_cells(level));
+        for (const auto &cell : tria.cell_iterators_on_level(level))
+          refinement_cases.push_back(
+            static_cast<std::uint8_t>(cell->refinement_case()));
+      }
+  write_array(n_cells_on_level);
+  write_array(refinement_cases);
+
+  out << std::flush;
+  AssertThrow(out.fail() == false, ExcIO());
+}
+
+
+
 template <int dim, int spacedim>
 void
 GridOut::write_mesh_per_processor_as_vtu(
@@ -5157,6 +5326,10 @@ GridOut::write(const Triangulation<dim, spacedim> &tria,
       case vtu:
         write_vtu(tria, out);
         return;
+
+      case dealii_binary:
+        write_dealii_binary(tria, out);
+        return;
     }
 
   Assert(false, ExcInternalError());
@@ -13,10 +13,13 @@
 //
 // ---------------------------------------------------------------------
 
+#include <deal.II/arborx/bvh.h>
+
 #include <deal.II/base/floating_point_comparator.h>
 #include <deal.II/base/mpi.h>
 #include <deal.II/base/mpi.templates.h>
 #include <deal.II/base/mpi_consensus_algorithms.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/quadrature_lib.h>
 #include <deal.II/base/thread_management.h>
 
@@ -69,6 +72,7 @@ DEAL_II_ENABLE_EXTRA_DIAGNOSTICS
 #include <iostream>
 #include <limits>
 #include <list>
+#include <map>
 #include <numeric>
 #include <set>
 #include <tuple>
@@ -4211,8 +4215,80 @@ namespace GridTools
                                                    n_partitions);
         }
     }
+
+
+
+    /**
+     * Return the order in which p4est would traverse the coarse cells of
+     * the given triangulation, i.e., the indices of the coarse cells sorted
+     * hierarchically by their vertex connectivity.
+     */
+    template <int dim, int spacedim>
+    std::vector<types::global_dof_index>
+    get_coarse_cells_in_p4est_order(
+      const Triangulation<dim, spacedim> &triangulation)
+    {
+      // Duplicate the coarse cell reordoring
+      // as done in p4est
+      std::vector<types::global_dof_index>
+        coarse_cell_to_p4est_tree_permutation;
+
+      DynamicSparsityPattern cell_connectivity;
+      GridTools::get_vertex_connectivity_of_cells_on_level(triangulation,
+                                                           0,
+                                                           cell_connectivity);
+      coarse_cell_to_p4est_tree_permutation.resize(triangulation.n_cells(0));
+      SparsityTools::reorder_hierarchical(
+        cell_connectivity, coarse_cell_to_p4est_tree_permutation);
+
+      return Utilities::invert_permutation(
+        coarse_cell_to_p4est_tree_permutation);
+    }
+
+
+
+    /**
+     * recursive helper function for get_active_cells_in_zorder
+     */
+    template <int dim, int spacedim>
+    void
+    collect_active_cells_in_zorder_recursively(
+      const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+      std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>
+        &active_cells)
+    {
+      if (cell->is_active())
+        active_cells.emplace_back(cell);
+      else
+        for (unsigned int n = 0; n < cell->n_children(); ++n)
+          collect_active_cells_in_zorder_recursively<dim, spacedim>(
+            cell->child(n), active_cells);
+    }
   } // namespace internal
 
+
+
+  template <int dim, int spacedim>
+  std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>
+  get_active_cells_in_zorder(const Triangulation<dim, spacedim> &triangulation)
+  {
+    std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>
+      active_cells;
+    active_cells.reserve(triangulation.n_active_cells());
+
+    if (triangulation.n_levels() == 0)
+      return active_cells;
+
+    for (const auto coarse_cell_idx :
+         internal::get_coarse_cells_in_p4est_order(triangulation))
+      internal::collect_active_cells_in_zorder_recursively<dim, spacedim>(
+        typename Triangulation<dim, spacedim>::cell_iterator(
+          &triangulation, 0, coarse_cell_idx),
+        active_cells);
+
+    return active_cells;
+  }
+
   template <int dim, int spacedim>
   void
   partition_triangulation_zorder(const unsigned int            n_partitions,
@@ -4238,21 +4314,9 @@ namespace GridTools
         return;
       }
 
-    // Duplicate the coarse cell reordoring
-    // as done in p4est
-    std::vector<types::global_dof_index> coarse_cell_to_p4est_tree_permutation;
-    std::vector<types::global_dof_index> p4est_tree_to_coarse_cell_permutation;
-
-    DynamicSparsityPattern cell_connectivity;
-    GridTools::get_vertex_connectivity_of_cells_on_level(triangulation,
-                                                         0,
-                                                         cell_connectivity);
-    coarse_cell_to_p4est_tree_permutation.resize(triangulation.n_cells(0));
-    SparsityTools::reorder_hierarchical(cell_connectivity,
-                                        coarse_cell_to_p4est_tree_permutation);
-
-    p4est_tree_to_coarse_cell_permutation =
-      Utilities::invert_permutation(coarse_cell_to_p4est_tree_permutation);
+    const std::vector<types::global_dof_index>
+      p4est_tree_to_coarse_cell_permutation =
+        internal::get_coarse_cells_in_p4est_order(triangulation);
 
     unsigned int       current_proc_idx = 0;
     unsigned int       current_cell_idx = 0;
@@ -5749,13 +5813,41 @@ namespace GridTools
     // For the search we shall use the following tree
     const auto &b_tree = cache.get_cell_bounding_boxes_rtree();
 
-    // Now make a tree of indices for the points
+    // If deal.II is configured with ArborX and Kokkos has been initialized,
+    // find the points within the bounding boxes of all cells with a single
+    // batched query. The points within the box of the cell with active cell
+    // index i are then given by the entries arborx_offsets[i] to
+    // arborx_offsets[i+1] of arborx_indices.
+    bool             use_arborx = false;
+    std::vector<int> arborx_indices;
+    std::vector<int> arborx_offsets;
+#ifdef DEAL_II_WITH_ARBORX
+    if (Kokkos::is_initialized())
+      {
+        std::vector<BoundingBox<spacedim>> cell_boxes(
+          cache.get_triangulation().n_active_cells());
+        for (const auto &leaf : b_tree)
+          cell_boxes[leaf.second->active_cell_index()] = leaf.first;
+
+        ArborXWrappers::BVH bvh(points);
+        std::tie(arborx_indices, arborx_offsets) =
+          bvh.query(ArborXWrappers::BoundingBoxIntersectPredicate(cell_boxes));
+        use_arborx = true;
+      }
+#endif
+
+    // Otherwise, make a tree of indices for the points
     // [TODO] This would work better with pack_rtree_of_indices, but
     // windows does not like it. Build a tree with pairs of point and id
-    std::vector<std::pair<Point<spacedim>, unsigned int>> points_and_ids(np);
-    for (unsigned int i = 0; i < np; ++i)
-      points_and_ids[i] = std::make_pair(points[i], i);
-    const auto p_tree = pack_rtree(points_and_ids);
+    RTree<std::pair<Point<spacedim>, unsigned int>> p_tree;
+    if (use_arborx == false)
+      {
+        std::vector<std::pair<Point<spacedim>, unsigned int>> points_and_ids(
+          np);
+        for (unsigned int i = 0; i < np; ++i)
+          points_and_ids[i] = std::make_pair(points[i], i);
+        p_tree = pack_rtree(points_and_ids);
+      }
 
     // Keep track of all found points
     std::vector<bool> found_points(points.size(), false);
@@ -5766,6 +5858,12 @@ namespace GridTools
       return found_points[id.second];
     };
 
+    // Position of each cell in cells_out, to avoid a linear search through
+    // all cells found so far for each point
+    std::map<typename Triangulation<dim, spacedim>::active_cell_iterator,
+             unsigned int>
+      cell_positions;
+
     // check if the given cell was already in the vector of cells before. If so,
     // insert in the corresponding vectors the reference point and the id.
     // Otherwise append a new entry to all vectors.
@@ -5774,13 +5872,12 @@ namespace GridTools
         const typename Triangulation<dim, spacedim>::active_cell_iterator &cell,
         const Point<dim> &  ref_point,
         const unsigned int &id) {
-        const auto it = std::find(cells_out.rbegin(), cells_out.rend(), cell);
-        if (it != cells_out.rend())
+        const auto it =
+          cell_positions.insert(std::make_pair(cell, cells_out.size())).first;
+        if (it->second < cells_out.size())
           {
-            const auto cell_id =
-              (cells_out.size() - 1 - (it - cells_out.rbegin()));
-            qpoints_out[cell_id].emplace_back(ref_point);
-            maps_out[cell_id].emplace_back(id);
+            qpoints_out[it->second].emplace_back(ref_point);
+            maps_out[it->second].emplace_back(id);
           }
         else
           {
@@ -5790,27 +5887,86 @@ namespace GridTools
           }
       };
 
-    // Check all points within a given pair of box and cell
+    // Scratch arrays for the points in one box
+    std::vector<unsigned int>    box_point_ids;
+    std::vector<Point<spacedim>> box_real_points;
+    std::vector<Point<dim>>      box_unit_points;
+
+    // Check all points within a given pair of box and cell. All these points
+    // are first mapped to the unit cell of the cell of the box with a single
+    // call to Mapping::transform_points_real_to_unit_cell(), which is
+    // vectorized over the points for MappingQ. The points that lie clearly
+    // inside the cell are stored right away. Only the remaining ones, which
+    // lie in other cells or on the boundary of this cell, are searched for
+    // with find_active_cell_around_point().
     const auto check_all_points_within_box = [&](const auto &leaf) {
       const auto &box       = leaf.first;
       const auto &cell_hint = leaf.second;
 
-      for (const auto &point_and_id :
-           p_tree | bgi::adaptors::queried(!bgi::satisfies(already_found) &&
-                                           bgi::intersects(box)))
+      box_point_ids.clear();
+      box_real_points.clear();
+      if (use_arborx)
+        {
+          const unsigned int index = cell_hint->active_cell_index();
+          for (int i = arborx_offsets[index]; i < arborx_offsets[index + 1];
+               ++i)
+            if (found_points[arborx_indices[i]] == false)
+              {
+                box_point_ids.push_back(arborx_indices[i]);
+                box_real_points.push_back(points[arborx_indices[i]]);
+              }
+        }
+      else
+        for (const auto &point_and_id :
+             p_tree | bgi::adaptors::queried(!bgi::satisfies(already_found) &&
+                                             bgi::intersects(box)))
+          {
+            box_point_ids.push_back(point_and_id.second);
+            box_real_points.push_back(points[point_and_id.second]);
+          }
+
+      box_unit_points.resize(box_real_points.size());
+      if (cell_hint->is_artificial() == false)
+        parallel::apply_to_subranges(
+          0U,
+          static_cast<unsigned int>(box_real_points.size()),
+          [&](const unsigned int begin, const unsigned int end) {
+            mapping.transform_points_real_to_unit_cell(
+              cell_hint,
+              make_array_view(box_real_points.begin() + begin,
+                              box_real_points.begin() + end),
+              make_array_view(box_unit_points.begin() + begin,
+                              box_unit_points.begin() + end));
+          },
+          256);
+      else
+        for (auto &unit_point : box_unit_points)
+          unit_point[0] = std::numeric_limits<double>::infinity();
+
+      for (unsigned int i = 0; i < box_point_ids.size(); ++i)
         {
-          const auto id = point_and_id.second;
-          const auto cell_and_ref =
-            GridTools::find_active_cell_around_point(cache,
-                                                     points[id],
-                                                     cell_hint);
-          const auto &cell      = cell_and_ref.first;
-          const auto &ref_point = cell_and_ref.second;
-
-          if (cell.state() == IteratorState::valid)
-            store_cell_point_and_id(cell, ref_point, id);
+          const auto id = box_point_ids[i];
+
+          // points whose distance to the boundary of the unit cell is larger
+          // than the tolerance of find_active_cell_around_point() are inside
+          // this cell and no other
+          if (GeometryInfo<dim>::is_inside_unit_cell(box_unit_points[i],
+                                                     -1e-10))
+            store_cell_point_and_id(cell_hint, box_unit_points[i], id);
           else
-            missing_points_out.emplace_back(id);
+            {
+              const auto cell_and_ref =
+                GridTools::find_active_cell_around_point(cache,
+                                                         points[id],
+                                                         cell_hint);
+              const auto &cell      = cell_and_ref.first;
+              const auto &ref_point = cell_and_ref.second;
+
+              if (cell.state() == IteratorState::valid)
+                store_cell_point_and_id(cell, ref_point, id);
+              else
+                missing_points_out.emplace_back(id);
+            }
 
           // Don't look anymore for this point
           found_points[id] = true;
@@ -6157,18 +6313,106 @@ namespace GridTools
           {
             cell_hint = cache.get_triangulation().begin_active();
 
+            using CellAndReferencePosition =
+              std::pair<typename Triangulation<dim, spacedim>::
+                          active_cell_iterator,
+                        Point<dim>>;
+
+            // Points that lie well inside one of the locally owned cells
+            // need not go through the general search below, which looks at
+            // one point at a time. Group them by the first locally owned
+            // cell whose bounding box contains them and map each group to
+            // the unit cell with a single call to
+            // Mapping::transform_points_real_to_unit_cell(), which is
+            // vectorized over the points for MappingQ. The margin to the
+            // boundary of the unit cell is chosen large enough that such a
+            // point cannot be found in any other cell within the given
+            // tolerance. Marked vertices restrict the admissible cells, so
+            // this shortcut is only taken without them.
+            std::vector<CellAndReferencePosition> bulk_cells_and_positions(
+              request.size());
+            if (marked_vertices.size() == 0)
+              {
+                const auto &owned_cells_tree =
+                  cache.get_locally_owned_cell_bounding_boxes_rtree();
+
+                std::vector<std::pair<
+                  typename Triangulation<dim, spacedim>::active_cell_iterator,
+                  unsigned int>>
+                  candidates;
+                candidates.reserve(request.size());
+                for (unsigned int i = 0; i < request.size(); ++i)
+                  {
+                    const auto leaf = owned_cells_tree.qbegin(
+                      boost::geometry::index::intersects(request[i].second));
+                    if (leaf != owned_cells_tree.qend() &&
+                        leaf->second->reference_cell().is_hyper_cube())
+                      candidates.emplace_back(leaf->second, i);
+                  }
+                std::sort(candidates.begin(), candidates.end());
+
+                std::vector<unsigned int> group_starts;
+                for (unsigned int c = 0; c < candidates.size(); ++c)
+                  if (c == 0 || candidates[c].first != candidates[c - 1].first)
+                    group_starts.push_back(c);
+                group_starts.push_back(candidates.size());
+
+                const double margin = std::max(1e-4, 1e2 * tolerance);
+                const auto & mapping = cache.get_mapping();
+                parallel::apply_to_subranges(
+                  0U,
+                  static_cast<unsigned int>(group_starts.size() - 1),
+                  [&](const unsigned int begin, const unsigned int end) {
+                    std::vector<Point<spacedim>> real_points;
+                    std::vector<Point<dim>>      unit_points;
+                    for (unsigned int g = begin; g < end; ++g)
+                      {
+                        const auto &cell = candidates[group_starts[g]].first;
+                        real_points.clear();
+                        for (unsigned int c = group_starts[g];
+                             c < group_starts[g + 1];
+                             ++c)
+                          real_points.push_back(
+                            request[candidates[c].second].second);
+                        unit_points.resize(real_points.size());
+                        mapping.transform_points_real_to_unit_cell(
+                          cell,
+                          make_array_view(real_points),
+                          make_array_view(unit_points));
+
+                        for (unsigned int c = group_starts[g];
+                             c < group_starts[g + 1];
+                             ++c)
+                          {
+                            const Point<dim> &unit_point =
+                              unit_points[c - group_starts[g]];
+                            if (GeometryInfo<dim>::is_inside_unit_cell(
+                                  unit_point, -margin))
+                              bulk_cells_and_positions[candidates[c].second] =
+                                {cell, unit_point};
+                          }
+                      }
+                  },
+                  16);
+              }
+
             for (unsigned int i = 0; i < request.size(); ++i)
               {
                 const auto &index_and_point = request[i];
 
-                const auto cells_and_reference_positions =
-                  find_all_locally_owned_active_cells_around_point(
-                    cache,
-                    index_and_point.second,
-                    cell_hint,
-                    marked_vertices,
-                    tolerance,
-                    enforce_unique_mapping);
+                const std::vector<CellAndReferencePosition>
+                  cells_and_reference_positions =
+                    bulk_cells_and_positions[i].first.state() ==
+                        IteratorState::valid ?
+                      std::vector<CellAndReferencePosition>{
+                        bulk_cells_and_positions[i]} :
+                      find_all_locally_owned_active_cells_around_point(
+                        cache,
+                        index_and_point.second,
+                        cell_hint,
+                        marked_vertices,
+                        tolerance,
+                        enforce_unique_mapping);
 
                 for (const auto &cell_and_reference_position :
                      cells_and_reference_positions)
@@ -15,24 +15,96 @@
 
 #include <deal.II/base/bounding_box.h>
 #include <deal.II/base/mpi_stub.h>
+#include <deal.II/base/parallel.h>
+
+#include <deal.II/distributed/tria_base.h>
 
 #include <deal.II/grid/filtered_iterator.h>
 #include <deal.II/grid/grid_tools.h>
 #include <deal.II/grid/grid_tools_cache.h>
 
+#include <algorithm>
+
 DEAL_II_NAMESPACE_OPEN
 
 namespace GridTools
 {
+  namespace
+  {
+    /**
+     * Return pairs of the bounding boxes of the given @p cells, as computed
+     * by @p mapping, and the cells. The bounding boxes are computed in
+     * parallel, since Mapping::get_bounding_box() evaluates the mapping at
+     * all vertices and dominates the time needed to build the RTree objects
+     * of the cache for large meshes.
+     */
+    template <int dim, int spacedim>
+    std::vector<std::pair<
+      BoundingBox<spacedim>,
+      typename Triangulation<dim, spacedim>::active_cell_iterator>>
+    compute_cell_bounding_boxes(
+      const Mapping<dim, spacedim> &mapping,
+      const std::vector<
+        typename Triangulation<dim, spacedim>::active_cell_iterator> &cells)
+    {
+      std::vector<std::pair<
+        BoundingBox<spacedim>,
+        typename Triangulation<dim, spacedim>::active_cell_iterator>>
+        boxes(cells.size());
+      parallel::apply_to_subranges(
+        std::size_t(0),
+        cells.size(),
+        [&](const std::size_t begin, const std::size_t end) {
+          for (std::size_t i = begin; i < end; ++i)
+            boxes[i] =
+              std::make_pair(mapping.get_bounding_box(cells[i]), cells[i]);
+        },
+        256);
+      return boxes;
+    }
+  } // namespace
+
+
+
   template <int dim, int spacedim>
   Cache<dim, spacedim>::Cache(const Triangulation<dim, spacedim> &tria,
                               const Mapping<dim, spacedim> &      mapping)
     : update_flags(update_all)
     , tria(&tria)
     , mapping(&mapping)
+    , track_refinement(false)
   {
-    tria_signal =
-      tria.signals.any_change.connect([&]() { mark_for_update(update_all); });
+    tria_signal = tria.signals.any_change.connect([&]() {
+      if (track_refinement)
+        update_after_refinement();
+      else
+        mark_for_update(update_all);
+    });
+
+    // For parallel triangulations, refinement is accompanied by changes of
+    // the ownership of cells, so only track the cells changed by refinement
+    // for serial triangulations.
+    if (dynamic_cast<const parallel::TriangulationBase<dim, spacedim> *>(
+          &tria) == nullptr)
+      {
+        refinement_signals.push_back(tria.signals.pre_refinement.connect([&]() {
+          track_refinement = true;
+          coarsened_cells.clear();
+          vertices_of_coarsened_cells.clear();
+          refined_cells.clear();
+        }));
+        refinement_signals.push_back(
+          tria.signals.pre_coarsening_on_cell.connect(
+            [&](const typename Triangulation<dim, spacedim>::cell_iterator
+                  &cell) { pre_coarsening_on_cell(cell); }));
+        refinement_signals.push_back(
+          tria.signals.post_refinement_on_cell.connect(
+            [&](const typename Triangulation<dim, spacedim>::cell_iterator
+                  &cell) {
+              if (track_refinement)
+                refined_cells.push_back(cell);
+            }));
+      }
   }
 
   template <int dim, int spacedim>
@@ -42,6 +114,129 @@ namespace GridTools
     // is removed here.
     if (tria_signal.connected())
       tria_signal.disconnect();
+    for (auto &connection : refinement_signals)
+      if (connection.connected())
+        connection.disconnect();
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  Cache<dim, spacedim>::pre_coarsening_on_cell(
+    const typename Triangulation<dim, spacedim>::cell_iterator &cell)
+  {
+    if (track_refinement == false)
+      return;
+
+    coarsened_cells.push_back(cell);
+    for (const auto &child : cell->child_iterators())
+      for (const unsigned int v : child->vertex_indices())
+        vertices_of_coarsened_cells.push_back(child->vertex_index(v));
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  Cache<dim, spacedim>::update_after_refinement()
+  {
+    track_refinement = false;
+
+    mark_for_update(update_all & ~update_vertex_to_cell_map);
+
+    // if a larger part of the mesh has changed, rebuilding the map from
+    // scratch is cheaper than updating it
+    if ((coarsened_cells.size() + refined_cells.size()) *
+          GeometryInfo<dim>::max_children_per_cell >
+        tria->n_active_cells() / 10)
+      mark_for_update(update_vertex_to_cell_map);
+    else if (!(update_flags & update_vertex_to_cell_map))
+      update_vertex_to_cell_map_after_refinement();
+
+    coarsened_cells.clear();
+    vertices_of_coarsened_cells.clear();
+    refined_cells.clear();
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  Cache<dim, spacedim>::update_vertex_to_cell_map_after_refinement()
+  {
+    using cell_iterator = typename Triangulation<dim, spacedim>::cell_iterator;
+    using active_cell_iterator =
+      typename Triangulation<dim, spacedim>::active_cell_iterator;
+
+    // only the entries of the vertices of the children of the changed cells
+    // can be different
+    std::vector<unsigned int> affected_vertices = vertices_of_coarsened_cells;
+    for (const auto &cell : refined_cells)
+      for (const auto &child : cell->child_iterators())
+        for (const unsigned int v : child->vertex_indices())
+          affected_vertices.push_back(child->vertex_index(v));
+    std::sort(affected_vertices.begin(), affected_vertices.end());
+    affected_vertices.erase(std::unique(affected_vertices.begin(),
+                                        affected_vertices.end()),
+                            affected_vertices.end());
+
+    // the cells that can be adjacent to these vertices are the new active
+    // cells and the ones previously stored for these vertices. some of the
+    // latter may have been removed, possibly along with their level, so
+    // check that they still exist before looking at them
+    std::vector<cell_iterator> candidates = coarsened_cells;
+    for (const auto &cell : refined_cells)
+      for (const auto &child : cell->child_iterators())
+        candidates.push_back(child);
+    for (const unsigned int v : affected_vertices)
+      if (v < vertex_to_cells.size())
+        for (const auto &cell : vertex_to_cells[v])
+          if (static_cast<unsigned int>(cell->level()) < tria->n_levels() &&
+              static_cast<unsigned int>(cell->index()) <
+                tria->n_raw_cells(cell->level()) &&
+              cell->used() && cell->is_active())
+            candidates.emplace_back(cell);
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()),
+                     candidates.end());
+
+    vertex_to_cells.resize(tria->n_vertices());
+    for (const unsigned int v : affected_vertices)
+      vertex_to_cells[v].clear();
+
+    const auto add_entry = [&](const unsigned int          vertex,
+                               const active_cell_iterator &cell) {
+      if (std::binary_search(affected_vertices.begin(),
+                             affected_vertices.end(),
+                             vertex))
+        vertex_to_cells[vertex].insert(cell);
+    };
+
+    // add the entries in the same way as GridTools::vertex_to_cell_map(),
+    // but seen from the cell that is being added: a cell is adjacent to its
+    // own vertices, to the vertices of the finer neighbors on its refined
+    // faces, and, in 3d, to the midpoints of its refined edges
+    for (const auto &candidate : candidates)
+      if (candidate->is_active())
+        {
+          const active_cell_iterator cell(candidate);
+          for (const unsigned int v : cell->vertex_indices())
+            add_entry(cell->vertex_index(v), cell);
+
+          for (const unsigned int f : cell->face_indices())
+            if (cell->at_boundary(f) == false && cell->face(f)->has_children())
+              for (unsigned int c = 0; c < cell->face(f)->n_children(); ++c)
+                for (unsigned int v = 0;
+                     v < cell->face(f)->child(c)->n_vertices();
+                     ++v)
+                  add_entry(cell->face(f)->child(c)->vertex_index(v), cell);
+
+          if (dim == 3)
+            for (unsigned int l = 0; l < cell->n_lines(); ++l)
+              if (cell->line(l)->has_children())
+                add_entry(cell->line(l)->child(0)->vertex_index(1), cell);
+        }
   }
 
 
@@ -127,15 +322,14 @@ namespace GridTools
   {
     if (update_flags & update_cell_bounding_boxes_rtree)
       {
-        std::vector<std::pair<
-          BoundingBox<spacedim>,
-          typename Triangulation<dim, spacedim>::active_cell_iterator>>
-                     boxes(tria->n_active_cells());
-        unsigned int i = 0;
+        std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>
+          cells;
+        cells.reserve(tria->n_active_cells());
         for (const auto &cell : tria->active_cell_iterators())
-          boxes[i++] = std::make_pair(mapping->get_bounding_box(cell), cell);
+          cells.push_back(cell);
 
-        cell_bounding_boxes_rtree = pack_rtree(boxes);
+        cell_bounding_boxes_rtree =
+          pack_rtree(compute_cell_bounding_boxes(*mapping, cells));
         update_flags = update_flags & ~update_cell_bounding_boxes_rtree;
       }
     return cell_bounding_boxes_rtree;
@@ -151,16 +345,15 @@ namespace GridTools
   {
     if (update_flags & update_locally_owned_cell_bounding_boxes_rtree)
       {
-        std::vector<std::pair<
-          BoundingBox<spacedim>,
-          typename Triangulation<dim, spacedim>::active_cell_iterator>>
-          boxes;
-        boxes.reserve(tria->n_active_cells());
+        std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>
+          cells;
+        cells.reserve(tria->n_active_cells());
         for (const auto &cell : tria->active_cell_iterators() |
                                   IteratorFilters::LocallyOwnedCell())
-          boxes.emplace_back(mapping->get_bounding_box(cell), cell);
+          cells.push_back(cell);
 
-        locally_owned_cell_bounding_boxes_rtree = pack_rtree(boxes);
+        locally_owned_cell_bounding_boxes_rtree =
+          pack_rtree(compute_cell_bounding_boxes(*mapping, cells));
         update_flags =
           update_flags & ~update_locally_owned_cell_bounding_boxes_rtree;
       }
@@ -13,7 +13,9 @@
 //
 // ---------------------------------------------------------------------
 
+#include <deal.II/base/bounding_box.h>
 #include <deal.II/base/geometry_info.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/point.h>
 #include <deal.II/base/tensor.h>
 
@@ -36,6 +38,8 @@
 
 #include <deal.II/lac/full_matrix.h>
 
+#include <deal.II/numerics/rtree.h>
+
 #include <algorithm>
 #include <array>
 #include <cmath>
@@ -2019,7 +2023,6 @@ namespace GridTools
     const FullMatrix<double> &matrix)
   {
     static const int space_dim = CellIterator::AccessorType::space_dimension;
-    (void)space_dim;
     AssertIndexRange(direction, space_dim);
 
 #ifdef DEBUG
@@ -2045,37 +2048,121 @@ namespace GridTools
 
     unsigned int n_matches = 0;
 
-    // Match with a complexity of O(n^2). This could be improved...
-    std::bitset<3> orientation;
     using PairIterator =
       typename std::set<std::pair<CellIterator, unsigned int>>::const_iterator;
-    for (PairIterator it1 = pairs1.begin(); it1 != pairs1.end(); ++it1)
-      {
-        for (PairIterator it2 = pairs2.begin(); it2 != pairs2.end(); ++it2)
+    const std::vector<PairIterator> faces1 = [&pairs1]() {
+      std::vector<PairIterator> faces;
+      for (PairIterator it = pairs1.begin(); it != pairs1.end(); ++it)
+        faces.push_back(it);
+      return faces;
+    }();
+    const std::vector<PairIterator> faces2 = [&pairs2]() {
+      std::vector<PairIterator> faces;
+      for (PairIterator it = pairs2.begin(); it != pairs2.end(); ++it)
+        faces.push_back(it);
+      return faces;
+    }();
+
+    // Two faces can only match if the centers of their vertices, with the
+    // one of the first face transformed by matrix and offset, coincide in
+    // all components other than the one in the given direction. Find the
+    // candidates through an rtree of these projected centers instead of
+    // comparing all pairs of faces:
+    const auto projected_center =
+      [&](const PairIterator &it,
+          const bool          transform) -> Point<space_dim> {
+      const Point<space_dim> center = it->first->face(it->second)->center();
+
+      Point<space_dim> point;
+      if (transform && matrix.m() == space_dim)
+        for (unsigned int i = 0; i < space_dim; ++i)
+          for (unsigned int j = 0; j < space_dim; ++j)
+            point(i) += matrix(i, j) * center(j);
+      else
+        point = center;
+      if (transform)
+        point += offset;
+      point(direction) = 0.;
+      return point;
+    };
+
+    std::vector<Point<space_dim>> centers2;
+    centers2.reserve(faces2.size());
+    for (const auto &it2 : faces2)
+      centers2.push_back(projected_center(it2, false));
+    const auto tree2 = pack_rtree_of_indices(centers2);
+
+    // orthogonal_equality() compares the vertices with a tolerance of 1e-10
+    // in each component, so the centers of matching faces are closer than
+    // that. Query with a larger tolerance to be safe against round-off:
+    const double tolerance = 1e-9;
+
+    // Collect the matching faces of the second set for each face of the
+    // first one in parallel, sorted by their position in pairs2...
+    std::vector<std::vector<std::pair<unsigned int, std::bitset<3>>>>
+      candidates(faces1.size());
+    parallel::apply_to_subranges(
+      0U,
+      static_cast<unsigned int>(faces1.size()),
+      [&](const unsigned int begin, const unsigned int end) {
+        std::vector<unsigned int> indices;
+        std::bitset<3>            orientation;
+        for (unsigned int i = begin; i < end; ++i)
           {
-            const CellIterator cell1     = it1->first;
-            const CellIterator cell2     = it2->first;
-            const unsigned int face_idx1 = it1->second;
-            const unsigned int face_idx2 = it2->second;
-            if (GridTools::orthogonal_equality(orientation,
-                                               cell1->face(face_idx1),
-                                               cell2->face(face_idx2),
-                                               direction,
-                                               offset,
-                                               matrix))
+            const Point<space_dim> center = projected_center(faces1[i], true);
+            Point<space_dim>       lower = center, upper = center;
+            for (unsigned int d = 0; d < space_dim; ++d)
               {
-                // We have a match, so insert the matching pairs and
-                // remove the matched cell in pairs2 to speed up the
-                // matching:
-                const PeriodicFacePair<CellIterator> matched_face = {
-                  {cell1, cell2}, {face_idx1, face_idx2}, orientation, matrix};
-                matched_pairs.push_back(matched_face);
-                pairs2.erase(it2);
-                ++n_matches;
-                break;
+                lower(d) -= tolerance;
+                upper(d) += tolerance;
               }
+
+            indices.clear();
+            tree2.query(boost::geometry::index::intersects(
+                          BoundingBox<space_dim>(std::make_pair(lower, upper))),
+                        std::back_inserter(indices));
+            std::sort(indices.begin(), indices.end());
+
+            const CellIterator cell1     = faces1[i]->first;
+            const unsigned int face_idx1 = faces1[i]->second;
+            for (const unsigned int j : indices)
+              if (GridTools::orthogonal_equality(orientation,
+                                                 cell1->face(face_idx1),
+                                                 faces2[j]->first->face(
+                                                   faces2[j]->second),
+                                                 direction,
+                                                 offset,
+                                                 matrix))
+                candidates[i].emplace_back(j, orientation);
           }
-      }
+      },
+      128);
+
+    // ...and then pick the first one that has not been matched yet, which
+    // gives the same result as comparing the faces in the order of the two
+    // sets:
+    std::vector<bool> matched(faces2.size(), false);
+    for (unsigned int i = 0; i < faces1.size(); ++i)
+      for (const auto &candidate : candidates[i])
+        if (matched[candidate.first] == false)
+          {
+            const CellIterator cell1     = faces1[i]->first;
+            const CellIterator cell2     = faces2[candidate.first]->first;
+            const unsigned int face_idx1 = faces1[i]->second;
+            const unsigned int face_idx2 = faces2[candidate.first]->second;
+
+            const PeriodicFacePair<CellIterator> matched_face = {
+              {cell1, cell2}, {face_idx1, face_idx2}, candidate.second, matrix};
+            matched_pairs.push_back(matched_face);
+            matched[candidate.first] = true;
+            ++n_matches;
+            break;
+          }
+
+    // remove the matched cells from pairs2
+    for (unsigned int j = 0; j < faces2.size(); ++j)
+      if (matched[j])
+        pairs2.erase(faces2[j]);
 
     // Assure that all faces are matched if not
     // parallel::fullydistributed::Triangulation is used. This is related to the
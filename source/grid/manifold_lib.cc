@@ -1115,6 +1115,70 @@ CylindricalManifold<dim, spacedim>::get_new_point(
 
 
 
+template <int dim, int spacedim>
+void
+CylindricalManifold<dim, spacedim>::get_new_points(
+  const ArrayView<const Point<spacedim>> &surrounding_points,
+  const Table<2, double> &                weights,
+  ArrayView<Point<spacedim>>              new_points) const
+{
+  Assert(spacedim == 3,
+         ExcMessage("CylindricalManifold can only be used for spacedim==3!"));
+  AssertDimension(surrounding_points.size(), weights.size(1));
+  AssertDimension(new_points.size(), weights.size(0));
+
+  // First compute the points whose average in space lies on the axis, see
+  // get_new_point(), and collect the remaining ones.
+  boost::container::small_vector<unsigned int, 100> chart_rows;
+  for (unsigned int row = 0; row < weights.size(0); ++row)
+    {
+      Point<spacedim> middle;
+      double          average_length = 0.;
+      for (unsigned int i = 0; i < surrounding_points.size(); ++i)
+        {
+          middle += surrounding_points[i] * weights[row][i];
+          average_length += surrounding_points[i].square() * weights[row][i];
+        }
+      middle -= point_on_axis;
+      const double lambda = middle * direction;
+
+      if ((middle - direction * lambda).square() < tolerance * average_length)
+        new_points[row] = point_on_axis + direction * lambda;
+      else
+        chart_rows.push_back(row);
+    }
+
+  if (chart_rows.empty())
+    return;
+
+  // For all other points, using the ChartManifold should yield valid
+  // results.
+  if (chart_rows.size() == weights.size(0))
+    {
+      ChartManifold<dim, spacedim, 3>::get_new_points(surrounding_points,
+                                                      weights,
+                                                      new_points);
+      return;
+    }
+
+  Table<2, double> chart_weights(chart_rows.size(), weights.size(1));
+  for (unsigned int row = 0; row < chart_rows.size(); ++row)
+    for (unsigned int i = 0; i < weights.size(1); ++i)
+      chart_weights[row][i] = weights[chart_rows[row]][i];
+
+  boost::container::small_vector<Point<spacedim>, 100> chart_new_points(
+    chart_rows.size());
+  ChartManifold<dim, spacedim, 3>::get_new_points(
+    surrounding_points,
+    chart_weights,
+    make_array_view(chart_new_points.begin(), chart_new_points.end()));
+
+  for (unsigned int row = 0; row < chart_rows.size(); ++row)
+    new_points[chart_rows[row]] = chart_new_points[row];
+}
+
+
+
 template <int dim, int spacedim>
 Point<3>
 CylindricalManifold<dim, spacedim>::pull_back(
@@ -17,6 +17,7 @@
 #include <deal.II/base/geometry_info.h>
 #include <deal.II/base/memory_consumption.h>
 #include <deal.II/base/thread_management.h>
+#include <deal.II/base/tracing.h>
 
 #include <deal.II/grid/connectivity.h>
 #include <deal.II/grid/grid_tools.h>
@@ -1386,8 +1387,12 @@ namespace internal
               tria_objects.boundary_or_material_id.reserve(new_size);
               tria_objects.boundary_or_material_id.resize(new_size);
 
-              tria_objects.user_data.reserve(new_size);
-              tria_objects.user_data.resize(new_size);
+              // the user data is only allocated once it is used
+              if (tria_objects.user_data.size() > 0)
+                {
+                  tria_objects.user_data.reserve(new_size);
+                  tria_objects.user_data.resize(new_size);
+                }
 
               tria_objects.manifold_id.reserve(new_size);
               tria_objects.manifold_id.insert(tria_objects.manifold_id.end(),
@@ -1453,8 +1458,12 @@ namespace internal
                                                 tria_objects.manifold_id.size(),
                                               numbers::flat_manifold_id);
 
-              tria_objects.user_data.reserve(new_size);
-              tria_objects.user_data.resize(new_size);
+              // the user data is only allocated once it is used
+              if (tria_objects.user_data.size() > 0)
+                {
+                  tria_objects.user_data.reserve(new_size);
+                  tria_objects.user_data.resize(new_size);
+                }
 
               tria_objects.refinement_cases.reserve(new_size);
               tria_objects.refinement_cases.insert(
@@ -1489,7 +1498,8 @@ namespace internal
       Assert(tria_object.n_objects() == tria_object.manifold_id.size(),
              ExcMemoryInexact(tria_object.n_objects(),
                               tria_object.manifold_id.size()));
-      Assert(tria_object.n_objects() == tria_object.user_data.size(),
+      Assert(tria_object.user_data.size() == 0 ||
+               tria_object.n_objects() == tria_object.user_data.size(),
              ExcMemoryInexact(tria_object.n_objects(),
                               tria_object.user_data.size()));
 
@@ -2674,7 +2684,7 @@ namespace internal
             BoundaryOrMaterialId());
         obj.manifold_id.assign(size, -1);
         obj.user_flags.assign(size, false);
-        obj.user_data.resize(size);
+        obj.user_data.clear();
 
         if (structdim > 1) // TODO: why?
           obj.refinement_cases.assign(size, 0);
@@ -14487,6 +14497,9 @@ template <int dim, int spacedim>
 void
 Triangulation<dim, spacedim>::execute_coarsening_and_refinement()
 {
+  DEAL_II_TRACE_SCOPE("Triangulation::execute_coarsening_and_refinement",
+                      "grid");
+
   // Call our version of prepare_coarsening_and_refinement() even if a derived
   // class like parallel::distributed::Triangulation overrides it. Their
   // function will be called in their execute_coarsening_and_refinement()
@@ -28,6 +28,11 @@
 #include <deal.II/grid/tria.h>
 #include <deal.II/grid/tria_description.h>
 
+#include <algorithm>
+#include <map>
+#include <set>
+#include <tuple>
+
 DEAL_II_NAMESPACE_OPEN
 
 
@@ -1089,6 +1094,578 @@ namespace TriangulationDescription
                                         settings);
     }
 
+
+
+    namespace
+    {
+      /**
+       * The coarse cells a process sends to another process as part of the
+       * ghost layer of the latter in
+       * create_description_from_partitioned_cells().
+       */
+      template <int dim, int spacedim>
+      struct GhostCellPackage
+      {
+        /**
+         * Serialization function for packing and unpacking the content of this
+         * class.
+         */
+        template <class Archive>
+        void
+        serialize(Archive &ar, const unsigned int /*version*/)
+        {
+          ar &cells;
+          ar &coarse_cell_ids;
+          ar &cell_infos;
+          ar &vertex_indices;
+          ar &vertices;
+        }
+
+        /**
+         * The cells, with vertex indices referring to the entries of
+         * @p vertex_indices and @p vertices.
+         */
+        std::vector<dealii::CellData<dim>> cells;
+
+        /**
+         * The coarse-cell id of each cell.
+         */
+        std::vector<types::coarse_cell_id> coarse_cell_ids;
+
+        /**
+         * The CellData of each cell.
+         */
+        std::vector<CellData<dim>> cell_infos;
+
+        /**
+         * The global indices of the vertices of the cells.
+         */
+        std::vector<types::global_vertex_index> vertex_indices;
+
+        /**
+         * The coordinates of the vertices of the cells.
+         */
+        std::vector<Point<spacedim>> vertices;
+      };
+    } // namespace
+
+
+
+    template <int dim, int spacedim>
+    Description<dim, spacedim>
+    create_description_from_partitioned_cells(
+      const std::vector<Point<spacedim>> &           vertices,
+      const std::vector<types::global_vertex_index> &global_vertex_indices,
+      const std::vector<dealii::CellData<dim>> &     cells,
+      const std::vector<types::coarse_cell_id> &     coarse_cell_ids,
+      const SubCellData &                            subcell_data,
+      const MPI_Comm &                               comm,
+      const typename Triangulation<dim, spacedim>::MeshSmoothing smoothing,
+      const TriangulationDescription::Settings                   settings)
+    {
+      AssertDimension(vertices.size(), global_vertex_indices.size());
+      AssertDimension(cells.size(), coarse_cell_ids.size());
+      Assert(subcell_data.check_consistency(dim),
+             ExcMessage("The SubCellData object contains entries that are "
+                        "not used in this dimension."));
+
+      const unsigned int n_procs = dealii::Utilities::MPI::n_mpi_processes(comm);
+      const unsigned int my_rank = dealii::Utilities::MPI::this_mpi_process(comm);
+
+      // faces are identified by the sorted global indices of their vertices
+      using FaceKey = std::vector<types::global_vertex_index>;
+
+      const auto get_face_key = [&](const dealii::CellData<dim> &cell,
+                                    const ReferenceCell &reference_cell,
+                                    const unsigned int   face) {
+        FaceKey key;
+        for (unsigned int v = 0;
+             v < reference_cell.face_reference_cell(face).n_vertices();
+             ++v)
+          key.push_back(
+            global_vertex_indices[cell.vertices[reference_cell
+                                                  .face_to_cell_vertices(
+                                                    face, v, 1)]]);
+        std::sort(key.begin(), key.end());
+        return key;
+      };
+
+      // 1) faces that are not shared by two local cells are on the surface of
+      //    the local part of the mesh, and so are all vertices this process
+      //    shares with other processes
+      std::map<FaceKey, unsigned int> face_count;
+      for (const auto &cell : cells)
+        {
+          const auto reference_cell =
+            ReferenceCell::n_vertices_to_type(dim, cell.vertices.size());
+          for (const auto face : reference_cell.face_indices())
+            ++face_count[get_face_key(cell, reference_cell, face)];
+        }
+
+      std::vector<types::global_vertex_index> surface_vertices;
+      for (const auto &face : face_count)
+        if (face.second == 1)
+          surface_vertices.insert(surface_vertices.end(),
+                                  face.first.begin(),
+                                  face.first.end());
+      std::sort(surface_vertices.begin(), surface_vertices.end());
+      surface_vertices.erase(std::unique(surface_vertices.begin(),
+                                         surface_vertices.end()),
+                             surface_vertices.end());
+      face_count.clear();
+
+      // 2) boundary and manifold ids of the faces
+      std::map<FaceKey, std::pair<types::boundary_id, types::manifold_id>>
+                 face_ids;
+      const auto add_face_ids = [&](const auto &faces) {
+        for (const auto &face : faces)
+          {
+            FaceKey key;
+            for (const auto v : face.vertices)
+              key.push_back(global_vertex_indices[v]);
+            std::sort(key.begin(), key.end());
+            face_ids[key] = {face.boundary_id, face.manifold_id};
+          }
+      };
+      if (dim == 2)
+        add_face_ids(subcell_data.boundary_lines);
+      else if (dim == 3)
+        add_face_ids(subcell_data.boundary_quads);
+
+      // 3) register the surface vertices at the process determined by their
+      //    global index, which thus collects all processes sharing a vertex.
+      //    messages to this process are handled directly.
+      std::map<unsigned int, std::vector<types::global_vertex_index>>
+        vertices_per_dictionary;
+      for (const auto v : surface_vertices)
+        vertices_per_dictionary[v % n_procs].push_back(v);
+
+      std::vector<unsigned int> dictionary_targets;
+      for (const auto &entry : vertices_per_dictionary)
+        if (entry.first != my_rank)
+          dictionary_targets.push_back(entry.first);
+
+      std::map<types::global_vertex_index, std::vector<unsigned int>>
+        vertex_to_ranks;
+
+      const auto create_vertex_request = [&](const unsigned int other_rank) {
+        return vertices_per_dictionary[other_rank];
+      };
+
+      const auto register_vertices =
+        [&](const unsigned int                             other_rank,
+            const std::vector<types::global_vertex_index> &request) {
+          for (const auto v : request)
+            vertex_to_ranks[v].push_back(other_rank);
+        };
+
+      register_vertices(my_rank, vertices_per_dictionary[my_rank]);
+      dealii::Utilities::MPI::ConsensusAlgorithms::selector<
+        std::vector<types::global_vertex_index>>(dictionary_targets,
+                                                 create_vertex_request,
+                                                 register_vertices,
+                                                 comm);
+
+      // 4) ask the dictionary processes for the other processes sharing the
+      //    surface vertices. the answer lists for each vertex of the request
+      //    the number of these processes followed by their ranks
+      std::map<types::global_vertex_index, std::vector<unsigned int>>
+        vertex_to_neighbors;
+
+      const auto answer_vertex_request =
+        [&](const unsigned int                             other_rank,
+            const std::vector<types::global_vertex_index> &request) {
+          std::vector<unsigned int> answer;
+          for (const auto v : request)
+            {
+              const auto &ranks = vertex_to_ranks[v];
+              answer.push_back(ranks.size() - 1);
+              for (const auto rank : ranks)
+                if (rank != other_rank)
+                  answer.push_back(rank);
+            }
+          return answer;
+        };
+
+      const auto process_vertex_answer =
+        [&](const unsigned int other_rank,
+            const std::vector<unsigned int> &answer) {
+          unsigned int counter = 0;
+          for (const auto v : vertices_per_dictionary[other_rank])
+            {
+              const unsigned int n_neighbors = answer[counter++];
+              for (unsigned int i = 0; i < n_neighbors; ++i)
+                vertex_to_neighbors[v].push_back(answer[counter++]);
+            }
+        };
+
+      process_vertex_answer(
+        my_rank,
+        answer_vertex_request(my_rank, vertices_per_dictionary[my_rank]));
+      dealii::Utilities::MPI::ConsensusAlgorithms::selector<
+        std::vector<types::global_vertex_index>,
+        std::vector<unsigned int>>(dictionary_targets,
+                                   create_vertex_request,
+                                   answer_vertex_request,
+                                   process_vertex_answer,
+                                   comm);
+      vertex_to_ranks.clear();
+      vertices_per_dictionary.clear();
+
+      // 5) send the cells adjacent to a shared vertex to the processes
+      //    sharing it
+      const auto create_cell_info = [&](const unsigned int c) {
+        const auto &cell = cells[c];
+        const auto  reference_cell =
+          ReferenceCell::n_vertices_to_type(dim, cell.vertices.size());
+
+        CellData<dim> cell_info;
+        cell_info.id = CellId(coarse_cell_ids[c], std::vector<std::uint8_t>())
+                         .template to_binary<dim>();
+        cell_info.subdomain_id       = my_rank;
+        cell_info.level_subdomain_id = my_rank;
+        cell_info.manifold_id        = cell.manifold_id;
+        std::fill(cell_info.manifold_line_ids.begin(),
+                  cell_info.manifold_line_ids.end(),
+                  numbers::flat_manifold_id);
+        std::fill(cell_info.manifold_quad_ids.begin(),
+                  cell_info.manifold_quad_ids.end(),
+                  numbers::flat_manifold_id);
+
+        for (const auto face : reference_cell.face_indices())
+          {
+            const auto ids =
+              face_ids.find(get_face_key(cell, reference_cell, face));
+            if (ids == face_ids.end())
+              continue;
+
+            cell_info.boundary_ids.emplace_back(face, ids->second.first);
+            if (dim == 2)
+              cell_info.manifold_line_ids[face] = ids->second.second;
+            else if (dim == 3)
+              cell_info.manifold_quad_ids[face] = ids->second.second;
+          }
+
+        return cell_info;
+      };
+
+      std::map<unsigned int, std::vector<unsigned int>> cells_per_neighbor;
+      for (unsigned int c = 0; c < cells.size(); ++c)
+        {
+          std::set<unsigned int> neighbors;
+          for (const auto v : cells[c].vertices)
+            {
+              const auto entry =
+                vertex_to_neighbors.find(global_vertex_indices[v]);
+              if (entry != vertex_to_neighbors.end())
+                neighbors.insert(entry->second.begin(), entry->second.end());
+            }
+          for (const auto rank : neighbors)
+            cells_per_neighbor[rank].push_back(c);
+        }
+
+      std::vector<unsigned int> neighbor_targets;
+      for (const auto &entry : cells_per_neighbor)
+        neighbor_targets.push_back(entry.first);
+
+      std::vector<GhostCellPackage<dim, spacedim>> ghost_packages;
+
+      const auto create_ghost_package = [&](const unsigned int other_rank) {
+        GhostCellPackage<dim, spacedim> package;
+        std::map<types::global_vertex_index, unsigned int> package_vertex;
+        for (const auto c : cells_per_neighbor[other_rank])
+          {
+            dealii::CellData<dim> cell = cells[c];
+            for (auto &v : cell.vertices)
+              {
+                const auto entry =
+                  package_vertex.emplace(global_vertex_indices[v],
+                                         package.vertices.size());
+                if (entry.second)
+                  {
+                    package.vertex_indices.push_back(global_vertex_indices[v]);
+                    package.vertices.push_back(vertices[v]);
+                  }
+                v = entry.first->second;
+              }
+            package.cells.push_back(cell);
+            package.coarse_cell_ids.push_back(coarse_cell_ids[c]);
+            package.cell_infos.push_back(create_cell_info(c));
+          }
+        return package;
+      };
+
+      const auto receive_ghost_package =
+        [&](const unsigned int, const GhostCellPackage<dim, spacedim> &package) {
+          ghost_packages.push_back(package);
+        };
+
+      dealii::Utilities::MPI::ConsensusAlgorithms::selector<
+        GhostCellPackage<dim, spacedim>>(neighbor_targets,
+                                         create_ghost_package,
+                                         receive_ghost_package,
+                                         comm);
+
+      // 6) set up the description from the locally owned and the ghost cells,
+      //    sorted by their coarse-cell id
+      Description<dim, spacedim> description;
+
+      std::map<types::global_vertex_index, unsigned int> local_vertex;
+      const auto add_vertex = [&](const types::global_vertex_index index,
+                                  const Point<spacedim> &          point) {
+        const auto entry =
+          local_vertex.emplace(index, description.coarse_cell_vertices.size());
+        if (entry.second)
+          description.coarse_cell_vertices.push_back(point);
+        return entry.first->second;
+      };
+
+      std::vector<std::tuple<types::coarse_cell_id,
+                             dealii::CellData<dim>,
+                             CellData<dim>>>
+        relevant_cells;
+      relevant_cells.reserve(cells.size());
+
+      for (unsigned int c = 0; c < cells.size(); ++c)
+        {
+          dealii::CellData<dim> cell = cells[c];
+          for (auto &v : cell.vertices)
+            v = add_vertex(global_vertex_indices[v], vertices[v]);
+          relevant_cells.emplace_back(coarse_cell_ids[c],
+                                      cell,
+                                      create_cell_info(c));
+        }
+
+      for (const auto &package : ghost_packages)
+        for (unsigned int c = 0; c < package.cells.size(); ++c)
+          {
+            dealii::CellData<dim> cell = package.cells[c];
+            for (auto &v : cell.vertices)
+              v = add_vertex(package.vertex_indices[v], package.vertices[v]);
+            relevant_cells.emplace_back(package.coarse_cell_ids[c],
+                                        cell,
+                                        package.cell_infos[c]);
+          }
+
+      std::sort(relevant_cells.begin(),
+                relevant_cells.end(),
+                [](const auto &a, const auto &b) {
+                  return std::get<0>(a) < std::get<0>(b);
+                });
+
+      description.cell_infos.resize(1);
+      for (const auto &cell : relevant_cells)
+        {
+          description.coarse_cell_index_to_coarse_cell_id.push_back(
+            std::get<0>(cell));
+          description.coarse_cells.push_back(std::get<1>(cell));
+          description.cell_infos[0].push_back(std::get<2>(cell));
+        }
+
+      description.comm      = comm;
+      description.smoothing = smoothing;
+      description.settings  = settings;
+
+      return description;
+    }
+
+
+
+    template <int dim>
+    Description<dim, dim>
+    create_description_from_subdivided_hyper_rectangle(
+      const std::vector<unsigned int> &repetitions,
+      const Point<dim> &               p1,
+      const Point<dim> &               p2,
+      const MPI_Comm &                 comm,
+      const bool                       colorize,
+      const typename Triangulation<dim, dim>::MeshSmoothing smoothing,
+      const TriangulationDescription::Settings              settings)
+    {
+      AssertDimension(repetitions.size(), dim);
+
+      const unsigned int n_procs = dealii::Utilities::MPI::n_mpi_processes(comm);
+      const unsigned int my_rank = dealii::Utilities::MPI::this_mpi_process(comm);
+
+      Point<dim>                             lower, upper;
+      std::array<types::coarse_cell_id, dim> n_cells_before;
+      types::coarse_cell_id                  n_cells = 1;
+      for (unsigned int d = 0; d < dim; ++d)
+        {
+          Assert(repetitions[d] >= 1,
+                 ExcMessage("The number of repetitions in each coordinate "
+                            "direction must be at least one."));
+          Assert(p1[d] != p2[d],
+                 ExcMessage("The hyper rectangle must not be degenerate."));
+          lower[d]          = std::min(p1[d], p2[d]);
+          upper[d]          = std::max(p1[d], p2[d]);
+          n_cells_before[d] = n_cells;
+          n_cells *= repetitions[d];
+        }
+
+      // the coarse cells are numbered lexicographically, and process p owns
+      // the cells [first_cell(p), first_cell(p+1))
+      const auto first_cell = [&](const unsigned int rank) {
+        return static_cast<types::coarse_cell_id>(
+          static_cast<long double>(n_cells) * rank / n_procs);
+      };
+
+      const auto owner = [&](const types::coarse_cell_id cell) {
+        unsigned int rank = static_cast<unsigned int>(
+          static_cast<long double>(cell) * n_procs / n_cells);
+        while (rank > 0 && first_cell(rank) > cell)
+          --rank;
+        while (rank + 1 < n_procs && first_cell(rank + 1) <= cell)
+          ++rank;
+        return rank;
+      };
+
+      const auto cell_to_indices = [&](types::coarse_cell_id cell) {
+        std::array<unsigned int, dim> indices;
+        for (unsigned int d = 0; d < dim; ++d)
+          {
+            indices[d] = cell % repetitions[d];
+            cell /= repetitions[d];
+          }
+        return indices;
+      };
+
+      // 1) the locally relevant cells are the locally owned ones and all
+      //    cells that share a vertex with them
+      const types::coarse_cell_id my_first_cell = first_cell(my_rank);
+      const types::coarse_cell_id my_end_cell   = first_cell(my_rank + 1);
+
+      std::vector<types::coarse_cell_id> relevant_cells;
+      for (types::coarse_cell_id cell = my_first_cell; cell < my_end_cell;
+           ++cell)
+        {
+          const auto indices = cell_to_indices(cell);
+          for (unsigned int offset = 0;
+               offset < dealii::Utilities::fixed_power<dim>(3U);
+               ++offset)
+            {
+              types::coarse_cell_id neighbor = 0;
+              bool                  valid    = true;
+              for (unsigned int d = 0, o = offset; d < dim; ++d, o /= 3)
+                {
+                  const int index = static_cast<int>(indices[d]) +
+                                    static_cast<int>(o % 3) - 1;
+                  if (index < 0 ||
+                      index >= static_cast<int>(repetitions[d]))
+                    {
+                      valid = false;
+                      break;
+                    }
+                  neighbor += index * n_cells_before[d];
+                }
+              if (valid)
+                relevant_cells.push_back(neighbor);
+            }
+        }
+      std::sort(relevant_cells.begin(), relevant_cells.end());
+      relevant_cells.erase(std::unique(relevant_cells.begin(),
+                                       relevant_cells.end()),
+                           relevant_cells.end());
+
+      // 2) the vertices of the relevant cells, numbered lexicographically in
+      //    the global mesh
+      const auto cell_vertex = [&](const std::array<unsigned int, dim> &indices,
+                                   const unsigned int                   v) {
+        types::global_vertex_index vertex         = 0;
+        types::global_vertex_index n_points_below = 1;
+        for (unsigned int d = 0; d < dim; ++d)
+          {
+            vertex += (indices[d] + ((v >> d) & 1)) * n_points_below;
+            n_points_below *= repetitions[d] + 1;
+          }
+        return vertex;
+      };
+
+      std::vector<types::global_vertex_index> relevant_vertices;
+      relevant_vertices.reserve(relevant_cells.size() *
+                                GeometryInfo<dim>::vertices_per_cell);
+      for (const auto cell : relevant_cells)
+        {
+          const auto indices = cell_to_indices(cell);
+          for (const unsigned int v : GeometryInfo<dim>::vertex_indices())
+            relevant_vertices.push_back(cell_vertex(indices, v));
+        }
+      std::sort(relevant_vertices.begin(), relevant_vertices.end());
+      relevant_vertices.erase(std::unique(relevant_vertices.begin(),
+                                          relevant_vertices.end()),
+                              relevant_vertices.end());
+
+      Description<dim, dim> description;
+
+      description.coarse_cell_vertices.reserve(relevant_vertices.size());
+      for (auto vertex : relevant_vertices)
+        {
+          Point<dim> point;
+          for (unsigned int d = 0; d < dim; ++d)
+            {
+              const unsigned int index = vertex % (repetitions[d] + 1);
+              vertex /= repetitions[d] + 1;
+              point[d] = (index == repetitions[d]) ?
+                           upper[d] :
+                           lower[d] + (upper[d] - lower[d]) * index /
+                                        repetitions[d];
+            }
+          description.coarse_cell_vertices.push_back(point);
+        }
+
+      // 3) the coarse cells and their CellData, sorted by their coarse-cell
+      //    id
+      description.coarse_cells.reserve(relevant_cells.size());
+      description.coarse_cell_index_to_coarse_cell_id = relevant_cells;
+      description.cell_infos.resize(1);
+      description.cell_infos[0].reserve(relevant_cells.size());
+
+      for (const auto cell : relevant_cells)
+        {
+          const auto indices = cell_to_indices(cell);
+
+          dealii::CellData<dim> cell_data;
+          for (const unsigned int v : GeometryInfo<dim>::vertex_indices())
+            cell_data.vertices[v] = std::lower_bound(relevant_vertices.begin(),
+                                                     relevant_vertices.end(),
+                                                     cell_vertex(indices, v)) -
+                                    relevant_vertices.begin();
+          description.coarse_cells.push_back(cell_data);
+
+          const types::subdomain_id cell_owner = owner(cell);
+
+          CellData<dim> cell_info;
+          cell_info.id = CellId(cell, std::vector<std::uint8_t>())
+                           .template to_binary<dim>();
+          cell_info.subdomain_id       = cell_owner;
+          cell_info.level_subdomain_id = cell_owner;
+          cell_info.manifold_id        = numbers::flat_manifold_id;
+          std::fill(cell_info.manifold_line_ids.begin(),
+                    cell_info.manifold_line_ids.end(),
+                    numbers::flat_manifold_id);
+          std::fill(cell_info.manifold_quad_ids.begin(),
+                    cell_info.manifold_quad_ids.end(),
+                    numbers::flat_manifold_id);
+
+          if (colorize)
+            for (unsigned int d = 0; d < dim; ++d)
+              {
+                if (indices[d] == 0)
+                  cell_info.boundary_ids.emplace_back(2 * d, 2 * d);
+                if (indices[d] + 1 == repetitions[d])
+                  cell_info.boundary_ids.emplace_back(2 * d + 1, 2 * d + 1);
+              }
+
+          description.cell_infos[0].push_back(cell_info);
+        }
+
+      description.comm      = comm;
+      description.smoothing = smoothing;
+      description.settings  = settings;
+
+      return description;
+    }
+
   } // namespace Utilities
 } // namespace TriangulationDescription
 
@@ -528,6 +528,35 @@ namespace hp
 
 
 
+  template <int dim, int spacedim>
+  template <typename QueryFunction>
+  std::vector<std::map<unsigned int, unsigned int>>
+  FECollection<dim, spacedim>::get_cached_dof_identities(
+    const unsigned int            structdim,
+    const unsigned int            face_no,
+    const std::set<unsigned int> &fes,
+    const QueryFunction &         query_identities) const
+  {
+    // there are no identities within a single element, so there is no point
+    // in caching anything
+    if (fes.size() <= 1)
+      return {};
+
+    std::lock_guard<std::mutex> lock(cache.mutex);
+
+    const auto key = std::make_pair(
+      std::array<unsigned int, 2>{{structdim, face_no}}, fes);
+    const auto entry = cache.dof_identities.find(key);
+    if (entry != cache.dof_identities.end())
+      return entry->second;
+
+    auto identities = compute_hp_dof_identities(fes, query_identities);
+    cache.dof_identities.emplace(key, identities);
+    return identities;
+  }
+
+
+
   template <int dim, int spacedim>
   std::vector<std::map<unsigned int, unsigned int>>
   FECollection<dim, spacedim>::hp_vertex_dof_identities(
@@ -537,7 +566,10 @@ namespace hp
                                               const unsigned int fe_index_2) {
       return (*this)[fe_index_1].hp_vertex_dof_identities((*this)[fe_index_2]);
     };
-    return compute_hp_dof_identities(fes, query_vertex_dof_identities);
+    return get_cached_dof_identities(0,
+                                     numbers::invalid_unsigned_int,
+                                     fes,
+                                     query_vertex_dof_identities);
   }
 
 
@@ -551,7 +583,10 @@ namespace hp
                                             const unsigned int fe_index_2) {
       return (*this)[fe_index_1].hp_line_dof_identities((*this)[fe_index_2]);
     };
-    return compute_hp_dof_identities(fes, query_line_dof_identities);
+    return get_cached_dof_identities(1,
+                                     numbers::invalid_unsigned_int,
+                                     fes,
+                                     query_line_dof_identities);
   }
 
 
@@ -568,7 +603,78 @@ namespace hp
       return (*this)[fe_index_1].hp_quad_dof_identities((*this)[fe_index_2],
                                                         face_no);
     };
-    return compute_hp_dof_identities(fes, query_quad_dof_identities);
+    return get_cached_dof_identities(2,
+                                     face_no,
+                                     fes,
+                                     query_quad_dof_identities);
+  }
+
+
+
+  template <int dim, int spacedim>
+  const FullMatrix<double> &
+  FECollection<dim, spacedim>::get_face_interpolation_matrix(
+    const unsigned int fe_index_1,
+    const unsigned int fe_index_2,
+    const unsigned int face_no) const
+  {
+    AssertIndexRange(fe_index_1, this->size());
+    AssertIndexRange(fe_index_2, this->size());
+
+    const std::array<unsigned int, 4> key = {
+      {fe_index_1, fe_index_2, numbers::invalid_unsigned_int, face_no}};
+
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    std::unique_ptr<FullMatrix<double>> &matrix =
+      cache.interpolation_matrices[key];
+    if (matrix == nullptr)
+      {
+        const FiniteElement<dim, spacedim> &fe1 = (*this)[fe_index_1];
+        const FiniteElement<dim, spacedim> &fe2 = (*this)[fe_index_2];
+
+        auto new_matrix = std::make_unique<FullMatrix<double>>(
+          fe2.n_dofs_per_face(face_no), fe1.n_dofs_per_face(face_no));
+        fe1.get_face_interpolation_matrix(fe2, *new_matrix, face_no);
+        matrix = std::move(new_matrix);
+      }
+
+    return *matrix;
+  }
+
+
+
+  template <int dim, int spacedim>
+  const FullMatrix<double> &
+  FECollection<dim, spacedim>::get_subface_interpolation_matrix(
+    const unsigned int fe_index_1,
+    const unsigned int fe_index_2,
+    const unsigned int subface,
+    const unsigned int face_no) const
+  {
+    AssertIndexRange(fe_index_1, this->size());
+    AssertIndexRange(fe_index_2, this->size());
+
+    const std::array<unsigned int, 4> key = {
+      {fe_index_1, fe_index_2, subface, face_no}};
+
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    std::unique_ptr<FullMatrix<double>> &matrix =
+      cache.interpolation_matrices[key];
+    if (matrix == nullptr)
+      {
+        const FiniteElement<dim, spacedim> &fe1 = (*this)[fe_index_1];
+        const FiniteElement<dim, spacedim> &fe2 = (*this)[fe_index_2];
+
+        auto new_matrix = std::make_unique<FullMatrix<double>>(
+          fe2.n_dofs_per_face(face_no), fe1.n_dofs_per_face(face_no));
+        fe1.get_subface_interpolation_matrix(fe2,
+                                             subface,
+                                             *new_matrix,
+                                             face_no);
+        matrix = std::move(new_matrix);
+      }
+
+    return *matrix;
   }
 
 
@@ -100,23 +100,24 @@ namespace GinkgoWrappers
     // Generate the solver from the solver using the system matrix.
     auto solver = solver_gen->generate(system_matrix);
 
-    // Create the rhs vector in Ginkgo's format.
-    std::vector<ValueType> f(rhs.size());
-    std::copy(rhs.begin(), rhs.begin() + rhs.size(), f.begin());
-    auto b =
-      vec::create(executor,
-                  gko::dim<2>(rhs.size(), 1),
-                  val_array::view(executor->get_master(), rhs.size(), f.data()),
-                  1);
-
-    // Create the solution vector in Ginkgo's format.
-    std::vector<ValueType> u(solution.size());
-    std::copy(solution.begin(), solution.begin() + solution.size(), u.begin());
+    // Create the rhs and solution vectors in Ginkgo's format as views of the
+    // memory of the deal.II vectors. If the executor is the host, Ginkgo
+    // works directly on this memory, otherwise the data is copied to the
+    // device. Ginkgo never writes into the rhs vector, so we can cast away
+    // the constness of its data.
+    ValueType *rhs_values = const_cast<ValueType *>(rhs.begin());
+
+    auto b = vec::create(executor,
+                         gko::dim<2>(rhs.size(), 1),
+                         val_array::view(executor->get_master(),
+                                         rhs.size(),
+                                         rhs_values),
+                         1);
     auto x = vec::create(executor,
                          gko::dim<2>(solution.size(), 1),
                          val_array::view(executor->get_master(),
                                          solution.size(),
-                                         u.data()),
+                                         solution.begin()),
                          1);
 
     // Create the logger object to log some data from the solvers to confirm
@@ -160,7 +161,7 @@ namespace GinkgoWrappers
                                     gko::dim<2>(rhs.size(), 1),
                                     val_array::view(executor->get_master(),
                                                     rhs.size(),
-                                                    f.data()),
+                                                    rhs_values),
                                     1);
         b_master->compute_norm2(b_norm.get());
       }
@@ -184,22 +185,19 @@ namespace GinkgoWrappers
                   SolverControl::NoConvergence(solver_control.last_step(),
                                                solver_control.last_value()));
 
-    // Check if the solution is on a CUDA device, if so, copy it over to the
-    // host.
+    // Check if the solution is on a CUDA device, if so, copy it over to
+    // deal.II's solution vector. Otherwise, Ginkgo has already written the
+    // solution into the memory of that vector.
     if (executor != executor->get_master())
       {
         auto x_master = vec::create(executor->get_master(),
                                     gko::dim<2>(solution.size(), 1),
-                                    val_array::view(executor,
+                                    val_array::view(executor->get_master(),
                                                     solution.size(),
-                                                    x->get_values()),
+                                                    solution.begin()),
                                     1);
-        x.reset(x_master.release());
+        x_master->copy_from(gko::lend(x));
       }
-    // Finally copy over the solution vector to deal.II's solution vector.
-    std::copy(x->get_values(),
-              x->get_values() + solution.size(),
-              solution.begin());
   }
 
 
@@ -233,6 +233,49 @@ namespace PETScWrappers
 
 
 
+#  if DEAL_II_PETSC_VERSION_GTE(3, 18, 0)
+  void
+  MatrixBase::set_COO_pattern(const std::vector<PetscInt> &row_indices,
+                              const std::vector<PetscInt> &column_indices)
+  {
+    AssertDimension(row_indices.size(), column_indices.size());
+    assert_is_compressed();
+
+    // PETSc does not change the index arrays, but takes them as non-const
+    // pointers
+    std::vector<PetscInt> petsc_rows(row_indices);
+    std::vector<PetscInt> petsc_columns(column_indices);
+
+    const PetscErrorCode ierr =
+      MatSetPreallocationCOO(matrix,
+                             static_cast<PetscCount>(petsc_rows.size()),
+                             petsc_rows.data(),
+                             petsc_columns.data());
+    AssertThrow(ierr == 0, ExcPETScError(ierr));
+  }
+
+
+
+  void
+  MatrixBase::set_values_COO(const PetscScalar *            values,
+                             const VectorOperation::values operation)
+  {
+    Assert(operation == VectorOperation::insert ||
+             operation == VectorOperation::add,
+           ExcMessage("The operation must be either insert or add."));
+    assert_is_compressed();
+
+    const PetscErrorCode ierr =
+      MatSetValuesCOO(matrix,
+                      values,
+                      operation == VectorOperation::insert ? INSERT_VALUES :
+                                                             ADD_VALUES);
+    AssertThrow(ierr == 0, ExcPETScError(ierr));
+  }
+#  endif
+
+
+
   MatrixBase::size_type
   MatrixBase::m() const
   {
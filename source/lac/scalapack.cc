@@ -976,6 +976,183 @@ ScaLAPACKMatrix<NumberType>::copy_to(ScaLAPACKMatrix<NumberType> &dest) const
 
 
 
+template <typename NumberType>
+Utilities::MPI::Future<void>
+ScaLAPACKMatrix<NumberType>::copy_to_async(
+  ScaLAPACKMatrix<NumberType> &dest) const
+{
+  Assert(n_rows == dest.n_rows, ExcDimensionMismatch(n_rows, dest.n_rows));
+  Assert(n_columns == dest.n_columns,
+         ExcDimensionMismatch(n_columns, dest.n_columns));
+
+  if (this->grid->mpi_process_is_active)
+    AssertThrow(
+      this->descriptor[0] == 1,
+      ExcMessage(
+        "Copying of ScaLAPACK matrices only implemented for dense matrices"));
+  if (dest.grid->mpi_process_is_active)
+    AssertThrow(
+      dest.descriptor[0] == 1,
+      ExcMessage(
+        "Copying of ScaLAPACK matrices only implemented for dense matrices"));
+
+  int comparison = MPI_UNEQUAL;
+  int ierr       = MPI_Comm_compare(this->grid->mpi_communicator,
+                              dest.grid->mpi_communicator,
+                              &comparison);
+  AssertThrowMPI(ierr);
+  AssertThrow(comparison == MPI_IDENT || comparison == MPI_CONGRUENT,
+              ExcMessage("The process grids of both matrices must have been "
+                         "built on the same MPI communicator."));
+
+  // the process ranks in the communicator of the process grid are assigned
+  // to the processes of the grid in row-major order, see the constructor of
+  // ProcessGrid. the process row (column) owning a global row (column)
+  // follows from the block-cyclic distribution
+  const auto owner = [](const int index,
+                        const int block_size,
+                        const int first_process,
+                        const int n_processes) {
+    return (index / block_size + first_process) % n_processes;
+  };
+
+  // both the sender and the receiver of a message run over the matrix
+  // column by column and, within each column, row by row. since local
+  // indices increase with the global ones, both see the entries they
+  // exchange in the same order, which is therefore not communicated
+  struct Buffers
+  {
+    std::vector<std::vector<NumberType>> send_buffers;
+    std::vector<std::vector<NumberType>> receive_buffers;
+    std::vector<MPI_Request>             requests;
+  };
+  const auto buffers = std::make_shared<Buffers>();
+  const int  n_sources =
+    this->grid->n_process_rows * this->grid->n_process_columns;
+  const int n_destinations =
+    dest.grid->n_process_rows * dest.grid->n_process_columns;
+
+  const MPI_Comm &mpi_communicator = this->grid->mpi_communicator;
+  const int mpi_tag = Utilities::MPI::internal::Tags::scalapack_copy_to_async;
+
+  // post the receives first, counting how many entries each process of the
+  // source grid sends
+  std::vector<int> dest_row_sources;
+  std::vector<int> dest_column_sources;
+  if (dest.grid->mpi_process_is_active)
+    {
+      dest_row_sources.resize(dest.n_local_rows);
+      for (int i = 0; i < dest.n_local_rows; ++i)
+        dest_row_sources[i] = owner(dest.global_row(i),
+                                    row_block_size,
+                                    first_process_row,
+                                    this->grid->n_process_rows);
+      dest_column_sources.resize(dest.n_local_columns);
+      for (int j = 0; j < dest.n_local_columns; ++j)
+        dest_column_sources[j] = owner(dest.global_column(j),
+                                       column_block_size,
+                                       first_process_column,
+                                       this->grid->n_process_columns);
+
+      std::vector<std::size_t> n_entries_from(n_sources, 0);
+      for (const int column_source : dest_column_sources)
+        for (const int row_source : dest_row_sources)
+          ++n_entries_from[row_source * this->grid->n_process_columns +
+                           column_source];
+
+      buffers->receive_buffers.resize(n_sources);
+      for (int source = 0; source < n_sources; ++source)
+        if (n_entries_from[source] > 0)
+          {
+            buffers->receive_buffers[source].resize(n_entries_from[source]);
+            buffers->requests.emplace_back();
+            ierr = MPI_Irecv(buffers->receive_buffers[source].data(),
+                             n_entries_from[source],
+                             Utilities::MPI::mpi_type_id_for_type<NumberType>,
+                             source,
+                             mpi_tag,
+                             mpi_communicator,
+                             &buffers->requests.back());
+            AssertThrowMPI(ierr);
+          }
+    }
+
+  // then pack and send the locally owned entries
+  if (this->grid->mpi_process_is_active)
+    {
+      std::vector<int> row_destinations(n_local_rows);
+      for (int i = 0; i < n_local_rows; ++i)
+        row_destinations[i] = owner(global_row(i),
+                                    dest.row_block_size,
+                                    dest.first_process_row,
+                                    dest.grid->n_process_rows);
+
+      buffers->send_buffers.resize(n_destinations);
+      for (int j = 0; j < n_local_columns; ++j)
+        {
+          const int column_destination = owner(global_column(j),
+                                               dest.column_block_size,
+                                               dest.first_process_column,
+                                               dest.grid->n_process_columns);
+          for (int i = 0; i < n_local_rows; ++i)
+            buffers
+              ->send_buffers[row_destinations[i] *
+                               dest.grid->n_process_columns +
+                             column_destination]
+              .push_back(local_el(i, j));
+        }
+
+      for (int destination = 0; destination < n_destinations; ++destination)
+        if (buffers->send_buffers[destination].size() > 0)
+          {
+            buffers->requests.emplace_back();
+            ierr = MPI_Isend(buffers->send_buffers[destination].data(),
+                             buffers->send_buffers[destination].size(),
+                             Utilities::MPI::mpi_type_id_for_type<NumberType>,
+                             destination,
+                             mpi_tag,
+                             mpi_communicator,
+                             &buffers->requests.back());
+            AssertThrowMPI(ierr);
+          }
+    }
+
+  const auto wait = [buffers]() {
+    const int ierr = MPI_Waitall(buffers->requests.size(),
+                                 buffers->requests.data(),
+                                 MPI_STATUSES_IGNORE);
+    AssertThrowMPI(ierr);
+  };
+
+  const auto unpack = [buffers,
+                       &dest,
+                       dest_row_sources    = std::move(dest_row_sources),
+                       dest_column_sources = std::move(dest_column_sources),
+                       n_source_columns    = this->grid->n_process_columns,
+                       state               = this->state,
+                       property            = this->property]() {
+    if (dest.grid->mpi_process_is_active)
+      {
+        std::vector<std::size_t> position(buffers->receive_buffers.size(), 0);
+        for (unsigned int j = 0; j < dest_column_sources.size(); ++j)
+          for (unsigned int i = 0; i < dest_row_sources.size(); ++i)
+            {
+              const int source =
+                dest_row_sources[i] * n_source_columns + dest_column_sources[j];
+              dest.local_el(i, j) =
+                buffers->receive_buffers[source][position[source]++];
+            }
+      }
+
+    dest.state    = state;
+    dest.property = property;
+  };
+
+  return Utilities::MPI::Future<void>(wait, unpack);
+}
+
+
+
 template <typename NumberType>
 void
 ScaLAPACKMatrix<NumberType>::copy_transposed(
@@ -15,6 +15,7 @@
 
 #include <deal.II/base/memory_consumption.h>
 #include <deal.II/base/numbers.h>
+#include <deal.II/base/parallel.h>
 
 #include <deal.II/lac/block_sparse_matrix.h>
 #include <deal.II/lac/sparse_direct.h>
@@ -250,17 +251,10 @@ SparseDirectUMFPACK::sort_arrays(const BlockSparseMatrix<number> &matrix)
 
 template <class Matrix>
 void
-SparseDirectUMFPACK::factorize(const Matrix &matrix)
+SparseDirectUMFPACK::copy_matrix(const Matrix &matrix)
 {
-  Assert(matrix.m() == matrix.n(), ExcNotQuadratic());
-
-  clear();
-
   using number = typename Matrix::value_type;
 
-  n_rows = matrix.m();
-  n_cols = matrix.n();
-
   const size_type N = matrix.m();
 
   // copy over the data from the matrix to the data structures UMFPACK
@@ -325,6 +319,61 @@ SparseDirectUMFPACK::factorize(const Matrix &matrix)
   // careful for block sparse matrices, so ship this task out to a
   // different function
   sort_arrays(matrix);
+}
+
+
+
+void
+SparseDirectUMFPACK::compute_numeric_decomposition()
+{
+  Assert(symbolic_decomposition != nullptr, ExcNotInitialized());
+
+  if (numeric_decomposition != nullptr)
+    {
+      umfpack_dl_free_numeric(&numeric_decomposition);
+      numeric_decomposition = nullptr;
+    }
+
+  int status;
+  if (Az.size() == 0)
+    status = umfpack_dl_numeric(Ap.data(),
+                                Ai.data(),
+                                Ax.data(),
+                                symbolic_decomposition,
+                                &numeric_decomposition,
+                                control.data(),
+                                nullptr);
+  else
+    status = umfpack_zl_numeric(Ap.data(),
+                                Ai.data(),
+                                Ax.data(),
+                                Az.data(),
+                                symbolic_decomposition,
+                                &numeric_decomposition,
+                                control.data(),
+                                nullptr);
+  AssertThrow(status == UMFPACK_OK,
+              ExcUMFPACKError("umfpack_dl_numeric", status));
+}
+
+
+
+template <class Matrix>
+void
+SparseDirectUMFPACK::analyze(const Matrix &matrix)
+{
+  Assert(matrix.m() == matrix.n(), ExcNotQuadratic());
+
+  clear();
+
+  using number = typename Matrix::value_type;
+
+  n_rows = matrix.m();
+  n_cols = matrix.n();
+
+  const size_type N = matrix.m();
+
+  copy_matrix(matrix);
 
   int status;
   if (numbers::NumberTraits<number>::is_complex == false)
@@ -348,28 +397,47 @@ SparseDirectUMFPACK::factorize(const Matrix &matrix)
                                  nullptr);
   AssertThrow(status == UMFPACK_OK,
               ExcUMFPACKError("umfpack_dl_symbolic", status));
+}
+
+
+
+template <class Matrix>
+void
+SparseDirectUMFPACK::refactor_numeric(const Matrix &matrix)
+{
+  Assert(symbolic_decomposition != nullptr,
+         ExcMessage("You need to call analyze() or factorize() before "
+                    "computing a numeric factorization with this function."));
+  AssertDimension(matrix.m(), n_rows);
+  AssertDimension(matrix.n(), n_cols);
+  AssertDimension(matrix.n_nonzero_elements(), Ai.size());
+  Assert(numbers::NumberTraits<typename Matrix::value_type>::is_complex ==
+           (Az.size() != 0),
+         ExcMessage("The matrix must have the same number type, real or "
+                    "complex, as the matrix given to analyze()."));
+
+#  ifdef DEBUG
+  const std::vector<types::suitesparse_index> previous_Ap = Ap;
+  const std::vector<types::suitesparse_index> previous_Ai = Ai;
+#  endif
+
+  copy_matrix(matrix);
+
+  Assert(Ap == previous_Ap && Ai == previous_Ai,
+         ExcMessage("The sparsity pattern of the matrix differs from the "
+                    "one of the matrix given to analyze()."));
+
+  compute_numeric_decomposition();
+}
 
-  if (numbers::NumberTraits<number>::is_complex == false)
-    status = umfpack_dl_numeric(Ap.data(),
-                                Ai.data(),
-                                Ax.data(),
-                                symbolic_decomposition,
-                                &numeric_decomposition,
-                                control.data(),
-                                nullptr);
-  else
-    status = umfpack_zl_numeric(Ap.data(),
-                                Ai.data(),
-                                Ax.data(),
-                                Az.data(),
-                                symbolic_decomposition,
-                                &numeric_decomposition,
-                                control.data(),
-                                nullptr);
-  AssertThrow(status == UMFPACK_OK,
-              ExcUMFPACKError("umfpack_dl_numeric", status));
 
-  umfpack_dl_free_symbolic(&symbolic_decomposition);
+
+template <class Matrix>
+void
+SparseDirectUMFPACK::factorize(const Matrix &matrix)
+{
+  analyze(matrix);
+  compute_numeric_decomposition();
 }
 
 
@@ -569,6 +637,87 @@ SparseDirectUMFPACK::solve(BlockVector<std::complex<double>> &rhs_and_solution,
 
 
 
+void
+SparseDirectUMFPACK::solve(std::vector<Vector<double>> &rhs_and_solution,
+                           const bool transpose /*=false*/) const
+{
+  // make sure that some kind of factorize() call has happened before
+  Assert(Ap.size() != 0, ExcNotInitialized());
+  Assert(Ai.size() != 0, ExcNotInitialized());
+  Assert(Ai.size() == Ax.size(), ExcNotInitialized());
+  Assert(numeric_decomposition != nullptr, ExcNotInitialized());
+
+  Assert(Az.size() == 0,
+         ExcMessage("You have previously factored a matrix using this class "
+                    "that had complex-valued entries. This then requires "
+                    "applying the factored matrix to a complex-valued "
+                    "vector, but you are only providing a real-valued vector "
+                    "here."));
+
+  const size_type N = n_rows;
+
+  // UMFPACK only solves for one right hand side at a time, but it does not
+  // modify the factorization when doing so. thus, solve for the right hand
+  // sides in parallel, giving each task its own copy of the right hand side
+  // and the work arrays of umfpack_dl_wsolve (which needs 5N doubles when
+  // doing iterative refinement). as above, solve for UMFPACK's A^T to
+  // account for the compressed row storage
+  parallel::apply_to_subranges(
+    0,
+    rhs_and_solution.size(),
+    [&](const std::size_t begin, const std::size_t end) {
+      Vector<double>                        rhs(N);
+      std::vector<types::suitesparse_index> integer_work(N);
+      std::vector<double>                   work(5 * N);
+      for (std::size_t i = begin; i < end; ++i)
+        {
+          AssertDimension(rhs_and_solution[i].size(), N);
+          rhs = rhs_and_solution[i];
+
+          const int status =
+            umfpack_dl_wsolve(transpose ? UMFPACK_A : UMFPACK_At,
+                              Ap.data(),
+                              Ai.data(),
+                              Ax.data(),
+                              rhs_and_solution[i].begin(),
+                              rhs.begin(),
+                              numeric_decomposition,
+                              control.data(),
+                              nullptr,
+                              integer_work.data(),
+                              work.data());
+          AssertThrow(status == UMFPACK_OK,
+                      ExcUMFPACKError("umfpack_dl_wsolve", status));
+        }
+    },
+    1);
+}
+
+
+
+void
+SparseDirectUMFPACK::solve(FullMatrix<double> &rhs_and_solution,
+                           const bool          transpose /*=false*/) const
+{
+  AssertDimension(rhs_and_solution.m(), n_rows);
+
+  // UMFPACK wants contiguous arrays, but the columns of a FullMatrix are
+  // not, so copy them into vectors and back
+  std::vector<Vector<double>> columns(rhs_and_solution.n(),
+                                      Vector<double>(rhs_and_solution.m()));
+  for (size_type i = 0; i < rhs_and_solution.m(); ++i)
+    for (size_type j = 0; j < rhs_and_solution.n(); ++j)
+      columns[j](i) = rhs_and_solution(i, j);
+
+  solve(columns, transpose);
+
+  for (size_type i = 0; i < rhs_and_solution.m(); ++i)
+    for (size_type j = 0; j < rhs_and_solution.n(); ++j)
+      rhs_and_solution(i, j) = columns[j](i);
+}
+
+
+
 template <class Matrix>
 void
 SparseDirectUMFPACK::solve(const Matrix &  matrix,
@@ -670,6 +819,34 @@ SparseDirectUMFPACK::factorize(const Matrix &)
 }
 
 
+
+template <class Matrix>
+void
+SparseDirectUMFPACK::analyze(const Matrix &)
+{
+  AssertThrow(
+    false,
+    ExcMessage(
+      "To call this function you need UMFPACK, but you configured deal.II "
+      "without passing the necessary switch to 'cmake'. Please consult the "
+      "installation instructions at https://dealii.org/current/readme.html"));
+}
+
+
+
+template <class Matrix>
+void
+SparseDirectUMFPACK::refactor_numeric(const Matrix &)
+{
+  AssertThrow(
+    false,
+    ExcMessage(
+      "To call this function you need UMFPACK, but you configured deal.II "
+      "without passing the necessary switch to 'cmake'. Please consult the "
+      "installation instructions at https://dealii.org/current/readme.html"));
+}
+
+
 void
 SparseDirectUMFPACK::solve(Vector<double> &, const bool) const
 {
@@ -723,6 +900,32 @@ SparseDirectUMFPACK::solve(BlockVector<std::complex<double>> &,
 
 
 
+void
+SparseDirectUMFPACK::solve(std::vector<Vector<double>> &, const bool) const
+{
+  AssertThrow(
+    false,
+    ExcMessage(
+      "To call this function you need UMFPACK, but you configured deal.II "
+      "without passing the necessary switch to 'cmake'. Please consult the "
+      "installation instructions at https://dealii.org/current/readme.html"));
+}
+
+
+
+void
+SparseDirectUMFPACK::solve(FullMatrix<double> &, const bool) const
+{
+  AssertThrow(
+    false,
+    ExcMessage(
+      "To call this function you need UMFPACK, but you configured deal.II "
+      "without passing the necessary switch to 'cmake'. Please consult the "
+      "installation instructions at https://dealii.org/current/readme.html"));
+}
+
+
+
 template <class Matrix>
 void
 SparseDirectUMFPACK::solve(const Matrix &, Vector<double> &, const bool)
@@ -846,6 +1049,8 @@ SparseDirectUMFPACK::n() const
 // explicit instantiations for SparseMatrixUMFPACK
 #define InstantiateUMFPACK(MatrixType)                                     \
   template void SparseDirectUMFPACK::factorize(const MatrixType &);        \
+  template void SparseDirectUMFPACK::analyze(const MatrixType &);          \
+  template void SparseDirectUMFPACK::refactor_numeric(const MatrixType &); \
   template void SparseDirectUMFPACK::solve(const MatrixType &,             \
                                            Vector<double> &,               \
                                            const bool);                    \
@@ -21,12 +21,14 @@
 #include <deal.II/lac/sparsity_tools.h>
 
 #include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <set>
 
 #ifdef DEAL_II_WITH_MPI
 #  include <deal.II/base/mpi.h>
+#  include <deal.II/base/mpi_consensus_algorithms.h>
 #  include <deal.II/base/utilities.h>
 
 #  include <deal.II/lac/block_sparsity_pattern.h>
@@ -912,94 +914,256 @@ namespace SparsityTools
 
 #ifdef DEAL_II_WITH_MPI
 
+  namespace
+  {
+    /**
+     * Append the difference between @p value and @p reference to @p buffer,
+     * mapping it to an unsigned integer by the zig-zag encoding (i.e., 0, -1,
+     * 1, -2, ... to 0, 1, 2, 3, ...) and then storing it with seven bits per
+     * byte, setting the highest bit of all but the last byte. Differences of
+     * less than 64 in magnitude thus take a single byte.
+     */
+    void
+    append_difference(std::vector<char> &                 buffer,
+                      const types::global_dof_index value,
+                      const types::global_dof_index reference)
+    {
+      const std::int64_t difference = static_cast<std::int64_t>(value) -
+                                      static_cast<std::int64_t>(reference);
+      std::uint64_t encoded =
+        (static_cast<std::uint64_t>(difference) << 1) ^
+        static_cast<std::uint64_t>(difference >> 63);
+      while (encoded >= 0x80)
+        {
+          buffer.push_back(static_cast<char>((encoded & 0x7f) | 0x80));
+          encoded >>= 7;
+        }
+      buffer.push_back(static_cast<char>(encoded));
+    }
+
+
+
+    /**
+     * Read a value written by append_difference() with the same
+     * @p reference from the position @p ptr, and advance @p ptr past it.
+     */
+    types::global_dof_index
+    read_difference(std::vector<char>::const_iterator &      ptr,
+                    const std::vector<char>::const_iterator &end,
+                    const types::global_dof_index            reference)
+    {
+      std::uint64_t encoded = 0;
+      for (unsigned int shift = 0;; shift += 7)
+        {
+          Assert(ptr != end, ExcInternalError());
+          (void)end;
+          const auto byte = static_cast<unsigned char>(*(ptr++));
+          encoded |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+          if ((byte & 0x80) == 0)
+            break;
+        }
+      const std::int64_t difference =
+        static_cast<std::int64_t>(encoded >> 1) ^
+        -static_cast<std::int64_t>(encoded & 1);
+      return static_cast<types::global_dof_index>(
+        static_cast<std::int64_t>(reference) + difference);
+    }
+
+
+
+    /**
+     * Append the given @p rows of @p dsp to @p buffer, skipping empty rows.
+     * Each row is stored as its difference to the previous row, the number
+     * of entries, and the differences of each column index to the previous
+     * one, starting with the row index. Since the column indices of the
+     * locally relevant rows are typically close to the diagonal and to each
+     * other, most of these numbers fit into a single byte, rather than the
+     * four or eight bytes of a types::global_dof_index.
+     */
+    template <typename SparsityPatternType>
+    void
+    append_compressed_rows(
+      const SparsityPatternType &                 dsp,
+      const std::vector<types::global_dof_index> &rows,
+      std::vector<char> &                         buffer)
+    {
+      types::global_dof_index previous_row = 0;
+      for (const auto row : rows)
+        {
+          const auto row_length = dsp.row_length(row);
+          if (row_length == 0)
+            continue;
+
+          append_difference(buffer, row, previous_row);
+          append_difference(buffer, row_length, 0);
+          types::global_dof_index previous_column = row;
+          for (typename SparsityPatternType::size_type c = 0; c < row_length;
+               ++c)
+            {
+              const types::global_dof_index column = dsp.column_number(row, c);
+              append_difference(buffer, column, previous_column);
+              previous_column = column;
+            }
+          previous_row = row;
+        }
+    }
+
+
+
+    /**
+     * Decode the rows written to @p buffer by append_compressed_rows() and
+     * call @p add_row with the index and the sorted column indices of each
+     * of them.
+     */
+    template <typename Function>
+    void
+    for_each_compressed_row(const std::vector<char> &buffer,
+                            const Function &         add_row)
+    {
+      std::vector<types::global_dof_index> columns;
+
+      auto                    ptr          = buffer.begin();
+      const auto              end          = buffer.end();
+      types::global_dof_index previous_row = 0;
+      while (ptr != end)
+        {
+          const types::global_dof_index row =
+            read_difference(ptr, end, previous_row);
+          const types::global_dof_index row_length =
+            read_difference(ptr, end, 0);
+          Assert(row_length > 0, ExcInternalError());
+
+          columns.resize(row_length);
+          types::global_dof_index previous_column = row;
+          for (auto &column : columns)
+            {
+              column          = read_difference(ptr, end, previous_column);
+              previous_column = column;
+            }
+
+          add_row(row, columns);
+          previous_row = row;
+        }
+    }
+
+
+
+    /**
+     * Send the entries of the rows of @p dsp that are locally relevant but not
+     * locally owned to their owners and add the rows received from other
+     * processes. The communication uses the consensus algorithms, so only
+     * the processes that actually exchange rows communicate with each other.
+     */
+    template <typename SparsityPatternType>
+    void
+    distribute_compressed_rows(SparsityPatternType &dsp,
+                               const IndexSet &     locally_owned_rows,
+                               const MPI_Comm &     mpi_comm,
+                               const IndexSet &     locally_relevant_rows)
+    {
+      IndexSet requested_rows(locally_relevant_rows);
+      requested_rows.subtract_set(locally_owned_rows);
+
+      const std::vector<unsigned int> index_owner =
+        Utilities::MPI::compute_index_owner(locally_owned_rows,
+                                            requested_rows,
+                                            mpi_comm);
+
+      std::map<unsigned int, std::vector<types::global_dof_index>>
+        rows_per_owner;
+      {
+        unsigned int i = 0;
+        for (const auto row : requested_rows)
+          rows_per_owner[index_owner[i++]].push_back(row);
+      }
+
+      std::map<unsigned int, std::vector<char>> send_buffers;
+      std::vector<unsigned int>                 targets;
+      for (const auto &rows : rows_per_owner)
+        {
+          std::vector<char> buffer;
+          append_compressed_rows(dsp, rows.second, buffer);
+          if (buffer.size() > 0)
+            {
+              targets.push_back(rows.first);
+              send_buffers[rows.first] = std::move(buffer);
+            }
+        }
+
+      Utilities::MPI::ConsensusAlgorithms::selector<std::vector<char>>(
+        targets,
+        [&](const unsigned int other_rank) {
+          return send_buffers[other_rank];
+        },
+        [&](const unsigned int, const std::vector<char> &buffer) {
+          for_each_compressed_row(
+            buffer,
+            [&](const types::global_dof_index               row,
+                const std::vector<types::global_dof_index> &columns) {
+              dsp.add_entries(row, columns.begin(), columns.end(), true);
+            });
+        },
+        mpi_comm);
+    }
+  } // namespace
+
+
+
   void
   gather_sparsity_pattern(DynamicSparsityPattern &dsp,
                           const IndexSet &        locally_owned_rows,
                           const MPI_Comm &        mpi_comm,
                           const IndexSet &        locally_relevant_rows)
   {
-    using map_vec_t =
-      std::map<unsigned int, std::vector<DynamicSparsityPattern::size_type>>;
-
     // 1. limit rows to non owned:
     IndexSet requested_rows(locally_relevant_rows);
     requested_rows.subtract_set(locally_owned_rows);
 
-    std::vector<unsigned int> index_owner =
+    const std::vector<unsigned int> index_owner =
       Utilities::MPI::compute_index_owner(locally_owned_rows,
                                           requested_rows,
                                           mpi_comm);
 
     // 2. go through requested_rows, figure out the owner and add the row to
     // request
-    map_vec_t rows_data;
-    for (DynamicSparsityPattern::size_type i = 0;
-         i < requested_rows.n_elements();
-         ++i)
-      {
-        const DynamicSparsityPattern::size_type row =
-          requested_rows.nth_index_in_set(i);
-
-        rows_data[index_owner[i]].push_back(row);
-      }
-
-    // 3. get what others ask us to send
-    const auto rows_data_received =
-      Utilities::MPI::some_to_some(mpi_comm, rows_data);
-
-    // 4. now prepare data to be sent in the same format as in
-    // distribute_sparsity_pattern() below, i.e.
-    // rX,num_rX,cols_rX
-    map_vec_t send_data;
-    for (const auto &data : rows_data_received)
-      {
-        for (const auto &row : data.second)
-          {
-            const auto rlen = dsp.row_length(row);
-
-            // skip empty lines
-            if (rlen == 0)
-              continue;
-
-            // save entries
-            send_data[data.first].push_back(row);  // row index
-            send_data[data.first].push_back(rlen); // number of entries
-            for (DynamicSparsityPattern::size_type c = 0; c < rlen; ++c)
-              send_data[data.first].push_back(
-                dsp.column_number(row, c)); // columns
-          }                                 // loop over rows
-      }                                     // loop over received data
-
-    // 5. communicate rows
-    const auto received_data =
-      Utilities::MPI::some_to_some(mpi_comm, send_data);
-
-    // 6. add result to our sparsity
-    for (const auto &data : received_data)
-      {
-        const auto &recv_buf = data.second;
-        auto        ptr      = recv_buf.begin();
-        const auto  end      = recv_buf.end();
-        while (ptr != end)
-          {
-            const auto row = *(ptr++);
-            Assert(ptr != end, ExcInternalError());
-
-            const auto n_entries = *(ptr++);
-            Assert(n_entries > 0, ExcInternalError());
-            Assert(ptr != end, ExcInternalError());
+    std::map<unsigned int, std::vector<types::global_dof_index>> rows_data;
+    {
+      unsigned int i = 0;
+      for (const auto row : requested_rows)
+        rows_data[index_owner[i++]].push_back(row);
+    }
 
-            // make sure we clear whatever was previously stored
-            // in these rows. Otherwise we can't guarantee that the
-            // data is consistent across MPI communicator.
+    std::vector<unsigned int> targets;
+    targets.reserve(rows_data.size());
+    for (const auto &rows : rows_data)
+      targets.push_back(rows.first);
+
+    // 3. request the rows from their owners, who answer with the entries of
+    // these rows in the same format as in distribute_sparsity_pattern()
+    // below, and add the result to our sparsity pattern. make sure we clear
+    // whatever was previously stored in these rows. Otherwise we can't
+    // guarantee that the data is consistent across MPI communicator.
+    Utilities::MPI::ConsensusAlgorithms::selector<
+      std::vector<types::global_dof_index>,
+      std::vector<char>>(
+      targets,
+      [&](const unsigned int other_rank) { return rows_data[other_rank]; },
+      [&](const unsigned int,
+          const std::vector<types::global_dof_index> &rows) {
+        std::vector<char> buffer;
+        append_compressed_rows(dsp, rows, buffer);
+        return buffer;
+      },
+      [&](const unsigned int, const std::vector<char> &buffer) {
+        for_each_compressed_row(
+          buffer,
+          [&](const types::global_dof_index               row,
+              const std::vector<types::global_dof_index> &columns) {
             dsp.clear_row(row);
-
-            Assert(ptr + (n_entries - 1) != end, ExcInternalError());
-            dsp.add_entries(row, ptr, ptr + n_entries, true);
-            ptr += n_entries;
-          }
-        Assert(ptr == end, ExcInternalError());
-      }
+            dsp.add_entries(row, columns.begin(), columns.end(), true);
+          });
+      },
+      mpi_comm);
   }
 
 
@@ -1032,63 +1196,10 @@ namespace SparsityTools
                               const MPI_Comm &        mpi_comm,
                               const IndexSet &        locally_relevant_rows)
   {
-    IndexSet requested_rows(locally_relevant_rows);
-    requested_rows.subtract_set(locally_owned_rows);
-
-    std::vector<unsigned int> index_owner =
-      Utilities::MPI::compute_index_owner(locally_owned_rows,
-                                          requested_rows,
-                                          mpi_comm);
-
-    using map_vec_t =
-      std::map<unsigned int, std::vector<DynamicSparsityPattern::size_type>>;
-
-    map_vec_t send_data;
-
-    for (DynamicSparsityPattern::size_type i = 0;
-         i < requested_rows.n_elements();
-         ++i)
-      {
-        const DynamicSparsityPattern::size_type row =
-          requested_rows.nth_index_in_set(i);
-
-        const auto rlen = dsp.row_length(row);
-
-        // skip empty lines
-        if (rlen == 0)
-          continue;
-
-        // save entries
-        send_data[index_owner[i]].push_back(row);  // row index
-        send_data[index_owner[i]].push_back(rlen); // number of entries
-        for (DynamicSparsityPattern::size_type c = 0; c < rlen; ++c)
-          {
-            // columns
-            const auto column = dsp.column_number(row, c);
-            send_data[index_owner[i]].push_back(column);
-          }
-      }
-
-    const auto receive_data = Utilities::MPI::some_to_some(mpi_comm, send_data);
-
-    // add what we received
-    for (const auto &data : receive_data)
-      {
-        const auto &recv_buf = data.second;
-        auto        ptr      = recv_buf.begin();
-        const auto  end      = recv_buf.end();
-        while (ptr != end)
-          {
-            const auto row = *(ptr++);
-            Assert(ptr != end, ExcInternalError());
-            const auto n_entries = *(ptr++);
-
-            Assert(ptr + (n_entries - 1) != end, ExcInternalError());
-            dsp.add_entries(row, ptr, ptr + n_entries, true);
-            ptr += n_entries;
-          }
-        Assert(ptr == end, ExcInternalError());
-      }
+    distribute_compressed_rows(dsp,
+                               locally_owned_rows,
+                               mpi_comm,
+                               locally_relevant_rows);
   }
 
 
@@ -1114,135 +1225,10 @@ namespace SparsityTools
                               const MPI_Comm &             mpi_comm,
                               const IndexSet &locally_relevant_rows)
   {
-    using map_vec_t =
-      std::map<BlockDynamicSparsityPattern::size_type,
-               std::vector<BlockDynamicSparsityPattern::size_type>>;
-    map_vec_t send_data;
-
-    IndexSet requested_rows(locally_relevant_rows);
-    requested_rows.subtract_set(locally_owned_rows);
-
-    std::vector<unsigned int> index_owner =
-      Utilities::MPI::compute_index_owner(locally_owned_rows,
-                                          requested_rows,
-                                          mpi_comm);
-
-    for (DynamicSparsityPattern::size_type i = 0;
-         i < requested_rows.n_elements();
-         ++i)
-      {
-        const DynamicSparsityPattern::size_type row =
-          requested_rows.nth_index_in_set(i);
-
-        BlockDynamicSparsityPattern::size_type rlen = dsp.row_length(row);
-
-        // skip empty lines
-        if (rlen == 0)
-          continue;
-
-        // save entries
-        std::vector<BlockDynamicSparsityPattern::size_type> &dst =
-          send_data[index_owner[i]];
-
-        dst.push_back(rlen); // number of entries
-        dst.push_back(row);  // row index
-        for (BlockDynamicSparsityPattern::size_type c = 0; c < rlen; ++c)
-          {
-            // columns
-            BlockDynamicSparsityPattern::size_type column =
-              dsp.column_number(row, c);
-            dst.push_back(column);
-          }
-      }
-
-    unsigned int num_receive = 0;
-    {
-      std::vector<unsigned int> send_to;
-      send_to.reserve(send_data.size());
-      for (const auto &sparsity_line : send_data)
-        send_to.push_back(sparsity_line.first);
-
-      num_receive =
-        Utilities::MPI::compute_n_point_to_point_communications(mpi_comm,
-                                                                send_to);
-    }
-
-    std::vector<MPI_Request> requests(send_data.size());
-
-
-    // send data
-
-    static Utilities::MPI::CollectiveMutex      mutex;
-    Utilities::MPI::CollectiveMutex::ScopedLock lock(mutex, mpi_comm);
-
-    const int mpi_tag = Utilities::MPI::internal::Tags::
-      sparsity_tools_distribute_sparsity_pattern;
-
-    {
-      unsigned int idx = 0;
-      for (const auto &sparsity_line : send_data)
-        {
-          const int ierr = MPI_Isend(sparsity_line.second.data(),
-                                     sparsity_line.second.size(),
-                                     DEAL_II_DOF_INDEX_MPI_TYPE,
-                                     sparsity_line.first,
-                                     mpi_tag,
-                                     mpi_comm,
-                                     &requests[idx++]);
-          AssertThrowMPI(ierr);
-        }
-    }
-
-    {
-      // receive
-      std::vector<BlockDynamicSparsityPattern::size_type> recv_buf;
-      for (unsigned int index = 0; index < num_receive; ++index)
-        {
-          MPI_Status status;
-          int ierr = MPI_Probe(MPI_ANY_SOURCE, mpi_tag, mpi_comm, &status);
-          AssertThrowMPI(ierr);
-
-          int len;
-          ierr = MPI_Get_count(&status, DEAL_II_DOF_INDEX_MPI_TYPE, &len);
-          AssertThrowMPI(ierr);
-
-          recv_buf.resize(len);
-          ierr = MPI_Recv(recv_buf.data(),
-                          len,
-                          DEAL_II_DOF_INDEX_MPI_TYPE,
-                          status.MPI_SOURCE,
-                          status.MPI_TAG,
-                          mpi_comm,
-                          &status);
-          AssertThrowMPI(ierr);
-
-          std::vector<BlockDynamicSparsityPattern::size_type>::const_iterator
-            ptr = recv_buf.begin();
-          std::vector<BlockDynamicSparsityPattern::size_type>::const_iterator
-            end = recv_buf.end();
-          while (ptr != end)
-            {
-              BlockDynamicSparsityPattern::size_type num = *(ptr++);
-              Assert(ptr != end, ExcInternalError());
-              BlockDynamicSparsityPattern::size_type row = *(ptr++);
-              for (unsigned int c = 0; c < num; ++c)
-                {
-                  Assert(ptr != end, ExcInternalError());
-                  dsp.add(row, *ptr);
-                  ++ptr;
-                }
-            }
-          Assert(ptr == end, ExcInternalError());
-        }
-    }
-
-    // complete all sends, so that we can safely destroy the buffers.
-    if (requests.size() > 0)
-      {
-        const int ierr =
-          MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
-        AssertThrowMPI(ierr);
-      }
+    distribute_compressed_rows(dsp,
+                               locally_owned_rows,
+                               mpi_comm,
+                               locally_relevant_rows);
   }
 #endif
 } // namespace SparsityTools
@@ -1625,6 +1625,32 @@ namespace internal
       const TaskInfo &,
       const std::vector<FaceToCellTopology<16>> &);
 
+    template void
+    DoFInfo::compute_ghost_ranks_of_partitions<1>(
+      const TaskInfo &,
+      const std::vector<FaceToCellTopology<1>> &,
+      std::vector<std::vector<unsigned int>> &) const;
+    template void
+    DoFInfo::compute_ghost_ranks_of_partitions<2>(
+      const TaskInfo &,
+      const std::vector<FaceToCellTopology<2>> &,
+      std::vector<std::vector<unsigned int>> &) const;
+    template void
+    DoFInfo::compute_ghost_ranks_of_partitions<4>(
+      const TaskInfo &,
+      const std::vector<FaceToCellTopology<4>> &,
+      std::vector<std::vector<unsigned int>> &) const;
+    template void
+    DoFInfo::compute_ghost_ranks_of_partitions<8>(
+      const TaskInfo &,
+      const std::vector<FaceToCellTopology<8>> &,
+      std::vector<std::vector<unsigned int>> &) const;
+    template void
+    DoFInfo::compute_ghost_ranks_of_partitions<16>(
+      const TaskInfo &,
+      const std::vector<FaceToCellTopology<16>> &,
+      std::vector<std::vector<unsigned int>> &) const;
+
     template void
     DoFInfo::print_memory_consumption<std::ostream>(std::ostream &,
                                                     const TaskInfo &) const;
@@ -19,6 +19,7 @@
 #include <deal.II/base/mpi.h>
 #include <deal.II/base/multithread_info.h>
 #include <deal.II/base/parallel.h>
+#include <deal.II/base/tracing.h>
 #include <deal.II/base/utilities.h>
 
 #include <deal.II/lac/dynamic_sparsity_pattern.h>
@@ -29,12 +30,14 @@
 #ifdef DEAL_II_WITH_TBB
 #  include <tbb/blocked_range.h>
 #  include <tbb/parallel_for.h>
+#  include <tbb/partitioner.h>
 #  include <tbb/task.h>
 #  ifndef DEAL_II_TBB_WITH_ONEAPI
 #    include <tbb/task_scheduler_init.h>
 #  endif
 #endif
 
+#include <algorithm>
 #include <iostream>
 #include <set>
 
@@ -299,8 +302,15 @@ namespace internal
              task_info.cell_partition_data[partition] + task_info.block_size -
              1) /
             task_info.block_size;
-          parallel_for(tbb::blocked_range<unsigned int>(0, n_chunks, 1),
-                       CellWork(worker, task_info, partition));
+          // with static partitioning, assign the same cells to the same
+          // threads in every loop, like the vector operations do
+          if (MultithreadInfo::use_static_partitioning())
+            parallel_for(tbb::blocked_range<unsigned int>(0, n_chunks, 1),
+                         CellWork(worker, task_info, partition),
+                         tbb::static_partitioner());
+          else
+            parallel_for(tbb::blocked_range<unsigned int>(0, n_chunks, 1),
+                         CellWork(worker, task_info, partition));
           if (is_blocked == true)
             tbb::empty_task::spawn(*dummy);
           return nullptr;
@@ -349,6 +359,8 @@ namespace internal
     void
     TaskInfo::loop(MFWorkerInterface &funct) const
     {
+      DEAL_II_TRACE_SCOPE("MatrixFree::loop", "matrix_free");
+
       // If we use thread parallelism, we do not currently support to schedule
       // pieces of updates within the loop, so this index will collect all
       // calls in that case and work like a single complete loop over all
@@ -608,6 +620,14 @@ namespace internal
           for (unsigned int part = 0; part < partition_row_index.size() - 2;
                ++part)
             {
+              // process the partitions with communication in the order in
+              // which the ghost data of the respective processes arrives
+              if (part == 1 && partition_ghost_ranks_index.empty() == false)
+                {
+                  loop_progress_ghost_ranks(funct);
+                  continue;
+                }
+
               if (part == 1)
                 funct.vector_update_ghosts_finish();
 
@@ -649,6 +669,92 @@ namespace internal
 
 
 
+    void
+    TaskInfo::loop_progress_ghost_ranks(MFWorkerInterface &funct) const
+    {
+      AssertDimension(
+        partition_ghost_ranks_index.size(),
+        partition_row_index[partition_row_index.size() - 2] + 1);
+      const unsigned int begin = partition_row_index[1];
+      const unsigned int end   = partition_row_index[2];
+
+      // All operations before the loop and the zeroing of the destination
+      // vector must be done before any of the partitions is processed,
+      // because the partitions are not processed in order
+      for (unsigned int i = begin; i < end; ++i)
+        {
+          funct.cell_loop_pre_range(i);
+          funct.zero_dst_vector_range(i);
+        }
+
+      // collect the ranks we need to wait for
+      std::vector<unsigned int> pending_ranks(
+        partition_ghost_ranks.begin() + partition_ghost_ranks_index[begin],
+        partition_ghost_ranks.begin() + partition_ghost_ranks_index[end]);
+      std::sort(pending_ranks.begin(), pending_ranks.end());
+      pending_ranks.erase(std::unique(pending_ranks.begin(),
+                                      pending_ranks.end()),
+                          pending_ranks.end());
+      std::vector<unsigned int> arrived_ranks;
+      arrived_ranks.reserve(pending_ranks.size());
+
+      std::vector<bool> done(end - begin, false);
+      unsigned int      n_done = 0;
+      while (n_done < end - begin)
+        {
+          // check for newly arrived data; once no progress can be made
+          // with the arrived data, this loop spins on MPI_Test
+          for (unsigned int r = 0; r < pending_ranks.size();)
+            if (funct.vector_update_ghosts_test(pending_ranks[r]))
+              {
+                arrived_ranks.insert(std::upper_bound(arrived_ranks.begin(),
+                                                      arrived_ranks.end(),
+                                                      pending_ranks[r]),
+                                     pending_ranks[r]);
+                pending_ranks.erase(pending_ranks.begin() + r);
+              }
+            else
+              ++r;
+
+          for (unsigned int i = begin; i < end; ++i)
+            if (done[i - begin] == false &&
+                std::all_of(partition_ghost_ranks.begin() +
+                              partition_ghost_ranks_index[i],
+                            partition_ghost_ranks.begin() +
+                              partition_ghost_ranks_index[i + 1],
+                            [&](const unsigned int rank) {
+                              return std::binary_search(arrived_ranks.begin(),
+                                                        arrived_ranks.end(),
+                                                        rank);
+                            }))
+              {
+                if (cell_partition_data[i + 1] > cell_partition_data[i])
+                  funct.cell(i);
+
+                if (face_partition_data.empty() == false)
+                  {
+                    if (face_partition_data[i + 1] > face_partition_data[i])
+                      funct.face(i);
+                    if (boundary_partition_data[i + 1] >
+                        boundary_partition_data[i])
+                      funct.boundary(i);
+                  }
+                done[i - begin] = true;
+                ++n_done;
+              }
+        }
+
+      // release the communication resources and run the operations after
+      // the loop once all partitions have been processed
+      funct.vector_update_ghosts_finish();
+      for (unsigned int i = begin; i < end; ++i)
+        funct.cell_loop_post_range(i);
+
+      funct.vector_compress_start();
+    }
+
+
+
     TaskInfo::TaskInfo()
     {
       clear();
@@ -665,6 +771,7 @@ namespace internal
       block_size           = 0;
       n_blocks             = 0;
       scheme               = none;
+      fe_index_cost.clear();
       partition_row_index.clear();
       partition_row_index.resize(2);
       cell_partition_data.clear();
@@ -678,6 +785,8 @@ namespace internal
       partition_odds.clear();
       partition_n_blocked_workers.clear();
       partition_n_workers.clear();
+      partition_ghost_ranks_index.clear();
+      partition_ghost_ranks.clear();
       communicator = MPI_COMM_SELF;
       my_pid       = 0;
       n_procs      = 1;
@@ -705,7 +814,7 @@ namespace internal
     TaskInfo::memory_consumption() const
     {
       return (
-        sizeof(*this) +
+        sizeof(*this) + MemoryConsumption::memory_consumption(fe_index_cost) +
         MemoryConsumption::memory_consumption(partition_row_index) +
         MemoryConsumption::memory_consumption(cell_partition_data) +
         MemoryConsumption::memory_consumption(face_partition_data) +
@@ -713,7 +822,9 @@ namespace internal
         MemoryConsumption::memory_consumption(partition_evens) +
         MemoryConsumption::memory_consumption(partition_odds) +
         MemoryConsumption::memory_consumption(partition_n_blocked_workers) +
-        MemoryConsumption::memory_consumption(partition_n_workers));
+        MemoryConsumption::memory_consumption(partition_n_workers) +
+        MemoryConsumption::memory_consumption(partition_ghost_ranks_index) +
+        MemoryConsumption::memory_consumption(partition_ghost_ranks));
     }
 
 
@@ -793,15 +904,19 @@ namespace internal
     void
     TaskInfo::create_blocks_serial(
       const std::vector<unsigned int> &cells_with_comm,
+      const std::vector<unsigned int> &cells_with_comm_rank,
       const unsigned int               dofs_per_cell,
       const bool                       categories_are_hp,
       const std::vector<unsigned int> &cell_vectorization_categories,
       const bool                       cell_vectorization_categories_strict,
       const std::vector<unsigned int> &parent_relation,
+      const std::vector<unsigned int> &cell_order,
       std::vector<unsigned int> &      renumbering,
       std::vector<unsigned char> &     incompletely_filled_vectorization)
     {
       Assert(dofs_per_cell > 0, ExcInternalError());
+      Assert(cell_order.empty() || cell_order.size() == n_active_cells,
+             ExcDimensionMismatch(cell_order.size(), n_active_cells));
       // This function is decomposed into several steps to determine a good
       // ordering that satisfies the following constraints:
       // a. Only cells belonging to the same category (or next higher if the
@@ -811,9 +926,13 @@ namespace internal
       // degree (category) in cell_partition_data
       // c. We want to group the cells with the same parent in the same SIMD
       // lane if possible
-      // d. The cell order should be similar to the initial one
+      // d. The cell order should be similar to the initial one, or follow
+      // the order given by cell_order if not empty
       // e. Form sets without MPI communication and those with to overlap
       // communication with computation
+      // f. If requested, group the cells with communication by the rank of
+      // the process they exchange data with, such that they can be processed
+      // as soon as the data of that process has arrived
       //
       // These constraints are satisfied by first grouping by the categories
       // and, within the groups, to distinguish between cells with a parent
@@ -940,7 +1059,14 @@ namespace internal
               }
 
           // Sort the remaining cells and append them as well
-          std::sort(other_cells.begin(), other_cells.end());
+          if (cell_order.empty())
+            std::sort(other_cells.begin(), other_cells.end());
+          else
+            std::sort(other_cells.begin(),
+                      other_cells.end(),
+                      [&](const unsigned int a, const unsigned int b) {
+                        return cell_order[a] < cell_order[b];
+                      });
           temporary_numbering.insert(temporary_numbering.end(),
                                      other_cells.begin(),
                                      other_cells.end());
@@ -961,24 +1087,51 @@ namespace internal
       for (const unsigned int cell : cells_with_comm)
         batch_with_comm[temporary_numbering_inverse[cell] / n_lanes] = true;
 
+      // For the grouping by ranks, a batch gets the lowest rank among its
+      // cells
+      std::vector<unsigned int> batch_comm_rank;
+      if (cells_with_comm_rank.empty() == false)
+        {
+          AssertDimension(cells_with_comm_rank.size(), cells_with_comm.size());
+          batch_comm_rank.resize(batch_with_comm.size(),
+                                 numbers::invalid_unsigned_int);
+          for (unsigned int i = 0; i < cells_with_comm.size(); ++i)
+            {
+              unsigned int &rank =
+                batch_comm_rank[temporary_numbering_inverse[cells_with_comm[i]] /
+                                n_lanes];
+              rank = std::min(rank, cells_with_comm_rank[i]);
+            }
+        }
+
       // Step 5: Sort the batches of cells by their last cell index to get
       // good locality, assuming that the initial cell order is of good
-      // locality. In case we have hp-calculations with categories, we need to
-      // sort also by the category.
-      std::vector<std::array<unsigned int, 3>> batch_order;
-      std::vector<std::array<unsigned int, 3>> batch_order_comm;
+      // locality, or by the last position in cell_order if given. In case we have hp-calculations with categories, we need to
+      // sort also by the category. The batches with communication are
+      // additionally sorted by the rank assigned in step 4, if any.
+      std::vector<std::array<unsigned int, 4>> batch_order;
+      std::vector<std::array<unsigned int, 4>> batch_order_comm;
       for (unsigned int i = 0; i < temporary_numbering.size(); i += n_lanes)
         {
           unsigned int max_index = 0;
           for (unsigned int j = 0; j < n_lanes; ++j)
             if (temporary_numbering[i + j] < numbers::invalid_unsigned_int)
-              max_index = std::max(temporary_numbering[i + j], max_index);
+              max_index =
+                std::max(cell_order.empty() ?
+                           temporary_numbering[i + j] :
+                           cell_order[temporary_numbering[i + j]],
+                         max_index);
           const unsigned int category_hp =
             categories_are_hp ?
               std::upper_bound(category_size.begin(), category_size.end(), i) -
                 category_size.begin() :
               0;
-          const std::array<unsigned int, 3> next{{category_hp, max_index, i}};
+          const unsigned int rank =
+            batch_comm_rank.empty() || !batch_with_comm[i / n_lanes] ?
+              0 :
+              batch_comm_rank[i / n_lanes];
+          const std::array<unsigned int, 4> next{
+            {category_hp, rank, max_index, i}};
           if (batch_with_comm[i / n_lanes])
             batch_order_comm.emplace_back(next);
           else
@@ -1063,7 +1216,9 @@ namespace internal
                     tight_category_map_ghost.end());
         }
 
-      // Step 8: Fill in the data by batches for the locally owned cells.
+      // Step 8: Fill in the data by batches for the locally owned cells. A
+      // new partition is started whenever the rank from step 4 changes, in
+      // order to not mix cells depending on data of different processes.
       const unsigned int n_cell_batches = batch_order.size();
       const unsigned int n_ghost_batches =
         ((tight_category_map_ghost.empty() ? n_ghost_cells :
@@ -1085,16 +1240,24 @@ namespace internal
         {
           const unsigned int grain_size =
             std::max((2048U / dofs_per_cell) / 8 * 4, 2U);
-          for (unsigned int k = blocks[block]; k < blocks[block + 1];
-               k += grain_size)
-            cell_partition_data.push_back(
-              std::min(k + grain_size, blocks[block + 1]));
+          for (unsigned int k = blocks[block]; k < blocks[block + 1];)
+            {
+              unsigned int end = std::min(k + grain_size, blocks[block + 1]);
+              for (unsigned int l = k + 1; l < end; ++l)
+                if (batch_order[l][1] != batch_order[k][1])
+                  {
+                    end = l;
+                    break;
+                  }
+              cell_partition_data.push_back(end);
+              k = end;
+            }
           partition_row_index[block + 1] = cell_partition_data.size() - 1;
 
           // Set the numbering according to the reordered temporary one
           for (unsigned int k = blocks[block]; k < blocks[block + 1]; ++k)
             {
-              const unsigned int pos = batch_order[k][2];
+              const unsigned int pos = batch_order[k][3];
               unsigned int       j   = 0;
               for (; j < n_lanes && temporary_numbering[pos + j] !=
                                       numbers::invalid_unsigned_int;
@@ -1733,6 +1896,14 @@ namespace internal
       Assert(!hp_bool || cell_active_fe_index.size() == n_active_cells,
              ExcInternalError());
 
+      // the cost of one cell batch with the given FE index in units of the
+      // cluster size
+      const auto batch_cost = [&](const unsigned int fe_index) {
+        return (hp_bool && fe_index < fe_index_cost.size()) ?
+                 std::max(1U, fe_index_cost[fe_index]) :
+                 1U;
+      };
+
       {
         unsigned int n_cell_batches_before = 0;
         // Create partitioning within partitions.
@@ -1852,7 +2023,8 @@ namespace internal
                               missing_macros +=
                                 ((renumbering_fe_index[j].size() +
                                   vectorization_length - 1) /
-                                 vectorization_length);
+                                 vectorization_length) *
+                                batch_cost(j);
                             }
                         }
                       else
@@ -1936,7 +2108,9 @@ namespace internal
                                       if (remaining_per_cell_batch
                                               [this_index] == 0 &&
                                           missing_macros > 0)
-                                        missing_macros--;
+                                        missing_macros -=
+                                          std::min(missing_macros,
+                                                   batch_cost(this_index));
                                       remaining_per_cell_batch[this_index]++;
                                       if (remaining_per_cell_batch
                                             [this_index] ==
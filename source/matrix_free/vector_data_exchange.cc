@@ -25,6 +25,7 @@
 
 #include <boost/serialization/utility.hpp>
 
+#include <algorithm>
 #include <map>
 #include <vector>
 
@@ -120,12 +121,22 @@ namespace internal
       {
         (void)locally_owned_array;
         (void)shared_arrays;
-#ifndef DEAL_II_WITH_MPI
-        (void)ghost_array;
-        (void)requests;
-#else
-        partitioner->export_to_ghosted_array_finish(ghost_array, requests);
-#endif
+        export_to_ghosted_array_finish_impl(ghost_array, requests);
+      }
+
+
+
+      bool
+      PartitionerWrapper::export_to_ghosted_array_test(
+        const unsigned int                          rank,
+        const ArrayView<const double> &             locally_owned_array,
+        const std::vector<ArrayView<const double>> &shared_arrays,
+        const ArrayView<double> &                   ghost_array,
+        std::vector<MPI_Request> &                  requests) const
+      {
+        (void)locally_owned_array;
+        (void)shared_arrays;
+        return export_to_ghosted_array_test_impl(rank, ghost_array, requests);
       }
 
 
@@ -231,12 +242,22 @@ namespace internal
       {
         (void)locally_owned_array;
         (void)shared_arrays;
-#ifndef DEAL_II_WITH_MPI
-        (void)ghost_array;
-        (void)requests;
-#else
-        partitioner->export_to_ghosted_array_finish(ghost_array, requests);
-#endif
+        export_to_ghosted_array_finish_impl(ghost_array, requests);
+      }
+
+
+
+      bool
+      PartitionerWrapper::export_to_ghosted_array_test(
+        const unsigned int                         rank,
+        const ArrayView<const float> &             locally_owned_array,
+        const std::vector<ArrayView<const float>> &shared_arrays,
+        const ArrayView<float> &                   ghost_array,
+        std::vector<MPI_Request> &                 requests) const
+      {
+        (void)locally_owned_array;
+        (void)shared_arrays;
+        return export_to_ghosted_array_test_impl(rank, ghost_array, requests);
       }
 
 
@@ -319,6 +340,153 @@ namespace internal
 
 
 
+      template <typename Number>
+      bool
+      PartitionerWrapper::export_to_ghosted_array_test_impl(
+        const unsigned int        rank,
+        const ArrayView<Number> & ghost_array,
+        std::vector<MPI_Request> &requests) const
+      {
+#ifndef DEAL_II_WITH_MPI
+        (void)rank;
+        (void)ghost_array;
+        (void)requests;
+        return true;
+#else
+        const auto &ghost_targets = partitioner->ghost_targets();
+        const auto  target =
+          std::find_if(ghost_targets.begin(),
+                       ghost_targets.end(),
+                       [rank](const std::pair<unsigned int, unsigned int> &t) {
+                         return t.first == rank;
+                       });
+        if (target == ghost_targets.end() || requests.empty())
+          return true;
+
+        AssertDimension(requests.size(),
+                        ghost_targets.size() +
+                          partitioner->import_targets().size());
+
+        const unsigned int target_index = target - ghost_targets.begin();
+        if (ghost_array.size() == partitioner->n_ghost_indices())
+          {
+            int       flag = 0;
+            const int ierr =
+              MPI_Test(&requests[target_index], &flag, MPI_STATUS_IGNORE);
+            AssertThrowMPI(ierr);
+            return flag != 0;
+          }
+
+        // The data of a subset of ghost indices needs to be moved to its
+        // final position in the order of the ghost targets, because the data
+        // of a process can overwrite the received data of processes with
+        // lower rank. Completed requests are set to MPI_REQUEST_NULL, which
+        // marks the data that has already been moved.
+        for (unsigned int i = 0; i <= target_index; ++i)
+          if (requests[i] != MPI_REQUEST_NULL)
+            {
+              int       flag = 0;
+              const int ierr =
+                MPI_Test(&requests[i], &flag, MPI_STATUS_IGNORE);
+              AssertThrowMPI(ierr);
+              if (flag == 0)
+                return false;
+              move_ghost_values_to_larger_set(i, ghost_array);
+            }
+        return true;
+#endif
+      }
+
+
+
+      template <typename Number>
+      void
+      PartitionerWrapper::export_to_ghosted_array_finish_impl(
+        const ArrayView<Number> & ghost_array,
+        std::vector<MPI_Request> &requests) const
+      {
+#ifndef DEAL_II_WITH_MPI
+        (void)ghost_array;
+        (void)requests;
+#else
+        // In case export_to_ghosted_array_test() has already moved the data
+        // of some processes to their final position, complete the remaining
+        // processes in order of the ghost targets rather than letting the
+        // partitioner move all data at once
+        const unsigned int n_ghost_targets = partitioner->ghost_targets().size();
+        if (ghost_array.size() > partitioner->n_ghost_indices() &&
+            requests.size() > 0 && n_ghost_targets > 0 &&
+            requests[0] == MPI_REQUEST_NULL)
+          {
+            for (unsigned int i = 0; i < n_ghost_targets; ++i)
+              if (requests[i] != MPI_REQUEST_NULL)
+                {
+                  const int ierr = MPI_Wait(&requests[i], MPI_STATUS_IGNORE);
+                  AssertThrowMPI(ierr);
+                  move_ghost_values_to_larger_set(i, ghost_array);
+                }
+            const int ierr =
+              MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+            AssertThrowMPI(ierr);
+            requests.resize(0);
+          }
+        else
+          partitioner->export_to_ghosted_array_finish(ghost_array, requests);
+#endif
+      }
+
+
+
+      template <typename Number>
+      void
+      PartitionerWrapper::move_ghost_values_to_larger_set(
+        const unsigned int       ghost_target_index,
+        const ArrayView<Number> &ghost_array) const
+      {
+        const auto &ghost_targets = partitioner->ghost_targets();
+        AssertIndexRange(ghost_target_index, ghost_targets.size());
+
+        // range of the data of the given process within the subset
+        unsigned int subset_begin = 0;
+        for (unsigned int i = 0; i < ghost_target_index; ++i)
+          subset_begin += ghost_targets[i].second;
+        const unsigned int subset_end =
+          subset_begin + ghost_targets[ghost_target_index].second;
+
+        // the data has been received at the end of the ghost array
+        const unsigned int offset =
+          ghost_array.size() - partitioner->n_ghost_indices();
+
+        unsigned int subset_index = 0;
+        for (const auto &ghost_range :
+             partitioner->ghost_indices_within_larger_ghost_set())
+          {
+            const unsigned int chunk_size =
+              ghost_range.second - ghost_range.first;
+            const unsigned int begin = std::max(subset_index, subset_begin);
+            const unsigned int end =
+              std::min(subset_index + chunk_size, subset_end);
+            if (begin < end)
+              {
+                Number *source      = ghost_array.data() + offset + begin;
+                Number *destination = ghost_array.data() + ghost_range.first +
+                                      (begin - subset_index);
+                if (source != destination)
+                  {
+                    std::copy(source, source + (end - begin), destination);
+                    std::fill(std::max(destination + (end - begin), source),
+                              source + (end - begin),
+                              Number());
+                  }
+              }
+            subset_index += chunk_size;
+            if (subset_index >= subset_end)
+              break;
+          }
+      }
+
+
+
       namespace internal
       {
         std::pair<std::vector<unsigned int>,
@@ -719,6 +887,29 @@ namespace internal
 
 
 
+      bool
+      Full::export_to_ghosted_array_test(
+        const unsigned int                          rank,
+        const ArrayView<const double> &             locally_owned_array,
+        const std::vector<ArrayView<const double>> &shared_arrays,
+        const ArrayView<double> &                   ghost_array,
+        std::vector<MPI_Request> &                  requests) const
+      {
+        (void)rank;
+        (void)locally_owned_array;
+        (void)shared_arrays;
+        (void)ghost_array;
+        (void)requests;
+
+        // the shared-memory and remote data are completed together in
+        // export_to_ghosted_array_finish(), so a test for the data of a
+        // single process is not available
+        AssertThrow(false, ExcNotImplemented());
+        return false;
+      }
+
+
+
       void
       Full::import_from_ghosted_array_start(
         const VectorOperation::values               vector_operation,
@@ -793,6 +984,29 @@ namespace internal
 
 
 
+      bool
+      Full::export_to_ghosted_array_test(
+        const unsigned int                         rank,
+        const ArrayView<const float> &             locally_owned_array,
+        const std::vector<ArrayView<const float>> &shared_arrays,
+        const ArrayView<float> &                   ghost_array,
+        std::vector<MPI_Request> &                 requests) const
+      {
+        (void)rank;
+        (void)locally_owned_array;
+        (void)shared_arrays;
+        (void)ghost_array;
+        (void)requests;
+
+        // the shared-memory and remote data are completed together in
+        // export_to_ghosted_array_finish(), so a test for the data of a
+        // single process is not available
+        AssertThrow(false, ExcNotImplemented());
+        return false;
+      }
+
+
+
       void
       Full::import_from_ghosted_array_start(
         const VectorOperation::values              vector_operation,
@@ -30,6 +30,19 @@
 DEAL_II_NAMESPACE_OPEN
 
 
+template <typename VectorType>
+void
+MGMatrixBase<VectorType>::residual(const unsigned int level,
+                                   VectorType &       dst,
+                                   const VectorType & src,
+                                   const VectorType & rhs) const
+{
+  vmult(level, dst, src);
+  dst.sadd(-1.0, 1.0, rhs);
+}
+
+
+
 template <typename VectorType>
 void
 MGSmootherBase<VectorType>::apply(const unsigned int level,
@@ -430,6 +430,16 @@ MGLevelGlobalTransfer<LinearAlgebra::distributed::Vector<Number>>::
 
 
 
+template <typename Number>
+bool
+MGLevelGlobalTransfer<LinearAlgebra::distributed::Vector<Number>>::
+  performs_plain_copy() const
+{
+  return perform_plain_copy;
+}
+
+
+
 template <typename Number>
 std::size_t
 MGLevelGlobalTransfer<
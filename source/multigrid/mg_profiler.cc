@@ -0,0 +1,234 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/utilities.h>
+
+#include <deal.II/multigrid/mg_profiler.h>
+
+#include <boost/io/ios_state.hpp>
+
+#include <iomanip>
+
+DEAL_II_NAMESPACE_OPEN
+
+
+MGProfiler::MGProfiler(const MPI_Comm mpi_comm)
+  : mpi_comm(mpi_comm)
+{}
+
+
+
+MGProfiler::~MGProfiler()
+{
+  disconnect();
+}
+
+
+
+void
+MGProfiler::disconnect()
+{
+  for (auto &connection : connections)
+    connection.disconnect();
+  connections.clear();
+}
+
+
+
+void
+MGProfiler::reset()
+{
+  for (auto &level_data : data)
+    level_data.fill(Data());
+}
+
+
+
+const MGProfiler::Data &
+MGProfiler::get_data(const unsigned int level, const Operation operation) const
+{
+  AssertIndexRange(level, data.size());
+  AssertIndexRange(static_cast<unsigned int>(operation),
+                   static_cast<unsigned int>(n_operations));
+  return data[level][operation];
+}
+
+
+
+std::string
+MGProfiler::get_operation_name(const Operation operation)
+{
+  switch (operation)
+    {
+      case pre_smoother_step:
+        return "pre-smoother";
+      case residual_step:
+        return "residual";
+      case restriction:
+        return "restriction";
+      case coarse_solve:
+        return "coarse solve";
+      case prolongation:
+        return "prolongation";
+      case edge_prolongation:
+        return "edge prolongation";
+      case post_smoother_step:
+        return "post-smoother";
+      default:
+        Assert(false, ExcNotImplemented());
+        return "";
+    }
+}
+
+
+
+void
+MGProfiler::setup_levels(const unsigned int         min_level,
+                         const unsigned int         max_level,
+                         const std::vector<double> &level_sizes)
+{
+  data.resize(max_level + 1);
+  start_times.resize(max_level + 1);
+  bytes_per_call.assign(max_level + 1, std::array<double, n_operations>());
+
+  if (level_sizes.empty())
+    return;
+
+  AssertDimension(level_sizes.size(), max_level + 1);
+  for (unsigned int l = min_level; l <= max_level; ++l)
+    {
+      const double size        = level_sizes[l];
+      const double size_coarse = l > min_level ? level_sizes[l - 1] : 0.;
+
+      auto &bytes               = bytes_per_call[l];
+      bytes[pre_smoother_step]  = 3. * size;
+      bytes[residual_step]      = 3. * size;
+      bytes[restriction]        = size + size_coarse;
+      bytes[coarse_solve]       = 2. * size;
+      bytes[prolongation]       = 2. * size + size_coarse;
+      bytes[post_smoother_step] = 3. * size;
+    }
+}
+
+
+
+void
+MGProfiler::record(const Operation    operation,
+                   const bool         before,
+                   const unsigned int level)
+{
+  AssertIndexRange(level, data.size());
+
+  if (before)
+    start_times[level][operation] = std::chrono::steady_clock::now();
+  else
+    {
+      Data &entry = data[level][operation];
+      entry.wall_time += std::chrono::duration<double>(
+                           std::chrono::steady_clock::now() -
+                           start_times[level][operation])
+                           .count();
+      ++entry.n_calls;
+      entry.bytes += bytes_per_call[level][operation];
+    }
+}
+
+
+
+void
+MGProfiler::print_summary(std::ostream &out) const
+{
+  // we are going to change the precision and width of output below. store the
+  // old values so the get restored when exiting this function
+  const boost::io::ios_base_all_saver restore_stream(out);
+
+  const unsigned int n_levels =
+    Utilities::MPI::max(static_cast<unsigned int>(data.size()), mpi_comm);
+
+  // combine the data of all processes, with the same number of entries on
+  // all of them
+  std::vector<double> wall_times(n_levels * n_operations);
+  std::vector<double> bytes(n_levels * n_operations);
+  std::vector<double> n_calls(n_levels * n_operations);
+  for (unsigned int l = 0; l < data.size(); ++l)
+    for (unsigned int o = 0; o < n_operations; ++o)
+      {
+        wall_times[l * n_operations + o] = data[l][o].wall_time;
+        bytes[l * n_operations + o]      = data[l][o].bytes;
+        n_calls[l * n_operations + o]    = data[l][o].n_calls;
+      }
+
+  const std::vector<Utilities::MPI::MinMaxAvg> time_statistics =
+    Utilities::MPI::min_max_avg(wall_times, mpi_comm);
+  Utilities::MPI::sum(bytes, mpi_comm, bytes);
+  Utilities::MPI::max(n_calls, mpi_comm, n_calls);
+
+  if (Utilities::MPI::this_mpi_process(mpi_comm) != 0)
+    return;
+
+  double total_wall_time = 0.;
+  for (const auto &statistics : time_statistics)
+    total_wall_time += statistics.avg;
+
+  out << "\n\n+---------------------------------+-----------+------------"
+      << "+------------+------------+------------+\n"
+      << "| Multigrid level operation       | no. calls |  wall time "
+      << "| % of total |  wait time |   GByte/s  |\n"
+      << "+---------------------------------+-----------+------------"
+      << "+------------+------------+------------+\n";
+
+  for (unsigned int l = n_levels; l-- > 0;)
+    for (unsigned int o = 0; o < n_operations; ++o)
+      {
+        const unsigned int index = l * n_operations + o;
+        if (n_calls[index] == 0)
+          continue;
+
+        const Utilities::MPI::MinMaxAvg &statistics = time_statistics[index];
+
+        std::string name = "level " + std::to_string(l) + " " +
+                           get_operation_name(static_cast<Operation>(o));
+        name.resize(32, ' ');
+
+        out << "| " << name << "| " << std::setw(9)
+            << static_cast<unsigned long int>(n_calls[index]) << " |"
+            << std::setw(10) << std::setprecision(3) << statistics.avg
+            << "s |" << std::setw(10);
+
+        // if run time was less than 0.1%, just print a zero to avoid printing
+        // silly things such as "2.45e-6%"
+        const double fraction =
+          total_wall_time > 0. ? statistics.avg / total_wall_time : 0.;
+        if (fraction > 0.001)
+          out << std::setprecision(2) << fraction * 100;
+        else
+          out << 0.0;
+        out << "% |" << std::setw(10) << std::setprecision(3)
+            << statistics.max - statistics.avg << "s |" << std::setw(11);
+
+        if (bytes[index] > 0. && statistics.max > 0.)
+          out << std::setprecision(3) << bytes[index] * 1e-9 / statistics.max;
+        else
+          out << "-";
+        out << " |\n";
+      }
+
+  out << "+---------------------------------+-----------+------------"
+      << "+------------+------------+------------+\n"
+      << std::endl;
+}
+
+DEAL_II_NAMESPACE_CLOSE
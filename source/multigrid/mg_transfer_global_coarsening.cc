@@ -13,6 +13,8 @@
 //
 // ---------------------------------------------------------------------
 
+#include <deal.II/base/table.h>
+
 #include <deal.II/multigrid/mg_transfer_global_coarsening.templates.h>
 
 DEAL_II_NAMESPACE_OPEN
@@ -55,6 +57,85 @@ namespace MGTransferGlobalCoarseningTools
 
     return degrees;
   }
+
+
+
+  std::vector<HybridCoarseningLevel>
+  create_hybrid_coarsening_sequence(
+    const std::vector<types::global_cell_index> &n_cells,
+    const unsigned int                           fine_degree,
+    const HybridCoarseningCosts &                costs)
+  {
+    Assert(n_cells.size() > 0,
+           ExcMessage("At least one triangulation is needed."));
+    Assert(fine_degree > 0, ExcMessage("The degree must be positive."));
+    Assert(costs.level_cost && costs.coarse_solver_cost,
+           ExcMessage("Both cost functions need to be provided."));
+
+    const unsigned int n_geometric_levels = n_cells.size();
+
+    // For each pair of geometric level and degree, the minimal cost of the
+    // V-cycle from that level downwards and the next coarser level in the
+    // optimal hierarchy, or invalid if the coarse solver is called there.
+    // The successors of a level have a smaller geometric level or degree,
+    // so iterating over both in ascending order sees them first.
+    Table<2, double>                cost(n_geometric_levels, fine_degree + 1);
+    Table<2, HybridCoarseningLevel> next(n_geometric_levels, fine_degree + 1);
+
+    const HybridCoarseningLevel invalid_level{numbers::invalid_unsigned_int,
+                                              numbers::invalid_unsigned_int};
+
+    for (unsigned int g = 0; g < n_geometric_levels; ++g)
+      for (unsigned int p = 1; p <= fine_degree; ++p)
+        {
+          cost[g][p] = costs.coarse_solver_cost(p, n_cells[g]);
+          next[g][p] = invalid_level;
+
+          const double this_level_cost = costs.level_cost(p, n_cells[g]);
+          const auto   try_successor   = [&](const unsigned int g_coarse,
+                                         const unsigned int p_coarse) {
+            const double candidate =
+              this_level_cost + cost[g_coarse][p_coarse];
+            if (candidate < cost[g][p])
+              {
+                cost[g][p] = candidate;
+                next[g][p] = HybridCoarseningLevel{g_coarse, p_coarse};
+              }
+          };
+
+          if (g > 0)
+            try_successor(g - 1, p);
+
+          std::vector<unsigned int> coarser_degrees;
+          for (const auto p_sequence :
+               {PolynomialCoarseningSequenceType::decrease_by_one,
+                PolynomialCoarseningSequenceType::bisect,
+                PolynomialCoarseningSequenceType::go_to_one})
+            {
+              const unsigned int p_coarse =
+                create_next_polynomial_coarsening_degree(p, p_sequence);
+              if (p_coarse < p &&
+                  std::find(coarser_degrees.begin(),
+                            coarser_degrees.end(),
+                            p_coarse) == coarser_degrees.end())
+                {
+                  coarser_degrees.push_back(p_coarse);
+                  try_successor(g, p_coarse);
+                }
+            }
+        }
+
+    std::vector<HybridCoarseningLevel> levels{
+      HybridCoarseningLevel{n_geometric_levels - 1, fine_degree}};
+    while (next[levels.back().geometric_level][levels.back().degree]
+             .geometric_level != numbers::invalid_unsigned_int)
+      levels.push_back(
+        next[levels.back().geometric_level][levels.back().degree]);
+
+    std::reverse(levels.begin(), levels.end());
+
+    return levels;
+  }
 } // namespace MGTransferGlobalCoarseningTools
 
 #include "mg_transfer_global_coarsening.inst"
@@ -14,6 +14,7 @@
 // ---------------------------------------------------------------------
 
 #include <deal.II/base/exceptions.h>
+#include <deal.II/base/mpi_remote_point_evaluation.h>
 #include <deal.II/base/point.h>
 #include <deal.II/base/tensor.h>
 
@@ -166,6 +167,149 @@ namespace NonMatching
           gtl1[i] = j++;
       return {gtl0, gtl1};
     }
+
+
+
+    /**
+     * Loop over the pairs of locally owned cells of the embedding
+     * triangulation and groups of quadrature points of the immersed
+     * triangulation, if the latter is a
+     * parallel::distributed::Triangulation.
+     *
+     * Each process computes the real-space quadrature points of its locally
+     * owned immersed cells and sends them to the processes owning the
+     * embedding cells they lie in with Utilities::MPI::RemotePointEvaluation.
+     * Along with each point, the indices of the degrees of freedom of its
+     * immersed cell and, if @p compute_values is true, the values of the
+     * immersed shape functions times the JxW value at the point are sent.
+     * For each locally owned embedding cell and each group of consecutive
+     * points in it that belong to the same immersed cell, @p worker is then
+     * called with the embedding cell, the reference coordinates of the
+     * points in it, the immersed degrees of freedom, and the immersed values,
+     * stored point by point.
+     */
+    template <int dim0, int dim1, int spacedim, typename Worker>
+    void
+    distributed_coupling_loop(const GridTools::Cache<dim0, spacedim> &cache,
+                              const DoFHandler<dim0, spacedim> &space_dh,
+                              const DoFHandler<dim1, spacedim> &immersed_dh,
+                              const Quadrature<dim1> &          quad,
+                              const Mapping<dim1, spacedim> &immersed_mapping,
+                              const bool                     compute_values,
+                              const Worker &                 worker)
+    {
+      const auto &       immersed_fe = immersed_dh.get_fe();
+      const unsigned int n_dofs      = immersed_fe.n_dofs_per_cell();
+
+      // Collect the quadrature points of the locally owned immersed cells
+      // and the data to send along with them
+      std::vector<Point<spacedim>>         points;
+      std::vector<types::global_dof_index> point_dofs;
+      std::vector<double>                  point_values;
+      {
+        const UpdateFlags flags =
+          compute_values ?
+            update_quadrature_points | update_values | update_JxW_values :
+            update_quadrature_points;
+        FEValues<dim1, spacedim> fe_v(immersed_mapping,
+                                      immersed_fe,
+                                      quad,
+                                      flags);
+        std::vector<types::global_dof_index> dofs(n_dofs);
+        for (const auto &cell : immersed_dh.active_cell_iterators() |
+                                  IteratorFilters::LocallyOwnedCell())
+          {
+            fe_v.reinit(cell);
+            cell->get_dof_indices(dofs);
+            for (const unsigned int q : fe_v.quadrature_point_indices())
+              {
+                points.push_back(fe_v.quadrature_point(q));
+                point_dofs.insert(point_dofs.end(), dofs.begin(), dofs.end());
+                if (compute_values)
+                  for (unsigned int j = 0; j < n_dofs; ++j)
+                    point_values.push_back(fe_v.shape_value(j, q) *
+                                           fe_v.JxW(q));
+              }
+          }
+      }
+
+      Utilities::MPI::RemotePointEvaluation<dim0, spacedim> rpe(1e-6, true);
+      rpe.reinit(points, cache.get_triangulation(), cache.get_mapping());
+
+      using CellData =
+        typename Utilities::MPI::RemotePointEvaluation<dim0,
+                                                       spacedim>::CellData;
+
+      // Send the data to the processes owning the points
+      std::vector<types::global_dof_index> received_dofs;
+      std::vector<types::global_dof_index> dofs_buffer;
+      const CellData *                     cell_data_ptr = nullptr;
+      rpe.template process_and_evaluate<types::global_dof_index>(
+        point_dofs,
+        dofs_buffer,
+        [&](const ArrayView<const types::global_dof_index> &values,
+            const CellData &                                cell_data) {
+          received_dofs.assign(values.begin(), values.end());
+          cell_data_ptr = &cell_data;
+        },
+        n_dofs);
+
+      std::vector<double> received_values;
+      if (compute_values)
+        {
+          std::vector<double> values_buffer;
+          rpe.template process_and_evaluate<double>(
+            point_values,
+            values_buffer,
+            [&](const ArrayView<const double> &values, const CellData &) {
+              received_values.assign(values.begin(), values.end());
+            },
+            n_dofs);
+        }
+
+      // Loop over the embedding cells and the groups of points in them
+      Assert(cell_data_ptr != nullptr, ExcInternalError());
+      const CellData &cell_data = *cell_data_ptr;
+      for (unsigned int c = 0; c < cell_data.cells.size(); ++c)
+        {
+          const typename DoFHandler<dim0, spacedim>::active_cell_iterator
+            ocell(&cache.get_triangulation(),
+                  cell_data.cells[c].first,
+                  cell_data.cells[c].second,
+                  &space_dh);
+
+          const unsigned int end = cell_data.reference_point_ptrs[c + 1];
+          for (unsigned int begin = cell_data.reference_point_ptrs[c];
+               begin < end;)
+            {
+              const auto dofs_begin = received_dofs.begin() + begin * n_dofs;
+
+              unsigned int group_end = begin + 1;
+              while (group_end < end &&
+                     std::equal(dofs_begin,
+                                dofs_begin + n_dofs,
+                                received_dofs.begin() + group_end * n_dofs))
+                ++group_end;
+
+              worker(ocell,
+                     make_array_view(cell_data.reference_point_values.begin() +
+                                       begin,
+                                     cell_data.reference_point_values.begin() +
+                                       group_end),
+                     make_array_view(received_dofs.begin() + begin * n_dofs,
+                                     received_dofs.begin() +
+                                       (begin + 1) * n_dofs),
+                     compute_values ?
+                       make_array_view(received_values.begin() +
+                                         begin * n_dofs,
+                                       received_values.begin() +
+                                         group_end * n_dofs) :
+                       ArrayView<double>());
+
+              begin = group_end;
+            }
+        }
+    }
   } // namespace internal
 
   template <int dim0, int dim1, int spacedim, typename number>
@@ -216,10 +360,41 @@ namespace NonMatching
     AssertDimension(sparsity.n_cols(), immersed_dh.n_dofs());
     Assert(dim1 <= dim0,
            ExcMessage("This function can only work if dim1 <= dim0"));
-    Assert((dynamic_cast<
-              const parallel::distributed::Triangulation<dim1, spacedim> *>(
-              &immersed_dh.get_triangulation()) == nullptr),
-           ExcNotImplemented());
+
+    if (dynamic_cast<
+          const parallel::distributed::Triangulation<dim1, spacedim> *>(
+          &immersed_dh.get_triangulation()) != nullptr)
+      {
+        Assert(immersed_constraints.n_constraints() == 0,
+               ExcMessage("Constraints on the immersed degrees of freedom "
+                          "are not supported for distributed immersed "
+                          "triangulations."));
+
+        std::vector<types::global_dof_index> dofs(
+          immersed_dh.get_fe().n_dofs_per_cell());
+        std::vector<types::global_dof_index> odofs(
+          space_dh.get_fe().n_dofs_per_cell());
+
+        internal::distributed_coupling_loop(
+          cache,
+          space_dh,
+          immersed_dh,
+          quad,
+          immersed_mapping,
+          false,
+          [&](const auto &ocell,
+              const auto &,
+              const auto &immersed_dofs,
+              const auto &) {
+            ocell->get_dof_indices(odofs);
+            dofs.assign(immersed_dofs.begin(), immersed_dofs.end());
+            constraints.add_entries_local_to_global(odofs,
+                                                    immersed_constraints,
+                                                    dofs,
+                                                    sparsity);
+          });
+        return;
+      }
 
     const bool tria_is_parallel =
       (dynamic_cast<const parallel::TriangulationBase<dim1, spacedim> *>(
@@ -406,10 +581,81 @@ namespace NonMatching
     AssertDimension(matrix.n(), immersed_dh.n_dofs());
     Assert(dim1 <= dim0,
            ExcMessage("This function can only work if dim1 <= dim0"));
-    Assert((dynamic_cast<
-              const parallel::distributed::Triangulation<dim1, spacedim> *>(
-              &immersed_dh.get_triangulation()) == nullptr),
-           ExcNotImplemented());
+
+    if (dynamic_cast<
+          const parallel::distributed::Triangulation<dim1, spacedim> *>(
+          &immersed_dh.get_triangulation()) != nullptr)
+      {
+        Assert(immersed_constraints.n_constraints() == 0,
+               ExcMessage("Constraints on the immersed degrees of freedom "
+                          "are not supported for distributed immersed "
+                          "triangulations."));
+
+        const auto &space_fe    = space_dh.get_fe();
+        const auto &immersed_fe = immersed_dh.get_fe();
+        Assert(space_fe.is_primitive() && immersed_fe.is_primitive(),
+               ExcNotImplemented());
+
+        const auto gtl = internal::compute_components_coupling(space_comps,
+                                                               immersed_comps,
+                                                               space_fe,
+                                                               immersed_fe);
+        const auto &space_gtl    = gtl.first;
+        const auto &immersed_gtl = gtl.second;
+
+        std::vector<types::global_dof_index> dofs(
+          immersed_fe.n_dofs_per_cell());
+        std::vector<types::global_dof_index> odofs(space_fe.n_dofs_per_cell());
+        std::vector<double> space_values(space_fe.n_dofs_per_cell());
+        FullMatrix<typename Matrix::value_type> cell_matrix(
+          space_fe.n_dofs_per_cell(), immersed_fe.n_dofs_per_cell());
+
+        internal::distributed_coupling_loop(
+          cache,
+          space_dh,
+          immersed_dh,
+          quad,
+          immersed_mapping,
+          true,
+          [&](const auto &ocell,
+              const auto &reference_points,
+              const auto &immersed_dofs,
+              const auto &immersed_values) {
+            ocell->get_dof_indices(odofs);
+            dofs.assign(immersed_dofs.begin(), immersed_dofs.end());
+
+            // Reset the matrices.
+            cell_matrix = typename Matrix::value_type();
+
+            for (unsigned int q = 0; q < reference_points.size(); ++q)
+              {
+                for (unsigned int i = 0; i < space_values.size(); ++i)
+                  space_values[i] =
+                    space_fe.shape_value(i, reference_points[q]);
+
+                for (unsigned int i = 0; i < space_values.size(); ++i)
+                  {
+                    const auto comp_i =
+                      space_fe.system_to_component_index(i).first;
+                    if (space_gtl[comp_i] != numbers::invalid_unsigned_int)
+                      for (unsigned int j = 0; j < dofs.size(); ++j)
+                        {
+                          const auto comp_j =
+                            immersed_fe.system_to_component_index(j).first;
+                          if (space_gtl[comp_i] == immersed_gtl[comp_j])
+                            cell_matrix(i, j) +=
+                              space_values[i] *
+                              immersed_values[q * dofs.size() + j];
+                        }
+                  }
+              }
+
+            // Now assemble the matrices
+            constraints.distribute_local_to_global(
+              cell_matrix, odofs, immersed_constraints, dofs, matrix);
+          });
+        return;
+      }
 
     const bool tria_is_parallel =
       (dynamic_cast<const parallel::TriangulationBase<dim1, spacedim> *>(
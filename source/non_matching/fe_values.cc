@@ -58,10 +58,11 @@ namespace NonMatching
     , q_collection_1D(quadrature)
     , region_update_flags(region_update_flags)
     , mesh_classifier(&mesh_classifier)
-    , quadrature_generator(q_collection_1D,
-                           dof_handler,
-                           level_set,
-                           additional_data)
+    , quadrature_generator(
+        std::make_unique<DiscreteQuadratureGenerator<dim>>(q_collection_1D,
+                                                           dof_handler,
+                                                           level_set,
+                                                           additional_data))
   {
     // Tensor products of each quadrature in q_collection_1D. Used on the
     // non-intersected cells.
@@ -90,10 +91,30 @@ namespace NonMatching
     , q_collection_1D(q_collection_1D)
     , region_update_flags(region_update_flags)
     , mesh_classifier(&mesh_classifier)
-    , quadrature_generator(q_collection_1D,
-                           dof_handler,
-                           level_set,
-                           additional_data)
+    , quadrature_generator(
+        std::make_unique<DiscreteQuadratureGenerator<dim>>(q_collection_1D,
+                                                           dof_handler,
+                                                           level_set,
+                                                           additional_data))
+  {
+    initialize(q_collection);
+  }
+
+
+
+  template <int dim>
+  FEValues<dim>::FEValues(const hp::MappingCollection<dim> &mapping_collection,
+                          const hp::FECollection<dim> &     fe_collection,
+                          const hp::QCollection<dim> &      q_collection,
+                          const RegionUpdateFlags           region_update_flags,
+                          const MeshClassifier<dim> &       mesh_classifier,
+                          const QuadratureCache<dim> &      quadrature_cache)
+    : mapping_collection(&mapping_collection)
+    , fe_collection(&fe_collection)
+    , q_collection_1D(quadrature_cache.get_quadratures_1D())
+    , region_update_flags(region_update_flags)
+    , mesh_classifier(&mesh_classifier)
+    , quadrature_cache(&quadrature_cache)
   {
     initialize(q_collection);
   }
@@ -180,17 +201,26 @@ namespace NonMatching
             const unsigned int mapping_index =
               mapping_collection->size() > 1 ? active_fe_index : 0;
 
-            const unsigned int q1D_index =
-              q_collection_1D.size() > 1 ? active_fe_index : 0;
-            quadrature_generator.set_1D_quadrature(q1D_index);
-            quadrature_generator.generate(cell);
+            if (quadrature_cache == nullptr)
+              {
+                const unsigned int q1D_index =
+                  q_collection_1D.size() > 1 ? active_fe_index : 0;
+                quadrature_generator->set_1D_quadrature(q1D_index);
+                quadrature_generator->generate(cell);
+              }
 
             const Quadrature<dim> &inside_quadrature =
-              quadrature_generator.get_inside_quadrature();
+              quadrature_cache != nullptr ?
+                quadrature_cache->get_inside_quadrature(cell) :
+                quadrature_generator->get_inside_quadrature();
             const Quadrature<dim> &outside_quadrature =
-              quadrature_generator.get_outside_quadrature();
+              quadrature_cache != nullptr ?
+                quadrature_cache->get_outside_quadrature(cell) :
+                quadrature_generator->get_outside_quadrature();
             const ImmersedSurfaceQuadrature<dim> &surface_quadrature =
-              quadrature_generator.get_surface_quadrature();
+              quadrature_cache != nullptr ?
+                quadrature_cache->get_surface_quadrature(cell) :
+                quadrature_generator->get_surface_quadrature();
 
             // Even if a cell is formally intersected the number of created
             // quadrature points can be 0. Avoid creating an FEValues object
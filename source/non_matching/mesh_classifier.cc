@@ -13,6 +13,7 @@
 //
 // ---------------------------------------------------------------------
 
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/quadrature.h>
 
 #include <deal.II/dofs/dof_accessor.h>
@@ -37,6 +38,7 @@
 #include <deal.II/non_matching/mesh_classifier.h>
 
 #include <algorithm>
+#include <tuple>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -96,6 +98,13 @@ namespace NonMatching
         /**
          * Return the FECollection of the DoFHandler passed to the constructor.
          */
+        /**
+         * Return a copy of this object, which refers to the same DoFHandler
+         * and vector.
+         */
+        std::unique_ptr<LevelSetDescription<dim>>
+        clone() const override;
+
         const hp::FECollection<dim> &
         get_fe_collection() const override;
 
@@ -142,6 +151,16 @@ namespace NonMatching
 
 
 
+      template <int dim, class VectorType>
+      std::unique_ptr<LevelSetDescription<dim>>
+      DiscreteLevelSetDescription<dim, VectorType>::clone() const
+      {
+        return std::make_unique<DiscreteLevelSetDescription<dim, VectorType>>(
+          *dof_handler, *level_set);
+      }
+
+
+
       template <int dim, class VectorType>
       const hp::FECollection<dim> &
       DiscreteLevelSetDescription<dim, VectorType>::get_fe_collection() const
@@ -209,6 +228,12 @@ namespace NonMatching
         AnalyticLevelSetDescription(const Function<dim> &     level_set,
                                     const FiniteElement<dim> &element);
 
+        /**
+         * Return a copy of this object with its own FEFaceValues object.
+         */
+        std::unique_ptr<LevelSetDescription<dim>>
+        clone() const override;
+
         /**
          * Returns the finite element passed to the constructor wrapped in a
          * collection.
@@ -269,6 +294,16 @@ namespace NonMatching
 
 
 
+      template <int dim>
+      std::unique_ptr<LevelSetDescription<dim>>
+      AnalyticLevelSetDescription<dim>::clone() const
+      {
+        return std::make_unique<AnalyticLevelSetDescription<dim>>(
+          *level_set, fe_collection[0]);
+      }
+
+
+
       template <int dim>
       void
       AnalyticLevelSetDescription<dim>::get_local_level_set_values(
@@ -368,29 +403,169 @@ namespace NonMatching
     face_locations.assign(triangulation->n_raw_faces(),
                           LocationToLevelSet::unassigned);
 
-    // Loop over all cells and determine the location of all non artificial
-    // cells and faces.
+    // Determine the location of all non artificial cells and faces.
+    std::vector<typename Triangulation<dim>::active_cell_iterator> cells;
     for (const auto &cell : triangulation->active_cell_iterators())
       if (!cell->is_artificial())
-        {
-          const LocationToLevelSet face0_location =
-            determine_face_location_to_levelset(cell, 0);
+        cells.push_back(cell);
+    classify_cells(cells);
+  }
 
-          face_locations[cell->face(0)->index()] = face0_location;
-          LocationToLevelSet cell_location       = face0_location;
 
-          for (unsigned int f = 1; f < GeometryInfo<dim>::faces_per_cell; ++f)
-            {
-              const LocationToLevelSet face_location =
-                determine_face_location_to_levelset(cell, f);
 
-              face_locations[cell->face(f)->index()] = face_location;
+  template <int dim>
+  void
+  MeshClassifier<dim>::reclassify(
+    const std::vector<typename Triangulation<dim>::active_cell_iterator>
+      &cells_to_check)
+  {
+    Assert(cell_locations.size() == triangulation->n_active_cells() &&
+             face_locations.size() == triangulation->n_raw_faces(),
+           internal::MeshClassifierImplementation::ExcReclassifyNotCalled());
+#ifdef DEBUG
+    for (const auto &cell : cells_to_check)
+      {
+        Assert(&cell->get_triangulation() == triangulation,
+               internal::MeshClassifierImplementation::
+                 ExcTriangulationMismatch());
+        Assert(!cell->is_artificial(),
+               ExcMessage("Artificial cells can not be classified."));
+      }
+#endif
+
+    classify_cells(cells_to_check);
+  }
+
 
-              if (face_location != face0_location)
+
+  template <int dim>
+  std::vector<typename Triangulation<dim>::active_cell_iterator>
+  MeshClassifier<dim>::get_cells_near_interface(
+    const unsigned int n_layers) const
+  {
+    Assert(cell_locations.size() == triangulation->n_active_cells(),
+           internal::MeshClassifierImplementation::ExcReclassifyNotCalled());
+
+    std::vector<typename Triangulation<dim>::active_cell_iterator> band;
+
+    std::vector<bool> is_in_band(triangulation->n_active_cells(), false);
+    const auto        add_to_band =
+      [&](const typename Triangulation<dim>::active_cell_iterator &cell) {
+        if (!cell->is_artificial() && !is_in_band[cell->active_cell_index()])
+          {
+            is_in_band[cell->active_cell_index()] = true;
+            band.push_back(cell);
+          }
+      };
+
+    for (const auto &cell : triangulation->active_cell_iterators())
+      if (cell_locations[cell->active_cell_index()] ==
+          LocationToLevelSet::intersected)
+        add_to_band(cell);
+
+    // Add one layer of face neighbors after the other, each time to the
+    // cells added in the previous layer
+    std::size_t layer_begin = 0;
+    for (unsigned int layer = 0; layer < n_layers; ++layer)
+      {
+        const std::size_t layer_end = band.size();
+        for (std::size_t i = layer_begin; i < layer_end; ++i)
+          {
+            const auto cell = band[i];
+            for (const unsigned int f : cell->face_indices())
+              if (!cell->at_boundary(f))
+                {
+                  const auto neighbor = cell->neighbor(f);
+                  if (neighbor->is_active())
+                    add_to_band(neighbor);
+                  else if (dim == 1)
+                    {
+                      auto neighbor_child = neighbor;
+                      while (neighbor_child->has_children())
+                        neighbor_child = neighbor_child->child(1 - f);
+                      add_to_band(neighbor_child);
+                    }
+                  else
+                    for (unsigned int sf = 0;
+                         sf < cell->face(f)->n_children();
+                         ++sf)
+                      add_to_band(cell->neighbor_child_on_subface(f, sf));
+                }
+          }
+        layer_begin = layer_end;
+      }
+
+    return band;
+  }
+
+
+
+  template <int dim>
+  void
+  MeshClassifier<dim>::classify_cells(
+    const std::vector<typename Triangulation<dim>::active_cell_iterator>
+      &cells)
+  {
+    // Collect each face of the cells once, together with one of the cells it
+    // belongs to, so that every face is classified by exactly one task.
+    std::vector<std::tuple<unsigned int,
+                           typename Triangulation<dim>::active_cell_iterator,
+                           unsigned int>>
+      faces;
+    faces.reserve(cells.size() * GeometryInfo<dim>::faces_per_cell);
+    for (const auto &cell : cells)
+      for (const unsigned int f : cell->face_indices())
+        faces.emplace_back(cell->face(f)->index(), cell, f);
+    std::sort(faces.begin(),
+              faces.end(),
+              [](const auto &a, const auto &b) {
+                return std::get<0>(a) < std::get<0>(b);
+              });
+    faces.erase(std::unique(faces.begin(),
+                            faces.end(),
+                            [](const auto &a, const auto &b) {
+                              return std::get<0>(a) == std::get<0>(b);
+                            }),
+                faces.end());
+
+    parallel::apply_to_subranges(
+      std::size_t(0),
+      faces.size(),
+      [&](const std::size_t begin, const std::size_t end) {
+        // The level set description may hold scratch data, so every task
+        // works on its own copy
+        const auto level_set = level_set_description->clone();
+        Vector<double> local_levelset_values;
+        for (std::size_t i = begin; i < end; ++i)
+          face_locations[std::get<0>(faces[i])] =
+            determine_face_location_to_levelset(std::get<1>(faces[i]),
+                                                std::get<2>(faces[i]),
+                                                *level_set,
+                                                local_levelset_values);
+      },
+      32);
+
+    // A cell is intersected if its faces have different locations.
+    parallel::apply_to_subranges(
+      std::size_t(0),
+      cells.size(),
+      [&](const std::size_t begin, const std::size_t end) {
+        for (std::size_t c = begin; c < end; ++c)
+          {
+            const auto &             cell = cells[c];
+            const LocationToLevelSet face0_location =
+              face_locations[cell->face(0)->index()];
+            LocationToLevelSet cell_location = face0_location;
+
+            for (unsigned int f = 1; f < GeometryInfo<dim>::faces_per_cell;
+                 ++f)
+              if (face_locations[cell->face(f)->index()] != face0_location)
                 cell_location = LocationToLevelSet::intersected;
-            }
-          cell_locations[cell->active_cell_index()] = cell_location;
-        }
+
+            cell_locations[cell->active_cell_index()] = cell_location;
+          }
+      },
+      256);
   }
 
 
@@ -399,25 +574,21 @@ namespace NonMatching
   LocationToLevelSet
   MeshClassifier<dim>::determine_face_location_to_levelset(
     const typename Triangulation<dim>::active_cell_iterator &cell,
-    const unsigned int                                       face_index)
+    const unsigned int                                       face_index,
+    internal::MeshClassifierImplementation::LevelSetDescription<dim>
+      &             level_set,
+    Vector<double> &local_levelset_values) const
   {
-    // The location of the face might already be computed on the neighboring
-    // cell. If this is the case we just return the value.
-    const LocationToLevelSet location =
-      face_locations.at(cell->face(face_index)->index());
-    if (location != LocationToLevelSet::unassigned)
-      return location;
-
     // Determine the location by changing basis to FE_Bernstein and checking
     // the signs of the dofs.
-    const unsigned int fe_index = level_set_description->active_fe_index(cell);
+    const unsigned int fe_index = level_set.active_fe_index(cell);
     const unsigned int n_local_dofs =
       lagrange_to_bernstein_face[fe_index][face_index].m();
 
-    Vector<double> local_levelset_values(n_local_dofs);
-    level_set_description->get_local_level_set_values(cell,
-                                                      face_index,
-                                                      local_levelset_values);
+    local_levelset_values.reinit(n_local_dofs);
+    level_set.get_local_level_set_values(cell,
+                                         face_index,
+                                         local_levelset_values);
 
     lagrange_to_bernstein_face[fe_index][face_index].solve(
       local_levelset_values);
@@ -0,0 +1,209 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+#include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/parallel.h>
+
+#include <deal.II/lac/block_vector.h>
+#include <deal.II/lac/la_parallel_block_vector.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/la_vector.h>
+#include <deal.II/lac/petsc_block_vector.h>
+#include <deal.II/lac/petsc_vector.h>
+#include <deal.II/lac/trilinos_epetra_vector.h>
+#include <deal.II/lac/trilinos_parallel_block_vector.h>
+#include <deal.II/lac/trilinos_tpetra_vector.h>
+#include <deal.II/lac/trilinos_vector.h>
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/non_matching/quadrature_cache.h>
+
+#include <atomic>
+#include <memory>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace NonMatching
+{
+  template <int dim>
+  QuadratureCache<dim>::QuadratureCache(
+    const hp::QCollection<1> & quadratures1D,
+    const MeshClassifier<dim> &mesh_classifier,
+    const AdditionalData &     additional_data)
+    : quadratures1D(quadratures1D)
+    , mesh_classifier(&mesh_classifier)
+    , additional_data(additional_data)
+  {}
+
+
+
+  template <int dim>
+  template <class VectorType>
+  unsigned int
+  QuadratureCache<dim>::update(const DoFHandler<dim> &dof_handler,
+                               const VectorType &     level_set)
+  {
+    const Triangulation<dim> &triangulation = dof_handler.get_triangulation();
+    if (cell_data.size() != triangulation.n_active_cells())
+      {
+        cell_data.clear();
+        cell_data.resize(triangulation.n_active_cells());
+      }
+
+    std::vector<typename DoFHandler<dim>::active_cell_iterator> cells;
+    for (const auto &cell : dof_handler.active_cell_iterators())
+      if (!cell->is_artificial())
+        cells.push_back(cell);
+
+    std::atomic<unsigned int> n_generated(0);
+    parallel::apply_to_subranges(
+      std::size_t(0),
+      cells.size(),
+      [&](const std::size_t begin, const std::size_t end) {
+        // The generator is only created once a cell needs new quadrature
+        // rules, which is rare for slowly moving interfaces
+        std::unique_ptr<DiscreteQuadratureGenerator<dim>> generator;
+        std::vector<double>                               level_set_values;
+        unsigned int n_generated_on_range = 0;
+
+        for (std::size_t c = begin; c < end; ++c)
+          {
+            const auto &cell = cells[c];
+            CellData &  data = cell_data[cell->active_cell_index()];
+
+            if (mesh_classifier->location_to_level_set(cell) !=
+                LocationToLevelSet::intersected)
+              {
+                data = CellData();
+                continue;
+              }
+
+            const unsigned int q_index =
+              quadratures1D.size() > 1 ? cell->active_fe_index() : 0;
+            level_set_values.resize(cell->get_fe().n_dofs_per_cell());
+            cell->get_dof_values(level_set,
+                                 level_set_values.begin(),
+                                 level_set_values.end());
+            if (data.is_intersected && data.q_index == q_index &&
+                data.level_set_values == level_set_values)
+              continue;
+
+            if (generator == nullptr)
+              generator = std::make_unique<DiscreteQuadratureGenerator<dim>>(
+                quadratures1D, dof_handler, level_set, additional_data);
+            generator->set_1D_quadrature(q_index);
+            generator->generate(cell);
+
+            data.is_intersected     = true;
+            data.q_index            = q_index;
+            data.level_set_values   = level_set_values;
+            data.inside_quadrature  = generator->get_inside_quadrature();
+            data.outside_quadrature = generator->get_outside_quadrature();
+            data.surface_quadrature = generator->get_surface_quadrature();
+            ++n_generated_on_range;
+          }
+        n_generated += n_generated_on_range;
+      },
+      16);
+
+    return n_generated;
+  }
+
+
+
+  template <int dim>
+  void
+  QuadratureCache<dim>::clear()
+  {
+    cell_data.clear();
+  }
+
+
+
+  template <int dim>
+  const typename QuadratureCache<dim>::CellData &
+  QuadratureCache<dim>::get_cell_data(
+    const typename Triangulation<dim>::cell_iterator &cell) const
+  {
+    AssertIndexRange(cell->active_cell_index(), cell_data.size());
+    const CellData &data = cell_data[cell->active_cell_index()];
+    Assert(data.is_intersected,
+           ExcMessage("There are no quadrature rules stored for this cell. "
+                      "Either the cell was not intersected in the last call "
+                      "to update(), or update() has not been called since "
+                      "the cell has become intersected."));
+    return data;
+  }
+
+
+
+  template <int dim>
+  const Quadrature<dim> &
+  QuadratureCache<dim>::get_inside_quadrature(
+    const typename Triangulation<dim>::cell_iterator &cell) const
+  {
+    return get_cell_data(cell).inside_quadrature;
+  }
+
+
+
+  template <int dim>
+  const Quadrature<dim> &
+  QuadratureCache<dim>::get_outside_quadrature(
+    const typename Triangulation<dim>::cell_iterator &cell) const
+  {
+    return get_cell_data(cell).outside_quadrature;
+  }
+
+
+
+  template <int dim>
+  const ImmersedSurfaceQuadrature<dim> &
+  QuadratureCache<dim>::get_surface_quadrature(
+    const typename Triangulation<dim>::cell_iterator &cell) const
+  {
+    return get_cell_data(cell).surface_quadrature;
+  }
+
+
+
+  template <int dim>
+  const hp::QCollection<1> &
+  QuadratureCache<dim>::get_quadratures_1D() const
+  {
+    return quadratures1D;
+  }
+
+
+
+  template <int dim>
+  std::size_t
+  QuadratureCache<dim>::memory_consumption() const
+  {
+    std::size_t memory = cell_data.capacity() * sizeof(CellData);
+    for (const CellData &data : cell_data)
+      if (data.is_intersected)
+        memory +=
+          MemoryConsumption::memory_consumption(data.level_set_values) +
+          data.inside_quadrature.memory_consumption() +
+          data.outside_quadrature.memory_consumption() +
+          data.surface_quadrature.memory_consumption();
+    return memory;
+  }
+} // namespace NonMatching
+
+#include "quadrature_cache.inst"
+
+DEAL_II_NAMESPACE_CLOSE
@@ -30,6 +30,44 @@
 DEAL_II_NAMESPACE_OPEN
 
 
+namespace
+{
+  /**
+   * Evaluate the components @p first_component to @p first_component +
+   * @p n_components - 1 of the finite element field described by
+   * @p dof_handler and @p vector in the points of @p rpe. All components are
+   * evaluated and communicated together, and the values of each component
+   * are appended to @p values as a separate vector.
+   */
+  template <int n_components, int dim, int spacedim, typename VectorType>
+  void
+  append_point_values_by_component(
+    const Utilities::MPI::RemotePointEvaluation<dim, spacedim> &rpe,
+    const DoFHandler<dim, spacedim> &                           dof_handler,
+    const VectorType &                                          vector,
+    const unsigned int                                          first_component,
+    std::vector<std::vector<double>> &                          values)
+  {
+    const auto point_values =
+      VectorTools::point_values<n_components>(rpe,
+                                              dof_handler,
+                                              vector,
+                                              VectorTools::EvaluationFlags::avg,
+                                              first_component);
+
+    for (unsigned int c = 0; c < n_components; ++c)
+      {
+        values.emplace_back(point_values.size());
+        for (unsigned int j = 0; j < point_values.size(); ++j)
+          values.back()[j] = internal::FEPointEvaluation::
+            EvaluatorTypeTraits<dim, n_components, double>::access(
+              point_values[j], c);
+      }
+  }
+} // namespace
+
+
+
 template <int dim, int patch_dim, int spacedim>
 DataOutResample<dim, patch_dim, spacedim>::DataOutResample(
   const Triangulation<patch_dim, spacedim> &patch_tria,
@@ -67,7 +105,9 @@ DataOutResample<dim, patch_dim, spacedim>::update_mapping(
   IndexSet active_dofs;
   DoFTools::extract_locally_active_dofs(patch_dof_handler, active_dofs);
   partitioner = std::make_shared<Utilities::MPI::Partitioner>(
-    patch_dof_handler.locally_owned_dofs(), active_dofs, MPI_COMM_WORLD);
+    patch_dof_handler.locally_owned_dofs(),
+    active_dofs,
+    patch_dof_handler.get_communicator());
 
   for (const auto &cell : patch_dof_handler.active_cell_iterators() |
                             IteratorFilters::LocallyOwnedCell())
@@ -160,12 +200,33 @@ DataOutResample<dim, patch_dim, spacedim>::build_patches(
             "with a single base element."));
 #endif
 
-      for (unsigned int comp = 0; comp < dh.get_fe_collection().n_components();
-           ++comp)
+      // evaluate vector-valued fields with up to three components with a
+      // single round of communication, and all others component by component
+      const unsigned int n_components = dh.get_fe_collection().n_components();
+      std::vector<std::vector<double>> component_values;
+      component_values.reserve(n_components);
+      switch (n_components)
         {
-          const auto values = VectorTools::point_values<1>(
-            rpe, dh, data_ptr->vector, VectorTools::EvaluationFlags::avg, comp);
+          case 1:
+            append_point_values_by_component<1>(
+              rpe, dh, data_ptr->vector, 0, component_values);
+            break;
+          case 2:
+            append_point_values_by_component<2>(
+              rpe, dh, data_ptr->vector, 0, component_values);
+            break;
+          case 3:
+            append_point_values_by_component<3>(
+              rpe, dh, data_ptr->vector, 0, component_values);
+            break;
+          default:
+            for (unsigned int comp = 0; comp < n_components; ++comp)
+              append_point_values_by_component<1>(
+                rpe, dh, data_ptr->vector, comp, component_values);
+        }
 
+      for (const auto &values : component_values)
+        {
           vectors.emplace_back(
             std::make_shared<LinearAlgebra::distributed::Vector<double>>(
               partitioner));
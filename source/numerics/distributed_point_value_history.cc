@@ -0,0 +1,433 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/quadrature.h>
+#include <deal.II/base/utilities.h>
+
+#include <deal.II/lac/block_vector.h>
+#include <deal.II/lac/la_parallel_block_vector.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/la_vector.h>
+#include <deal.II/lac/petsc_block_vector.h>
+#include <deal.II/lac/petsc_vector.h>
+#include <deal.II/lac/trilinos_parallel_block_vector.h>
+#include <deal.II/lac/trilinos_vector.h>
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/matrix_free/fe_point_evaluation.h>
+
+#include <deal.II/non_matching/mapping_info.h>
+
+#include <deal.II/numerics/distributed_point_value_history.h>
+
+#include <fstream>
+#include <iomanip>
+#include <limits>
+
+DEAL_II_NAMESPACE_OPEN
+
+
+template <int dim>
+DistributedPointValueHistory<dim>::DistributedPointValueHistory(
+  const Mapping<dim> &           mapping,
+  const std::vector<Point<dim>> &points,
+  const std::string &            file_name_base,
+  const unsigned int             n_buffered_steps,
+  const double                   tolerance)
+  : mapping(&mapping)
+  , points(points)
+  , file_name_base(file_name_base)
+  , n_buffered_steps(n_buffered_steps)
+  , n_values(0)
+  , remote_point_evaluation(tolerance)
+  , n_steps(0)
+  , n_written_steps(0)
+{
+  Assert(n_buffered_steps > 0,
+         ExcMessage("At least one step needs to be buffered."));
+}
+
+
+
+template <int dim>
+DistributedPointValueHistory<dim>::~DistributedPointValueHistory()
+{
+  // write what is left in the buffer, but do not throw from the destructor
+  try
+    {
+      flush();
+    }
+  catch (...)
+    {}
+}
+
+
+
+template <int dim>
+void
+DistributedPointValueHistory<dim>::add_field(
+  const std::string &    name,
+  const DoFHandler<dim> &dof_handler,
+  const unsigned int     first_component,
+  const unsigned int     n_components)
+{
+  Assert(n_steps == 0,
+         ExcMessage("Fields can only be added before the first step is "
+                    "recorded."));
+  Assert(fields.empty() || &dof_handler.get_triangulation() ==
+                             &fields[0].dof_handler->get_triangulation(),
+         ExcMessage("All fields need to be defined on the same "
+                    "triangulation."));
+
+  const unsigned int n_fe_components =
+    dof_handler.get_fe_collection().n_components();
+  AssertIndexRange(first_component, n_fe_components);
+
+  Field field;
+  field.name            = name;
+  field.dof_handler     = &dof_handler;
+  field.first_component = first_component;
+  field.n_components    = (n_components == numbers::invalid_unsigned_int ?
+                          n_fe_components - first_component :
+                          n_components);
+  AssertIndexRange(first_component + field.n_components, n_fe_components + 1);
+
+  n_values += field.n_components;
+  fields.push_back(field);
+}
+
+
+
+template <int dim>
+void
+DistributedPointValueHistory<dim>::locate_points()
+{
+  Assert(!fields.empty(), ExcMessage("No field has been added."));
+
+  evaluators.clear();
+  mapping_info.reset();
+  remote_point_evaluation.reinit(points,
+                                 fields[0].dof_handler->get_triangulation(),
+                                 *mapping);
+}
+
+
+
+template <int dim>
+void
+DistributedPointValueHistory<dim>::setup_evaluators(
+  const typename Utilities::MPI::RemotePointEvaluation<dim>::CellData
+    &cell_data)
+{
+  if (!evaluators.empty())
+    return;
+
+  // precomputed geometry data can only be used with the fast tensor product
+  // evaluation of FEPointEvaluation
+  bool use_precomputed_mapping =
+    internal::FEPointEvaluation::is_fast_path_supported(*mapping);
+  for (const Field &field : fields)
+    for (const FiniteElement<dim> &fe : field.dof_handler->get_fe_collection())
+      for (unsigned int b = 0; b < fe.n_base_elements(); ++b)
+        if (!internal::FEPointEvaluation::is_fast_path_supported(fe, b))
+          use_precomputed_mapping = false;
+
+  if (use_precomputed_mapping)
+    {
+      // the cells and reference points do not change until the points are
+      // located again, so compute the geometry data of all cells once
+      const Triangulation<dim> &tria =
+        remote_point_evaluation.get_triangulation();
+      std::vector<typename Triangulation<dim>::cell_iterator> cells;
+      std::vector<Quadrature<dim>>                            quadratures;
+      cells.reserve(cell_data.cells.size());
+      quadratures.reserve(cell_data.cells.size());
+      for (unsigned int i = 0; i < cell_data.cells.size(); ++i)
+        {
+          cells.emplace_back(&tria,
+                             cell_data.cells[i].first,
+                             cell_data.cells[i].second);
+          quadratures.emplace_back(std::vector<Point<dim>>(
+            cell_data.reference_point_values.begin() +
+              cell_data.reference_point_ptrs[i],
+            cell_data.reference_point_values.begin() +
+              cell_data.reference_point_ptrs[i + 1]));
+        }
+
+      mapping_info =
+        std::make_unique<NonMatching::MappingInfo<dim, dim>>(*mapping,
+                                                             update_values);
+      mapping_info->reinit_cells(cells, quadratures);
+    }
+
+  evaluators.resize(fields.size());
+  for (unsigned int f = 0; f < fields.size(); ++f)
+    {
+      const hp::FECollection<dim> &fe_collection =
+        fields[f].dof_handler->get_fe_collection();
+      evaluators[f].resize(fe_collection.size());
+      for (unsigned int i = 0; i < fe_collection.size(); ++i)
+        for (unsigned int c = 0; c < fields[f].n_components; ++c)
+          evaluators[f][i].push_back(
+            use_precomputed_mapping ?
+              std::make_unique<FEPointEvaluation<1, dim, dim, double>>(
+                *mapping_info,
+                fe_collection[i],
+                fields[f].first_component + c) :
+              std::make_unique<FEPointEvaluation<1, dim, dim, double>>(
+                *mapping,
+                fe_collection[i],
+                update_values,
+                fields[f].first_component + c));
+    }
+}
+
+
+
+template <int dim>
+template <typename VectorType>
+void
+DistributedPointValueHistory<dim>::record(
+  const double                           time,
+  const std::vector<const VectorType *> &vectors)
+{
+  AssertDimension(vectors.size(), fields.size());
+
+  if (!remote_point_evaluation.is_ready())
+    locate_points();
+
+  // evaluate the components of all fields on each cell, with the values of
+  // one point stored next to each other
+  const auto evaluation_function =
+    [&](const ArrayView<double> &values,
+        const typename Utilities::MPI::RemotePointEvaluation<dim>::CellData
+          &cell_data) {
+      setup_evaluators(cell_data);
+
+      std::vector<double> solution_values;
+      for (unsigned int i = 0; i < cell_data.cells.size(); ++i)
+        {
+          const unsigned int first_point = cell_data.reference_point_ptrs[i];
+          const ArrayView<const Point<dim>> unit_points(
+            cell_data.reference_point_values.data() + first_point,
+            cell_data.reference_point_ptrs[i + 1] - first_point);
+
+          unsigned int value_offset = 0;
+          for (unsigned int f = 0; f < fields.size(); ++f)
+            {
+              const typename DoFHandler<dim>::active_cell_iterator cell = {
+                &remote_point_evaluation.get_triangulation(),
+                cell_data.cells[i].first,
+                cell_data.cells[i].second,
+                fields[f].dof_handler};
+
+              solution_values.resize(cell->get_fe().n_dofs_per_cell());
+              cell->get_dof_values(*vectors[f],
+                                   solution_values.begin(),
+                                   solution_values.end());
+
+              for (unsigned int c = 0; c < fields[f].n_components; ++c)
+                {
+                  FEPointEvaluation<1, dim, dim, double> &evaluator =
+                    *evaluators[f][cell->active_fe_index()][c];
+                  if (mapping_info != nullptr)
+                    evaluator.reinit(i);
+                  else
+                    evaluator.reinit(cell, unit_points);
+                  evaluator.evaluate(solution_values,
+                                     dealii::EvaluationFlags::values);
+                  for (unsigned int q = 0; q < unit_points.size(); ++q)
+                    values[(first_point + q) * n_values + value_offset + c] =
+                      evaluator.get_value(q);
+                }
+              value_offset += fields[f].n_components;
+            }
+        }
+    };
+
+  std::vector<double> point_results;
+  std::vector<double> buffer;
+  remote_point_evaluation.template evaluate_and_process<double>(
+    point_results, buffer, evaluation_function, n_values);
+
+  // average the values of points found in several cells, and mark the points
+  // that have not been found
+  const std::vector<unsigned int> &ptr =
+    remote_point_evaluation.get_point_ptrs();
+  last_values.assign(points.size() * n_values,
+                     std::numeric_limits<double>::quiet_NaN());
+  for (unsigned int p = 0; p < points.size(); ++p)
+    {
+      const unsigned int n_entries = ptr[p + 1] - ptr[p];
+      if (n_entries == 0)
+        continue;
+
+      for (unsigned int v = 0; v < n_values; ++v)
+        {
+          double sum = 0.;
+          for (unsigned int e = ptr[p]; e < ptr[p + 1]; ++e)
+            sum += point_results[e * n_values + v];
+          last_values[p * n_values + v] = sum / n_entries;
+        }
+    }
+
+  buffered_times.push_back(time);
+  buffered_values.insert(buffered_values.end(),
+                         last_values.begin(),
+                         last_values.end());
+  ++n_steps;
+
+  if (buffered_times.size() >= n_buffered_steps)
+    flush();
+}
+
+
+
+template <int dim>
+std::string
+DistributedPointValueHistory<dim>::get_file_name(
+  const std::string &suffix) const
+{
+  const MPI_Comm &mpi_comm =
+    fields[0].dof_handler->get_triangulation().get_communicator();
+  return file_name_base + "_" +
+         Utilities::int_to_string(Utilities::MPI::this_mpi_process(mpi_comm),
+                                  4) +
+         suffix;
+}
+
+
+
+template <int dim>
+void
+DistributedPointValueHistory<dim>::flush()
+{
+  if (buffered_times.empty() || points.empty())
+    {
+      n_written_steps += buffered_times.size();
+      buffered_times.clear();
+      buffered_values.clear();
+      return;
+    }
+
+  // describe the content of the binary file along with the first data
+  if (n_written_steps == 0)
+    {
+      const std::string file_name = get_file_name(".txt");
+      std::ofstream     out(file_name);
+      AssertThrow(out.good(), ExcFileNotOpen(file_name));
+
+      out << "# Values at points recorded by DistributedPointValueHistory\n"
+          << "# The file " << get_file_name(".bin")
+          << " contains, for each step, the time and the values of all\n"
+          << "# points, with the values of one point stored next to each "
+          << "other, as doubles\n"
+          << "n_points " << points.size() << '\n'
+          << "n_values " << n_values << '\n'
+          << "values";
+      for (const std::string &name : get_value_names())
+        out << ' ' << name;
+      out << '\n' << "points\n" << std::setprecision(17);
+      for (const Point<dim> &point : points)
+        out << point << '\n';
+      AssertThrow(out.good(), ExcIO());
+    }
+
+  const std::string file_name = get_file_name(".bin");
+  std::ofstream     out(file_name,
+                    n_written_steps == 0 ?
+                      std::ios::binary | std::ios::trunc :
+                      std::ios::binary | std::ios::app);
+  AssertThrow(out.good(), ExcFileNotOpen(file_name));
+
+  const std::size_t n_values_per_step = points.size() * n_values;
+  for (unsigned int step = 0; step < buffered_times.size(); ++step)
+    {
+      out.write(reinterpret_cast<const char *>(&buffered_times[step]),
+                sizeof(double));
+      out.write(reinterpret_cast<const char *>(buffered_values.data() +
+                                               step * n_values_per_step),
+                n_values_per_step * sizeof(double));
+    }
+  AssertThrow(out.good(), ExcIO());
+
+  n_written_steps += buffered_times.size();
+  buffered_times.clear();
+  buffered_values.clear();
+}
+
+
+
+template <int dim>
+unsigned int
+DistributedPointValueHistory<dim>::n_recorded_steps() const
+{
+  return n_steps;
+}
+
+
+
+template <int dim>
+unsigned int
+DistributedPointValueHistory<dim>::n_values_per_point() const
+{
+  return n_values;
+}
+
+
+
+template <int dim>
+std::vector<std::string>
+DistributedPointValueHistory<dim>::get_value_names() const
+{
+  std::vector<std::string> names;
+  for (const Field &field : fields)
+    for (unsigned int c = 0; c < field.n_components; ++c)
+      names.push_back(field.n_components == 1 ?
+                        field.name :
+                        field.name + "_" + Utilities::int_to_string(c));
+  return names;
+}
+
+
+
+template <int dim>
+std::vector<double>
+DistributedPointValueHistory<dim>::get_last_values() const
+{
+  Assert(n_steps > 0, ExcMessage("No step has been recorded yet."));
+  return last_values;
+}
+
+
+
+template <int dim>
+std::size_t
+DistributedPointValueHistory<dim>::memory_consumption() const
+{
+  return MemoryConsumption::memory_consumption(points) +
+         MemoryConsumption::memory_consumption(buffered_times) +
+         MemoryConsumption::memory_consumption(buffered_values) +
+         MemoryConsumption::memory_consumption(last_values);
+}
+
+
+// explicit instantiations
+#include "distributed_point_value_history.inst"
+
+
+DEAL_II_NAMESPACE_CLOSE
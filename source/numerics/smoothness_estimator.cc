@@ -13,6 +13,7 @@
 //
 // ---------------------------------------------------------------------
 
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/quadrature.h>
 #include <deal.II/base/signaling_nan.h>
 
@@ -62,6 +63,122 @@ namespace SmoothnessEstimator
         size[d] = N;
       coeff.reinit(size);
     }
+
+
+
+    /**
+     * Fill @p smoothness_indicators with the value that
+     * @p estimate_from_coefficients returns for the expansion coefficients
+     * of @p solution on each locally owned cell, or only on those flagged for
+     * refinement or coarsening if @p only_flagged_cells is set. Locally owned
+     * cells that are not considered get a signaling NaN.
+     *
+     * Instead of expanding the solution cell by cell, the cells are grouped by
+     * their active FE index, and the coefficients of a whole batch of cells
+     * are computed by a single matrix-matrix product. The subsequent
+     * evaluation of @p estimate_from_coefficients, which is called with the
+     * coefficients of one cell and the number of modes per direction, runs
+     * in parallel over the cells of each batch and thus has to be
+     * thread-safe.
+     */
+    template <int dim,
+              int spacedim,
+              typename FESeriesType,
+              typename VectorType,
+              typename EstimateFunction>
+    void
+    estimate_in_batches(FESeriesType &                   fe_series,
+                        const DoFHandler<dim, spacedim> &dof_handler,
+                        const VectorType &               solution,
+                        Vector<float> &                  smoothness_indicators,
+                        const bool                       only_flagged_cells,
+                        const EstimateFunction &estimate_from_coefficients)
+    {
+      using number       = typename VectorType::value_type;
+      using number_coeff = typename FESeriesType::CoefficientType;
+      using cell_iterator =
+        typename DoFHandler<dim, spacedim>::active_cell_iterator;
+
+      // the number of cells whose coefficients are computed at once
+      const unsigned int batch_size = 256;
+
+      smoothness_indicators.reinit(
+        dof_handler.get_triangulation().n_active_cells());
+
+      std::vector<std::vector<cell_iterator>> cells_per_fe_index(
+        dof_handler.get_fe_collection().size());
+      for (const auto &cell : dof_handler.active_cell_iterators() |
+                                IteratorFilters::LocallyOwnedCell())
+        if (!only_flagged_cells || cell->refine_flag_set() ||
+            cell->coarsen_flag_set())
+          cells_per_fe_index[cell->active_fe_index()].push_back(cell);
+        else
+          smoothness_indicators(cell->active_cell_index()) =
+            numbers::signaling_nan<float>();
+
+      Vector<number>           local_dof_values;
+      FullMatrix<number_coeff> batch_dof_values;
+      FullMatrix<number_coeff> batch_coefficients;
+      for (unsigned int fe_index = 0; fe_index < cells_per_fe_index.size();
+           ++fe_index)
+        {
+          const std::vector<cell_iterator> &cells =
+            cells_per_fe_index[fe_index];
+          if (cells.empty())
+            continue;
+
+          const unsigned int n_dofs =
+            dof_handler.get_fe(fe_index).n_dofs_per_cell();
+          const unsigned int n_modes =
+            fe_series.get_n_coefficients_per_direction(fe_index);
+          local_dof_values.reinit(n_dofs);
+
+          for (std::size_t first = 0; first < cells.size(); first += batch_size)
+            {
+              const unsigned int n_cells =
+                std::min<std::size_t>(batch_size, cells.size() - first);
+
+              // Gather the local DoF values of all cells of this batch into
+              // the columns of one matrix, and transform all of them at once.
+              batch_dof_values.reinit(n_dofs, n_cells);
+              for (unsigned int c = 0; c < n_cells; ++c)
+                {
+                  cells[first + c]->get_dof_values(solution, local_dof_values);
+                  for (unsigned int i = 0; i < n_dofs; ++i)
+                    batch_dof_values(i, c) = local_dof_values(i);
+                }
+
+              fe_series.calculate(batch_dof_values,
+                                  fe_index,
+                                  batch_coefficients);
+
+              parallel::apply_to_subranges(
+                0u,
+                n_cells,
+                [&](const unsigned int begin, const unsigned int end) {
+                  Table<dim, number_coeff>  expansion_coefficients;
+                  std::vector<number_coeff> unrolled_coefficients(
+                    batch_coefficients.m());
+                  resize(expansion_coefficients, n_modes);
+
+                  for (unsigned int c = begin; c < end; ++c)
+                    {
+                      for (unsigned int i = 0; i < unrolled_coefficients.size();
+                           ++i)
+                        unrolled_coefficients[i] = batch_coefficients(i, c);
+                      expansion_coefficients.fill(
+                        unrolled_coefficients.begin());
+
+                      smoothness_indicators(
+                        cells[first + c]->active_cell_index()) =
+                        estimate_from_coefficients(expansion_coefficients,
+                                                   n_modes);
+                    }
+                },
+                /* grainsize = */ 16);
+            }
+        }
+    }
   } // namespace
 
 
@@ -108,72 +225,51 @@ namespace SmoothnessEstimator
                       const double smallest_abs_coefficient,
                       const bool   only_flagged_cells)
     {
-      using number = typename VectorType::value_type;
       using number_coeff =
         typename FESeries::Legendre<dim, spacedim>::CoefficientType;
 
-      smoothness_indicators.reinit(
-        dof_handler.get_triangulation().n_active_cells());
-
-      unsigned int             n_modes;
-      Table<dim, number_coeff> expansion_coefficients;
-
-      Vector<number>      local_dof_values;
-      std::vector<double> converted_indices;
-      std::pair<std::vector<unsigned int>, std::vector<double>> res;
-      for (const auto &cell : dof_handler.active_cell_iterators() |
-                                IteratorFilters::LocallyOwnedCell())
-        {
-          if (!only_flagged_cells || cell->refine_flag_set() ||
-              cell->coarsen_flag_set())
+      estimate_in_batches(
+        fe_legendre,
+        dof_handler,
+        solution,
+        smoothness_indicators,
+        only_flagged_cells,
+        [&](const Table<dim, number_coeff> &expansion_coefficients,
+            const unsigned int              n_modes) {
+          // We fit our exponential decay of expansion coefficients to the
+          // provided regression_strategy on each possible value of |k|.
+          // To this end, we use FESeries::process_coefficients() to
+          // rework coefficients into the desired format.
+          std::pair<std::vector<unsigned int>, std::vector<double>> res =
+            FESeries::process_coefficients<dim>(
+              expansion_coefficients,
+              [n_modes](const TableIndices<dim> &indices) {
+                return index_sum_less_than_N(indices, n_modes);
+              },
+              regression_strategy,
+              smallest_abs_coefficient);
+
+          Assert(res.first.size() == res.second.size(), ExcInternalError());
+
+          // Last, do the linear regression.
+          float regularity = std::numeric_limits<float>::infinity();
+          if (res.first.size() > 1)
             {
-              n_modes = fe_legendre.get_n_coefficients_per_direction(
-                cell->active_fe_index());
-              resize(expansion_coefficients, n_modes);
-
-              local_dof_values.reinit(cell->get_fe().n_dofs_per_cell());
-              cell->get_dof_values(solution, local_dof_values);
-
-              fe_legendre.calculate(local_dof_values,
-                                    cell->active_fe_index(),
-                                    expansion_coefficients);
-
-              // We fit our exponential decay of expansion coefficients to the
-              // provided regression_strategy on each possible value of |k|.
-              // To this end, we use FESeries::process_coefficients() to
-              // rework coefficients into the desired format.
-              res = FESeries::process_coefficients<dim>(
-                expansion_coefficients,
-                [n_modes](const TableIndices<dim> &indices) {
-                  return index_sum_less_than_N(indices, n_modes);
-                },
-                regression_strategy,
-                smallest_abs_coefficient);
+              // Prepare linear equation for the logarithmic least squares
+              // fit.
+              const std::vector<double> converted_indices(res.first.begin(),
+                                                          res.first.end());
 
-              Assert(res.first.size() == res.second.size(), ExcInternalError());
+              for (auto &residual_element : res.second)
+                residual_element = std::log(residual_element);
 
-              // Last, do the linear regression.
-              float regularity = std::numeric_limits<float>::infinity();
-              if (res.first.size() > 1)
-                {
-                  // Prepare linear equation for the logarithmic least squares
-                  // fit.
-                  converted_indices.assign(res.first.begin(), res.first.end());
-
-                  for (auto &residual_element : res.second)
-                    residual_element = std::log(residual_element);
-
-                  const std::pair<double, double> fit =
-                    FESeries::linear_regression(converted_indices, res.second);
-                  regularity = static_cast<float>(-fit.first);
-                }
-
-              smoothness_indicators(cell->active_cell_index()) = regularity;
+              const std::pair<double, double> fit =
+                FESeries::linear_regression(converted_indices, res.second);
+              regularity = static_cast<float>(-fit.first);
             }
-          else
-            smoothness_indicators(cell->active_cell_index()) =
-              numbers::signaling_nan<float>();
-        }
+
+          return regularity;
+        });
     }
 
 
@@ -375,90 +471,63 @@ namespace SmoothnessEstimator
                       const double smallest_abs_coefficient,
                       const bool   only_flagged_cells)
     {
-      using number = typename VectorType::value_type;
       using number_coeff =
         typename FESeries::Fourier<dim, spacedim>::CoefficientType;
 
-      smoothness_indicators.reinit(
-        dof_handler.get_triangulation().n_active_cells());
-
-      unsigned int             n_modes;
-      Table<dim, number_coeff> expansion_coefficients;
-
-      Vector<number>      local_dof_values;
-      std::vector<double> ln_k;
-      std::pair<std::vector<unsigned int>, std::vector<double>> res;
-      for (const auto &cell : dof_handler.active_cell_iterators() |
-                                IteratorFilters::LocallyOwnedCell())
-        {
-          if (!only_flagged_cells || cell->refine_flag_set() ||
-              cell->coarsen_flag_set())
+      estimate_in_batches(
+        fe_fourier,
+        dof_handler,
+        solution,
+        smoothness_indicators,
+        only_flagged_cells,
+        [&](const Table<dim, number_coeff> &expansion_coefficients,
+            const unsigned int              n_modes) {
+          // We fit our exponential decay of expansion coefficients to the
+          // provided regression_strategy on each possible value of |k|.
+          // To this end, we use FESeries::process_coefficients() to
+          // rework coefficients into the desired format.
+          std::pair<std::vector<unsigned int>, std::vector<double>> res =
+            FESeries::process_coefficients<dim>(
+              expansion_coefficients,
+              [n_modes](const TableIndices<dim> &indices) {
+                return index_norm_greater_than_zero_and_less_than_N_squared(
+                  indices, n_modes);
+              },
+              regression_strategy,
+              smallest_abs_coefficient);
+
+          Assert(res.first.size() == res.second.size(), ExcInternalError());
+
+          // Last, do the linear regression.
+          float regularity = std::numeric_limits<float>::infinity();
+          if (res.first.size() > 1)
             {
-              n_modes = fe_fourier.get_n_coefficients_per_direction(
-                cell->active_fe_index());
-              resize(expansion_coefficients, n_modes);
-
-              // Inside the loop, we first need to get the values of the local
-              // degrees of freedom and then need to compute the series
-              // expansion by multiplying this vector with the matrix ${\cal
-              // F}$ corresponding to this finite element.
-              local_dof_values.reinit(cell->get_fe().n_dofs_per_cell());
-              cell->get_dof_values(solution, local_dof_values);
-
-              fe_fourier.calculate(local_dof_values,
-                                   cell->active_fe_index(),
-                                   expansion_coefficients);
-
-              // We fit our exponential decay of expansion coefficients to the
-              // provided regression_strategy on each possible value of |k|.
-              // To this end, we use FESeries::process_coefficients() to
-              // rework coefficients into the desired format.
-              res = FESeries::process_coefficients<dim>(
-                expansion_coefficients,
-                [n_modes](const TableIndices<dim> &indices) {
-                  return index_norm_greater_than_zero_and_less_than_N_squared(
-                    indices, n_modes);
-                },
-                regression_strategy,
-                smallest_abs_coefficient);
-
-              Assert(res.first.size() == res.second.size(), ExcInternalError());
-
-              // Last, do the linear regression.
-              float regularity = std::numeric_limits<float>::infinity();
-              if (res.first.size() > 1)
-                {
-                  // Prepare linear equation for the logarithmic least squares
-                  // fit.
-                  //
-                  // First, calculate ln(|k|).
-                  //
-                  // For Fourier expansion, this translates to
-                  // ln(2*pi*sqrt(predicate)) = ln(2*pi) + 0.5*ln(predicate).
-                  // Since we are just interested in the slope of a linear
-                  // regression later, we omit the ln(2*pi) factor.
-                  ln_k.resize(res.first.size());
-                  for (unsigned int f = 0; f < res.first.size(); ++f)
-                    ln_k[f] = 0.5 * std::log(static_cast<double>(res.first[f]));
-
-                  // Second, calculate ln(U_k).
-                  for (auto &residual_element : res.second)
-                    residual_element = std::log(residual_element);
-
-                  const std::pair<double, double> fit =
-                    FESeries::linear_regression(ln_k, res.second);
-                  // Compute regularity s = mu - dim/2
-                  regularity = static_cast<float>(-fit.first) -
-                               ((dim > 1) ? (.5 * dim) : 0);
-                }
-
-              // Store result in the vector of estimated values for each cell.
-              smoothness_indicators(cell->active_cell_index()) = regularity;
+              // Prepare linear equation for the logarithmic least squares
+              // fit.
+              //
+              // First, calculate ln(|k|).
+              //
+              // For Fourier expansion, this translates to
+              // ln(2*pi*sqrt(predicate)) = ln(2*pi) + 0.5*ln(predicate).
+              // Since we are just interested in the slope of a linear
+              // regression later, we omit the ln(2*pi) factor.
+              std::vector<double> ln_k(res.first.size());
+              for (unsigned int f = 0; f < res.first.size(); ++f)
+                ln_k[f] = 0.5 * std::log(static_cast<double>(res.first[f]));
+
+              // Second, calculate ln(U_k).
+              for (auto &residual_element : res.second)
+                residual_element = std::log(residual_element);
+
+              const std::pair<double, double> fit =
+                FESeries::linear_regression(ln_k, res.second);
+              // Compute regularity s = mu - dim/2
+              regularity = static_cast<float>(-fit.first) -
+                           ((dim > 1) ? (.5 * dim) : 0);
             }
-          else
-            smoothness_indicators(cell->active_cell_index()) =
-              numbers::signaling_nan<float>();
-        }
+
+          return regularity;
+        });
     }
 
 
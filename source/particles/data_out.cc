@@ -23,6 +23,149 @@ DEAL_II_NAMESPACE_OPEN
 
 namespace Particles
 {
+  namespace
+  {
+    /**
+     * Return the ranges of vector and tensor valued data among the data sets
+     * named @p dataset_names with the given interpretations.
+     */
+    template <int spacedim>
+    std::vector<
+      std::tuple<unsigned int,
+                 unsigned int,
+                 std::string,
+                 DataComponentInterpretation::DataComponentInterpretation>>
+    compute_nonscalar_data_ranges(
+      const std::vector<std::string> &dataset_names,
+      const std::vector<
+        DataComponentInterpretation::DataComponentInterpretation>
+        &data_component_interpretations)
+    {
+      std::vector<
+        std::tuple<unsigned int,
+                   unsigned int,
+                   std::string,
+                   DataComponentInterpretation::DataComponentInterpretation>>
+        ranges;
+
+      // Make sure the data structures were set up correctly. The callers
+      // have checked this already.
+      Assert(dataset_names.size() == data_component_interpretations.size(),
+             ExcInternalError());
+
+      // collect the ranges of particle data
+      const unsigned int n_output_components =
+        data_component_interpretations.size();
+      unsigned int output_component = 0;
+      for (unsigned int i = 0; i < n_output_components;
+           /* i is updated below */)
+        // see what kind of data we have here. note that for the purpose of
+        // the current function all we care about is vector data
+        switch (data_component_interpretations[i])
+          {
+            case DataComponentInterpretation::component_is_scalar:
+              {
+                // Just move component forward by one
+                ++i;
+                ++output_component;
+
+                break;
+              }
+            case DataComponentInterpretation::component_is_part_of_vector:
+              {
+                // ensure that there is a continuous number of next space_dim
+                // components that all deal with vectors
+                Assert(i + spacedim <= n_output_components,
+                       Exceptions::DataOutImplementation::
+                         ExcInvalidVectorDeclaration(i, dataset_names[i]));
+                for (unsigned int dd = 1; dd < spacedim; ++dd)
+                  Assert(
+                    data_component_interpretations[i + dd] ==
+                      DataComponentInterpretation::component_is_part_of_vector,
+                    Exceptions::DataOutImplementation::
+                      ExcInvalidVectorDeclaration(i, dataset_names[i]));
+
+                // all seems right, so figure out whether there is a common
+                // name to these components. if not, leave the name empty and
+                // let the output format writer decide what to do here
+                std::string name = dataset_names[i];
+                for (unsigned int dd = 1; dd < spacedim; ++dd)
+                  if (name != dataset_names[i + dd])
+                    {
+                      name = "";
+                      break;
+                    }
+
+                // Finally add a corresponding range.
+                //
+                // This sort of logic is also explained in some detail in
+                //   DataOut::build_one_patch().
+                ranges.emplace_back(std::forward_as_tuple(
+                  output_component,
+                  output_component + spacedim - 1,
+                  name,
+                  DataComponentInterpretation::component_is_part_of_vector));
+
+                // increase the 'component' counter by the appropriate amount,
+                // same for 'i', since we have already dealt with all these
+                // components
+                output_component += spacedim;
+                i += spacedim;
+
+                break;
+              }
+
+            case DataComponentInterpretation::component_is_part_of_tensor:
+              {
+                const unsigned int size = spacedim * spacedim;
+                // ensure that there is a continuous number of next
+                // spacedim*spacedim components that all deal with tensors
+                Assert(i + size <= n_output_components,
+                       Exceptions::DataOutImplementation::
+                         ExcInvalidTensorDeclaration(i, dataset_names[i]));
+                for (unsigned int dd = 1; dd < size; ++dd)
+                  Assert(
+                    data_component_interpretations[i + dd] ==
+                      DataComponentInterpretation::component_is_part_of_tensor,
+                    Exceptions::DataOutImplementation::
+                      ExcInvalidTensorDeclaration(i, dataset_names[i]));
+
+                // all seems right, so figure out whether there is a common
+                // name to these components. if not, leave the name empty and
+                // let the output format writer decide what to do here
+                std::string name = dataset_names[i];
+                for (unsigned int dd = 1; dd < size; ++dd)
+                  if (name != dataset_names[i + dd])
+                    {
+                      name = "";
+                      break;
+                    }
+
+                // Finally add a corresponding range.
+                ranges.emplace_back(std::forward_as_tuple(
+                  output_component,
+                  output_component + size - 1,
+                  name,
+                  DataComponentInterpretation::component_is_part_of_tensor));
+
+                // increase the 'component' counter by the appropriate amount,
+                // same for 'i', since we have already dealt with all these
+                // components
+                output_component += size;
+                i += size;
+                break;
+              }
+
+            default:
+              Assert(false, ExcNotImplemented());
+          }
+
+      return ranges;
+    }
+  } // namespace
+
+
+
   template <int dim, int spacedim>
   void
   DataOut<dim, spacedim>::build_patches(
@@ -128,128 +271,93 @@ namespace Particles
                DataComponentInterpretation::DataComponentInterpretation>>
   DataOut<dim, spacedim>::get_nonscalar_data_ranges() const
   {
-    std::vector<
-      std::tuple<unsigned int,
-                 unsigned int,
-                 std::string,
-                 DataComponentInterpretation::DataComponentInterpretation>>
-      ranges;
-
-    // Make sure the data structures were set up correctly. Since they
-    // can only be filled by build_patches() above, they should have
-    // been checked already.
-    Assert(dataset_names.size() == data_component_interpretations.size(),
-           ExcInternalError());
-
-    // collect the ranges of particle data
-    const unsigned int n_output_components =
-      data_component_interpretations.size();
-    unsigned int output_component = 0;
-    for (unsigned int i = 0; i < n_output_components; /* i is updated below */)
-      // see what kind of data we have here. note that for the purpose of the
-      // current function all we care about is vector data
-      switch (data_component_interpretations[i])
-        {
-          case DataComponentInterpretation::component_is_scalar:
-            {
-              // Just move component forward by one
-              ++i;
-              ++output_component;
-
-              break;
-            }
-          case DataComponentInterpretation::component_is_part_of_vector:
-            {
-              // ensure that there is a continuous number of next space_dim
-              // components that all deal with vectors
-              Assert(
-                i + spacedim <= n_output_components,
-                Exceptions::DataOutImplementation::ExcInvalidVectorDeclaration(
-                  i, dataset_names[i]));
-              for (unsigned int dd = 1; dd < spacedim; ++dd)
-                Assert(
-                  data_component_interpretations[i + dd] ==
-                    DataComponentInterpretation::component_is_part_of_vector,
-                  Exceptions::DataOutImplementation::
-                    ExcInvalidVectorDeclaration(i, dataset_names[i]));
-
-              // all seems right, so figure out whether there is a common
-              // name to these components. if not, leave the name empty and
-              // let the output format writer decide what to do here
-              std::string name = dataset_names[i];
-              for (unsigned int dd = 1; dd < spacedim; ++dd)
-                if (name != dataset_names[i + dd])
-                  {
-                    name = "";
-                    break;
-                  }
-
-              // Finally add a corresponding range.
-              //
-              // This sort of logic is also explained in some detail in
-              //   DataOut::build_one_patch().
-              ranges.emplace_back(std::forward_as_tuple(
-                output_component,
-                output_component + spacedim - 1,
-                name,
-                DataComponentInterpretation::component_is_part_of_vector));
-
-              // increase the 'component' counter by the appropriate amount,
-              // same for 'i', since we have already dealt with all these
-              // components
-              output_component += spacedim;
-              i += spacedim;
-
-              break;
-            }
-
-          case DataComponentInterpretation::component_is_part_of_tensor:
-            {
-              const unsigned int size = spacedim * spacedim;
-              // ensure that there is a continuous number of next
-              // spacedim*spacedim components that all deal with tensors
-              Assert(
-                i + size <= n_output_components,
-                Exceptions::DataOutImplementation::ExcInvalidTensorDeclaration(
-                  i, dataset_names[i]));
-              for (unsigned int dd = 1; dd < size; ++dd)
-                Assert(
-                  data_component_interpretations[i + dd] ==
-                    DataComponentInterpretation::component_is_part_of_tensor,
-                  Exceptions::DataOutImplementation::
-                    ExcInvalidTensorDeclaration(i, dataset_names[i]));
-
-              // all seems right, so figure out whether there is a common
-              // name to these components. if not, leave the name empty and
-              // let the output format writer decide what to do here
-              std::string name = dataset_names[i];
-              for (unsigned int dd = 1; dd < size; ++dd)
-                if (name != dataset_names[i + dd])
-                  {
-                    name = "";
-                    break;
-                  }
-
-              // Finally add a corresponding range.
-              ranges.emplace_back(std::forward_as_tuple(
-                output_component,
-                output_component + size - 1,
-                name,
-                DataComponentInterpretation::component_is_part_of_tensor));
-
-              // increase the 'component' counter by the appropriate amount,
-              // same for 'i', since we have already dealt with all these
-              // components
-              output_component += size;
-              i += size;
-              break;
-            }
-
-          default:
-            Assert(false, ExcNotImplemented());
-        }
-
-    return ranges;
+    return compute_nonscalar_data_ranges<spacedim>(
+      dataset_names, data_component_interpretations);
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  write_vtu_in_parallel(
+    const Particles::ParticleHandler<dim, spacedim> &particles,
+    const std::string &                              filename,
+    const MPI_Comm &                                 comm,
+    const std::vector<std::string> &                 data_component_names,
+    const std::vector<DataComponentInterpretation::DataComponentInterpretation>
+      &                              data_component_interpretations_,
+    const std::vector<unsigned int> &property_indices_,
+    const DataOutBase::VtkFlags &    flags)
+  {
+    Assert(
+      data_component_names.size() == data_component_interpretations_.size(),
+      ExcMessage(
+        "When calling Particles::write_vtu_in_parallel with data component "
+        "names and interpretations you need to provide as many data component "
+        "names as interpretations. Provide the same name for components that "
+        "belong to a single vector or tensor."));
+    Assert(property_indices_.empty() ||
+             property_indices_.size() == data_component_names.size(),
+           ExcDimensionMismatch(property_indices_.size(),
+                                data_component_names.size()));
+
+    const unsigned int n_property_components = data_component_names.size();
+    std::vector<unsigned int> property_indices(property_indices_);
+    if (property_indices.empty())
+      for (unsigned int c = 0; c < n_property_components; ++c)
+        property_indices.push_back(c);
+    for (const unsigned int index : property_indices)
+      {
+        (void)index;
+        AssertIndexRange(index, particles.n_properties_per_particle());
+      }
+
+    std::vector<std::string> dataset_names;
+    dataset_names.emplace_back("id");
+    dataset_names.insert(dataset_names.end(),
+                         data_component_names.begin(),
+                         data_component_names.end());
+
+    std::vector<DataComponentInterpretation::DataComponentInterpretation>
+      data_component_interpretations;
+    data_component_interpretations.emplace_back(
+      DataComponentInterpretation::component_is_scalar);
+    data_component_interpretations.insert(
+      data_component_interpretations.end(),
+      data_component_interpretations_.begin(),
+      data_component_interpretations_.end());
+
+    // copy the locations, ids, and selected properties of the particles
+    // straight into the arrays that are written, without building patches
+    const unsigned int n_particles = particles.n_locally_owned_particles();
+    std::vector<Point<spacedim>> locations(n_particles);
+    Table<2, float>              data(dataset_names.size(), n_particles);
+
+    unsigned int i = 0;
+    for (const auto &particle : particles)
+      {
+        locations[i] = particle.get_location();
+        data(0, i)   = particle.get_id();
+        if (n_property_components > 0)
+          {
+            const ArrayView<const double> properties =
+              particle.get_properties();
+            for (unsigned int c = 0; c < n_property_components; ++c)
+              data(c + 1, i) = properties[property_indices[c]];
+          }
+        ++i;
+      }
+    AssertDimension(i, n_particles);
+
+    DataOutBase::write_vtu_point_cloud_in_parallel(
+      filename,
+      locations,
+      data,
+      dataset_names,
+      compute_nonscalar_data_ranges<spacedim>(dataset_names,
+                                              data_component_interpretations),
+      flags,
+      comm);
   }
 
 } // namespace Particles
@@ -15,6 +15,7 @@
 
 #include <deal.II/base/bounding_box.h>
 #include <deal.II/base/geometry_info.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/quadrature_lib.h>
 #include <deal.II/base/signaling_nan.h>
 
@@ -213,21 +214,51 @@ namespace Particles
       particle_handler.reserve(particle_handler.n_locally_owned_particles() +
                                n_particles_to_generate);
 
+      std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>
+        locally_owned_cells;
       for (const auto &cell : triangulation.active_cell_iterators() |
                                 IteratorFilters::LocallyOwnedCell())
-        {
-          for (const auto &reference_location : particle_reference_locations)
-            {
-              const Point<spacedim> position_real =
-                mapping.transform_unit_to_real_cell(cell, reference_location);
+        locally_owned_cells.push_back(cell);
+
+      // Compute the real positions of the particles in parallel over the
+      // cells, evaluating the mapping once per cell for all reference
+      // locations, and insert the particles afterwards in the order of the
+      // cells
+      const unsigned int n_particles_per_cell =
+        particle_reference_locations.size();
+      std::vector<Point<spacedim>> positions(locally_owned_cells.size() *
+                                             n_particles_per_cell);
+      if (n_particles_per_cell > 0)
+        parallel::apply_to_subranges(
+          0U,
+          static_cast<unsigned int>(locally_owned_cells.size()),
+          [&](const unsigned int begin, const unsigned int end) {
+            FE_Nothing<dim, spacedim> alibi_finite_element;
+            FEValues<dim, spacedim>   fe_values(mapping,
+                                              alibi_finite_element,
+                                              Quadrature<dim>(
+                                                particle_reference_locations),
+                                              update_quadrature_points);
+            for (unsigned int c = begin; c < end; ++c)
+              {
+                fe_values.reinit(locally_owned_cells[c]);
+                std::copy(fe_values.get_quadrature_points().begin(),
+                          fe_values.get_quadrature_points().end(),
+                          positions.begin() + c * n_particles_per_cell);
+              }
+          },
+          32);
 
-              particle_handler.insert_particle(position_real,
-                                               reference_location,
-                                               particle_index,
-                                               cell);
-              ++particle_index;
-            }
-        }
+      for (unsigned int c = 0; c < locally_owned_cells.size(); ++c)
+        for (unsigned int i = 0; i < n_particles_per_cell; ++i)
+          {
+            particle_handler.insert_particle(
+              positions[c * n_particles_per_cell + i],
+              particle_reference_locations[i],
+              particle_index,
+              locally_owned_cells[c]);
+            ++particle_index;
+          }
 
       particle_handler.update_cached_numbers();
     }
@@ -422,28 +453,63 @@ namespace Particles
           }
       }
 
-      // Now generate as many particles per cell as determined above
+      // Now generate as many particles per cell as determined above. The
+      // locations are computed in parallel over the cells. Each cell draws
+      // from its own random number generator, seeded with the combined seed
+      // and the index of the cell, so that the result does not depend on
+      // the number of threads.
       {
-        particle_handler.reserve(particle_handler.n_locally_owned_particles() +
-                                 n_local_particles);
-        unsigned int current_particle_index = start_particle_id;
-
+        std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>
+                                           cells;
+        std::vector<types::particle_index> first_particle_of_cell;
+        types::particle_index              n_particles = 0;
         for (const auto &cell : triangulation.active_cell_iterators() |
                                   IteratorFilters::LocallyOwnedCell())
-          {
-            for (unsigned int i = 0;
-                 i < particles_per_cell[cell->active_cell_index()];
-                 ++i)
-              {
-                random_particle_in_cell_insert(cell,
-                                               current_particle_index,
-                                               random_number_generator,
-                                               particle_handler,
-                                               mapping);
+          if (particles_per_cell[cell->active_cell_index()] > 0)
+            {
+              cells.push_back(cell);
+              first_particle_of_cell.push_back(n_particles);
+              n_particles += particles_per_cell[cell->active_cell_index()];
+            }
 
-                ++current_particle_index;
+        std::vector<std::pair<Point<spacedim>, Point<dim>>> locations(
+          n_particles);
+        parallel::apply_to_subranges(
+          0U,
+          static_cast<unsigned int>(cells.size()),
+          [&](const unsigned int begin, const unsigned int end) {
+            for (unsigned int c = begin; c < end; ++c)
+              {
+                std::seed_seq cell_seed{combined_seed,
+                                        cells[c]->active_cell_index()};
+                std::mt19937  cell_random_number_generator(cell_seed);
+
+                const types::particle_index n_particles_in_cell =
+                  particles_per_cell[cells[c]->active_cell_index()];
+                for (types::particle_index i = 0; i < n_particles_in_cell; ++i)
+                  locations[first_particle_of_cell[c] + i] =
+                    random_location_in_cell(cells[c],
+                                            mapping,
+                                            cell_random_number_generator);
               }
-          }
+          },
+          16);
+
+        particle_handler.reserve(particle_handler.n_locally_owned_particles() +
+                                 n_particles);
+        types::particle_index current_particle_index = start_particle_id;
+        for (unsigned int c = 0; c < cells.size(); ++c)
+          for (types::particle_index i = 0;
+               i < particles_per_cell[cells[c]->active_cell_index()];
+               ++i)
+            {
+              const auto &location = locations[first_particle_of_cell[c] + i];
+              particle_handler.insert_particle(location.first,
+                                               location.second,
+                                               current_particle_index,
+                                               cells[c]);
+              ++current_particle_index;
+            }
 
         particle_handler.update_cached_numbers();
       }
@@ -0,0 +1,281 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+#include <deal.II/base/bounding_box.h>
+#include <deal.II/base/parallel.h>
+
+#include <deal.II/numerics/rtree.h>
+
+#include <deal.II/particles/neighbor_list.h>
+
+#include <algorithm>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace Particles
+{
+  template <int dim, int spacedim>
+  NeighborList<dim, spacedim>::NeighborList()
+    : cutoff_radius(0.)
+    , skin(0.)
+    , n_locally_owned_particles(0)
+  {}
+
+
+
+  template <int dim, int spacedim>
+  NeighborList<dim, spacedim>::NeighborList(
+    const ParticleHandler<dim, spacedim> &particle_handler,
+    const double                          cutoff_radius,
+    const double                          skin)
+    : NeighborList()
+  {
+    reinit(particle_handler, cutoff_radius, skin);
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  NeighborList<dim, spacedim>::reinit(
+    const ParticleHandler<dim, spacedim> &particle_handler,
+    const double                          cutoff_radius,
+    const double                          skin)
+  {
+    Assert(cutoff_radius > 0.,
+           ExcMessage("The cutoff radius must be positive."));
+    Assert(skin >= 0., ExcMessage("The skin distance must not be negative."));
+
+    this->particle_handler = &particle_handler;
+    this->cutoff_radius    = cutoff_radius;
+    this->skin             = skin;
+
+    rebuild();
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  NeighborList<dim, spacedim>::rebuild()
+  {
+    Assert(particle_handler != nullptr,
+           ExcMessage("The neighbor list has not been initialized."));
+
+    // Gather the locations and ids of the locally owned particles and then
+    // of the ghost particles, grouped by the cells they are in
+    std::vector<unsigned int>          first_particle_of_group;
+    std::vector<types::particle_index> ids;
+    build_locations.clear();
+    const auto gather_particles = [&](auto particle, const auto end) {
+      while (particle != end)
+        {
+          const auto pic = particle_handler->particles_in_cell(
+            particle->get_surrounding_cell());
+
+          Assert(pic.begin() == particle, ExcInternalError());
+          first_particle_of_group.push_back(ids.size());
+          for (; particle != pic.end(); ++particle)
+            {
+              ids.push_back(particle->get_id());
+              build_locations.push_back(particle->get_location());
+            }
+        }
+    };
+    gather_particles(particle_handler->begin(), particle_handler->end());
+    const unsigned int n_owned_groups = first_particle_of_group.size();
+    n_locally_owned_particles         = ids.size();
+    gather_particles(particle_handler->begin_ghost(),
+                     particle_handler->end_ghost());
+    first_particle_of_group.push_back(ids.size());
+
+    particle_indices.clear();
+    particle_indices.reserve(ids.size());
+    for (unsigned int i = 0; i < ids.size(); ++i)
+      particle_indices[ids[i]] = i;
+
+    // Put the bounding boxes of the particles of each group into a tree
+    const unsigned int n_groups = first_particle_of_group.size() - 1;
+    std::vector<std::pair<BoundingBox<spacedim>, unsigned int>> boxes(
+      n_groups);
+    for (unsigned int g = 0; g < n_groups; ++g)
+      {
+        Point<spacedim> lower = build_locations[first_particle_of_group[g]];
+        Point<spacedim> upper = lower;
+        for (unsigned int i = first_particle_of_group[g] + 1;
+             i < first_particle_of_group[g + 1];
+             ++i)
+          for (unsigned int d = 0; d < spacedim; ++d)
+            {
+              lower[d] = std::min(lower[d], build_locations[i][d]);
+              upper[d] = std::max(upper[d], build_locations[i][d]);
+            }
+        boxes[g] = std::make_pair(BoundingBox<spacedim>(
+                                    std::make_pair(lower, upper)),
+                                  g);
+      }
+    const auto tree = pack_rtree(boxes);
+
+    // Find the neighbors of the particles of each locally owned group in
+    // parallel. The neighbors of the particles of a group are stored one
+    // particle after the other, so that the lists of all groups can be
+    // concatenated to the rows of all particles.
+    const double search_radius        = cutoff_radius + skin;
+    const double search_radius_square = search_radius * search_radius;
+    std::vector<std::vector<types::particle_index>> group_neighbors(
+      n_owned_groups);
+    std::vector<unsigned int> n_neighbors_of_particle(
+      n_locally_owned_particles);
+    parallel::apply_to_subranges(
+      0U,
+      n_owned_groups,
+      [&](const unsigned int begin, const unsigned int end) {
+        std::vector<std::pair<BoundingBox<spacedim>, unsigned int>> candidates;
+        for (unsigned int g = begin; g < end; ++g)
+          {
+            BoundingBox<spacedim> search_box = boxes[g].first;
+            search_box.extend(search_radius);
+            candidates.clear();
+            tree.query(boost::geometry::index::intersects(search_box),
+                       std::back_inserter(candidates));
+            std::sort(candidates.begin(),
+                      candidates.end(),
+                      [](const auto &a, const auto &b) {
+                        return a.second < b.second;
+                      });
+
+            for (unsigned int i = first_particle_of_group[g];
+                 i < first_particle_of_group[g + 1];
+                 ++i)
+              {
+                const std::size_t n_before = group_neighbors[g].size();
+                for (const auto &candidate : candidates)
+                  for (unsigned int j =
+                         first_particle_of_group[candidate.second];
+                       j < first_particle_of_group[candidate.second + 1];
+                       ++j)
+                    if (j != i && build_locations[i].distance_square(
+                                    build_locations[j]) < search_radius_square)
+                      group_neighbors[g].push_back(ids[j]);
+                n_neighbors_of_particle[i] =
+                  group_neighbors[g].size() - n_before;
+              }
+          }
+      },
+      16);
+
+    row_starts.resize(n_locally_owned_particles + 1);
+    row_starts[0] = 0;
+    for (unsigned int i = 0; i < n_locally_owned_particles; ++i)
+      row_starts[i + 1] = row_starts[i] + n_neighbors_of_particle[i];
+
+    neighbor_ids.clear();
+    neighbor_ids.reserve(row_starts.back());
+    for (const auto &neighbors : group_neighbors)
+      neighbor_ids.insert(neighbor_ids.end(),
+                          neighbors.begin(),
+                          neighbors.end());
+  }
+
+
+
+  template <int dim, int spacedim>
+  bool
+  NeighborList<dim, spacedim>::needs_rebuild() const
+  {
+    Assert(particle_handler != nullptr,
+           ExcMessage("The neighbor list has not been initialized."));
+
+    if (particle_handler->n_locally_owned_particles() !=
+        n_locally_owned_particles)
+      return true;
+
+    // check the distance each particle has moved. particles that are not
+    // in the list or a different number of particles mean that particles
+    // have been added or removed
+    const double max_distance_square = 0.25 * skin * skin;
+    std::size_t  n_particles         = 0;
+    const auto   has_moved_too_far   = [&](auto particle, const auto end) {
+      for (; particle != end; ++particle, ++n_particles)
+        {
+          const auto index = particle_indices.find(particle->get_id());
+          if (index == particle_indices.end() ||
+              particle->get_location().distance_square(
+                build_locations[index->second]) > max_distance_square)
+            return true;
+        }
+      return false;
+    };
+    return has_moved_too_far(particle_handler->begin(),
+                             particle_handler->end()) ||
+           has_moved_too_far(particle_handler->begin_ghost(),
+                             particle_handler->end_ghost()) ||
+           n_particles != build_locations.size();
+  }
+
+
+
+  template <int dim, int spacedim>
+  bool
+  NeighborList<dim, spacedim>::update()
+  {
+    if (needs_rebuild())
+      {
+        rebuild();
+        return true;
+      }
+    else
+      return false;
+  }
+
+
+
+  template <int dim, int spacedim>
+  ArrayView<const types::particle_index>
+  NeighborList<dim, spacedim>::get_neighbors(
+    const types::particle_index particle_id) const
+  {
+    const auto index = particle_indices.find(particle_id);
+    Assert(index != particle_indices.end() &&
+             index->second < n_locally_owned_particles,
+           ExcMessage("The particle with id " + std::to_string(particle_id) +
+                      " was not locally owned when the neighbor list was "
+                      "built."));
+    return make_array_view(neighbor_ids.data() + row_starts[index->second],
+                           neighbor_ids.data() + row_starts[index->second + 1]);
+  }
+
+
+
+  template <int dim, int spacedim>
+  unsigned int
+  NeighborList<dim, spacedim>::n_particles() const
+  {
+    return n_locally_owned_particles;
+  }
+
+
+
+  template <int dim, int spacedim>
+  std::size_t
+  NeighborList<dim, spacedim>::n_neighbors() const
+  {
+    return neighbor_ids.size();
+  }
+} // namespace Particles
+
+#include "neighbor_list.inst"
+
+DEAL_II_NAMESPACE_CLOSE
@@ -13,6 +13,8 @@
 //
 // ---------------------------------------------------------------------
 
+#include <deal.II/base/parallel.h>
+
 #include <deal.II/grid/grid_tools.h>
 #include <deal.II/grid/grid_tools_cache.h>
 
@@ -20,6 +22,7 @@
 
 #include <deal.II/particles/particle_handler.h>
 
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <utility>
@@ -28,32 +31,6 @@ DEAL_II_NAMESPACE_OPEN
 
 namespace Particles
 {
-  namespace
-  {
-    template <int dim, int spacedim>
-    std::vector<char>
-    pack_particles(std::vector<ParticleIterator<dim, spacedim>> &particles)
-    {
-      std::vector<char> buffer;
-
-      if (particles.size() == 0)
-        return buffer;
-
-      buffer.resize(particles.size() *
-                    particles.front()->serialized_size_in_bytes());
-      void *current_data = buffer.data();
-
-      for (const auto &particle : particles)
-        {
-          current_data = particle->write_particle_data_to_memory(current_data);
-        }
-
-      return buffer;
-    }
-  } // namespace
-
-
-
   template <int dim, int spacedim>
   ParticleHandler<dim, spacedim>::ParticleHandler()
     : triangulation()
@@ -68,6 +45,7 @@ namespace Particles
     , load_callback()
     , handle(numbers::invalid_unsigned_int)
     , tria_listeners()
+    , particle_weight(0)
   {
     reset_particle_container(particles);
   }
@@ -95,6 +73,7 @@ namespace Particles
         std::make_unique<GridTools::Cache<dim, spacedim>>(triangulation,
                                                           mapping))
     , tria_listeners()
+    , particle_weight(0)
   {
     reset_particle_container(particles);
     connect_to_triangulation_signals();
@@ -151,6 +130,7 @@ namespace Particles
   {
     const unsigned int n_properties =
       particle_handler.property_pool->n_properties_per_slot();
+    particle_weight = particle_handler.particle_weight;
     initialize(*particle_handler.triangulation,
                *particle_handler.mapping,
                n_properties);
@@ -1221,55 +1201,90 @@ namespace Particles
     // TODO: Extend this function to allow keeping particles on other
     // processes around (with an invalid cell).
 
-    std::vector<particle_iterator> particles_out_of_cell;
-
-    // Reserve some space for particles that need sorting to avoid frequent
-    // re-allocation. Guess 25% of particles need sorting. Balance memory
-    // overhead and performance.
-    particles_out_of_cell.reserve(n_locally_owned_particles() / 4);
-
-    // Now update the reference locations of the moved particles
-    std::vector<Point<spacedim>> real_locations;
-    std::vector<Point<dim>>      reference_locations;
-    real_locations.reserve(global_max_particles_per_cell);
-    reference_locations.reserve(global_max_particles_per_cell);
+    using active_cell_iterator =
+      typename Triangulation<dim, spacedim>::active_cell_iterator;
 
+    // Particles can be inserted into arbitrary cells, e.g. if their cell is
+    // not known. However, for artificial cells we can not evaluate the
+    // reference position of particles. Do not sort particles that are not
+    // locally owned, because they will be sorted by the process that owns
+    // them.
+    std::vector<active_cell_iterator> locally_owned_cells;
     for (const auto &cell : triangulation->active_cell_iterators())
-      {
-        // Particles can be inserted into arbitrary cells, e.g. if their cell is
-        // not known. However, for artificial cells we can not evaluate
-        // the reference position of particles. Do not sort particles that are
-        // not locally owned, because they will be sorted by the process that
-        // owns them.
-        if (cell->is_locally_owned() == false)
+      if (cell->is_locally_owned())
+        locally_owned_cells.push_back(cell);
+
+    // Update the reference locations of the particles in parallel over the
+    // cells. Each cell collects the particles that have left it in a list of
+    // its own, so that the order of the particles in particles_out_of_cell
+    // does not depend on the number of threads.
+    std::vector<std::vector<particle_iterator>> particles_out_of_cell_by_cell(
+      locally_owned_cells.size());
+    parallel::apply_to_subranges(
+      std::size_t(0),
+      locally_owned_cells.size(),
+      [&](const std::size_t begin, const std::size_t end) {
+        std::vector<Point<spacedim>> real_locations;
+        std::vector<Point<dim>>      reference_locations;
+        real_locations.reserve(global_max_particles_per_cell);
+        reference_locations.reserve(global_max_particles_per_cell);
+
+        for (std::size_t c = begin; c < end; ++c)
           {
-            continue;
+            const auto &       cell  = locally_owned_cells[c];
+            const unsigned int n_pic = n_particles_in_cell(cell);
+            auto               pic   = particles_in_cell(cell);
+
+            real_locations.clear();
+            for (const auto &particle : pic)
+              real_locations.push_back(particle.get_location());
+
+            reference_locations.resize(n_pic);
+            mapping->transform_points_real_to_unit_cell(cell,
+                                                        real_locations,
+                                                        reference_locations);
+
+            auto particle = pic.begin();
+            for (const auto &p_unit : reference_locations)
+              {
+                if (p_unit[0] == std::numeric_limits<double>::infinity() ||
+                    !GeometryInfo<dim>::is_inside_unit_cell(p_unit))
+                  particles_out_of_cell_by_cell[c].push_back(particle);
+                else
+                  particle->set_reference_location(p_unit);
+
+                ++particle;
+              }
           }
+      },
+      32);
 
-        const unsigned int n_pic = n_particles_in_cell(cell);
-        auto               pic   = particles_in_cell(cell);
+    std::size_t n_particles_out_of_cell = 0;
+    for (const auto &particles : particles_out_of_cell_by_cell)
+      n_particles_out_of_cell += particles.size();
 
-        real_locations.clear();
-        for (const auto &particle : pic)
-          real_locations.push_back(particle.get_location());
+    std::vector<particle_iterator> particles_out_of_cell;
+    particles_out_of_cell.reserve(n_particles_out_of_cell);
+    for (const auto &particles : particles_out_of_cell_by_cell)
+      particles_out_of_cell.insert(particles_out_of_cell.end(),
+                                   particles.begin(),
+                                   particles.end());
+    particles_out_of_cell_by_cell.clear();
 
-        reference_locations.resize(n_pic);
-        mapping->transform_points_real_to_unit_cell(cell,
-                                                    real_locations,
-                                                    reference_locations);
+    sort_particles_into_subdomains_and_cells(particles_out_of_cell);
+  }
 
-        auto particle = pic.begin();
-        for (const auto &p_unit : reference_locations)
-          {
-            if (p_unit[0] == std::numeric_limits<double>::infinity() ||
-                !GeometryInfo<dim>::is_inside_unit_cell(p_unit))
-              particles_out_of_cell.push_back(particle);
-            else
-              particle->set_reference_location(p_unit);
 
-            ++particle;
-          }
-      }
+
+  template <int dim, int spacedim>
+  void
+  ParticleHandler<dim, spacedim>::sort_particles_into_subdomains_and_cells(
+    const std::vector<particle_iterator> &particles_out_of_cell)
+  {
+    Assert(triangulation != nullptr, ExcInternalError());
+
+    using active_cell_iterator =
+      typename Triangulation<dim, spacedim>::active_cell_iterator;
 
     // There are three reasons why a particle is not in its old cell:
     // It moved to another cell, to another subdomain or it left the mesh.
@@ -1279,9 +1294,7 @@ namespace Particles
     // the mesh completely are ignored and removed.
     std::map<types::subdomain_id, std::vector<particle_iterator>>
       moved_particles;
-    std::map<
-      types::subdomain_id,
-      std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>>
+    std::map<types::subdomain_id, std::vector<active_cell_iterator>>
       moved_cells;
 
     // We do not know exactly how many particles are lost, exchanged between
@@ -1305,166 +1318,191 @@ namespace Particles
     for (const auto &ghost_owner : ghost_owners)
       moved_cells[ghost_owner].reserve(particles_out_of_cell.size() / 4);
 
-    {
-      // Create a map from vertices to adjacent cells using grid cache
-      const std::vector<
-        std::set<typename Triangulation<dim, spacedim>::active_cell_iterator>>
-        &vertex_to_cells = triangulation_cache->get_vertex_to_cell_map();
-
-      // Create a corresponding map of vectors from vertex to cell center
-      // using grid cache
-      const std::vector<std::vector<Tensor<1, spacedim>>>
-        &vertex_to_cell_centers =
-          triangulation_cache->get_vertex_to_cell_centers_directions();
-
-      std::vector<unsigned int> neighbor_permutation;
-
-      // Reuse these vectors below, but only with a single element.
-      // Avoid resizing for every particle.
-      Point<dim>      invalid_reference_point;
-      Point<spacedim> invalid_point;
-      invalid_reference_point[0] = std::numeric_limits<double>::infinity();
-      invalid_point[0]           = std::numeric_limits<double>::infinity();
-      reference_locations.resize(1, invalid_reference_point);
-      real_locations.resize(1, invalid_point);
-
-      // Find the cells that the particles moved to.
-      for (auto &out_particle : particles_out_of_cell)
-        {
-          // make a copy of the current cell, since we will modify the
-          // variable current_cell below, but we need the original in
-          // the case the particle is not found
-          auto current_cell = out_particle->get_surrounding_cell();
-
-          real_locations[0] = out_particle->get_location();
-
-          // Record if the new cell was found
-          bool found_cell = false;
-
-          // Check if the particle is in one of the old cell's neighbors
-          // that are adjacent to the closest vertex
-          const unsigned int closest_vertex =
-            GridTools::find_closest_vertex_of_cell<dim, spacedim>(
-              current_cell, out_particle->get_location(), *mapping);
-          Tensor<1, spacedim> vertex_to_particle =
-            out_particle->get_location() - current_cell->vertex(closest_vertex);
-          vertex_to_particle /= vertex_to_particle.norm();
-
-          const unsigned int closest_vertex_index =
-            current_cell->vertex_index(closest_vertex);
-          const unsigned int n_neighbor_cells =
-            vertex_to_cells[closest_vertex_index].size();
-
-          neighbor_permutation.resize(n_neighbor_cells);
-          for (unsigned int i = 0; i < n_neighbor_cells; ++i)
-            neighbor_permutation[i] = i;
-
-          const auto &cell_centers =
-            vertex_to_cell_centers[closest_vertex_index];
-          std::sort(neighbor_permutation.begin(),
-                    neighbor_permutation.end(),
-                    [&vertex_to_particle, &cell_centers](const unsigned int a,
-                                                         const unsigned int b) {
-                      return compare_particle_association(a,
-                                                          b,
-                                                          vertex_to_particle,
-                                                          cell_centers);
-                    });
-
-          // Search all of the cells adjacent to the closest vertex of the
-          // previous cell Most likely we will find the particle in them.
-          for (unsigned int i = 0; i < n_neighbor_cells; ++i)
-            {
-              typename std::set<typename Triangulation<dim, spacedim>::
-                                  active_cell_iterator>::const_iterator cell =
-                vertex_to_cells[closest_vertex_index].begin();
+    if (particles_out_of_cell.size() > 0)
+      {
+        // Create a map from vertices to adjacent cells using grid cache
+        const std::vector<std::set<active_cell_iterator>> &vertex_to_cells =
+          triangulation_cache->get_vertex_to_cell_map();
+
+        // Create a corresponding map of vectors from vertex to cell center
+        // using grid cache
+        const std::vector<std::vector<Tensor<1, spacedim>>>
+          &vertex_to_cell_centers =
+            triangulation_cache->get_vertex_to_cell_centers_directions();
+
+        // The cache builds its data structures on first access, which is not
+        // thread-safe, so query the tree of vertices before the parallel
+        // search below
+        const auto &used_vertices_rtree =
+          triangulation_cache->get_used_vertices_rtree();
+
+        // Find the cells that the particles moved to and their reference
+        // locations in parallel. Particles for which no cell is found keep
+        // an invalid cell iterator.
+        std::vector<active_cell_iterator> new_cells(
+          particles_out_of_cell.size());
+        std::vector<Point<dim>> new_reference_locations(
+          particles_out_of_cell.size());
+
+        parallel::apply_to_subranges(
+          std::size_t(0),
+          particles_out_of_cell.size(),
+          [&](const std::size_t begin, const std::size_t end) {
+            std::vector<unsigned int> neighbor_permutation;
+
+            // Reuse these vectors below, but only with a single element.
+            // Avoid resizing for every particle.
+            Point<dim>      invalid_reference_point;
+            Point<spacedim> invalid_point;
+            invalid_reference_point[0] =
+              std::numeric_limits<double>::infinity();
+            invalid_point[0] = std::numeric_limits<double>::infinity();
+            std::vector<Point<dim>> reference_locations(
+              1, invalid_reference_point);
+            std::vector<Point<spacedim>> real_locations(1, invalid_point);
+
+            for (std::size_t p = begin; p < end; ++p)
+              {
+                const particle_iterator &out_particle =
+                  particles_out_of_cell[p];
+                const auto current_cell = out_particle->get_surrounding_cell();
+
+                real_locations[0] = out_particle->get_location();
+
+                // Check if the particle is in one of the old cell's neighbors
+                // that are adjacent to the closest vertex
+                const unsigned int closest_vertex =
+                  GridTools::find_closest_vertex_of_cell<dim, spacedim>(
+                    current_cell, out_particle->get_location(), *mapping);
+                Tensor<1, spacedim> vertex_to_particle =
+                  out_particle->get_location() -
+                  current_cell->vertex(closest_vertex);
+                vertex_to_particle /= vertex_to_particle.norm();
+
+                const unsigned int closest_vertex_index =
+                  current_cell->vertex_index(closest_vertex);
+                const unsigned int n_neighbor_cells =
+                  vertex_to_cells[closest_vertex_index].size();
+
+                neighbor_permutation.resize(n_neighbor_cells);
+                for (unsigned int i = 0; i < n_neighbor_cells; ++i)
+                  neighbor_permutation[i] = i;
+
+                const auto &cell_centers =
+                  vertex_to_cell_centers[closest_vertex_index];
+                std::sort(neighbor_permutation.begin(),
+                          neighbor_permutation.end(),
+                          [&vertex_to_particle,
+                           &cell_centers](const unsigned int a,
+                                          const unsigned int b) {
+                            return compare_particle_association(
+                              a, b, vertex_to_particle, cell_centers);
+                          });
+
+                // Search all of the cells adjacent to the closest vertex of
+                // the previous cell Most likely we will find the particle in
+                // them.
+                for (unsigned int i = 0; i < n_neighbor_cells; ++i)
+                  {
+                    auto cell = vertex_to_cells[closest_vertex_index].begin();
 
-              std::advance(cell, neighbor_permutation[i]);
-              mapping->transform_points_real_to_unit_cell(*cell,
-                                                          real_locations,
-                                                          reference_locations);
+                    std::advance(cell, neighbor_permutation[i]);
+                    mapping->transform_points_real_to_unit_cell(
+                      *cell, real_locations, reference_locations);
 
-              if (GeometryInfo<dim>::is_inside_unit_cell(
-                    reference_locations[0]))
-                {
-                  current_cell = *cell;
-                  found_cell   = true;
-                  break;
-                }
-            }
+                    if (GeometryInfo<dim>::is_inside_unit_cell(
+                          reference_locations[0]))
+                      {
+                        new_cells[p] = *cell;
+                        break;
+                      }
+                  }
 
-          if (!found_cell)
-            {
-              // The particle is not in a neighbor of the old cell.
-              // Look for the new cell in the whole local domain.
-              // This case is rare.
-              std::vector<std::pair<Point<spacedim>, unsigned int>>
-                closest_vertex_in_domain;
-              triangulation_cache->get_used_vertices_rtree().query(
-                boost::geometry::index::nearest(out_particle->get_location(),
-                                                1),
-                std::back_inserter(closest_vertex_in_domain));
-
-              // We should have one and only one result
-              AssertDimension(closest_vertex_in_domain.size(), 1);
-              const unsigned int closest_vertex_index_in_domain =
-                closest_vertex_in_domain[0].second;
-
-              // Search all of the cells adjacent to the closest vertex of the
-              // domain. Most likely we will find the particle in them.
-              for (const auto &cell :
-                   vertex_to_cells[closest_vertex_index_in_domain])
-                {
-                  mapping->transform_points_real_to_unit_cell(
-                    cell, real_locations, reference_locations);
-
-                  if (GeometryInfo<dim>::is_inside_unit_cell(
-                        reference_locations[0]))
-                    {
-                      current_cell = cell;
-                      found_cell   = true;
-                      break;
-                    }
-                }
-            }
+                if (new_cells[p].state() != IteratorState::valid)
+                  {
+                    // The particle is not in a neighbor of the old cell.
+                    // Look for the new cell in the whole local domain.
+                    // This case is rare.
+                    std::vector<std::pair<Point<spacedim>, unsigned int>>
+                      closest_vertex_in_domain;
+                    used_vertices_rtree.query(
+                      boost::geometry::index::nearest(
+                        out_particle->get_location(), 1),
+                      std::back_inserter(closest_vertex_in_domain));
+
+                    // We should have one and only one result
+                    AssertDimension(closest_vertex_in_domain.size(), 1);
+                    const unsigned int closest_vertex_index_in_domain =
+                      closest_vertex_in_domain[0].second;
+
+                    // Search all of the cells adjacent to the closest vertex
+                    // of the domain. Most likely we will find the particle in
+                    // them.
+                    for (const auto &cell :
+                         vertex_to_cells[closest_vertex_index_in_domain])
+                      {
+                        mapping->transform_points_real_to_unit_cell(
+                          cell, real_locations, reference_locations);
 
-          if (!found_cell)
-            {
-              // We can find no cell for this particle. It has left the
-              // domain due to an integration error or an open boundary.
-              // Signal the loss and move on.
-              signals.particle_lost(out_particle,
-                                    out_particle->get_surrounding_cell());
-              continue;
-            }
+                        if (GeometryInfo<dim>::is_inside_unit_cell(
+                              reference_locations[0]))
+                          {
+                            new_cells[p] = cell;
+                            break;
+                          }
+                      }
+                  }
+
+                new_reference_locations[p] = reference_locations[0];
+              }
+          },
+          64);
 
-          // If we are here, we found a cell and reference position for this
-          // particle
-          out_particle->set_reference_location(reference_locations[0]);
+        // Now move the particles in the order of particles_out_of_cell,
+        // which makes the result independent of the number of threads
+        for (std::size_t p = 0; p < particles_out_of_cell.size(); ++p)
+          {
+            particle_iterator           out_particle = particles_out_of_cell[p];
+            const active_cell_iterator &current_cell = new_cells[p];
 
-          // Reinsert the particle into our domain if we own its cell.
-          // Mark it for MPI transfer otherwise
-          if (current_cell->is_locally_owned())
-            {
-              typename PropertyPool<dim, spacedim>::Handle &old =
-                out_particle->particles_in_cell
-                  ->particles[out_particle->particle_index_within_cell];
+            if (current_cell.state() != IteratorState::valid)
+              {
+                // We can find no cell for this particle. It has left the
+                // domain due to an integration error or an open boundary.
+                // Signal the loss and move on.
+                signals.particle_lost(out_particle,
+                                      out_particle->get_surrounding_cell());
+                continue;
+              }
 
-              // Avoid deallocating the memory of this particle
-              const auto old_value = old;
-              old = PropertyPool<dim, spacedim>::invalid_handle;
+            // If we are here, we found a cell and reference position for this
+            // particle
+            out_particle->set_reference_location(new_reference_locations[p]);
 
-              // Allocate particle with the old handle
-              insert_particle(old_value, current_cell);
-            }
-          else
-            {
-              moved_particles[current_cell->subdomain_id()].push_back(
-                out_particle);
-              moved_cells[current_cell->subdomain_id()].push_back(current_cell);
-            }
-        }
-    }
+            // Reinsert the particle into our domain if we own its cell.
+            // Mark it for MPI transfer otherwise
+            if (current_cell->is_locally_owned())
+              {
+                typename PropertyPool<dim, spacedim>::Handle &old =
+                  out_particle->particles_in_cell
+                    ->particles[out_particle->particle_index_within_cell];
+
+                // Avoid deallocating the memory of this particle
+                const auto old_value = old;
+                old = PropertyPool<dim, spacedim>::invalid_handle;
+
+                // Allocate particle with the old handle
+                insert_particle(old_value, current_cell);
+              }
+            else
+              {
+                moved_particles[current_cell->subdomain_id()].push_back(
+                  out_particle);
+                moved_cells[current_cell->subdomain_id()].push_back(
+                  current_cell);
+              }
+          }
+      }
 
     // Exchange particles between processors if we have more than one process
 #ifdef DEAL_II_WITH_MPI
@@ -1482,6 +1520,15 @@ namespace Particles
     remove_particles(particles_out_of_cell);
 
     // now make sure particle data is sorted in order of iteration
+    sort_particle_data_by_cell();
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  ParticleHandler<dim, spacedim>::sort_particle_data_by_cell()
+  {
     std::vector<typename PropertyPool<dim, spacedim>::Handle> unsorted_handles;
     unsorted_handles.reserve(property_pool->n_registered_slots());
 
@@ -1494,8 +1541,50 @@ namespace Particles
         }
 
     property_pool->sort_memory_slots(unsorted_handles);
+  }
+
+
+
+  template <int dim, int spacedim>
+  bool
+  ParticleHandler<dim, spacedim>::has_contiguous_particle_data(
+    const typename Triangulation<dim, spacedim>::active_cell_iterator &cell)
+    const
+  {
+    if (n_particles_in_cell(cell) == 0)
+      return true;
+
+    const std::vector<typename PropertyPool<dim, spacedim>::Handle> &handles =
+      cells_to_particle_cache[cell->active_cell_index()]->particles;
+    for (unsigned int i = 1; i < handles.size(); ++i)
+      if (handles[i] != handles[0] + i)
+        return false;
+    return true;
+  }
 
-  } // namespace Particles
+
+
+  template <int dim, int spacedim>
+  typename ParticleHandler<dim, spacedim>::ParticleDataInCell
+  ParticleHandler<dim, spacedim>::get_particle_data_in_cell(
+    const typename Triangulation<dim, spacedim>::active_cell_iterator &cell)
+  {
+    Assert(has_contiguous_particle_data(cell),
+           ExcMessage("The data of the particles in this cell is not stored "
+                      "contiguously. Call sort_particle_data_by_cell() "
+                      "before calling this function."));
+
+    const unsigned int n_particles = n_particles_in_cell(cell);
+    const typename PropertyPool<dim, spacedim>::Handle first_handle =
+      n_particles > 0 ?
+        cells_to_particle_cache[cell->active_cell_index()]->particles[0] :
+        0;
+
+    return {property_pool->get_locations(first_handle, n_particles),
+            property_pool->get_reference_locations(first_handle, n_particles),
+            property_pool->get_properties(first_handle, n_particles),
+            property_pool->n_properties_per_slot()};
+  }
 
 
 
@@ -1640,6 +1729,37 @@ namespace Particles
 
 
 
+  template <int dim, int spacedim>
+  void
+  ParticleHandler<dim, spacedim>::update_ghost_particles(
+    const std::vector<unsigned int> &property_indices,
+    const GhostLocationUpdate        location_update)
+  {
+    // Nothing to do in serial computations
+    const auto parallel_triangulation =
+      dynamic_cast<const parallel::TriangulationBase<dim, spacedim> *>(
+        &*triangulation);
+    if (parallel_triangulation == nullptr ||
+        dealii::Utilities::MPI::n_mpi_processes(
+          parallel_triangulation->get_communicator()) == 1)
+      {
+        (void)property_indices;
+        (void)location_update;
+        return;
+      }
+
+#ifdef DEAL_II_WITH_MPI
+    Assert(ghost_particles_cache.valid,
+           ExcMessage(
+             "Ghost particles cannot be updated if they first have not been "
+             "exchanged at least once with the cache enabled"));
+
+    send_recv_particles_properties_subset(property_indices, location_update);
+#endif
+  }
+
+
+
 #ifdef DEAL_II_WITH_MPI
   template <int dim, int spacedim>
   void
@@ -1887,7 +2007,15 @@ namespace Particles
             recv_pointers_particles[i] +
             n_recv_data[i] * individual_particle_data_size;
 
-        ghost_particles_cache.neighbors = neighbors;
+        ghost_particles_cache.neighbors        = neighbors;
+        ghost_particles_cache.n_send_particles = n_send_data;
+        ghost_particles_cache.n_recv_particles = n_recv_data;
+
+        // The persistent requests refer to the previous communication
+        // pattern and the receivers do not know the sent locations yet
+        ghost_particles_cache.persistent_requests.reset();
+        ghost_particles_cache.persistent_requests_bytes_per_particle = 0;
+        ghost_particles_cache.sent_locations_valid                   = false;
 
         ghost_particles_cache.send_data.resize(
           ghost_particles_cache.send_pointers.back());
@@ -2047,6 +2175,238 @@ namespace Particles
                 ExcMessage(
                   "The amount of data that was read into new particles "
                   "does not match the amount of data sent around."));
+
+    // The locations of the ghost particles have been overwritten
+    ghost_particles_cache.sent_locations_valid = false;
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  ParticleHandler<dim, spacedim>::send_recv_particles_properties_subset(
+    const std::vector<unsigned int> &property_indices,
+    const GhostLocationUpdate        location_update)
+  {
+    const auto parallel_triangulation =
+      dynamic_cast<const parallel::TriangulationBase<dim, spacedim> *>(
+        &*triangulation);
+    Assert(
+      parallel_triangulation,
+      ExcMessage(
+        "This function is only implemented for parallel::TriangulationBase "
+        "objects."));
+
+    for (const unsigned int index : property_indices)
+      {
+        AssertIndexRange(index, n_properties_per_particle());
+        (void)index;
+      }
+
+    auto &             cache       = ghost_particles_cache;
+    const auto &       neighbors   = cache.neighbors;
+    const unsigned int n_neighbors = neighbors.size();
+
+    // Send the full locations if the receivers do not know the locations
+    // the changes refer to. All processes call this function at the same
+    // time and keep track of the same state, so sender and receiver agree
+    // on the format.
+    const bool send_delta =
+      location_update == GhostLocationUpdate::single_precision_delta &&
+      cache.sent_locations_valid;
+    const unsigned int location_size =
+      location_update == GhostLocationUpdate::none ?
+        0 :
+        (send_delta ? spacedim * sizeof(float) : spacedim * sizeof(double));
+    const unsigned int bytes_per_particle =
+      location_size + property_indices.size() * sizeof(double);
+
+    unsigned int n_recv_requests = 0;
+    for (unsigned int i = 0; i < n_neighbors; ++i)
+      if (cache.n_recv_particles[i] > 0)
+        ++n_recv_requests;
+
+    // Set up the buffers and the persistent requests if this is the first
+    // call or the amount of data per particle has changed
+    if (cache.persistent_requests == nullptr ||
+        cache.persistent_requests_bytes_per_particle != bytes_per_particle)
+      {
+        cache.persistent_requests.reset();
+
+        unsigned int n_send_particles = 0;
+        unsigned int n_recv_particles = 0;
+        for (unsigned int i = 0; i < n_neighbors; ++i)
+          {
+            n_send_particles += cache.n_send_particles[i];
+            n_recv_particles += cache.n_recv_particles[i];
+          }
+        cache.subset_send_data.resize(n_send_particles * bytes_per_particle);
+        cache.subset_recv_data.resize(n_recv_particles * bytes_per_particle);
+        cache.sent_locations.resize(n_send_particles);
+
+        cache.persistent_requests.reset(
+          new std::vector<MPI_Request>(),
+          [](std::vector<MPI_Request> *requests) {
+            int finalized;
+            MPI_Finalized(&finalized);
+            if (finalized == 0)
+              for (auto &request : *requests)
+                {
+                  const int ierr = MPI_Request_free(&request);
+                  AssertNothrow(ierr == MPI_SUCCESS, ExcMPI(ierr));
+                }
+            delete requests;
+          });
+        std::vector<MPI_Request> &requests = *cache.persistent_requests;
+
+        const int mpi_tag = Utilities::MPI::internal::Tags::
+          particle_handler_send_recv_particles_send;
+
+        char *recv_data = cache.subset_recv_data.data();
+        for (unsigned int i = 0; i < n_neighbors; ++i)
+          if (cache.n_recv_particles[i] > 0)
+            {
+              requests.emplace_back();
+              const int ierr =
+                MPI_Recv_init(recv_data,
+                              cache.n_recv_particles[i] * bytes_per_particle,
+                              MPI_CHAR,
+                              neighbors[i],
+                              mpi_tag,
+                              parallel_triangulation->get_communicator(),
+                              &requests.back());
+              AssertThrowMPI(ierr);
+              recv_data += cache.n_recv_particles[i] * bytes_per_particle;
+            }
+
+        char *send_data = cache.subset_send_data.data();
+        for (unsigned int i = 0; i < n_neighbors; ++i)
+          if (cache.n_send_particles[i] > 0)
+            {
+              requests.emplace_back();
+              const int ierr =
+                MPI_Send_init(send_data,
+                              cache.n_send_particles[i] * bytes_per_particle,
+                              MPI_CHAR,
+                              neighbors[i],
+                              mpi_tag,
+                              parallel_triangulation->get_communicator(),
+                              &requests.back());
+              AssertThrowMPI(ierr);
+              send_data += cache.n_send_particles[i] * bytes_per_particle;
+            }
+
+        cache.persistent_requests_bytes_per_particle = bytes_per_particle;
+      }
+
+    std::vector<MPI_Request> &requests = *cache.persistent_requests;
+
+    // Post the receives before packing the data to send
+    if (n_recv_requests > 0)
+      {
+        const int ierr = MPI_Startall(n_recv_requests, requests.data());
+        AssertThrowMPI(ierr);
+      }
+
+    // Fill data to send, sorted by receiving process. Keep track of the
+    // locations as the receivers reconstruct them.
+    char *       send_data   = cache.subset_send_data.data();
+    unsigned int particle_no = 0;
+    for (const auto i : neighbors)
+      for (const auto &p : cache.ghost_particles_by_domain.at(i))
+        {
+          if (location_update != GhostLocationUpdate::none)
+            {
+              const Point<spacedim> &location = p->get_location();
+              Point<spacedim> &sent_location =
+                cache.sent_locations[particle_no];
+              if (send_delta)
+                for (unsigned int d = 0; d < spacedim; ++d)
+                  {
+                    const float delta = location[d] - sent_location[d];
+                    std::memcpy(send_data, &delta, sizeof(float));
+                    send_data += sizeof(float);
+                    sent_location[d] += static_cast<double>(delta);
+                  }
+              else
+                for (unsigned int d = 0; d < spacedim; ++d)
+                  {
+                    std::memcpy(send_data, &location[d], sizeof(double));
+                    send_data += sizeof(double);
+                    sent_location[d] = location[d];
+                  }
+            }
+
+          const ArrayView<const double> properties = p->get_properties();
+          for (const unsigned int index : property_indices)
+            {
+              std::memcpy(send_data, &properties[index], sizeof(double));
+              send_data += sizeof(double);
+            }
+          ++particle_no;
+        }
+    Assert(send_data ==
+             cache.subset_send_data.data() + cache.subset_send_data.size(),
+           ExcInternalError());
+
+    if (requests.size() > n_recv_requests)
+      {
+        const int ierr = MPI_Startall(requests.size() - n_recv_requests,
+                                      requests.data() + n_recv_requests);
+        AssertThrowMPI(ierr);
+      }
+    if (requests.size() > 0)
+      {
+        const int ierr =
+          MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+        AssertThrowMPI(ierr);
+      }
+
+    // Update the ghost particles in the order in which they are received
+    const char *recv_data = cache.subset_recv_data.data();
+    for (auto &recv_particle : cache.ghost_particles_iterators)
+      {
+        Assert(recv_particle->particles_in_cell->cell->is_ghost(),
+               ExcInternalError());
+
+        if (location_update != GhostLocationUpdate::none)
+          {
+            Point<spacedim> location = recv_particle->get_location();
+            if (send_delta)
+              for (unsigned int d = 0; d < spacedim; ++d)
+                {
+                  float delta;
+                  std::memcpy(&delta, recv_data, sizeof(float));
+                  recv_data += sizeof(float);
+                  location[d] += static_cast<double>(delta);
+                }
+            else
+              for (unsigned int d = 0; d < spacedim; ++d)
+                {
+                  std::memcpy(&location[d], recv_data, sizeof(double));
+                  recv_data += sizeof(double);
+                }
+            recv_particle->set_location(location);
+          }
+
+        const ArrayView<double> properties = recv_particle->get_properties();
+        for (const unsigned int index : property_indices)
+          {
+            std::memcpy(&properties[index], recv_data, sizeof(double));
+            recv_data += sizeof(double);
+          }
+      }
+
+    AssertThrow(recv_data ==
+                  cache.subset_recv_data.data() + cache.subset_recv_data.size(),
+                ExcMessage(
+                  "The amount of data that was read into ghost particles "
+                  "does not match the amount of data sent around."));
+
+    // Without a location update, the receivers still hold the previously
+    // sent locations
+    if (location_update != GhostLocationUpdate::none)
+      cache.sent_locations_valid = true;
   }
 #endif
 
@@ -2102,6 +2462,60 @@ namespace Particles
         tria_listeners.push_back(triangulation->signals.post_refinement.connect(
           [&]() { this->post_mesh_change_action(); }));
       }
+
+    if (particle_weight > 0)
+      tria_listeners.push_back(triangulation->signals.weight.connect(
+        [&](const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+            const typename Triangulation<dim, spacedim>::CellStatus     status)
+          -> unsigned int {
+          return this->cell_weight(cell, status, this->particle_weight);
+        }));
+  }
+
+
+
+  template <int dim, int spacedim>
+  unsigned int
+  ParticleHandler<dim, spacedim>::cell_weight(
+    const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+    const typename Triangulation<dim, spacedim>::CellStatus     status,
+    const unsigned int particle_weight) const
+  {
+    switch (status)
+      {
+        case parallel::TriangulationBase<dim, spacedim>::CELL_PERSIST:
+          return n_particles_in_cell(cell) * particle_weight;
+
+        case parallel::TriangulationBase<dim, spacedim>::CELL_REFINE:
+          // The function is called for each of the future children of the
+          // cell, so assign each of them its share of the particles
+          return n_particles_in_cell(cell) * particle_weight /
+                 cell->reference_cell().n_isotropic_children();
+
+        case parallel::TriangulationBase<dim, spacedim>::CELL_COARSEN:
+          {
+            types::particle_index n_particles = 0;
+            for (const auto &child : cell->child_iterators())
+              n_particles += n_particles_in_cell(child);
+            return n_particles * particle_weight;
+          }
+
+        default:
+          Assert(false, ExcInternalError());
+          return 0;
+      }
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  ParticleHandler<dim, spacedim>::set_particle_weight(
+    const unsigned int particle_weight)
+  {
+    this->particle_weight = particle_weight;
+    if (triangulation != nullptr)
+      connect_to_triangulation_signals();
   }
 
 
@@ -2287,44 +2701,20 @@ namespace Particles
     const typename Triangulation<dim, spacedim>::cell_iterator &cell,
     const typename Triangulation<dim, spacedim>::CellStatus     status) const
   {
-    std::vector<particle_iterator> stored_particles_on_cell;
-
+    // If the cell persists or is refined, store all particles of the current
+    // cell. If this cell is the parent of children that will be coarsened,
+    // collect the particles of all children.
+    types::particle_index n_particles = 0;
     switch (status)
       {
         case parallel::TriangulationBase<dim, spacedim>::CELL_PERSIST:
         case parallel::TriangulationBase<dim, spacedim>::CELL_REFINE:
-          // If the cell persist or is refined store all particles of the
-          // current cell.
-          {
-            const unsigned int n_particles = n_particles_in_cell(cell);
-            stored_particles_on_cell.reserve(n_particles);
-
-            for (unsigned int i = 0; i < n_particles; ++i)
-              stored_particles_on_cell.push_back(particle_iterator(
-                cells_to_particle_cache[cell->active_cell_index()],
-                *property_pool,
-                i));
-          }
+          n_particles = n_particles_in_cell(cell);
           break;
 
         case parallel::TriangulationBase<dim, spacedim>::CELL_COARSEN:
-          // If this cell is the parent of children that will be coarsened,
-          // collect the particles of all children.
-          {
-            for (const auto &child : cell->child_iterators())
-              {
-                const unsigned int n_particles = n_particles_in_cell(child);
-
-                stored_particles_on_cell.reserve(
-                  stored_particles_on_cell.size() + n_particles);
-
-                const typename particle_container::iterator &cache =
-                  cells_to_particle_cache[child->active_cell_index()];
-                for (unsigned int i = 0; i < n_particles; ++i)
-                  stored_particles_on_cell.push_back(
-                    particle_iterator(cache, *property_pool, i));
-              }
-          }
+          for (const auto &child : cell->child_iterators())
+            n_particles += n_particles_in_cell(child);
           break;
 
         default:
@@ -2332,7 +2722,42 @@ namespace Particles
           break;
       }
 
-    return pack_particles(stored_particles_on_cell);
+    std::vector<char> buffer;
+    if (n_particles == 0)
+      return buffer;
+
+    // All particles have the same size, so the buffer can be allocated at
+    // once and filled directly from the particle storage
+    void *data = nullptr;
+    const auto write_particles_of_cell =
+      [&](const typename Triangulation<dim, spacedim>::cell_iterator
+            &active_cell) {
+        const typename particle_container::iterator &cache =
+          cells_to_particle_cache[active_cell->active_cell_index()];
+        const unsigned int n_particles_in_this_cell =
+          n_particles_in_cell(active_cell);
+        for (unsigned int i = 0; i < n_particles_in_this_cell; ++i)
+          {
+            const particle_iterator particle(cache, *property_pool, i);
+            if (data == nullptr)
+              {
+                buffer.resize(n_particles *
+                              particle->serialized_size_in_bytes());
+                data = buffer.data();
+              }
+            data = particle->write_particle_data_to_memory(data);
+          }
+      };
+
+    if (status == parallel::TriangulationBase<dim, spacedim>::CELL_COARSEN)
+      for (const auto &child : cell->child_iterators())
+        write_particles_of_cell(child);
+    else
+      write_particles_of_cell(cell);
+
+    Assert(data == buffer.data() + buffer.size(), ExcInternalError());
+
+    return buffer;
   }
 
 
@@ -569,6 +569,23 @@ namespace SUNDIALS
               arkode_mem, data.implicit_function_is_time_independent ? 0 : 1);
             AssertARKode(status);
           }
+
+        // Control how often the linear solver setup and the Jacobian data of
+        // the preconditioner are updated
+        status = ARKStepSetLSetupFrequency(
+          arkode_mem, data.maximum_steps_between_linear_solver_setups);
+        AssertARKode(status);
+#  if DEAL_II_SUNDIALS_VERSION_LT(6, 0, 0)
+        status = ARKStepSetMaxStepsBetweenJac(
+          arkode_mem, data.maximum_steps_between_jacobian_evaluations);
+#  else
+        status = ARKStepSetJacEvalFrequency(
+          arkode_mem, data.maximum_steps_between_jacobian_evaluations);
+#  endif
+        AssertARKode(status);
+        status = ARKStepSetDeltaGammaMax(arkode_mem,
+                                         data.maximum_relative_gamma_change);
+        AssertARKode(status);
       }
     else
       {